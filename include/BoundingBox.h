@@ -0,0 +1,80 @@
+/**
+ * @file BoundingBox.h
+ * @brief Axis-aligned bounding box for Elemental Renderer
+ */
+
+#ifndef ELEMENTAL_RENDERER_BOUNDING_BOX_H
+#define ELEMENTAL_RENDERER_BOUNDING_BOX_H
+
+#include <glm/glm.hpp>
+#include <limits>
+
+namespace ElementalRenderer {
+
+/**
+ * @brief Axis-aligned bounding box
+ *
+ * A default-constructed box is empty (min > max) and grows with expand().
+ */
+struct BoundingBox {
+    glm::vec3 min = glm::vec3(std::numeric_limits<float>::max());
+    glm::vec3 max = glm::vec3(-std::numeric_limits<float>::max());
+
+    BoundingBox() = default;
+
+    BoundingBox(const glm::vec3& minCorner, const glm::vec3& maxCorner) : min(minCorner), max(maxCorner) {}
+
+    bool isEmpty() const { return min.x > max.x || min.y > max.y || min.z > max.z; }
+
+    void expand(const glm::vec3& point) {
+        min = glm::min(min, point);
+        max = glm::max(max, point);
+    }
+
+    void expand(const BoundingBox& other) {
+        min = glm::min(min, other.min);
+        max = glm::max(max, other.max);
+    }
+
+    glm::vec3 getCenter() const { return (min + max) * 0.5f; }
+
+    glm::vec3 getExtent() const { return max - min; }
+
+    /**
+     * @brief Get one of the eight corners
+     * @param index Corner index, bit 0/1/2 select max x/y/z
+     */
+    glm::vec3 getCorner(int index) const {
+        return glm::vec3((index & 1) ? max.x : min.x, (index & 2) ? max.y : min.y, (index & 4) ? max.z : min.z);
+    }
+
+    bool intersects(const BoundingBox& other) const {
+        return min.x <= other.max.x && max.x >= other.min.x && min.y <= other.max.y && max.y >= other.min.y
+            && min.z <= other.max.z && max.z >= other.min.z;
+    }
+
+    bool contains(const glm::vec3& point) const {
+        return point.x >= min.x && point.x <= max.x && point.y >= min.y && point.y <= max.y
+            && point.z >= min.z && point.z <= max.z;
+    }
+
+    /**
+     * @brief Bounds of this box after an affine transform
+     * @param transform Affine matrix
+     * @return Box enclosing the eight transformed corners
+     */
+    BoundingBox transformed(const glm::mat4& transform) const {
+        BoundingBox result;
+        if (isEmpty()) {
+            return result;
+        }
+        for (int i = 0; i < 8; ++i) {
+            result.expand(glm::vec3(transform * glm::vec4(getCorner(i), 1.0f)));
+        }
+        return result;
+    }
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_BOUNDING_BOX_H
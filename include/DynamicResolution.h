@@ -0,0 +1,102 @@
+/**
+ * @file DynamicResolution.h
+ * @brief Frame-time driven control of the internal render resolution
+ */
+
+#ifndef ELEMENTAL_RENDERER_DYNAMIC_RESOLUTION_H
+#define ELEMENTAL_RENDERER_DYNAMIC_RESOLUTION_H
+
+#include <cstdint>
+#include <glm/glm.hpp>
+
+namespace ElementalRenderer {
+
+/**
+ * @brief Controller tuning
+ */
+struct DynamicResolutionSettings {
+    float targetFrameTime = 1000.0f / 60.0f;    // Frame budget in milliseconds
+    float headroom = 0.9f;                      // Fraction of the budget the controller aims for
+    float minScale = 0.5f;                      // Render size per output size, per axis
+    float maxScale = 1.0f;
+    float proportionalGain = 0.3f;              // PID gains on the relative frame time error
+    float integralGain = 0.5f;
+    float derivativeGain = 0.1f;
+    float smoothing = 0.5f;                     // Weight of the newest frame in the filtered frame time
+    float hysteresis = 0.05f;                   // Relative errors within this band leave the scale alone
+    int alignment = 8;                          // Render sizes are multiples of this many pixels
+    float sharpness = 0.5f;                     // Upscale sharpening, see CPUPostProcessor::upscale()
+};
+
+/**
+ * @brief Controller state exposed for overlays and logging
+ */
+struct DynamicResolutionTelemetry {
+    float scale = 1.0f;                 // Applied scale, per axis
+    float frameTime = 0.0f;             // Last measured frame time in milliseconds
+    float filteredFrameTime = 0.0f;     // Exponential moving average of the frame time
+    uint64_t frameCount = 0;
+    uint64_t scaleChanges = 0;          // Frames on which the applied scale changed
+};
+
+/**
+ * @brief PID controller choosing the render resolution from frame times
+ *
+ * Rendering cost is taken to grow with the pixel count, so the controller
+ * works on the pixel fraction scale^2. The relative error between the
+ * budget (target frame time times headroom) and the filtered frame time
+ * drives a velocity-form PID update of the logarithm of that fraction,
+ * whose square root is the per-axis scale. Being incremental, the
+ * controller has no integral to wind up while the fraction is clamped to
+ * [minScale^2, maxScale^2], so it recovers at once from hardware that
+ * cannot reach the budget even at the minimum scale. Errors inside the
+ * hysteresis band count as zero, which keeps measurement noise from
+ * making the resolution flicker.
+ */
+class DynamicResolutionController {
+public:
+    explicit DynamicResolutionController(const DynamicResolutionSettings& settings = DynamicResolutionSettings());
+
+    /**
+     * @brief Change the tuning and restart at the maximum scale
+     */
+    void setSettings(const DynamicResolutionSettings& settings);
+
+    const DynamicResolutionSettings& getSettings() const { return m_settings; }
+
+    /**
+     * @brief Restart at the maximum scale with no frame history
+     */
+    void reset();
+
+    /**
+     * @brief Feed the duration of the last frame
+     * @param frameTime Frame time in milliseconds; non-positive values are ignored
+     * @return Scale to render the next frame at
+     */
+    float update(float frameTime);
+
+    float getScale() const { return m_telemetry.scale; }
+
+    /**
+     * @brief Internal render size for an output size at the current scale
+     *
+     * Sizes are rounded to the alignment but never exceed the output size
+     * or fall below one alignment step; at full scale the output size is
+     * returned unchanged.
+     */
+    glm::ivec2 getRenderSize(const glm::ivec2& outputSize) const;
+
+    const DynamicResolutionTelemetry& getTelemetry() const { return m_telemetry; }
+
+private:
+    DynamicResolutionSettings m_settings;
+    DynamicResolutionTelemetry m_telemetry;
+    float m_pixelFraction;
+    float m_previousError;
+    float m_olderError;
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_DYNAMIC_RESOLUTION_H
@@ -10,6 +10,7 @@
 #include <vector>
 #include <memory>
 #include <unordered_map>
+#include "DynamicResolution.h"
 
 namespace ElementalRenderer {
 
@@ -48,6 +49,8 @@ struct RendererOptions {
     bool vsync = true;
     bool fullscreen = false;
     bool enableDebug = false;
+    bool dynamicResolution = false;                     // Scale the render size to hold the frame budget
+    DynamicResolutionSettings dynamicResolutionSettings;
 };
 
 /**
@@ -0,0 +1,216 @@
+/**
+ * @file EditHistory.h
+ * @brief Command based undo/redo history storing only the changed fields
+ */
+
+#ifndef ELEMENTAL_RENDERER_EDIT_HISTORY_H
+#define ELEMENTAL_RENDERER_EDIT_HISTORY_H
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ElementalRenderer {
+
+/**
+ * @brief A reversible edit
+ *
+ * A command holds just the state it changes, so applying and reverting it
+ * costs time proportional to that delta rather than to the scene size.
+ */
+class EditCommand {
+public:
+    explicit EditCommand(std::string description) : m_description(std::move(description)) {}
+    virtual ~EditCommand() = default;
+
+    /**
+     * @brief Perform (or redo) the edit
+     */
+    virtual void apply() = 0;
+
+    /**
+     * @brief Undo the edit
+     */
+    virtual void revert() = 0;
+
+    /**
+     * @brief Approximate heap and object bytes held by the command
+     */
+    virtual size_t getMemoryUsage() const = 0;
+
+    /**
+     * @brief Fold a later edit of the same target into this one
+     * @param next Command recorded right after this one, already applied
+     * @return true if this command now covers both edits
+     */
+    virtual bool merge(const EditCommand& next) { (void)next; return false; }
+
+    const std::string& getDescription() const { return m_description; }
+
+protected:
+    std::string m_description;
+};
+
+/**
+ * @brief Bytes held by a stored property value
+ */
+template<typename T>
+size_t editValueSize(const T&) {
+    return sizeof(T);
+}
+
+inline size_t editValueSize(const std::string& value) {
+    return sizeof(value) + value.capacity();
+}
+
+template<typename T>
+size_t editValueSize(const std::vector<T>& value) {
+    return sizeof(value) + value.capacity() * sizeof(T);
+}
+
+/**
+ * @brief Edit of a single property, stored as its old and new value
+ *
+ * Commands sharing a non-empty merge key coalesce, so a drag that sets a
+ * light position every frame ends up as one step from the position before
+ * the drag to the one after it.
+ */
+template<typename T>
+class PropertyEditCommand : public EditCommand {
+public:
+    using Setter = std::function<void(const T&)>;
+
+    PropertyEditCommand(std::string description, std::string mergeKey, T before, T after, Setter setter)
+        : EditCommand(std::move(description))
+        , m_mergeKey(std::move(mergeKey))
+        , m_before(std::move(before))
+        , m_after(std::move(after))
+        , m_setter(std::move(setter)) {}
+
+    void apply() override { m_setter(m_after); }
+    void revert() override { m_setter(m_before); }
+
+    size_t getMemoryUsage() const override {
+        return sizeof(*this) + m_description.capacity() + m_mergeKey.capacity()
+             + editValueSize(m_before) + editValueSize(m_after) - 2 * sizeof(T);
+    }
+
+    bool merge(const EditCommand& next) override {
+        const auto* property = dynamic_cast<const PropertyEditCommand<T>*>(&next);
+        if (!property || m_mergeKey.empty() || property->m_mergeKey != m_mergeKey) {
+            return false;
+        }
+        m_after = property->m_after;
+        return true;
+    }
+
+    const std::string& getMergeKey() const { return m_mergeKey; }
+    const T& getBefore() const { return m_before; }
+    const T& getAfter() const { return m_after; }
+
+private:
+    std::string m_mergeKey;
+    T m_before;
+    T m_after;
+    Setter m_setter;
+};
+
+/**
+ * @brief Undo and redo stacks of edit commands under a memory budget
+ *
+ * While coalescing is open (typically for the duration of a drag) each new
+ * command is offered to the newest undo step first and only pushed when it
+ * cannot be merged. Once the commands exceed the memory budget the oldest
+ * undo steps are dropped; the newest step is always kept.
+ */
+class EditHistory {
+public:
+    explicit EditHistory(size_t memoryBudget = 64u * 1024u * 1024u);
+
+    /**
+     * @brief Apply a command and record it
+     */
+    void execute(std::unique_ptr<EditCommand> command);
+
+    /**
+     * @brief Record a command whose edit has already been applied
+     *
+     * Clears the redo stack.
+     */
+    void record(std::unique_ptr<EditCommand> command);
+
+    /**
+     * @brief Start merging consecutive commands into one undo step
+     */
+    void beginCoalescing();
+
+    /**
+     * @brief Seal the current undo step; later commands start a new one
+     */
+    void endCoalescing();
+
+    bool isCoalescing() const { return m_coalescing; }
+
+    /**
+     * @brief Revert the newest undo step
+     * @return true if there was a step to undo
+     */
+    bool undo();
+
+    /**
+     * @brief Reapply the newest undone step
+     * @return true if there was a step to redo
+     */
+    bool redo();
+
+    bool canUndo() const { return !m_undoStack.empty(); }
+    bool canRedo() const { return !m_redoStack.empty(); }
+
+    size_t getUndoCount() const { return m_undoStack.size(); }
+    size_t getRedoCount() const { return m_redoStack.size(); }
+
+    /**
+     * @brief Description of the step undo() would revert, or an empty string
+     */
+    std::string getUndoDescription() const;
+
+    /**
+     * @brief Description of the step redo() would reapply, or an empty string
+     */
+    std::string getRedoDescription() const;
+
+    /**
+     * @brief Drop all undo and redo steps
+     */
+    void clear();
+
+    /**
+     * @brief Change the memory budget, trimming the oldest steps if needed
+     */
+    void setMemoryBudget(size_t bytes);
+
+    size_t getMemoryBudget() const { return m_memoryBudget; }
+
+    /**
+     * @brief Bytes held by all undo and redo steps
+     */
+    size_t getMemoryUsage() const { return m_memoryUsage; }
+
+private:
+    void clearRedo();
+    void trim();
+
+    std::deque<std::unique_ptr<EditCommand>> m_undoStack;
+    std::vector<std::unique_ptr<EditCommand>> m_redoStack;
+    size_t m_memoryBudget;
+    size_t m_memoryUsage;
+    bool m_coalescing;
+    bool m_mergeable;       // The newest undo step was recorded in the open coalescing span
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_EDIT_HISTORY_H
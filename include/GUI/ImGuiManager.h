@@ -169,7 +169,8 @@ private:
     void drawRenderGraph(RenderGraph* graph);
     void drawPerformanceGraph();
     void drawMaterialProperties(Material* material);
-    void drawLightProperties(Light* light);
+    bool drawLightProperties(Light* light);     // True if a property was edited
+    void notifyLightEdited(const Light* light);
     void drawBRDFProperties(LightingModel* lightingModel);
 
     // Internal state
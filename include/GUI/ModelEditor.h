@@ -8,6 +8,7 @@
 #include "../Mesh.h"
 #include "../Material.h"
 #include "../Texture.h"
+#include "../HalfEdgeMesh.h"
 
 /**
  * ModelEditor class provides functionality for users to create and edit 3D models
@@ -25,13 +26,19 @@ public:
     void renderEditorUI();
     void handleInput();
     
-    // Model creation and manipulation
+    // Model creation and manipulation. Vertex and face indices stay valid
+    // across removals (removed slots are reused) until the model is exported
     void createNewModel(const std::string& name);
     void addVertex(float x, float y, float z);
     void addFace(const std::vector<int>& vertexIndices);
     void removeVertex(int index);
     void removeFace(int index);
     void moveVertex(int index, float x, float y, float z);
+
+    // While a drag is active, moved vertices only mark their neighbourhood;
+    // normals and tangents are brought up to date once per frame in one batch
+    void beginVertexDrag();
+    void endVertexDrag();
     
     // Texture and material handling
     void assignMaterial(int faceIndex, const std::shared_ptr<Material>& material);
@@ -48,16 +55,13 @@ public:
 private:
     struct EditableMesh {
         std::string name;
-        std::vector<float> vertices;
-        std::vector<float> normals;
-        std::vector<float> texCoords;
-        std::vector<unsigned int> indices;
+        ElementalRenderer::HalfEdgeMesh geometry;   // Faces carry their material index
         std::vector<std::shared_ptr<Material>> materials;
-        std::vector<int> materialIndices; // Material index for each face
     };
 
     EditableMesh currentMesh;
     bool modified;
+    bool dragging;
     
     // Helper methods
     void calculateNormals();
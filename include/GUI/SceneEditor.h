@@ -12,6 +12,9 @@
 #include <functional>
 #include "../Scene.h"
 #include "../Camera.h"
+#include "../SceneSnapshot.h"
+#include "EditHistory.h"
+#include "ScenePicker.h"
 
 namespace ElementalRenderer {
 
@@ -26,15 +29,6 @@ enum class EditorMode {
     ANIMATION
 };
 
-/**
- * @brief Stores scene state for undo/redo functionality
- */
-struct SceneHistoryState {
-    // Serialized scene state for undo/redo
-    std::string serializedScene;
-    std::string description;
-};
-
 /**
  * @brief Scene editor state management
  */
@@ -90,6 +84,8 @@ public:
     
     /**
      * @brief Set the dragging state
+     *
+     * Edits recorded while dragging coalesce into a single undo step.
      * @param dragging true to enable dragging, false to disable
      */
     void setDragging(bool dragging);
@@ -107,10 +103,24 @@ public:
     void setPlaying(bool playing);
     
     /**
-     * @brief Save the current scene state to the undo stack
+     * @brief Apply an edit and push it onto the undo history
+     * @param command Edit to perform
+     */
+    void execute(std::unique_ptr<EditCommand> command);
+    
+    /**
+     * @brief Change a property through the undo history
      * @param description Description of the action
+     * @param mergeKey Identifies the property so repeated edits during a drag coalesce; empty never merges
+     * @param before Current value, restored on undo
+     * @param after New value
+     * @param setter Writes a value to the property
      */
-    void saveState(const std::string& description);
+    template<typename T>
+    void editProperty(const std::string& description, const std::string& mergeKey,
+                      const T& before, const T& after, std::function<void(const T&)> setter) {
+        execute(std::make_unique<PropertyEditCommand<T>>(description, mergeKey, before, after, std::move(setter)));
+    }
     
     /**
      * @brief Undo the last action
@@ -136,6 +146,12 @@ public:
      */
     bool canRedo() const;
     
+    /**
+     * @brief Get the undo/redo history
+     * @return History of the recorded edits
+     */
+    EditHistory& getHistory();
+    
     /**
      * @brief Get the scene being edited
      * @return Shared pointer to the scene
@@ -148,6 +164,58 @@ public:
      */
     std::shared_ptr<Camera> getCamera() const;
     
+    /**
+     * @brief Write the scene and the editor view to a snapshot file
+     * @param filePath Destination, replaced atomically
+     * @return true if the file was written
+     */
+    bool saveSnapshot(const std::string& filePath) const;
+    
+    /**
+     * @brief Replace the scene and the editor view with a snapshot file
+     *
+     * Clears the undo history, which refers to the previous scene.
+     * @param filePath Snapshot to open
+     * @param resolver Supplies the geometry of each mesh reference
+     * @return true if the snapshot was loaded
+     */
+    bool loadSnapshot(const std::string& filePath, const SnapshotMeshResolver& resolver);
+    
+    /**
+     * @brief Set the size of the viewport the scene is shown in
+     * @param size Viewport size in pixels, used to turn cursor positions into rays
+     */
+    void setViewportSize(const glm::ivec2& size);
+    
+    /**
+     * @brief Find the mesh under the cursor
+     * @param xpos Cursor X position in pixels
+     * @param ypos Cursor Y position in pixels
+     * @param hit Output hit; hit.object is the mesh index
+     * @return true if a mesh was hit
+     */
+    bool pickObject(double xpos, double ypos, PickHit& hit);
+    
+    /**
+     * @brief Meshes whose bounds overlap a rectangle dragged on screen
+     * @param cursorStart Cursor position where the drag started
+     * @param cursorEnd Cursor position where the drag ended
+     * @return Indices of the selected meshes
+     */
+    std::vector<int> selectRectangle(const glm::vec2& cursorStart, const glm::vec2& cursorEnd);
+    
+    /**
+     * @brief Meshes whose bounds overlap a lasso drawn on screen
+     * @param cursorPath Cursor positions along the lasso
+     * @return Indices of the selected meshes
+     */
+    std::vector<int> selectLasso(const std::vector<glm::vec2>& cursorPath);
+    
+    /**
+     * @brief Get the picking structure, kept in sync with the scene's meshes
+     */
+    ScenePicker& getPicker();
+    
     /**
      * @brief Render the scene editor UI
      */
@@ -177,15 +245,20 @@ private:
     bool m_isDragging;
     bool m_isPlaying;
     
-    std::vector<SceneHistoryState> m_undoStack;
-    std::vector<SceneHistoryState> m_redoStack;
+    EditHistory m_history;
+    ScenePicker m_picker;
+    glm::ivec2 m_viewportSize;
     
     std::shared_ptr<Scene> m_scene;
     std::shared_ptr<Camera> m_camera;
+    size_t m_sceneListener;
+    bool m_hasSceneListener;
     
     // Helper functions
-    std::string serializeScene() const;
-    void deserializeScene(const std::string& data);
+    void onSceneChanged(const SceneChange& change);
+    void addPickableMesh(size_t index);
+    void rebuildPicker();
+    std::vector<int> toMeshIndices(const std::vector<uint32_t>& ids) const;
 };
 
 } // namespace ElementalRenderer
@@ -0,0 +1,174 @@
+/**
+ * @file ScenePicker.h
+ * @brief Ray picking and rectangle/lasso selection through a two-level BVH
+ */
+
+#ifndef ELEMENTAL_RENDERER_SCENE_PICKER_H
+#define ELEMENTAL_RENDERER_SCENE_PICKER_H
+
+#include "../BoundingBox.h"
+#include "../PathTracing/TriangleBVH.h"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace ElementalRenderer {
+
+/**
+ * @brief Fills in the object-space triangles of a pickable object
+ *
+ * Called the first time a ray reaches the object's bounds, and again after
+ * the geometry is invalidated.
+ */
+using PickGeometrySource = std::function<void(std::vector<glm::vec3>& positions, std::vector<unsigned int>& indices)>;
+
+/**
+ * @brief Closest object under a picking ray
+ */
+struct PickHit {
+    uint32_t object = 0;                    // Id passed to ScenePicker::setObject()
+    uint32_t triangle = 0;                  // Triangle index within the object's geometry
+    glm::vec3 barycentrics = glm::vec3(0.0f);   // Weights of the triangle's three vertices
+    glm::vec3 position = glm::vec3(0.0f);   // World-space hit point
+    float t = 0.0f;                         // Ray parameter of the hit
+};
+
+/**
+ * @brief Object picking for the editor
+ *
+ * Objects are registered with an id, a transform and object-space bounds.
+ * A binary BVH over their world bounds finds the candidates for a ray, and
+ * each candidate's triangles live in a TriangleBVH that is built on the
+ * first ray to reach it and kept until its geometry is invalidated. Moving
+ * an object refits the top level instead of rebuilding it; adding or
+ * removing objects rebuilds it on the next query.
+ *
+ * Rectangle and lasso selection intersect the top level with the frustum
+ * through the selected screen region and report the objects whose world
+ * bounds fall inside it.
+ */
+class ScenePicker {
+public:
+    ScenePicker();
+    ~ScenePicker();
+
+    /**
+     * @brief Add an object or replace one with the same id
+     * @param id Caller's identifier, reported in hits and selections
+     * @param localBounds Object-space bounds of the geometry
+     * @param source Supplies the geometry when first needed
+     * @param transform Object-to-world affine transform
+     */
+    void setObject(uint32_t id, const BoundingBox& localBounds, PickGeometrySource source,
+                   const glm::mat4& transform = glm::mat4(1.0f));
+
+    /**
+     * @brief Move an object without touching its triangle BVH
+     * @return false for unknown ids
+     */
+    bool setTransform(uint32_t id, const glm::mat4& transform);
+
+    /**
+     * @brief Drop an object's triangle BVH after its geometry changed
+     * @param localBounds New object-space bounds
+     * @return false for unknown ids
+     */
+    bool invalidateGeometry(uint32_t id, const BoundingBox& localBounds);
+
+    bool removeObject(uint32_t id);
+
+    void clear();
+
+    size_t getObjectCount() const { return m_objects.size(); }
+
+    /**
+     * @brief Number of objects whose triangle BVH is currently built
+     */
+    size_t getCachedObjectCount() const;
+
+    /**
+     * @brief Ray through a point on the screen
+     * @param viewProjection Camera projection times view
+     * @param ndc Normalized device coordinates, in [-1, 1] with +y up
+     * @return Ray from the near plane to the far plane, with tMax = 1
+     */
+    static Ray unproject(const glm::mat4& viewProjection, const glm::vec2& ndc);
+
+    /**
+     * @brief Convert a cursor position to normalized device coordinates
+     * @param cursor Window position in pixels, origin at the top left
+     * @param viewport Window size in pixels
+     */
+    static glm::vec2 cursorToNDC(const glm::vec2& cursor, const glm::ivec2& viewport);
+
+    /**
+     * @brief Find the closest object along a ray
+     * @param ray World-space ray
+     * @param hit Output hit, untouched on a miss
+     * @return True if an object was hit
+     */
+    bool pick(const Ray& ray, PickHit& hit);
+
+    /**
+     * @brief Objects whose bounds overlap a screen rectangle
+     * @param viewProjection Camera projection times view
+     * @param ndcMin One corner of the rectangle in normalized device coordinates
+     * @param ndcMax The opposite corner
+     * @return Ids of the selected objects
+     */
+    std::vector<uint32_t> selectRectangle(const glm::mat4& viewProjection, const glm::vec2& ndcMin,
+                                          const glm::vec2& ndcMax);
+
+    /**
+     * @brief Objects whose projected bounds overlap a lasso polygon
+     *
+     * The frustum through the lasso's bounding rectangle gathers the
+     * candidates, which are then kept if the screen rectangle of their
+     * projected bounds overlaps the polygon.
+     *
+     * @param viewProjection Camera projection times view
+     * @param lasso Polygon in normalized device coordinates
+     * @return Ids of the selected objects
+     */
+    std::vector<uint32_t> selectLasso(const glm::mat4& viewProjection, const std::vector<glm::vec2>& lasso);
+
+private:
+    struct Object {
+        uint32_t id = 0;
+        BoundingBox localBounds;
+        BoundingBox worldBounds;
+        glm::mat4 transform = glm::mat4(1.0f);
+        glm::mat4 inverseTransform = glm::mat4(1.0f);
+        PickGeometrySource source;
+        std::unique_ptr<TriangleBVH> triangles;     // Built on demand
+        int leaf = -1;                              // Node holding the object, -1 before a rebuild
+    };
+
+    struct Node {
+        BoundingBox bounds;
+        int parent = -1;
+        int children[2] = {-1, -1};
+        uint32_t first = 0;     // Range of m_order for a leaf
+        uint32_t count = 0;     // Object count of a leaf, 0 for interior nodes
+    };
+
+    void update();
+    int buildRecursive(uint32_t begin, uint32_t end, int parent);
+    void markMoved(size_t object);
+    const TriangleBVH& getTriangles(Object& object);
+    std::vector<uint32_t> selectFrustum(const glm::vec4 (&planes)[6]) const;
+
+    std::vector<Object> m_objects;
+    std::unordered_map<uint32_t, size_t> m_objectIndices;     // Id to index in m_objects
+    std::vector<Node> m_nodes;                                // Parents precede their children
+    std::vector<uint32_t> m_order;                            // Object indices in leaf order
+    std::vector<int> m_dirtyNodes;                            // Leaves whose objects moved
+    bool m_needsRebuild;
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_SCENE_PICKER_H
@@ -0,0 +1,313 @@
+/**
+ * @file HalfEdgeMesh.h
+ * @brief Editable polygon mesh with half-edge adjacency
+ */
+
+#ifndef ELEMENTAL_RENDERER_HALF_EDGE_MESH_H
+#define ELEMENTAL_RENDERER_HALF_EDGE_MESH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace ElementalRenderer {
+
+/**
+ * @brief Polygon mesh for interactive editing
+ *
+ * Every face is a loop of half-edges; each half-edge knows its origin
+ * vertex, its face, the next and previous half-edge of that face and the
+ * opposite half-edge of the neighbouring face (-1 on a boundary). Each
+ * vertex keeps one outgoing half-edge. Adjacency queries follow these
+ * links, so they cost time proportional to the answer rather than to the
+ * mesh size.
+ *
+ * Vertex and face ids stay stable while editing: removed elements leave
+ * holes that are put on free lists and reused by later additions.
+ * compact() closes the holes, typically before export.
+ *
+ * Only boundary half-edges are kept in a map from (origin, target) to
+ * half-edge, which is how a new face finds its neighbours. A closed mesh
+ * therefore carries no lookup structure at all.
+ *
+ * A vertex may carry several open fans at once, as happens while faces
+ * are added in any order or after a face is removed from the middle of a
+ * fan. Vertex queries visit every fan, reaching the others through their
+ * boundary half-edges, and a face that fills the gap between two fans
+ * joins them through its twins. addFace only rejects faces that would
+ * leave a vertex non-manifold: a closed fan with other faces at the same
+ * vertex.
+ *
+ * Vertex normals and tangents are derived from per-face frames that are
+ * cached between updates. Edits mark the faces and vertices they touch as
+ * dirty, and updateNormals() recomputes only those, so moving a vertex
+ * costs its one-ring rather than the whole mesh. Edits made over several
+ * calls, such as the steps of a drag, accumulate into one batch.
+ */
+class HalfEdgeMesh {
+public:
+    static constexpr int32_t kInvalid = -1;
+
+    struct HalfEdge {
+        int32_t origin = kInvalid;
+        int32_t face = kInvalid;        // kInvalid once the half-edge is removed
+        int32_t next = kInvalid;
+        int32_t prev = kInvalid;
+        int32_t twin = kInvalid;        // kInvalid on a boundary
+    };
+
+    HalfEdgeMesh();
+
+    void clear();
+
+    void reserve(size_t vertexCount, size_t faceCount);
+
+    /**
+     * @brief Add an isolated vertex
+     * @return Vertex id
+     */
+    int32_t addVertex(const glm::vec3& position, const glm::vec2& texCoord = glm::vec2(0.0f));
+
+    /**
+     * @brief Add a polygon
+     * @param vertices At least three distinct vertex ids, counter-clockwise
+     * @param material Material slot of the face
+     * @return Face id, or kInvalid if the vertices are invalid, an edge is
+     *         already used in the same direction (inconsistent winding), or a
+     *         vertex would end up with a closed fan beside other faces
+     */
+    int32_t addFace(const std::vector<int32_t>& vertices, int32_t material = 0);
+
+    /**
+     * @brief Remove a face; its vertices stay
+     */
+    bool removeFace(int32_t face);
+
+    /**
+     * @brief Remove a vertex and every face using it
+     */
+    bool removeVertex(int32_t vertex);
+
+    bool isVertexValid(int32_t vertex) const;
+    bool isFaceValid(int32_t face) const;
+
+    const glm::vec3& getPosition(int32_t vertex) const { return m_positions[vertex]; }
+    const glm::vec3& getNormal(int32_t vertex) const { return m_normals[vertex]; }
+
+    /**
+     * @brief Unit tangent along +u in xyz, bitangent handedness (+1 or -1) in w
+     */
+    const glm::vec4& getTangent(int32_t vertex) const { return m_tangents[vertex]; }
+    const glm::vec2& getTexCoord(int32_t vertex) const { return m_texCoords[vertex]; }
+    int32_t getFaceMaterial(int32_t face) const { return m_faceMaterials[face]; }
+
+    /**
+     * @brief Move a vertex and mark the faces around it dirty
+     */
+    bool setPosition(int32_t vertex, const glm::vec3& position);
+
+    /**
+     * @brief Override a vertex normal until an update next recomputes it
+     */
+    bool setNormal(int32_t vertex, const glm::vec3& normal);
+
+    /**
+     * @brief Change a texture coordinate and mark the faces around it dirty, as tangents follow it
+     */
+    bool setTexCoord(int32_t vertex, const glm::vec2& texCoord);
+    bool setFaceMaterial(int32_t face, int32_t material);
+
+    /**
+     * @brief Live element counts
+     */
+    size_t getVertexCount() const { return m_vertexHalfEdges.size() - m_freeVertices.size(); }
+    size_t getFaceCount() const { return m_faceHalfEdges.size() - m_freeFaces.size(); }
+    size_t getHalfEdgeCount() const { return m_halfEdges.size() - m_freeHalfEdges.size(); }
+
+    /**
+     * @brief One past the largest id ever handed out; ids below it may be holes
+     */
+    size_t getVertexCapacity() const { return m_vertexHalfEdges.size(); }
+    size_t getFaceCapacity() const { return m_faceHalfEdges.size(); }
+
+    const HalfEdge& getHalfEdge(int32_t halfEdge) const { return m_halfEdges[halfEdge]; }
+
+    /**
+     * @brief Vertex a half-edge points to
+     */
+    int32_t getTarget(int32_t halfEdge) const { return m_halfEdges[m_halfEdges[halfEdge].next].origin; }
+
+    /**
+     * @brief One half-edge of a face
+     */
+    int32_t getFaceHalfEdge(int32_t face) const { return m_faceHalfEdges[face]; }
+
+    /**
+     * @brief One outgoing half-edge of a vertex, kInvalid if it has no faces
+     */
+    int32_t getVertexHalfEdge(int32_t vertex) const;
+
+    void getFaceVertices(int32_t face, std::vector<int32_t>& vertices) const;
+
+    /**
+     * @brief Faces around a vertex
+     *
+     * Walks the fan of faces reached through the vertex's outgoing
+     * half-edge in both directions, so open fans on boundaries are covered,
+     * then any fan split off from it by removeFace.
+     */
+    void getVertexFaces(int32_t vertex, std::vector<int32_t>& faces) const;
+
+    /**
+     * @brief Vertices sharing an edge with a vertex
+     */
+    void getVertexNeighbors(int32_t vertex, std::vector<int32_t>& neighbors) const;
+
+    /**
+     * @brief Faces sharing an edge with a face
+     */
+    void getFaceNeighbors(int32_t face, std::vector<int32_t>& neighbors) const;
+
+    bool isBoundaryVertex(int32_t vertex) const;
+
+    /**
+     * @brief Call fn(halfEdge) for each half-edge of a face, in order
+     */
+    template<typename Function>
+    void forEachFaceHalfEdge(int32_t face, Function fn) const {
+        const int32_t first = m_faceHalfEdges[face];
+        int32_t halfEdge = first;
+        do {
+            fn(halfEdge);
+            halfEdge = m_halfEdges[halfEdge].next;
+        } while (halfEdge != first);
+    }
+
+    /**
+     * @brief Call fn(halfEdge) for each half-edge leaving a vertex
+     */
+    template<typename Function>
+    void forEachOutgoing(int32_t vertex, Function fn) const {
+        const int32_t first = getVertexHalfEdge(vertex);
+        if (first < 0) {
+            return;
+        }
+        // Rotate one way until the fan closes or a boundary stops it ...
+        int32_t halfEdge = first;
+        do {
+            fn(halfEdge);
+            halfEdge = m_halfEdges[m_halfEdges[halfEdge].prev].twin;
+        } while (halfEdge >= 0 && halfEdge != first);
+        if (halfEdge == first) {
+            return;
+        }
+        // ... then the other way from the start to the other boundary
+        halfEdge = first;
+        for (int32_t twin = m_halfEdges[first].twin; twin >= 0; twin = m_halfEdges[halfEdge].twin) {
+            halfEdge = m_halfEdges[twin].next;
+            fn(halfEdge);
+        }
+        // Every open fan ends in one outgoing boundary half-edge, so other fans
+        // left by removeFace start at the vertex's other boundary half-edges
+        for (auto it = m_boundaryEdges.lower_bound(edgeKey(vertex, 0));
+             it != m_boundaryEdges.end() && (it->first >> 32) == static_cast<uint32_t>(vertex); ++it) {
+            if (it->second == halfEdge) {
+                continue;
+            }
+            for (int32_t other = it->second; other >= 0; other = m_halfEdges[m_halfEdges[other].prev].twin) {
+                fn(other);
+            }
+        }
+    }
+
+    /**
+     * @brief Remove the holes left by deleted elements
+     * @param vertexRemap Optional output, new id of each old vertex or kInvalid
+     * @param faceRemap Optional output, new id of each old face or kInvalid
+     */
+    void compact(std::vector<int32_t>* vertexRemap = nullptr, std::vector<int32_t>* faceRemap = nullptr);
+
+    /**
+     * @brief Fan-triangulate the live faces for rendering
+     *
+     * Vertices are numbered as compact() would number them.
+     *
+     * @param triangleMaterials Optional output, material of each triangle
+     */
+    void triangulate(std::vector<glm::vec3>& positions, std::vector<glm::vec3>& normals,
+                     std::vector<glm::vec2>& texCoords, std::vector<unsigned int>& indices,
+                     std::vector<int32_t>* triangleMaterials = nullptr) const;
+
+    /**
+     * @brief Recompute every face frame and vertex normal and tangent
+     *
+     * Each vertex gets the normalized sum of the unit normals of its faces;
+     * vertices without faces point up. Tangents are the sum of the face
+     * tangents made orthogonal to the normal. Faces and then vertices are
+     * processed in parallel, and the dirty sets are cleared.
+     */
+    void computeNormals();
+
+    /**
+     * @brief Recompute the normals and tangents affected by edits since the last update
+     *
+     * Dirty faces get a new frame and their vertices are re-accumulated from
+     * the cached frames of the faces around them. Batches covering a large
+     * part of the mesh fall back to computeNormals().
+     *
+     * @return Number of vertices whose normal and tangent were recomputed
+     */
+    size_t updateNormals();
+
+    /**
+     * @brief Number of faces waiting for updateNormals()
+     */
+    size_t getDirtyFaceCount() const { return m_dirtyFaces.size(); }
+
+    /**
+     * @brief Unit normal of a face, from Newell's method so polygons may be non-planar
+     */
+    glm::vec3 computeFaceNormal(int32_t face) const;
+
+private:
+    static constexpr int32_t kRemoved = -2;     // m_vertexHalfEdges entry of a removed vertex
+
+    static uint64_t edgeKey(int32_t origin, int32_t target) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(origin)) << 32) | static_cast<uint32_t>(target);
+    }
+
+    int32_t allocateHalfEdge();
+    int32_t findBoundaryOutgoing(int32_t vertex) const;
+    bool keepsVertexManifold(int32_t vertex, int32_t previous, int32_t next) const;
+    void markFaceDirty(int32_t face);
+    void markVertexDirty(int32_t vertex);
+    void markFanDirty(int32_t vertex);
+    void computeFaceFrame(int32_t face);
+    void computeVertexFrame(int32_t vertex);
+
+    std::vector<glm::vec3> m_positions;
+    std::vector<glm::vec3> m_normals;
+    std::vector<glm::vec2> m_texCoords;
+    std::vector<glm::vec4> m_tangents;
+    std::vector<int32_t> m_vertexHalfEdges;     // Outgoing half-edge, kInvalid if isolated, kRemoved if removed
+    std::vector<int32_t> m_faceHalfEdges;       // kInvalid for removed faces
+    std::vector<int32_t> m_faceMaterials;
+    std::vector<glm::vec3> m_faceNormals;       // Cached frames, valid for faces that are not dirty
+    std::vector<glm::vec3> m_faceTangents;
+    std::vector<glm::vec3> m_faceBitangents;
+    std::vector<HalfEdge> m_halfEdges;
+    std::vector<int32_t> m_freeVertices;
+    std::vector<int32_t> m_freeFaces;
+    std::vector<int32_t> m_freeHalfEdges;
+    std::map<uint64_t, int32_t> m_boundaryEdges;   // (origin, target) of every half-edge without a twin
+    std::vector<int32_t> m_dirtyFaces;
+    std::vector<int32_t> m_dirtyVertices;
+    std::vector<uint8_t> m_faceDirty;           // Membership flags for the dirty lists
+    std::vector<uint8_t> m_vertexDirty;
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_HALF_EDGE_MESH_H
@@ -0,0 +1,81 @@
+/**
+ * @file AmbientOcclusion.h
+ * @brief CPU screen-space ambient occlusion over the headless G-buffer
+ */
+
+#ifndef ELEMENTAL_RENDERER_HEADLESS_AMBIENT_OCCLUSION_H
+#define ELEMENTAL_RENDERER_HEADLESS_AMBIENT_OCCLUSION_H
+
+#include "GBuffer.h"
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace ElementalRenderer {
+
+/**
+ * @brief Occlusion estimator
+ */
+enum class AmbientOcclusionMode {
+    HEMISPHERE, // Normal-oriented sample kernel, same as SSAOShader
+    HORIZON     // Horizon-based (HBAO), marches screen-space directions
+};
+
+/**
+ * @brief Parameters of the ambient occlusion stage
+ */
+struct AmbientOcclusionSettings {
+    AmbientOcclusionMode mode = AmbientOcclusionMode::HORIZON;
+    float radius = 0.5f;        // View-space sampling radius
+    float bias = 0.025f;        // Depth bias (hemisphere) or horizon angle bias (sine, horizon)
+    float intensity = 1.0f;     // Scales the occlusion before it is subtracted from 1
+    int kernelSize = 32;        // Hemisphere samples, at most kMaxKernelSize
+    int directionCount = 8;     // Horizon directions per pixel
+    int stepCount = 4;          // Horizon samples per direction
+    int downsample = 2;         // Occlusion is computed at 1/downsample resolution and upsampled
+    bool blur = true;           // Depth-aware 4x4 blur that removes the rotation noise pattern
+    int tileSize = 32;          // Square tile processed by one task, in working-resolution pixels
+};
+
+/**
+ * @brief Screen-space ambient occlusion evaluated on the CPU
+ *
+ * Works from a GBuffer with its projection set: positions are reconstructed
+ * from linear depth. The hemisphere mode uses the kernel and 4x4 rotation
+ * noise generated exactly like SSAOShader, so for downsample = 1 and the blur
+ * disabled it is a reference for validating the GPU pass. Occlusion runs over
+ * tiles in parallel; at reduced resolution each block keeps its nearest texel
+ * and the result is brought back with a depth- and normal-aware bilateral
+ * upsample so silhouettes do not bleed.
+ */
+class AmbientOcclusion {
+public:
+    static const int kMaxKernelSize = 64;
+    static const int kNoiseSize = 4;
+
+    /**
+     * @brief Compute ambient visibility for every pixel
+     * @param gbuffer View-space normals, linear depth and projection
+     * @param settings Mode, radius and quality settings
+     * @param visibility Output in [0, 1] (1 is unoccluded, background is 1), row-major
+     */
+    static void compute(const GBuffer& gbuffer, const AmbientOcclusionSettings& settings,
+                        std::vector<float>& visibility);
+
+    /**
+     * @brief Hemisphere sample kernel, identical to SSAOShader::generateSampleKernel
+     * @param kernelSize Number of samples
+     * @return Tangent-space samples with z >= 0, denser near the origin
+     */
+    static std::vector<glm::vec3> generateSampleKernel(int kernelSize);
+
+    /**
+     * @brief Rotation noise, identical to SSAOShader::generateNoiseTexture
+     * @param size Noise tile size (the tile repeats over the screen)
+     * @return size * size tangent-plane vectors, row-major
+     */
+    static std::vector<glm::vec3> generateNoise(int size);
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_HEADLESS_AMBIENT_OCCLUSION_H
@@ -0,0 +1,100 @@
+/**
+ * @file BRDF.h
+ * @brief CPU evaluation of the shader lighting models
+ */
+
+#ifndef ELEMENTAL_RENDERER_HEADLESS_BRDF_H
+#define ELEMENTAL_RENDERER_HEADLESS_BRDF_H
+
+#include <cstddef>
+#include <functional>
+#include <glm/glm.hpp>
+
+namespace ElementalRenderer {
+
+/**
+ * @brief Lighting models, numbered like the lightingModel uniform of MainFragmentShader.glsl
+ */
+enum class BRDFModel {
+    PHONG = 0,
+    BLINN_PHONG = 1,
+    OREN_NAYAR = 2,
+    COOK_TORRANCE = 3,
+    GGX = 4,
+    PHYSICALLY_BASED = 5,
+    CUSTOM = 6
+};
+
+/**
+ * @brief Microfacet distributions of the Cook-Torrance model (lighting.distribution)
+ */
+enum class MicrofacetDistribution {
+    BECKMANN = 0,
+    GGX = 1,
+    BLINN_PHONG = 2
+};
+
+/**
+ * @brief CPU counterpart of a custom GLSL BRDF (calculateCustomBRDF)
+ *
+ * Receives the normal, light and view directions, the albedo and
+ * (param1, param2, param3, param4) and returns the reflected radiance factor,
+ * cosine included, like the shader function.
+ */
+using CustomBRDFCallback = std::function<glm::vec3(const glm::vec3& normal, const glm::vec3& lightDir,
+                                                   const glm::vec3& viewDir, const glm::vec3& albedo,
+                                                   const glm::vec4& params)>;
+
+/**
+ * @brief Material uniforms shared by a batch, named after the shader uniforms
+ */
+struct BRDFMaterial {
+    glm::vec3 albedo = glm::vec3(1.0f);
+    float roughness = 0.3f;         // lighting.roughness (the PBR model reads the same value)
+    float metallic = 0.0f;
+    float fresnel = 0.04f;          // Scalar F0 of Cook-Torrance and GGX
+    MicrofacetDistribution distribution = MicrofacetDistribution::GGX;
+    float ao = 1.0f;                // Only used by the PBR model
+    float specularPower = 32.0f;    // Phong and Blinn-Phong exponent
+    glm::vec4 customParams = glm::vec4(0.5f);
+    CustomBRDFCallback custom;      // Empty selects the default Lambertian custom BRDF
+};
+
+/**
+ * @brief Batched lighting model evaluation
+ *
+ * Every model reproduces its GLSL function (calculatePhong, calculateOrenNayar,
+ * ...) term for term and returns the same quantity: the per-light contribution
+ * before light color and attenuation. Batches are evaluated four samples at a
+ * time in SIMD lanes, with vectorized exp/log for the pow and exp terms; the
+ * single-sample overload runs the same kernel and is meant for spot checks.
+ *
+ * One deviation from the shaders: where a microfacet specular term divides by
+ * zero (grazing views), the CPU result is 0 instead of NaN or infinity.
+ * Custom models run their CustomBRDFCallback once per sample.
+ */
+class BRDF {
+public:
+    /**
+     * @brief Evaluate a batch of shading samples
+     * @param model Lighting model
+     * @param material Material uniforms
+     * @param normals Unit surface normals
+     * @param lightDirs Unit directions towards the light
+     * @param viewDirs Unit directions towards the viewer
+     * @param count Number of samples
+     * @param result Output, one RGB value per sample
+     */
+    static void evaluate(BRDFModel model, const BRDFMaterial& material, const glm::vec3* normals,
+                         const glm::vec3* lightDirs, const glm::vec3* viewDirs, size_t count, glm::vec3* result);
+
+    /**
+     * @brief Evaluate a single shading sample
+     */
+    static glm::vec3 evaluate(BRDFModel model, const BRDFMaterial& material, const glm::vec3& normal,
+                              const glm::vec3& lightDir, const glm::vec3& viewDir);
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_HEADLESS_BRDF_H
@@ -0,0 +1,155 @@
+/**
+ * @file CPUPostProcessor.h
+ * @brief CPU implementations of the PostProcessShader effects for the headless path
+ */
+
+#ifndef ELEMENTAL_RENDERER_CPU_POST_PROCESSOR_H
+#define ELEMENTAL_RENDERER_CPU_POST_PROCESSOR_H
+
+#include "Image.h"
+#include "../Shaders/PostProcessShader.h"
+#include <vector>
+
+namespace ElementalRenderer {
+
+/**
+ * @brief One entry of a post-processing effect chain
+ */
+struct PostProcessStep {
+    PostProcessEffect effect = PostProcessEffect::NONE;
+    float strength = 0.5f;
+};
+
+/**
+ * @brief Applies PostProcessShader effects to CPU images
+ *
+ * Every effect reproduces the math of the standard post-processing fragment
+ * shader (including its bilinear, clamp-to-edge texture lookups), so an offline
+ * render can run the same effect chain without a GPU. Rows are processed in
+ * parallel and each pixel is handled as one four-lane SIMD vector.
+ */
+class CPUPostProcessor {
+public:
+    /**
+     * @brief Default constructor
+     */
+    CPUPostProcessor();
+
+    /**
+     * @brief Set the effect type
+     * @param effect The post-processing effect to use
+     */
+    void setEffect(PostProcessEffect effect);
+
+    /**
+     * @brief Set effect strength parameter
+     * @param strength Value between 0.0 and 1.0
+     */
+    void setEffectStrength(float strength);
+
+    /**
+     * @brief Set time parameter for animated effects
+     * @param time Current time value
+     */
+    void setTime(float time);
+
+    /**
+     * @brief Get current effect type
+     * @return Current post-processing effect
+     */
+    PostProcessEffect getEffect() const;
+
+    /**
+     * @brief Get current effect strength
+     * @return Current strength
+     */
+    float getEffectStrength() const;
+
+    /**
+     * @brief Apply the current effect to a float image
+     * @param source Input image
+     * @param destination Output image (may alias source)
+     */
+    void apply(const Image& source, Image& destination) const;
+
+    /**
+     * @brief Apply the current effect to 8-bit RGBA pixels
+     * @param source Interleaved RGBA8 input
+     * @param width Width in pixels
+     * @param height Height in pixels
+     * @param destination Interleaved RGBA8 output
+     */
+    void apply(const unsigned char* source, int width, int height, std::vector<unsigned char>& destination) const;
+
+    /**
+     * @brief Apply a single effect
+     * @param effect Effect to apply (NONE and CUSTOM copy the input)
+     * @param strength Effect strength
+     * @param source Input image
+     * @param destination Output image (may alias source)
+     */
+    static void applyEffect(PostProcessEffect effect, float strength, const Image& source, Image& destination);
+
+    /**
+     * @brief Apply a chain of effects in order, in place
+     * @param steps Effects to apply
+     * @param image Image to process
+     */
+    static void applyChain(const std::vector<PostProcessStep>& steps, Image& image);
+
+    /**
+     * @brief 3x3 binomial blur with tap spacing strength/300 in UV, mixed by strength
+     */
+    static void blur(const Image& source, Image& destination, float strength);
+
+    /**
+     * @brief Rec. 709 luminance grayscale mixed by strength
+     */
+    static void grayscale(const Image& source, Image& destination, float strength);
+
+    /**
+     * @brief Radial darkening using smoothstep(0.8, 0.2, distance * strength)
+     */
+    static void vignette(const Image& source, Image& destination, float strength);
+
+    /**
+     * @brief Horizontal red/blue channel offset of 0.01 * strength in UV
+     */
+    static void chromaticAberration(const Image& source, Image& destination, float strength);
+
+    /**
+     * @brief Separable Gaussian blur approximated by three sliding-window box passes
+     *
+     * Cost per pixel is constant regardless of sigma.
+     *
+     * @param source Input image
+     * @param destination Output image (may alias source)
+     * @param sigma Standard deviation in pixels
+     */
+    static void gaussianBlur(const Image& source, Image& destination, float sigma);
+
+    /**
+     * @brief Bilinear upscale with a ringing-limited sharpen, for dynamic resolution
+     *
+     * Matches PostProcessShader::s_upscaleFragmentShaderSource: each output
+     * pixel takes the bilinear source color plus sharpness times its
+     * difference to the mean of four taps one source texel away, clamped to
+     * the range of those five taps so edges do not ring.
+     *
+     * @param source Image rendered at the internal resolution
+     * @param width Output width
+     * @param height Output height
+     * @param sharpness Sharpening amount, 0 for plain bilinear
+     * @param destination Output image (may alias source)
+     */
+    static void upscale(const Image& source, int width, int height, float sharpness, Image& destination);
+
+private:
+    PostProcessEffect m_currentEffect;
+    float m_effectStrength;
+    float m_time;
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_CPU_POST_PROCESSOR_H
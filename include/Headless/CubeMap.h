@@ -0,0 +1,108 @@
+/**
+ * @file CubeMap.h
+ * @brief CPU-side cube map used by the headless lighting bakers
+ */
+
+#ifndef ELEMENTAL_RENDERER_HEADLESS_CUBE_MAP_H
+#define ELEMENTAL_RENDERER_HEADLESS_CUBE_MAP_H
+
+#include "Image.h"
+#include <glm/glm.hpp>
+
+namespace ElementalRenderer {
+
+/**
+ * @brief Six square RGBA32F faces in OpenGL cube map order and orientation
+ *
+ * Faces are +X, -X, +Y, -Y, +Z, -Z (GL_TEXTURE_CUBE_MAP_POSITIVE_X + face).
+ * Texel (x, y) of a face has face coordinates s = (x + 0.5) / size and
+ * t = (y + 0.5) / size, mapped to directions as in the OpenGL specification,
+ * so each face can be uploaded with glTexImage2D as is.
+ */
+class CubeMap {
+public:
+    static const int kFaceCount = 6;
+
+    /**
+     * @brief Default constructor (empty cube map)
+     */
+    CubeMap();
+
+    /**
+     * @brief Construct a cube map filled with a constant color
+     * @param size Face width and height in texels
+     * @param fill Initial color of every texel
+     */
+    explicit CubeMap(int size, const glm::vec4& fill = glm::vec4(0.0f));
+
+    /**
+     * @brief Resize every face, discarding the contents
+     */
+    void resize(int size, const glm::vec4& fill = glm::vec4(0.0f));
+
+    int getSize() const { return m_size; }
+
+    bool isEmpty() const { return m_size == 0; }
+
+    Image& getFace(int face) { return m_faces[face]; }
+
+    const Image& getFace(int face) const { return m_faces[face]; }
+
+    /**
+     * @brief Direction through a point of a face
+     * @param face Face index
+     * @param s Horizontal face coordinate in [0, 1]
+     * @param t Vertical face coordinate in [0, 1]
+     * @return Unit direction
+     */
+    static glm::vec3 faceDirection(int face, float s, float t);
+
+    /**
+     * @brief Face and face coordinates hit by a direction
+     * @param direction Any non-zero direction
+     * @param face Output face index
+     * @param st Output face coordinates in [0, 1]
+     */
+    static void directionToFace(const glm::vec3& direction, int& face, glm::vec2& st);
+
+    /**
+     * @brief Solid angle covered by one texel
+     * @param size Face size
+     * @param x Texel column
+     * @param y Texel row
+     * @return Solid angle in steradians (all texels sum to 4 pi)
+     */
+    static float texelSolidAngle(int size, int x, int y);
+
+    /**
+     * @brief Bilinearly sample along a direction (clamped at face edges)
+     * @param direction Any non-zero direction
+     * @return Filtered color
+     */
+    glm::vec4 sample(const glm::vec3& direction) const;
+
+    /**
+     * @brief Half-resolution copy, each texel the average of a 2x2 block
+     */
+    CubeMap downsample() const;
+
+    /**
+     * @brief Resample an equirectangular panorama
+     *
+     * The panorama's u coordinate runs with the azimuth atan2(z, x) starting
+     * from -x, and its v coordinate from straight down (row 0) to straight up.
+     *
+     * @param panorama Latitude-longitude image, typically twice as wide as high
+     * @param size Face size of the result
+     * @return Cube map
+     */
+    static CubeMap fromEquirectangular(const Image& panorama, int size);
+
+private:
+    int m_size;
+    Image m_faces[kFaceCount];
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_HEADLESS_CUBE_MAP_H
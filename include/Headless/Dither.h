@@ -0,0 +1,89 @@
+/**
+ * @file Dither.h
+ * @brief Ordered and error-diffusion dithering for palette reduction
+ */
+
+#ifndef ELEMENTAL_RENDERER_HEADLESS_DITHER_H
+#define ELEMENTAL_RENDERER_HEADLESS_DITHER_H
+
+#include "Image.h"
+#include "Palette.h"
+#include <vector>
+
+namespace ElementalRenderer {
+
+/**
+ * @brief Threshold pattern used by ordered dithering
+ */
+enum class DitherPattern {
+    NONE,
+    BAYER,          // 4x4 matrix used by PixelArtEffect
+    BLUE_NOISE      // 64x64 void-and-cluster tile
+};
+
+/**
+ * @brief CPU dithering kernels
+ *
+ * Pixel coordinates follow the image rows, with row 0 at the bottom as in
+ * gl_FragCoord, so BAYER output matches PixelArtEffect. Alpha is preserved
+ * so sprite cut-outs survive palette reduction.
+ */
+class Dither {
+public:
+    /**
+     * @brief Side length of the blue-noise tile
+     */
+    static const int kBlueNoiseSize = 64;
+
+    /**
+     * @brief Threshold in [0, 1) for a pixel
+     * @param pattern Pattern to read (NONE returns 0.5)
+     * @param x Pixel column
+     * @param y Pixel row
+     * @return Threshold
+     */
+    static float threshold(DitherPattern pattern, int x, int y);
+
+    /**
+     * @brief Blue-noise ranks as thresholds in [0, 1), row-major
+     *
+     * Generated once with the void-and-cluster method and shared afterwards.
+     */
+    static const std::vector<float>& getBlueNoise();
+
+    /**
+     * @brief Quantize to a number of levels per channel (PixelArtEffect palette mode 0)
+     *
+     * Computes floor((c + t / levels) * levels) / levels; without a pattern,
+     * floor(c * levels) / levels.
+     *
+     * @param image Image processed in place
+     * @param levels Levels per channel
+     * @param pattern Threshold pattern
+     */
+    static void quantize(Image& image, int levels, DitherPattern pattern);
+
+    /**
+     * @brief Map every pixel to a palette entry with ordered dithering
+     * @param image Image processed in place
+     * @param lut Palette lookup table
+     * @param pattern Threshold pattern
+     * @param spread Amplitude of the threshold offset in color units
+     */
+    static void mapToPalette(Image& image, const PaletteLUT& lut, DitherPattern pattern, float spread = 0.125f);
+
+    /**
+     * @brief Map every pixel to a palette entry with serpentine Floyd-Steinberg diffusion
+     *
+     * Error diffusion is inherently sequential within an image; transparent
+     * pixels neither receive nor spread error.
+     *
+     * @param image Image processed in place
+     * @param lut Palette lookup table
+     */
+    static void errorDiffuse(Image& image, const PaletteLUT& lut);
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_HEADLESS_DITHER_H
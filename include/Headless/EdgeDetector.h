@@ -0,0 +1,107 @@
+/**
+ * @file EdgeDetector.h
+ * @brief Screen-space silhouette and crease extraction for ANIME style outlines
+ */
+
+#ifndef ELEMENTAL_RENDERER_HEADLESS_EDGE_DETECTOR_H
+#define ELEMENTAL_RENDERER_HEADLESS_EDGE_DETECTOR_H
+
+#include "GBuffer.h"
+#include "Image.h"
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace ElementalRenderer {
+
+/**
+ * @brief Gradient operator used for edge extraction
+ */
+enum class EdgeOperator {
+    SOBEL,      // 3x3, robust to noise
+    ROBERTS     // 2x2 cross, sharper on fine detail
+};
+
+/**
+ * @brief Parameters of the outline extraction
+ */
+struct EdgeSettings {
+    EdgeOperator edgeOperator = EdgeOperator::SOBEL;
+    float depthThreshold = 0.05f;   // Depth gradient relative to the pixel depth
+    float slopeScale = 1.0f;        // Raises the depth threshold on surfaces seen at grazing angles
+    float normalThreshold = 0.5f;   // Normal gradient magnitude for creases
+    float lineWidth = 2.0f;         // Outline width in pixels
+    glm::vec3 outlineColor = glm::vec3(0.0f);
+
+    /**
+     * @brief Settings matching the StyleShaderManager "outlineThickness" parameter
+     * @param thickness Outline thickness in [0, 1]
+     * @return Settings with a line width between 1 and 8 pixels
+     */
+    static EdgeSettings fromOutlineThickness(float thickness);
+};
+
+/**
+ * @brief CPU outline extraction over a G-buffer
+ *
+ * Depth edges use a threshold proportional to the pixel depth and to the slope
+ * implied by its normal, so distant objects and grazing planes do not produce
+ * false outlines; depth edges are kept on the nearer side only so silhouettes
+ * hug the foreground object. Line width comes from a jump-flood distance
+ * transform instead of re-drawing geometry.
+ */
+class EdgeDetector {
+public:
+    /**
+     * @brief Mark silhouette and crease pixels
+     * @param gbuffer View-space normals and linear depth
+     * @param settings Operator and thresholds
+     * @param edges Output mask, 1 on edge pixels and 0 elsewhere (row-major)
+     */
+    static void detectEdges(const GBuffer& gbuffer, const EdgeSettings& settings, std::vector<float>& edges);
+
+    /**
+     * @brief Distance from every pixel to the nearest edge pixel (jump flooding)
+     *
+     * Only distances up to maxDistance are needed, so the flood starts at the
+     * smallest power-of-two step that covers it; pixels farther away report a
+     * value greater than maxDistance.
+     *
+     * @param edges Edge mask (values above 0.5 are seeds)
+     * @param width Mask width
+     * @param height Mask height
+     * @param maxDistance Largest distance of interest in pixels
+     * @param distance Output distances (row-major)
+     */
+    static void jumpFlood(const std::vector<float>& edges, int width, int height, float maxDistance,
+                          std::vector<float>& distance);
+
+    /**
+     * @brief Step sizes of a jump flood that resolves distances up to maxDistance
+     *
+     * Shared with the GPU outline passes so both produce the same distances.
+     *
+     * @param maxDistance Largest distance of interest in pixels
+     * @return Decreasing power-of-two steps followed by one extra unit step
+     */
+    static std::vector<int> getJumpFloodSteps(float maxDistance);
+
+    /**
+     * @brief Anti-aliased outline coverage for the configured line width
+     * @param gbuffer View-space normals and linear depth
+     * @param settings Operator, thresholds and line width
+     * @param coverage Output coverage in [0, 1] (row-major)
+     */
+    static void computeCoverage(const GBuffer& gbuffer, const EdgeSettings& settings, std::vector<float>& coverage);
+
+    /**
+     * @brief Blend the outline color over an image
+     * @param color Image processed in place
+     * @param coverage Coverage from computeCoverage
+     * @param outlineColor Line color
+     */
+    static void composite(Image& color, const std::vector<float>& coverage, const glm::vec3& outlineColor);
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_HEADLESS_EDGE_DETECTOR_H
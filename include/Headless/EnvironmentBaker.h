@@ -0,0 +1,145 @@
+/**
+ * @file EnvironmentBaker.h
+ * @brief CPU baking of image-based lighting data for the PBR and GGX models
+ */
+
+#ifndef ELEMENTAL_RENDERER_HEADLESS_ENVIRONMENT_BAKER_H
+#define ELEMENTAL_RENDERER_HEADLESS_ENVIRONMENT_BAKER_H
+
+#include "CubeMap.h"
+#include "Image.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace ElementalRenderer {
+
+/**
+ * @brief Resolution and sample counts of an environment bake
+ */
+struct EnvironmentBakeSettings {
+    int brdfLUTSize = 128;
+    int brdfSampleCount = 512;
+    int specularSize = 128;         // Face size of specular mip 0
+    int specularMipCount = 6;       // Roughness 0 at mip 0 to 1 at the last mip
+    int specularSampleCount = 256;  // GGX samples per texel and mip
+};
+
+/**
+ * @brief Third-order (9 coefficient) spherical harmonics of RGB radiance
+ */
+struct SphericalHarmonics9 {
+    glm::vec3 coefficients[9];
+
+    SphericalHarmonics9();
+
+    /**
+     * @brief Project a cube map, weighting each texel by its solid angle
+     */
+    static SphericalHarmonics9 project(const CubeMap& environment);
+
+    /**
+     * @brief Accumulate one radiance sample
+     * @param direction Unit direction the radiance arrives from
+     * @param radiance RGB radiance
+     * @param weight Solid angle the sample represents (4 pi / N for N uniform samples)
+     */
+    void addSample(const glm::vec3& direction, const glm::vec3& radiance, float weight);
+
+    /**
+     * @brief Diffuse irradiance divided by pi around a normal
+     *
+     * This is the cosine-weighted average radiance, the value an irradiance
+     * map stores: multiply by the albedo for Lambertian ambient lighting.
+     *
+     * @param normal Unit surface normal
+     * @return RGB irradiance / pi
+     */
+    glm::vec3 evaluateIrradiance(const glm::vec3& normal) const;
+};
+
+/**
+ * @brief Everything the split-sum image-based lighting needs
+ */
+struct BakedEnvironment {
+    Image brdfLUT;                      // (scale, bias, 0, 1) over (NdotV, roughness)
+    std::vector<CubeMap> specular;      // Prefiltered mips, roughness = mip / (count - 1)
+    SphericalHarmonics9 irradiance;
+    uint64_t hash = 0;                  // Environment and settings hash used as cache key
+    bool loadedFromCache = false;
+};
+
+/**
+ * @brief Bakes split-sum image-based lighting on the CPU
+ *
+ * Follows the split-sum approximation: a BRDF integration LUT for the GGX
+ * model with Schlick-GGX IBL geometry (k = roughness^2 / 2), GGX-prefiltered
+ * specular mips produced by importance sampling with N = V = R and source
+ * mip selection from the sample PDF, and diffuse irradiance as spherical
+ * harmonics. Texels are processed in parallel, so the whole bake runs on
+ * machines without a GPU. Results can be cached on disk, keyed by a hash of
+ * the environment and the settings.
+ */
+class EnvironmentBaker {
+public:
+    // Largest LUT and cube face size that is baked or accepted from a cache file
+    static constexpr int kMaxBakeSize = 2048;
+
+    /**
+     * @brief Bake, or load from the cache if an identical bake exists
+     * @param environment Source radiance cube map
+     * @param settings Bake settings
+     * @param cacheDirectory Directory for cached bakes, empty disables caching
+     * @return Baked data
+     */
+    static BakedEnvironment bake(const CubeMap& environment, const EnvironmentBakeSettings& settings = EnvironmentBakeSettings(),
+                                 const std::string& cacheDirectory = "");
+
+    /**
+     * @brief Integrate the GGX BRDF for the split-sum approximation
+     * @param size LUT width and height, clamped to [1, kMaxBakeSize]
+     * @param sampleCount Importance samples per texel
+     * @return LUT with texel (x, y) at NdotV = (x + 0.5) / size, roughness = (y + 0.5) / size
+     */
+    static Image bakeBRDFLUT(int size, int sampleCount);
+
+    /**
+     * @brief Prefilter the environment with the GGX lobe for increasing roughness
+     * @param environment Source radiance
+     * @param size Face size of mip 0, clamped to [1, kMaxBakeSize]
+     * @param mipCount Number of mips (each half the size of the previous one)
+     * @param sampleCount Importance samples per texel
+     * @return One cube map per mip
+     */
+    static std::vector<CubeMap> prefilterSpecular(const CubeMap& environment, int size, int mipCount, int sampleCount);
+
+    /**
+     * @brief Cache key of an environment and bake settings
+     */
+    static uint64_t computeHash(const CubeMap& environment, const EnvironmentBakeSettings& settings);
+
+    /**
+     * @brief Write a bake to a binary file
+     * @return true on success
+     */
+    static bool saveToFile(const BakedEnvironment& baked, const std::string& filePath);
+
+    /**
+     * @brief Read a bake from a binary file
+     *
+     * Sizes are checked against kMaxBakeSize and against the bytes left in
+     * the file before anything is allocated, so a corrupt file is rejected
+     * cheaply.
+     *
+     * @param filePath File written by saveToFile
+     * @param baked Output data
+     * @param expectedHash Reject the file unless it holds this hash (0 accepts any)
+     * @return true on success
+     */
+    static bool loadFromFile(const std::string& filePath, BakedEnvironment& baked, uint64_t expectedHash = 0);
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_HEADLESS_ENVIRONMENT_BAKER_H
@@ -0,0 +1,60 @@
+/**
+ * @file FFT.h
+ * @brief Square power-of-two complex FFT for the headless simulation kernels
+ */
+
+#ifndef ELEMENTAL_RENDERER_HEADLESS_FFT_H
+#define ELEMENTAL_RENDERER_HEADLESS_FFT_H
+
+#include <vector>
+
+namespace ElementalRenderer {
+
+/**
+ * @brief In-place 2D FFT over an N x N grid, N a power of two (N >= 4)
+ *
+ * Data is split into separate real and imaginary planes, row-major. Rows are
+ * transformed first, then columns, both in parallel. Row transforms vectorize
+ * over the butterflies of one stage (the two shortest stages are fused into a
+ * scalar radix-4 pass); column transforms vectorize across four neighbouring
+ * columns, so every access stays contiguous. Neither direction is normalized.
+ */
+class FFT2D {
+public:
+    /**
+     * @brief Constructor
+     * @param size Grid width and height, rounded up to a power of two (at least 4)
+     */
+    explicit FFT2D(int size);
+
+    int getSize() const { return m_size; }
+
+    /**
+     * @brief Inverse transform: out(x) = sum_k in(k) e^{+2 pi i k x / N}
+     * @param real Real plane, size * size floats
+     * @param imag Imaginary plane, size * size floats
+     */
+    void inverse(float* real, float* imag) const;
+
+    /**
+     * @brief Forward transform: out(k) = sum_x in(x) e^{-2 pi i k x / N}
+     * @param real Real plane, size * size floats
+     * @param imag Imaginary plane, size * size floats
+     */
+    void forward(float* real, float* imag) const;
+
+private:
+    void transform(float* real, float* imag, float sign) const;
+    void transformRow(float* real, float* imag, float sign) const;
+    void transformColumns(float* real, float* imag, int column, float sign) const;
+
+    int m_size;
+    std::vector<int> m_bitReverse;
+    // Stage with half-length m keeps cos and sin of pi j / m, j < m, in [m, 2m)
+    std::vector<float> m_twiddleCos;
+    std::vector<float> m_twiddleSin;
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_HEADLESS_FFT_H
@@ -0,0 +1,108 @@
+/**
+ * @file GBuffer.h
+ * @brief CPU-side geometry buffer used by the headless screen-space passes
+ */
+
+#ifndef ELEMENTAL_RENDERER_HEADLESS_GBUFFER_H
+#define ELEMENTAL_RENDERER_HEADLESS_GBUFFER_H
+
+#include "Image.h"
+#include <glm/glm.hpp>
+
+namespace ElementalRenderer {
+
+/**
+ * @brief View-space normals and linear depth, packed per pixel
+ *
+ * Each texel stores the view-space normal in xyz and the positive linear view
+ * depth (distance along -Z) in w, so screen-space kernels can load both with a
+ * single four-lane SIMD load. A depth of zero or less marks background.
+ *
+ * Passes that need view-space positions (ambient occlusion) reconstruct them
+ * from the depth and the perspective projection set with setProjection(); the
+ * default is a symmetric 90 degree frustum.
+ */
+class GBuffer {
+public:
+    GBuffer() = default;
+
+    GBuffer(int width, int height) { resize(width, height); }
+
+    /**
+     * @brief Resize and clear to background
+     */
+    void resize(int width, int height) { m_normalDepth.resize(width, height, glm::vec4(0.0f, 0.0f, 1.0f, 0.0f)); }
+
+    int getWidth() const { return m_normalDepth.getWidth(); }
+
+    int getHeight() const { return m_normalDepth.getHeight(); }
+
+    bool isEmpty() const { return m_normalDepth.isEmpty(); }
+
+    void set(int x, int y, const glm::vec3& normal, float depth) { m_normalDepth.at(x, y) = glm::vec4(normal, depth); }
+
+    glm::vec3 getNormal(int x, int y) const {
+        const glm::vec4& t = m_normalDepth.at(x, y);
+        return glm::vec3(t.x, t.y, t.z);
+    }
+
+    float getDepth(int x, int y) const { return m_normalDepth.at(x, y).w; }
+
+    bool isBackground(int x, int y) const { return m_normalDepth.at(x, y).w <= 0.0f; }
+
+    /**
+     * @brief Set the perspective projection the G-buffer was rendered with
+     * @param projection Projection matrix (OpenGL conventions, camera looking down -Z)
+     */
+    void setProjection(const glm::mat4& projection) {
+        m_projectionScale = glm::vec2(projection[0][0], projection[1][1]);
+        m_projectionOffset = glm::vec2(projection[2][0], projection[2][1]);
+    }
+
+    /**
+     * @brief Reconstruct a view-space position
+     * @param px Horizontal pixel coordinate (texel centers at x + 0.5)
+     * @param py Vertical pixel coordinate (texel centers at y + 0.5)
+     * @param depth Positive linear depth
+     * @return View-space position (z = -depth)
+     */
+    glm::vec3 getViewPosition(float px, float py, float depth) const {
+        const float ndcX = 2.0f * px / static_cast<float>(getWidth()) - 1.0f;
+        const float ndcY = 2.0f * py / static_cast<float>(getHeight()) - 1.0f;
+        return glm::vec3(depth * (ndcX + m_projectionOffset.x) / m_projectionScale.x,
+                         depth * (ndcY + m_projectionOffset.y) / m_projectionScale.y, -depth);
+    }
+
+    /**
+     * @brief Project a view-space position back to pixel coordinates
+     * @param position View-space position in front of the camera
+     * @return Continuous pixel coordinates (inverse of getViewPosition)
+     */
+    glm::vec2 projectToPixel(const glm::vec3& position) const {
+        const float depth = -position.z;
+        const float ndcX = position.x * m_projectionScale.x / depth - m_projectionOffset.x;
+        const float ndcY = position.y * m_projectionScale.y / depth - m_projectionOffset.y;
+        return glm::vec2((ndcX + 1.0f) * 0.5f * static_cast<float>(getWidth()),
+                         (ndcY + 1.0f) * 0.5f * static_cast<float>(getHeight()));
+    }
+
+    /**
+     * @brief Horizontal pixels covered by one view-space unit at a given depth
+     */
+    float getPixelsPerUnit(float depth) const {
+        return 0.5f * static_cast<float>(getWidth()) * m_projectionScale.x / depth;
+    }
+
+    const Image& getNormalDepth() const { return m_normalDepth; }
+
+    Image& getNormalDepth() { return m_normalDepth; }
+
+private:
+    Image m_normalDepth;
+    glm::vec2 m_projectionScale = glm::vec2(1.0f);
+    glm::vec2 m_projectionOffset = glm::vec2(0.0f);
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_HEADLESS_GBUFFER_H
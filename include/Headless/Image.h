@@ -0,0 +1,104 @@
+/**
+ * @file Image.h
+ * @brief CPU-side RGBA image used by the headless rendering path
+ */
+
+#ifndef ELEMENTAL_RENDERER_HEADLESS_IMAGE_H
+#define ELEMENTAL_RENDERER_HEADLESS_IMAGE_H
+
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace ElementalRenderer {
+
+/**
+ * @brief Linear RGBA32F image stored row-major, row 0 first
+ *
+ * Texture coordinates follow the OpenGL convention used by the post-processing
+ * shaders: texel (x, y) has its center at ((x + 0.5) / width, (y + 0.5) / height)
+ * and lookups outside [0, 1] are clamped to the edge.
+ */
+class Image {
+public:
+    /**
+     * @brief Default constructor (empty image)
+     */
+    Image();
+
+    /**
+     * @brief Construct an image filled with a constant color
+     * @param width Width in pixels
+     * @param height Height in pixels
+     * @param fill Initial color of every pixel
+     */
+    Image(int width, int height, const glm::vec4& fill = glm::vec4(0.0f));
+
+    /**
+     * @brief Resize the image, discarding its contents
+     * @param width New width in pixels
+     * @param height New height in pixels
+     * @param fill Color of every pixel after resizing
+     */
+    void resize(int width, int height, const glm::vec4& fill = glm::vec4(0.0f));
+
+    int getWidth() const { return m_width; }
+
+    int getHeight() const { return m_height; }
+
+    bool isEmpty() const { return m_pixels.empty(); }
+
+    glm::vec4& at(int x, int y) { return m_pixels[static_cast<size_t>(y) * m_width + x]; }
+
+    const glm::vec4& at(int x, int y) const { return m_pixels[static_cast<size_t>(y) * m_width + x]; }
+
+    glm::vec4* getRow(int y) { return m_pixels.data() + static_cast<size_t>(y) * m_width; }
+
+    const glm::vec4* getRow(int y) const { return m_pixels.data() + static_cast<size_t>(y) * m_width; }
+
+    /**
+     * @brief Get the raw pixel storage as interleaved RGBA floats
+     * @return Pointer to width * height * 4 floats
+     */
+    float* getData() { return reinterpret_cast<float*>(m_pixels.data()); }
+
+    const float* getData() const { return reinterpret_cast<const float*>(m_pixels.data()); }
+
+    /**
+     * @brief Fetch a texel with clamp-to-edge addressing
+     * @param x Texel column (may be out of range)
+     * @param y Texel row (may be out of range)
+     * @return The clamped texel
+     */
+    const glm::vec4& fetchClamped(int x, int y) const;
+
+    /**
+     * @brief Bilinearly sample the image like a GL_LINEAR, GL_CLAMP_TO_EDGE texture
+     * @param uv Normalized texture coordinates
+     * @return Filtered color
+     */
+    glm::vec4 sample(const glm::vec2& uv) const;
+
+    /**
+     * @brief Convert 8-bit RGBA data into a float image
+     * @param data Interleaved RGBA8 pixels (width * height * 4 bytes)
+     * @param width Width in pixels
+     * @param height Height in pixels
+     * @return Image with channels remapped to [0, 1]
+     */
+    static Image fromRGBA8(const unsigned char* data, int width, int height);
+
+    /**
+     * @brief Convert the image to 8-bit RGBA with clamping and rounding
+     * @param out Destination buffer, resized to width * height * 4 bytes
+     */
+    void toRGBA8(std::vector<unsigned char>& out) const;
+
+private:
+    int m_width;
+    int m_height;
+    std::vector<glm::vec4> m_pixels;
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_HEADLESS_IMAGE_H
@@ -0,0 +1,161 @@
+/**
+ * @file LTC.h
+ * @brief Linearly transformed cosines for rectangle and disk area lights
+ */
+
+#ifndef ELEMENTAL_RENDERER_HEADLESS_LTC_H
+#define ELEMENTAL_RENDERER_HEADLESS_LTC_H
+
+#include "BRDF.h"
+#include "Image.h"
+#include <string>
+#include <glm/glm.hpp>
+
+namespace ElementalRenderer {
+
+/**
+ * @brief Resolution and effort of an LTC table fit
+ */
+struct LTCFitSettings {
+    int tableSize = 64;
+    int sampleCount = 512;      // Error samples per distribution and Nelder-Mead step
+    int maxIterations = 200;    // Nelder-Mead iterations per table cell
+};
+
+/**
+ * @brief Fitted LTC tables for the Cook-Torrance GGX specular lobe
+ *
+ * Both images are size x size and are indexed with
+ * u = sqrt(1 - NdotV) and v = roughness, texel centers at (i + 0.5) / size,
+ * so they can be uploaded as RGBA32F textures with linear filtering.
+ */
+struct LTCTable {
+    Image matrix;       // (m00, m02, m20, m22) of the inverse transform, m11 = 1, other entries 0
+    Image magnitude;    // (scale, bias, 0, 1): lobe albedo is F0 * scale + bias
+
+    int getSize() const { return matrix.getWidth(); }
+
+    bool isEmpty() const { return matrix.getWidth() == 0; }
+};
+
+/**
+ * @brief Fitting and CPU evaluation of linearly transformed cosines
+ *
+ * A linearly transformed cosine is a clamped cosine lobe warped by a 3x3
+ * matrix. Its integral over a polygon has a closed form, so once the GGX
+ * lobe of the Cook-Torrance model is fitted per (view angle, roughness),
+ * rectangle and disk lights are shaded exactly up to the fit, instead of
+ * being approximated with many point lights. Each table cell is fitted
+ * with Nelder-Mead, starting from the neighbouring cell of the same
+ * roughness, and the roughness rows are fitted in parallel.
+ *
+ * Light polygons are convex. A one-sided light emits towards the side from
+ * which its vertices appear clockwise, which is what rectanglePolygon and
+ * diskPolygon produce for emission along axisY x axisX.
+ */
+class LTC {
+public:
+    static const int kDiskSegments = 12;
+    static const int kMaxPolygonVertices = kDiskSegments;
+
+    /**
+     * @brief Fit the tables
+     * @param settings Fit settings
+     * @return Fitted tables
+     */
+    static LTCTable fit(const LTCFitSettings& settings = LTCFitSettings());
+
+    /**
+     * @brief Tables fitted with the default LTCFitSettings and compiled into the library
+     * @return Tables, built on first use
+     */
+    static const LTCTable& getBuiltinTable();
+
+    /**
+     * @brief Load tables written by saveToFile, or fit and write them
+     * @param filePath Binary table asset
+     * @param settings Fit settings; a file of a different size is refitted
+     * @return Tables
+     */
+    static LTCTable loadOrFit(const std::string& filePath, const LTCFitSettings& settings = LTCFitSettings());
+
+    /**
+     * @brief Write tables to a binary file
+     * @return true on success
+     */
+    static bool saveToFile(const LTCTable& table, const std::string& filePath);
+
+    /**
+     * @brief Read tables from a binary file
+     * @param filePath File written by saveToFile
+     * @param table Output tables
+     * @param expectedSize Reject the file unless its tables have this size (0 accepts any)
+     * @return true on success
+     */
+    static bool loadFromFile(const std::string& filePath, LTCTable& table, int expectedSize = 0);
+
+    /**
+     * @brief Corners of a rectangle light
+     * @param center Center of the rectangle
+     * @param axisX Half extent along the first side
+     * @param axisY Half extent along the second side, the light emits along axisY x axisX
+     * @param polygon Output, 4 vertices
+     * @return Vertex count
+     */
+    static int rectanglePolygon(const glm::vec3& center, const glm::vec3& axisX, const glm::vec3& axisY, glm::vec3* polygon);
+
+    /**
+     * @brief Polygon with the same area as a disk (or ellipse) light
+     * @param center Center of the disk
+     * @param axisX First radius vector
+     * @param axisY Second radius vector, the light emits along axisY x axisX
+     * @param polygon Output, kDiskSegments vertices
+     * @return Vertex count
+     */
+    static int diskPolygon(const glm::vec3& center, const glm::vec3& axisX, const glm::vec3& axisY, glm::vec3* polygon);
+
+    /**
+     * @brief Integral of the clamped cosine over a polygon divided by pi
+     *
+     * This is the form factor of the polygon seen from the origin with
+     * normal +z. The polygon is clipped to the upper hemisphere first.
+     *
+     * @param polygon Up to kMaxPolygonVertices vertices relative to the shading point
+     * @param count Vertex count
+     * @param twoSided Whether the back face emits as well
+     * @return Form factor in [0, 1]
+     */
+    static float integratePolygon(const glm::vec3* polygon, int count, bool twoSided);
+
+    /**
+     * @brief Inverse LTC matrix for a view angle and roughness
+     *
+     * Maps directions in the shading frame (normal +z, view in the xz-plane
+     * with positive x) to the cosine lobe's space.
+     */
+    static glm::mat3 lookupInverse(const LTCTable& table, float nDotV, float roughness);
+
+    /**
+     * @brief Radiance reflected from an area light of unit radiance
+     *
+     * Mirrors calculateCookTorrance: albedo times the diffuse form factor
+     * scaled by (1 - metallic) plus the GGX specular term.
+     *
+     * @param table Fitted tables
+     * @param polygon World-space light polygon
+     * @param count Vertex count
+     * @param twoSided Whether the back face emits as well
+     * @param position Shaded point
+     * @param normal Unit surface normal
+     * @param viewDir Unit direction towards the viewer
+     * @param material Roughness, metallic, fresnel and albedo are used
+     * @return RGB factor to multiply with the light's color and intensity
+     */
+    static glm::vec3 evaluate(const LTCTable& table, const glm::vec3* polygon, int count, bool twoSided,
+                              const glm::vec3& position, const glm::vec3& normal, const glm::vec3& viewDir,
+                              const BRDFMaterial& material);
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_HEADLESS_LTC_H
@@ -0,0 +1,146 @@
+/**
+ * @file OceanSimulation.h
+ * @brief Tessendorf FFT ocean simulated on the CPU
+ */
+
+#ifndef ELEMENTAL_RENDERER_HEADLESS_OCEAN_SIMULATION_H
+#define ELEMENTAL_RENDERER_HEADLESS_OCEAN_SIMULATION_H
+
+#include "FFT.h"
+#include "Image.h"
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace ElementalRenderer {
+
+/**
+ * @brief Wave energy spectrum the ocean is seeded from
+ */
+enum class OceanSpectrum {
+    PHILLIPS,   // Fully developed sea, Tessendorf's original spectrum
+    JONSWAP     // Fetch-limited sea with a sharper peak
+};
+
+/**
+ * @brief Parameters of the ocean simulation
+ */
+struct OceanSettings {
+    OceanSpectrum spectrum = OceanSpectrum::PHILLIPS;
+    int resolution = 256;                   // Grid size, power of two (256 to 512 for real-time use)
+    float patchSize = 250.0f;               // World-space size of the tiling patch, in meters
+    float windSpeed = 20.0f;                // Meters per second, 10 m above the surface
+    glm::vec2 windDirection = glm::vec2(1.0f, 0.0f);
+    float phillipsConstant = 0.0018f;       // Phillips amplitude, roughly Pierson-Moskowitz wave heights
+    float fetch = 100000.0f;                // JONSWAP fetch, in meters
+    float peakEnhancement = 3.3f;           // JONSWAP gamma
+    float upwindDamping = 0.07f;            // Energy kept by waves travelling against the wind
+    float smallWaveLength = 0.5f;           // Waves much shorter than this are suppressed, in meters
+    float depth = 0.0f;                     // Water depth for the dispersion relation, 0 for deep water
+    float choppiness = 1.3f;                // Horizontal displacement scale (0 gives rounded sine-like crests)
+    uint32_t seed = 1;
+};
+
+/**
+ * @brief Tessendorf FFT ocean
+ *
+ * The initial spectrum h0(k) is drawn once from the chosen energy spectrum and
+ * the deep (or finite) depth dispersion relation. Every update() advances the
+ * phases analytically and runs four inverse FFTs: height, horizontal
+ * displacement, slopes and displacement derivatives are packed two real
+ * fields per complex transform. The result tiles seamlessly every patchSize
+ * meters.
+ *
+ * Outputs are resolution x resolution RGBA32F images, texel (x, z) covering
+ * world position (x, z) * patchSize / resolution:
+ * - displacement: (dx, height, dz, jacobian); a jacobian below 1 marks
+ *   compressed crests and below 0 folded ones, the usual foam mask
+ * - normals: (nx, ny, nz, 0), unit length with ny > 0
+ */
+class OceanSimulation {
+public:
+    /**
+     * @brief Constructor
+     * @param settings Simulation parameters
+     */
+    explicit OceanSimulation(const OceanSettings& settings = OceanSettings());
+
+    /**
+     * @brief Replace the settings and redraw the initial spectrum
+     * @param settings Simulation parameters
+     */
+    void setSettings(const OceanSettings& settings);
+
+    const OceanSettings& getSettings() const { return m_settings; }
+
+    int getResolution() const { return m_fft.getSize(); }
+
+    /**
+     * @brief Evaluate the surface at a point in time
+     * @param time Simulation time in seconds
+     */
+    void update(float time);
+
+    const Image& getDisplacement() const { return m_displacement; }
+
+    const Image& getNormals() const { return m_normals; }
+
+    /**
+     * @brief Bilinearly sample the displacement with wrap-around (e.g. for buoyancy)
+     * @param worldXZ World-space position on the undisplaced plane
+     * @return (dx, height, dz)
+     */
+    glm::vec3 sampleDisplacement(const glm::vec2& worldXZ) const;
+
+    /**
+     * @brief Expected height variance of the seeded spectrum (significant wave height is 4 sqrt)
+     */
+    float getExpectedHeightVariance() const { return m_expectedVariance; }
+
+    /**
+     * @brief Encode the current frame for WaterShader::setWaterMaps
+     *
+     * Both outputs are RGBA8, row-major, ready for Texture::loadFromMemory with
+     * 4 channels and REPEAT wrapping. The DuDv map stores the surface slopes in
+     * red and green (0.5 is flat) and the foam mask in blue; the normal map uses
+     * the layout the water fragment shader decodes.
+     *
+     * @param dudvMap Output DuDv/foam map
+     * @param normalMap Output normal map
+     */
+    void encodeWaterMaps(std::vector<unsigned char>& dudvMap, std::vector<unsigned char>& normalMap) const;
+
+    /**
+     * @brief Spectral energy density at a wave vector (per unit wavenumber area)
+     * @param k Wave vector in radians per meter
+     * @return Height variance density
+     */
+    float evaluateSpectrum(const glm::vec2& k) const;
+
+    /**
+     * @brief Angular frequency of a wave number under the configured dispersion relation
+     */
+    float dispersion(float k) const;
+
+private:
+    void initializeSpectrum();
+    float waveNumberAt(int index) const;
+
+    OceanSettings m_settings;
+    FFT2D m_fft;
+    std::vector<glm::vec2> m_h0;            // h0(k)
+    std::vector<glm::vec2> m_h0MinusConj;   // conj(h0(-k))
+    std::vector<float> m_omega;
+    float m_expectedVariance;
+
+    // Four packed complex planes, each carrying two real fields
+    std::vector<float> m_real[4];
+    std::vector<float> m_imag[4];
+
+    Image m_displacement;
+    Image m_normals;
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_HEADLESS_OCEAN_SIMULATION_H
@@ -0,0 +1,160 @@
+/**
+ * @file Palette.h
+ * @brief Palette extraction and constant-time nearest-color lookup
+ */
+
+#ifndef ELEMENTAL_RENDERER_HEADLESS_PALETTE_H
+#define ELEMENTAL_RENDERER_HEADLESS_PALETTE_H
+
+#include "Image.h"
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace ElementalRenderer {
+
+/**
+ * @brief An ordered set of at most 256 RGB colors
+ */
+class Palette {
+public:
+    /**
+     * @brief Largest palette size (indices must fit in a byte)
+     */
+    static const int kMaxColors = 256;
+
+    /**
+     * @brief Default constructor (empty palette)
+     */
+    Palette();
+
+    /**
+     * @brief Construct from explicit colors (extra colors beyond kMaxColors are dropped)
+     * @param colors Palette entries
+     */
+    explicit Palette(const std::vector<glm::vec3>& colors);
+
+    const std::vector<glm::vec3>& getColors() const { return m_colors; }
+
+    int getSize() const { return static_cast<int>(m_colors.size()); }
+
+    bool isEmpty() const { return m_colors.empty(); }
+
+    const glm::vec3& operator[](int index) const { return m_colors[index]; }
+
+    /**
+     * @brief Find the closest entry by exhaustive search
+     * @param color Color to match
+     * @return Index of the entry with the smallest Euclidean distance (-1 if empty)
+     */
+    int findNearest(const glm::vec3& color) const;
+
+    /**
+     * @brief The 16-color CGA-like palette built into PixelArtEffect
+     */
+    static Palette cga();
+
+    /**
+     * @brief Extract a palette by recursive median cut
+     *
+     * Pixels with zero alpha are ignored so sprite backgrounds do not claim
+     * entries. Large images are subsampled on a fixed stride.
+     *
+     * @param reference Source image
+     * @param count Desired number of colors (1 to kMaxColors)
+     * @return Palette with at most count colors
+     */
+    static Palette medianCut(const Image& reference, int count);
+
+    /**
+     * @brief Extract a palette with k-means, seeded by median cut
+     *
+     * The assignment step runs in parallel over fixed-size blocks whose partial
+     * sums are merged in order, so the result does not depend on the thread count.
+     *
+     * @param reference Source image
+     * @param count Desired number of colors (1 to kMaxColors)
+     * @param maxIterations Upper bound on Lloyd iterations
+     * @return Palette with at most count colors
+     */
+    static Palette kMeans(const Image& reference, int count, int maxIterations = 16);
+
+private:
+    std::vector<glm::vec3> m_colors;
+};
+
+/**
+ * @brief Regular 3D grid mapping any RGB color to a palette index in O(1)
+ *
+ * Each cell stores the palette entry nearest to its center. A lookup can
+ * therefore differ from the exhaustive search only for colors lying within
+ * half a cell of a decision boundary.
+ */
+class PaletteLUT {
+public:
+    /**
+     * @brief Default constructor (empty LUT)
+     */
+    PaletteLUT();
+
+    /**
+     * @brief Build a LUT for a palette
+     * @param palette Palette to map onto
+     * @param resolution Cells per axis
+     */
+    explicit PaletteLUT(const Palette& palette, int resolution = 32);
+
+    /**
+     * @brief Rebuild the LUT (cells are filled in parallel)
+     * @param palette Palette to map onto
+     * @param resolution Cells per axis (clamped to 2..256)
+     */
+    void build(const Palette& palette, int resolution = 32);
+
+    bool isEmpty() const { return m_indices.empty(); }
+
+    int getResolution() const { return m_resolution; }
+
+    const Palette& getPalette() const { return m_palette; }
+
+    /**
+     * @brief Palette index for a color (components are clamped to [0, 1])
+     */
+    int lookupIndex(const glm::vec3& color) const {
+        return m_indices[cellIndex(cellCoord(color.x), cellCoord(color.y), cellCoord(color.z))];
+    }
+
+    /**
+     * @brief Palette color for a color (components are clamped to [0, 1])
+     */
+    const glm::vec3& lookup(const glm::vec3& color) const { return m_palette[lookupIndex(color)]; }
+
+    /**
+     * @brief Raw cell indices, red varying fastest, then green, then blue
+     */
+    const std::vector<std::uint8_t>& getIndices() const { return m_indices; }
+
+    /**
+     * @brief Expand the LUT to RGB8 texels for upload as a 3D texture
+     * @param out Destination buffer, resized to resolution^3 * 3 bytes
+     */
+    void toRGB8(std::vector<unsigned char>& out) const;
+
+private:
+    int cellCoord(float c) const {
+        int i = static_cast<int>(c * static_cast<float>(m_resolution));
+        return i < 0 ? 0 : (i >= m_resolution ? m_resolution - 1 : i);
+    }
+
+    size_t cellIndex(int r, int g, int b) const {
+        return (static_cast<size_t>(b) * m_resolution + g) * m_resolution + r;
+    }
+
+    Palette m_palette;
+    int m_resolution;
+    std::vector<std::uint8_t> m_indices;
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_HEADLESS_PALETTE_H
@@ -0,0 +1,52 @@
+/**
+ * @file Parallel.h
+ * @brief Shared worker pool and parallel loops for the headless rendering path
+ */
+
+#ifndef ELEMENTAL_RENDERER_HEADLESS_PARALLEL_H
+#define ELEMENTAL_RENDERER_HEADLESS_PARALLEL_H
+
+#include <functional>
+
+namespace ElementalRenderer {
+namespace Parallel {
+
+/**
+ * @brief Get the number of threads that take part in a parallel loop
+ * @return Worker threads plus the calling thread
+ */
+unsigned int getThreadCount();
+
+/**
+ * @brief Resize the shared worker pool
+ * @param count Total thread count including the caller, 0 selects the hardware concurrency
+ */
+void setThreadCount(unsigned int count);
+
+/**
+ * @brief Run a loop body over [begin, end) split into contiguous chunks
+ *
+ * The calling thread takes part in the work and the call returns once every
+ * chunk has finished. Calls made from inside a running loop body, or while
+ * another thread owns the pool, run serially on the calling thread. Bodies
+ * must not throw.
+ *
+ * @param begin First index
+ * @param end One past the last index
+ * @param grainSize Minimum number of indices per chunk
+ * @param body Function receiving a [chunkBegin, chunkEnd) range
+ */
+void forRange(int begin, int end, int grainSize, const std::function<void(int, int)>& body);
+
+/**
+ * @brief Run a loop body once per index in [begin, end)
+ * @param begin First index
+ * @param end One past the last index
+ * @param body Function receiving the index
+ */
+void forEach(int begin, int end, const std::function<void(int)>& body);
+
+} // namespace Parallel
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_HEADLESS_PARALLEL_H
@@ -0,0 +1,123 @@
+/**
+ * @file PixelKernels.h
+ * @brief Addressing helpers and row kernels shared by the headless image filters
+ *
+ * Internal to the headless post-processing code; not part of the public API.
+ * CPUPostProcessor and the PostProcessFusion executor both run the effect
+ * kernels, so there is a single CPU reference for each effect's GLSL.
+ * PainterlyFilter and EdgeDetector use the same addressing and box filter.
+ */
+
+#ifndef ELEMENTAL_RENDERER_HEADLESS_PIXELKERNELS_H
+#define ELEMENTAL_RENDERER_HEADLESS_PIXELKERNELS_H
+
+#include "Headless/SIMD.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <glm/glm.hpp>
+
+namespace ElementalRenderer {
+namespace PixelKernels {
+
+inline int clampIndex(int i, int size) {
+    return std::min(std::max(i, 0), size - 1);
+}
+
+/**
+ * @brief Bilinear tap at a constant texel offset: floor part plus lerp weight
+ */
+struct LinearTap {
+    int offset;
+    float weight;
+
+    explicit LinearTap(float shift) {
+        float whole = std::floor(shift);
+        offset = static_cast<int>(whole);
+        weight = shift - whole;
+    }
+};
+
+/**
+ * @brief Linear lookup along a strided line with clamp-to-edge addressing
+ */
+inline SIMD::Float4 sampleLine(const glm::vec4* line, int stride, int size, int index, const LinearTap& tap) {
+    SIMD::Float4 a = SIMD::Float4::load(line[static_cast<size_t>(clampIndex(index + tap.offset, size)) * stride]);
+    SIMD::Float4 b = SIMD::Float4::load(line[static_cast<size_t>(clampIndex(index + tap.offset + 1, size)) * stride]);
+    return SIMD::mix(a, b, SIMD::Float4::splat(tap.weight));
+}
+
+/**
+ * @brief Sliding-window box mean of the given radius along one strided line, clamp-to-edge
+ */
+inline void boxLine(const glm::vec4* in, glm::vec4* out, int stride, int size, int radius) {
+    const SIMD::Float4 scale = SIMD::Float4::splat(1.0f / static_cast<float>(2 * radius + 1));
+
+    SIMD::Float4 sum = SIMD::Float4::splat(0.0f);
+    for (int k = -radius; k <= radius; ++k) {
+        sum = sum + SIMD::Float4::load(in[static_cast<size_t>(clampIndex(k, size)) * stride]);
+    }
+
+    for (int i = 0; i < size; ++i) {
+        (sum * scale).store(out[static_cast<size_t>(i) * stride]);
+        SIMD::Float4 entering = SIMD::Float4::load(in[static_cast<size_t>(clampIndex(i + radius + 1, size)) * stride]);
+        SIMD::Float4 leaving = SIMD::Float4::load(in[static_cast<size_t>(clampIndex(i - radius, size)) * stride]);
+        sum = sum + entering - leaving;
+    }
+}
+
+/**
+ * @brief GLSL smoothstep, including the reversed-edge form used by the vignette
+ */
+inline float smoothstep(float edge0, float edge1, float x) {
+    float t = std::min(std::max((x - edge0) / (edge1 - edge0), 0.0f), 1.0f);
+    return t * t * (3.0f - 2.0f * t);
+}
+
+/**
+ * @brief Blend towards Rec. 709 luminance; in and out may be the same row
+ */
+inline void grayscaleRow(const glm::vec4* in, glm::vec4* out, int width, float strength) {
+    const SIMD::Float4 luminance = SIMD::Float4::set(0.2126f, 0.7152f, 0.0722f, 0.0f);
+    const SIMD::Float4 mixFactor = SIMD::Float4::splat(strength);
+    const SIMD::Float4 opaque = SIMD::Float4::splat(1.0f);
+    for (int x = 0; x < width; ++x) {
+        SIMD::Float4 color = SIMD::Float4::load(in[x]);
+        SIMD::withW(SIMD::mix(color, SIMD::dot3(color, luminance), mixFactor), opaque).store(out[x]);
+    }
+}
+
+/**
+ * @brief Darken towards the corners of a width x height image; in and out may be the same row
+ */
+inline void vignetteRow(const glm::vec4* in, glm::vec4* out, int width, int height, int y, float strength) {
+    const SIMD::Float4 opaque = SIMD::Float4::splat(1.0f);
+    const float invWidth = 1.0f / static_cast<float>(std::max(width, 1));
+    const float invHeight = 1.0f / static_cast<float>(std::max(height, 1));
+    const float dy = (static_cast<float>(y) + 0.5f) * invHeight - 0.5f;
+    for (int x = 0; x < width; ++x) {
+        const float dx = (static_cast<float>(x) + 0.5f) * invWidth - 0.5f;
+        const float factor = smoothstep(0.8f, 0.2f, std::sqrt(dx * dx + dy * dy) * strength);
+        SIMD::withW(SIMD::Float4::load(in[x]) * SIMD::Float4::splat(factor), opaque).store(out[x]);
+    }
+}
+
+/**
+ * @brief Shift red and blue horizontally in opposite directions; in and out must differ
+ */
+inline void chromaticAberrationRow(const glm::vec4* in, glm::vec4* out, int width, float strength) {
+    // Texel centers sit at x + 0.5, so a UV offset maps to x + shift in texel space
+    const float shift = 0.01f * strength * static_cast<float>(width);
+    const LinearTap redTap(shift), blueTap(-shift);
+    float red[4], blue[4];
+    for (int x = 0; x < width; ++x) {
+        sampleLine(in, 1, width, x, redTap).store(red);
+        sampleLine(in, 1, width, x, blueTap).store(blue);
+        out[x] = glm::vec4(red[0], in[x].y, blue[2], 1.0f);
+    }
+}
+
+} // namespace PixelKernels
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_HEADLESS_PIXELKERNELS_H
@@ -0,0 +1,228 @@
+/**
+ * @file SIMD.h
+ * @brief Thin SIMD wrappers used by the headless CPU kernels
+ *
+ * SSE2 is used whenever the compiler targets it (always on x86-64); other
+ * targets fall back to plain scalar code with identical results.
+ */
+
+#ifndef ELEMENTAL_RENDERER_HEADLESS_SIMD_H
+#define ELEMENTAL_RENDERER_HEADLESS_SIMD_H
+
+#include <algorithm>
+#include <cmath>
+#include <glm/glm.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ELEMENTAL_RENDERER_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace ElementalRenderer {
+namespace SIMD {
+
+/**
+ * @brief Four float lanes, typically one RGBA pixel
+ */
+struct Float4 {
+#ifdef ELEMENTAL_RENDERER_SIMD_SSE2
+    __m128 v;
+
+    static Float4 load(const float* p) { return {_mm_loadu_ps(p)}; }
+    static Float4 splat(float s) { return {_mm_set1_ps(s)}; }
+    static Float4 set(float x, float y, float z, float w) { return {_mm_setr_ps(x, y, z, w)}; }
+    void store(float* p) const { _mm_storeu_ps(p, v); }
+#else
+    float v[4];
+
+    static Float4 load(const float* p) { return {{p[0], p[1], p[2], p[3]}}; }
+    static Float4 splat(float s) { return {{s, s, s, s}}; }
+    static Float4 set(float x, float y, float z, float w) { return {{x, y, z, w}}; }
+    void store(float* p) const { p[0] = v[0]; p[1] = v[1]; p[2] = v[2]; p[3] = v[3]; }
+#endif
+
+    static Float4 load(const glm::vec4& p) { return load(&p.x); }
+    void store(glm::vec4& p) const { store(&p.x); }
+
+    float lane(int i) const {
+        float tmp[4];
+        store(tmp);
+        return tmp[i];
+    }
+};
+
+#ifdef ELEMENTAL_RENDERER_SIMD_SSE2
+inline Float4 operator+(Float4 a, Float4 b) { return {_mm_add_ps(a.v, b.v)}; }
+inline Float4 operator-(Float4 a, Float4 b) { return {_mm_sub_ps(a.v, b.v)}; }
+inline Float4 operator*(Float4 a, Float4 b) { return {_mm_mul_ps(a.v, b.v)}; }
+inline Float4 operator/(Float4 a, Float4 b) { return {_mm_div_ps(a.v, b.v)}; }
+inline Float4 min(Float4 a, Float4 b) { return {_mm_min_ps(a.v, b.v)}; }
+inline Float4 max(Float4 a, Float4 b) { return {_mm_max_ps(a.v, b.v)}; }
+
+/**
+ * @brief Dot product of the first three lanes, broadcast to all lanes
+ */
+inline Float4 dot3(Float4 a, Float4 b) {
+    __m128 m = _mm_mul_ps(a.v, b.v);
+    __m128 y = _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 1, 1, 1));
+    __m128 z = _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 2, 2, 2));
+    __m128 s = _mm_add_ss(_mm_add_ss(m, y), z);
+    return {_mm_shuffle_ps(s, s, _MM_SHUFFLE(0, 0, 0, 0))};
+}
+
+/**
+ * @brief Take lanes x, y, z from a and lane w from b
+ */
+inline Float4 withW(Float4 a, Float4 b) {
+    __m128 bw = _mm_shuffle_ps(b.v, a.v, _MM_SHUFFLE(2, 2, 3, 3)); // b.w b.w a.z a.z
+    return {_mm_shuffle_ps(a.v, bw, _MM_SHUFFLE(0, 2, 1, 0))};     // a.x a.y a.z b.w
+}
+
+/**
+ * @brief Round toward negative infinity (inputs must fit in a 32-bit int)
+ */
+inline Float4 floor(Float4 a) {
+    __m128 truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(a.v));
+    __m128 correction = _mm_and_ps(_mm_cmpgt_ps(truncated, a.v), _mm_set1_ps(1.0f));
+    return {_mm_sub_ps(truncated, correction)};
+}
+
+inline Float4 sqrt(Float4 a) { return {_mm_sqrt_ps(a.v)}; }
+
+/**
+ * @brief Lane masks for select(): all bits set where the comparison holds
+ */
+inline Float4 lessThan(Float4 a, Float4 b) { return {_mm_cmplt_ps(a.v, b.v)}; }
+inline Float4 greaterThan(Float4 a, Float4 b) { return {_mm_cmpgt_ps(a.v, b.v)}; }
+inline Float4 lessEqual(Float4 a, Float4 b) { return {_mm_cmple_ps(a.v, b.v)}; }
+
+/**
+ * @brief One bit per lane of a comparison mask, lane 0 in bit 0
+ */
+inline int moveMask(Float4 mask) { return _mm_movemask_ps(mask.v); }
+
+/**
+ * @brief Per-lane mask ? ifTrue : ifFalse, for masks from the comparisons above
+ */
+inline Float4 select(Float4 mask, Float4 ifTrue, Float4 ifFalse) {
+    return {_mm_or_ps(_mm_and_ps(mask.v, ifTrue.v), _mm_andnot_ps(mask.v, ifFalse.v))};
+}
+
+/**
+ * @brief Natural exponential (Cephes polynomial, about 1e-7 relative error)
+ */
+inline Float4 exp(Float4 a) {
+    __m128 x = _mm_min_ps(_mm_max_ps(a.v, _mm_set1_ps(-87.3f)), _mm_set1_ps(88.3f));
+    __m128 fx = _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(1.44269504088896341f)), _mm_set1_ps(0.5f));
+    fx = floor(Float4{fx}).v;
+    x = _mm_sub_ps(x, _mm_mul_ps(fx, _mm_set1_ps(0.693359375f)));
+    x = _mm_sub_ps(x, _mm_mul_ps(fx, _mm_set1_ps(-2.12194440e-4f)));
+
+    __m128 y = _mm_set1_ps(1.9875691500e-4f);
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(1.3981999507e-3f));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(8.3334519073e-3f));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(4.1665795894e-2f));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(1.6666665459e-1f));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(5.0000001201e-1f));
+    y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(y, _mm_mul_ps(x, x)), x), _mm_set1_ps(1.0f));
+
+    __m128i exponent = _mm_slli_epi32(_mm_add_epi32(_mm_cvttps_epi32(fx), _mm_set1_epi32(127)), 23);
+    return {_mm_mul_ps(y, _mm_castsi128_ps(exponent))};
+}
+
+/**
+ * @brief Natural logarithm for positive lanes (Cephes polynomial)
+ */
+inline Float4 log(Float4 a) {
+    __m128 x = _mm_max_ps(a.v, _mm_castsi128_ps(_mm_set1_epi32(0x00800000))); // smallest normal
+    __m128i bits = _mm_castps_si128(x);
+    __m128 e = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(126)));
+    // Mantissa in [0.5, 1)
+    x = _mm_or_ps(_mm_and_ps(x, _mm_castsi128_ps(_mm_set1_epi32(~0x7f800000))), _mm_set1_ps(0.5f));
+
+    // Shift to [sqrt(0.5), sqrt(2)) for a better polynomial fit
+    __m128 small = _mm_cmplt_ps(x, _mm_set1_ps(0.707106781186547524f));
+    __m128 extra = _mm_and_ps(x, small);
+    x = _mm_sub_ps(x, _mm_set1_ps(1.0f));
+    e = _mm_sub_ps(e, _mm_and_ps(_mm_set1_ps(1.0f), small));
+    x = _mm_add_ps(x, extra);
+
+    __m128 z = _mm_mul_ps(x, x);
+    __m128 y = _mm_set1_ps(7.0376836292e-2f);
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(-1.1514610310e-1f));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(1.1676998740e-1f));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(-1.2420140846e-1f));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(1.4249322787e-1f));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(-1.6668057665e-1f));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(2.0000714765e-1f));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(-2.4999993993e-1f));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(3.3333331174e-1f));
+    y = _mm_mul_ps(_mm_mul_ps(y, x), z);
+    y = _mm_add_ps(y, _mm_mul_ps(e, _mm_set1_ps(-2.12194440e-4f)));
+    y = _mm_sub_ps(y, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+    x = _mm_add_ps(x, y);
+    return {_mm_add_ps(x, _mm_mul_ps(e, _mm_set1_ps(0.693359375f)))};
+}
+#else
+inline Float4 operator+(Float4 a, Float4 b) { return {{a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]}}; }
+inline Float4 operator-(Float4 a, Float4 b) { return {{a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3]}}; }
+inline Float4 operator*(Float4 a, Float4 b) { return {{a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]}}; }
+inline Float4 operator/(Float4 a, Float4 b) { return {{a.v[0] / b.v[0], a.v[1] / b.v[1], a.v[2] / b.v[2], a.v[3] / b.v[3]}}; }
+inline Float4 min(Float4 a, Float4 b) {
+    return {{std::min(a.v[0], b.v[0]), std::min(a.v[1], b.v[1]), std::min(a.v[2], b.v[2]), std::min(a.v[3], b.v[3])}};
+}
+inline Float4 max(Float4 a, Float4 b) {
+    return {{std::max(a.v[0], b.v[0]), std::max(a.v[1], b.v[1]), std::max(a.v[2], b.v[2]), std::max(a.v[3], b.v[3])}};
+}
+inline Float4 dot3(Float4 a, Float4 b) {
+    return Float4::splat(a.v[0] * b.v[0] + a.v[1] * b.v[1] + a.v[2] * b.v[2]);
+}
+inline Float4 withW(Float4 a, Float4 b) { return {{a.v[0], a.v[1], a.v[2], b.v[3]}}; }
+inline Float4 floor(Float4 a) {
+    return {{std::floor(a.v[0]), std::floor(a.v[1]), std::floor(a.v[2]), std::floor(a.v[3])}};
+}
+inline Float4 sqrt(Float4 a) {
+    return {{std::sqrt(a.v[0]), std::sqrt(a.v[1]), std::sqrt(a.v[2]), std::sqrt(a.v[3])}};
+}
+// Scalar masks are 1 or 0 per lane; only select() and moveMask() read them
+inline Float4 lessThan(Float4 a, Float4 b) {
+    return {{a.v[0] < b.v[0] ? 1.0f : 0.0f, a.v[1] < b.v[1] ? 1.0f : 0.0f, a.v[2] < b.v[2] ? 1.0f : 0.0f, a.v[3] < b.v[3] ? 1.0f : 0.0f}};
+}
+inline Float4 greaterThan(Float4 a, Float4 b) { return lessThan(b, a); }
+inline Float4 lessEqual(Float4 a, Float4 b) {
+    return {{a.v[0] <= b.v[0] ? 1.0f : 0.0f, a.v[1] <= b.v[1] ? 1.0f : 0.0f, a.v[2] <= b.v[2] ? 1.0f : 0.0f, a.v[3] <= b.v[3] ? 1.0f : 0.0f}};
+}
+inline int moveMask(Float4 mask) {
+    return (mask.v[0] != 0.0f ? 1 : 0) | (mask.v[1] != 0.0f ? 2 : 0) | (mask.v[2] != 0.0f ? 4 : 0) | (mask.v[3] != 0.0f ? 8 : 0);
+}
+inline Float4 select(Float4 mask, Float4 ifTrue, Float4 ifFalse) {
+    return {{mask.v[0] != 0.0f ? ifTrue.v[0] : ifFalse.v[0], mask.v[1] != 0.0f ? ifTrue.v[1] : ifFalse.v[1],
+             mask.v[2] != 0.0f ? ifTrue.v[2] : ifFalse.v[2], mask.v[3] != 0.0f ? ifTrue.v[3] : ifFalse.v[3]}};
+}
+inline Float4 exp(Float4 a) {
+    return {{std::exp(a.v[0]), std::exp(a.v[1]), std::exp(a.v[2]), std::exp(a.v[3])}};
+}
+inline Float4 log(Float4 a) {
+    return {{std::log(a.v[0]), std::log(a.v[1]), std::log(a.v[2]), std::log(a.v[3])}};
+}
+#endif
+
+/**
+ * @brief Linear interpolation a + (b - a) * t, matching GLSL mix()
+ */
+inline Float4 mix(Float4 a, Float4 b, Float4 t) { return a + (b - a) * t; }
+
+inline Float4 clamp(Float4 x, Float4 lo, Float4 hi) { return min(max(x, lo), hi); }
+
+/**
+ * @brief a^b for a > 0; lanes with a <= 0 return 0
+ */
+inline Float4 pow(Float4 a, Float4 b) {
+    const Float4 zero = Float4::splat(0.0f);
+    return select(greaterThan(a, zero), exp(b * log(a)), zero);
+}
+
+} // namespace SIMD
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_HEADLESS_SIMD_H
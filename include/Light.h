@@ -21,6 +21,14 @@ enum class LightType {
     AREA
 };
 
+/**
+ * @brief Shapes of area lights
+ */
+enum class AreaLightShape {
+    RECTANGLE,
+    DISK
+};
+
 /**
  * @brief Base class for all light types
  */
@@ -129,101 +137,25 @@ public:
         float range = 10.0f,
         float innerAngle = 30.0f,
         float outerAngle = 45.0f);
-/**
- * @file Light.h
- * @brief Light system for Elemental Renderer
- */
-
-#ifndef ELEMENTAL_RENDERER_LIGHT_H
-#define ELEMENTAL_RENDERER_LIGHT_H
-
-#include <glm/glm.hpp>
-#include <memory>
-
-namespace ElementalRenderer {
-
-/**
- * @brief Light types
- */
-enum class LightType {
-    DIRECTIONAL,
-    POINT,
-    SPOT
-};
-
-/**
- * @brief Class for handling lights
- */
-class Light {
-public:
-    Light(LightType type = LightType::POINT);
-    
-    void setPosition(const glm::vec3& position);
-    
-    glm::vec3 getPosition() const;
-    
-    void setDirection(const glm::vec3& direction);
-    
-    glm::vec3 getDirection() const;
     
-    void setColor(const glm::vec3& color);
-    
-    glm::vec3 getColor() const;
-    
-    void setIntensity(float intensity);
-    
-    float getIntensity() const;
-    
-    void setRange(float range);
-    
-    float getRange() const;
-    
-    void setInnerConeAngle(float angleDegrees);
-    
-    float getInnerConeAngle() const;
-    
-    void setOuterConeAngle(float angleDegrees);
-    
-    float getOuterConeAngle() const;
-    
-    void setType(LightType type);
-    
-    LightType getType() const;
-    
-    static std::shared_ptr<Light> createDirectionalLight(
-        const glm::vec3& direction = glm::vec3(0.0f, -1.0f, 0.0f),
-        const glm::vec3& color = glm::vec3(1.0f),
-        float intensity = 1.0f);
-    
-    static std::shared_ptr<Light> createPointLight(
-        const glm::vec3& position = glm::vec3(0.0f),
-        const glm::vec3& color = glm::vec3(1.0f),
-        float intensity = 1.0f,
-        float range = 10.0f);
-    
-    static std::shared_ptr<Light> createSpotLight(
+    /**
+     * @brief Create an area light
+     * @param shape Rectangle or disk
+     * @param position Center of the light
+     * @param direction Direction the light emits towards
+     * @param size Width and height (diameters for a disk)
+     * @param color RGB color of the light
+     * @param intensity Intensity of the light
+     * @return Shared pointer to the created light
+     */
+    static std::shared_ptr<Light> createAreaLight(
+        AreaLightShape shape = AreaLightShape::RECTANGLE,
         const glm::vec3& position = glm::vec3(0.0f),
         const glm::vec3& direction = glm::vec3(0.0f, -1.0f, 0.0f),
+        const glm::vec2& size = glm::vec2(1.0f),
         const glm::vec3& color = glm::vec3(1.0f),
-        float intensity = 1.0f,
-        float range = 10.0f,
-        float innerAngleDegrees = 15.0f,
-        float outerAngleDegrees = 30.0f);
-
-private:
-    LightType m_type;
-    glm::vec3 m_position;
-    glm::vec3 m_direction;
-    glm::vec3 m_color;
-    float m_intensity;
-    float m_range;
-    float m_innerConeAngle;
-    float m_outerConeAngle;
-};
-
-} // namespace ElementalRenderer
+        float intensity = 1.0f);
 
-#endif // ELEMENTAL_RENDERER_LIGHT_H
 protected:
     LightType m_type;
     glm::vec3 m_color;
@@ -406,6 +338,112 @@ private:
     float m_outerAngle;
 };
 
+/**
+ * @brief Area light (emitting rectangle or disk)
+ *
+ * Emits from one face towards its direction, or from both faces when
+ * two-sided. Shaded with linearly transformed cosines (see Headless/LTC.h),
+ * which replaces approximating the emitter with many point lights.
+ */
+class AreaLight : public Light {
+public:
+    /**
+     * @brief Default constructor (1x1 rectangle facing down)
+     */
+    AreaLight();
+    
+    /**
+     * @brief Constructor with shape and placement
+     * @param shape Rectangle or disk
+     * @param position Center of the light
+     * @param direction Direction the light emits towards
+     * @param size Width and height (diameters for a disk)
+     * @param color RGB color of the light
+     * @param intensity Intensity of the light
+     */
+    AreaLight(AreaLightShape shape, const glm::vec3& position, const glm::vec3& direction,
+              const glm::vec2& size, const glm::vec3& color = glm::vec3(1.0f), float intensity = 1.0f);
+    
+    /**
+     * @brief Set the shape
+     * @param shape Rectangle or disk
+     */
+    void setShape(AreaLightShape shape);
+    
+    /**
+     * @brief Get the shape
+     * @return The shape
+     */
+    AreaLightShape getShape() const;
+    
+    /**
+     * @brief Set the light position
+     * @param position Center of the light
+     */
+    void setPosition(const glm::vec3& position);
+    
+    /**
+     * @brief Get the light position
+     * @return The center of the light
+     */
+    glm::vec3 getPosition() const;
+    
+    /**
+     * @brief Set the emission direction
+     * @param direction Direction vector
+     */
+    void setDirection(const glm::vec3& direction);
+    
+    /**
+     * @brief Get the emission direction
+     * @return The direction vector
+     */
+    glm::vec3 getDirection() const;
+    
+    /**
+     * @brief Set the size
+     * @param size Width and height (diameters for a disk)
+     */
+    void setSize(const glm::vec2& size);
+    
+    /**
+     * @brief Get the size
+     * @return Width and height
+     */
+    glm::vec2 getSize() const;
+    
+    /**
+     * @brief Set whether both faces emit
+     * @param twoSided True if the back face emits as well
+     */
+    void setTwoSided(bool twoSided);
+    
+    /**
+     * @brief Check if both faces emit
+     * @return True if the back face emits as well
+     */
+    bool isTwoSided() const;
+    
+    /**
+     * @brief Get the half extent along the width
+     * @return Vector from the center to the middle of a side (radius for a disk)
+     */
+    glm::vec3 getAxisX() const;
+    
+    /**
+     * @brief Get the half extent along the height
+     * @return Vector from the center to the middle of a side, getAxisY() x getAxisX() points along the direction
+     */
+    glm::vec3 getAxisY() const;
+
+private:
+    AreaLightShape m_shape;
+    glm::vec3 m_position;
+    glm::vec3 m_direction;
+    glm::vec2 m_size;
+    bool m_twoSided;
+};
+
 } // namespace ElementalRenderer
 
 #endif // ELEMENTAL_RENDERER_LIGHT_H
@@ -0,0 +1,122 @@
+/**
+ * @file IrradianceProbeGrid.h
+ * @brief Grid of spherical-harmonic irradiance probes baked on the CPU
+ */
+
+#ifndef ELEMENTAL_RENDERER_IRRADIANCE_PROBE_GRID_H
+#define ELEMENTAL_RENDERER_IRRADIANCE_PROBE_GRID_H
+
+#include "../BoundingBox.h"
+#include "../Headless/EnvironmentBaker.h"
+#include "../Headless/Image.h"
+#include <glm/glm.hpp>
+
+namespace ElementalRenderer {
+
+class PathTracer;
+
+/**
+ * @brief Probe bake settings
+ */
+struct IrradianceProbeSettings {
+    glm::ivec3 counts = glm::ivec3(8, 4, 8);    // Probes along each axis of the bounds
+    int samplesPerProbe = 256;                  // Paths traced from each probe
+    int visibilityResolution = 16;              // Octahedral distance texels per probe side
+    float normalBias = 0.05f;                   // Lookup offset along the normal, in cell sizes
+};
+
+/**
+ * @brief Regular 3D grid of irradiance probes for diffuse global illumination
+ *
+ * Each probe traces paths in uniformly distributed directions through a
+ * PathTracer, which supplies the scene BVH, the lights and the bounces, and
+ * projects the radiance into third-order spherical harmonics. Hit distances
+ * go into a small octahedral map of mean and mean squared distance per probe.
+ * Lookups blend the eight surrounding probes trilinearly, weighted by
+ * whether the probe faces the surface and by a Chebyshev test against the
+ * distance map, so probes behind walls do not leak light.
+ *
+ * Probes live directly in two atlases ready for upload as textures:
+ * - the irradiance atlas holds the 9 RGB coefficients of a probe in 9
+ *   adjacent texels, probe (x, y, z) at texel (9 x + c, y + counts.y z);
+ * - the visibility atlas holds (mean distance, mean squared distance) in
+ *   the red and green channels, one visibilityResolution square tile per
+ *   probe, laid out the same way.
+ */
+class IrradianceProbeGrid {
+public:
+    IrradianceProbeGrid();
+
+    /**
+     * @brief Place probes over a region, discarding baked data
+     * @param bounds Region covered; the outermost probes sit on its faces
+     * @param settings Probe counts and bake settings
+     */
+    void place(const BoundingBox& bounds, const IrradianceProbeSettings& settings = IrradianceProbeSettings());
+
+    /**
+     * @brief Bake every probe, one parallel job per probe
+     * @param tracer Path tracer holding the scene
+     */
+    void bake(const PathTracer& tracer);
+
+    /**
+     * @brief Re-bake the probes around changed geometry or lights
+     *
+     * Only probes within one cell of the region are traced again, which are
+     * the probes whose lookups the change can reach through trilinear
+     * blending. Distant probes that see the change keep their old values
+     * until the next full bake.
+     *
+     * @param tracer Path tracer holding the updated scene
+     * @param changed Bounds of what changed
+     * @return Number of probes re-baked
+     */
+    int rebake(const PathTracer& tracer, const BoundingBox& changed);
+
+    /**
+     * @brief Diffuse irradiance divided by pi at a surface point
+     *
+     * Same convention as SphericalHarmonics9::evaluateIrradiance: multiply
+     * by the albedo for Lambertian ambient lighting.
+     *
+     * @param position World-space surface position
+     * @param normal Unit surface normal
+     * @return RGB irradiance / pi, zero before the first bake
+     */
+    glm::vec3 sampleIrradiance(const glm::vec3& position, const glm::vec3& normal) const;
+
+    bool isBaked() const { return m_baked; }
+
+    const glm::ivec3& getCounts() const { return m_settings.counts; }
+
+    int getProbeCount() const { return m_settings.counts.x * m_settings.counts.y * m_settings.counts.z; }
+
+    glm::vec3 getProbePosition(const glm::ivec3& probe) const;
+
+    /**
+     * @brief Spherical harmonics of one probe, read back from the atlas
+     */
+    SphericalHarmonics9 getProbe(const glm::ivec3& probe) const;
+
+    const Image& getIrradianceAtlas() const { return m_irradianceAtlas; }
+
+    const Image& getVisibilityAtlas() const { return m_visibilityAtlas; }
+
+    const IrradianceProbeSettings& getSettings() const { return m_settings; }
+
+private:
+    void bakeProbe(const PathTracer& tracer, const glm::ivec3& probe);
+    float visibilityWeight(const glm::ivec3& probe, const glm::vec3& toPoint) const;
+
+    IrradianceProbeSettings m_settings;
+    BoundingBox m_bounds;
+    glm::vec3 m_spacing;
+    Image m_irradianceAtlas;
+    Image m_visibilityAtlas;
+    bool m_baked;
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_IRRADIANCE_PROBE_GRID_H
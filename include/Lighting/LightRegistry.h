@@ -0,0 +1,276 @@
+/**
+ * @file LightRegistry.h
+ * @brief Contiguous per-type light storage and packed GPU light buffers
+ */
+
+#ifndef ELEMENTAL_RENDERER_LIGHT_REGISTRY_H
+#define ELEMENTAL_RENDERER_LIGHT_REGISTRY_H
+
+#include "../Light.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace ElementalRenderer {
+
+/**
+ * @brief Stable reference to a registered light
+ *
+ * Handles stay valid while their light is registered, however other lights
+ * are added or removed; a removed light's handle never becomes valid again.
+ */
+struct LightHandle {
+    static const uint32_t kInvalidSlot = 0xffffffffu;
+
+    uint32_t slot = kInvalidSlot;
+    uint32_t generation = 0;
+
+    bool isValid() const { return slot != kInvalidSlot; }
+
+    bool operator==(const LightHandle& other) const { return slot == other.slot && generation == other.generation; }
+
+    bool operator!=(const LightHandle& other) const { return !(*this == other); }
+};
+
+/**
+ * @brief Every property of one light, whatever its type
+ *
+ * Fields that do not apply to the type are ignored.
+ */
+struct LightDesc {
+    LightType type = LightType::POINT;
+    glm::vec3 position = glm::vec3(0.0f);
+    glm::vec3 direction = glm::vec3(0.0f, -1.0f, 0.0f);
+    glm::vec3 color = glm::vec3(1.0f);
+    float intensity = 1.0f;
+    float range = 10.0f;
+    float innerAngle = 30.0f;       // Spot cone, degrees
+    float outerAngle = 45.0f;
+    AreaLightShape shape = AreaLightShape::RECTANGLE;
+    glm::vec3 axisX = glm::vec3(0.5f, 0.0f, 0.0f);    // Area light half extents, see AreaLight::getAxisX()
+    glm::vec3 axisY = glm::vec3(0.0f, 0.0f, 0.5f);
+    bool twoSided = false;
+    bool castShadows = true;
+
+    /**
+     * @brief Describe a scene light
+     */
+    static LightDesc fromLight(const Light& light);
+};
+
+/**
+ * @brief One light in the GPU light buffer
+ *
+ * Five vec4s, so the layout is identical under std430 and std140:
+ *
+ *     struct PackedLight {
+ *         vec4 positionType;      // xyz position, w LightType
+ *         vec4 directionRange;    // xyz direction, w range
+ *         vec4 radianceFlags;     // rgb color * intensity, w flags
+ *         vec4 axisXCosInner;     // xyz area axis X, w spot cos(inner angle)
+ *         vec4 axisYCosOuter;     // xyz area axis Y, w spot cos(outer angle)
+ *     };
+ *
+ * Flags are kPackedCastShadows | kPackedDisk | kPackedTwoSided stored as a
+ * float (exact for these small integers).
+ */
+struct PackedLight {
+    static const int kPackedCastShadows = 1;
+    static const int kPackedDisk = 2;
+    static const int kPackedTwoSided = 4;
+
+    glm::vec4 positionType;
+    glm::vec4 directionRange;
+    glm::vec4 radianceFlags;
+    glm::vec4 axisXCosInner;
+    glm::vec4 axisYCosOuter;
+};
+
+static_assert(sizeof(PackedLight) == 80, "PackedLight must match the std430 layout");
+
+/**
+ * @brief Where each light type starts in a packed buffer, indexed by LightType
+ */
+struct LightBufferLayout {
+    uint32_t offsets[4] = {0, 0, 0, 0};
+    uint32_t counts[4] = {0, 0, 0, 0};
+};
+
+/**
+ * @brief Columns shared by every light type, one element per light
+ */
+struct LightColumns {
+    std::vector<glm::vec3> colors;
+    std::vector<float> intensities;
+    std::vector<uint8_t> castShadows;
+    std::vector<uint32_t> slots;        // Handle slot of each light
+    std::vector<uint64_t> versions;     // Registry version of each light's last change
+
+    size_t size() const { return slots.size(); }
+
+protected:
+    template<typename Visitor>
+    void visitCommon(Visitor&& visitor) {
+        visitor(colors);
+        visitor(intensities);
+        visitor(castShadows);
+        visitor(slots);
+        visitor(versions);
+    }
+};
+
+struct DirectionalLightColumns : LightColumns {
+    std::vector<glm::vec3> directions;
+
+    template<typename Visitor>
+    void visit(Visitor&& visitor) {
+        visitCommon(visitor);
+        visitor(directions);
+    }
+};
+
+struct PointLightColumns : LightColumns {
+    std::vector<glm::vec3> positions;
+    std::vector<float> ranges;
+
+    template<typename Visitor>
+    void visit(Visitor&& visitor) {
+        visitCommon(visitor);
+        visitor(positions);
+        visitor(ranges);
+    }
+};
+
+struct SpotLightColumns : LightColumns {
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> directions;
+    std::vector<float> ranges;
+    std::vector<float> cosInner;
+    std::vector<float> cosOuter;
+
+    template<typename Visitor>
+    void visit(Visitor&& visitor) {
+        visitCommon(visitor);
+        visitor(positions);
+        visitor(directions);
+        visitor(ranges);
+        visitor(cosInner);
+        visitor(cosOuter);
+    }
+};
+
+struct AreaLightColumns : LightColumns {
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> axesX;
+    std::vector<glm::vec3> axesY;
+    std::vector<uint8_t> disk;
+    std::vector<uint8_t> twoSided;
+
+    template<typename Visitor>
+    void visit(Visitor&& visitor) {
+        visitCommon(visitor);
+        visitor(positions);
+        visitor(axesX);
+        visitor(axesY);
+        visitor(disk);
+        visitor(twoSided);
+    }
+};
+
+/**
+ * @brief Light storage with one structure-of-arrays table per light type
+ *
+ * Lights of a type are kept densely packed (removal moves the last light
+ * into the hole), so per-frame code walks a few contiguous columns instead
+ * of chasing one heap object per light. Handles map to the dense position
+ * through a slot table. Every change bumps the registry version and stamps
+ * the light with it, so consumers can skip re-uploads when nothing changed.
+ */
+class LightRegistry {
+public:
+    LightRegistry();
+
+    /**
+     * @brief Register a light
+     * @return Handle for later updates
+     */
+    LightHandle add(const LightDesc& desc);
+
+    /**
+     * @brief Unregister a light
+     * @return False if the handle is not (or no longer) valid
+     */
+    bool remove(LightHandle handle);
+
+    /**
+     * @brief Replace a light's properties, possibly changing its type
+     * @return False if the handle is not valid
+     */
+    bool update(LightHandle handle, const LightDesc& desc);
+
+    bool contains(LightHandle handle) const;
+
+    /**
+     * @brief Read a light's properties back
+     * @return False if the handle is not valid
+     */
+    bool getDesc(LightHandle handle, LightDesc& desc) const;
+
+    /**
+     * @brief Remove every light (all handles become invalid)
+     */
+    void clear();
+
+    size_t getLightCount() const;
+
+    /**
+     * @brief Version of the registry, increased by every change
+     */
+    uint64_t getVersion() const { return m_version; }
+
+    /**
+     * @brief Registry version of a light's last change, 0 for invalid handles
+     */
+    uint64_t getVersion(LightHandle handle) const;
+
+    const DirectionalLightColumns& getDirectionalLights() const { return m_directional; }
+
+    const PointLightColumns& getPointLights() const { return m_point; }
+
+    const SpotLightColumns& getSpotLights() const { return m_spot; }
+
+    const AreaLightColumns& getAreaLights() const { return m_area; }
+
+    /**
+     * @brief Write every light into a GPU buffer, grouped by type
+     * @param buffer Output, resized to the light count
+     * @return Offset and count of each type in the buffer
+     */
+    LightBufferLayout pack(std::vector<PackedLight>& buffer) const;
+
+private:
+    struct Slot {
+        LightType type = LightType::POINT;
+        uint32_t index = 0;         // Position in the type's columns
+        uint32_t generation = 0;
+        bool alive = false;
+    };
+
+    const Slot* findSlot(LightHandle handle) const;
+    void append(uint32_t slot, const LightDesc& desc);
+    void store(const Slot& slot, const LightDesc& desc);
+    void erase(LightType type, uint32_t index);
+
+    DirectionalLightColumns m_directional;
+    PointLightColumns m_point;
+    SpotLightColumns m_spot;
+    AreaLightColumns m_area;
+    std::vector<Slot> m_slots;
+    std::vector<uint32_t> m_freeSlots;
+    uint64_t m_version;
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_LIGHT_REGISTRY_H
@@ -0,0 +1,118 @@
+/**
+ * @file LightmapBaker.h
+ * @brief CPU baker for static direct and indirect lighting into lightmaps
+ */
+
+#ifndef ELEMENTAL_RENDERER_LIGHTMAP_BAKER_H
+#define ELEMENTAL_RENDERER_LIGHTMAP_BAKER_H
+
+#include "../Headless/Image.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace ElementalRenderer {
+
+class PathTracer;
+
+/**
+ * @brief Lightmap bake settings
+ */
+struct LightmapBakeSettings {
+    int width = 512;            // Lightmap size in texels, matching the unwrap resolution
+    int height = 512;
+    int directSamples = 16;     // Light samples per texel
+    int indirectSamples = 64;   // Hemisphere rays per texel
+    int bounces = 1;            // Indirect bounces, 0 bakes direct light only
+    int tileSize = 32;          // Tiles are distributed over the worker threads
+    int dilation = 2;           // Texels filled around charts to hide filtering seams
+    float bias = 1e-4f;         // Ray start offset along the normal, relative to the scene size
+    uint32_t seed = 1;          // Equal seeds give identical bakes
+};
+
+/**
+ * @brief World-space triangles that receive a lightmap
+ */
+struct LightmapSurface {
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> normals;         // Per vertex; zero or missing normals fall back to face normals
+    std::vector<glm::vec2> lightmapCoords;  // Per vertex, e.g. from LightmapUnwrapper
+    std::vector<unsigned int> indices;      // Three per triangle
+};
+
+/**
+ * @brief Bakes static lighting into lightmap texels
+ *
+ * Each texel covered by a triangle in lightmap space is mapped back to its
+ * world position and normal. Direct light is estimated with next-event
+ * samples through the path tracer's light BVH and shadow rays through its
+ * triangle BVH, so every light type of the tracer's scene contributes,
+ * including delta lights a hemisphere search could never find. Indirect
+ * light follows cosine-distributed rays whose radiance the path tracer
+ * evaluates with bounces - 1 further bounces, which for the default of one
+ * bounce is the emission and direct lighting of the surfaces hit. The
+ * receiving surface must be part of the tracer's scene to shadow and bounce
+ * light onto itself.
+ *
+ * Texels store irradiance divided by pi in RGB, the convention of the
+ * irradiance probes, so shaders multiply by the albedo; alpha is 1 for
+ * covered texels and 0 elsewhere. The atlas is split into tiles that run on
+ * all cores; random numbers depend only on the seed, the texel and the
+ * sample index, so bakes do not depend on the thread count. After every
+ * tile the progress callback is invoked under a lock, and cancel() stops
+ * the bake at the next tile boundary.
+ */
+class LightmapBaker {
+public:
+    /**
+     * @brief Progress notification
+     * @param completedTiles Tiles finished so far
+     * @param tileCount Tiles in the bake
+     */
+    using ProgressCallback = std::function<void(int completedTiles, int tileCount)>;
+
+    LightmapBaker();
+
+    void setSettings(const LightmapBakeSettings& settings) { m_settings = settings; }
+
+    const LightmapBakeSettings& getSettings() const { return m_settings; }
+
+    /**
+     * @brief Set the function called after every finished tile, from a worker thread
+     */
+    void setProgressCallback(ProgressCallback callback) { m_progressCallback = std::move(callback); }
+
+    /**
+     * @brief Bake a lightmap
+     * @param tracer Path tracer holding the scene lights and geometry
+     * @param surface Triangles to bake, with lightmap coordinates
+     * @param lightmap Receives the lightmap; unchanged if the bake is cancelled
+     * @return False if the surface is inconsistent or cancel() interrupted the bake
+     */
+    bool bake(const PathTracer& tracer, const LightmapSurface& surface, Image& lightmap);
+
+    /**
+     * @brief Stop the running or next bake (safe to call from another thread)
+     */
+    void cancel();
+
+    /**
+     * @brief Fraction of tiles of the running or last bake that are done
+     */
+    float getProgress() const { return m_progress.load(std::memory_order_relaxed); }
+
+private:
+    LightmapBakeSettings m_settings;
+    ProgressCallback m_progressCallback;
+    std::mutex m_progressMutex;
+    std::atomic<float> m_progress;
+    std::atomic<bool> m_cancelRequested;
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_LIGHTMAP_BAKER_H
@@ -0,0 +1,65 @@
+/**
+ * @file LightmapUnwrapper.h
+ * @brief Chart-based lightmap UV generation and atlas packing
+ */
+
+#ifndef ELEMENTAL_RENDERER_LIGHTMAP_UNWRAPPER_H
+#define ELEMENTAL_RENDERER_LIGHTMAP_UNWRAPPER_H
+
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace ElementalRenderer {
+
+/**
+ * @brief Atlas size and spacing of a lightmap unwrap
+ */
+struct LightmapUnwrapSettings {
+    int resolution = 512;   // Atlas width and height in texels
+    int padding = 2;        // Empty texels kept around every chart
+};
+
+/**
+ * @brief Result of a lightmap unwrap
+ *
+ * Vertices on chart boundaries are split, so the unwrap has its own vertex
+ * list: output vertex i copies input vertex vertexMap[i] and adds
+ * lightmapCoords[i].
+ */
+struct LightmapUnwrap {
+    std::vector<glm::vec2> lightmapCoords;  // Per output vertex, in [0, 1] with Image texel conventions
+    std::vector<unsigned int> vertexMap;    // Input vertex of each output vertex
+    std::vector<unsigned int> indices;      // Three output vertex indices per triangle, same triangle order
+    int chartCount = 0;
+    float texelsPerUnit = 0.0f;             // Uniform scale from mesh units to texels
+};
+
+/**
+ * @brief Generates a second UV set for lightmaps
+ *
+ * Triangles are grouped into charts: edge-connected triangles whose face
+ * normals share the same dominant axis direction (one of six) form one
+ * chart, which is projected flat onto the plane of that axis. Such a
+ * projection never flips a triangle; surfaces that fold back over
+ * themselves along the axis can still overlap, which is rare for the
+ * architectural geometry lightmaps are used for. Charts keep their
+ * relative world size and are shelf-packed, tallest first, at the largest
+ * uniform scale that fits the atlas, with padding texels between charts so
+ * filtering and dilation do not bleed from one chart into the next.
+ */
+class LightmapUnwrapper {
+public:
+    /**
+     * @brief Unwrap a triangle mesh
+     * @param positions Vertex positions
+     * @param indices Three vertex indices per triangle
+     * @param settings Atlas settings
+     * @return Unwrapped vertices; empty if the charts cannot fit even at the smallest scale
+     */
+    static LightmapUnwrap unwrap(const std::vector<glm::vec3>& positions, const std::vector<unsigned int>& indices,
+                                 const LightmapUnwrapSettings& settings = LightmapUnwrapSettings());
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_LIGHTMAP_UNWRAPPER_H
@@ -50,6 +50,26 @@ public:
     void setMat3(const std::string& name, const glm::mat3& value);
     
     void setMat4(const std::string& name, const glm::mat4& value);
+
+    /**
+     * @brief Look up a float property
+     * @param name Property name
+     * @param fallback Value returned when the property is not set
+     */
+    float getFloat(const std::string& name, float fallback = 0.0f) const {
+        auto it = m_floatProperties.find(name);
+        return it != m_floatProperties.end() ? it->second : fallback;
+    }
+
+    /**
+     * @brief Look up a vec3 property
+     * @param name Property name
+     * @param fallback Value returned when the property is not set
+     */
+    glm::vec3 getVec3(const std::string& name, const glm::vec3& fallback = glm::vec3(0.0f)) const {
+        auto it = m_vec3Properties.find(name);
+        return it != m_vec3Properties.end() ? it->second : fallback;
+    }
     
     void apply() const;
     
@@ -6,6 +6,7 @@
 #ifndef ELEMENTAL_RENDERER_MESH_H
 #define ELEMENTAL_RENDERER_MESH_H
 
+#include <cstdint>
 #include <vector>
 #include <string>
 #include <memory>
@@ -16,6 +17,8 @@
 namespace ElementalRenderer {
 
 class Material;
+struct AmbientOcclusionSettings;
+struct LightmapUnwrapSettings;
 
 /**
  * @brief Vertex structure containing position, normal, and texture coordinates
@@ -26,13 +29,14 @@ struct Vertex {
     glm::vec2 texCoords;
     glm::vec3 tangent;
     glm::vec3 bitangent;
+    glm::vec2 lightmapCoords;   // Second UV set, see Mesh::generateLightmapCoords()
     
-    Vertex() : position(0.0f), normal(0.0f), texCoords(0.0f), tangent(0.0f), bitangent(0.0f) {}
+    Vertex() : position(0.0f), normal(0.0f), texCoords(0.0f), tangent(0.0f), bitangent(0.0f), lightmapCoords(0.0f) {}
     
     Vertex(const glm::vec3& pos, const glm::vec3& norm = glm::vec3(0.0f), 
            const glm::vec2& tex = glm::vec2(0.0f), const glm::vec3& tan = glm::vec3(0.0f), 
            const glm::vec3& bitan = glm::vec3(0.0f))
-        : position(pos), normal(norm), texCoords(tex), tangent(tan), bitangent(bitan) {}
+        : position(pos), normal(norm), texCoords(tex), tangent(tan), bitangent(bitan), lightmapCoords(0.0f) {}
 };
 
 /**
@@ -69,6 +73,50 @@ public:
     
     void setPrimitiveType(PrimitiveType type);
 
+    PrimitiveType getPrimitiveType() const { return m_primitiveType; }
+
+    const std::vector<Vertex>& getVertices() const { return m_vertices; }
+
+    const std::vector<unsigned int>& getIndices() const { return m_indices; }
+
+    /**
+     * @brief Set the baked ambient occlusion vertex stream
+     * @param occlusion One value per vertex (255 = unoccluded), or empty to remove the stream
+     * @return False if the size does not match the vertex count
+     */
+    bool setVertexOcclusion(const std::vector<uint8_t>& occlusion);
+
+    const std::vector<uint8_t>& getVertexOcclusion() const { return m_vertexOcclusion; }
+
+    /**
+     * @brief Bake ambient occlusion into the vertex occlusion stream
+     * @param settings Bake settings, see PathTracing/AmbientOcclusionBaker.h
+     * @param cacheDirectory Directory for cached bakes, empty disables caching
+     * @return False if the mesh is not a triangle list
+     */
+    bool bakeAmbientOcclusion(const AmbientOcclusionSettings& settings, const std::string& cacheDirectory = "");
+
+    /**
+     * @brief Bake ambient occlusion with the default settings and no cache
+     */
+    bool bakeAmbientOcclusion();
+
+    /**
+     * @brief Generate non-overlapping lightmap coordinates
+     *
+     * Vertices on chart boundaries are duplicated, so the vertex count grows
+     * and the vertex occlusion stream is removed like in setData().
+     *
+     * @param settings Atlas resolution and chart padding, see Lighting/LightmapUnwrapper.h
+     * @return False if the mesh is not a triangle list or the charts do not fit the atlas
+     */
+    bool generateLightmapCoords(const LightmapUnwrapSettings& settings);
+
+    /**
+     * @brief Generate lightmap coordinates with the default atlas settings
+     */
+    bool generateLightmapCoords();
+
     static std::shared_ptr<Mesh> createCube(float size = 1.0f);
     
     static std::shared_ptr<Mesh> createSphere(float radius = 1.0f, int rings = 16, int sectors = 32);
@@ -78,12 +126,14 @@ public:
 private:
     std::vector<Vertex> m_vertices;
     std::vector<unsigned int> m_indices;
+    std::vector<uint8_t> m_vertexOcclusion;     // Empty unless baked
     std::shared_ptr<Material> m_material;
     PrimitiveType m_primitiveType;
     
     unsigned int m_vao;
     unsigned int m_vbo;
     unsigned int m_ebo;
+    unsigned int m_occlusionVbo;
     
     void setupMesh();
     
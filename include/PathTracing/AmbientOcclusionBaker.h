@@ -0,0 +1,81 @@
+/**
+ * @file AmbientOcclusionBaker.h
+ * @brief Per-vertex ambient occlusion baking for static meshes
+ */
+
+#ifndef ELEMENTAL_RENDERER_AMBIENT_OCCLUSION_BAKER_H
+#define ELEMENTAL_RENDERER_AMBIENT_OCCLUSION_BAKER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace ElementalRenderer {
+
+/**
+ * @brief Ray counts and distances of an ambient occlusion bake
+ */
+struct AmbientOcclusionSettings {
+    int rayCount = 64;          // Rays per vertex, rounded up to a multiple of the packet size 4
+    float maxDistance = 1.0f;   // Occluders farther away do not darken, in mesh units
+    float bias = 1e-4f;         // Ray start offset along the normal, relative to the mesh size
+    uint32_t seed = 1;          // Equal seeds give identical bakes
+};
+
+/**
+ * @brief Result of an ambient occlusion bake
+ */
+struct BakedAmbientOcclusion {
+    std::vector<uint8_t> occlusion;     // One per vertex, 0 fully occluded to 255 unoccluded
+    uint64_t hash = 0;                  // Geometry and settings hash used as cache key
+    bool loadedFromCache = false;
+};
+
+/**
+ * @brief Bakes ambient occlusion into an 8-bit vertex attribute
+ *
+ * Every vertex shoots cosine-distributed rays over the hemisphere around its
+ * normal against a triangle BVH of the mesh itself, in packets of four rays
+ * that traverse the tree together. The stored value is the fraction of rays
+ * that travel maxDistance unobstructed, which is the cosine-weighted
+ * visibility a constant ambient term should be scaled by. Ray directions are
+ * a stratified Hammersley set rotated per vertex by a hash of the seed and
+ * vertex index, and vertices are distributed over all cores, so results do
+ * not depend on the thread count. Bakes can be cached on disk, keyed by a
+ * hash of the geometry and the settings.
+ */
+class AmbientOcclusionBaker {
+public:
+    /**
+     * @brief Bake, or load from the cache if an identical bake exists
+     * @param positions Vertex positions
+     * @param normals Vertex normals; zero or missing normals are replaced by the face normals
+     * @param indices Three vertex indices per triangle
+     * @param settings Bake settings
+     * @param cacheDirectory Directory for cached bakes, empty disables caching
+     * @return Baked occlusion
+     */
+    static BakedAmbientOcclusion bake(const std::vector<glm::vec3>& positions, const std::vector<glm::vec3>& normals,
+                                      const std::vector<unsigned int>& indices,
+                                      const AmbientOcclusionSettings& settings = AmbientOcclusionSettings(),
+                                      const std::string& cacheDirectory = "");
+
+    /**
+     * @brief Cache key of a bake
+     */
+    static uint64_t computeHash(const std::vector<glm::vec3>& positions, const std::vector<glm::vec3>& normals,
+                                const std::vector<unsigned int>& indices, const AmbientOcclusionSettings& settings);
+
+    static bool saveToFile(const BakedAmbientOcclusion& baked, const std::string& filePath);
+
+    /**
+     * @brief Load a bake
+     * @param expectedHash Reject files with a different hash, 0 accepts any
+     */
+    static bool loadFromFile(const std::string& filePath, BakedAmbientOcclusion& baked, uint64_t expectedHash = 0);
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_AMBIENT_OCCLUSION_BAKER_H
@@ -0,0 +1,150 @@
+/**
+ * @file LightBVH.h
+ * @brief Bounding volume hierarchy over lights for many-light importance sampling
+ */
+
+#ifndef ELEMENTAL_RENDERER_LIGHT_BVH_H
+#define ELEMENTAL_RENDERER_LIGHT_BVH_H
+
+#include "../BoundingBox.h"
+#include <cstddef>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace ElementalRenderer {
+
+/**
+ * @brief Spatial and directional bounds of the light emitted by one or more lights
+ *
+ * Emission directions lie within thetaO of the direction axis and fall off
+ * to zero over a further thetaE (pi/2 for cosine emitters such as area
+ * lights). A point light covers the whole sphere: cosThetaO = -1.
+ */
+struct LightBounds {
+    BoundingBox bounds;
+    glm::vec3 direction = glm::vec3(0.0f, 0.0f, 1.0f);
+    float cosThetaO = -1.0f;
+    float cosThetaE = 0.0f;
+    float power = 0.0f;         // Scalar emitted power, the sampling weight
+    bool twoSided = false;
+
+    /**
+     * @brief Conservative estimate of the light reaching a point
+     * @param point Receiving point
+     * @param normal Receiver normal, or zero to ignore the receiver's orientation
+     * @return Unnormalized importance, 0 if no light can arrive
+     */
+    float importance(const glm::vec3& point, const glm::vec3& normal) const;
+
+    /**
+     * @brief Bounds of two sets of lights together
+     */
+    static LightBounds merge(const LightBounds& a, const LightBounds& b);
+};
+
+/**
+ * @brief Sampling description of one light
+ */
+struct LightEmitter {
+    LightBounds bounds;
+    bool infinite = false;      // Directional lights: no position, sampled outside the tree
+};
+
+/**
+ * @brief Light BVH for importance sampling thousands of lights
+ *
+ * Every leaf holds one light; every node stores the union of its lights'
+ * bounds and their total power. Sampling walks from the root, picking each
+ * child with probability proportional to its importance for the shading
+ * point, so lights that are bright, close and facing the point are chosen
+ * far more often than with uniform selection. Infinite lights and the tree
+ * share the probability by count, as the tree cannot bound them.
+ *
+ * The tree is split by the surface area orientation heuristic. When lights
+ * move, updateEmitter() followed by refit() recomputes only the nodes above
+ * the changed leaves and keeps the topology; rebuild after large changes.
+ */
+class LightBVH {
+public:
+    /**
+     * @brief Build the tree, replacing any previous one
+     * @param emitters One entry per light, indices are kept for sampling results
+     */
+    void build(const std::vector<LightEmitter>& emitters);
+
+    /**
+     * @brief Remove all lights
+     */
+    void clear();
+
+    size_t getEmitterCount() const { return m_emitters.size(); }
+
+    const LightEmitter& getEmitter(size_t index) const { return m_emitters[index]; }
+
+    /**
+     * @brief Number of tree nodes (twice the number of finite lights with power, minus one)
+     */
+    size_t getNodeCount() const { return m_nodes.size(); }
+
+    /**
+     * @brief Bounds of all finite lights, empty power if there are none
+     */
+    LightBounds getRootBounds() const;
+
+    /**
+     * @brief Replace a light's bounds, to be applied by refit()
+     *
+     * A light that becomes or stops being infinite, or whose power changes
+     * from or to zero, makes refit() rebuild the tree.
+     */
+    void updateEmitter(size_t index, const LightEmitter& emitter);
+
+    /**
+     * @brief Bring node bounds up to date after updateEmitter()
+     * @return Number of nodes recomputed
+     */
+    size_t refit();
+
+    /**
+     * @brief Choose a light for a shading point
+     * @param point Shading point
+     * @param normal Surface normal, or zero for points in a medium
+     * @param u Uniform random number in [0, 1)
+     * @param emitterIndex Output light index
+     * @param probability Output probability of choosing that light
+     * @return false if no light can reach the point
+     */
+    bool sample(const glm::vec3& point, const glm::vec3& normal, float u, size_t& emitterIndex, float& probability) const;
+
+    /**
+     * @brief Probability that sample() chooses a light, for multiple importance sampling
+     */
+    float probability(const glm::vec3& point, const glm::vec3& normal, size_t emitterIndex) const;
+
+    /**
+     * @brief Choose a light uniformly, the baseline sample() improves on
+     */
+    bool sampleUniform(float u, size_t& emitterIndex, float& probability) const;
+
+private:
+    struct Node {
+        LightBounds bounds;
+        int parent = -1;
+        int children[2] = {-1, -1};
+        int emitter = -1;       // Leaf light, -1 for interior nodes
+    };
+
+    int buildRecursive(std::vector<size_t>& indices, size_t begin, size_t end, int parent);
+    float infiniteProbability() const;
+
+    std::vector<LightEmitter> m_emitters;
+    std::vector<Node> m_nodes;              // Parents precede their children
+    std::vector<int> m_emitterLeaves;       // Leaf node of each light, -1 if not in the tree
+    std::vector<size_t> m_infiniteEmitters;
+    std::vector<int> m_dirtyNodes;
+    bool m_needsRebuild = false;
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_LIGHT_BVH_H
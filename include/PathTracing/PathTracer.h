@@ -0,0 +1,218 @@
+/**
+ * @file PathTracer.h
+ * @brief Progressive CPU path tracer for ground-truth reference renders
+ */
+
+#ifndef ELEMENTAL_RENDERER_PATH_TRACER_H
+#define ELEMENTAL_RENDERER_PATH_TRACER_H
+
+#include "LightBVH.h"
+#include "TriangleBVH.h"
+#include "../Headless/BRDF.h"
+#include "../Headless/Image.h"
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace ElementalRenderer {
+
+class Scene;
+class Light;
+
+/**
+ * @brief Surface description used by the path tracer
+ */
+struct PathTracerMaterial {
+    BRDFModel model = BRDFModel::PHYSICALLY_BASED;
+    BRDFMaterial brdf;
+    glm::vec3 emission = glm::vec3(0.0f);   // Emitted radiance, found by paths that hit the surface
+};
+
+/**
+ * @brief Light description used by the path tracer
+ *
+ * Point and spot lights fall off with the rasterizer's attenuation
+ * 1 / (1 + 0.09 d + 0.032 d^2), so references differ from the raster output
+ * only by what rasterization approximates: shadows, indirect light and area
+ * light visibility.
+ */
+struct PathTracerLight {
+    enum class Type {
+        DIRECTIONAL,
+        POINT,
+        SPOT,
+        AREA
+    };
+
+    Type type = Type::POINT;
+    glm::vec3 position = glm::vec3(0.0f);
+    glm::vec3 direction = glm::vec3(0.0f, -1.0f, 0.0f); // Direction the light travels (unit length)
+    glm::vec3 radiance = glm::vec3(1.0f);               // Color times intensity
+    float cosInner = 1.0f;                              // Spot cone, full intensity inside
+    float cosOuter = 0.0f;                              // Spot cone, dark outside
+    glm::vec3 axisX = glm::vec3(0.5f, 0.0f, 0.0f);      // Area light half extents, emitting along axisY x axisX
+    glm::vec3 axisY = glm::vec3(0.0f, 0.0f, 0.5f);
+    bool disk = false;
+    bool twoSided = false;
+};
+
+/**
+ * @brief Flattened world-space triangles, materials and lights
+ */
+struct PathTracerScene {
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> normals;             // Per vertex, same size as positions
+    std::vector<unsigned int> indices;          // Three per triangle
+    std::vector<uint32_t> triangleMaterials;    // One per triangle
+    std::vector<PathTracerMaterial> materials;
+    std::vector<PathTracerLight> lights;
+    glm::vec3 environment = glm::vec3(0.0f);    // Radiance of rays leaving the scene
+
+    /**
+     * @brief Append a triangle mesh with its own material
+     * @param meshPositions World-space vertex positions
+     * @param meshNormals Vertex normals, or empty for flat shading
+     * @param meshIndices Three vertex indices per triangle
+     * @param material Surface material
+     */
+    void addMesh(const std::vector<glm::vec3>& meshPositions, const std::vector<glm::vec3>& meshNormals,
+                 const std::vector<unsigned int>& meshIndices, const PathTracerMaterial& material);
+
+    /**
+     * @brief Gather the triangle meshes and lights of a scene
+     *
+     * Materials made by Material::createPBRMaterial() map to the physically
+     * based model with their albedo, metallic, roughness and emissive values.
+     * The scene's ambient light becomes the environment radiance.
+     */
+    static PathTracerScene fromScene(const Scene& scene);
+
+    /**
+     * @brief Path tracer description of a scene light
+     */
+    static PathTracerLight makeLight(const Light& light);
+};
+
+/**
+ * @brief Render settings
+ */
+struct PathTracerSettings {
+    int width = 640;
+    int height = 360;
+    int maxBounces = 4;             // Indirect bounces after the first hit
+    int tileSize = 16;              // Tiles are distributed over the worker threads
+    uint32_t seed = 1;              // Images are identical for equal seeds and sample counts
+};
+
+/**
+ * @brief Progressive unidirectional path tracer
+ *
+ * Paths pick one light per vertex with the light BVH for next-event
+ * estimation, shoot a shadow ray through the triangle BVH and continue with
+ * a cosine-weighted bounce, shading with the same CPU BRDFs as the lighting
+ * models. Each renderPass() adds one sample to every pixel, tile by tile on
+ * all cores. Random numbers are derived from the seed, the pixel and the
+ * sample index only, so the output does not depend on thread scheduling.
+ */
+class PathTracer {
+public:
+    PathTracer();
+
+    /**
+     * @brief Set the scene, building both BVHs and discarding accumulated samples
+     */
+    void setScene(const PathTracerScene& scene);
+
+    /**
+     * @brief Change settings, discarding accumulated samples
+     */
+    void setSettings(const PathTracerSettings& settings);
+
+    const PathTracerSettings& getSettings() const { return m_settings; }
+
+    /**
+     * @brief Set the camera, discarding accumulated samples
+     * @param view View matrix
+     * @param projection Projection matrix (perspective or orthographic)
+     */
+    void setCamera(const glm::mat4& view, const glm::mat4& projection);
+
+    /**
+     * @brief Discard accumulated samples
+     */
+    void reset();
+
+    /**
+     * @brief Add one sample per pixel
+     * @return False if cancel() interrupted the pass, whose samples are then discarded
+     */
+    bool renderPass();
+
+    /**
+     * @brief Stop the running or next pass (safe to call from another thread)
+     */
+    void cancel();
+
+    int getSampleCount() const { return m_sampleCount; }
+
+    /**
+     * @brief Mean radiance per pixel so far, row 0 at the bottom like Image
+     */
+    Image getImage() const;
+
+    /**
+     * @brief Trace one path
+     * @param ray Camera ray
+     * @param pixelIndex Pixel the path belongs to (selects its random sequence)
+     * @param sampleIndex Sample number of that pixel
+     * @return Radiance arriving along the ray
+     */
+    glm::vec3 tracePath(const Ray& ray, uint32_t pixelIndex, uint32_t sampleIndex) const;
+
+    /**
+     * @brief Trace one path with its own bounce limit instead of the settings'
+     * @param maxBounces Indirect bounces after the first hit, 0 for emission plus direct light there
+     */
+    glm::vec3 tracePath(const Ray& ray, uint32_t pixelIndex, uint32_t sampleIndex, int maxBounces) const;
+
+    /**
+     * @brief Pick a light with the light BVH and sample a point on it
+     *
+     * Shadowing is left to the caller, through the triangle BVH.
+     *
+     * @param point Receiving point
+     * @param normal Unit normal at the point, guides the light selection
+     * @param uLight Random number selecting the light
+     * @param uPoint Random numbers selecting the point on area lights
+     * @param direction Unit direction towards the light
+     * @param distance Distance to the sampled light point (max float for directional lights)
+     * @param radiance Incoming radiance divided by the selection and sampling pdf
+     * @return False if no light contributes
+     */
+    bool sampleDirectLight(const glm::vec3& point, const glm::vec3& normal, float uLight, const glm::vec2& uPoint,
+                           glm::vec3& direction, float& distance, glm::vec3& radiance) const;
+
+    const TriangleBVH& getTriangleBVH() const { return m_triangleBVH; }
+
+    const LightBVH& getLightBVH() const { return m_lightBVH; }
+
+    /**
+     * @brief Light BVH description of a light
+     */
+    static LightEmitter makeEmitter(const PathTracerLight& light);
+
+private:
+    PathTracerScene m_scene;
+    PathTracerSettings m_settings;
+    TriangleBVH m_triangleBVH;
+    LightBVH m_lightBVH;
+    glm::mat4 m_inverseViewProjection;
+    std::vector<glm::vec3> m_accumulation;
+    int m_sampleCount;
+    std::atomic<bool> m_cancelRequested;
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_PATH_TRACER_H
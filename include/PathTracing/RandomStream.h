@@ -0,0 +1,70 @@
+/**
+ * @file RandomStream.h
+ * @brief Integer hash and PCG random stream shared by the CPU tracers and bakers
+ *
+ * Internal to the path tracing and baking modules; not part of the public API.
+ */
+
+#ifndef ELEMENTAL_RENDERER_PATHTRACING_RANDOMSTREAM_H
+#define ELEMENTAL_RENDERER_PATHTRACING_RANDOMSTREAM_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <glm/glm.hpp>
+
+namespace ElementalRenderer {
+namespace RandomStream {
+
+/**
+ * @brief Integer hash (lowbias32) used to derive independent streams and keys
+ */
+inline uint32_t hash32(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return x;
+}
+
+/**
+ * @brief PCG random stream seeded from a render or bake seed, an element and a sample index
+ *
+ * The element is a pixel or a lightmap texel. Every (seed, element, sample)
+ * triple gives its own stream, so results do not depend on the thread count.
+ */
+class Sampler {
+public:
+    Sampler(uint32_t seed, uint32_t elementIndex, uint32_t sampleIndex)
+        : m_state(hash32(hash32(hash32(seed) + elementIndex) + sampleIndex)) {}
+
+    /**
+     * @brief Next uniform number in [0, 1)
+     */
+    float next() {
+        m_state = m_state * 747796405u + 2891336453u;
+        uint32_t word = ((m_state >> ((m_state >> 28u) + 4u)) ^ m_state) * 277803737u;
+        word = (word >> 22u) ^ word;
+        return std::min(static_cast<float>(word >> 8) * 0x1p-24f, 0x1.fffffep-1f);
+    }
+
+private:
+    uint32_t m_state;
+};
+
+/**
+ * @brief Orthonormal basis around a unit normal (Duff et al.)
+ */
+inline void makeBasis(const glm::vec3& n, glm::vec3& tangent, glm::vec3& bitangent) {
+    const float sign = std::copysign(1.0f, n.z);
+    const float a = -1.0f / (sign + n.z);
+    const float b = n.x * n.y * a;
+    tangent = glm::vec3(1.0f + sign * n.x * n.x * a, sign * b, -sign * n.x);
+    bitangent = glm::vec3(b, sign + n.y * n.y * a, -n.y);
+}
+
+} // namespace RandomStream
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_PATHTRACING_RANDOMSTREAM_H
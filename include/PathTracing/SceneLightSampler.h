@@ -0,0 +1,64 @@
+/**
+ * @file SceneLightSampler.h
+ * @brief Light BVH kept in sync with a Scene
+ */
+
+#ifndef ELEMENTAL_RENDERER_SCENE_LIGHT_SAMPLER_H
+#define ELEMENTAL_RENDERER_SCENE_LIGHT_SAMPLER_H
+
+#include "LightBVH.h"
+#include "../Scene.h"
+#include <vector>
+
+namespace ElementalRenderer {
+
+/**
+ * @brief Importance sampling of a Scene's lights through a LightBVH
+ *
+ * Light indices follow Scene::getLights(). Connect onSceneChange() to
+ * Scene::addListener(): lights reported by notifyLightChanged() are refitted
+ * in place on the next update(), while added and removed lights rebuild the
+ * tree.
+ */
+class SceneLightSampler {
+public:
+    /**
+     * @brief Build the tree over the scene's current lights
+     * @param scene Scene to sample, must outlive the sampler
+     */
+    explicit SceneLightSampler(const Scene& scene);
+
+    /**
+     * @brief Scene listener entry point
+     */
+    void onSceneChange(const SceneChange& change);
+
+    /**
+     * @brief Apply the changes reported since the last update
+     */
+    void update();
+
+    const LightBVH& getBVH() const { return m_bvh; }
+
+    /**
+     * @brief Sampling description of a light
+     *
+     * Power is the luminance of color * intensity times the solid angle a
+     * point or spot light covers, or times pi and the emitting area for an
+     * area light, whose intensity is its radiance. Directional lights are
+     * infinite.
+     */
+    static LightEmitter makeEmitter(const Light& light);
+
+private:
+    std::vector<LightEmitter> gatherEmitters() const;
+
+    const Scene& m_scene;
+    LightBVH m_bvh;
+    std::vector<size_t> m_changedLights;
+    bool m_needsRebuild;
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_SCENE_LIGHT_SAMPLER_H
@@ -0,0 +1,135 @@
+/**
+ * @file TriangleBVH.h
+ * @brief Four-wide bounding volume hierarchy over triangles for CPU ray tracing
+ */
+
+#ifndef ELEMENTAL_RENDERER_TRIANGLE_BVH_H
+#define ELEMENTAL_RENDERER_TRIANGLE_BVH_H
+
+#include "../BoundingBox.h"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace ElementalRenderer {
+
+/**
+ * @brief Ray segment from origin along direction, up to tMax
+ */
+struct Ray {
+    glm::vec3 origin = glm::vec3(0.0f);
+    glm::vec3 direction = glm::vec3(0.0f, 0.0f, -1.0f);
+    float tMax = std::numeric_limits<float>::max();
+};
+
+/**
+ * @brief Closest intersection found by TriangleBVH::intersect()
+ */
+struct RayHit {
+    float t = 0.0f;
+    float u = 0.0f;             // Barycentric weight of the triangle's second vertex
+    float v = 0.0f;             // Barycentric weight of the third vertex
+    uint32_t triangle = 0;      // Index into the triangle list passed to build()
+};
+
+/**
+ * @brief Triangle BVH with four children per node
+ *
+ * The tree is built with the binned surface area heuristic as a binary tree
+ * and then collapsed so every node holds up to four children, whose boxes are
+ * stored as structure-of-arrays and slab-tested against a ray in one SIMD
+ * pass. Closest-hit queries visit children front to back; occlusion queries
+ * stop at the first hit, singly or for packets of four rays. Queries use a
+ * small fixed-size stack on the call stack and never allocate, so they can
+ * run concurrently from any thread.
+ */
+class TriangleBVH {
+public:
+    /**
+     * @brief Build the tree, replacing any previous one
+     * @param positions Vertex positions
+     * @param indices Three vertex indices per triangle
+     */
+    void build(const std::vector<glm::vec3>& positions, const std::vector<unsigned int>& indices);
+
+    /**
+     * @brief Remove all triangles
+     */
+    void clear();
+
+    size_t getTriangleCount() const { return m_triangles.size(); }
+
+    size_t getNodeCount() const { return m_nodes.size(); }
+
+    /**
+     * @brief Bounds of all triangles, empty if there are none
+     */
+    const BoundingBox& getBounds() const { return m_bounds; }
+
+    /**
+     * @brief Find the closest intersection with t in (0, ray.tMax)
+     * @param ray Query ray, direction need not be normalized
+     * @param hit Output intersection, untouched on a miss
+     * @return True if a triangle was hit
+     */
+    bool intersect(const Ray& ray, RayHit& hit) const;
+
+    /**
+     * @brief Check whether any triangle lies on the ray segment (0, ray.tMax)
+     */
+    bool occluded(const Ray& ray) const;
+
+    /**
+     * @brief Occlusion test for a packet of four rays traversed together
+     *
+     * Each node is visited once for all rays that are still unoccluded, with
+     * the rays in SIMD lanes, so coherent rays (sharing an origin, as for
+     * ambient occlusion) share the box tests and memory traffic.
+     *
+     * @param rays Four query rays
+     * @return Bit i set if rays[i] is occluded
+     */
+    int occludedPacket(const Ray (&rays)[4]) const;
+
+private:
+    struct BuildNode {
+        BoundingBox bounds;
+        int children[2] = {-1, -1};
+        uint32_t first = 0;
+        uint32_t count = 0;     // Triangle count of a leaf, 0 for interior nodes
+    };
+
+    // Child slot i is an interior node when counts[i] == 0 and children[i] >= 0,
+    // a leaf of counts[i] triangles starting at children[i] otherwise, or empty
+    // when children[i] == -1 (its box is inverted so rays never enter it)
+    struct alignas(16) Node {
+        float bounds[6][4];     // min x, y, z then max x, y, z, one lane per child
+        int32_t children[4];
+        uint32_t counts[4];
+    };
+
+    // Vertex and edges for the Moller-Trumbore test, in leaf order
+    struct Triangle {
+        glm::vec3 v0;
+        glm::vec3 edge1;
+        glm::vec3 edge2;
+        uint32_t index;
+    };
+
+    int buildRecursive(std::vector<BuildNode>& nodes, std::vector<uint32_t>& order,
+                       const std::vector<BoundingBox>& boxes, uint32_t begin, uint32_t end, int depth);
+    int collapse(const std::vector<BuildNode>& nodes, int buildIndex);
+
+    template<bool AnyHit>
+    bool traverse(const Ray& ray, RayHit* hit) const;
+
+    std::vector<Node> m_nodes;          // Node 0 is the root
+    std::vector<Triangle> m_triangles;
+    BoundingBox m_bounds;
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_TRIANGLE_BVH_H
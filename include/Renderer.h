@@ -8,6 +8,8 @@
 
 #include "Camera.h"
 #include "Scene.h"
+#include "DynamicResolution.h"
+#include "Shaders/PostProcessFusion.h"
 #include <memory>
 #include <string>
 #include <vector>
@@ -16,6 +18,7 @@ namespace ElementalRenderer {
 
 // Forward declarations
 class StyleShaderManager;
+class OutlineShader;
 struct RendererOptions;
 
 /**
@@ -63,6 +66,41 @@ public:
     static std::vector<std::string> getAvailableStyles();
     static std::vector<std::string> getAvailableStyleDescriptions();
 
+    /**
+     * @brief Enable or disable dynamic resolution
+     *
+     * While enabled, the scene is rendered at a size chosen each frame from
+     * GPU frame times and upscaled to the viewport; disabled renders at the
+     * viewport size. Stays disabled if the upscale pass failed to load.
+     *
+     * @param enabled Whether the render size follows the frame budget
+     * @param settings Controller tuning, including the frame budget
+     */
+    static void setDynamicResolution(bool enabled, const DynamicResolutionSettings& settings = DynamicResolutionSettings());
+
+    static bool isDynamicResolutionEnabled();
+
+    /**
+     * @brief Size the scene is rendered at before upscaling to the viewport
+     */
+    static glm::ivec2 getRenderSize();
+
+    /**
+     * @brief Scale, frame times and change counts of the resolution controller
+     */
+    static const DynamicResolutionTelemetry& getDynamicResolutionTelemetry();
+
+    /**
+     * @brief Post-processing stack applied to every frame after the upscale
+     *
+     * The stack is planned with PostProcessFusion, so it costs one full-screen
+     * pass per fused pass instead of one per stage. CUSTOM stages have no
+     * generated shader and are skipped with a warning.
+     *
+     * @param stages Stack in application order, empty for none
+     */
+    static void setPostProcessStack(const std::vector<PostProcessStage>& stages);
+
 private:
     // Private constructor to enforce static usage
     Renderer();
@@ -74,11 +112,59 @@ private:
     static int s_viewportHeight;
     static float s_clearColor[4];
     static std::unique_ptr<StyleShaderManager> s_styleShaderManager;
+    static bool s_dynamicResolution;
+    static DynamicResolutionController s_resolutionController;
+    static unsigned int s_frameTimerQueries[2];   // GPU frame timers, each read back two frames later
+    static int s_frameIndex;
+
+    // Offscreen target the scene is rendered into while dynamic resolution, a
+    // post-processing stack or outlines are on, sized to the viewport with the
+    // render size in its lower-left part. Outlined styles also write view-space
+    // normals and linear depth to the second color attachment.
+    static unsigned int s_sceneFramebuffer;
+    static unsigned int s_sceneColorTexture;
+    static unsigned int s_sceneDepthRenderbuffer;
+    static unsigned int s_sceneNormalDepthTexture;
+    static glm::ivec2 s_sceneTargetSize;
+    static unsigned int s_quadVao;
+    static unsigned int s_quadVbo;
+    static std::unique_ptr<PostProcessShader> s_upscaleShader;
+
+    // Fused post-processing passes; intermediate results alternate between the
+    // scene target and the post-processing target, the last pass writes the screen
+    static std::vector<PostProcessPass> s_postProcessPasses;
+    static std::vector<std::unique_ptr<PostProcessShader>> s_postProcessShaders;
+    static unsigned int s_postProcessFramebuffer;
+    static unsigned int s_postProcessTexture;
+    static glm::ivec2 s_postProcessTargetSize;
+
+    // Screen-space outline for the ANIME style: edge detection and jump flood
+    // alternate between the seed targets, the composite is the first post-processing draw
+    static std::unique_ptr<OutlineShader> s_outlineEdgeShader;
+    static std::unique_ptr<OutlineShader> s_outlineJumpFloodShader;
+    static std::unique_ptr<OutlineShader> s_outlineCompositeShader;
+    static unsigned int s_outlineSeedFramebuffers[2];
+    static unsigned int s_outlineSeedTextures[2];
+    static glm::ivec2 s_outlineSeedSize;
 
     // Internal rendering methods
     static void setupRenderState();
     static void renderSceneInternal();
-    static void applyPostProcessing();
+    static void applyPostProcessing(bool offscreen);
+    static void updateRenderResolution();
+    static void createFullscreenQuad();
+    static bool createUpscalePass();
+    static void destroyUpscalePass();
+    static bool ensureSceneTarget();
+    static void createPostProcessShaders();
+    static void destroyPostProcessPasses();
+    static bool ensurePostProcessTarget();
+    static bool createOutlinePass();
+    static void destroyOutlinePass();
+    static bool ensureOutlineTargets();
+    static bool isOutlinePassActive();
+    static void drawOutlines(unsigned int target, const glm::ivec2& renderSize);
+
 };
 
 } // namespace ElementalRenderer
@@ -9,14 +9,41 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <functional>
 #include <unordered_map>
 #include <glm/glm.hpp>
+#include "Lighting/LightRegistry.h"
 
 namespace ElementalRenderer {
 
 class Mesh;
 class Light;
 class Camera;
+class IrradianceProbeGrid;
+
+/**
+ * @brief Kinds of scene modification reported to listeners
+ */
+enum class SceneChangeType {
+    MESH_ADDED,
+    MESH_REMOVED,       // Meshes after the index shift down by one
+    MESH_CHANGED,       // Transform, geometry or shadow flags changed
+    LIGHT_ADDED,
+    LIGHT_REMOVED,      // Lights after the index shift down by one
+    LIGHT_CHANGED,      // Position, direction, range or shadow settings changed
+    CLEARED
+};
+
+/**
+ * @brief A single scene modification
+ */
+struct SceneChange {
+    SceneChangeType type;
+    size_t index;       // Mesh or light index (unused for CLEARED)
+};
+
+using SceneListener = std::function<void(const SceneChange&)>;
+
 /**
  * @brief Class for managing 3D scenes
  */
@@ -38,6 +65,11 @@ public:
 
     const std::vector<std::shared_ptr<Mesh>>& getMeshes() const;
 
+    /**
+     * @brief Name of every mesh by index, empty for unnamed meshes
+     */
+    std::vector<std::string> getMeshNames() const;
+
     size_t addLight(std::shared_ptr<Light> light, const std::string& name = "");
 
     std::shared_ptr<Light> getLight(size_t index) const;
@@ -50,25 +82,92 @@ public:
 
     const std::vector<std::shared_ptr<Light>>& getLights() const;
 
+    /**
+     * @brief Name of every light by index, empty for unnamed lights
+     */
+    std::vector<std::string> getLightNames() const;
+
+    /**
+     * @brief Contiguous per-type copy of the scene's lights
+     *
+     * Kept in sync by addLight, removeLight, clear and notifyLightChanged;
+     * reading it never touches the Light objects. A light edited through
+     * its pointer keeps its old values here until notifyLightChanged.
+     */
+    const LightRegistry& getLightRegistry() const;
+
+    /**
+     * @brief Registry handle of a light, invalid for out-of-range indices
+     */
+    LightHandle getLightHandle(size_t index) const;
+
     void setAmbientLight(const glm::vec3& color);
 
     glm::vec3 getAmbientLight() const;
 
+    /**
+     * @brief Ambient light at a surface point
+     *
+     * Looks up the irradiance probes when a baked grid is set, otherwise
+     * returns the constant ambient color.
+     *
+     * @param position World-space surface position
+     * @param normal Unit surface normal
+     * @return Irradiance / pi, to be multiplied by the albedo
+     */
+    glm::vec3 getAmbientLight(const glm::vec3& position, const glm::vec3& normal) const;
+
+    /**
+     * @brief Use a probe grid for ambient lighting, or nullptr for the constant color
+     */
+    void setIrradianceProbes(std::shared_ptr<const IrradianceProbeGrid> probes);
+
+    std::shared_ptr<const IrradianceProbeGrid> getIrradianceProbes() const;
+
     void setName(const std::string& name);
 
     std::string getName() const;
 
     void clear();
 
+    /**
+     * @brief Register a callback for scene modifications
+     * @param listener Called after each change
+     * @return Handle for removeListener
+     */
+    size_t addListener(SceneListener listener);
+
+    void removeListener(size_t handle);
+
+    /**
+     * @brief Report that a mesh was modified in place (moved, deformed, ...)
+     *
+     * Meshes and lights do not know which scene holds them, so code that edits
+     * them through the returned pointers reports the edit here.
+     */
+    void notifyMeshChanged(size_t index);
+
+    /**
+     * @brief Report that a light was modified in place
+     */
+    void notifyLightChanged(size_t index);
+
     static std::shared_ptr<Scene> createTestScene(const std::string& name = "Test Scene");
 
 private:
     std::string m_name;
     std::vector<std::shared_ptr<Mesh>> m_meshes;
     std::vector<std::shared_ptr<Light>> m_lights;
+    std::vector<LightHandle> m_lightHandles;    // Parallel to m_lights
+    LightRegistry m_lightRegistry;
     std::unordered_map<std::string, size_t> m_meshNameMap;
     std::unordered_map<std::string, size_t> m_lightNameMap;
     glm::vec3 m_ambientLight;
+    std::shared_ptr<const IrradianceProbeGrid> m_irradianceProbes;
+    std::unordered_map<size_t, SceneListener> m_listeners;
+    size_t m_nextListenerHandle;
+
+    void notify(SceneChangeType type, size_t index);
 };
 
 } // namespace ElementalRenderer
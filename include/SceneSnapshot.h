@@ -0,0 +1,296 @@
+/**
+ * @file SceneSnapshot.h
+ * @brief Binary scene container for fast save, load and editor autosave
+ */
+
+#ifndef ELEMENTAL_RENDERER_SCENE_SNAPSHOT_H
+#define ELEMENTAL_RENDERER_SCENE_SNAPSHOT_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace ElementalRenderer {
+
+class Scene;
+class Mesh;
+
+/**
+ * @brief Sections of a snapshot file
+ */
+enum class SnapshotSectionType : uint32_t {
+    STRINGS,        // Null-terminated names, referenced by byte offset
+    TRANSFORMS,     // SnapshotTransform records
+    MESHES,         // SnapshotMesh records
+    MATERIALS,      // SnapshotMaterial records
+    LIGHTS,         // SnapshotLight records
+    EDITOR,         // A single SnapshotEditorState
+    COUNT
+};
+
+/**
+ * @brief Index or string offset meaning "none"
+ */
+const uint32_t kSnapshotNone = 0xFFFFFFFFu;
+
+/**
+ * @brief Object transform
+ */
+struct SnapshotTransform {
+    glm::vec3 translation = glm::vec3(0.0f);
+    glm::vec4 rotation = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);    // Quaternion, xyzw
+    glm::vec3 scale = glm::vec3(1.0f);
+};
+
+/**
+ * @brief Reference to a mesh; geometry stays in its source asset
+ */
+struct SnapshotMesh {
+    uint32_t name = kSnapshotNone;          // String offset
+    uint32_t source = kSnapshotNone;        // String offset of the asset path, if any
+    uint32_t transform = kSnapshotNone;     // Index into the transforms
+    uint32_t material = kSnapshotNone;      // Index into the materials
+    uint32_t vertexCount = 0;               // Recorded for validation against the resolved mesh
+    uint32_t indexCount = 0;
+    uint32_t flags = 0;
+    uint32_t reserved = 0;
+};
+
+/**
+ * @brief PBR material parameters, as read by the renderers
+ */
+struct SnapshotMaterial {
+    uint32_t name = kSnapshotNone;
+    glm::vec3 albedo = glm::vec3(1.0f);
+    float metallic = 0.0f;
+    float roughness = 0.5f;
+    float ao = 1.0f;
+    float emissive = 0.0f;
+};
+
+/**
+ * @brief Every property of one light, whatever its type
+ */
+struct SnapshotLight {
+    static const uint32_t kCastShadows = 1u << 0;
+    static const uint32_t kTwoSided = 1u << 1;
+
+    uint32_t name = kSnapshotNone;
+    uint32_t type = 0;                      // LightType
+    uint32_t shape = 0;                     // AreaLightShape
+    uint32_t flags = kCastShadows;
+    glm::vec3 position = glm::vec3(0.0f);
+    float range = 10.0f;
+    glm::vec3 direction = glm::vec3(0.0f, -1.0f, 0.0f);
+    float innerAngle = 30.0f;
+    glm::vec3 color = glm::vec3(1.0f);
+    float intensity = 1.0f;
+    glm::vec2 size = glm::vec2(1.0f);
+    float outerAngle = 45.0f;
+    uint32_t reserved = 0;
+};
+
+/**
+ * @brief Scene settings and editor view state
+ */
+struct SnapshotEditorState {
+    static const uint32_t kPlaying = 1u << 0;
+
+    glm::vec3 cameraPosition = glm::vec3(0.0f, 0.0f, 5.0f);
+    int32_t selectedObject = -1;
+    glm::vec3 cameraTarget = glm::vec3(0.0f);
+    uint32_t mode = 0;                      // EditorMode
+    glm::vec3 cameraUp = glm::vec3(0.0f, 1.0f, 0.0f);
+    uint32_t sceneName = kSnapshotNone;
+    glm::vec3 ambientLight = glm::vec3(0.1f);
+    uint32_t flags = 0;
+};
+
+static_assert(sizeof(SnapshotTransform) == 40, "SnapshotTransform is part of the file format");
+static_assert(sizeof(SnapshotMesh) == 32, "SnapshotMesh is part of the file format");
+static_assert(sizeof(SnapshotMaterial) == 32, "SnapshotMaterial is part of the file format");
+static_assert(sizeof(SnapshotLight) == 80, "SnapshotLight is part of the file format");
+static_assert(sizeof(SnapshotEditorState) == 64, "SnapshotEditorState is part of the file format");
+
+/**
+ * @brief Read-only view of the records of one section
+ */
+template<typename T>
+struct SnapshotView {
+    const T* data = nullptr;
+    size_t count = 0;
+
+    const T* begin() const { return data; }
+    const T* end() const { return data + count; }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    const T& operator[](size_t index) const { return data[index]; }
+};
+
+/**
+ * @brief Resolves a mesh reference to geometry when a snapshot is restored
+ * @param name Mesh name
+ * @param source Asset path, or an empty string
+ * @return The mesh, or nullptr to skip the reference
+ */
+using SnapshotMeshResolver = std::function<std::shared_ptr<Mesh>(const std::string& name, const std::string& source)>;
+
+/**
+ * @brief Builds a snapshot file
+ *
+ * Records are appended to one array per section and written with a single
+ * write per section. Strings are deduplicated, so repeated asset paths
+ * cost one copy.
+ */
+class SceneSnapshotWriter {
+public:
+    SceneSnapshotWriter();
+
+    /**
+     * @brief Intern a string
+     * @return Offset to store in a record; kSnapshotNone for the empty string
+     */
+    uint32_t addString(const std::string& value);
+
+    uint32_t addTransform(const SnapshotTransform& transform);
+    uint32_t addMesh(const SnapshotMesh& mesh);
+    uint32_t addMaterial(const SnapshotMaterial& material);
+    uint32_t addLight(const SnapshotLight& light);
+    void setEditorState(const SnapshotEditorState& state);
+
+    /**
+     * @brief Record the meshes, materials, lights and settings of a scene
+     *
+     * Meshes are stored as references by name with an identity transform;
+     * materials shared between meshes are stored once. The editor state
+     * receives the scene name and ambient light.
+     */
+    void captureScene(const Scene& scene);
+
+    /**
+     * @brief Write the snapshot to memory
+     */
+    void writeToBuffer(std::vector<uint8_t>& buffer) const;
+
+    /**
+     * @brief Write the snapshot to a file
+     *
+     * The data goes to a temporary file that then replaces the target, so
+     * an interrupted autosave never leaves a truncated snapshot behind.
+     */
+    bool saveToFile(const std::string& filePath) const;
+
+    void clear();
+
+private:
+    std::vector<char> m_strings;
+    std::unordered_map<std::string, uint32_t> m_stringOffsets;
+    std::vector<SnapshotTransform> m_transforms;
+    std::vector<SnapshotMesh> m_meshes;
+    std::vector<SnapshotMaterial> m_materials;
+    std::vector<SnapshotLight> m_lights;
+    SnapshotEditorState m_editorState;
+};
+
+/**
+ * @brief A snapshot file opened for reading
+ *
+ * The file is memory mapped where the platform allows it. Records hold
+ * indices and string offsets instead of pointers, so the section views
+ * point straight into the mapping with no fixups. Opening validates only
+ * the header and section table; each section is checked on its first
+ * access (sizes, string offsets, cross-section indices), so a load that
+ * touches a few sections pays for just those. A section that fails its
+ * check reads as empty and is reported once.
+ *
+ * Layout, little-endian:
+ *     header          magic "ERSNAP", version, section count, file size
+ *     section table   type, record count, byte offset, byte size per section
+ *     sections        16-byte aligned record arrays
+ */
+class SceneSnapshot {
+public:
+    SceneSnapshot();
+    ~SceneSnapshot();
+
+    SceneSnapshot(const SceneSnapshot&) = delete;
+    SceneSnapshot& operator=(const SceneSnapshot&) = delete;
+
+    /**
+     * @brief Map a snapshot file
+     * @return false if the file is missing or its header or section table is invalid
+     */
+    bool open(const std::string& filePath);
+
+    /**
+     * @brief Read a snapshot held in memory, taking ownership of the bytes
+     */
+    bool openBuffer(std::vector<uint8_t> buffer);
+
+    void close();
+
+    bool isOpen() const { return m_data != nullptr; }
+
+    SnapshotView<SnapshotTransform> getTransforms() const;
+    SnapshotView<SnapshotMesh> getMeshes() const;
+    SnapshotView<SnapshotMaterial> getMaterials() const;
+    SnapshotView<SnapshotLight> getLights() const;
+
+    /**
+     * @brief Editor state, or false if the snapshot has none
+     */
+    bool getEditorState(SnapshotEditorState& state) const;
+
+    /**
+     * @brief String at an offset from a record
+     * @return The string, or "" for kSnapshotNone and invalid offsets
+     */
+    const char* getString(uint32_t offset) const;
+
+    /**
+     * @brief Replace the contents of a scene with the snapshot
+     *
+     * Transforms are not applied, since scenes place meshes through their
+     * vertex data; they remain available through getTransforms(). Snapshot
+     * materials only go to resolved meshes without a material of their own,
+     * since they record the PBR parameters alone. Meshes whose vertex or
+     * index count differs from the recorded one are left out with a warning.
+     * @param resolver Supplies the geometry of each mesh reference
+     * @return false if the snapshot is not open
+     */
+    bool restoreScene(Scene& scene, const SnapshotMeshResolver& resolver) const;
+
+private:
+    enum class SectionState : uint8_t { UNCHECKED, VALID, INVALID };
+
+    struct Section {
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+        uint32_t count = 0;
+    };
+
+    bool openMapped(const uint8_t* data, size_t size);
+    bool checkSection(SnapshotSectionType type) const;
+    bool validate(SnapshotSectionType type) const;
+
+    template<typename T>
+    SnapshotView<T> view(SnapshotSectionType type) const;
+
+    const uint8_t* m_data;
+    size_t m_size;
+    void* m_mapping;                    // Platform mapping, nullptr when reading from m_buffer
+    std::vector<uint8_t> m_buffer;
+    std::array<Section, static_cast<size_t>(SnapshotSectionType::COUNT)> m_sections;
+    mutable std::array<std::atomic<uint8_t>, static_cast<size_t>(SnapshotSectionType::COUNT)> m_states;
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_SCENE_SNAPSHOT_H
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ShaderEffect.h"
+#include "../Headless/EdgeDetector.h"
 
 /**
  * AnimeShader implements a cel-shading technique commonly used
@@ -23,6 +24,11 @@ public:
     void setColorBands(int bands);
     void setSpecularIntensity(float intensity);
     
+    // Outline settings for the screen-space pass, derived from the outline
+    // parameters (thickness as in StyleShaderManager, 0-1). The shader writes
+    // that pass's normal/depth input to its second color output.
+    ElementalRenderer::EdgeSettings getEdgeSettings() const;
+    
 private:
     // Default parameter values
     static constexpr float DEFAULT_OUTLINE_THICKNESS = 0.02f;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "LightingModel.h"
+#include "../Headless/LTC.h"
 
 /**
  * CookTorranceModel implements the Cook-Torrance microfacet specular reflection model,
@@ -9,7 +10,7 @@
 class CookTorranceModel : public LightingModel {
 public:
     CookTorranceModel();
-    ~CookTorranceModel() override = default;
+    ~CookTorranceModel() override;
     
     // Get model description
     std::string getDescription() const override;
@@ -38,7 +39,23 @@ public:
     float getFresnel() const;
     int getDistributionFunction() const;
     
+    // Upload fitted LTC tables (ElementalRenderer::LTC::fit or loadOrFit) as the
+    // ltcMatrix and ltcMagnitude textures used to shade rectangle and disk area lights.
+    // Without a call, applyToShader uploads ElementalRenderer::LTC::getBuiltinTable()
+    void setAreaLightTables(const ElementalRenderer::LTCTable& table);
+    
+    // Check if area light tables have been uploaded
+    bool hasAreaLightTables() const { return ltcMatrixTexture != 0; }
+    
+    // Texture units the LTC tables are bound to by applyToShader
+    static constexpr int LTC_MATRIX_UNIT = 6;
+    static constexpr int LTC_MAGNITUDE_UNIT = 7;
+    
 private:
+    unsigned int ltcMatrixTexture = 0;
+    unsigned int ltcMagnitudeTexture = 0;
+    
+
     // Default parameters
     static constexpr float DEFAULT_ROUGHNESS = 0.3f;
     static constexpr float DEFAULT_METALLIC = 0.0f;
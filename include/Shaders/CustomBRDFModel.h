@@ -1,6 +1,7 @@
 #pragma once
 
 #include "LightingModel.h"
+#include "../Headless/BRDF.h"
 #include <functional>
 
 /**
@@ -27,6 +28,13 @@ public:
     // Set custom BRDF function
     void setCustomBRDF(const BRDFFunction& brdfFunction, const std::string& description = "");
     
+    // Set the CPU version of the custom BRDF, used by BRDF::evaluate for baking and validation
+    // (empty means the default Lambertian, matching the default shader code)
+    void setCPUBRDF(const ElementalRenderer::CustomBRDFCallback& cpuFunction);
+    
+    // Get the CPU version of the custom BRDF
+    const ElementalRenderer::CustomBRDFCallback& getCPUBRDF() const { return cpuBRDFFunction; }
+    
     // Add custom parameter
     void addParameter(const std::string& name, float defaultValue, float min, float max);
     
@@ -43,6 +51,7 @@ public:
     
 private:
     BRDFFunction customBRDFFunction;
+    ElementalRenderer::CustomBRDFCallback cpuBRDFFunction;
     std::string customDescription;
     std::vector<ParameterInfo> parameterInfo;
 };
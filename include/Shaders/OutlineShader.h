@@ -0,0 +1,93 @@
+/**
+ * @file OutlineShader.h
+ * @brief Screen-space outline passes (edge detection, jump flood, composite)
+ */
+
+#ifndef ELEMENTAL_RENDERER_OUTLINE_SHADER_H
+#define ELEMENTAL_RENDERER_OUTLINE_SHADER_H
+
+#include "../Shader.h"
+#include "../Headless/EdgeDetector.h"
+#include <vector>
+
+namespace ElementalRenderer {
+
+/**
+ * @brief GPU counterpart of EdgeDetector
+ *
+ * The outline is drawn in three full-screen stages, each loaded into its own
+ * OutlineShader instance:
+ *  1. edge detection writes the pixel's own coordinates into an RG32F seed
+ *     target on edges and -1 elsewhere,
+ *  2. one jump-flood pass per step from getJumpFloodSteps() ping-pongs the
+ *     seed targets,
+ *  3. the composite blends the outline color over the scene by distance.
+ *
+ * All stages run with the viewport set to the render size and read the
+ * lower-left part of their input textures, so the targets may be larger.
+ */
+class OutlineShader : public Shader {
+public:
+    /**
+     * @brief Default constructor
+     */
+    OutlineShader();
+
+    /**
+     * @brief Destructor
+     */
+    ~OutlineShader();
+
+    /**
+     * @brief Load the edge detection stage (reads gNormalDepth)
+     * @return true if loading was successful, false otherwise
+     */
+    bool loadEdgeDetectionShader();
+
+    /**
+     * @brief Load the jump-flood stage (reads seedTexture)
+     * @return true if loading was successful, false otherwise
+     */
+    bool loadJumpFloodShader();
+
+    /**
+     * @brief Load the composite stage (reads screenTexture and seedTexture)
+     * @return true if loading was successful, false otherwise
+     */
+    bool loadCompositeShader();
+
+    /**
+     * @brief Upload thresholds, operator, line width and color
+     * @param settings Outline settings shared with the CPU path
+     */
+    void setEdgeSettings(const EdgeSettings& settings);
+
+    /**
+     * @brief Set the size of the rendered part of the inputs (edge and jump-flood stages)
+     * @param size Render size in pixels
+     */
+    void setRenderSize(const glm::ivec2& size);
+
+    /**
+     * @brief Set the step of the next jump-flood pass
+     * @param step Step size in pixels
+     */
+    void setJumpStep(int step);
+
+    /**
+     * @brief Jump-flood steps needed for a line width
+     * @param lineWidth Outline width in pixels
+     * @return Steps in the order they must run
+     */
+    static std::vector<int> getJumpFloodSteps(float lineWidth);
+
+private:
+    static const char* s_vertexShaderSource;
+    static const char* s_edgeFragmentShaderSource;
+    static const char* s_jumpFloodFragmentShaderSource;
+    static const char* s_compositeFragmentShaderSource;
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_OUTLINE_SHADER_H
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ShaderEffect.h"
+#include "../Headless/Palette.h"
 
 /**
  * PixelArtEffect implements a post-processing effect that transforms
@@ -29,16 +30,27 @@ public:
     // Set palette mode (0: RGB, 1: Custom palette)
     void setPaletteMode(int mode);
     
+    // Use a custom palette for mode 1 (e.g. from Palette::medianCut or Palette::kMeans).
+    // The palette is baked into a 3D lookup texture so the shader maps colors in O(1).
+    void setCustomPalette(const ElementalRenderer::Palette& palette);
+    
+    // Get the palette used by mode 1 (CGA colors until a custom palette is set)
+    const ElementalRenderer::Palette& getCustomPalette() const { return customPalette; }
+    
 private:
     // Additional resources
     unsigned int framebuffer;
     unsigned int outputTexture;
+    unsigned int paletteLUTTexture;
+    ElementalRenderer::Palette customPalette;
     
     // Default parameter values
     static constexpr int DEFAULT_PIXEL_SIZE = 4;
     static constexpr int DEFAULT_COLOR_DEPTH = 5;
+    static constexpr int PALETTE_LUT_RESOLUTION = 32;
     
     // Helper methods
     void createShaders();
     void createFramebuffer(int width, int height);
+    void uploadPaletteLUT();
 };
@@ -0,0 +1,185 @@
+/**
+ * @file PostProcessFusion.h
+ * @brief Fuses consecutive post-processing effects into single full-screen passes
+ */
+
+#ifndef ELEMENTAL_RENDERER_POST_PROCESS_FUSION_H
+#define ELEMENTAL_RENDERER_POST_PROCESS_FUSION_H
+
+#include "PostProcessShader.h"
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ElementalRenderer {
+
+class Image;
+struct PostProcessStep;
+
+/**
+ * @brief Operations that can appear in a post-processing stack
+ */
+enum class PostProcessStageType {
+    GRAYSCALE,              // per-pixel
+    VIGNETTE,               // per-pixel (depends on screen position only)
+    COLOR_QUANTIZE,         // per-pixel, optional 4x4 ordered dithering
+    TONE_MAP,               // per-pixel
+    BLUR,                   // samples neighbours of its input
+    CHROMATIC_ABERRATION,   // samples neighbours of its input
+    PIXELATE,               // samples its input at snapped coordinates
+    CUSTOM                  // opaque effect, always its own pass
+};
+
+/**
+ * @brief Tone mapping curves available to TONE_MAP stages
+ */
+enum class ToneMapOperator {
+    REINHARD,
+    ACES
+};
+
+/**
+ * @brief One operation in a post-processing stack
+ */
+struct PostProcessStage {
+    PostProcessStageType type = PostProcessStageType::GRAYSCALE;
+    float strength = 1.0f;              // GRAYSCALE, VIGNETTE, BLUR, CHROMATIC_ABERRATION
+    int levels = 5;                     // COLOR_QUANTIZE: levels per channel
+    bool dithering = false;             // COLOR_QUANTIZE
+    int pixelSize = 4;                  // PIXELATE
+    ToneMapOperator toneMapOperator = ToneMapOperator::ACES;
+    float exposure = 1.0f;              // TONE_MAP
+    std::string customName;             // CUSTOM
+
+    /**
+     * @brief Check whether the stage only needs its own pixel's input value
+     * @return true for stages that can be appended to any fused pass
+     */
+    bool isPerPixel() const;
+
+    /**
+     * @brief Create a stage equivalent to a PostProcessShader effect
+     * @param effect Effect type (NONE is not representable and maps to CUSTOM)
+     * @param strength Effect strength
+     * @return The stage
+     */
+    static PostProcessStage fromEffect(PostProcessEffect effect, float strength);
+
+    static PostProcessStage grayscale(float strength);
+    static PostProcessStage vignette(float strength);
+    static PostProcessStage quantize(int levels, bool dithering);
+    static PostProcessStage toneMap(ToneMapOperator op, float exposure);
+    static PostProcessStage blur(float strength);
+    static PostProcessStage chromaticAberration(float strength);
+    static PostProcessStage pixelate(int pixelSize);
+    static PostProcessStage custom(const std::string& name);
+};
+
+/**
+ * @brief A single full-screen pass of a fusion plan
+ *
+ * A pass reads its input texture once (through its first stage when that stage
+ * samples neighbours, otherwise with a plain fetch) and then runs every
+ * following per-pixel stage in registers before writing its output.
+ */
+struct PostProcessPass {
+    std::vector<PostProcessStage> stages;
+    std::vector<int> stageIndices;      // positions of the stages in the original stack
+
+    bool isCustom() const;
+};
+
+/**
+ * @brief Result of analysing a post-processing stack
+ */
+struct PostProcessPlan {
+    std::vector<PostProcessPass> passes;
+    int unfusedPassCount = 0;
+
+    /**
+     * @brief Estimate framebuffer traffic for the plan
+     * @param width Framebuffer width
+     * @param height Framebuffer height
+     * @param bytesPerPixel Bytes per texel of the intermediate targets
+     * @return Bytes read plus bytes written across all passes
+     */
+    double estimateBandwidth(int width, int height, int bytesPerPixel = 8) const;
+
+    /**
+     * @brief Estimate framebuffer traffic if every stage ran as its own pass
+     */
+    double estimateUnfusedBandwidth(int width, int height, int bytesPerPixel = 8) const;
+};
+
+/**
+ * @brief Plans, generates and executes fused post-processing passes
+ *
+ * Planning and CPU execution need no GL context, so the planner can be
+ * validated headless; the generated GLSL uses the same uniform names that
+ * getUniformValues() reports.
+ */
+class PostProcessFusion {
+public:
+    /**
+     * @brief Group a stack into the fewest passes that preserve its result
+     *
+     * A new pass starts at every stage that samples neighbours of its input
+     * (because it must see the fully processed previous output) and around
+     * every CUSTOM stage. Per-pixel stages join the current pass.
+     *
+     * @param stages Stack in application order
+     * @return The fusion plan
+     */
+    static PostProcessPlan plan(const std::vector<PostProcessStage>& stages);
+
+    /**
+     * @brief Convert a PostProcessShader chain to stages
+     * @param steps Chain in application order (NONE entries are dropped)
+     * @return Equivalent stages
+     */
+    static std::vector<PostProcessStage> fromSteps(const std::vector<PostProcessStep>& steps);
+
+    /**
+     * @brief Stages equivalent to a PixelArtEffect configuration
+     * @param pixelSize Pixel grid size
+     * @param colorDepth Levels per channel
+     * @param dithering Whether ordered dithering is enabled
+     * @return Pixelate followed by quantization
+     */
+    static std::vector<PostProcessStage> pixelArtStages(int pixelSize, int colorDepth, bool dithering);
+
+    /**
+     * @brief Generate the fragment shader for one fused pass
+     * @param pass Pass to generate (must not be a CUSTOM pass)
+     * @return GLSL 330 source using the standard post-process vertex shader inputs
+     */
+    static std::string generateFragmentShader(const PostProcessPass& pass);
+
+    /**
+     * @brief Uniform values that the generated shader expects
+     * @param pass Pass whose uniforms are requested
+     * @return Pairs of uniform name and value
+     */
+    static std::vector<std::pair<std::string, float>> getUniformValues(const PostProcessPass& pass);
+
+    /**
+     * @brief Run a plan on the CPU, one memory round trip per pass
+     *
+     * CUSTOM passes have no CPU implementation and leave the image unchanged.
+     *
+     * @param plan Plan to execute
+     * @param image Image processed in place
+     */
+    static void execute(const PostProcessPlan& plan, Image& image);
+
+    /**
+     * @brief Run every stage as a separate pass (reference path)
+     * @param stages Stack in application order
+     * @param image Image processed in place
+     */
+    static void executeUnfused(const std::vector<PostProcessStage>& stages, Image& image);
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_POST_PROCESS_FUSION_H
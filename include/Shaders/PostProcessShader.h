@@ -10,6 +10,8 @@
 
 namespace ElementalRenderer {
 
+struct PostProcessPass;
+
 /**
  * @brief Post-processing effect types
  */
@@ -67,6 +69,36 @@ public:
      */
     PostProcessEffect getEffect() const;
 
+    /**
+     * @brief Load the dynamic resolution upscale pass
+     *
+     * Set screenTexture, renderScale and sharpness, then draw a full-screen
+     * quad with positions at location 0 and texture coordinates at location 1.
+     *
+     * @return true if loading was successful, false otherwise
+     */
+    bool loadUpscale();
+
+    /**
+     * @brief Load the generated shader of one PostProcessFusion pass
+     *
+     * The stage uniforms are set once here; bind screenTexture and draw the
+     * same full-screen quad as for loadUpscale().
+     *
+     * @param pass Pass to load (must not be a CUSTOM pass)
+     * @return true if loading was successful, false otherwise
+     */
+    bool loadFusedPass(const PostProcessPass& pass);
+
+    /**
+     * @brief Dynamic resolution upscale pass, same math as CPUPostProcessor::upscale()
+     *
+     * Samples screenTexture, holding the scene rendered at the internal
+     * resolution in its lower-left renderScale part, and covers the full
+     * output viewport.
+     */
+    static const char* s_upscaleFragmentShaderSource;
+
 private:
     PostProcessEffect m_currentEffect;
     float m_effectStrength;
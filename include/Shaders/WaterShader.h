@@ -38,7 +38,10 @@ public:
     void setTime(float time);
     
     /**
-     * @brief Set water texture maps
+     * @brief Bind the water texture maps to units 0 and 1
+     *
+     * Animated maps can be produced every frame by OceanSimulation::encodeWaterMaps.
+     *
      * @param dudvMap Distortion/DuDv map texture ID
      * @param normalMap Normal map texture ID
      */
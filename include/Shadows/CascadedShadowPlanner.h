@@ -0,0 +1,111 @@
+/**
+ * @file CascadedShadowPlanner.h
+ * @brief Split and light-frustum computation for cascaded shadow maps
+ */
+
+#ifndef ELEMENTAL_RENDERER_CASCADED_SHADOW_PLANNER_H
+#define ELEMENTAL_RENDERER_CASCADED_SHADOW_PLANNER_H
+
+#include "../BoundingBox.h"
+#include <array>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace ElementalRenderer {
+
+/**
+ * @brief Cascade layout parameters
+ */
+struct CascadeSettings {
+    int cascadeCount = 4;           // Number of cascades, at most kMaxCascades
+    float splitLambda = 0.75f;      // 0 = uniform splits, 1 = logarithmic splits
+    float maxShadowDistance = 0.0f; // Shadows end here (view depth); 0 uses the camera far plane
+    int resolution = 2048;          // Shadow map size of each cascade in texels
+    bool stabilize = true;          // Rotation-invariant extents snapped to texels, no shimmering
+};
+
+/**
+ * @brief One planned cascade
+ */
+struct ShadowCascade {
+    float splitNear = 0.0f;         // View depth where the cascade starts
+    float splitFar = 0.0f;          // View depth where the cascade ends
+    glm::mat4 lightView = glm::mat4(1.0f);
+    glm::mat4 lightProjection = glm::mat4(1.0f);
+    glm::mat4 lightSpaceMatrix = glm::mat4(1.0f); // lightProjection * lightView, for ShadowShader
+    float texelSize = 0.0f;         // World units covered by one shadow map texel
+    std::vector<size_t> casters;    // Indices of the casters that must be drawn into this cascade
+};
+
+/**
+ * @brief Plans cascaded shadow maps for a directional light
+ *
+ * Pure CPU math over the camera matrices and bounding boxes, so it can run
+ * (and be tested) without a GL context. Splits follow the practical split
+ * scheme, a blend of logarithmic and uniform distributions. Each cascade is
+ * fitted to its slice of the camera frustum; its depth range is clipped to the
+ * scene bounds so casters between the light and the slice are kept while depth
+ * precision is not spent on empty space. With stabilization on, the light
+ * window has a size that does not change with camera rotation and its origin
+ * moves in whole texels, so shadow edges do not crawl as the camera moves.
+ */
+class CascadedShadowPlanner {
+public:
+    static const int kMaxCascades = 8;
+
+    /**
+     * @brief Compute cascade split distances
+     * @param nearPlane Camera near plane
+     * @param farPlane Distance where shadows end
+     * @param cascadeCount Number of cascades
+     * @param lambda Blend between uniform (0) and logarithmic (1) splits
+     * @return cascadeCount + 1 increasing view depths from nearPlane to farPlane
+     */
+    static std::vector<float> computeSplits(float nearPlane, float farPlane, int cascadeCount, float lambda);
+
+    /**
+     * @brief Plan all cascades
+     * @param cameraView Camera view matrix
+     * @param cameraProjection Camera projection matrix (perspective or orthographic)
+     * @param lightDirection Direction the light travels in
+     * @param sceneBounds World bounds of everything that casts or receives shadows
+     * @param casterBounds World bounds of each caster
+     * @param settings Cascade layout
+     * @return Cascades ordered from near to far
+     */
+    static std::vector<ShadowCascade> plan(const glm::mat4& cameraView, const glm::mat4& cameraProjection,
+                                           const glm::vec3& lightDirection, const BoundingBox& sceneBounds,
+                                           const std::vector<BoundingBox>& casterBounds,
+                                           const CascadeSettings& settings = CascadeSettings());
+
+    /**
+     * @brief World-space corners of a slice of the camera frustum
+     * @param cameraView Camera view matrix
+     * @param cameraProjection Camera projection matrix
+     * @param sliceNear View depth of the slice's near face
+     * @param sliceFar View depth of the slice's far face
+     * @return Near face corners followed by far face corners
+     */
+    static std::array<glm::vec3, 8> getFrustumSliceCorners(const glm::mat4& cameraView, const glm::mat4& cameraProjection,
+                                                          float sliceNear, float sliceFar);
+
+    /**
+     * @brief Find the cascade that shades a point
+     * @param cascades Planned cascades
+     * @param viewDepth Positive view depth of the point
+     * @return Cascade index, or -1 beyond the last cascade
+     */
+    static int selectCascade(const std::vector<ShadowCascade>& cascades, float viewDepth);
+
+    /**
+     * @brief Get the near and far planes encoded in a projection matrix
+     * @param projection Perspective or orthographic projection
+     * @param nearPlane Output near plane distance
+     * @param farPlane Output far plane distance
+     */
+    static void getClipPlanes(const glm::mat4& projection, float& nearPlane, float& farPlane);
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_CASCADED_SHADOW_PLANNER_H
@@ -0,0 +1,169 @@
+/**
+ * @file ShadowAtlas.h
+ * @brief Single-texture shadow atlas with a quadtree allocator
+ */
+
+#ifndef ELEMENTAL_RENDERER_SHADOW_ATLAS_H
+#define ELEMENTAL_RENDERER_SHADOW_ATLAS_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace ElementalRenderer {
+
+/**
+ * @brief Square region of the atlas, in texels
+ */
+struct ShadowAtlasTile {
+    int x = 0;
+    int y = 0;
+    int size = 0;
+};
+
+/**
+ * @brief What a light asks of the atlas this frame
+ */
+struct ShadowAtlasRequest {
+    size_t lightId = 0;
+    float screenCoverage = 0.0f;    // Fraction of the screen the light's influence covers, in [0, 1]
+    float importance = 1.0f;        // Priority multiplier (e.g. intensity, user preference)
+    int maxResolution = 4096;       // Upper bound, e.g. Light::getShadowMapSize()
+    int faceCount = 1;              // 1 for spot lights, 6 for point light cube faces
+};
+
+/**
+ * @brief Where a light's shadow maps live in the atlas
+ */
+struct ShadowAtlasAllocation {
+    size_t lightId = 0;
+    int resolution = 0;             // Size of every face tile
+    std::vector<ShadowAtlasTile> faces;
+    bool moved = false;             // Allocated or relocated this frame, so the shadow maps must be redrawn
+};
+
+/**
+ * @brief Occupancy and fragmentation figures
+ */
+struct ShadowAtlasStats {
+    int allocationCount = 0;        // Lights with shadows this frame
+    int droppedCount = 0;           // Lights that did not fit even at the minimum tile size
+    int relocationCount = 0;        // Allocations created or moved this frame
+    int freeBlockCount = 0;         // Free quadtree nodes
+    int largestFreeTile = 0;        // Largest tile that can still be allocated
+    float usedFraction = 0.0f;      // Allocated area over atlas area
+    float fragmentation = 0.0f;     // 1 - largest free block area / free area
+};
+
+/**
+ * @brief Packs the shadow maps of many lights into one square texture
+ *
+ * Space is handed out by a quadtree (buddy) allocator: tiles are power-of-two
+ * squares, a request splits the smallest free node that fits and freed
+ * siblings merge back into their parent. update() chooses each light's
+ * resolution from its screen coverage and importance and keeps existing
+ * tiles in place unless the resolution changes enough to matter, so shadow
+ * maps are not re-rendered because of reshuffling. When space runs out, the
+ * lowest-priority lights are shrunk first and dropped last.
+ */
+class ShadowAtlas {
+public:
+    /**
+     * @brief Constructor
+     * @param atlasSize Atlas width and height in texels (rounded down to a power of two)
+     * @param minTileSize Smallest tile handed out (rounded down to a power of two)
+     */
+    explicit ShadowAtlas(int atlasSize = 8192, int minTileSize = 64);
+
+    /**
+     * @brief Set the resolution given to a light of importance 1 that covers the whole screen
+     * @param resolution Resolution in texels
+     */
+    void setFullCoverageResolution(int resolution);
+
+    /**
+     * @brief Allocate and release tiles for this frame's lights
+     * @param requests One request per shadow-casting light; lights missing from the list are released
+     */
+    void update(const std::vector<ShadowAtlasRequest>& requests);
+
+    /**
+     * @brief Get a light's allocation
+     * @param lightId Light identifier
+     * @return Allocation, or nullptr if the light has no shadow this frame
+     */
+    const ShadowAtlasAllocation* getAllocation(size_t lightId) const;
+
+    /**
+     * @brief Get occupancy statistics of the current frame
+     */
+    ShadowAtlasStats getStats() const;
+
+    /**
+     * @brief Resolution a request would ideally get
+     * @param request Light request
+     * @return Power-of-two resolution between the minimum tile size and the request's maximum
+     */
+    int chooseResolution(const ShadowAtlasRequest& request) const;
+
+    /**
+     * @brief Scale and offset that map a tile's [0, 1] shadow coordinates into the atlas
+     * @param tile Atlas tile
+     * @return (scaleX, scaleY, offsetX, offsetY)
+     */
+    glm::vec4 getUVTransform(const ShadowAtlasTile& tile) const;
+
+    /**
+     * @brief Reserve a single tile (quadtree allocator)
+     * @param size Tile size, rounded up to a power of two
+     * @param tile Output tile
+     * @return true if space was found
+     */
+    bool allocateTile(int size, ShadowAtlasTile& tile);
+
+    /**
+     * @brief Return a tile to the allocator
+     * @param tile Tile previously returned by allocateTile
+     */
+    void freeTile(const ShadowAtlasTile& tile);
+
+    /**
+     * @brief Release every allocation
+     */
+    void clear();
+
+    int getAtlasSize() const { return m_atlasSize; }
+
+    int getMinTileSize() const { return m_minTileSize; }
+
+private:
+    enum class NodeState : uint8_t {
+        ABSENT,     // Covered by an unsplit ancestor
+        FREE,
+        SPLIT,
+        USED
+    };
+
+    int levelForSize(int size) const;
+    int sizeForLevel(int level) const { return m_atlasSize >> level; }
+    int gridSize(int level) const { return 1 << level; }
+    void setNode(int level, int x, int y, NodeState state);
+    NodeState node(int level, int x, int y) const { return m_levels[level][static_cast<size_t>(y) * gridSize(level) + x]; }
+
+    bool allocateFaces(const ShadowAtlasRequest& request, int resolution, ShadowAtlasAllocation& allocation);
+    void releaseAllocation(ShadowAtlasAllocation& allocation);
+
+    int m_atlasSize;
+    int m_minTileSize;
+    int m_fullCoverageResolution;
+    std::vector<std::vector<NodeState>> m_levels;   // Quadtree nodes, one grid per level
+    std::vector<int> m_freeCounts;                   // Free nodes per level, to skip full levels
+    std::unordered_map<size_t, ShadowAtlasAllocation> m_allocations;
+    int m_droppedCount;
+    int m_relocationCount;
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_SHADOW_ATLAS_H
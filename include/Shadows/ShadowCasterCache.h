@@ -0,0 +1,136 @@
+/**
+ * @file ShadowCasterCache.h
+ * @brief Per-light caching of static shadow casters
+ */
+
+#ifndef ELEMENTAL_RENDERER_SHADOW_CASTER_CACHE_H
+#define ELEMENTAL_RENDERER_SHADOW_CASTER_CACHE_H
+
+#include "../BoundingBox.h"
+#include "../Scene.h"
+#include <map>
+#include <utility>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace ElementalRenderer {
+
+/**
+ * @brief What to draw into one shadow view this frame
+ *
+ * A shadow view keeps a cached depth layer holding only static casters. When
+ * redrawStatic is set, staticCasters must be rendered into that layer first.
+ * The live shadow map is then the cached layer, with dynamicCasters drawn on
+ * top (copy the layer, then depth-test the dynamic draws against it). When
+ * there are no dynamic casters, the cached layer can be sampled directly.
+ */
+struct ShadowViewPlan {
+    bool redrawStatic = false;
+    std::vector<size_t> staticCasters;  // Filled only when redrawStatic is set
+    std::vector<size_t> dynamicCasters;
+};
+
+/**
+ * @brief Cache statistics since the last resetStats()
+ */
+struct ShadowCacheStats {
+    int viewsPrepared = 0;
+    int staticRedraws = 0;          // Views whose static layer had to be re-rendered
+    int staticCastersDrawn = 0;     // Static draws issued (the cost the cache avoids)
+    int staticCastersSkipped = 0;   // Static draws served from cached layers
+};
+
+/**
+ * @brief Tracks which cached static shadow layers are still valid
+ *
+ * A shadow view is one shadow map: a light, or one cascade or cube face of a
+ * light. Each view remembers its light-space matrix and the static casters
+ * culled into it. The layer is re-rendered only when the matrix changes, a
+ * static caster overlapping the view is added, moved or removed, or the light
+ * itself is edited. Dynamic casters are culled every frame, but only among the
+ * (usually few) dynamic meshes, so per-frame CPU culling and submission no
+ * longer scale with the static level geometry.
+ *
+ * Caster and light indices follow the Scene; connect onSceneChange() to
+ * Scene::addListener() so removals shift indices and edits invalidate views.
+ */
+class ShadowCasterCache {
+public:
+    ShadowCasterCache();
+
+    /**
+     * @brief Register or update a caster
+     * @param meshIndex Scene mesh index
+     * @param worldBounds World-space bounds
+     * @param isStatic True if the caster is expected to stay put
+     */
+    void setCaster(size_t meshIndex, const BoundingBox& worldBounds, bool isStatic);
+
+    /**
+     * @brief Stop treating a mesh as a caster (indices are not shifted)
+     */
+    void removeCaster(size_t meshIndex);
+
+    /**
+     * @brief Build this frame's draw lists for one shadow view
+     * @param lightIndex Scene light index
+     * @param viewIndex Cascade or cube face of that light (0 for spot lights)
+     * @param lightSpaceMatrix Projection * view of the shadow map
+     * @return Draw lists and whether the static layer needs re-rendering
+     */
+    ShadowViewPlan prepareView(size_t lightIndex, int viewIndex, const glm::mat4& lightSpaceMatrix);
+
+    /**
+     * @brief Drop every cached layer of a light (e.g. its atlas tile moved)
+     */
+    void invalidateLight(size_t lightIndex);
+
+    /**
+     * @brief Drop every cached layer
+     */
+    void invalidateAll();
+
+    /**
+     * @brief Scene listener entry point
+     * @param change Change reported by the scene
+     */
+    void onSceneChange(const SceneChange& change);
+
+    const ShadowCacheStats& getStats() const { return m_stats; }
+
+    void resetStats() { m_stats = ShadowCacheStats(); }
+
+    /**
+     * @brief Set the tolerance under which light-space matrices count as unchanged
+     * @param epsilon Largest element difference
+     */
+    void setMatrixEpsilon(float epsilon) { m_matrixEpsilon = epsilon; }
+
+private:
+    struct Caster {
+        BoundingBox bounds;
+        bool isStatic = true;
+        bool registered = false;
+    };
+
+    struct View {
+        glm::mat4 lightSpaceMatrix = glm::mat4(1.0f);
+        std::vector<size_t> staticCasters;
+        bool valid = false;
+    };
+
+    using ViewKey = std::pair<size_t, int>;
+
+    static bool overlapsView(const BoundingBox& bounds, const glm::mat4& lightSpaceMatrix);
+    bool matricesMatch(const glm::mat4& a, const glm::mat4& b) const;
+    void invalidateOverlapping(const BoundingBox& bounds);
+
+    std::vector<Caster> m_casters;
+    std::map<ViewKey, View> m_views;
+    ShadowCacheStats m_stats;
+    float m_matrixEpsilon;
+};
+
+} // namespace ElementalRenderer
+
+#endif // ELEMENTAL_RENDERER_SHADOW_CASTER_CACHE_H
@@ -0,0 +1,91 @@
+/**
+ * @file DynamicResolution.cpp
+ * @brief Implementation of the dynamic resolution controller
+ */
+
+#include "DynamicResolution.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ElementalRenderer {
+
+namespace {
+
+const float kMaxStep = 0.5f;        // Largest change of the log pixel fraction per frame
+
+} // namespace
+
+DynamicResolutionController::DynamicResolutionController(const DynamicResolutionSettings& settings)
+    : m_settings(settings)
+    , m_pixelFraction(1.0f)
+    , m_previousError(0.0f)
+    , m_olderError(0.0f) {
+    reset();
+}
+
+void DynamicResolutionController::setSettings(const DynamicResolutionSettings& settings) {
+    m_settings = settings;
+    reset();
+}
+
+void DynamicResolutionController::reset() {
+    m_settings.minScale = std::clamp(m_settings.minScale, 0.01f, 1.0f);
+    m_settings.maxScale = std::clamp(m_settings.maxScale, m_settings.minScale, 1.0f);
+    m_telemetry = DynamicResolutionTelemetry();
+    m_telemetry.scale = m_settings.maxScale;
+    m_pixelFraction = m_settings.maxScale * m_settings.maxScale;
+    m_previousError = 0.0f;
+    m_olderError = 0.0f;
+}
+
+float DynamicResolutionController::update(float frameTime) {
+    if (!(frameTime > 0.0f)) {
+        return m_telemetry.scale;
+    }
+
+    m_telemetry.frameTime = frameTime;
+    const float smoothing = std::clamp(m_settings.smoothing, 0.0f, 1.0f);
+    m_telemetry.filteredFrameTime = m_telemetry.frameCount == 0 ? frameTime
+        : m_telemetry.filteredFrameTime + smoothing * (frameTime - m_telemetry.filteredFrameTime);
+    ++m_telemetry.frameCount;
+
+    // Relative error, positive while there is time left; zero inside the hysteresis band
+    const float budget = std::max(m_settings.targetFrameTime * m_settings.headroom, 1e-3f);
+    float error = std::clamp((budget - m_telemetry.filteredFrameTime) / budget, -1.0f, 1.0f);
+    if (std::abs(error) <= m_settings.hysteresis) {
+        error = 0.0f;
+    }
+
+    // Velocity-form PID on the log of the pixel fraction; clamping the output cannot wind it up
+    const float step = m_settings.proportionalGain * (error - m_previousError) + m_settings.integralGain * error
+                     + m_settings.derivativeGain * (error - 2.0f * m_previousError + m_olderError);
+    m_olderError = m_previousError;
+    m_previousError = error;
+    const float minFraction = m_settings.minScale * m_settings.minScale;
+    const float maxFraction = m_settings.maxScale * m_settings.maxScale;
+    m_pixelFraction = std::clamp(m_pixelFraction * std::exp(std::clamp(step, -kMaxStep, kMaxStep)), minFraction, maxFraction);
+
+    const float scale = std::sqrt(m_pixelFraction);
+    if (scale != m_telemetry.scale) {
+        m_telemetry.scale = scale;
+        ++m_telemetry.scaleChanges;
+    }
+    return m_telemetry.scale;
+}
+
+glm::ivec2 DynamicResolutionController::getRenderSize(const glm::ivec2& outputSize) const {
+    if (m_telemetry.scale >= 1.0f) {
+        return outputSize;
+    }
+    const int alignment = std::max(m_settings.alignment, 1);
+    glm::ivec2 size;
+    for (int axis = 0; axis < 2; ++axis) {
+        const int output = std::max(outputSize[axis], 1);
+        const float scaled = static_cast<float>(output) * m_telemetry.scale;
+        const int aligned = static_cast<int>(std::lround(scaled / alignment)) * alignment;
+        size[axis] = std::clamp(aligned, std::min(alignment, output), output);
+    }
+    return size;
+}
+
+} // namespace ElementalRenderer
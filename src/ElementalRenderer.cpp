@@ -172,6 +172,23 @@ void Renderer::renderScene(const Scene& scene, const Camera& camera) {
         renderGraph->addPass(shadowPass);
     }
 
+    // Gather light uniforms once per frame from the registry's contiguous columns.
+    // The forward shader shades up to 4 positional lights (points, then spots)
+    // and up to 4 area lights.
+    const LightRegistry& lightRegistry = scene.getLightRegistry();
+    std::vector<glm::vec3> lightPositions;
+    std::vector<glm::vec3> lightRadiance;
+    auto gatherPositional = [&](const std::vector<glm::vec3>& positions, const LightColumns& columns) {
+        for (size_t i = 0; i < columns.size() && lightPositions.size() < 4; ++i) {
+            lightPositions.push_back(positions[i]);
+            lightRadiance.push_back(columns.colors[i] * columns.intensities[i]);
+        }
+    };
+    gatherPositional(lightRegistry.getPointLights().positions, lightRegistry.getPointLights());
+    gatherPositional(lightRegistry.getSpotLights().positions, lightRegistry.getSpotLights());
+    const AreaLightColumns& areaLights = lightRegistry.getAreaLights();
+    const int areaLightCount = static_cast<int>(std::min<size_t>(areaLights.size(), 4));
+
     // Create geometry pass
     auto geometryPass = std::make_shared<RenderPass>("GeometryPass", [&]() {
         std::cout << "Executing Geometry Pass" << std::endl;
@@ -194,14 +211,25 @@ void Renderer::renderScene(const Scene& scene, const Camera& camera) {
             shader->setMat4("viewProjection", viewProjectionMatrix);
             shader->setVec3("camPos", cameraPosition);
 
-            int lightCount = std::min(static_cast<int>(lights.size()), 4);
+            const int lightCount = static_cast<int>(lightPositions.size());
             shader->setInt("lightCount", lightCount);
 
             for (int i = 0; i < lightCount; ++i) {
-                const auto& light = lights[i];
-                shader->setVec3("lightPositions[" + std::to_string(i) + "]", light->getPosition());
-                shader->setVec3("lightColors[" + std::to_string(i) + "]", light->getColor() * light->getIntensity());
+                shader->setVec3("lightPositions[" + std::to_string(i) + "]", lightPositions[i]);
+                shader->setVec3("lightColors[" + std::to_string(i) + "]", lightRadiance[i]);
+            }
+
+            // Area lights are shaded with LTC tables bound by CookTorranceModel
+            for (int i = 0; i < areaLightCount; ++i) {
+                const std::string index = "[" + std::to_string(i) + "]";
+                shader->setVec3("areaLightCenters" + index, areaLights.positions[i]);
+                shader->setVec3("areaLightAxesX" + index, areaLights.axesX[i]);
+                shader->setVec3("areaLightAxesY" + index, areaLights.axesY[i]);
+                shader->setVec3("areaLightColors" + index, areaLights.colors[i] * areaLights.intensities[i]);
+                shader->setInt("areaLightShapes" + index, areaLights.disk[i]);
+                shader->setInt("areaLightTwoSided" + index, areaLights.twoSided[i]);
             }
+            shader->setInt("areaLightCount", areaLightCount);
 
             mesh->render();
         }
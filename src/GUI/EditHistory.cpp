@@ -0,0 +1,120 @@
+/**
+ * @file EditHistory.cpp
+ * @brief Implementation of the command based undo/redo history
+ */
+
+#include "GUI/EditHistory.h"
+
+namespace ElementalRenderer {
+
+EditHistory::EditHistory(size_t memoryBudget)
+    : m_memoryBudget(memoryBudget)
+    , m_memoryUsage(0)
+    , m_coalescing(false)
+    , m_mergeable(false) {
+}
+
+void EditHistory::execute(std::unique_ptr<EditCommand> command) {
+    if (!command) {
+        return;
+    }
+    command->apply();
+    record(std::move(command));
+}
+
+void EditHistory::record(std::unique_ptr<EditCommand> command) {
+    if (!command) {
+        return;
+    }
+    clearRedo();
+
+    if (m_coalescing && m_mergeable && !m_undoStack.empty()) {
+        EditCommand& top = *m_undoStack.back();
+        const size_t before = top.getMemoryUsage();
+        if (top.merge(*command)) {
+            m_memoryUsage = m_memoryUsage - before + top.getMemoryUsage();
+            trim();
+            return;
+        }
+    }
+
+    m_memoryUsage += command->getMemoryUsage();
+    m_undoStack.push_back(std::move(command));
+    m_mergeable = m_coalescing;
+    trim();
+}
+
+void EditHistory::beginCoalescing() {
+    m_coalescing = true;
+    m_mergeable = false;
+}
+
+void EditHistory::endCoalescing() {
+    m_coalescing = false;
+    m_mergeable = false;
+}
+
+bool EditHistory::undo() {
+    if (m_undoStack.empty()) {
+        return false;
+    }
+    std::unique_ptr<EditCommand> command = std::move(m_undoStack.back());
+    m_undoStack.pop_back();
+    command->revert();
+    m_redoStack.push_back(std::move(command));
+    m_mergeable = false;
+    return true;
+}
+
+bool EditHistory::redo() {
+    if (m_redoStack.empty()) {
+        return false;
+    }
+    std::unique_ptr<EditCommand> command = std::move(m_redoStack.back());
+    m_redoStack.pop_back();
+    command->apply();
+    m_undoStack.push_back(std::move(command));
+    m_mergeable = false;
+    return true;
+}
+
+std::string EditHistory::getUndoDescription() const {
+    return m_undoStack.empty() ? std::string() : m_undoStack.back()->getDescription();
+}
+
+std::string EditHistory::getRedoDescription() const {
+    return m_redoStack.empty() ? std::string() : m_redoStack.back()->getDescription();
+}
+
+void EditHistory::clear() {
+    m_undoStack.clear();
+    m_redoStack.clear();
+    m_memoryUsage = 0;
+    m_mergeable = false;
+}
+
+void EditHistory::setMemoryBudget(size_t bytes) {
+    m_memoryBudget = bytes;
+    trim();
+}
+
+void EditHistory::clearRedo() {
+    for (const auto& command : m_redoStack) {
+        m_memoryUsage -= command->getMemoryUsage();
+    }
+    m_redoStack.clear();
+}
+
+void EditHistory::trim() {
+    // Redo steps are the first to go, then the oldest undo steps
+    while (m_memoryUsage > m_memoryBudget && !m_redoStack.empty()) {
+        m_memoryUsage -= m_redoStack.front()->getMemoryUsage();
+        m_redoStack.erase(m_redoStack.begin());
+    }
+    while (m_memoryUsage > m_memoryBudget && m_undoStack.size() > 1) {
+        m_memoryUsage -= m_undoStack.front()->getMemoryUsage();
+        m_undoStack.pop_front();
+    }
+}
+
+} // namespace ElementalRenderer
@@ -314,7 +314,9 @@ void ImGuiManager::showInspector(bool* open) {
     
     if (m_selectedLight) {
         if (ImGui::CollapsingHeader("Light", ImGuiTreeNodeFlags_DefaultOpen)) {
-            drawLightProperties(m_selectedLight);
+            if (drawLightProperties(m_selectedLight)) {
+                notifyLightEdited(m_selectedLight);
+            }
         }
     }
     
@@ -395,7 +397,9 @@ void ImGuiManager::showLightEditor(Light* light, bool* open) {
         return;
     }
     
-    drawLightProperties(light);
+    if (drawLightProperties(light)) {
+        notifyLightEdited(light);
+    }
     
     ImGui::End();
 }
@@ -763,14 +767,16 @@ void ImGuiManager::drawMaterialProperties(Material* material) {
     }
 }
 
-void ImGuiManager::drawLightProperties(Light* light) {
-    if (!light) return;
+bool ImGuiManager::drawLightProperties(Light* light) {
+    if (!light) return false;
+    bool changed = false;
     
     // Light type
     int lightType = static_cast<int>(light->getType());
     const char* lightTypeNames[] = { "Directional", "Point", "Spot", "Area" };
     if (ImGui::Combo("Type", &lightType, lightTypeNames, IM_ARRAYSIZE(lightTypeNames))) {
         light->setType(static_cast<Light::Type>(lightType));
+        changed = true;
     }
     
     // Light color
@@ -778,12 +784,14 @@ void ImGuiManager::drawLightProperties(Light* light) {
     float colorF[3] = { color.r, color.g, color.b };
     if (ImGui::ColorEdit3("Color", colorF)) {
         light->setColor(glm::vec3(colorF[0], colorF[1], colorF[2]));
+        changed = true;
     }
     
     // Light intensity
     float intensity = light->getIntensity();
     if (ImGui::SliderFloat("Intensity", &intensity, 0.0f, 10.0f)) {
         light->setIntensity(intensity);
+        changed = true;
     }
     
     // Light position (for point and spot lights)
@@ -792,6 +800,7 @@ void ImGuiManager::drawLightProperties(Light* light) {
         float positionF[3] = { position.x, position.y, position.z };
         if (ImGui::DragFloat3("Position", positionF, 0.1f)) {
             light->setPosition(glm::vec3(positionF[0], positionF[1], positionF[2]));
+            changed = true;
         }
     }
     
@@ -801,6 +810,7 @@ void ImGuiManager::drawLightProperties(Light* light) {
         float directionF[3] = { direction.x, direction.y, direction.z };
         if (ImGui::DragFloat3("Direction", directionF, 0.1f)) {
             light->setDirection(glm::normalize(glm::vec3(directionF[0], directionF[1], directionF[2])));
+            changed = true;
         }
     }
     
@@ -809,6 +819,7 @@ void ImGuiManager::drawLightProperties(Light* light) {
         float range = light->getRange();
         if (ImGui::SliderFloat("Range", &range, 0.1f, 100.0f)) {
             light->setRange(range);
+            changed = true;
         }
     }
     
@@ -817,11 +828,13 @@ void ImGuiManager::drawLightProperties(Light* light) {
         float spotAngle = light->getSpotAngle();
         if (ImGui::SliderFloat("Spot Angle", &spotAngle, 0.0f, 90.0f)) {
             light->setSpotAngle(spotAngle);
+            changed = true;
         }
         
         float spotSoftness = light->getSpotSoftness();
         if (ImGui::SliderFloat("Spot Softness", &spotSoftness, 0.0f, 1.0f)) {
             light->setSpotSoftness(spotSoftness);
+            changed = true;
         }
     }
     
@@ -829,17 +842,35 @@ void ImGuiManager::drawLightProperties(Light* light) {
     bool castShadows = light->getCastShadows();
     if (ImGui::Checkbox("Cast Shadows", &castShadows)) {
         light->setCastShadows(castShadows);
+        changed = true;
     }
     
     if (castShadows) {
         int shadowMapSize = light->getShadowMapSize();
         if (ImGui::SliderInt("Shadow Map Size", &shadowMapSize, 512, 4096)) {
             light->setShadowMapSize(shadowMapSize);
+            changed = true;
         }
         
         float shadowBias = light->getShadowBias();
         if (ImGui::SliderFloat("Shadow Bias", &shadowBias, 0.0f, 0.01f, "%.5f")) {
             light->setShadowBias(shadowBias);
+            changed = true;
+        }
+    }
+    
+    return changed;
+}
+
+void ImGuiManager::notifyLightEdited(const Light* light) {
+    // The scene's light registry only sees edits reported through notifyLightChanged
+    if (!m_activeScene) return;
+    
+    const auto& lights = m_activeScene->getLights();
+    for (size_t i = 0; i < lights.size(); ++i) {
+        if (lights[i].get() == light) {
+            m_activeScene->notifyLightChanged(i);
+            return;
         }
     }
 }
@@ -0,0 +1,354 @@
+/**
+ * @file SceneEditor.cpp
+ * @brief Implementation of the scene editor state management
+ */
+
+#include "GUI/SceneEditor.h"
+#include "Mesh.h"
+
+#include <imgui.h>
+#include <iostream>
+#include <GLFW/glfw3.h>
+
+namespace ElementalRenderer {
+
+namespace {
+
+const char* kModeNames[] = { "Scene", "Material", "Lighting", "Camera", "Animation" };
+
+BoundingBox meshBounds(const Mesh& mesh) {
+    BoundingBox bounds;
+    for (const Vertex& vertex : mesh.getVertices()) {
+        bounds.expand(vertex.position);
+    }
+    return bounds;
+}
+
+} // namespace
+
+SceneEditor::SceneEditor()
+    : m_currentMode(EditorMode::SCENE)
+    , m_selectedObjectId(-1)
+    , m_isDragging(false)
+    , m_isPlaying(false)
+    , m_viewportSize(1, 1)
+    , m_sceneListener(0)
+    , m_hasSceneListener(false) {
+}
+
+SceneEditor::~SceneEditor() {
+    if (m_scene && m_hasSceneListener) {
+        m_scene->removeListener(m_sceneListener);
+    }
+}
+
+bool SceneEditor::initialize(std::shared_ptr<Scene> scene, std::shared_ptr<Camera> camera) {
+    if (!scene || !camera) {
+        return false;
+    }
+    if (m_scene && m_hasSceneListener) {
+        m_scene->removeListener(m_sceneListener);
+    }
+    m_scene = scene;
+    m_camera = camera;
+    m_history.clear();
+    m_sceneListener = m_scene->addListener([this](const SceneChange& change) { onSceneChanged(change); });
+    m_hasSceneListener = true;
+    rebuildPicker();
+    return true;
+}
+
+EditorMode SceneEditor::getCurrentMode() const {
+    return m_currentMode;
+}
+
+void SceneEditor::setCurrentMode(EditorMode mode) {
+    m_currentMode = mode;
+}
+
+int SceneEditor::getSelectedObjectId() const {
+    return m_selectedObjectId;
+}
+
+void SceneEditor::setSelectedObjectId(int id) {
+    m_selectedObjectId = id;
+}
+
+bool SceneEditor::isDragging() const {
+    return m_isDragging;
+}
+
+void SceneEditor::setDragging(bool dragging) {
+    if (dragging == m_isDragging) {
+        return;
+    }
+    m_isDragging = dragging;
+    if (dragging) {
+        m_history.beginCoalescing();
+    } else {
+        m_history.endCoalescing();
+    }
+}
+
+bool SceneEditor::isPlaying() const {
+    return m_isPlaying;
+}
+
+void SceneEditor::setPlaying(bool playing) {
+    m_isPlaying = playing;
+}
+
+void SceneEditor::execute(std::unique_ptr<EditCommand> command) {
+    m_history.execute(std::move(command));
+}
+
+bool SceneEditor::undo() {
+    // An undo ends any drag so the next edit starts a fresh step
+    setDragging(false);
+    return m_history.undo();
+}
+
+bool SceneEditor::redo() {
+    setDragging(false);
+    return m_history.redo();
+}
+
+bool SceneEditor::canUndo() const {
+    return m_history.canUndo();
+}
+
+bool SceneEditor::canRedo() const {
+    return m_history.canRedo();
+}
+
+EditHistory& SceneEditor::getHistory() {
+    return m_history;
+}
+
+std::shared_ptr<Scene> SceneEditor::getScene() const {
+    return m_scene;
+}
+
+std::shared_ptr<Camera> SceneEditor::getCamera() const {
+    return m_camera;
+}
+
+bool SceneEditor::saveSnapshot(const std::string& filePath) const {
+    if (!m_scene) {
+        return false;
+    }
+    SceneSnapshotWriter writer;
+    writer.captureScene(*m_scene);
+
+    SnapshotEditorState state;
+    state.sceneName = writer.addString(m_scene->getName());
+    state.ambientLight = m_scene->getAmbientLight();
+    state.selectedObject = m_selectedObjectId;
+    state.mode = static_cast<uint32_t>(m_currentMode);
+    state.flags = m_isPlaying ? SnapshotEditorState::kPlaying : 0u;
+    if (m_camera) {
+        state.cameraPosition = m_camera->getPosition();
+        state.cameraTarget = m_camera->getTarget();
+        state.cameraUp = m_camera->getUp();
+    }
+    writer.setEditorState(state);
+    return writer.saveToFile(filePath);
+}
+
+bool SceneEditor::loadSnapshot(const std::string& filePath, const SnapshotMeshResolver& resolver) {
+    if (!m_scene) {
+        return false;
+    }
+    SceneSnapshot snapshot;
+    if (!snapshot.open(filePath) || !snapshot.restoreScene(*m_scene, resolver)) {
+        std::cerr << "Warning: Could not load scene snapshot '" << filePath << "'" << std::endl;
+        return false;
+    }
+
+    setDragging(false);
+    m_history.clear();
+    SnapshotEditorState state;
+    if (snapshot.getEditorState(state)) {
+        m_selectedObjectId = state.selectedObject;
+        m_currentMode = state.mode <= static_cast<uint32_t>(EditorMode::ANIMATION)
+            ? static_cast<EditorMode>(state.mode) : EditorMode::SCENE;
+        m_isPlaying = (state.flags & SnapshotEditorState::kPlaying) != 0;
+        if (m_camera) {
+            m_camera->setPosition(state.cameraPosition);
+            m_camera->setTarget(state.cameraTarget);
+            m_camera->setUp(state.cameraUp);
+        }
+    }
+    return true;
+}
+
+void SceneEditor::setViewportSize(const glm::ivec2& size) {
+    m_viewportSize = glm::max(size, glm::ivec2(1));
+}
+
+bool SceneEditor::pickObject(double xpos, double ypos, PickHit& hit) {
+    if (!m_camera) {
+        return false;
+    }
+    const glm::vec2 ndc = ScenePicker::cursorToNDC(glm::vec2(static_cast<float>(xpos), static_cast<float>(ypos)), m_viewportSize);
+    return m_picker.pick(ScenePicker::unproject(m_camera->getViewProjectionMatrix(), ndc), hit);
+}
+
+std::vector<int> SceneEditor::selectRectangle(const glm::vec2& cursorStart, const glm::vec2& cursorEnd) {
+    if (!m_camera) {
+        return {};
+    }
+    return toMeshIndices(m_picker.selectRectangle(m_camera->getViewProjectionMatrix(),
+                                                  ScenePicker::cursorToNDC(cursorStart, m_viewportSize),
+                                                  ScenePicker::cursorToNDC(cursorEnd, m_viewportSize)));
+}
+
+std::vector<int> SceneEditor::selectLasso(const std::vector<glm::vec2>& cursorPath) {
+    if (!m_camera) {
+        return {};
+    }
+    std::vector<glm::vec2> lasso;
+    lasso.reserve(cursorPath.size());
+    for (const glm::vec2& cursor : cursorPath) {
+        lasso.push_back(ScenePicker::cursorToNDC(cursor, m_viewportSize));
+    }
+    return toMeshIndices(m_picker.selectLasso(m_camera->getViewProjectionMatrix(), lasso));
+}
+
+ScenePicker& SceneEditor::getPicker() {
+    return m_picker;
+}
+
+void SceneEditor::onSceneChanged(const SceneChange& change) {
+    switch (change.type) {
+    case SceneChangeType::MESH_ADDED:
+        addPickableMesh(change.index);
+        break;
+    case SceneChangeType::MESH_CHANGED:
+        if (std::shared_ptr<Mesh> mesh = m_scene->getMesh(change.index)) {
+            m_picker.invalidateGeometry(static_cast<uint32_t>(change.index), meshBounds(*mesh));
+        }
+        break;
+    case SceneChangeType::MESH_REMOVED:
+        // Picker ids are mesh indices, which shift down after a removal
+        rebuildPicker();
+        if (m_selectedObjectId == static_cast<int>(change.index)) {
+            m_selectedObjectId = -1;
+        } else if (m_selectedObjectId > static_cast<int>(change.index)) {
+            --m_selectedObjectId;
+        }
+        break;
+    case SceneChangeType::CLEARED:
+        m_picker.clear();
+        m_selectedObjectId = -1;
+        break;
+    default:
+        break;
+    }
+}
+
+void SceneEditor::addPickableMesh(size_t index) {
+    std::shared_ptr<Mesh> mesh = m_scene->getMesh(index);
+    if (!mesh) {
+        return;
+    }
+    // The triangle BVH is built from the mesh the first time a ray reaches it
+    std::weak_ptr<Mesh> source = mesh;
+    m_picker.setObject(static_cast<uint32_t>(index), meshBounds(*mesh),
+                       [source](std::vector<glm::vec3>& positions, std::vector<unsigned int>& indices) {
+        std::shared_ptr<Mesh> target = source.lock();
+        if (!target || target->getPrimitiveType() != Mesh::PrimitiveType::TRIANGLES) {
+            return;
+        }
+        positions.reserve(target->getVertices().size());
+        for (const Vertex& vertex : target->getVertices()) {
+            positions.push_back(vertex.position);
+        }
+        indices = target->getIndices();
+    });
+}
+
+void SceneEditor::rebuildPicker() {
+    m_picker.clear();
+    if (!m_scene) {
+        return;
+    }
+    for (size_t i = 0; i < m_scene->getMeshes().size(); ++i) {
+        addPickableMesh(i);
+    }
+}
+
+std::vector<int> SceneEditor::toMeshIndices(const std::vector<uint32_t>& ids) const {
+    return std::vector<int>(ids.begin(), ids.end());
+}
+
+void SceneEditor::renderUI() {
+    if (!ImGui::Begin("Scene Editor")) {
+        ImGui::End();
+        return;
+    }
+
+    int mode = static_cast<int>(m_currentMode);
+    if (ImGui::Combo("Mode", &mode, kModeNames, IM_ARRAYSIZE(kModeNames))) {
+        m_currentMode = static_cast<EditorMode>(mode);
+    }
+
+    if (ImGui::Button("Undo")) {
+        undo();
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Redo")) {
+        redo();
+    }
+
+    if (canUndo()) {
+        ImGui::Text("Undo: %s", m_history.getUndoDescription().c_str());
+    }
+    if (canRedo()) {
+        ImGui::Text("Redo: %s", m_history.getRedoDescription().c_str());
+    }
+    ImGui::Text("History: %zu steps, %.1f KB", m_history.getUndoCount() + m_history.getRedoCount(),
+                m_history.getMemoryUsage() / 1024.0);
+
+    ImGui::End();
+}
+
+void SceneEditor::processKeyInput(int key, int action, int mods) {
+    if (action != GLFW_PRESS && action != GLFW_REPEAT) {
+        return;
+    }
+    if (!(mods & GLFW_MOD_CONTROL)) {
+        return;
+    }
+    if (key == GLFW_KEY_Z) {
+        if (mods & GLFW_MOD_SHIFT) {
+            redo();
+        } else {
+            undo();
+        }
+    } else if (key == GLFW_KEY_Y) {
+        redo();
+    }
+}
+
+void SceneEditor::processMouseInput(int button, int action, int mods, double xpos, double ypos) {
+    (void)mods;
+    if (button != GLFW_MOUSE_BUTTON_LEFT) {
+        return;
+    }
+    // A press selects what is under the cursor and starts dragging it; everything
+    // the drag records until the release is one undo step
+    if (action == GLFW_PRESS && !m_isPlaying) {
+        PickHit hit;
+        if (pickObject(xpos, ypos, hit)) {
+            m_selectedObjectId = static_cast<int>(hit.object);
+            setDragging(true);
+        } else {
+            m_selectedObjectId = -1;
+        }
+    } else if (action == GLFW_RELEASE) {
+        setDragging(false);
+    }
+}
+
+} // namespace ElementalRenderer
@@ -0,0 +1,451 @@
+/**
+ * @file ScenePicker.cpp
+ * @brief Implementation of two-level BVH picking and frustum selection
+ */
+
+#include "GUI/ScenePicker.h"
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace ElementalRenderer {
+
+namespace {
+
+const uint32_t kMaxLeafObjects = 4;
+const int kStackSize = 64;
+
+bool intersectBox(const BoundingBox& box, const glm::vec3& origin, const glm::vec3& inverseDirection,
+                  float tMax, float& tNear) {
+    if (box.isEmpty()) {
+        return false;
+    }
+    float t0 = 0.0f;
+    float t1 = tMax;
+    for (int axis = 0; axis < 3; ++axis) {
+        float tA = (box.min[axis] - origin[axis]) * inverseDirection[axis];
+        float tB = (box.max[axis] - origin[axis]) * inverseDirection[axis];
+        if (tA > tB) {
+            std::swap(tA, tB);
+        }
+        t0 = std::max(t0, tA);
+        t1 = std::min(t1, tB);
+        if (t0 > t1) {
+            return false;
+        }
+    }
+    tNear = t0;
+    return true;
+}
+
+// Planes point inwards: a point p is inside when dot(plane.xyz, p) + plane.w >= 0
+bool outsideFrustum(const BoundingBox& box, const glm::vec4 (&planes)[6]) {
+    if (box.isEmpty()) {
+        return true;
+    }
+    for (const glm::vec4& plane : planes) {
+        const glm::vec3 farthest(plane.x >= 0.0f ? box.max.x : box.min.x,
+                                 plane.y >= 0.0f ? box.max.y : box.min.y,
+                                 plane.z >= 0.0f ? box.max.z : box.min.z);
+        if (plane.x * farthest.x + plane.y * farthest.y + plane.z * farthest.z + plane.w < 0.0f) {
+            return true;
+        }
+    }
+    return false;
+}
+
+glm::vec4 matrixRow(const glm::mat4& matrix, int row) {
+    return glm::vec4(matrix[0][row], matrix[1][row], matrix[2][row], matrix[3][row]);
+}
+
+// Frustum through a screen rectangle, from the rows of the view-projection matrix
+void rectanglePlanes(const glm::mat4& viewProjection, const glm::vec2& ndcMin, const glm::vec2& ndcMax,
+                     glm::vec4 (&planes)[6]) {
+    const glm::vec4 x = matrixRow(viewProjection, 0);
+    const glm::vec4 y = matrixRow(viewProjection, 1);
+    const glm::vec4 z = matrixRow(viewProjection, 2);
+    const glm::vec4 w = matrixRow(viewProjection, 3);
+    planes[0] = x - w * ndcMin.x;
+    planes[1] = w * ndcMax.x - x;
+    planes[2] = y - w * ndcMin.y;
+    planes[3] = w * ndcMax.y - y;
+    planes[4] = z + w;
+    planes[5] = w - z;
+}
+
+// Liang-Barsky: does the segment touch the rectangle?
+bool segmentTouchesRectangle(const glm::vec2& a, const glm::vec2& b, const glm::vec2& rectMin, const glm::vec2& rectMax) {
+    float t0 = 0.0f;
+    float t1 = 1.0f;
+    const glm::vec2 delta = b - a;
+    const float p[4] = { -delta.x, delta.x, -delta.y, delta.y };
+    const float q[4] = { a.x - rectMin.x, rectMax.x - a.x, a.y - rectMin.y, rectMax.y - a.y };
+    for (int i = 0; i < 4; ++i) {
+        if (p[i] == 0.0f) {
+            if (q[i] < 0.0f) {
+                return false;
+            }
+            continue;
+        }
+        const float t = q[i] / p[i];
+        if (p[i] < 0.0f) {
+            t0 = std::max(t0, t);
+        } else {
+            t1 = std::min(t1, t);
+        }
+        if (t0 > t1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool insidePolygon(const glm::vec2& point, const std::vector<glm::vec2>& polygon) {
+    bool inside = false;
+    for (size_t i = 0, j = polygon.size() - 1; i < polygon.size(); j = i++) {
+        const glm::vec2& a = polygon[i];
+        const glm::vec2& b = polygon[j];
+        if ((a.y > point.y) != (b.y > point.y)
+            && point.x < (b.x - a.x) * (point.y - a.y) / (b.y - a.y) + a.x) {
+            inside = !inside;
+        }
+    }
+    return inside;
+}
+
+bool rectangleOverlapsPolygon(const glm::vec2& rectMin, const glm::vec2& rectMax, const std::vector<glm::vec2>& polygon) {
+    for (size_t i = 0, j = polygon.size() - 1; i < polygon.size(); j = i++) {
+        if (segmentTouchesRectangle(polygon[j], polygon[i], rectMin, rectMax)) {
+            return true;
+        }
+    }
+    // No edge reaches the rectangle, so it is either wholly inside the polygon or outside
+    return insidePolygon(rectMin, polygon);
+}
+
+} // namespace
+
+ScenePicker::ScenePicker()
+    : m_needsRebuild(false) {
+}
+
+ScenePicker::~ScenePicker() {
+}
+
+void ScenePicker::setObject(uint32_t id, const BoundingBox& localBounds, PickGeometrySource source,
+                            const glm::mat4& transform) {
+    auto it = m_objectIndices.find(id);
+    if (it == m_objectIndices.end()) {
+        it = m_objectIndices.emplace(id, m_objects.size()).first;
+        m_objects.emplace_back();
+        m_needsRebuild = true;
+    }
+    Object& object = m_objects[it->second];
+    object.id = id;
+    object.localBounds = localBounds;
+    object.transform = transform;
+    object.inverseTransform = glm::inverse(transform);
+    object.source = std::move(source);
+    object.triangles.reset();
+    markMoved(it->second);
+}
+
+bool ScenePicker::setTransform(uint32_t id, const glm::mat4& transform) {
+    auto it = m_objectIndices.find(id);
+    if (it == m_objectIndices.end()) {
+        return false;
+    }
+    Object& object = m_objects[it->second];
+    object.transform = transform;
+    object.inverseTransform = glm::inverse(transform);
+    markMoved(it->second);
+    return true;
+}
+
+bool ScenePicker::invalidateGeometry(uint32_t id, const BoundingBox& localBounds) {
+    auto it = m_objectIndices.find(id);
+    if (it == m_objectIndices.end()) {
+        return false;
+    }
+    Object& object = m_objects[it->second];
+    object.localBounds = localBounds;
+    object.triangles.reset();
+    markMoved(it->second);
+    return true;
+}
+
+bool ScenePicker::removeObject(uint32_t id) {
+    auto it = m_objectIndices.find(id);
+    if (it == m_objectIndices.end()) {
+        return false;
+    }
+    const size_t index = it->second;
+    m_objectIndices.erase(it);
+    if (index + 1 != m_objects.size()) {
+        m_objects[index] = std::move(m_objects.back());
+        m_objectIndices[m_objects[index].id] = index;
+    }
+    m_objects.pop_back();
+    m_needsRebuild = true;
+    return true;
+}
+
+void ScenePicker::clear() {
+    m_objects.clear();
+    m_objectIndices.clear();
+    m_nodes.clear();
+    m_order.clear();
+    m_dirtyNodes.clear();
+    m_needsRebuild = false;
+}
+
+size_t ScenePicker::getCachedObjectCount() const {
+    return static_cast<size_t>(std::count_if(m_objects.begin(), m_objects.end(),
+                                             [](const Object& object) { return object.triangles != nullptr; }));
+}
+
+Ray ScenePicker::unproject(const glm::mat4& viewProjection, const glm::vec2& ndc) {
+    const glm::mat4 inverse = glm::inverse(viewProjection);
+    const glm::vec4 nearPoint = inverse * glm::vec4(ndc.x, ndc.y, -1.0f, 1.0f);
+    const glm::vec4 farPoint = inverse * glm::vec4(ndc.x, ndc.y, 1.0f, 1.0f);
+    Ray ray;
+    ray.origin = glm::vec3(nearPoint) / nearPoint.w;
+    ray.direction = glm::vec3(farPoint) / farPoint.w - ray.origin;
+    ray.tMax = 1.0f;
+    return ray;
+}
+
+glm::vec2 ScenePicker::cursorToNDC(const glm::vec2& cursor, const glm::ivec2& viewport) {
+    const glm::vec2 size(static_cast<float>(std::max(viewport.x, 1)), static_cast<float>(std::max(viewport.y, 1)));
+    return glm::vec2(2.0f * cursor.x / size.x - 1.0f, 1.0f - 2.0f * cursor.y / size.y);
+}
+
+bool ScenePicker::pick(const Ray& ray, PickHit& hit) {
+    update();
+    if (m_nodes.empty()) {
+        return false;
+    }
+
+    const glm::vec3 inverseDirection(1.0f / ray.direction.x, 1.0f / ray.direction.y, 1.0f / ray.direction.z);
+    float closest = ray.tMax;
+    bool found = false;
+    float rootNear;
+    if (!intersectBox(m_nodes[0].bounds, ray.origin, inverseDirection, closest, rootNear)) {
+        return false;
+    }
+
+    int stack[kStackSize];
+    int stackSize = 0;
+    stack[stackSize++] = 0;
+    while (stackSize > 0) {
+        const Node& node = m_nodes[stack[--stackSize]];
+        if (node.count == 0) {
+            // Push the far child first so the near one is visited first and shrinks the ray
+            float tNear[2];
+            bool hits[2];
+            for (int i = 0; i < 2; ++i) {
+                hits[i] = intersectBox(m_nodes[node.children[i]].bounds, ray.origin, inverseDirection, closest, tNear[i]);
+            }
+            const int first = (hits[0] && hits[1] && tNear[1] < tNear[0]) ? 1 : 0;
+            for (int i : { 1 - first, first }) {
+                if (hits[i] && stackSize < kStackSize) {
+                    stack[stackSize++] = node.children[i];
+                }
+            }
+            continue;
+        }
+
+        for (uint32_t i = node.first; i < node.first + node.count; ++i) {
+            Object& object = m_objects[m_order[i]];
+            float tNear;
+            if (!intersectBox(object.worldBounds, ray.origin, inverseDirection, closest, tNear)) {
+                continue;
+            }
+            // An affine transform keeps the ray parameter, so t compares across objects
+            Ray local;
+            local.origin = glm::vec3(object.inverseTransform * glm::vec4(ray.origin, 1.0f));
+            local.direction = glm::vec3(object.inverseTransform * glm::vec4(ray.direction, 0.0f));
+            local.tMax = closest;
+            RayHit triangleHit;
+            if (getTriangles(object).intersect(local, triangleHit)) {
+                closest = triangleHit.t;
+                found = true;
+                hit.object = object.id;
+                hit.triangle = triangleHit.triangle;
+                hit.barycentrics = glm::vec3(1.0f - triangleHit.u - triangleHit.v, triangleHit.u, triangleHit.v);
+                hit.position = ray.origin + ray.direction * triangleHit.t;
+                hit.t = triangleHit.t;
+            }
+        }
+    }
+    return found;
+}
+
+std::vector<uint32_t> ScenePicker::selectRectangle(const glm::mat4& viewProjection, const glm::vec2& ndcMin,
+                                                   const glm::vec2& ndcMax) {
+    glm::vec4 planes[6];
+    rectanglePlanes(viewProjection, glm::min(ndcMin, ndcMax), glm::max(ndcMin, ndcMax), planes);
+    update();
+    return selectFrustum(planes);
+}
+
+std::vector<uint32_t> ScenePicker::selectLasso(const glm::mat4& viewProjection, const std::vector<glm::vec2>& lasso) {
+    if (lasso.size() < 3) {
+        return {};
+    }
+    glm::vec2 lassoMin = lasso[0];
+    glm::vec2 lassoMax = lasso[0];
+    for (const glm::vec2& point : lasso) {
+        lassoMin = glm::min(lassoMin, point);
+        lassoMax = glm::max(lassoMax, point);
+    }
+    std::vector<uint32_t> selection = selectRectangle(viewProjection, lassoMin, lassoMax);
+
+    auto outsideLasso = [&](uint32_t id) {
+        const BoundingBox& bounds = m_objects[m_objectIndices.at(id)].worldBounds;
+        glm::vec2 screenMin(std::numeric_limits<float>::max());
+        glm::vec2 screenMax(-std::numeric_limits<float>::max());
+        for (int corner = 0; corner < 8; ++corner) {
+            const glm::vec4 clip = viewProjection * glm::vec4(bounds.getCorner(corner), 1.0f);
+            if (clip.w <= 0.0f) {
+                return false;   // Straddles the camera plane; keep what the frustum test found
+            }
+            const glm::vec2 ndc(clip.x / clip.w, clip.y / clip.w);
+            screenMin = glm::min(screenMin, ndc);
+            screenMax = glm::max(screenMax, ndc);
+        }
+        return !rectangleOverlapsPolygon(screenMin, screenMax, lasso);
+    };
+    selection.erase(std::remove_if(selection.begin(), selection.end(), outsideLasso), selection.end());
+    return selection;
+}
+
+void ScenePicker::update() {
+    if (m_needsRebuild) {
+        m_nodes.clear();
+        m_dirtyNodes.clear();
+        m_order.resize(m_objects.size());
+        std::iota(m_order.begin(), m_order.end(), 0u);
+        if (!m_objects.empty()) {
+            m_nodes.reserve(2 * m_objects.size() / kMaxLeafObjects + 1);
+            buildRecursive(0, static_cast<uint32_t>(m_objects.size()), -1);
+        }
+        m_needsRebuild = false;
+        return;
+    }
+
+    // Refit: recompute each moved leaf and the boxes on its path to the root
+    for (int leaf : m_dirtyNodes) {
+        Node& node = m_nodes[leaf];
+        node.bounds = BoundingBox();
+        for (uint32_t i = node.first; i < node.first + node.count; ++i) {
+            node.bounds.expand(m_objects[m_order[i]].worldBounds);
+        }
+        for (int parent = node.parent; parent >= 0; parent = m_nodes[parent].parent) {
+            Node& interior = m_nodes[parent];
+            interior.bounds = m_nodes[interior.children[0]].bounds;
+            interior.bounds.expand(m_nodes[interior.children[1]].bounds);
+        }
+    }
+    m_dirtyNodes.clear();
+}
+
+int ScenePicker::buildRecursive(uint32_t begin, uint32_t end, int parent) {
+    const int index = static_cast<int>(m_nodes.size());
+    m_nodes.emplace_back();
+    m_nodes[index].parent = parent;
+
+    BoundingBox bounds;
+    BoundingBox centroids;
+    for (uint32_t i = begin; i < end; ++i) {
+        const BoundingBox& objectBounds = m_objects[m_order[i]].worldBounds;
+        bounds.expand(objectBounds);
+        if (!objectBounds.isEmpty()) {
+            centroids.expand(objectBounds.getCenter());
+        }
+    }
+    m_nodes[index].bounds = bounds;
+
+    if (end - begin <= kMaxLeafObjects) {
+        m_nodes[index].first = begin;
+        m_nodes[index].count = end - begin;
+        for (uint32_t i = begin; i < end; ++i) {
+            m_objects[m_order[i]].leaf = index;
+        }
+        return index;
+    }
+
+    // Median split along the widest centroid axis keeps the tree balanced for any layout
+    int axis = 0;
+    if (!centroids.isEmpty()) {
+        const glm::vec3 extent = centroids.getExtent();
+        axis = extent.y > extent.x ? 1 : 0;
+        axis = extent.z > extent[axis] ? 2 : axis;
+    }
+    const uint32_t middle = begin + (end - begin) / 2;
+    std::nth_element(m_order.begin() + begin, m_order.begin() + middle, m_order.begin() + end,
+                     [this, axis](uint32_t a, uint32_t b) {
+                         const BoundingBox& boundsA = m_objects[a].worldBounds;
+                         const BoundingBox& boundsB = m_objects[b].worldBounds;
+                         return (boundsA.min[axis] + boundsA.max[axis]) < (boundsB.min[axis] + boundsB.max[axis]);
+                     });
+    const int left = buildRecursive(begin, middle, index);
+    const int right = buildRecursive(middle, end, index);
+    m_nodes[index].children[0] = left;
+    m_nodes[index].children[1] = right;
+    return index;
+}
+
+void ScenePicker::markMoved(size_t object) {
+    Object& target = m_objects[object];
+    target.worldBounds = target.localBounds.transformed(target.transform);
+    if (!m_needsRebuild && target.leaf >= 0) {
+        m_dirtyNodes.push_back(target.leaf);
+    }
+}
+
+const TriangleBVH& ScenePicker::getTriangles(Object& object) {
+    if (!object.triangles) {
+        object.triangles = std::make_unique<TriangleBVH>();
+        if (object.source) {
+            std::vector<glm::vec3> positions;
+            std::vector<unsigned int> indices;
+            object.source(positions, indices);
+            object.triangles->build(positions, indices);
+        }
+    }
+    return *object.triangles;
+}
+
+std::vector<uint32_t> ScenePicker::selectFrustum(const glm::vec4 (&planes)[6]) const {
+    std::vector<uint32_t> selection;
+    if (m_nodes.empty()) {
+        return selection;
+    }
+    int stack[kStackSize];
+    int stackSize = 0;
+    stack[stackSize++] = 0;
+    while (stackSize > 0) {
+        const Node& node = m_nodes[stack[--stackSize]];
+        if (outsideFrustum(node.bounds, planes)) {
+            continue;
+        }
+        if (node.count == 0) {
+            for (int child : node.children) {
+                if (stackSize < kStackSize) {
+                    stack[stackSize++] = child;
+                }
+            }
+            continue;
+        }
+        for (uint32_t i = node.first; i < node.first + node.count; ++i) {
+            const Object& object = m_objects[m_order[i]];
+            if (!outsideFrustum(object.worldBounds, planes)) {
+                selection.push_back(object.id);
+            }
+        }
+    }
+    return selection;
+}
+
+} // namespace ElementalRenderer
@@ -0,0 +1,651 @@
+/**
+ * @file HalfEdgeMesh.cpp
+ * @brief Implementation of the half-edge mesh
+ */
+
+#include "HalfEdgeMesh.h"
+#include "Headless/Parallel.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <iterator>
+
+namespace ElementalRenderer {
+
+namespace {
+
+const int kFaceGrain = 512;             // Faces per parallel chunk
+const int kVertexGrain = 512;           // Vertices per parallel chunk
+const size_t kFullUpdateDivisor = 4;    // Recompute everything once this fraction of the faces is dirty
+
+const glm::vec3 kDefaultNormal(0.0f, 1.0f, 0.0f);
+const glm::vec4 kDefaultTangent(1.0f, 0.0f, 0.0f, 1.0f);
+
+} // namespace
+
+HalfEdgeMesh::HalfEdgeMesh() {
+}
+
+void HalfEdgeMesh::clear() {
+    m_positions.clear();
+    m_normals.clear();
+    m_texCoords.clear();
+    m_tangents.clear();
+    m_vertexHalfEdges.clear();
+    m_faceHalfEdges.clear();
+    m_faceMaterials.clear();
+    m_faceNormals.clear();
+    m_faceTangents.clear();
+    m_faceBitangents.clear();
+    m_halfEdges.clear();
+    m_freeVertices.clear();
+    m_freeFaces.clear();
+    m_freeHalfEdges.clear();
+    m_boundaryEdges.clear();
+    m_dirtyFaces.clear();
+    m_dirtyVertices.clear();
+    m_faceDirty.clear();
+    m_vertexDirty.clear();
+}
+
+void HalfEdgeMesh::reserve(size_t vertexCount, size_t faceCount) {
+    m_positions.reserve(vertexCount);
+    m_normals.reserve(vertexCount);
+    m_texCoords.reserve(vertexCount);
+    m_tangents.reserve(vertexCount);
+    m_vertexHalfEdges.reserve(vertexCount);
+    m_vertexDirty.reserve(vertexCount);
+    m_faceHalfEdges.reserve(faceCount);
+    m_faceMaterials.reserve(faceCount);
+    m_faceNormals.reserve(faceCount);
+    m_faceTangents.reserve(faceCount);
+    m_faceBitangents.reserve(faceCount);
+    m_faceDirty.reserve(faceCount);
+    m_halfEdges.reserve(faceCount * 3);
+}
+
+int32_t HalfEdgeMesh::addVertex(const glm::vec3& position, const glm::vec2& texCoord) {
+    int32_t vertex;
+    if (!m_freeVertices.empty()) {
+        vertex = m_freeVertices.back();
+        m_freeVertices.pop_back();
+        m_positions[vertex] = position;
+        m_normals[vertex] = kDefaultNormal;
+        m_texCoords[vertex] = texCoord;
+        m_tangents[vertex] = kDefaultTangent;
+        m_vertexHalfEdges[vertex] = kInvalid;
+    } else {
+        vertex = static_cast<int32_t>(m_vertexHalfEdges.size());
+        m_positions.push_back(position);
+        m_normals.push_back(kDefaultNormal);
+        m_texCoords.push_back(texCoord);
+        m_tangents.push_back(kDefaultTangent);
+        m_vertexHalfEdges.push_back(kInvalid);
+        m_vertexDirty.push_back(0);
+    }
+    return vertex;
+}
+
+int32_t HalfEdgeMesh::addFace(const std::vector<int32_t>& vertices, int32_t material) {
+    const size_t count = vertices.size();
+    if (count < 3) {
+        std::cerr << "Warning: A face needs at least three vertices" << std::endl;
+        return kInvalid;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        if (!isVertexValid(vertices[i])
+            || std::find(vertices.begin() + i + 1, vertices.end(), vertices[i]) != vertices.end()) {
+            std::cerr << "Warning: Face uses an invalid or repeated vertex" << std::endl;
+            return kInvalid;
+        }
+    }
+    for (size_t i = 0; i < count; ++i) {
+        // A directed edge can only gain a twin, never a second copy
+        const int32_t target = vertices[(i + 1) % count];
+        bool used = m_boundaryEdges.count(edgeKey(vertices[i], target)) != 0;
+        forEachOutgoing(vertices[i], [&](int32_t halfEdge) { used = used || getTarget(halfEdge) == target; });
+        if (used) {
+            std::cerr << "Warning: Face winding disagrees with its neighbours" << std::endl;
+            return kInvalid;
+        }
+    }
+    for (size_t i = 0; i < count; ++i) {
+        if (!keepsVertexManifold(vertices[i], vertices[(i + count - 1) % count], vertices[(i + 1) % count])) {
+            std::cerr << "Warning: Face would make a vertex non-manifold" << std::endl;
+            return kInvalid;
+        }
+    }
+
+    int32_t face;
+    if (!m_freeFaces.empty()) {
+        face = m_freeFaces.back();
+        m_freeFaces.pop_back();
+        m_faceMaterials[face] = material;
+    } else {
+        face = static_cast<int32_t>(m_faceHalfEdges.size());
+        m_faceHalfEdges.push_back(kInvalid);
+        m_faceMaterials.push_back(material);
+        m_faceNormals.emplace_back(0.0f);
+        m_faceTangents.emplace_back(0.0f);
+        m_faceBitangents.emplace_back(0.0f);
+        m_faceDirty.push_back(0);
+    }
+
+    std::vector<int32_t> loop(count);
+    for (size_t i = 0; i < count; ++i) {
+        loop[i] = allocateHalfEdge();
+    }
+    for (size_t i = 0; i < count; ++i) {
+        HalfEdge& halfEdge = m_halfEdges[loop[i]];
+        halfEdge.origin = vertices[i];
+        halfEdge.face = face;
+        halfEdge.next = loop[(i + 1) % count];
+        halfEdge.prev = loop[(i + count - 1) % count];
+        halfEdge.twin = kInvalid;
+
+        const int32_t target = vertices[(i + 1) % count];
+        auto twin = m_boundaryEdges.find(edgeKey(target, vertices[i]));
+        if (twin != m_boundaryEdges.end()) {
+            halfEdge.twin = twin->second;
+            m_halfEdges[twin->second].twin = loop[i];
+            m_boundaryEdges.erase(twin);
+        } else {
+            m_boundaryEdges.emplace(edgeKey(vertices[i], target), loop[i]);
+        }
+        if (m_vertexHalfEdges[vertices[i]] == kInvalid) {
+            m_vertexHalfEdges[vertices[i]] = loop[i];
+        }
+    }
+    m_faceHalfEdges[face] = loop[0];
+    markFaceDirty(face);
+    return face;
+}
+
+bool HalfEdgeMesh::removeFace(int32_t face) {
+    if (!isFaceValid(face)) {
+        return false;
+    }
+
+    // Hand each vertex another outgoing half-edge while the links are intact
+    forEachFaceHalfEdge(face, [this](int32_t halfEdge) {
+        const HalfEdge& edge = m_halfEdges[halfEdge];
+        if (m_vertexHalfEdges[edge.origin] != halfEdge) {
+            return;
+        }
+        int32_t replacement = m_halfEdges[edge.prev].twin;
+        if (replacement < 0 && edge.twin >= 0) {
+            replacement = m_halfEdges[edge.twin].next;
+        }
+        m_vertexHalfEdges[edge.origin] = replacement;
+    });
+
+    std::vector<int32_t> loop;
+    std::vector<int32_t> origins;
+    forEachFaceHalfEdge(face, [&](int32_t halfEdge) {
+        loop.push_back(halfEdge);
+        origins.push_back(m_halfEdges[halfEdge].origin);
+    });
+    for (int32_t halfEdge : loop) {
+        HalfEdge& edge = m_halfEdges[halfEdge];
+        const int32_t target = m_halfEdges[edge.next].origin;
+        if (edge.twin >= 0) {
+            m_halfEdges[edge.twin].twin = kInvalid;
+            m_boundaryEdges[edgeKey(target, edge.origin)] = edge.twin;
+        } else {
+            m_boundaryEdges.erase(edgeKey(edge.origin, target));
+        }
+    }
+    for (int32_t halfEdge : loop) {
+        m_halfEdges[halfEdge] = HalfEdge();
+        m_freeHalfEdges.push_back(halfEdge);
+    }
+
+    // A vertex joining several fans may have lost its only local replacement;
+    // any other fan it touches is open and so has a boundary edge leaving it
+    for (int32_t origin : origins) {
+        if (m_vertexHalfEdges[origin] == kInvalid) {
+            m_vertexHalfEdges[origin] = findBoundaryOutgoing(origin);
+        }
+        markVertexDirty(origin);
+    }
+    m_faceHalfEdges[face] = kInvalid;
+    m_freeFaces.push_back(face);
+    return true;
+}
+
+bool HalfEdgeMesh::removeVertex(int32_t vertex) {
+    if (!isVertexValid(vertex)) {
+        return false;
+    }
+    std::vector<int32_t> faces;
+    while (getVertexHalfEdge(vertex) >= 0) {
+        getVertexFaces(vertex, faces);
+        for (int32_t face : faces) {
+            removeFace(face);
+        }
+    }
+    m_vertexHalfEdges[vertex] = kRemoved;
+    m_freeVertices.push_back(vertex);
+    return true;
+}
+
+bool HalfEdgeMesh::isVertexValid(int32_t vertex) const {
+    return vertex >= 0 && static_cast<size_t>(vertex) < m_vertexHalfEdges.size() && m_vertexHalfEdges[vertex] != kRemoved;
+}
+
+bool HalfEdgeMesh::isFaceValid(int32_t face) const {
+    return face >= 0 && static_cast<size_t>(face) < m_faceHalfEdges.size() && m_faceHalfEdges[face] != kInvalid;
+}
+
+bool HalfEdgeMesh::setPosition(int32_t vertex, const glm::vec3& position) {
+    if (!isVertexValid(vertex)) {
+        return false;
+    }
+    m_positions[vertex] = position;
+    markFanDirty(vertex);
+    return true;
+}
+
+bool HalfEdgeMesh::setNormal(int32_t vertex, const glm::vec3& normal) {
+    if (!isVertexValid(vertex)) {
+        return false;
+    }
+    m_normals[vertex] = normal;
+    return true;
+}
+
+bool HalfEdgeMesh::setTexCoord(int32_t vertex, const glm::vec2& texCoord) {
+    if (!isVertexValid(vertex)) {
+        return false;
+    }
+    m_texCoords[vertex] = texCoord;
+    markFanDirty(vertex);
+    return true;
+}
+
+bool HalfEdgeMesh::setFaceMaterial(int32_t face, int32_t material) {
+    if (!isFaceValid(face)) {
+        return false;
+    }
+    m_faceMaterials[face] = material;
+    return true;
+}
+
+int32_t HalfEdgeMesh::getVertexHalfEdge(int32_t vertex) const {
+    const int32_t halfEdge = m_vertexHalfEdges[vertex];
+    return halfEdge >= 0 ? halfEdge : kInvalid;
+}
+
+void HalfEdgeMesh::getFaceVertices(int32_t face, std::vector<int32_t>& vertices) const {
+    vertices.clear();
+    forEachFaceHalfEdge(face, [&](int32_t halfEdge) { vertices.push_back(m_halfEdges[halfEdge].origin); });
+}
+
+void HalfEdgeMesh::getVertexFaces(int32_t vertex, std::vector<int32_t>& faces) const {
+    faces.clear();
+    forEachOutgoing(vertex, [&](int32_t halfEdge) { faces.push_back(m_halfEdges[halfEdge].face); });
+}
+
+void HalfEdgeMesh::getVertexNeighbors(int32_t vertex, std::vector<int32_t>& neighbors) const {
+    neighbors.clear();
+    size_t outgoingCount = 0;
+    forEachOutgoing(vertex, [&](int32_t halfEdge) {
+        neighbors.insert(neighbors.begin() + outgoingCount++, getTarget(halfEdge));
+        // On a boundary the last neighbour of each fan is only reached by an incoming edge
+        const int32_t incoming = m_halfEdges[halfEdge].prev;
+        if (m_halfEdges[incoming].twin < 0) {
+            neighbors.push_back(m_halfEdges[incoming].origin);
+        }
+    });
+}
+
+void HalfEdgeMesh::getFaceNeighbors(int32_t face, std::vector<int32_t>& neighbors) const {
+    neighbors.clear();
+    forEachFaceHalfEdge(face, [&](int32_t halfEdge) {
+        const int32_t twin = m_halfEdges[halfEdge].twin;
+        if (twin >= 0) {
+            neighbors.push_back(m_halfEdges[twin].face);
+        }
+    });
+}
+
+bool HalfEdgeMesh::isBoundaryVertex(int32_t vertex) const {
+    bool boundary = getVertexHalfEdge(vertex) < 0;
+    forEachOutgoing(vertex, [&](int32_t halfEdge) {
+        boundary = boundary || m_halfEdges[halfEdge].twin < 0;
+    });
+    return boundary;
+}
+
+void HalfEdgeMesh::compact(std::vector<int32_t>* vertexRemap, std::vector<int32_t>* faceRemap) {
+    std::vector<int32_t> vertexIds(m_vertexHalfEdges.size(), kInvalid);
+    int32_t vertexCount = 0;
+    for (size_t i = 0; i < m_vertexHalfEdges.size(); ++i) {
+        if (m_vertexHalfEdges[i] != kRemoved) {
+            vertexIds[i] = vertexCount;
+            m_positions[vertexCount] = m_positions[i];
+            m_normals[vertexCount] = m_normals[i];
+            m_texCoords[vertexCount] = m_texCoords[i];
+            m_tangents[vertexCount] = m_tangents[i];
+            m_vertexHalfEdges[vertexCount] = m_vertexHalfEdges[i];
+            m_vertexDirty[vertexCount] = m_vertexDirty[i];
+            ++vertexCount;
+        }
+    }
+    m_positions.resize(vertexCount);
+    m_normals.resize(vertexCount);
+    m_texCoords.resize(vertexCount);
+    m_tangents.resize(vertexCount);
+    m_vertexHalfEdges.resize(vertexCount);
+    m_vertexDirty.resize(vertexCount);
+
+    std::vector<int32_t> halfEdgeIds(m_halfEdges.size(), kInvalid);
+    int32_t halfEdgeCount = 0;
+    for (size_t i = 0; i < m_halfEdges.size(); ++i) {
+        if (m_halfEdges[i].face != kInvalid) {
+            halfEdgeIds[i] = halfEdgeCount++;
+        }
+    }
+    auto remapHalfEdge = [&halfEdgeIds](int32_t halfEdge) { return halfEdge >= 0 ? halfEdgeIds[halfEdge] : halfEdge; };
+
+    std::vector<int32_t> faceIds(m_faceHalfEdges.size(), kInvalid);
+    int32_t faceCount = 0;
+    for (size_t i = 0; i < m_faceHalfEdges.size(); ++i) {
+        if (m_faceHalfEdges[i] != kInvalid) {
+            faceIds[i] = faceCount;
+            m_faceHalfEdges[faceCount] = remapHalfEdge(m_faceHalfEdges[i]);
+            m_faceMaterials[faceCount] = m_faceMaterials[i];
+            m_faceNormals[faceCount] = m_faceNormals[i];
+            m_faceTangents[faceCount] = m_faceTangents[i];
+            m_faceBitangents[faceCount] = m_faceBitangents[i];
+            m_faceDirty[faceCount] = m_faceDirty[i];
+            ++faceCount;
+        }
+    }
+    m_faceHalfEdges.resize(faceCount);
+    m_faceMaterials.resize(faceCount);
+    m_faceNormals.resize(faceCount);
+    m_faceTangents.resize(faceCount);
+    m_faceBitangents.resize(faceCount);
+    m_faceDirty.resize(faceCount);
+
+    for (size_t i = 0; i < m_halfEdges.size(); ++i) {
+        if (halfEdgeIds[i] == kInvalid) {
+            continue;
+        }
+        HalfEdge edge = m_halfEdges[i];
+        edge.origin = vertexIds[edge.origin];
+        edge.face = faceIds[edge.face];
+        edge.next = halfEdgeIds[edge.next];
+        edge.prev = halfEdgeIds[edge.prev];
+        edge.twin = remapHalfEdge(edge.twin);
+        m_halfEdges[halfEdgeIds[i]] = edge;
+    }
+    m_halfEdges.resize(halfEdgeCount);
+    for (int32_t& halfEdge : m_vertexHalfEdges) {
+        halfEdge = remapHalfEdge(halfEdge);
+    }
+
+    std::map<uint64_t, int32_t> boundaryEdges;
+    for (const auto& entry : m_boundaryEdges) {
+        const int32_t halfEdge = halfEdgeIds[entry.second];
+        boundaryEdges.emplace_hint(boundaryEdges.end(),
+                                   edgeKey(m_halfEdges[halfEdge].origin, getTarget(halfEdge)), halfEdge);
+    }
+    m_boundaryEdges.swap(boundaryEdges);
+    m_freeVertices.clear();
+    m_freeFaces.clear();
+    m_freeHalfEdges.clear();
+
+    // Pending updates follow their elements; those of removed elements are dropped
+    auto remapDirty = [](std::vector<int32_t>& dirty, const std::vector<int32_t>& ids) {
+        size_t kept = 0;
+        for (int32_t element : dirty) {
+            if (ids[element] != kInvalid) {
+                dirty[kept++] = ids[element];
+            }
+        }
+        dirty.resize(kept);
+    };
+    remapDirty(m_dirtyFaces, faceIds);
+    remapDirty(m_dirtyVertices, vertexIds);
+
+    if (vertexRemap) {
+        vertexRemap->swap(vertexIds);
+    }
+    if (faceRemap) {
+        faceRemap->swap(faceIds);
+    }
+}
+
+void HalfEdgeMesh::triangulate(std::vector<glm::vec3>& positions, std::vector<glm::vec3>& normals,
+                               std::vector<glm::vec2>& texCoords, std::vector<unsigned int>& indices,
+                               std::vector<int32_t>* triangleMaterials) const {
+    positions.clear();
+    normals.clear();
+    texCoords.clear();
+    indices.clear();
+    if (triangleMaterials) {
+        triangleMaterials->clear();
+    }
+
+    std::vector<unsigned int> vertexIds(m_vertexHalfEdges.size(), 0);
+    for (size_t i = 0; i < m_vertexHalfEdges.size(); ++i) {
+        if (m_vertexHalfEdges[i] != kRemoved) {
+            vertexIds[i] = static_cast<unsigned int>(positions.size());
+            positions.push_back(m_positions[i]);
+            normals.push_back(m_normals[i]);
+            texCoords.push_back(m_texCoords[i]);
+        }
+    }
+
+    for (size_t face = 0; face < m_faceHalfEdges.size(); ++face) {
+        const int32_t first = m_faceHalfEdges[face];
+        if (first == kInvalid) {
+            continue;
+        }
+        const unsigned int apex = vertexIds[m_halfEdges[first].origin];
+        for (int32_t halfEdge = m_halfEdges[first].next; m_halfEdges[halfEdge].next != first;
+             halfEdge = m_halfEdges[halfEdge].next) {
+            indices.push_back(apex);
+            indices.push_back(vertexIds[m_halfEdges[halfEdge].origin]);
+            indices.push_back(vertexIds[getTarget(halfEdge)]);
+            if (triangleMaterials) {
+                triangleMaterials->push_back(m_faceMaterials[face]);
+            }
+        }
+    }
+}
+
+void HalfEdgeMesh::computeNormals() {
+    // Every write goes to the element being processed, so both passes split freely
+    Parallel::forRange(0, static_cast<int>(m_faceHalfEdges.size()), kFaceGrain, [this](int begin, int end) {
+        for (int face = begin; face < end; ++face) {
+            if (m_faceHalfEdges[face] != kInvalid) {
+                computeFaceFrame(face);
+            }
+        }
+    });
+    Parallel::forRange(0, static_cast<int>(m_vertexHalfEdges.size()), kVertexGrain, [this](int begin, int end) {
+        for (int vertex = begin; vertex < end; ++vertex) {
+            if (m_vertexHalfEdges[vertex] != kRemoved) {
+                computeVertexFrame(vertex);
+            }
+        }
+    });
+    std::fill(m_faceDirty.begin(), m_faceDirty.end(), 0);
+    std::fill(m_vertexDirty.begin(), m_vertexDirty.end(), 0);
+    m_dirtyFaces.clear();
+    m_dirtyVertices.clear();
+}
+
+size_t HalfEdgeMesh::updateNormals() {
+    if (m_dirtyFaces.size() * kFullUpdateDivisor >= getFaceCount() && !m_dirtyFaces.empty()) {
+        computeNormals();
+        return getVertexCount();
+    }
+
+    // Faces removed after being marked are skipped; their vertices were marked on removal
+    Parallel::forRange(0, static_cast<int>(m_dirtyFaces.size()), kFaceGrain, [this](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            if (isFaceValid(m_dirtyFaces[i])) {
+                computeFaceFrame(m_dirtyFaces[i]);
+            }
+        }
+    });
+    for (int32_t face : m_dirtyFaces) {
+        m_faceDirty[face] = 0;
+        if (isFaceValid(face)) {
+            forEachFaceHalfEdge(face, [this](int32_t halfEdge) { markVertexDirty(m_halfEdges[halfEdge].origin); });
+        }
+    }
+    m_dirtyFaces.clear();
+
+    Parallel::forRange(0, static_cast<int>(m_dirtyVertices.size()), kVertexGrain, [this](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            if (isVertexValid(m_dirtyVertices[i])) {
+                computeVertexFrame(m_dirtyVertices[i]);
+            }
+        }
+    });
+    size_t updated = 0;
+    for (int32_t vertex : m_dirtyVertices) {
+        m_vertexDirty[vertex] = 0;
+        updated += isVertexValid(vertex) ? 1 : 0;
+    }
+    m_dirtyVertices.clear();
+    return updated;
+}
+
+glm::vec3 HalfEdgeMesh::computeFaceNormal(int32_t face) const {
+    glm::vec3 normal(0.0f);
+    forEachFaceHalfEdge(face, [&](int32_t halfEdge) {
+        const glm::vec3& current = m_positions[m_halfEdges[halfEdge].origin];
+        const glm::vec3& next = m_positions[getTarget(halfEdge)];
+        normal += glm::vec3((current.y - next.y) * (current.z + next.z),
+                            (current.z - next.z) * (current.x + next.x),
+                            (current.x - next.x) * (current.y + next.y));
+    });
+    const float length = glm::length(normal);
+    return length > 1e-12f ? normal / length : glm::vec3(0.0f);
+}
+
+int32_t HalfEdgeMesh::allocateHalfEdge() {
+    if (!m_freeHalfEdges.empty()) {
+        const int32_t halfEdge = m_freeHalfEdges.back();
+        m_freeHalfEdges.pop_back();
+        return halfEdge;
+    }
+    m_halfEdges.emplace_back();
+    return static_cast<int32_t>(m_halfEdges.size() - 1);
+}
+
+void HalfEdgeMesh::markFaceDirty(int32_t face) {
+    if (!m_faceDirty[face]) {
+        m_faceDirty[face] = 1;
+        m_dirtyFaces.push_back(face);
+    }
+}
+
+void HalfEdgeMesh::markVertexDirty(int32_t vertex) {
+    if (!m_vertexDirty[vertex]) {
+        m_vertexDirty[vertex] = 1;
+        m_dirtyVertices.push_back(vertex);
+    }
+}
+
+void HalfEdgeMesh::markFanDirty(int32_t vertex) {
+    markVertexDirty(vertex);
+    forEachOutgoing(vertex, [this](int32_t halfEdge) { markFaceDirty(m_halfEdges[halfEdge].face); });
+}
+
+void HalfEdgeMesh::computeFaceFrame(int32_t face) {
+    m_faceNormals[face] = computeFaceNormal(face);
+
+    // Sum the fan triangles' texture-space axes; skipping the division by the
+    // UV determinant weights each triangle by its area
+    glm::vec3 tangent(0.0f);
+    glm::vec3 bitangent(0.0f);
+    const int32_t first = m_faceHalfEdges[face];
+    const glm::vec3& p0 = m_positions[m_halfEdges[first].origin];
+    const glm::vec2& uv0 = m_texCoords[m_halfEdges[first].origin];
+    for (int32_t halfEdge = m_halfEdges[first].next; m_halfEdges[halfEdge].next != first;
+         halfEdge = m_halfEdges[halfEdge].next) {
+        const glm::vec3 edge1 = m_positions[m_halfEdges[halfEdge].origin] - p0;
+        const glm::vec3 edge2 = m_positions[getTarget(halfEdge)] - p0;
+        const glm::vec2 duv1 = m_texCoords[m_halfEdges[halfEdge].origin] - uv0;
+        const glm::vec2 duv2 = m_texCoords[getTarget(halfEdge)] - uv0;
+        const float sign = duv1.x * duv2.y - duv2.x * duv1.y < 0.0f ? -1.0f : 1.0f;
+        tangent += (edge1 * duv2.y - edge2 * duv1.y) * sign;
+        bitangent += (edge2 * duv1.x - edge1 * duv2.x) * sign;
+    }
+    m_faceTangents[face] = tangent;
+    m_faceBitangents[face] = bitangent;
+}
+
+void HalfEdgeMesh::computeVertexFrame(int32_t vertex) {
+    glm::vec3 normal(0.0f);
+    glm::vec3 tangent(0.0f);
+    glm::vec3 bitangent(0.0f);
+    forEachOutgoing(vertex, [&](int32_t halfEdge) {
+        const int32_t face = m_halfEdges[halfEdge].face;
+        normal += m_faceNormals[face];
+        tangent += m_faceTangents[face];
+        bitangent += m_faceBitangents[face];
+    });
+
+    const float normalLength = glm::length(normal);
+    normal = normalLength > 1e-4f ? normal / normalLength : kDefaultNormal;
+    m_normals[vertex] = normal;
+
+    // Gram-Schmidt against the normal; without usable UVs pick any perpendicular axis
+    tangent -= normal * glm::dot(normal, tangent);
+    float tangentLength = glm::length(tangent);
+    if (tangentLength <= 1e-8f) {
+        tangent = std::abs(normal.x) < 0.9f ? glm::cross(glm::vec3(1.0f, 0.0f, 0.0f), normal)
+                                            : glm::cross(glm::vec3(0.0f, 1.0f, 0.0f), normal);
+        tangent = glm::cross(normal, tangent);
+        tangentLength = glm::length(tangent);
+    }
+    tangent /= tangentLength;
+    const float handedness = glm::dot(glm::cross(normal, tangent), bitangent) < 0.0f ? -1.0f : 1.0f;
+    m_tangents[vertex] = glm::vec4(tangent, handedness);
+}
+
+bool HalfEdgeMesh::keepsVertexManifold(int32_t vertex, int32_t previous, int32_t next) const {
+    if (getVertexHalfEdge(vertex) < 0) {
+        return true;
+    }
+    // A closed fan has no boundary edge left, so any face added there is a second sheet
+    auto firstBoundary = m_boundaryEdges.lower_bound(edgeKey(vertex, 0));
+    if (firstBoundary == m_boundaryEdges.end() || (firstBoundary->first >> 32) != static_cast<uint32_t>(vertex)) {
+        return false;
+    }
+
+    // Open fans may gather in any order and join once the faces between them
+    // arrive; only closing one fan while others remain leaves it unreachable
+    auto outgoing = m_boundaryEdges.find(edgeKey(vertex, previous));
+    auto incoming = m_boundaryEdges.find(edgeKey(next, vertex));
+    if (outgoing == m_boundaryEdges.end() || incoming == m_boundaryEdges.end()) {
+        return true;
+    }
+    int32_t halfEdge = outgoing->second;
+    while (m_halfEdges[m_halfEdges[halfEdge].prev].twin >= 0) {
+        halfEdge = m_halfEdges[m_halfEdges[halfEdge].prev].twin;
+    }
+    if (m_halfEdges[halfEdge].prev != incoming->second) {
+        return true;
+    }
+    auto secondBoundary = std::next(firstBoundary);
+    return secondBoundary == m_boundaryEdges.end() || (secondBoundary->first >> 32) != static_cast<uint32_t>(vertex);
+}
+
+int32_t HalfEdgeMesh::findBoundaryOutgoing(int32_t vertex) const {
+    auto it = m_boundaryEdges.lower_bound(edgeKey(vertex, 0));
+    if (it != m_boundaryEdges.end() && (it->first >> 32) == static_cast<uint32_t>(vertex)) {
+        return it->second;
+    }
+    return kInvalid;
+}
+
+} // namespace ElementalRenderer
@@ -0,0 +1,401 @@
+/**
+ * @file AmbientOcclusion.cpp
+ * @brief Implementation of the CPU screen-space ambient occlusion
+ */
+
+#include "Headless/AmbientOcclusion.h"
+#include "Headless/Parallel.h"
+#include "Headless/SIMD.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace ElementalRenderer {
+
+using SIMD::Float4;
+
+namespace {
+
+const int kRowGrain = 8;
+const float kTwoPi = 6.28318530718f;
+
+// Largest horizon search radius in working-resolution pixels; keeps close-ups
+// from turning every pixel into a full-screen march
+const float kMaxRadiusPixels = 64.0f;
+
+// Relative depth difference at which blur and upsample weights fall to 1/e
+const float kDepthSigma = 0.05f;
+
+// Exponent applied to the (remapped) normal agreement in the upsample
+const int kNormalPower = 8;
+
+/**
+ * Occlusion input at working resolution. Each texel keeps the nearest full
+ * resolution texel of its block together with that texel's pixel coordinates,
+ * so positions reconstructed through the full-resolution projection stay exact.
+ */
+struct WorkBuffer {
+    int width = 0;
+    int height = 0;
+    int factor = 1;
+    std::vector<glm::vec4> normalDepth;
+    std::vector<glm::vec2> pixel;
+
+    bool isValid(int x, int y) const { return x >= 0 && y >= 0 && x < width && y < height; }
+
+    size_t index(int x, int y) const { return static_cast<size_t>(y) * width + x; }
+};
+
+void buildWorkBuffer(const GBuffer& gbuffer, int factor, WorkBuffer& work) {
+    const int width = gbuffer.getWidth();
+    const int height = gbuffer.getHeight();
+    work.factor = factor;
+    work.width = (width + factor - 1) / factor;
+    work.height = (height + factor - 1) / factor;
+    work.normalDepth.assign(static_cast<size_t>(work.width) * work.height, glm::vec4(0.0f, 0.0f, 1.0f, 0.0f));
+    work.pixel.assign(work.normalDepth.size(), glm::vec2(0.0f));
+
+    const Image& input = gbuffer.getNormalDepth();
+    Parallel::forRange(0, work.height, kRowGrain, [&](int rowBegin, int rowEnd) {
+        for (int wy = rowBegin; wy < rowEnd; ++wy) {
+            for (int wx = 0; wx < work.width; ++wx) {
+                const size_t i = work.index(wx, wy);
+                work.pixel[i] = glm::vec2((static_cast<float>(wx) + 0.5f) * factor,
+                                          (static_cast<float>(wy) + 0.5f) * factor);
+                for (int y = wy * factor; y < std::min((wy + 1) * factor, height); ++y) {
+                    for (int x = wx * factor; x < std::min((wx + 1) * factor, width); ++x) {
+                        const glm::vec4& texel = input.at(x, y);
+                        const float current = work.normalDepth[i].w;
+                        if (texel.w > 0.0f && (current <= 0.0f || texel.w < current)) {
+                            work.normalDepth[i] = texel;
+                            work.pixel[i] = glm::vec2(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f);
+                        }
+                    }
+                }
+            }
+        }
+    });
+}
+
+inline Float4 viewPosition(const GBuffer& gbuffer, const glm::vec2& pixel, float depth) {
+    const glm::vec3 p = gbuffer.getViewPosition(pixel.x, pixel.y, depth);
+    return Float4::set(p.x, p.y, p.z, 0.0f);
+}
+
+inline Float4 normalize3(const Float4& v) {
+    const float length = std::sqrt(SIMD::dot3(v, v).lane(0));
+    return length > 1e-6f ? v * Float4::splat(1.0f / length) : v;
+}
+
+inline Float4 cross3(const Float4& a, const Float4& b) {
+    return Float4::set(a.lane(1) * b.lane(2) - a.lane(2) * b.lane(1),
+                       a.lane(2) * b.lane(0) - a.lane(0) * b.lane(2),
+                       a.lane(0) * b.lane(1) - a.lane(1) * b.lane(0), 0.0f);
+}
+
+inline float smoothstep01(float x) {
+    x = std::min(std::max(x, 0.0f), 1.0f);
+    return x * x * (3.0f - 2.0f * x);
+}
+
+// Mirrors the SSAOShader fragment shader, one working texel at a time
+float hemisphereOcclusion(const GBuffer& gbuffer, const WorkBuffer& work, const AmbientOcclusionSettings& settings,
+                          const std::vector<Float4>& kernel, const glm::vec3& random, size_t texel) {
+    const glm::vec4& center = work.normalDepth[texel];
+    const Float4 position = viewPosition(gbuffer, work.pixel[texel], center.w);
+    const Float4 normal = normalize3(Float4::set(center.x, center.y, center.z, 0.0f));
+
+    // Gram-Schmidt the random vector into a tangent frame around the normal
+    const Float4 randomVec = Float4::set(random.x, random.y, random.z, 0.0f);
+    Float4 tangent = randomVec - normal * SIMD::dot3(randomVec, normal);
+    if (SIMD::dot3(tangent, tangent).lane(0) < 1e-8f) {
+        tangent = std::abs(center.x) < 0.9f ? Float4::set(1.0f, 0.0f, 0.0f, 0.0f) : Float4::set(0.0f, 1.0f, 0.0f, 0.0f);
+        tangent = tangent - normal * SIMD::dot3(tangent, normal);
+    }
+    tangent = normalize3(tangent);
+    const Float4 bitangent = cross3(normal, tangent);
+    const Float4 radius = Float4::splat(settings.radius);
+    const float factor = static_cast<float>(work.factor);
+
+    float occlusion = 0.0f;
+    for (const Float4& k : kernel) {
+        const Float4 offset = tangent * Float4::splat(k.lane(0)) + bitangent * Float4::splat(k.lane(1))
+                            + normal * Float4::splat(k.lane(2));
+        const Float4 samplePos = position + offset * radius;
+        if (samplePos.lane(2) >= 0.0f) {
+            continue; // behind the camera
+        }
+
+        const glm::vec2 projected = gbuffer.projectToPixel(glm::vec3(samplePos.lane(0), samplePos.lane(1), samplePos.lane(2)));
+        const int sx = static_cast<int>(std::floor(projected.x / factor));
+        const int sy = static_cast<int>(std::floor(projected.y / factor));
+        if (!work.isValid(sx, sy)) {
+            continue;
+        }
+        const float sampleDepth = work.normalDepth[work.index(sx, sy)].w;
+        if (sampleDepth <= 0.0f) {
+            continue;
+        }
+
+        const float sampleZ = -sampleDepth;
+        const float rangeCheck = smoothstep01(settings.radius / std::abs(position.lane(2) - sampleZ));
+        occlusion += (sampleZ >= samplePos.lane(2) + settings.bias ? 1.0f : 0.0f) * rangeCheck;
+    }
+    return occlusion / static_cast<float>(kernel.size());
+}
+
+// Horizon-based occlusion: per direction, integrate the rise of the horizon
+// elevation (measured from the tangent plane) with a quadratic distance falloff
+float horizonOcclusion(const GBuffer& gbuffer, const WorkBuffer& work, const AmbientOcclusionSettings& settings,
+                       const glm::vec2* directions, float jitter, int x, int y) {
+    const size_t texel = work.index(x, y);
+    const glm::vec4& center = work.normalDepth[texel];
+    const Float4 position = viewPosition(gbuffer, work.pixel[texel], center.w);
+    const Float4 normal = normalize3(Float4::set(center.x, center.y, center.z, 0.0f));
+
+    const float radiusPixels =
+        std::min(settings.radius * gbuffer.getPixelsPerUnit(center.w) / static_cast<float>(work.factor), kMaxRadiusPixels);
+    if (radiusPixels < 1.0f) {
+        return 0.0f;
+    }
+    const int stepCount = std::max(settings.stepCount, 1);
+    const float stepPixels = (radiusPixels - 1.0f) / static_cast<float>(stepCount);
+    const float inverseRadiusSquared = 1.0f / (settings.radius * settings.radius);
+
+    float occlusion = 0.0f;
+    for (int d = 0; d < settings.directionCount; ++d) {
+        float maxSine = settings.bias;
+        for (int s = 0; s < stepCount; ++s) {
+            const float t = 1.0f + (static_cast<float>(s) + jitter) * stepPixels;
+            const int sx = static_cast<int>(std::floor(static_cast<float>(x) + 0.5f + directions[d].x * t));
+            const int sy = static_cast<int>(std::floor(static_cast<float>(y) + 0.5f + directions[d].y * t));
+            if (!work.isValid(sx, sy)) {
+                break;
+            }
+            const size_t sample = work.index(sx, sy);
+            const float sampleDepth = work.normalDepth[sample].w;
+            if (sampleDepth <= 0.0f) {
+                continue;
+            }
+
+            const Float4 v = viewPosition(gbuffer, work.pixel[sample], sampleDepth) - position;
+            const float lengthSquared = SIMD::dot3(v, v).lane(0);
+            const float falloff = 1.0f - lengthSquared * inverseRadiusSquared;
+            if (falloff <= 0.0f || lengthSquared < 1e-12f) {
+                continue;
+            }
+            const float sine = SIMD::dot3(normal, v).lane(0) / std::sqrt(lengthSquared);
+            if (sine > maxSine) {
+                occlusion += (sine - maxSine) * falloff;
+                maxSine = sine;
+            }
+        }
+    }
+    return occlusion / static_cast<float>(std::max(settings.directionCount, 1));
+}
+
+inline float depthWeight(float depth, float other) {
+    return std::exp(-std::abs(depth - other) / (kDepthSigma * depth));
+}
+
+// Depth-aware version of the SSAOShader blur: same 4x4 footprint, which spans
+// exactly one tile of the rotation noise, but neighbours across depth
+// discontinuities are left out
+void blurOcclusion(const WorkBuffer& work, std::vector<float>& visibility) {
+    std::vector<float> source = visibility;
+    Parallel::forRange(0, work.height, kRowGrain, [&](int rowBegin, int rowEnd) {
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            for (int x = 0; x < work.width; ++x) {
+                const float depth = work.normalDepth[work.index(x, y)].w;
+                if (depth <= 0.0f) {
+                    continue;
+                }
+                float sum = 0.0f;
+                float weightSum = 0.0f;
+                for (int dy = -2; dy < 2; ++dy) {
+                    for (int dx = -2; dx < 2; ++dx) {
+                        if (!work.isValid(x + dx, y + dy)) {
+                            continue;
+                        }
+                        const size_t i = work.index(x + dx, y + dy);
+                        const float other = work.normalDepth[i].w;
+                        if (other <= 0.0f) {
+                            continue;
+                        }
+                        const float w = depthWeight(depth, other);
+                        sum += source[i] * w;
+                        weightSum += w;
+                    }
+                }
+                visibility[work.index(x, y)] = sum / weightSum;
+            }
+        }
+    });
+}
+
+// Joint bilateral upsample: bilinear weights of the four nearest working
+// texels, scaled by depth and normal agreement with the full-resolution pixel
+void upsampleOcclusion(const GBuffer& gbuffer, const WorkBuffer& work, const std::vector<float>& low,
+                       std::vector<float>& visibility) {
+    const int width = gbuffer.getWidth();
+    const Image& input = gbuffer.getNormalDepth();
+    const float inverseFactor = 1.0f / static_cast<float>(work.factor);
+
+    Parallel::forRange(0, gbuffer.getHeight(), kRowGrain, [&](int rowBegin, int rowEnd) {
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            const glm::vec4* row = input.getRow(y);
+            float* out = &visibility[static_cast<size_t>(y) * width];
+            const float v = (static_cast<float>(y) + 0.5f) * inverseFactor - 0.5f;
+            const int y0 = static_cast<int>(std::floor(v));
+            const float fy = v - static_cast<float>(y0);
+
+            for (int x = 0; x < width; ++x) {
+                if (row[x].w <= 0.0f) {
+                    out[x] = 1.0f;
+                    continue;
+                }
+                const Float4 normal = Float4::load(row[x]);
+                const float u = (static_cast<float>(x) + 0.5f) * inverseFactor - 0.5f;
+                const int x0 = static_cast<int>(std::floor(u));
+                const float fx = u - static_cast<float>(x0);
+
+                float sum = 0.0f;
+                float weightSum = 0.0f;
+                float closest = 1.0f;
+                float closestDifference = -1.0f;
+                for (int j = 0; j < 4; ++j) {
+                    const int tx = std::min(std::max(x0 + (j & 1), 0), work.width - 1);
+                    const int ty = std::min(std::max(y0 + (j >> 1), 0), work.height - 1);
+                    const size_t i = work.index(tx, ty);
+                    const glm::vec4& tap = work.normalDepth[i];
+                    if (tap.w <= 0.0f) {
+                        continue;
+                    }
+                    const float difference = std::abs(tap.w - row[x].w);
+                    if (closestDifference < 0.0f || difference < closestDifference) {
+                        closestDifference = difference;
+                        closest = low[i];
+                    }
+
+                    const float bilinear = ((j & 1) ? fx : 1.0f - fx) * ((j >> 1) ? fy : 1.0f - fy);
+                    const float agreement = 0.5f + 0.5f * SIMD::dot3(normal, Float4::load(tap)).lane(0);
+                    const float w = (bilinear + 1e-3f) * depthWeight(row[x].w, tap.w)
+                                  * std::pow(std::max(agreement, 0.0f), static_cast<float>(kNormalPower));
+                    sum += low[i] * w;
+                    weightSum += w;
+                }
+                // Nothing on the same surface nearby: take the closest depth match
+                out[x] = weightSum > 1e-4f ? sum / weightSum : closest;
+            }
+        }
+    });
+}
+
+} // namespace
+
+std::vector<glm::vec3> AmbientOcclusion::generateSampleKernel(int kernelSize) {
+    std::vector<glm::vec3> kernel(std::max(kernelSize, 0));
+    std::uniform_real_distribution<float> randomFloats(0.0, 1.0);
+    std::default_random_engine generator;
+
+    for (int i = 0; i < kernelSize; ++i) {
+        // Sample in tangent space, on the positive-z hemisphere
+        glm::vec3 sample(randomFloats(generator) * 2.0f - 1.0f,
+                         randomFloats(generator) * 2.0f - 1.0f,
+                         randomFloats(generator));
+        sample = glm::normalize(sample);
+        sample *= randomFloats(generator);
+
+        // Scale samples so they are more focused near the origin
+        float scale = static_cast<float>(i) / static_cast<float>(kernelSize);
+        scale = 0.1f + 0.9f * scale * scale;
+        kernel[i] = sample * scale;
+    }
+    return kernel;
+}
+
+std::vector<glm::vec3> AmbientOcclusion::generateNoise(int size) {
+    std::vector<glm::vec3> noise;
+    std::uniform_real_distribution<float> randomFloats(0.0, 1.0);
+    std::default_random_engine generator;
+
+    for (int i = 0; i < size * size; ++i) {
+        // Rotation around the tangent-space z axis
+        noise.push_back(glm::vec3(randomFloats(generator) * 2.0f - 1.0f,
+                                  randomFloats(generator) * 2.0f - 1.0f,
+                                  0.0f));
+    }
+    return noise;
+}
+
+void AmbientOcclusion::compute(const GBuffer& gbuffer, const AmbientOcclusionSettings& settings,
+                               std::vector<float>& visibility) {
+    const int width = gbuffer.getWidth();
+    const int height = gbuffer.getHeight();
+    visibility.assign(static_cast<size_t>(width) * height, 1.0f);
+    if (gbuffer.isEmpty() || settings.radius <= 0.0f) {
+        return;
+    }
+
+    WorkBuffer work;
+    buildWorkBuffer(gbuffer, std::max(settings.downsample, 1), work);
+
+    const std::vector<glm::vec3> noise = generateNoise(kNoiseSize);
+    std::vector<Float4> kernel;
+    for (const glm::vec3& k : generateSampleKernel(std::min(std::max(settings.kernelSize, 1), kMaxKernelSize))) {
+        kernel.push_back(Float4::set(k.x, k.y, k.z, 0.0f));
+    }
+
+    // Horizon directions rotated once per noise texel
+    const int directionCount = std::max(settings.directionCount, 1);
+    std::vector<glm::vec2> directions(noise.size() * directionCount);
+    std::vector<float> jitter(noise.size());
+    for (size_t n = 0; n < noise.size(); ++n) {
+        const float rotation = std::atan2(noise[n].y, noise[n].x);
+        for (int d = 0; d < directionCount; ++d) {
+            const float angle = rotation + kTwoPi * static_cast<float>(d) / static_cast<float>(directionCount);
+            directions[n * directionCount + d] = glm::vec2(std::cos(angle), std::sin(angle));
+        }
+        jitter[n] = noise[n].x * 0.5f + 0.5f;
+    }
+
+    std::vector<float> low(work.normalDepth.size(), 1.0f);
+    const int tileSize = std::max(settings.tileSize, 1);
+    const int tilesX = (work.width + tileSize - 1) / tileSize;
+    const int tilesY = (work.height + tileSize - 1) / tileSize;
+
+    Parallel::forEach(0, tilesX * tilesY, [&](int tile) {
+        const int x0 = (tile % tilesX) * tileSize;
+        const int y0 = (tile / tilesX) * tileSize;
+        for (int y = y0; y < std::min(y0 + tileSize, work.height); ++y) {
+            for (int x = x0; x < std::min(x0 + tileSize, work.width); ++x) {
+                const size_t texel = work.index(x, y);
+                if (work.normalDepth[texel].w <= 0.0f) {
+                    continue;
+                }
+                const size_t n = static_cast<size_t>((y % kNoiseSize) * kNoiseSize + x % kNoiseSize);
+                float occlusion;
+                if (settings.mode == AmbientOcclusionMode::HEMISPHERE) {
+                    occlusion = hemisphereOcclusion(gbuffer, work, settings, kernel, noise[n], texel);
+                } else {
+                    occlusion = horizonOcclusion(gbuffer, work, settings, &directions[n * directionCount], jitter[n], x, y);
+                }
+                low[texel] = std::min(std::max(1.0f - occlusion * settings.intensity, 0.0f), 1.0f);
+            }
+        }
+    });
+
+    if (settings.blur) {
+        blurOcclusion(work, low);
+    }
+
+    if (work.factor == 1) {
+        for (size_t i = 0; i < low.size(); ++i) {
+            visibility[i] = low[i];
+        }
+        return;
+    }
+    upsampleOcclusion(gbuffer, work, low, visibility);
+}
+
+} // namespace ElementalRenderer
@@ -0,0 +1,268 @@
+/**
+ * @file BRDF.cpp
+ * @brief Implementation of the batched CPU lighting models
+ */
+
+#include "Headless/BRDF.h"
+#include "Headless/SIMD.h"
+#include <algorithm>
+
+namespace ElementalRenderer {
+
+using SIMD::Float4;
+
+namespace {
+
+const float kPi = 3.14159265359f; // Same constant as the shaders
+
+/**
+ * Four 3D vectors, one per lane
+ */
+struct Vec3x4 {
+    Float4 x;
+    Float4 y;
+    Float4 z;
+};
+
+inline Float4 dot(const Vec3x4& a, const Vec3x4& b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+inline Vec3x4 normalize(const Vec3x4& a) {
+    const Float4 inverseLength = Float4::splat(1.0f) / SIMD::sqrt(SIMD::max(dot(a, a), Float4::splat(1e-20f)));
+    return {a.x * inverseLength, a.y * inverseLength, a.z * inverseLength};
+}
+
+inline Float4 pow5(Float4 a) {
+    const Float4 a2 = a * a;
+    return a2 * a2 * a;
+}
+
+// a / b where b > 0, else 0 (the shaders would produce NaN or infinity)
+inline Float4 safeDivide(Float4 a, Float4 b) {
+    const Float4 zero = Float4::splat(0.0f);
+    const Float4 positive = SIMD::greaterThan(b, zero);
+    return SIMD::select(positive, a / SIMD::select(positive, b, Float4::splat(1.0f)), zero);
+}
+
+Vec3x4 load(const glm::vec3* v, size_t begin, size_t count) {
+    float x[4], y[4], z[4];
+    for (size_t lane = 0; lane < 4; ++lane) {
+        // Pad a partial batch with its last sample
+        const glm::vec3& value = v[begin + std::min(lane, count - 1)];
+        x[lane] = value.x;
+        y[lane] = value.y;
+        z[lane] = value.z;
+    }
+    return {Float4::load(x), Float4::load(y), Float4::load(z)};
+}
+
+void store(const Vec3x4& value, glm::vec3* out, size_t begin, size_t count) {
+    float x[4], y[4], z[4];
+    value.x.store(x);
+    value.y.store(y);
+    value.z.store(z);
+    for (size_t lane = 0; lane < count; ++lane) {
+        out[begin + lane] = glm::vec3(x[lane], y[lane], z[lane]);
+    }
+}
+
+Vec3x4 scaleAlbedo(const BRDFMaterial& material, Float4 factor) {
+    return {Float4::splat(material.albedo.x) * factor, Float4::splat(material.albedo.y) * factor,
+            Float4::splat(material.albedo.z) * factor};
+}
+
+// Zero the lanes whose light is behind the surface (the shaders' early exit)
+Vec3x4 maskBackFacing(const Vec3x4& value, Float4 nDotL) {
+    const Float4 unlit = SIMD::lessThan(nDotL, Float4::splat(0.001f));
+    const Float4 zero = Float4::splat(0.0f);
+    return {SIMD::select(unlit, zero, value.x), SIMD::select(unlit, zero, value.y), SIMD::select(unlit, zero, value.z)};
+}
+
+// calculatePhong / calculateBlinnPhong
+Vec3x4 shadePhong(const BRDFMaterial& material, const Vec3x4& n, const Vec3x4& l, const Vec3x4& v, bool blinn) {
+    const Float4 zero = Float4::splat(0.0f);
+    const Float4 rawNdotL = dot(n, l);
+    const Float4 nDotL = SIMD::max(rawNdotL, zero);
+
+    Float4 cosine;
+    if (blinn) {
+        const Vec3x4 h = normalize({l.x + v.x, l.y + v.y, l.z + v.z});
+        cosine = SIMD::max(dot(n, h), zero);
+    } else {
+        // reflect(-L, N) = 2 (N.L) N - L
+        const Float4 twoNdotL = rawNdotL + rawNdotL;
+        const Vec3x4 r = {twoNdotL * n.x - l.x, twoNdotL * n.y - l.y, twoNdotL * n.z - l.z};
+        cosine = SIMD::max(dot(v, r), zero);
+    }
+    const Float4 specular = Float4::splat(0.3f) * SIMD::pow(cosine, Float4::splat(material.specularPower));
+
+    const Vec3x4 diffuse = scaleAlbedo(material, nDotL);
+    return maskBackFacing({diffuse.x + specular, diffuse.y + specular, diffuse.z + specular}, nDotL);
+}
+
+// calculateOrenNayar, with sin(acos) and tan(acos) rewritten algebraically
+Vec3x4 shadeOrenNayar(const BRDFMaterial& material, const Vec3x4& n, const Vec3x4& l, const Vec3x4& v) {
+    const Float4 zero = Float4::splat(0.0f);
+    const Float4 one = Float4::splat(1.0f);
+    const Float4 nDotL = SIMD::max(dot(n, l), zero);
+    const Float4 nDotV = SIMD::max(dot(n, v), zero);
+    const Float4 angleVL = SIMD::max(dot(v, l), zero);
+
+    const float sigma2 = material.roughness * material.roughness;
+    const Float4 a = Float4::splat(1.0f - 0.5f * sigma2 / (sigma2 + 0.33f));
+    const Float4 b = Float4::splat(0.45f * sigma2 / (sigma2 + 0.09f));
+
+    // alpha = max(thetaI, thetaR) has the smaller cosine, beta the larger
+    const Float4 cosAlpha = SIMD::min(nDotL, nDotV);
+    const Float4 cosBeta = SIMD::max(nDotL, nDotV);
+    const Float4 sinAlpha = SIMD::sqrt(SIMD::max(one - cosAlpha * cosAlpha, zero));
+    const Float4 tanBeta = safeDivide(SIMD::sqrt(SIMD::max(one - cosBeta * cosBeta, zero)), cosBeta);
+    const Float4 c = sinAlpha * tanBeta;
+
+    const Float4 diffuse = nDotL * (a + b * angleVL * c);
+    return maskBackFacing(scaleAlbedo(material, diffuse), nDotL);
+}
+
+// calculateCookTorrance (calculateGGX forces the GGX distribution)
+Vec3x4 shadeCookTorrance(const BRDFMaterial& material, MicrofacetDistribution distribution,
+                         const Vec3x4& n, const Vec3x4& l, const Vec3x4& v) {
+    const Float4 zero = Float4::splat(0.0f);
+    const Float4 one = Float4::splat(1.0f);
+    const Float4 pi = Float4::splat(kPi);
+
+    const Vec3x4 h = normalize({l.x + v.x, l.y + v.y, l.z + v.z});
+    const Float4 nDotL = SIMD::max(dot(n, l), zero);
+    const Float4 nDotV = SIMD::max(dot(n, v), zero);
+    const Float4 nDotH = SIMD::max(dot(n, h), zero);
+    const Float4 vDotH = SIMD::max(dot(v, h), zero);
+
+    const float alphaScalar = material.roughness * material.roughness;
+    const Float4 alpha = Float4::splat(alphaScalar);
+    const Float4 alpha2 = alpha * alpha;
+    const Float4 nDotH2 = nDotH * nDotH;
+
+    Float4 d;
+    if (distribution == MicrofacetDistribution::BECKMANN) {
+        const Float4 safeNdotH2 = SIMD::max(nDotH2, Float4::splat(1e-12f));
+        const Float4 exponent = (safeNdotH2 - one) / (alpha2 * safeNdotH2);
+        d = SIMD::exp(exponent) / (pi * alpha2 * safeNdotH2 * safeNdotH2);
+    } else if (distribution == MicrofacetDistribution::GGX) {
+        const Float4 denom = nDotH2 * (alpha2 - one) + one;
+        d = alpha2 / (pi * denom * denom);
+    } else {
+        const float normalization = (2.0f + 2.0f / alphaScalar) / (2.0f * kPi);
+        const float power = 2.0f / (alphaScalar * alphaScalar) - 2.0f;
+        d = Float4::splat(normalization) * SIMD::pow(nDotH, Float4::splat(power));
+    }
+
+    const Float4 two = Float4::splat(2.0f);
+    const Float4 g1v = safeDivide(two * nDotV, nDotV + SIMD::sqrt(alpha + (one - alpha) * nDotV * nDotV));
+    const Float4 g1l = safeDivide(two * nDotL, nDotL + SIMD::sqrt(alpha + (one - alpha) * nDotL * nDotL));
+    const Float4 g = g1v * g1l;
+
+    const Float4 f0 = Float4::splat(material.fresnel);
+    const Float4 f = f0 + (one - f0) * pow5(one - vDotH);
+    const Float4 specular = safeDivide(d * g * f, Float4::splat(4.0f) * nDotV * nDotL);
+    const Float4 diffuse = (one - f) * Float4::splat(1.0f - material.metallic) * nDotL / pi;
+
+    return maskBackFacing(scaleAlbedo(material, diffuse + specular * nDotL), nDotL);
+}
+
+// calculatePBR: colored F0, Schlick-GGX geometry and no back-facing early exit
+Vec3x4 shadePhysicallyBased(const BRDFMaterial& material, const Vec3x4& n, const Vec3x4& l, const Vec3x4& v) {
+    const Float4 one = Float4::splat(1.0f);
+    const Float4 pi = Float4::splat(kPi);
+    const Float4 minimum = Float4::splat(0.001f);
+
+    const Vec3x4 h = normalize({v.x + l.x, v.y + l.y, v.z + l.z});
+    const Float4 nDotL = SIMD::max(dot(n, l), minimum);
+    const Float4 nDotV = SIMD::max(dot(n, v), minimum);
+    const Float4 nDotH = SIMD::max(dot(n, h), Float4::splat(0.0f));
+    const Float4 hDotV = SIMD::max(dot(h, v), Float4::splat(0.0f));
+
+    const float alphaScalar = material.roughness * material.roughness;
+    const Float4 alpha2 = Float4::splat(alphaScalar * alphaScalar);
+    const Float4 denom = nDotH * nDotH * (alpha2 - one) + one;
+    const Float4 d = alpha2 / (pi * denom * denom);
+
+    const float kScalar = (material.roughness + 1.0f) * (material.roughness + 1.0f) / 8.0f;
+    const Float4 k = Float4::splat(kScalar);
+    const Float4 g = (nDotV / (nDotV * (one - k) + k)) * (nDotL / (nDotL * (one - k) + k));
+
+    const Float4 schlick = pow5(one - hDotV);
+    const Float4 common = d * g / (Float4::splat(4.0f) * nDotV * nDotL);
+    const Float4 diffuseScale = Float4::splat((1.0f - material.metallic) / kPi);
+    const Float4 scale = nDotL * Float4::splat(material.ao);
+
+    Float4 channels[3];
+    for (int c = 0; c < 3; ++c) {
+        const float albedo = material.albedo[c];
+        const Float4 f0 = Float4::splat(0.04f + (albedo - 0.04f) * material.metallic);
+        const Float4 f = f0 + (one - f0) * schlick;
+        const Float4 diffuse = (one - f) * diffuseScale * Float4::splat(albedo);
+        channels[c] = (diffuse + f * common) * scale;
+    }
+    return {channels[0], channels[1], channels[2]};
+}
+
+// Default calculateCustomBRDF: Lambertian
+Vec3x4 shadeLambert(const BRDFMaterial& material, const Vec3x4& n, const Vec3x4& l) {
+    const Float4 nDotL = SIMD::max(dot(n, l), Float4::splat(0.0f));
+    return scaleAlbedo(material, nDotL / Float4::splat(kPi));
+}
+
+} // namespace
+
+void BRDF::evaluate(BRDFModel model, const BRDFMaterial& material, const glm::vec3* normals,
+                    const glm::vec3* lightDirs, const glm::vec3* viewDirs, size_t count, glm::vec3* result) {
+    if (model == BRDFModel::CUSTOM && material.custom) {
+        for (size_t i = 0; i < count; ++i) {
+            result[i] = material.custom(normals[i], lightDirs[i], viewDirs[i], material.albedo, material.customParams);
+        }
+        return;
+    }
+
+    for (size_t begin = 0; begin < count; begin += 4) {
+        const size_t lanes = std::min<size_t>(4, count - begin);
+        const Vec3x4 n = load(normals, begin, lanes);
+        const Vec3x4 l = load(lightDirs, begin, lanes);
+        const Vec3x4 v = load(viewDirs, begin, lanes);
+
+        Vec3x4 shaded;
+        switch (model) {
+            case BRDFModel::PHONG:
+                shaded = shadePhong(material, n, l, v, false);
+                break;
+            case BRDFModel::BLINN_PHONG:
+                shaded = shadePhong(material, n, l, v, true);
+                break;
+            case BRDFModel::OREN_NAYAR:
+                shaded = shadeOrenNayar(material, n, l, v);
+                break;
+            case BRDFModel::COOK_TORRANCE:
+                shaded = shadeCookTorrance(material, material.distribution, n, l, v);
+                break;
+            case BRDFModel::GGX:
+                shaded = shadeCookTorrance(material, MicrofacetDistribution::GGX, n, l, v);
+                break;
+            case BRDFModel::PHYSICALLY_BASED:
+                shaded = shadePhysicallyBased(material, n, l, v);
+                break;
+            case BRDFModel::CUSTOM:
+            default:
+                shaded = shadeLambert(material, n, l);
+                break;
+        }
+        store(shaded, result, begin, lanes);
+    }
+}
+
+glm::vec3 BRDF::evaluate(BRDFModel model, const BRDFMaterial& material, const glm::vec3& normal,
+                         const glm::vec3& lightDir, const glm::vec3& viewDir) {
+    glm::vec3 result;
+    evaluate(model, material, &normal, &lightDir, &viewDir, 1, &result);
+    return result;
+}
+
+} // namespace ElementalRenderer
@@ -0,0 +1,316 @@
+/**
+ * @file CPUPostProcessor.cpp
+ * @brief Implementation of the CPU post-processing kernels
+ */
+
+#include "Headless/CPUPostProcessor.h"
+#include "Headless/Parallel.h"
+#include "Headless/PixelKernels.h"
+#include "Headless/SIMD.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ElementalRenderer {
+
+using SIMD::Float4;
+using PixelKernels::LinearTap;
+using PixelKernels::boxLine;
+using PixelKernels::clampIndex;
+using PixelKernels::sampleLine;
+
+namespace {
+
+// Rows per parallel chunk; small images still run on one thread
+const int kRowGrain = 8;
+
+// Columns per vertical sliding-window block
+const int kColumnBlock = 64;
+
+// Box widths whose three-pass convolution approximates a Gaussian of sigma
+void boxesForGaussian(float sigma, int radii[3]) {
+    const int passes = 3;
+    float idealWidth = std::sqrt(12.0f * sigma * sigma / passes + 1.0f);
+    int lower = static_cast<int>(std::floor(idealWidth));
+    if (lower % 2 == 0) {
+        --lower;
+    }
+    int upper = lower + 2;
+
+    float idealLower = (12.0f * sigma * sigma - passes * lower * lower - 4.0f * passes * lower - 3.0f * passes)
+                       / (-4.0f * lower - 4.0f);
+    int lowerCount = static_cast<int>(std::round(idealLower));
+
+    for (int i = 0; i < passes; ++i) {
+        int width = i < lowerCount ? lower : upper;
+        radii[i] = std::max(0, (width - 1) / 2);
+    }
+}
+
+void boxBlurHorizontal(const Image& source, Image& destination, int radius) {
+    const int width = source.getWidth();
+    Parallel::forRange(0, source.getHeight(), kRowGrain, [&](int rowBegin, int rowEnd) {
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            boxLine(source.getRow(y), destination.getRow(y), 1, width, radius);
+        }
+    });
+}
+
+// Vertical pass walks rows inside column blocks so memory stays contiguous
+void boxBlurVertical(const Image& source, Image& destination, int radius) {
+    const int width = source.getWidth();
+    const int height = source.getHeight();
+    const int blocks = (width + kColumnBlock - 1) / kColumnBlock;
+    const Float4 scale = Float4::splat(1.0f / static_cast<float>(2 * radius + 1));
+
+    Parallel::forEach(0, blocks, [&](int block) {
+        const int x0 = block * kColumnBlock;
+        const int x1 = std::min(width, x0 + kColumnBlock);
+        std::vector<Float4> sums(static_cast<size_t>(x1 - x0), Float4::splat(0.0f));
+
+        for (int k = -radius; k <= radius; ++k) {
+            const glm::vec4* row = source.getRow(clampIndex(k, height));
+            for (int x = x0; x < x1; ++x) {
+                sums[x - x0] = sums[x - x0] + Float4::load(row[x]);
+            }
+        }
+
+        for (int y = 0; y < height; ++y) {
+            const glm::vec4* entering = source.getRow(clampIndex(y + radius + 1, height));
+            const glm::vec4* leaving = source.getRow(clampIndex(y - radius, height));
+            glm::vec4* out = destination.getRow(y);
+            for (int x = x0; x < x1; ++x) {
+                Float4& sum = sums[x - x0];
+                (sum * scale).store(out[x]);
+                sum = sum + Float4::load(entering[x]) - Float4::load(leaving[x]);
+            }
+        }
+    });
+}
+
+} // namespace
+
+CPUPostProcessor::CPUPostProcessor()
+    : m_currentEffect(PostProcessEffect::NONE),
+      m_effectStrength(0.5f),
+      m_time(0.0f) {
+}
+
+void CPUPostProcessor::setEffect(PostProcessEffect effect) {
+    m_currentEffect = effect;
+}
+
+void CPUPostProcessor::setEffectStrength(float strength) {
+    m_effectStrength = strength;
+}
+
+void CPUPostProcessor::setTime(float time) {
+    // None of the standard effects animate yet; kept for parity with PostProcessShader
+    m_time = time;
+}
+
+PostProcessEffect CPUPostProcessor::getEffect() const {
+    return m_currentEffect;
+}
+
+float CPUPostProcessor::getEffectStrength() const {
+    return m_effectStrength;
+}
+
+void CPUPostProcessor::apply(const Image& source, Image& destination) const {
+    applyEffect(m_currentEffect, m_effectStrength, source, destination);
+}
+
+void CPUPostProcessor::apply(const unsigned char* source, int width, int height,
+                             std::vector<unsigned char>& destination) const {
+    Image image = Image::fromRGBA8(source, width, height);
+    applyEffect(m_currentEffect, m_effectStrength, image, image);
+    image.toRGBA8(destination);
+}
+
+void CPUPostProcessor::applyEffect(PostProcessEffect effect, float strength, const Image& source, Image& destination) {
+    // Kernels read neighbours, so an aliased destination needs a private copy of the input
+    if (&source == &destination) {
+        Image copy = source;
+        applyEffect(effect, strength, copy, destination);
+        return;
+    }
+
+    switch (effect) {
+        case PostProcessEffect::BLUR:
+            blur(source, destination, strength);
+            break;
+        case PostProcessEffect::GRAYSCALE:
+            grayscale(source, destination, strength);
+            break;
+        case PostProcessEffect::VIGNETTE:
+            vignette(source, destination, strength);
+            break;
+        case PostProcessEffect::CHROMATIC_ABERRATION:
+            chromaticAberration(source, destination, strength);
+            break;
+        case PostProcessEffect::NONE:
+        case PostProcessEffect::CUSTOM:
+        default:
+            destination = source;
+            break;
+    }
+}
+
+void CPUPostProcessor::applyChain(const std::vector<PostProcessStep>& steps, Image& image) {
+    Image scratch;
+    for (const auto& step : steps) {
+        if (step.effect == PostProcessEffect::NONE || step.effect == PostProcessEffect::CUSTOM) {
+            continue;
+        }
+        applyEffect(step.effect, step.strength, image, scratch);
+        std::swap(image, scratch);
+    }
+}
+
+void CPUPostProcessor::blur(const Image& source, Image& destination, float strength) {
+    const int width = source.getWidth();
+    const int height = source.getHeight();
+    // Written to a temporary so source and destination may be the same image
+    Image result(width, height);
+    if (source.isEmpty()) {
+        destination = std::move(result);
+        return;
+    }
+
+    // The shader samples at +-strength/300 in UV with a 1-2-1 kernel per axis.
+    // Bilinear filtering is separable, so two 1D passes give the same result.
+    const float shiftX = strength * static_cast<float>(width) / 300.0f;
+    const float shiftY = strength * static_cast<float>(height) / 300.0f;
+    const LinearTap leftTap(-shiftX), rightTap(shiftX);
+    const LinearTap downTap(-shiftY), upTap(shiftY);
+    const Float4 quarter = Float4::splat(0.25f);
+    const Float4 half = Float4::splat(0.5f);
+
+    Image horizontal(width, height);
+    Parallel::forRange(0, height, kRowGrain, [&](int rowBegin, int rowEnd) {
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            const glm::vec4* in = source.getRow(y);
+            glm::vec4* out = horizontal.getRow(y);
+            for (int x = 0; x < width; ++x) {
+                Float4 sum = sampleLine(in, 1, width, x, leftTap) * quarter
+                           + Float4::load(in[x]) * half
+                           + sampleLine(in, 1, width, x, rightTap) * quarter;
+                sum.store(out[x]);
+            }
+        }
+    });
+
+    const Float4 mixFactor = Float4::splat(strength);
+    const Float4 opaque = Float4::splat(1.0f);
+    Parallel::forRange(0, height, kRowGrain, [&](int rowBegin, int rowEnd) {
+        const glm::vec4* column = horizontal.getRow(0);
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            const glm::vec4* original = source.getRow(y);
+            glm::vec4* out = result.getRow(y);
+            for (int x = 0; x < width; ++x) {
+                Float4 sum = sampleLine(column + x, width, height, y, downTap) * quarter
+                           + Float4::load(horizontal.at(x, y)) * half
+                           + sampleLine(column + x, width, height, y, upTap) * quarter;
+                Float4 blended = SIMD::mix(Float4::load(original[x]), sum, mixFactor);
+                SIMD::withW(blended, opaque).store(out[x]);
+            }
+        }
+    });
+    destination = std::move(result);
+}
+
+void CPUPostProcessor::grayscale(const Image& source, Image& destination, float strength) {
+    const int width = source.getWidth();
+    Image result(width, source.getHeight());
+
+    Parallel::forRange(0, source.getHeight(), kRowGrain, [&](int rowBegin, int rowEnd) {
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            PixelKernels::grayscaleRow(source.getRow(y), result.getRow(y), width, strength);
+        }
+    });
+    destination = std::move(result);
+}
+
+void CPUPostProcessor::vignette(const Image& source, Image& destination, float strength) {
+    const int width = source.getWidth();
+    const int height = source.getHeight();
+    Image result(width, height);
+
+    Parallel::forRange(0, height, kRowGrain, [&](int rowBegin, int rowEnd) {
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            PixelKernels::vignetteRow(source.getRow(y), result.getRow(y), width, height, y, strength);
+        }
+    });
+    destination = std::move(result);
+}
+
+void CPUPostProcessor::chromaticAberration(const Image& source, Image& destination, float strength) {
+    const int width = source.getWidth();
+    Image result(width, source.getHeight());
+
+    // Offsets are purely horizontal, so every lookup is a lerp within the row
+    Parallel::forRange(0, source.getHeight(), kRowGrain, [&](int rowBegin, int rowEnd) {
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            PixelKernels::chromaticAberrationRow(source.getRow(y), result.getRow(y), width, strength);
+        }
+    });
+    destination = std::move(result);
+}
+
+void CPUPostProcessor::gaussianBlur(const Image& source, Image& destination, float sigma) {
+    if (sigma <= 0.0f || source.isEmpty()) {
+        destination = source;
+        return;
+    }
+
+    int radii[3];
+    boxesForGaussian(sigma, radii);
+
+    Image front = source;
+    Image back(source.getWidth(), source.getHeight());
+    for (int radius : radii) {
+        boxBlurHorizontal(front, back, radius);
+        boxBlurVertical(back, front, radius);
+    }
+    destination = std::move(front);
+}
+
+void CPUPostProcessor::upscale(const Image& source, int width, int height, float sharpness, Image& destination) {
+    Image result(std::max(width, 0), std::max(height, 0));
+    if (source.isEmpty() || result.isEmpty()) {
+        destination = std::move(result);
+        return;
+    }
+
+    const glm::vec2 texel(1.0f / source.getWidth(), 1.0f / source.getHeight());
+    Parallel::forRange(0, result.getHeight(), kRowGrain, [&](int rowBegin, int rowEnd) {
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            glm::vec4* row = result.getRow(y);
+            const float v = (y + 0.5f) / result.getHeight();
+            for (int x = 0; x < result.getWidth(); ++x) {
+                const glm::vec2 uv((x + 0.5f) / result.getWidth(), v);
+                const glm::vec4 center = source.sample(uv);
+                if (sharpness <= 0.0f) {
+                    row[x] = center;
+                    continue;
+                }
+                const glm::vec4 taps[4] = {
+                    source.sample(uv + glm::vec2(texel.x, 0.0f)), source.sample(uv - glm::vec2(texel.x, 0.0f)),
+                    source.sample(uv + glm::vec2(0.0f, texel.y)), source.sample(uv - glm::vec2(0.0f, texel.y))};
+                glm::vec3 lower(center);
+                glm::vec3 upper(center);
+                glm::vec3 mean(0.0f);
+                for (const glm::vec4& tap : taps) {
+                    lower = glm::min(lower, glm::vec3(tap));
+                    upper = glm::max(upper, glm::vec3(tap));
+                    mean += glm::vec3(tap) * 0.25f;
+                }
+                const glm::vec3 sharpened = glm::vec3(center) + (glm::vec3(center) - mean) * sharpness;
+                row[x] = glm::vec4(glm::clamp(sharpened, lower, upper), center.w);
+            }
+        }
+    });
+    destination = std::move(result);
+}
+
+} // namespace ElementalRenderer
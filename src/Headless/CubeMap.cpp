@@ -0,0 +1,148 @@
+/**
+ * @file CubeMap.cpp
+ * @brief Implementation of the CPU cube map
+ */
+
+#include "Headless/CubeMap.h"
+#include "Headless/Parallel.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ElementalRenderer {
+
+namespace {
+
+const int kRowGrain = 8;
+const float kPi = 3.14159265358979f;
+
+// Solid angle of the face region from the face center to (x, y), face coordinates in [-1, 1]
+float areaElement(float x, float y) {
+    return std::atan2(x * y, std::sqrt(x * x + y * y + 1.0f));
+}
+
+} // namespace
+
+CubeMap::CubeMap()
+    : m_size(0) {
+}
+
+CubeMap::CubeMap(int size, const glm::vec4& fill)
+    : m_size(0) {
+    resize(size, fill);
+}
+
+void CubeMap::resize(int size, const glm::vec4& fill) {
+    m_size = std::max(size, 0);
+    for (Image& face : m_faces) {
+        face.resize(m_size, m_size, fill);
+    }
+}
+
+glm::vec3 CubeMap::faceDirection(int face, float s, float t) {
+    const float a = 2.0f * s - 1.0f;
+    const float b = 2.0f * t - 1.0f;
+    glm::vec3 direction;
+    switch (face) {
+        case 0: direction = glm::vec3(1.0f, -b, -a); break;
+        case 1: direction = glm::vec3(-1.0f, -b, a); break;
+        case 2: direction = glm::vec3(a, 1.0f, b); break;
+        case 3: direction = glm::vec3(a, -1.0f, -b); break;
+        case 4: direction = glm::vec3(a, -b, 1.0f); break;
+        default: direction = glm::vec3(-a, -b, -1.0f); break;
+    }
+    return glm::normalize(direction);
+}
+
+void CubeMap::directionToFace(const glm::vec3& direction, int& face, glm::vec2& st) {
+    const glm::vec3 absolute = glm::abs(direction);
+    float sc, tc, ma;
+    if (absolute.x >= absolute.y && absolute.x >= absolute.z) {
+        ma = absolute.x;
+        if (direction.x >= 0.0f) {
+            face = 0;
+            sc = -direction.z;
+        } else {
+            face = 1;
+            sc = direction.z;
+        }
+        tc = -direction.y;
+    } else if (absolute.y >= absolute.z) {
+        ma = absolute.y;
+        sc = direction.x;
+        if (direction.y >= 0.0f) {
+            face = 2;
+            tc = direction.z;
+        } else {
+            face = 3;
+            tc = -direction.z;
+        }
+    } else {
+        ma = absolute.z;
+        tc = -direction.y;
+        if (direction.z >= 0.0f) {
+            face = 4;
+            sc = direction.x;
+        } else {
+            face = 5;
+            sc = -direction.x;
+        }
+    }
+    st = glm::vec2(sc / ma + 1.0f, tc / ma + 1.0f) * 0.5f;
+}
+
+float CubeMap::texelSolidAngle(int size, int x, int y) {
+    const float inverseSize = 2.0f / static_cast<float>(size);
+    const float x0 = x * inverseSize - 1.0f;
+    const float y0 = y * inverseSize - 1.0f;
+    const float x1 = x0 + inverseSize;
+    const float y1 = y0 + inverseSize;
+    return areaElement(x0, y0) - areaElement(x0, y1) - areaElement(x1, y0) + areaElement(x1, y1);
+}
+
+glm::vec4 CubeMap::sample(const glm::vec3& direction) const {
+    if (m_size == 0) {
+        return glm::vec4(0.0f);
+    }
+    int face;
+    glm::vec2 st;
+    directionToFace(direction, face, st);
+    return m_faces[face].sample(st);
+}
+
+CubeMap CubeMap::downsample() const {
+    CubeMap result(std::max(m_size / 2, 1));
+    const int size = result.m_size;
+    for (int face = 0; face < kFaceCount; ++face) {
+        const Image& source = m_faces[face];
+        Image& target = result.m_faces[face];
+        Parallel::forRange(0, size, kRowGrain, [&](int rowBegin, int rowEnd) {
+            for (int y = rowBegin; y < rowEnd; ++y) {
+                for (int x = 0; x < size; ++x) {
+                    target.at(x, y) = 0.25f * (source.fetchClamped(2 * x, 2 * y) + source.fetchClamped(2 * x + 1, 2 * y)
+                                             + source.fetchClamped(2 * x, 2 * y + 1) + source.fetchClamped(2 * x + 1, 2 * y + 1));
+                }
+            }
+        });
+    }
+    return result;
+}
+
+CubeMap CubeMap::fromEquirectangular(const Image& panorama, int size) {
+    CubeMap result(size);
+    for (int face = 0; face < kFaceCount; ++face) {
+        Image& target = result.m_faces[face];
+        Parallel::forRange(0, size, kRowGrain, [&](int rowBegin, int rowEnd) {
+            for (int y = rowBegin; y < rowEnd; ++y) {
+                for (int x = 0; x < size; ++x) {
+                    const glm::vec3 d = faceDirection(face, (x + 0.5f) / size, (y + 0.5f) / size);
+                    const float u = std::atan2(d.z, d.x) / (2.0f * kPi) + 0.5f;
+                    const float v = std::asin(std::clamp(d.y, -1.0f, 1.0f)) / kPi + 0.5f;
+                    target.at(x, y) = panorama.sample(glm::vec2(u, v));
+                }
+            }
+        });
+    }
+    return result;
+}
+
+} // namespace ElementalRenderer
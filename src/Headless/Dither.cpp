@@ -0,0 +1,272 @@
+/**
+ * @file Dither.cpp
+ * @brief Implementation of the CPU dithering kernels
+ */
+
+#include "Headless/Dither.h"
+#include "Headless/Parallel.h"
+#include "Headless/SIMD.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace ElementalRenderer {
+
+using SIMD::Float4;
+
+namespace {
+
+const int kRowGrain = 8;
+
+// Same matrix as the PixelArtEffect shader
+const float kBayer4[16] = {
+    0.0f / 16.0f,  8.0f / 16.0f,  2.0f / 16.0f, 10.0f / 16.0f,
+    12.0f / 16.0f, 4.0f / 16.0f, 14.0f / 16.0f,  6.0f / 16.0f,
+    3.0f / 16.0f, 11.0f / 16.0f,  1.0f / 16.0f,  9.0f / 16.0f,
+    15.0f / 16.0f, 7.0f / 16.0f, 13.0f / 16.0f,  5.0f / 16.0f
+};
+
+/**
+ * Void-and-cluster blue noise (Ulichney 1993) on a toroidal grid.
+ *
+ * Energy at each cell is the Gaussian-weighted count of set cells around it;
+ * the tightest cluster is the set cell with the highest energy and the
+ * largest void the empty cell with the lowest.
+ */
+class VoidAndCluster {
+public:
+    explicit VoidAndCluster(int size)
+        : m_size(size),
+          m_cells(static_cast<size_t>(size) * size),
+          m_kernel(m_cells),
+          m_pattern(m_cells, 0),
+          m_energy(m_cells, 0.0f) {
+        const float sigma = 1.5f;
+        for (int y = 0; y < size; ++y) {
+            for (int x = 0; x < size; ++x) {
+                float dx = static_cast<float>(std::min(x, size - x));
+                float dy = static_cast<float>(std::min(y, size - y));
+                m_kernel[static_cast<size_t>(y) * size + x] = std::exp(-(dx * dx + dy * dy) / (2.0f * sigma * sigma));
+            }
+        }
+    }
+
+    std::vector<float> generate() {
+        // Deterministic initial binary pattern with roughly 10% coverage
+        std::mt19937 rng(0x5eed);
+        const size_t initialCount = m_cells / 10;
+        size_t placed = 0;
+        while (placed < initialCount) {
+            size_t cell = rng() % m_cells;
+            if (!m_pattern[cell]) {
+                toggle(cell);
+                ++placed;
+            }
+        }
+
+        // Relax until moving the tightest cluster into the largest void changes nothing
+        for (size_t guard = 0; guard < m_cells; ++guard) {
+            size_t cluster = find(1, true);
+            toggle(cluster);
+            size_t hole = find(0, false);
+            toggle(hole);
+            if (hole == cluster) {
+                break;
+            }
+        }
+
+        std::vector<unsigned char> initialPattern = m_pattern;
+        std::vector<float> initialEnergy = m_energy;
+        std::vector<size_t> ranks(m_cells, 0);
+
+        // Phase 1: rank the initial points by removing tightest clusters
+        for (size_t rank = initialCount; rank-- > 0;) {
+            size_t cluster = find(1, true);
+            toggle(cluster);
+            ranks[cluster] = rank;
+        }
+
+        // Phases 2 and 3: fill the largest voids until the grid is full
+        m_pattern = initialPattern;
+        m_energy = initialEnergy;
+        for (size_t rank = initialCount; rank < m_cells; ++rank) {
+            size_t hole = find(0, false);
+            toggle(hole);
+            ranks[hole] = rank;
+        }
+
+        std::vector<float> thresholds(m_cells);
+        for (size_t i = 0; i < m_cells; ++i) {
+            thresholds[i] = (static_cast<float>(ranks[i]) + 0.5f) / static_cast<float>(m_cells);
+        }
+        return thresholds;
+    }
+
+private:
+    void toggle(size_t cell) {
+        const float sign = m_pattern[cell] ? -1.0f : 1.0f;
+        m_pattern[cell] = m_pattern[cell] ? 0 : 1;
+
+        const int cx = static_cast<int>(cell % m_size);
+        const int cy = static_cast<int>(cell / m_size);
+        for (int y = 0; y < m_size; ++y) {
+            const float* kernelRow = &m_kernel[static_cast<size_t>((y - cy + m_size) % m_size) * m_size];
+            float* energyRow = &m_energy[static_cast<size_t>(y) * m_size];
+            for (int x = 0; x < m_size; ++x) {
+                energyRow[x] += sign * kernelRow[(x - cx + m_size) % m_size];
+            }
+        }
+    }
+
+    size_t find(unsigned char value, bool highest) const {
+        size_t best = 0;
+        bool found = false;
+        for (size_t i = 0; i < m_cells; ++i) {
+            if (m_pattern[i] != value) {
+                continue;
+            }
+            if (!found || (highest ? m_energy[i] > m_energy[best] : m_energy[i] < m_energy[best])) {
+                best = i;
+                found = true;
+            }
+        }
+        return best;
+    }
+
+    int m_size;
+    size_t m_cells;
+    std::vector<float> m_kernel;
+    std::vector<unsigned char> m_pattern;
+    std::vector<float> m_energy;
+};
+
+// Row of thresholds for a pattern, repeated to the image width
+void fillThresholds(DitherPattern pattern, int y, int width, std::vector<float>& out) {
+    out.resize(width);
+    for (int x = 0; x < width; ++x) {
+        out[x] = Dither::threshold(pattern, x, y);
+    }
+}
+
+} // namespace
+
+float Dither::threshold(DitherPattern pattern, int x, int y) {
+    switch (pattern) {
+        case DitherPattern::BAYER:
+            return kBayer4[(y & 3) * 4 + (x & 3)];
+        case DitherPattern::BLUE_NOISE:
+            return getBlueNoise()[static_cast<size_t>(y & (kBlueNoiseSize - 1)) * kBlueNoiseSize
+                                  + (x & (kBlueNoiseSize - 1))];
+        case DitherPattern::NONE:
+        default:
+            return 0.5f;
+    }
+}
+
+const std::vector<float>& Dither::getBlueNoise() {
+    static const std::vector<float> noise = VoidAndCluster(kBlueNoiseSize).generate();
+    return noise;
+}
+
+void Dither::quantize(Image& image, int levels, DitherPattern pattern) {
+    const float levelCount = static_cast<float>(std::max(levels, 1));
+    const Float4 scale = Float4::splat(levelCount);
+    const int width = image.getWidth();
+    if (pattern == DitherPattern::BLUE_NOISE) {
+        getBlueNoise();
+    }
+
+    Parallel::forRange(0, image.getHeight(), kRowGrain, [&](int rowBegin, int rowEnd) {
+        std::vector<float> thresholds;
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            glm::vec4* row = image.getRow(y);
+            if (pattern == DitherPattern::NONE) {
+                for (int x = 0; x < width; ++x) {
+                    Float4 color = Float4::load(row[x]);
+                    SIMD::withW(SIMD::floor(color * scale) / scale, color).store(row[x]);
+                }
+                continue;
+            }
+
+            fillThresholds(pattern, y, width, thresholds);
+            for (int x = 0; x < width; ++x) {
+                Float4 color = Float4::load(row[x]);
+                Float4 offset = Float4::splat(thresholds[x] / levelCount);
+                SIMD::withW(SIMD::floor((color + offset) * scale) / scale, color).store(row[x]);
+            }
+        }
+    });
+}
+
+void Dither::mapToPalette(Image& image, const PaletteLUT& lut, DitherPattern pattern, float spread) {
+    if (lut.isEmpty()) {
+        return;
+    }
+    const int width = image.getWidth();
+    if (pattern == DitherPattern::BLUE_NOISE) {
+        getBlueNoise();
+    }
+
+    const Float4 zero = Float4::splat(0.0f);
+    const Float4 one = Float4::splat(1.0f);
+
+    Parallel::forRange(0, image.getHeight(), kRowGrain, [&](int rowBegin, int rowEnd) {
+        std::vector<float> thresholds;
+        float shifted[4];
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            glm::vec4* row = image.getRow(y);
+            fillThresholds(pattern, y, width, thresholds);
+            for (int x = 0; x < width; ++x) {
+                Float4 offset = Float4::splat((thresholds[x] - 0.5f) * spread);
+                SIMD::clamp(Float4::load(row[x]) + offset, zero, one).store(shifted);
+                const glm::vec3& mapped = lut.lookup(glm::vec3(shifted[0], shifted[1], shifted[2]));
+                row[x] = glm::vec4(mapped, row[x].w);
+            }
+        }
+    });
+}
+
+void Dither::errorDiffuse(Image& image, const PaletteLUT& lut) {
+    if (lut.isEmpty() || image.isEmpty()) {
+        return;
+    }
+
+    const int width = image.getWidth();
+    const int height = image.getHeight();
+
+    // Error carried into the current and the next row, padded by one on each side
+    std::vector<glm::vec3> current(width + 2, glm::vec3(0.0f));
+    std::vector<glm::vec3> next(width + 2, glm::vec3(0.0f));
+
+    for (int y = 0; y < height; ++y) {
+        glm::vec4* row = image.getRow(y);
+        const bool leftToRight = (y % 2) == 0;
+        const int step = leftToRight ? 1 : -1;
+
+        for (int i = 0; i < width; ++i) {
+            const int x = leftToRight ? i : width - 1 - i;
+            glm::vec4& pixel = row[x];
+            if (pixel.w <= 0.0f) {
+                continue;
+            }
+
+            glm::vec3 wanted = glm::vec3(pixel.x, pixel.y, pixel.z) + current[x + 1];
+            const glm::vec3& chosen = lut.lookup(wanted);
+            glm::vec3 error = wanted - chosen;
+            pixel = glm::vec4(chosen, pixel.w);
+
+            const int ahead = x + step;
+            if (ahead >= 0 && ahead < width && row[ahead].w > 0.0f) {
+                current[ahead + 1] += error * (7.0f / 16.0f);
+            }
+            next[x - step + 1] += error * (3.0f / 16.0f);
+            next[x + 1] += error * (5.0f / 16.0f);
+            next[x + step + 1] += error * (1.0f / 16.0f);
+        }
+
+        std::swap(current, next);
+        std::fill(next.begin(), next.end(), glm::vec3(0.0f));
+    }
+}
+
+} // namespace ElementalRenderer
@@ -0,0 +1,249 @@
+/**
+ * @file EdgeDetector.cpp
+ * @brief Implementation of the screen-space outline extraction
+ */
+
+#include "Headless/EdgeDetector.h"
+#include "Headless/Parallel.h"
+#include "Headless/PixelKernels.h"
+#include "Headless/SIMD.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ElementalRenderer {
+
+using SIMD::Float4;
+using PixelKernels::clampIndex;
+
+namespace {
+
+const int kRowGrain = 8;
+
+// Largest slope factor, reached at about 84 degrees from the view direction
+const float kMaxSlope = 10.0f;
+
+// How far above the tap mean a pixel may sit and still count as the near side;
+// keeps smooth ramps (where the two are equal) while rejecting the far side of steps
+const float kNearSideTolerance = 0.2f;
+
+inline float depthEdgeThreshold(const EdgeSettings& settings, const Float4& center) {
+    const float nz = std::max(center.lane(2), 0.0f);
+    const float sine = std::sqrt(std::max(1.0f - nz * nz, 0.0f));
+    const float slope = std::min(sine / std::max(nz, 1e-3f), kMaxSlope);
+    return settings.depthThreshold * center.lane(3) * (1.0f + settings.slopeScale * slope);
+}
+
+// Classifies one pixel given its gradients and the mean depth of the taps used
+inline bool isEdge(const EdgeSettings& settings, const Float4& center, const Float4& gx, const Float4& gy,
+                   float meanTapDepth) {
+    const float normalGradient = std::sqrt(SIMD::dot3(gx, gx).lane(0) + SIMD::dot3(gy, gy).lane(0));
+    if (normalGradient > settings.normalThreshold) {
+        return true;
+    }
+
+    const float dx = gx.lane(3);
+    const float dy = gy.lane(3);
+    const float depthGradient = std::sqrt(dx * dx + dy * dy);
+    // Only the nearer side of a depth discontinuity carries the line
+    return depthGradient > depthEdgeThreshold(settings, center)
+        && center.lane(3) <= meanTapDepth + kNearSideTolerance * depthGradient;
+}
+
+// Roberts cross over the 2x2 block whose top-left corner is (x, y)
+inline bool isRobertsEdge(const EdgeSettings& settings, const Float4& center, const glm::vec4& topLeft,
+                          const glm::vec4& topRight, const glm::vec4& bottomLeft, const glm::vec4& bottomRight) {
+    if (topLeft.w <= 0.0f || topRight.w <= 0.0f || bottomLeft.w <= 0.0f || bottomRight.w <= 0.0f) {
+        return true; // silhouette against the background
+    }
+    Float4 g1 = Float4::load(bottomRight) - Float4::load(topLeft);
+    Float4 g2 = Float4::load(topRight) - Float4::load(bottomLeft);
+    const float meanDepth = (topLeft.w + topRight.w + bottomLeft.w + bottomRight.w) * 0.25f;
+    return isEdge(settings, center, g1, g2, meanDepth);
+}
+
+} // namespace
+
+EdgeSettings EdgeSettings::fromOutlineThickness(float thickness) {
+    EdgeSettings settings;
+    settings.lineWidth = 1.0f + 7.0f * std::min(std::max(thickness, 0.0f), 1.0f);
+    return settings;
+}
+
+void EdgeDetector::detectEdges(const GBuffer& gbuffer, const EdgeSettings& settings, std::vector<float>& edges) {
+    const int width = gbuffer.getWidth();
+    const int height = gbuffer.getHeight();
+    const Image& input = gbuffer.getNormalDepth();
+    edges.assign(static_cast<size_t>(width) * height, 0.0f);
+
+    const Float4 two = Float4::splat(2.0f);
+    const Float4 quarter = Float4::splat(0.25f);
+
+    Parallel::forRange(0, height, kRowGrain, [&](int rowBegin, int rowEnd) {
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            const glm::vec4* above = input.getRow(clampIndex(y - 1, height));
+            const glm::vec4* row = input.getRow(y);
+            const glm::vec4* below = input.getRow(clampIndex(y + 1, height));
+            float* out = &edges[static_cast<size_t>(y) * width];
+
+            for (int x = 0; x < width; ++x) {
+                if (row[x].w <= 0.0f) {
+                    continue;
+                }
+                const int l = clampIndex(x - 1, width);
+                const int r = clampIndex(x + 1, width);
+                const Float4 center = Float4::load(row[x]);
+
+                if (settings.edgeOperator == EdgeOperator::ROBERTS) {
+                    // A forward difference only sees the step from the pixel before it, so
+                    // test the four blocks that contain the pixel to find near-side edges
+                    const glm::vec4* rows[3] = {above, row, below};
+                    const int columns[3] = {l, x, r};
+                    bool edge = false;
+                    for (int by = 0; by < 2 && !edge; ++by) {
+                        for (int bx = 0; bx < 2 && !edge; ++bx) {
+                            edge = isRobertsEdge(settings, center, rows[by][columns[bx]], rows[by][columns[bx + 1]],
+                                                 rows[by + 1][columns[bx]], rows[by + 1][columns[bx + 1]]);
+                        }
+                    }
+                    out[x] = edge ? 1.0f : 0.0f;
+                    continue;
+                }
+
+                const glm::vec4* taps[8] = {&above[l], &above[x], &above[r], &row[l],
+                                            &row[r], &below[l], &below[x], &below[r]};
+                float tapDepth = 0.0f;
+                bool silhouette = false;
+                for (const glm::vec4* tap : taps) {
+                    silhouette = silhouette || tap->w <= 0.0f;
+                    tapDepth += tap->w;
+                }
+                if (silhouette) {
+                    out[x] = 1.0f;
+                    continue;
+                }
+
+                // Sobel scaled by 1/4 so a step of size s reads as s
+                Float4 gx = (Float4::load(above[r]) + Float4::load(row[r]) * two + Float4::load(below[r])
+                           - Float4::load(above[l]) - Float4::load(row[l]) * two - Float4::load(below[l])) * quarter;
+                Float4 gy = (Float4::load(below[l]) + Float4::load(below[x]) * two + Float4::load(below[r])
+                           - Float4::load(above[l]) - Float4::load(above[x]) * two - Float4::load(above[r])) * quarter;
+                out[x] = isEdge(settings, center, gx, gy, tapDepth / 8.0f) ? 1.0f : 0.0f;
+            }
+        }
+    });
+}
+
+std::vector<int> EdgeDetector::getJumpFloodSteps(float maxDistance) {
+    // Steps k, k/2, ..., 1 reach offsets up to 2k - 1
+    const int reach = static_cast<int>(std::ceil(std::max(maxDistance, 0.0f))) + 1;
+    int step = 1;
+    while (2 * step - 1 < reach) {
+        step *= 2;
+    }
+
+    std::vector<int> steps;
+    for (; step >= 1; step /= 2) {
+        steps.push_back(step);
+    }
+    steps.push_back(1);
+    return steps;
+}
+
+void EdgeDetector::jumpFlood(const std::vector<float>& edges, int width, int height, float maxDistance,
+                             std::vector<float>& distance) {
+    const size_t count = static_cast<size_t>(width) * height;
+    std::vector<int> front(count, -1);
+    std::vector<int> back(count, -1);
+    for (size_t i = 0; i < count; ++i) {
+        if (edges[i] > 0.5f) {
+            front[i] = static_cast<int>(i);
+        }
+    }
+
+    auto seedDistanceSquared = [width](int seed, int x, int y) {
+        const int dx = seed % width - x;
+        const int dy = seed / width - y;
+        return dx * dx + dy * dy;
+    };
+
+    for (int step : getJumpFloodSteps(maxDistance)) {
+        Parallel::forRange(0, height, kRowGrain, [&](int rowBegin, int rowEnd) {
+            for (int y = rowBegin; y < rowEnd; ++y) {
+                for (int x = 0; x < width; ++x) {
+                    int best = front[static_cast<size_t>(y) * width + x];
+                    int bestDistance = best >= 0 ? seedDistanceSquared(best, x, y) : std::numeric_limits<int>::max();
+                    for (int dy = -step; dy <= step; dy += step) {
+                        const int qy = y + dy;
+                        if (qy < 0 || qy >= height) {
+                            continue;
+                        }
+                        for (int dx = -step; dx <= step; dx += step) {
+                            const int qx = x + dx;
+                            if (qx < 0 || qx >= width) {
+                                continue;
+                            }
+                            const int seed = front[static_cast<size_t>(qy) * width + qx];
+                            if (seed >= 0) {
+                                const int d = seedDistanceSquared(seed, x, y);
+                                if (d < bestDistance) {
+                                    bestDistance = d;
+                                    best = seed;
+                                }
+                            }
+                        }
+                    }
+                    back[static_cast<size_t>(y) * width + x] = best;
+                }
+            }
+        });
+        std::swap(front, back);
+    }
+
+    distance.resize(count);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            const int seed = front[static_cast<size_t>(y) * width + x];
+            distance[static_cast<size_t>(y) * width + x] =
+                seed >= 0 ? std::sqrt(static_cast<float>(seedDistanceSquared(seed, x, y)))
+                          : std::numeric_limits<float>::max();
+        }
+    }
+}
+
+void EdgeDetector::computeCoverage(const GBuffer& gbuffer, const EdgeSettings& settings, std::vector<float>& coverage) {
+    std::vector<float> edges;
+    detectEdges(gbuffer, settings, edges);
+
+    const float halfWidth = std::max(settings.lineWidth, 0.0f) * 0.5f;
+    std::vector<float> distance;
+    jumpFlood(edges, gbuffer.getWidth(), gbuffer.getHeight(), halfWidth + 0.5f, distance);
+
+    coverage.resize(distance.size());
+    for (size_t i = 0; i < distance.size(); ++i) {
+        coverage[i] = std::min(std::max(halfWidth + 0.5f - distance[i], 0.0f), 1.0f);
+    }
+}
+
+void EdgeDetector::composite(Image& color, const std::vector<float>& coverage, const glm::vec3& outlineColor) {
+    const int width = color.getWidth();
+    const Float4 line = Float4::set(outlineColor.x, outlineColor.y, outlineColor.z, 1.0f);
+
+    Parallel::forRange(0, color.getHeight(), kRowGrain, [&](int rowBegin, int rowEnd) {
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            glm::vec4* row = color.getRow(y);
+            const float* weights = &coverage[static_cast<size_t>(y) * width];
+            for (int x = 0; x < width; ++x) {
+                if (weights[x] <= 0.0f) {
+                    continue;
+                }
+                Float4 pixel = Float4::load(row[x]);
+                Float4 blended = SIMD::mix(pixel, line, Float4::splat(weights[x]));
+                // Alpha becomes max(alpha, coverage) so lines over background stay visible
+                SIMD::withW(blended, SIMD::max(pixel, Float4::splat(weights[x]))).store(row[x]);
+            }
+        }
+    });
+}
+
+} // namespace ElementalRenderer
@@ -0,0 +1,418 @@
+/**
+ * @file EnvironmentBaker.cpp
+ * @brief Implementation of the CPU image-based lighting baker
+ */
+
+#include "Headless/EnvironmentBaker.h"
+#include "Headless/Parallel.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+namespace ElementalRenderer {
+
+namespace {
+
+const int kRowGrain = 4;
+const float kPi = 3.14159265358979f;
+
+const char kFileMagic[8] = {'E', 'R', 'I', 'B', 'L', '\0', '\0', '\0'};
+const uint32_t kFileVersion = 1;
+
+float radicalInverse(uint32_t bits) {
+    bits = (bits << 16u) | (bits >> 16u);
+    bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);
+    bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);
+    bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);
+    bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);
+    return static_cast<float>(bits) * 2.3283064365386963e-10f;
+}
+
+glm::vec2 hammersley(int i, int count) {
+    return glm::vec2(static_cast<float>(i) / static_cast<float>(count), radicalInverse(static_cast<uint32_t>(i)));
+}
+
+// GGX-distributed half vector around +z
+glm::vec3 importanceSampleGGX(const glm::vec2& xi, float roughness) {
+    const float a = roughness * roughness;
+    const float phi = 2.0f * kPi * xi.x;
+    const float cosTheta = std::sqrt((1.0f - xi.y) / (1.0f + (a * a - 1.0f) * xi.y));
+    const float sinTheta = std::sqrt(std::max(1.0f - cosTheta * cosTheta, 0.0f));
+    return glm::vec3(std::cos(phi) * sinTheta, std::sin(phi) * sinTheta, cosTheta);
+}
+
+float distributionGGX(float nDotH, float roughness) {
+    const float a = roughness * roughness;
+    const float a2 = a * a;
+    const float denom = nDotH * nDotH * (a2 - 1.0f) + 1.0f;
+    return a2 / (kPi * denom * denom);
+}
+
+// Schlick-GGX with the image-based lighting remapping k = roughness^2 / 2
+float geometrySmithIBL(float nDotV, float nDotL, float roughness) {
+    const float k = roughness * roughness * 0.5f;
+    return (nDotV / (nDotV * (1.0f - k) + k)) * (nDotL / (nDotL * (1.0f - k) + k));
+}
+
+void tangentFrame(const glm::vec3& n, glm::vec3& tangent, glm::vec3& bitangent) {
+    const glm::vec3 up = std::abs(n.z) < 0.999f ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(1.0f, 0.0f, 0.0f);
+    tangent = glm::normalize(glm::cross(up, n));
+    bitangent = glm::cross(n, tangent);
+}
+
+// Trilinear lookup into a mip chain
+glm::vec4 sampleChain(const std::vector<CubeMap>& chain, const glm::vec3& direction, float lod) {
+    lod = std::clamp(lod, 0.0f, static_cast<float>(chain.size() - 1));
+    const int level = static_cast<int>(lod);
+    const float fraction = lod - static_cast<float>(level);
+    const glm::vec4 value = chain[level].sample(direction);
+    if (fraction <= 0.0f || level + 1 >= static_cast<int>(chain.size())) {
+        return value;
+    }
+    return glm::mix(value, chain[level + 1].sample(direction), fraction);
+}
+
+void shBasis(const glm::vec3& d, float basis[9]) {
+    basis[0] = 0.282095f;
+    basis[1] = 0.488603f * d.y;
+    basis[2] = 0.488603f * d.z;
+    basis[3] = 0.488603f * d.x;
+    basis[4] = 1.092548f * d.x * d.y;
+    basis[5] = 1.092548f * d.y * d.z;
+    basis[6] = 0.315392f * (3.0f * d.z * d.z - 1.0f);
+    basis[7] = 1.092548f * d.x * d.z;
+    basis[8] = 0.546274f * (d.x * d.x - d.y * d.y);
+}
+
+void hashBytes(uint64_t& hash, const void* data, size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull; // FNV-1a prime
+    }
+}
+
+void writeImage(std::ofstream& file, const Image& image) {
+    file.write(reinterpret_cast<const char*>(image.getData()),
+               static_cast<std::streamsize>(sizeof(float) * 4 * image.getWidth() * image.getHeight()));
+}
+
+// True if the file holds at least byteCount more bytes past the read position
+bool hasBytes(std::ifstream& file, std::streamoff fileSize, uint64_t byteCount) {
+    const std::streamoff position = file.tellg();
+    return position >= 0 && position <= fileSize && static_cast<uint64_t>(fileSize - position) >= byteCount;
+}
+
+uint64_t imageBytes(int size) {
+    return sizeof(float) * 4 * static_cast<uint64_t>(size) * static_cast<uint64_t>(size);
+}
+
+bool readImage(std::ifstream& file, Image& image, int size) {
+    image.resize(size, size);
+    file.read(reinterpret_cast<char*>(image.getData()), static_cast<std::streamsize>(sizeof(float) * 4 * size * size));
+    return static_cast<bool>(file);
+}
+
+template<typename T>
+void writeValue(std::ofstream& file, const T& value) {
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+bool readValue(std::ifstream& file, T& value) {
+    file.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return static_cast<bool>(file);
+}
+
+} // namespace
+
+SphericalHarmonics9::SphericalHarmonics9() {
+    for (glm::vec3& coefficient : coefficients) {
+        coefficient = glm::vec3(0.0f);
+    }
+}
+
+SphericalHarmonics9 SphericalHarmonics9::project(const CubeMap& environment) {
+    SphericalHarmonics9 faceSums[CubeMap::kFaceCount];
+    const int size = environment.getSize();
+    Parallel::forEach(0, CubeMap::kFaceCount, [&](int face) {
+        SphericalHarmonics9& sum = faceSums[face];
+        const Image& image = environment.getFace(face);
+        float basis[9];
+        for (int y = 0; y < size; ++y) {
+            for (int x = 0; x < size; ++x) {
+                const glm::vec3 direction = CubeMap::faceDirection(face, (x + 0.5f) / size, (y + 0.5f) / size);
+                const float weight = CubeMap::texelSolidAngle(size, x, y);
+                const glm::vec4& radiance = image.at(x, y);
+                shBasis(direction, basis);
+                for (int i = 0; i < 9; ++i) {
+                    sum.coefficients[i] += glm::vec3(radiance.x, radiance.y, radiance.z) * (basis[i] * weight);
+                }
+            }
+        }
+    });
+
+    SphericalHarmonics9 result;
+    for (const SphericalHarmonics9& sum : faceSums) {
+        for (int i = 0; i < 9; ++i) {
+            result.coefficients[i] += sum.coefficients[i];
+        }
+    }
+    return result;
+}
+
+void SphericalHarmonics9::addSample(const glm::vec3& direction, const glm::vec3& radiance, float weight) {
+    float basis[9];
+    shBasis(direction, basis);
+    for (int i = 0; i < 9; ++i) {
+        coefficients[i] += radiance * (basis[i] * weight);
+    }
+}
+
+glm::vec3 SphericalHarmonics9::evaluateIrradiance(const glm::vec3& normal) const {
+    // Cosine lobe convolution (Ramamoorthi and Hanrahan) divided by pi
+    static const float kBandScale[9] = {1.0f, 2.0f / 3.0f, 2.0f / 3.0f, 2.0f / 3.0f,
+                                        0.25f, 0.25f, 0.25f, 0.25f, 0.25f};
+    float basis[9];
+    shBasis(normal, basis);
+    glm::vec3 result(0.0f);
+    for (int i = 0; i < 9; ++i) {
+        result += coefficients[i] * (basis[i] * kBandScale[i]);
+    }
+    return glm::max(result, glm::vec3(0.0f));
+}
+
+Image EnvironmentBaker::bakeBRDFLUT(int size, int sampleCount) {
+    size = std::min(std::max(size, 1), kMaxBakeSize);
+    sampleCount = std::max(sampleCount, 1);
+    Image lut(size, size);
+    Parallel::forRange(0, size, kRowGrain, [&](int rowBegin, int rowEnd) {
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            const float roughness = (y + 0.5f) / size;
+            for (int x = 0; x < size; ++x) {
+                const float nDotV = (x + 0.5f) / size;
+                const glm::vec3 v(std::sqrt(1.0f - nDotV * nDotV), 0.0f, nDotV);
+                float scale = 0.0f;
+                float bias = 0.0f;
+                for (int i = 0; i < sampleCount; ++i) {
+                    const glm::vec3 h = importanceSampleGGX(hammersley(i, sampleCount), roughness);
+                    const float vDotH = glm::dot(v, h);
+                    const glm::vec3 l = 2.0f * vDotH * h - v;
+                    const float nDotL = l.z;
+                    if (nDotL <= 0.0f) {
+                        continue;
+                    }
+                    const float nDotH = std::max(h.z, 0.0f);
+                    const float clampedVdotH = std::max(vDotH, 0.0f);
+                    const float visibility = geometrySmithIBL(nDotV, nDotL, roughness) * clampedVdotH / (nDotH * nDotV);
+                    const float fresnel = std::pow(1.0f - clampedVdotH, 5.0f);
+                    scale += (1.0f - fresnel) * visibility;
+                    bias += fresnel * visibility;
+                }
+                lut.at(x, y) = glm::vec4(scale / sampleCount, bias / sampleCount, 0.0f, 1.0f);
+            }
+        }
+    });
+    return lut;
+}
+
+std::vector<CubeMap> EnvironmentBaker::prefilterSpecular(const CubeMap& environment, int size, int mipCount, int sampleCount) {
+    std::vector<CubeMap> mips;
+    if (environment.isEmpty()) {
+        return mips;
+    }
+    size = std::min(std::max(size, 1), kMaxBakeSize);
+    mipCount = std::max(mipCount, 1);
+    sampleCount = std::max(sampleCount, 1);
+
+    std::vector<CubeMap> chain(1, environment);
+    while (chain.back().getSize() > 1) {
+        chain.push_back(chain.back().downsample());
+    }
+    const float sourceSize = static_cast<float>(environment.getSize());
+    const float texelSolidAngle = 4.0f * kPi / (6.0f * sourceSize * sourceSize);
+
+    struct LobeSample {
+        glm::vec3 direction;    // Tangent space, around +z
+        float weight;           // NdotL
+        float lod;
+    };
+
+    for (int mip = 0; mip < mipCount; ++mip) {
+        const int mipSize = std::max(size >> mip, 1);
+        const float roughness = mipCount > 1 ? static_cast<float>(mip) / static_cast<float>(mipCount - 1) : 0.0f;
+        // Mirror reflection: read the source level whose texels match this mip
+        const float mirrorLod = std::log2(sourceSize / static_cast<float>(mipSize));
+
+        // N = V = R, so the lobe is identical in every texel's tangent frame
+        std::vector<LobeSample> lobe;
+        if (roughness > 0.0f) {
+            for (int i = 0; i < sampleCount; ++i) {
+                const glm::vec3 h = importanceSampleGGX(hammersley(i, sampleCount), roughness);
+                const glm::vec3 l(2.0f * h.z * h.x, 2.0f * h.z * h.y, 2.0f * h.z * h.z - 1.0f);
+                if (l.z <= 0.0f) {
+                    continue;
+                }
+                // pdf = D * NdotH / (4 VdotH) with NdotH = VdotH
+                const float pdf = distributionGGX(h.z, roughness) * 0.25f + 1e-4f;
+                const float sampleSolidAngle = 1.0f / (static_cast<float>(sampleCount) * pdf + 1e-4f);
+                const float lod = std::max(0.5f * std::log2(sampleSolidAngle / texelSolidAngle), 0.0f);
+                lobe.push_back({l, l.z, lod});
+            }
+        }
+
+        CubeMap output(mipSize);
+        Parallel::forRange(0, CubeMap::kFaceCount * mipSize, kRowGrain, [&](int rowBegin, int rowEnd) {
+            for (int row = rowBegin; row < rowEnd; ++row) {
+                const int face = row / mipSize;
+                const int y = row % mipSize;
+                Image& target = output.getFace(face);
+                for (int x = 0; x < mipSize; ++x) {
+                    const glm::vec3 n = CubeMap::faceDirection(face, (x + 0.5f) / mipSize, (y + 0.5f) / mipSize);
+                    if (lobe.empty()) {
+                        target.at(x, y) = sampleChain(chain, n, mirrorLod);
+                        continue;
+                    }
+                    glm::vec3 tangent, bitangent;
+                    tangentFrame(n, tangent, bitangent);
+                    glm::vec4 sum(0.0f);
+                    float weight = 0.0f;
+                    for (const LobeSample& sample : lobe) {
+                        const glm::vec3 l = tangent * sample.direction.x + bitangent * sample.direction.y + n * sample.direction.z;
+                        sum += sampleChain(chain, l, sample.lod) * sample.weight;
+                        weight += sample.weight;
+                    }
+                    target.at(x, y) = sum / weight;
+                }
+            }
+        });
+        mips.push_back(std::move(output));
+    }
+    return mips;
+}
+
+uint64_t EnvironmentBaker::computeHash(const CubeMap& environment, const EnvironmentBakeSettings& settings) {
+    uint64_t hash = 14695981039346656037ull; // FNV-1a offset basis
+    hashBytes(hash, &kFileVersion, sizeof(kFileVersion));
+    const int values[6] = {environment.getSize(), settings.brdfLUTSize, settings.brdfSampleCount,
+                           settings.specularSize, settings.specularMipCount, settings.specularSampleCount};
+    hashBytes(hash, values, sizeof(values));
+    for (int face = 0; face < CubeMap::kFaceCount; ++face) {
+        const Image& image = environment.getFace(face);
+        hashBytes(hash, image.getData(), sizeof(float) * 4 * image.getWidth() * image.getHeight());
+    }
+    return hash;
+}
+
+bool EnvironmentBaker::saveToFile(const BakedEnvironment& baked, const std::string& filePath) {
+    std::ofstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    file.write(kFileMagic, sizeof(kFileMagic));
+    writeValue(file, kFileVersion);
+    writeValue(file, baked.hash);
+
+    writeValue(file, static_cast<int32_t>(baked.brdfLUT.getWidth()));
+    writeImage(file, baked.brdfLUT);
+    for (const glm::vec3& coefficient : baked.irradiance.coefficients) {
+        writeValue(file, coefficient.x);
+        writeValue(file, coefficient.y);
+        writeValue(file, coefficient.z);
+    }
+    writeValue(file, static_cast<int32_t>(baked.specular.size()));
+    for (const CubeMap& mip : baked.specular) {
+        writeValue(file, static_cast<int32_t>(mip.getSize()));
+        for (int face = 0; face < CubeMap::kFaceCount; ++face) {
+            writeImage(file, mip.getFace(face));
+        }
+    }
+    return static_cast<bool>(file);
+}
+
+bool EnvironmentBaker::loadFromFile(const std::string& filePath, BakedEnvironment& baked, uint64_t expectedHash) {
+    std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return false;
+    }
+    const std::streamoff fileSize = file.tellg();
+    file.seekg(0);
+    char magic[sizeof(kFileMagic)];
+    uint32_t version = 0;
+    uint64_t hash = 0;
+    file.read(magic, sizeof(magic));
+    if (!file || std::memcmp(magic, kFileMagic, sizeof(magic)) != 0 || !readValue(file, version)
+        || version != kFileVersion || !readValue(file, hash) || (expectedHash != 0 && hash != expectedHash)) {
+        return false;
+    }
+
+    BakedEnvironment result;
+    result.hash = hash;
+    int32_t lutSize = 0;
+    if (!readValue(file, lutSize) || lutSize < 0 || lutSize > kMaxBakeSize
+        || !hasBytes(file, fileSize, imageBytes(lutSize)) || !readImage(file, result.brdfLUT, lutSize)) {
+        return false;
+    }
+    for (glm::vec3& coefficient : result.irradiance.coefficients) {
+        if (!readValue(file, coefficient.x) || !readValue(file, coefficient.y) || !readValue(file, coefficient.z)) {
+            return false;
+        }
+    }
+    int32_t mipCount = 0;
+    if (!readValue(file, mipCount) || mipCount < 0 || mipCount > 32) {
+        return false;
+    }
+    result.specular.resize(mipCount);
+    for (CubeMap& mip : result.specular) {
+        int32_t size = 0;
+        if (!readValue(file, size) || size < 0 || size > kMaxBakeSize
+            || !hasBytes(file, fileSize, imageBytes(size) * CubeMap::kFaceCount)) {
+            return false;
+        }
+        mip.resize(size);
+        for (int face = 0; face < CubeMap::kFaceCount; ++face) {
+            if (!readImage(file, mip.getFace(face), size)) {
+                return false;
+            }
+        }
+    }
+    baked = std::move(result);
+    return true;
+}
+
+BakedEnvironment EnvironmentBaker::bake(const CubeMap& environment, const EnvironmentBakeSettings& settings,
+                                        const std::string& cacheDirectory) {
+    BakedEnvironment baked;
+    baked.hash = computeHash(environment, settings);
+
+    std::string cachePath;
+    if (!cacheDirectory.empty()) {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016llx.ibl", static_cast<unsigned long long>(baked.hash));
+        cachePath = (std::filesystem::path(cacheDirectory) / name).string();
+        if (loadFromFile(cachePath, baked, baked.hash)) {
+            baked.loadedFromCache = true;
+            return baked;
+        }
+    }
+
+    baked.brdfLUT = bakeBRDFLUT(settings.brdfLUTSize, settings.brdfSampleCount);
+    baked.specular = prefilterSpecular(environment, settings.specularSize, settings.specularMipCount,
+                                       settings.specularSampleCount);
+    baked.irradiance = SphericalHarmonics9::project(environment);
+
+    if (!cachePath.empty()) {
+        std::error_code error;
+        std::filesystem::create_directories(cacheDirectory, error);
+        if (!saveToFile(baked, cachePath)) {
+            std::cerr << "Warning: Could not write environment cache '" << cachePath << "'" << std::endl;
+        }
+    }
+    return baked;
+}
+
+} // namespace ElementalRenderer
@@ -0,0 +1,166 @@
+/**
+ * @file FFT.cpp
+ * @brief Implementation of the square 2D FFT
+ */
+
+#include "Headless/FFT.h"
+#include "Headless/Parallel.h"
+#include "Headless/SIMD.h"
+#include <cmath>
+#include <utility>
+
+namespace ElementalRenderer {
+
+using SIMD::Float4;
+
+namespace {
+
+const int kRowGrain = 8;
+const int kColumnGroupGrain = 2;
+const double kPi = 3.14159265358979323846;
+
+} // namespace
+
+FFT2D::FFT2D(int size)
+    : m_size(4) {
+    while (m_size < size) {
+        m_size *= 2;
+    }
+
+    int bits = 0;
+    while ((1 << bits) < m_size) {
+        ++bits;
+    }
+    m_bitReverse.resize(m_size);
+    for (int i = 0; i < m_size; ++i) {
+        int reversed = 0;
+        for (int b = 0; b < bits; ++b) {
+            reversed |= ((i >> b) & 1) << (bits - 1 - b);
+        }
+        m_bitReverse[i] = reversed;
+    }
+
+    m_twiddleCos.assign(m_size, 1.0f);
+    m_twiddleSin.assign(m_size, 0.0f);
+    for (int m = 1; m < m_size; m *= 2) {
+        for (int j = 0; j < m; ++j) {
+            const double angle = kPi * j / m;
+            m_twiddleCos[m + j] = static_cast<float>(std::cos(angle));
+            m_twiddleSin[m + j] = static_cast<float>(std::sin(angle));
+        }
+    }
+}
+
+void FFT2D::inverse(float* real, float* imag) const {
+    transform(real, imag, 1.0f);
+}
+
+void FFT2D::forward(float* real, float* imag) const {
+    transform(real, imag, -1.0f);
+}
+
+void FFT2D::transform(float* real, float* imag, float sign) const {
+    const int n = m_size;
+    Parallel::forRange(0, n, kRowGrain, [&](int rowBegin, int rowEnd) {
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            transformRow(real + static_cast<size_t>(y) * n, imag + static_cast<size_t>(y) * n, sign);
+        }
+    });
+    Parallel::forRange(0, n / 4, kColumnGroupGrain, [&](int groupBegin, int groupEnd) {
+        for (int group = groupBegin; group < groupEnd; ++group) {
+            transformColumns(real, imag, group * 4, sign);
+        }
+    });
+}
+
+void FFT2D::transformRow(float* re, float* im, float sign) const {
+    const int n = m_size;
+    for (int i = 0; i < n; ++i) {
+        const int j = m_bitReverse[i];
+        if (i < j) {
+            std::swap(re[i], re[j]);
+            std::swap(im[i], im[j]);
+        }
+    }
+
+    // Stages of half-length 1 and 2 fused: their twiddles are 1 and +-i
+    for (int k = 0; k < n; k += 4) {
+        const float s0r = re[k] + re[k + 1], s0i = im[k] + im[k + 1];
+        const float d0r = re[k] - re[k + 1], d0i = im[k] - im[k + 1];
+        const float s1r = re[k + 2] + re[k + 3], s1i = im[k + 2] + im[k + 3];
+        const float d1r = re[k + 2] - re[k + 3], d1i = im[k + 2] - im[k + 3];
+        // (sign * i) * d1
+        const float rotr = -sign * d1i, roti = sign * d1r;
+        re[k] = s0r + s1r;
+        im[k] = s0i + s1i;
+        re[k + 2] = s0r - s1r;
+        im[k + 2] = s0i - s1i;
+        re[k + 1] = d0r + rotr;
+        im[k + 1] = d0i + roti;
+        re[k + 3] = d0r - rotr;
+        im[k + 3] = d0i - roti;
+    }
+
+    // Remaining radix-2 stages, four butterflies per step
+    const Float4 signs = Float4::splat(sign);
+    for (int m = 4; m < n; m *= 2) {
+        for (int k = 0; k < n; k += 2 * m) {
+            for (int j = 0; j < m; j += 4) {
+                const Float4 wr = Float4::load(&m_twiddleCos[m + j]);
+                const Float4 wi = Float4::load(&m_twiddleSin[m + j]) * signs;
+                const Float4 ur = Float4::load(re + k + j);
+                const Float4 ui = Float4::load(im + k + j);
+                const Float4 vr = Float4::load(re + k + j + m);
+                const Float4 vi = Float4::load(im + k + j + m);
+                const Float4 tr = vr * wr - vi * wi;
+                const Float4 ti = vr * wi + vi * wr;
+                (ur + tr).store(re + k + j);
+                (ui + ti).store(im + k + j);
+                (ur - tr).store(re + k + j + m);
+                (ui - ti).store(im + k + j + m);
+            }
+        }
+    }
+}
+
+void FFT2D::transformColumns(float* real, float* imag, int column, float sign) const {
+    const int n = m_size;
+    float* re = real + column;
+    float* im = imag + column;
+    auto at = [n](int row) { return static_cast<size_t>(row) * n; };
+
+    for (int i = 0; i < n; ++i) {
+        const int j = m_bitReverse[i];
+        if (i < j) {
+            const Float4 ar = Float4::load(re + at(i)), ai = Float4::load(im + at(i));
+            Float4::load(re + at(j)).store(re + at(i));
+            Float4::load(im + at(j)).store(im + at(i));
+            ar.store(re + at(j));
+            ai.store(im + at(j));
+        }
+    }
+
+    // Each lane is a different column, so every stage vectorizes the same way
+    for (int m = 1; m < n; m *= 2) {
+        for (int j = 0; j < m; ++j) {
+            const Float4 wr = Float4::splat(m_twiddleCos[m + j]);
+            const Float4 wi = Float4::splat(sign * m_twiddleSin[m + j]);
+            for (int k = j; k < n; k += 2 * m) {
+                float* ure = re + at(k);
+                float* uim = im + at(k);
+                float* vre = re + at(k + m);
+                float* vim = im + at(k + m);
+                const Float4 ur = Float4::load(ure), ui = Float4::load(uim);
+                const Float4 vr = Float4::load(vre), vi = Float4::load(vim);
+                const Float4 tr = vr * wr - vi * wi;
+                const Float4 ti = vr * wi + vi * wr;
+                (ur + tr).store(ure);
+                (ui + ti).store(uim);
+                (ur - tr).store(vre);
+                (ui - ti).store(vim);
+            }
+        }
+    }
+}
+
+} // namespace ElementalRenderer
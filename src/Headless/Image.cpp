@@ -0,0 +1,86 @@
+/**
+ * @file Image.cpp
+ * @brief Implementation of the headless RGBA image
+ */
+
+#include "Headless/Image.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ElementalRenderer {
+
+Image::Image()
+    : m_width(0)
+    , m_height(0)
+{
+}
+
+Image::Image(int width, int height, const glm::vec4& fill)
+    : m_width(0)
+    , m_height(0)
+{
+    resize(width, height, fill);
+}
+
+void Image::resize(int width, int height, const glm::vec4& fill) {
+    m_width = std::max(0, width);
+    m_height = std::max(0, height);
+    m_pixels.assign(static_cast<size_t>(m_width) * m_height, fill);
+}
+
+const glm::vec4& Image::fetchClamped(int x, int y) const {
+    x = std::min(std::max(x, 0), m_width - 1);
+    y = std::min(std::max(y, 0), m_height - 1);
+    return at(x, y);
+}
+
+glm::vec4 Image::sample(const glm::vec2& uv) const {
+    if (m_pixels.empty()) {
+        return glm::vec4(0.0f);
+    }
+
+    // Shift so texel centers land on integer coordinates
+    float fx = uv.x * m_width - 0.5f;
+    float fy = uv.y * m_height - 0.5f;
+    float x0f = std::floor(fx);
+    float y0f = std::floor(fy);
+    float tx = fx - x0f;
+    float ty = fy - y0f;
+    int x0 = static_cast<int>(x0f);
+    int y0 = static_cast<int>(y0f);
+
+    glm::vec4 top = glm::mix(fetchClamped(x0, y0), fetchClamped(x0 + 1, y0), tx);
+    glm::vec4 bottom = glm::mix(fetchClamped(x0, y0 + 1), fetchClamped(x0 + 1, y0 + 1), tx);
+    return glm::mix(top, bottom, ty);
+}
+
+Image Image::fromRGBA8(const unsigned char* data, int width, int height) {
+    Image image(width, height);
+    if (!data) {
+        return image;
+    }
+
+    float lut[256];
+    for (int i = 0; i < 256; ++i) {
+        lut[i] = static_cast<float>(i) / 255.0f;
+    }
+
+    const size_t count = static_cast<size_t>(image.m_width) * image.m_height;
+    for (size_t i = 0; i < count; ++i) {
+        const unsigned char* p = data + i * 4;
+        image.m_pixels[i] = glm::vec4(lut[p[0]], lut[p[1]], lut[p[2]], lut[p[3]]);
+    }
+    return image;
+}
+
+void Image::toRGBA8(std::vector<unsigned char>& out) const {
+    out.resize(m_pixels.size() * 4);
+
+    const float* src = getData();
+    for (size_t i = 0; i < out.size(); ++i) {
+        float c = std::min(std::max(src[i], 0.0f), 1.0f);
+        out[i] = static_cast<unsigned char>(c * 255.0f + 0.5f);
+    }
+}
+
+} // namespace ElementalRenderer
@@ -0,0 +1,469 @@
+/**
+ * @file LTC.cpp
+ * @brief Implementation of the linearly transformed cosine fit and evaluation
+ */
+
+#include "Headless/LTC.h"
+#include "Headless/Parallel.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace ElementalRenderer {
+
+namespace {
+
+const float kPi = 3.14159265358979f;
+const float kMinScale = 1e-4f;
+const float kMinRoughness = 0.01f;  // CookTorranceModel::setRoughness clamps to the same range
+
+const char kFileMagic[8] = {'E', 'R', 'L', 'T', 'C', '\0', '\0', '\0'};
+const uint32_t kFileVersion = 1;
+const int kMaxFileSize = 1024;
+
+float radicalInverse(uint32_t bits) {
+    bits = (bits << 16u) | (bits >> 16u);
+    bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);
+    bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);
+    bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);
+    bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);
+    return static_cast<float>(bits) * 2.3283064365386963e-10f;
+}
+
+glm::vec2 hammersley(int i, int count) {
+    return glm::vec2((static_cast<float>(i) + 0.5f) / static_cast<float>(count), radicalInverse(static_cast<uint32_t>(i)));
+}
+
+// GGX-distributed half vector around +z, alpha = roughness^2 as in calculateCookTorrance
+glm::vec3 importanceSampleGGX(const glm::vec2& xi, float roughness) {
+    const float a = roughness * roughness;
+    const float phi = 2.0f * kPi * xi.x;
+    // 1 - y + a^2 y rather than 1 + (a^2 - 1) y, which cancels to 1 - y at the smallest roughness
+    const float cosTheta = std::sqrt((1.0f - xi.y) / (1.0f - xi.y + a * a * xi.y));
+    const float sinTheta = std::sqrt(std::max(1.0f - cosTheta * cosTheta, 0.0f));
+    return glm::vec3(std::cos(phi) * sinTheta, std::sin(phi) * sinTheta, cosTheta);
+}
+
+// Cook-Torrance GGX specular with F = 1, cosine included, and the density of
+// importanceSampleGGX reflections at l
+float evaluateSpecular(const glm::vec3& v, const glm::vec3& l, float roughness, float& pdf) {
+    pdf = 0.0f;
+    const glm::vec3 h = glm::normalize(v + l);
+    const float nDotH = h.z;
+    const float vDotH = glm::dot(v, h);
+    if (nDotH <= 0.0f || vDotH <= 0.0f) {
+        return 0.0f;
+    }
+    const float alpha = roughness * roughness;
+    const float alpha2 = alpha * alpha;
+    // sin^2 + cos^2 alpha^2, so the peak stays finite when alpha2 - 1 rounds to -1
+    const float cos2 = nDotH * nDotH;
+    const float denom = std::max(1.0f - cos2, 0.0f) + cos2 * alpha2;
+    const float d = alpha2 / (kPi * denom * denom);
+    pdf = d * nDotH / (4.0f * vDotH);
+
+    const float nDotV = v.z;
+    const float nDotL = l.z;
+    if (nDotL <= 0.0f) {
+        return 0.0f;
+    }
+    // Same Smith form as the shader, which uses alpha where GGX has alpha^2
+    const float g1v = 2.0f * nDotV / (nDotV + std::sqrt(alpha + (1.0f - alpha) * nDotV * nDotV));
+    const float g1l = 2.0f * nDotL / (nDotL + std::sqrt(alpha + (1.0f - alpha) * nDotL * nDotL));
+    return d * g1v * g1l / (4.0f * nDotV);
+}
+
+/**
+ * @brief Clamped cosine lobe transformed by M
+ */
+struct LinearCosine {
+    glm::mat3 m;
+    glm::mat3 inverse;
+    float inverseDeterminant;
+
+    // M = frame * [[p0, 0, p2], [0, p1, 0], [0, 0, 1]]
+    void set(const glm::mat3& frame, float p0, float p1, float p2) {
+        glm::mat3 scale(1.0f);
+        scale[0][0] = std::max(std::abs(p0), kMinScale);
+        scale[1][1] = std::max(std::abs(p1), kMinScale);
+        scale[2][0] = p2;
+        m = frame * scale;
+        inverse = glm::inverse(m);
+        inverseDeterminant = std::abs(glm::determinant(inverse));
+    }
+
+    // Normalized density at a unit direction
+    float density(const glm::vec3& l) const {
+        const glm::vec3 local = inverse * l;
+        const float length = glm::length(local);
+        const float cosine = local.z / length;
+        if (cosine <= 0.0f) {
+            return 0.0f;
+        }
+        return cosine / kPi * inverseDeterminant / (length * length * length);
+    }
+
+    glm::vec3 sample(const glm::vec2& xi) const {
+        const float r = std::sqrt(xi.x);
+        const float phi = 2.0f * kPi * xi.y;
+        const glm::vec3 local(r * std::cos(phi), r * std::sin(phi), std::sqrt(std::max(1.0f - xi.x, 0.0f)));
+        return glm::normalize(m * local);
+    }
+};
+
+// Integral of |target - fitted|^3, with samples of both distributions combined by the balance heuristic
+double fitError(const LinearCosine& ltc, const glm::vec3& v, float roughness, float norm, int sampleCount) {
+    double error = 0.0;
+    for (int i = 0; i < sampleCount; ++i) {
+        const glm::vec2 xi = hammersley(i, sampleCount);
+        float pdf;
+
+        const glm::vec3 fromLTC = ltc.sample(xi);
+        const float target = evaluateSpecular(v, fromLTC, roughness, pdf) / norm;
+        const float fitted = ltc.density(fromLTC);
+        if (pdf + fitted > 0.0f) {
+            const double difference = std::abs(target - fitted);
+            error += difference * difference * difference / (pdf + fitted);
+        }
+
+        const glm::vec3 h = importanceSampleGGX(xi, roughness);
+        const glm::vec3 fromBRDF = 2.0f * glm::dot(v, h) * h - v;
+        const float targetBRDF = evaluateSpecular(v, fromBRDF, roughness, pdf) / norm;
+        const float fittedBRDF = ltc.density(fromBRDF);
+        if (pdf + fittedBRDF > 0.0f) {
+            const double difference = std::abs(targetBRDF - fittedBRDF);
+            error += difference * difference * difference / (pdf + fittedBRDF);
+        }
+    }
+    return error / (2.0 * sampleCount);
+}
+
+// Minimizes f over up to 3 parameters, x holds the start and receives the result
+template<typename Function>
+void nelderMead(float* x, int dimension, int maxIterations, Function f) {
+    const int count = dimension + 1;
+    float points[4][3];
+    double values[4];
+    for (int i = 0; i < count; ++i) {
+        std::copy(x, x + dimension, points[i]);
+        if (i > 0) {
+            points[i][i - 1] += 0.25f * std::abs(x[i - 1]) + 1e-3f;
+        }
+        values[i] = f(points[i]);
+    }
+
+    int order[4] = {0, 1, 2, 3};
+    for (int iteration = 0; iteration < maxIterations; ++iteration) {
+        std::sort(order, order + count, [&](int a, int b) { return values[a] < values[b]; });
+        const int best = order[0];
+        const int worst = order[count - 1];
+        const int secondWorst = order[count - 2];
+        if (values[worst] - values[best] <= 1e-5 * std::abs(values[best]) + 1e-30) {
+            break;
+        }
+
+        float centroid[3] = {0.0f, 0.0f, 0.0f};
+        for (int i = 0; i < count; ++i) {
+            if (i != worst) {
+                for (int d = 0; d < dimension; ++d) {
+                    centroid[d] += points[i][d] / static_cast<float>(dimension);
+                }
+            }
+        }
+        auto along = [&](float t, float* out) {
+            for (int d = 0; d < dimension; ++d) {
+                out[d] = centroid[d] + t * (points[worst][d] - centroid[d]);
+            }
+            return f(out);
+        };
+
+        float reflected[3];
+        const double reflectedValue = along(-1.0f, reflected);
+        if (reflectedValue < values[best]) {
+            float expanded[3];
+            const double expandedValue = along(-2.0f, expanded);
+            const bool expand = expandedValue < reflectedValue;
+            std::copy(expand ? expanded : reflected, (expand ? expanded : reflected) + dimension, points[worst]);
+            values[worst] = expand ? expandedValue : reflectedValue;
+        } else if (reflectedValue < values[secondWorst]) {
+            std::copy(reflected, reflected + dimension, points[worst]);
+            values[worst] = reflectedValue;
+        } else {
+            const bool outside = reflectedValue < values[worst];
+            float contracted[3];
+            const double contractedValue = along(outside ? -0.5f : 0.5f, contracted);
+            if (contractedValue < std::min(reflectedValue, values[worst])) {
+                std::copy(contracted, contracted + dimension, points[worst]);
+                values[worst] = contractedValue;
+            } else {
+                for (int i = 0; i < count; ++i) {
+                    if (i == best) {
+                        continue;
+                    }
+                    for (int d = 0; d < dimension; ++d) {
+                        points[i][d] = 0.5f * (points[i][d] + points[best][d]);
+                    }
+                    values[i] = f(points[i]);
+                }
+            }
+        }
+    }
+
+    int best = 0;
+    for (int i = 1; i < count; ++i) {
+        if (values[i] < values[best]) {
+            best = i;
+        }
+    }
+    std::copy(points[best], points[best] + dimension, x);
+}
+
+// Fit one table cell; params carries the starting point in and the fit out
+void fitCell(const glm::vec3& v, float roughness, const LTCFitSettings& settings, bool isotropic,
+             float params[3], glm::vec4& matrixTexel, glm::vec4& magnitudeTexel) {
+    // Albedo split by the Schlick Fresnel weight, and the lobe's mean direction
+    const int sampleCount = std::max(settings.sampleCount, 1);
+    float scale = 0.0f;
+    float bias = 0.0f;
+    glm::vec3 meanDirection(0.0f);
+    for (int i = 0; i < sampleCount; ++i) {
+        const glm::vec3 h = importanceSampleGGX(hammersley(i, sampleCount), roughness);
+        const glm::vec3 l = 2.0f * glm::dot(v, h) * h - v;
+        float pdf;
+        const float value = evaluateSpecular(v, l, roughness, pdf);
+        if (!(value > 0.0f) || !(pdf > 0.0f) || !std::isfinite(value) || !std::isfinite(pdf)) {
+            continue;
+        }
+        const float weight = value / pdf;
+        const float fresnel = std::pow(1.0f - glm::dot(v, h), 5.0f);
+        scale += (1.0f - fresnel) * weight;
+        bias += fresnel * weight;
+        meanDirection += l * weight;
+    }
+    scale /= static_cast<float>(sampleCount);
+    bias /= static_cast<float>(sampleCount);
+    magnitudeTexel = glm::vec4(scale, bias, 0.0f, 1.0f);
+    const float norm = std::max(scale + bias, 1e-6f);
+
+    // Frame around the mean direction, which stays in the xz-plane of the view
+    glm::mat3 frame(1.0f);
+    meanDirection.y = 0.0f;
+    if (!isotropic && glm::dot(meanDirection, meanDirection) > 1e-12f) {
+        const glm::vec3 z = glm::normalize(meanDirection);
+        const glm::vec3 y(0.0f, 1.0f, 0.0f);
+        frame = glm::mat3(glm::cross(y, z), y, z);
+    }
+
+    LinearCosine ltc;
+    auto error = [&](const float* p) {
+        if (isotropic) {
+            ltc.set(frame, p[0], p[0], 0.0f);
+        } else {
+            ltc.set(frame, p[0], p[1], p[2]);
+        }
+        return fitError(ltc, v, roughness, norm, sampleCount);
+    };
+    nelderMead(params, isotropic ? 1 : 3, settings.maxIterations, error);
+    if (isotropic) {
+        params[1] = params[0];
+        params[2] = 0.0f;
+    }
+    params[0] = std::max(std::abs(params[0]), kMinScale);
+    params[1] = std::max(std::abs(params[1]), kMinScale);
+
+    ltc.set(frame, params[0], params[1], params[2]);
+    const glm::mat3& inverse = ltc.inverse;
+    matrixTexel = glm::vec4(inverse[0][0], inverse[2][0], inverse[0][2], inverse[2][2]) / inverse[1][1];
+}
+
+// Sutherland-Hodgman clip against z >= 0; a convex polygon gains at most one vertex
+int clipToHorizon(const glm::vec3* polygon, int count, glm::vec3* clipped) {
+    int clippedCount = 0;
+    for (int i = 0; i < count; ++i) {
+        const glm::vec3& a = polygon[i];
+        const glm::vec3& b = polygon[(i + 1) % count];
+        if (a.z >= 0.0f) {
+            clipped[clippedCount++] = a;
+        }
+        if ((a.z >= 0.0f) != (b.z >= 0.0f)) {
+            const float t = a.z / (a.z - b.z);
+            clipped[clippedCount++] = a + t * (b - a);
+        }
+    }
+    return clippedCount;
+}
+
+// Signed integral of the cosine-weighted edge between two unit vectors, times 2 pi
+float integrateEdge(const glm::vec3& a, const glm::vec3& b) {
+    const float cosine = std::clamp(glm::dot(a, b), -1.0f, 1.0f);
+    const glm::vec3 normal = glm::cross(a, b);
+    const float sine = glm::length(normal);
+    return normal.z * (sine > 1e-6f ? std::acos(cosine) / sine : 1.0f);
+}
+
+bool readImage(std::ifstream& file, Image& image, int size) {
+    image.resize(size, size);
+    file.read(reinterpret_cast<char*>(image.getData()), static_cast<std::streamsize>(sizeof(float) * 4 * size * size));
+    return static_cast<bool>(file);
+}
+
+} // namespace
+
+LTCTable LTC::fit(const LTCFitSettings& settings) {
+    const int size = std::max(settings.tableSize, 2);
+    LTCTable table;
+    table.matrix.resize(size, size);
+    table.magnitude.resize(size, size);
+
+    Parallel::forEach(0, size, [&](int row) {
+        const float roughness = std::max((row + 0.5f) / size, kMinRoughness);
+        const float alpha = roughness * roughness;
+        float params[3] = {alpha, alpha, 0.0f};
+        // From normal incidence, where the lobe is isotropic, towards grazing angles
+        for (int column = 0; column < size; ++column) {
+            const float x = (column + 0.5f) / size;
+            const float nDotV = 1.0f - x * x;
+            const glm::vec3 v(std::sqrt(1.0f - nDotV * nDotV), 0.0f, nDotV);
+            fitCell(v, roughness, settings, column == 0, params, table.matrix.at(column, row),
+                    table.magnitude.at(column, row));
+        }
+    });
+    return table;
+}
+
+LTCTable LTC::loadOrFit(const std::string& filePath, const LTCFitSettings& settings) {
+    LTCTable table;
+    if (loadFromFile(filePath, table, std::max(settings.tableSize, 2))) {
+        return table;
+    }
+    table = fit(settings);
+    if (!saveToFile(table, filePath)) {
+        std::cerr << "Warning: Could not write LTC tables '" << filePath << "'" << std::endl;
+    }
+    return table;
+}
+
+bool LTC::saveToFile(const LTCTable& table, const std::string& filePath) {
+    std::ofstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    const int32_t size = table.getSize();
+    file.write(kFileMagic, sizeof(kFileMagic));
+    file.write(reinterpret_cast<const char*>(&kFileVersion), sizeof(kFileVersion));
+    file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    const std::streamsize bytes = static_cast<std::streamsize>(sizeof(float) * 4 * size * size);
+    file.write(reinterpret_cast<const char*>(table.matrix.getData()), bytes);
+    file.write(reinterpret_cast<const char*>(table.magnitude.getData()), bytes);
+    return static_cast<bool>(file);
+}
+
+bool LTC::loadFromFile(const std::string& filePath, LTCTable& table, int expectedSize) {
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    char magic[sizeof(kFileMagic)];
+    uint32_t version = 0;
+    int32_t size = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    file.read(reinterpret_cast<char*>(&size), sizeof(size));
+    if (!file || std::memcmp(magic, kFileMagic, sizeof(magic)) != 0 || version != kFileVersion
+        || size <= 0 || size > kMaxFileSize || (expectedSize != 0 && size != expectedSize)) {
+        return false;
+    }
+
+    LTCTable result;
+    if (!readImage(file, result.matrix, size) || !readImage(file, result.magnitude, size)) {
+        return false;
+    }
+    table = std::move(result);
+    return true;
+}
+
+int LTC::rectanglePolygon(const glm::vec3& center, const glm::vec3& axisX, const glm::vec3& axisY, glm::vec3* polygon) {
+    polygon[0] = center - axisX - axisY;
+    polygon[1] = center + axisX - axisY;
+    polygon[2] = center + axisX + axisY;
+    polygon[3] = center - axisX + axisY;
+    return 4;
+}
+
+int LTC::diskPolygon(const glm::vec3& center, const glm::vec3& axisX, const glm::vec3& axisY, glm::vec3* polygon) {
+    // Push the vertices out so the polygon's area matches the disk's
+    const float step = 2.0f * kPi / kDiskSegments;
+    const float areaScale = std::sqrt(step / std::sin(step));
+    for (int i = 0; i < kDiskSegments; ++i) {
+        const float angle = step * static_cast<float>(i);
+        polygon[i] = center + (std::cos(angle) * axisX + std::sin(angle) * axisY) * areaScale;
+    }
+    return kDiskSegments;
+}
+
+float LTC::integratePolygon(const glm::vec3* polygon, int count, bool twoSided) {
+    count = std::min(count, kMaxPolygonVertices);
+    glm::vec3 clipped[kMaxPolygonVertices + 1];
+    const int clippedCount = clipToHorizon(polygon, count, clipped);
+    if (clippedCount < 3) {
+        return 0.0f;
+    }
+    for (int i = 0; i < clippedCount; ++i) {
+        const float length = glm::length(clipped[i]);
+        if (length <= 0.0f) {
+            return 0.0f;
+        }
+        clipped[i] /= length;
+    }
+
+    float sum = 0.0f;
+    for (int i = 0; i < clippedCount; ++i) {
+        sum += integrateEdge(clipped[i], clipped[(i + 1) % clippedCount]);
+    }
+    sum /= 2.0f * kPi;
+    return std::min(twoSided ? std::abs(sum) : std::max(sum, 0.0f), 1.0f);
+}
+
+glm::mat3 LTC::lookupInverse(const LTCTable& table, float nDotV, float roughness) {
+    const glm::vec2 uv(std::sqrt(1.0f - std::clamp(nDotV, 0.0f, 1.0f)), std::clamp(roughness, kMinRoughness, 1.0f));
+    const glm::vec4 texel = table.matrix.sample(uv);
+    return glm::mat3(glm::vec3(texel.x, 0.0f, texel.z), glm::vec3(0.0f, 1.0f, 0.0f), glm::vec3(texel.y, 0.0f, texel.w));
+}
+
+glm::vec3 LTC::evaluate(const LTCTable& table, const glm::vec3* polygon, int count, bool twoSided,
+                        const glm::vec3& position, const glm::vec3& normal, const glm::vec3& viewDir,
+                        const BRDFMaterial& material) {
+    count = std::min(count, kMaxPolygonVertices);
+    const float nDotV = std::clamp(glm::dot(normal, viewDir), 1e-4f, 1.0f);
+
+    // Shading frame with the view direction in the xz-plane
+    glm::vec3 tangent = viewDir - normal * glm::dot(normal, viewDir);
+    if (glm::dot(tangent, tangent) < 1e-8f) {
+        tangent = std::abs(normal.x) < 0.9f ? glm::vec3(1.0f, 0.0f, 0.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+        tangent -= normal * glm::dot(normal, tangent);
+    }
+    tangent = glm::normalize(tangent);
+    const glm::vec3 bitangent = glm::cross(normal, tangent);
+
+    glm::vec3 local[kMaxPolygonVertices];
+    for (int i = 0; i < count; ++i) {
+        const glm::vec3 offset = polygon[i] - position;
+        local[i] = glm::vec3(glm::dot(offset, tangent), glm::dot(offset, bitangent), glm::dot(offset, normal));
+    }
+    const float diffuse = integratePolygon(local, count, twoSided);
+
+    const float roughness = std::clamp(material.roughness, kMinRoughness, 1.0f);
+    const glm::mat3 inverse = lookupInverse(table, nDotV, roughness);
+    for (int i = 0; i < count; ++i) {
+        local[i] = inverse * local[i];
+    }
+    const glm::vec4 magnitude = table.magnitude.sample(glm::vec2(std::sqrt(1.0f - nDotV), roughness));
+    const float specular = integratePolygon(local, count, twoSided) * (material.fresnel * magnitude.x + magnitude.y);
+
+    return material.albedo * ((1.0f - material.metallic) * diffuse + specular);
+}
+
+} // namespace ElementalRenderer
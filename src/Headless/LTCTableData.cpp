@@ -0,0 +1,4137 @@
+/**
+ * @file LTCTableData.cpp
+ * @brief LTC tables embedded in the library
+ *
+ * Generated with LTC::fit(LTCFitSettings()) and written out at full float
+ * precision. Regenerate it when the fit or the Cook-Torrance GGX lobe changes.
+ */
+
+#include "Headless/LTC.h"
+
+namespace ElementalRenderer {
+
+namespace {
+
+const int kBuiltinTableSize = 64;
+
+// One row per cell, rows of increasing roughness, NdotV decreasing along each row:
+// m00, m02, m20, m22 of the inverse matrix, then the magnitude scale and bias
+constexpr float kBuiltinTable[kBuiltinTableSize * kBuiltinTableSize * 6] = {
+    1.0f, 0.0f, 0.0f, 0.0103500001f, 1.00000012f, 8.58675171e-22f,
+    1.03540897f, 0.0332663171f, -0.000344127795f, 0.0103783207f, 1.0f, 5.00879202e-17f,
+    0.814323783f, 0.0437397882f, -0.000492344028f, 0.00890235696f, 0.99999994f, 8.2757677e-15f,
+    1.56792247f, 0.119196787f, -0.000901458145f, 0.0116298115f, 1.0f, 2.39320635e-13f,
+    2.87461543f, 0.283358842f, -0.00132410158f, 0.0132666621f, 0.999999821f, 2.95378869e-12f,
+    3.05725145f, 0.371305108f, -0.00187892292f, 0.0153743587f, 0.999999881f, 2.19715756e-11f,
+    2.75494885f, 0.392595857f, -0.00203212653f, 0.0140386466f, 0.999999762f, 1.16776269e-10f,
+    5.12714338f, 0.85179764f, -0.00315857469f, 0.0188620053f, 0.999999344f, 4.88456497e-10f,
+    9.29007435f, 1.75940633f, -0.00435451511f, 0.0228760857f, 0.999999583f, 1.70765346e-09f,
+    9.32758999f, 1.98375678f, -0.00477394788f, 0.0223640464f, 0.999999464f, 5.19328625e-09f,
+    9.95897579f, 2.35052705f, -0.00521402527f, 0.0220162217f, 0.999999106f, 1.41285517e-08f,
+    7.11222935f, 1.84800684f, -0.0058992072f, 0.0226488691f, 0.999998987f, 3.50897089e-08f,
+    7.05447006f, 2.00164962f, -0.00628153002f, 0.022085797f, 0.999998152f, 8.0779138e-08f,
+    23.4460278f, 7.25128794f, -0.0107958009f, 0.0349709243f, 0.999997675f, 1.74396874e-07f,
+    20.7126331f, 6.89052868f, -0.0112524787f, 0.0337526426f, 0.999997437f, 3.56349346e-07f,
+    28.58811f, 10.2317839f, -0.0133449128f, 0.0372274928f, 0.99999702f, 6.94245045e-07f,
+    20.1494503f, 7.7240262f, -0.0134838223f, 0.0351127945f, 0.999993742f, 1.29727971e-06f,
+    31.6840248f, 12.9698725f, -0.0155417379f, 0.0379011855f, 0.999992728f, 2.33656215e-06f,
+    23.0516186f, 10.050621f, -0.0157494135f, 0.0360688493f, 0.999991179f, 4.0729833e-06f,
+    26.4172516f, 12.2337313f, -0.01795795f, 0.0387163982f, 0.999978423f, 6.8950817e-06f,
+    34.8586769f, 17.1180477f, -0.0200008545f, 0.0406803563f, 0.999973238f, 1.13692377e-05f,
+    34.4608116f, 17.905508f, -0.0209198184f, 0.0402155071f, 0.999969363f, 1.83053671e-05f,
+    37.9676094f, 20.8405113f, -0.0223337505f, 0.0406447202f, 0.99996084f, 2.88413648e-05f,
+    2.77897239f, 1.60426092f, -0.00814924482f, 0.0140597001f, 0.999939203f, 4.45523765e-05f,
+    1.66830945f, 1.0141598f, -0.00707114907f, 0.0115795219f, 0.999911308f, 6.75852571e-05f,
+    1.64838505f, 1.05619621f, -0.00629958883f, 0.00980211329f, 0.999878407f, 0.00010083081f,
+    3.20207572f, 2.15859246f, -0.00864751264f, 0.012796443f, 0.999825597f, 0.000148131687f,
+    1.94707489f, 1.3793987f, -0.00669383444f, 0.00942743011f, 0.999758422f, 0.000214543848f,
+    2.99047804f, 2.22513127f, -0.00915785041f, 0.0122827981f, 0.999665141f, 0.000306644914f,
+    2.60645819f, 2.03507948f, -0.00835131761f, 0.0106722852f, 0.999540091f, 0.000432918459f,
+    1.97369003f, 1.61645079f, -0.00845754799f, 0.010301494f, 0.999360621f, 0.000604201283f,
+    2.1749413f, 1.86857665f, -0.00878938287f, 0.0102064917f, 0.999124646f, 0.000834231323f,
+    2.07947493f, 1.87485611f, -0.00892823748f, 0.00988559425f, 0.998817027f, 0.00114029041f,
+    1.69869864f, 1.60568309f, -0.00811334793f, 0.00856561307f, 0.998412728f, 0.00154393166f,
+    2.29043651f, 2.27173066f, -0.00956996903f, 0.00963268429f, 0.997873843f, 0.00207190122f,
+    2.01796412f, 2.09963202f, -0.00968796574f, 0.00929509103f, 0.997191608f, 0.00275714486f,
+    2.84458518f, 3.10356307f, -0.0109807793f, 0.0100389142f, 0.996304691f, 0.00364001305f,
+    0.784048378f, 0.898935556f, -0.00648154086f, 0.00564368209f, 0.995169461f, 0.00476961816f,
+    0.860571325f, 1.03585315f, -0.00717062317f, 0.00594302965f, 0.993720591f, 0.00620547729f,
+    1.53325701f, 1.94204378f, -0.00984588545f, 0.00776155479f, 0.991904974f, 0.00801924244f,
+    2.34802175f, 3.12780786f, -0.0127822012f, 0.00957538374f, 0.989617646f, 0.0102969641f,
+    3.94696307f, 5.53961563f, -0.0159270205f, 0.0113259777f, 0.986758351f, 0.0131412316f,
+    4.38136816f, 6.4898057f, -0.0172845386f, 0.0116533693f, 0.983216524f, 0.0166740008f,
+    2.06144929f, 3.2198844f, -0.0123110441f, 0.00785792805f, 0.978842974f, 0.0210396312f,
+    1.90176702f, 3.14071846f, -0.0126828961f, 0.00765097747f, 0.973453045f, 0.0264081843f,
+    0.308667421f, 0.541306317f, -0.00449403143f, 0.00255724322f, 0.966865599f, 0.032979764f,
+    0.329578429f, 0.613379478f, -0.00472168531f, 0.0025287075f, 0.958835721f, 0.0409875959f,
+    0.362612158f, 0.71851474f, -0.00502889557f, 0.00252812821f, 0.949097931f, 0.0507048182f,
+    0.179574922f, 0.379498512f, -0.00381305697f, 0.00179398584f, 0.93732518f, 0.0624481589f,
+    0.135274827f, 0.307422459f, -0.00312482356f, 0.00137107517f, 0.923157811f, 0.0765838474f,
+    0.166787967f, 0.407817066f, -0.00360836741f, 0.00147046312f, 0.906161368f, 0.0935364738f,
+    0.123445317f, 0.32613048f, -0.0036387518f, 0.00137055258f, 0.885857999f, 0.113793336f,
+    0.124148361f, 0.356717885f, -0.00372429146f, 0.00128907396f, 0.861667931f, 0.137915403f,
+    0.117238596f, 0.367209643f, -0.00368793006f, 0.0011649339f, 0.832958162f, 0.166540965f,
+    0.134472534f, 0.463622063f, -0.00403443165f, 0.00115324324f, 0.798986554f, 0.200400814f,
+    0.0445633866f, 0.17059499f, -0.00171133969f, 0.000438074581f, 0.758914232f, 0.240325212f,
+    0.0273965448f, 0.118282542f, -0.00124680717f, 0.000282053225f, 0.711774766f, 0.287248462f,
+    0.0181431081f, 0.0899848044f, -0.00100795028f, 0.00019805957f, 0.656479061f, 0.342228353f,
+    0.0113104098f, 0.0655106977f, -0.000867014634f, 0.000144585283f, 0.59178704f, 0.406422347f,
+    0.0103977732f, 0.0718578845f, -0.00101530133f, 0.000139043899f, 0.516269922f, 0.48107785f,
+    0.000749161292f, 0.00640899967f, -9.94324801e-05f, 1.06385687e-05f, 0.42829296f, 0.567365825f,
+    0.00148592424f, 0.0173908994f, -0.000284729089f, 2.18747937e-05f, 0.325897276f, 0.665729761f,
+    0.000646816217f, 0.0117765693f, -0.000188800608f, 8.75620208e-06f, 0.20637539f, 0.771038234f,
+    0.000169259627f, 0.00652890326f, -9.9987883e-05f, 1.55711518e-06f, 0.0630081445f, 0.772068501f,
+    1.0f, 0.0f, 0.0f, 0.00568062533f, 1.00000036f, 1.68326388e-21f,
+    1.06644034f, 0.035462223f, -3.52645475e-05f, 0.00106397783f, 0.999999642f, 5.22344241e-17f,
+    0.974239051f, 0.0538954213f, -5.99949999e-05f, 0.00108508149f, 0.999999404f, 8.39219577e-15f,
+    1.03821623f, 0.0804663301f, -8.55773251e-05f, 0.00110424566f, 0.999999106f, 2.40962252e-13f,
+    1.0373621f, 0.103446364f, -0.000112628964f, 0.00112863851f, 0.99999845f, 2.96558481e-12f,
+    0.9924438f, 0.121263407f, -0.000133585898f, 0.00109320658f, 0.999997318f, 2.20279472e-11f,
+    0.957322896f, 0.13854678f, -0.000148068488f, 0.00102301221f, 0.999995589f, 1.16982049e-10f,
+    0.96543628f, 0.161676362f, -0.000179868322f, 0.00107421214f, 0.999994099f, 4.89074115e-10f,
+    0.931920946f, 0.177343577f, -0.000199647533f, 0.00104891649f, 0.999991894f, 1.70924386e-09f,
+    0.959051609f, 0.2047382f, -0.000221079012f, 0.0010357406f, 0.999989629f, 5.19695487e-09f,
+    0.952968359f, 0.22565046f, -0.000244957453f, 0.00103440182f, 0.999986172f, 1.4136182e-08f,
+    0.999834001f, 0.260377467f, -0.000267311989f, 0.0010263453f, 0.999982536f, 3.51045593e-08f,
+    0.939085901f, 0.267077059f, -0.000282609079f, 0.000993703725f, 0.999979377f, 8.08059539e-08f,
+    0.969450533f, 0.299273431f, -0.000324823515f, 0.00105225365f, 0.999975979f, 1.74441027e-07f,
+    0.840811789f, 0.280349523f, -0.000314415054f, 0.000943155552f, 0.999972165f, 3.56422561e-07f,
+    0.868599176f, 0.311377496f, -0.000343430642f, 0.000958089659f, 0.99996686f, 6.94352991e-07f,
+    0.799198449f, 0.306891084f, -0.000335351186f, 0.000873313693f, 0.999961495f, 1.29743421e-06f,
+    0.777738154f, 0.318952054f, -0.000366579538f, 0.000894002034f, 0.999954104f, 2.33674655e-06f,
+    0.72449249f, 0.31631285f, -0.000369800691f, 0.000846937939f, 0.999946713f, 4.07319294e-06f,
+    0.818174899f, 0.379516304f, -0.000411518005f, 0.000887246337f, 0.999937832f, 6.8952927e-06f,
+    0.892905653f, 0.439065099f, -0.000449063053f, 0.000913391763f, 0.999925554f, 1.13693177e-05f,
+    0.838553607f, 0.436187863f, -0.000452671811f, 0.000870228978f, 0.999911368f, 1.83050652e-05f,
+    0.750229537f, 0.412257463f, -0.000448318082f, 0.000815909007f, 0.999891698f, 2.88405208e-05f,
+    0.765581548f, 0.443748057f, -0.000456888578f, 0.000788281613f, 0.999868095f, 4.45500373e-05f,
+    0.760000587f, 0.464127332f, -0.000460098643f, 0.00075347611f, 0.999833584f, 6.75806878e-05f,
+    0.656623065f, 0.421973675f, -0.000445356243f, 0.000692995556f, 0.999789953f, 0.000100822057f,
+    0.683044374f, 0.461579621f, -0.000462909491f, 0.000685032166f, 0.999731421f, 0.000148116931f,
+    0.650087655f, 0.461631984f, -0.000473979657f, 0.000667564513f, 0.999651909f, 0.000214518484f,
+    0.611558199f, 0.455979764f, -0.000472493179f, 0.000633745454f, 0.99954623f, 0.000306604372f,
+    0.566465199f, 0.443292737f, -0.000480288407f, 0.000613787852f, 0.999404728f, 0.000432854285f,
+    0.569896936f, 0.467910916f, -0.000491019222f, 0.000598093204f, 0.999216795f, 0.000604103145f,
+    0.530111909f, 0.456547827f, -0.000488368445f, 0.000567126379f, 0.998968482f, 0.000834082544f,
+    0.506823421f, 0.457728267f, -0.000501145842f, 0.000554898696f, 0.998642564f, 0.00114005781f,
+    0.554774761f, 0.525442421f, -0.000531196245f, 0.000560824235f, 0.998216867f, 0.00154358707f,
+    0.52299732f, 0.519589067f, -0.000527769327f, 0.000531244616f, 0.99766463f, 0.00207139109f,
+    0.509809852f, 0.531358242f, -0.000539703236f, 0.000517830311f, 0.996954024f, 0.00275640143f,
+    0.484032691f, 0.529489875f, -0.00052891922f, 0.000483565818f, 0.996041179f, 0.00363892945f,
+    0.408621609f, 0.469257653f, -0.000541613845f, 0.000471613137f, 0.994878709f, 0.00476807076f,
+    0.375098199f, 0.45257771f, -0.000534787076f, 0.000443247525f, 0.993406713f, 0.00620326586f,
+    0.351549476f, 0.445959449f, -0.000510094396f, 0.000402124744f, 0.991552174f, 0.00801614393f,
+    0.397596151f, 0.53077966f, -0.000516978907f, 0.000387292443f, 0.989229262f, 0.0102925813f,
+    0.354041517f, 0.49792099f, -0.00051470648f, 0.000366031076f, 0.986333668f, 0.0131350402f,
+    0.294427991f, 0.436698228f, -0.000443477737f, 0.000299007253f, 0.982742369f, 0.0166652929f,
+    0.309673697f, 0.485155255f, -0.000480070594f, 0.000306431699f, 0.978311121f, 0.0210274272f,
+    0.302396715f, 0.501283467f, -0.000502251962f, 0.000302995584f, 0.972866952f, 0.0263911635f,
+    0.254598051f, 0.447409809f, -0.000478399947f, 0.000272236532f, 0.96620971f, 0.0329558104f,
+    0.196961001f, 0.367744446f, -0.000423734979f, 0.000226939781f, 0.958103716f, 0.0409543663f,
+    0.200222149f, 0.39825961f, -0.000440561591f, 0.000221489827f, 0.948270917f, 0.0506582893f,
+    0.171486929f, 0.364492714f, -0.000383019389f, 0.000180213363f, 0.936394393f, 0.0623828955f,
+    0.166986361f, 0.380589843f, -0.000389343593f, 0.000170840969f, 0.922100842f, 0.0764926225f,
+    0.146754548f, 0.360059679f, -0.000355975353f, 0.00014507267f, 0.904959917f, 0.0934077725f,
+    0.124639474f, 0.330871075f, -0.000347598951f, 0.00013093157f, 0.88447845f, 0.113610752f,
+    0.101250216f, 0.292517483f, -0.000333754229f, 0.000115528834f, 0.860082388f, 0.137653247f,
+    0.0781408995f, 0.247376233f, -0.000280976441f, 8.87611386e-05f, 0.831118107f, 0.166162312f,
+    0.079862617f, 0.279395819f, -0.000277905521f, 7.94457301e-05f, 0.796833098f, 0.199846685f,
+    0.0580158904f, 0.226653799f, -0.000256988686f, 6.57907149e-05f, 0.756360829f, 0.239498883f,
+    0.0404601358f, 0.178819269f, -0.000217703899f, 4.92539548e-05f, 0.708711386f, 0.285990655f,
+    0.0339958966f, 0.17292729f, -0.000188112608f, 3.69686022e-05f, 0.652738869f, 0.34024772f,
+    0.0251802765f, 0.150971621f, -0.000177791037f, 2.96537291e-05f, 0.587115526f, 0.403173417f,
+    0.0156621318f, 0.114420332f, -0.000128901273f, 1.76567173e-05f, 0.51025933f, 0.475411654f,
+    0.0102327345f, 0.0956459716f, -9.94321381e-05f, 1.06419402e-05f, 0.420212209f, 0.556555569f,
+    0.00703466823f, 0.0916803628f, -9.97058451e-05f, 7.66432913e-06f, 0.314281911f, 0.641800761f,
+    0.00610467233f, 0.13185297f, -9.98923133e-05f, 4.6394839e-06f, 0.187958956f, 0.701691508f,
+    0.00290600373f, 0.186212108f, -9.99874828e-05f, 1.58200635e-06f, 0.0385747701f, 0.468827814f,
+    1.0f, 0.0f, 0.0f, 0.0129284011f, 1.00000024f, 2.04473012e-19f,
+    1.00543523f, 0.0333686993f, -0.000101241487f, 0.00305713341f, 0.999999702f, 8.67920515e-17f,
+    0.993766189f, 0.0549552217f, -0.000167660386f, 0.00303386222f, 0.999999166f, 9.52046652e-15f,
+    0.983976007f, 0.0762808248f, -0.000233618819f, 0.00301558338f, 0.999997079f, 2.54846518e-13f,
+    1.00709128f, 0.100511566f, -0.000304870424f, 0.00305592502f, 0.999994814f, 3.06151003e-12f,
+    0.981365621f, 0.119930245f, -0.000366958615f, 0.00300371833f, 0.999990523f, 2.24859437e-11f,
+    0.982617617f, 0.142233908f, -0.000433654117f, 0.00299673015f, 0.999987185f, 1.18677471e-10f,
+    0.98260808f, 0.164549828f, -0.000497157685f, 0.0029696438f, 0.999982476f, 4.94288943e-10f,
+    0.970017135f, 0.184639558f, -0.000561554101f, 0.00295077078f, 0.999976397f, 1.72317527e-09f,
+    0.958064258f, 0.204490975f, -0.000622344378f, 0.00291604968f, 0.999970078f, 5.23027799e-09f,
+    0.956968367f, 0.226635426f, -0.00068520027f, 0.00289381272f, 0.999962032f, 1.42091006e-08f,
+    0.942789197f, 0.24555473f, -0.000741571421f, 0.00284760073f, 0.999953687f, 3.52527145e-08f,
+    0.914763451f, 0.26018095f, -0.000794087246f, 0.00279245735f, 0.999944568f, 8.10890199e-08f,
+    0.91873467f, 0.283615142f, -0.000859117659f, 0.00278336857f, 0.999934196f, 1.74953655e-07f,
+    0.908317029f, 0.302826136f, -0.000913236174f, 0.00273971655f, 0.999921918f, 3.57309148e-07f,
+    0.891385138f, 0.319540173f, -0.000966027088f, 0.00269523333f, 0.999909103f, 6.95825861e-07f,
+    0.85639149f, 0.328877509f, -0.000996583607f, 0.00259550428f, 0.999894202f, 1.29979333e-06f,
+    0.859697759f, 0.352538377f, -0.0010635684f, 0.00259401207f, 0.999878407f, 2.3403984e-06f,
+    0.847595453f, 0.37010771f, -0.00111354806f, 0.00255051814f, 0.999859869f, 4.07868538e-06f,
+    0.829165637f, 0.384613454f, -0.00116697955f, 0.00251624244f, 0.999838829f, 6.90330444e-06f,
+    0.804506958f, 0.395557731f, -0.00119375018f, 0.00242826832f, 0.999814928f, 1.13807164e-05f,
+    0.791247487f, 0.411610246f, -0.00124836212f, 0.00240006787f, 0.999786437f, 1.83208249e-05f,
+    0.774467528f, 0.425551444f, -0.0012842057f, 0.00233733747f, 0.999752104f, 2.88617302e-05f,
+    0.744291961f, 0.431394339f, -0.00129903306f, 0.00224141823f, 0.999711633f, 4.45777769e-05f,
+    0.739262998f, 0.451422632f, -0.00135773537f, 0.00222364278f, 0.999660909f, 6.76158452e-05f,
+    0.704010606f, 0.452437252f, -0.00137508125f, 0.00213983958f, 0.999598205f, 0.000100865102f,
+    0.690526903f, 0.466630757f, -0.00139358884f, 0.00206243293f, 0.999517977f, 0.000148167252f,
+    0.657210112f, 0.46663329f, -0.00141528063f, 0.00199345406f, 0.999416173f, 0.000214574044f,
+    0.651940227f, 0.486072272f, -0.00145793508f, 0.00195563096f, 0.999285281f, 0.000306660193f,
+    0.62341547f, 0.487838537f, -0.00146877172f, 0.00187715201f, 0.99911654f, 0.00043290059f,
+    0.600489855f, 0.493014991f, -0.00149077608f, 0.00181598903f, 0.998899162f, 0.000604124216f,
+    0.57167542f, 0.492302775f, -0.00149663084f, 0.00173810776f, 0.998618424f, 0.000834052393f,
+    0.542794824f, 0.49024716f, -0.00148663542f, 0.00164620567f, 0.998257279f, 0.00113993732f,
+    0.525745809f, 0.497974426f, -0.0015120802f, 0.00159653113f, 0.997793257f, 0.00154331303f,
+    0.512101471f, 0.50875473f, -0.00152143906f, 0.00153156824f, 0.997197747f, 0.00207087607f,
+    0.487086087f, 0.507681608f, -0.00152484712f, 0.00146315654f, 0.996439278f, 0.00275550643f,
+    0.448304653f, 0.490369588f, -0.00149008224f, 0.00136241433f, 0.995474398f, 0.00363747054f,
+    0.430372268f, 0.494276315f, -0.0015380882f, 0.00133940356f, 0.994253695f, 0.0047657718f,
+    0.411629885f, 0.496654421f, -0.00152998185f, 0.00126819557f, 0.992716849f, 0.00619973568f,
+    0.374707341f, 0.475358695f, -0.00147925573f, 0.00116624404f, 0.990790367f, 0.00801083166f,
+    0.368833125f, 0.492351264f, -0.0014791803f, 0.00110821612f, 0.988386691f, 0.0102847079f,
+    0.339287817f, 0.477082789f, -0.00144260074f, 0.00102599279f, 0.985401034f, 0.0131235309f,
+    0.313985705f, 0.46570459f, -0.00142879412f, 0.000963429629f, 0.981707752f, 0.0166486483f,
+    0.278878897f, 0.436919034f, -0.00136514404f, 0.000871464028f, 0.977161288f, 0.0210035145f,
+    0.267115116f, 0.442785501f, -0.00135161821f, 0.000815481064f, 0.971586764f, 0.0263570435f,
+    0.248062715f, 0.435930192f, -0.00131888757f, 0.000750604027f, 0.964780748f, 0.0329073295f,
+    0.223184392f, 0.41674763f, -0.00125998806f, 0.000674891635f, 0.95650214f, 0.0408856869f,
+    0.201353624f, 0.400520056f, -0.00121138431f, 0.000609094568f, 0.946474075f, 0.0505612232f,
+    0.177978531f, 0.378307909f, -0.00114940247f, 0.000540877285f, 0.934367478f, 0.0622457005f,
+    0.161410898f, 0.367870957f, -0.00110910402f, 0.000486739707f, 0.919805825f, 0.0762985349f,
+    0.143820882f, 0.352915496f, -0.00105742156f, 0.000431008142f, 0.90235126f, 0.0931323767f,
+    0.124627054f, 0.330881923f, -0.00100414758f, 0.000378307013f, 0.881495833f, 0.113218382f,
+    0.105803803f, 0.305671602f, -0.000959420926f, 0.000332172523f, 0.856651604f, 0.137090191f,
+    0.0911653936f, 0.288587421f, -0.000878339575f, 0.000277535524f, 0.827144623f, 0.165347338f,
+    0.0752122104f, 0.263120502f, -0.000806626864f, 0.000230657417f, 0.792189956f, 0.198652282f,
+    0.0630151927f, 0.24618572f, -0.000741583237f, 0.000189912942f, 0.750881672f, 0.237720191f,
+    0.0498914905f, 0.220555067f, -0.000662891194f, 0.000150035339f, 0.70216608f, 0.283284605f,
+    0.0376593471f, 0.19165118f, -0.000577633036f, 0.000113577436f, 0.644800484f, 0.336010456f,
+    0.027066499f, 0.162313372f, -0.000503956398f, 8.41130604e-05f, 0.57729888f, 0.396276116f,
+    0.0183996595f, 0.134340391f, -0.000411742687f, 5.64564216e-05f, 0.497819752f, 0.463561147f,
+    0.0113589242f, 0.106141813f, -0.000319449842f, 3.42453131e-05f, 0.40395692f, 0.534542978f,
+    0.00580418156f, 0.0755602792f, -0.000232211794f, 1.79084873e-05f, 0.292357415f, 0.595957518f,
+    0.00203861692f, 0.0439380035f, -0.000137372277f, 6.44611237e-06f, 0.159231693f, 0.591171026f,
+    0.000700637349f, 0.0445872098f, -9.9984667e-05f, 1.75139098e-06f, 0.0236018486f, 0.271976769f,
+    1.0f, 0.0f, 0.0f, 0.0134443808f, 1.00000012f, 5.14130338e-17f,
+    0.996740282f, 0.0330579355f, -0.000197359564f, 0.0059666601f, 0.999999821f, 8.72862476e-16f,
+    0.997367382f, 0.0551665686f, -0.000329396687f, 0.00596481841f, 0.999997675f, 1.9572414e-14f,
+    0.993292987f, 0.0770009607f, -0.000460040028f, 0.00594133884f, 0.999994397f, 3.35329773e-13f,
+    0.987900436f, 0.0986007974f, -0.000588996161f, 0.00590631459f, 0.999988794f, 3.51128696e-12f,
+    0.985432863f, 0.120432086f, -0.000718809548f, 0.00588575331f, 0.999982834f, 2.44007349e-11f,
+    0.982756615f, 0.142263442f, -0.000847857387f, 0.0058607338f, 0.999974668f, 1.25310734e-10f,
+    0.977169514f, 0.163636327f, -0.000974169816f, 0.00582042709f, 0.999964297f, 5.13891207e-10f,
+    0.961365581f, 0.182998434f, -0.00109294429f, 0.00574434269f, 0.999954283f, 1.77428761e-09f,
+    0.956292868f, 0.204140037f, -0.0012179797f, 0.00570811937f, 0.999940813f, 5.35077183e-09f,
+    0.947426975f, 0.224376455f, -0.0013388677f, 0.00565551827f, 0.999926269f, 1.44705892e-08f,
+    0.937191129f, 0.24411194f, -0.00145663426f, 0.00559438765f, 0.999908924f, 3.57823566e-08f,
+    0.926320851f, 0.263466209f, -0.00157189579f, 0.00552857434f, 0.999890864f, 8.21008115e-08f,
+    0.91573143f, 0.282695025f, -0.00168388896f, 0.00545631489f, 0.999870062f, 1.76791957e-07f,
+    0.900823832f, 0.300319403f, -0.00179105531f, 0.00537396548f, 0.999846935f, 3.60506618e-07f,
+    0.886710823f, 0.317864776f, -0.00189877697f, 0.00529837329f, 0.999821544f, 7.01177953e-07f,
+    0.870977819f, 0.334465414f, -0.00199637678f, 0.00520007592f, 0.999794245f, 1.30845115e-06f,
+    0.854763865f, 0.350496829f, -0.00209496752f, 0.00511024008f, 0.999763131f, 2.3539842e-06f,
+    0.84191972f, 0.36762169f, -0.0021961187f, 0.00503072236f, 0.999727905f, 4.09941913e-06f,
+    0.817857265f, 0.379352719f, -0.00227313093f, 0.00490194093f, 0.999690533f, 6.93416541e-06f,
+    0.805888355f, 0.396217048f, -0.00236221449f, 0.00480568828f, 0.999647856f, 1.14255736e-05f,
+    0.788772821f, 0.410307497f, -0.00244842586f, 0.00470784213f, 0.999598444f, 1.83846314e-05f,
+    0.764708996f, 0.420196295f, -0.0025215731f, 0.0045899679f, 0.999542415f, 2.8950597e-05f,
+    0.748882055f, 0.434079736f, -0.00258877897f, 0.00446733739f, 0.999476612f, 4.46991653e-05f,
+    0.727925897f, 0.444522768f, -0.00265970966f, 0.00435646484f, 0.999400139f, 6.77783828e-05f,
+    0.708087385f, 0.455072194f, -0.0027210163f, 0.00423481781f, 0.99930805f, 0.000101078578f,
+    0.684099972f, 0.462274671f, -0.0027658816f, 0.00409382861f, 0.999196649f, 0.000148442312f,
+    0.666262805f, 0.473064482f, -0.00282392162f, 0.00397802098f, 0.99906069f, 0.000214921063f,
+    0.643091202f, 0.479478419f, -0.00285857869f, 0.00383486901f, 0.998893023f, 0.000307088543f,
+    0.621866643f, 0.486624479f, -0.00290386728f, 0.00371171371f, 0.998683929f, 0.000433416106f,
+    0.60126555f, 0.493631184f, -0.0029383027f, 0.0035797297f, 0.998422265f, 0.000604726723f,
+    0.575879335f, 0.49591428f, -0.00296032289f, 0.00343839102f, 0.998092949f, 0.000834730978f,
+    0.54787904f, 0.494817942f, -0.00296487194f, 0.00328352954f, 0.997678161f, 0.00114066398f,
+    0.527769685f, 0.499913454f, -0.00298541971f, 0.00315257045f, 0.997154891f, 0.00154403097f,
+    0.502219558f, 0.498966128f, -0.00298397173f, 0.00300424173f, 0.996495724f, 0.00207149074f,
+    0.478866369f, 0.499105275f, -0.00298296707f, 0.00286268513f, 0.995665848f, 0.00275586848f,
+    0.456246674f, 0.499056995f, -0.00297415373f, 0.00271972758f, 0.994621992f, 0.00363733456f,
+    0.431081086f, 0.495075643f, -0.00296935416f, 0.00258617359f, 0.993314207f, 0.00476478133f,
+    0.407603115f, 0.491793513f, -0.00294144265f, 0.00243853196f, 0.991680801f, 0.00619737431f,
+    0.382230461f, 0.484887928f, -0.002907424f, 0.00229259185f, 0.989645958f, 0.00800632127f,
+    0.357670546f, 0.47745797f, -0.0028612935f, 0.00214408222f, 0.987121642f, 0.0102769611f,
+    0.333962411f, 0.469641566f, -0.00281450851f, 0.00200207182f, 0.983999431f, 0.0131109711f,
+    0.313749373f, 0.465368718f, -0.0027802831f, 0.00187509996f, 0.980154276f, 0.0166290514f,
+    0.290596515f, 0.455272764f, -0.0027158272f, 0.00173405989f, 0.975435674f, 0.020973755f,
+    0.269192994f, 0.446243763f, -0.00266077276f, 0.00160570478f, 0.969665587f, 0.0263127275f,
+    0.245495737f, 0.431420475f, -0.00257216883f, 0.00146422687f, 0.96263653f, 0.0328422263f,
+    0.223487556f, 0.417297214f, -0.00248726108f, 0.00133261341f, 0.954103529f, 0.0407910794f,
+    0.203383416f, 0.404554635f, -0.00240545999f, 0.00120983622f, 0.943780541f, 0.0504246838f,
+    0.181471124f, 0.385703772f, -0.00230704178f, 0.00108597719f, 0.93133527f, 0.0620495826f,
+    0.161515981f, 0.368103802f, -0.00219571334f, 0.000963950297f, 0.916378379f, 0.076017499f,
+    0.142561823f, 0.349833876f, -0.00209052768f, 0.000852445781f, 0.898459613f, 0.092729874f,
+    0.12422958f, 0.329811335f, -0.00197184389f, 0.000743218581f, 0.877055347f, 0.112640627f,
+    0.10770376f, 0.311158895f, -0.0018597286f, 0.000644214859f, 0.851558268f, 0.13625738f,
+    0.0912142694f, 0.288764477f, -0.00172205083f, 0.000544462353f, 0.821262598f, 0.164137974f,
+    0.0752916932f, 0.26338762f, -0.00157988688f, 0.000452104403f, 0.785346568f, 0.196878821f,
+    0.0616095327f, 0.240677699f, -0.00143665622f, 0.000368244684f, 0.742849588f, 0.235082373f,
+    0.0490626767f, 0.216868997f, -0.0012911791f, 0.000292568555f, 0.692638278f, 0.279285669f,
+    0.0371481702f, 0.189035356f, -0.00113110943f, 0.000222735427f, 0.633358836f, 0.329793185f,
+    0.0271366108f, 0.162707254f, -0.000973609101f, 0.000162837445f, 0.563360631f, 0.386274993f,
+    0.0184318833f, 0.134567112f, -0.000805407995f, 0.000110783942f, 0.480577558f, 0.446718395f,
+    0.0113332802f, 0.105906852f, -0.00063240726f, 6.81749079e-05f, 0.382398844f, 0.504415214f,
+    0.00587957865f, 0.0764616504f, -0.000456616108f, 3.56101627e-05f, 0.266076595f, 0.539051652f,
+    0.00217233156f, 0.0466823876f, -0.000277641462f, 1.34507827e-05f, 0.132454365f, 0.483471632f,
+    0.000273903541f, 0.016723888f, -9.99739932e-05f, 2.2801562e-06f, 0.0180258807f, 0.179364786f,
+    1.0f, 0.0f, 0.0f, 0.0155646661f, 0.999999821f, 8.44835744e-15f,
+    0.99943924f, 0.0331377685f, -0.000326204376f, 0.00987765007f, 0.999999166f, 2.03167307e-14f,
+    0.998425245f, 0.0552150458f, -0.000544339768f, 0.0098666111f, 0.999995708f, 1.36442588e-13f,
+    0.995190263f, 0.0771386698f, -0.000760777388f, 0.00983218476f, 0.999989629f, 9.02183384e-13f,
+    0.990917861f, 0.0989006087f, -0.000975296076f, 0.00978543982f, 0.999981344f, 5.79150573e-12f,
+    0.985357761f, 0.120419301f, -0.00118845329f, 0.00973576494f, 0.999970675f, 3.22364357e-11f,
+    0.978755355f, 0.141675055f, -0.0013993443f, 0.00967666507f, 0.99995774f, 1.48851098e-10f,
+    0.974559247f, 0.163197458f, -0.00160939188f, 0.00961907487f, 0.999941468f, 5.76992398e-10f,
+    0.965758026f, 0.183830366f, -0.00181465072f, 0.00954050291f, 0.999922752f, 1.92788452e-09f,
+    0.959550977f, 0.204822481f, -0.00202027801f, 0.00947084278f, 0.999901056f, 5.69530823e-09f,
+    0.947582304f, 0.224421546f, -0.00221603666f, 0.00936326291f, 0.999877393f, 1.51914552e-08f,
+    0.935229719f, 0.243601322f, -0.00240680319f, 0.00924591627f, 0.999849558f, 3.72031295e-08f,
+    0.924865663f, 0.263044387f, -0.00259895413f, 0.00914302282f, 0.999818325f, 8.4759769e-08f,
+    0.912681103f, 0.281750888f, -0.00278476812f, 0.00902549084f, 0.999784648f, 1.81548572e-07f,
+    0.899271309f, 0.299793482f, -0.00296358881f, 0.00889399461f, 0.999747097f, 3.6868397e-07f,
+    0.886033773f, 0.317617565f, -0.00313736917f, 0.00875634979f, 0.999705553f, 7.14750399e-07f,
+    0.872571051f, 0.335081667f, -0.00330820517f, 0.00861878507f, 0.999660134f, 1.33027675e-06f,
+    0.855292618f, 0.350718647f, -0.00346686575f, 0.00845833588f, 0.999609709f, 2.38810503e-06f,
+    0.838459969f, 0.366116583f, -0.00362134073f, 0.00829710998f, 0.99955374f, 4.15140494e-06f,
+    0.824007988f, 0.382207483f, -0.00377516448f, 0.00814255606f, 0.999492288f, 7.01152567e-06f,
+    0.804534376f, 0.39556253f, -0.00391086331f, 0.00795772299f, 0.999424219f, 1.15382354e-05f,
+    0.785169899f, 0.408441931f, -0.00404237537f, 0.0077741202f, 0.999348044f, 1.85454282e-05f,
+    0.770030141f, 0.423126251f, -0.00417829445f, 0.00760705536f, 0.999261737f, 2.91758533e-05f,
+    0.748165488f, 0.433647305f, -0.00428726943f, 0.00739969779f, 0.999164283f, 4.50091138e-05f,
+    0.728166044f, 0.444662631f, -0.00439369446f, 0.0071979682f, 0.999051392f, 6.81978054e-05f,
+    0.71029681f, 0.456487387f, -0.00450399332f, 0.00701103779f, 0.998921692f, 0.000101636906f,
+    0.68624866f, 0.463736266f, -0.00458203675f, 0.00678322604f, 0.998768032f, 0.000149173648f,
+    0.665051639f, 0.472208112f, -0.00466859248f, 0.00657784753f, 0.998587012f, 0.000215864115f,
+    0.642996073f, 0.479402542f, -0.00473558158f, 0.00635417132f, 0.998369992f, 0.000308285031f,
+    0.619909823f, 0.485097587f, -0.00479591219f, 0.00613134308f, 0.998105943f, 0.000434909714f,
+    0.597794116f, 0.490788907f, -0.00484840292f, 0.00590801379f, 0.997785151f, 0.000606557936f,
+    0.573375583f, 0.493764132f, -0.00488430774f, 0.00567428442f, 0.997390866f, 0.000836933265f,
+    0.551351607f, 0.497959107f, -0.00492157554f, 0.0054517258f, 0.996905327f, 0.00114325434f,
+    0.525986731f, 0.49821341f, -0.00493055675f, 0.0052078031f, 0.996303976f, 0.00154700072f,
+    0.504008889f, 0.500728369f, -0.00494576339f, 0.00498053804f, 0.995558321f, 0.0020747832f,
+    0.479723543f, 0.500005424f, -0.00493863272f, 0.00474066567f, 0.994633019f, 0.00275935745f,
+    0.455439299f, 0.498169422f, -0.00492171152f, 0.00450184569f, 0.993484259f, 0.00364078931f,
+    0.431576282f, 0.495646507f, -0.00490019238f, 0.00426901039f, 0.992060184f, 0.00476781465f,
+    0.40757978f, 0.491772801f, -0.00485971803f, 0.0040299953f, 0.990296721f, 0.00619937899f,
+    0.383776158f, 0.486837327f, -0.00481057959f, 0.00379444449f, 0.988117933f, 0.00800637994f,
+    0.359742582f, 0.480220228f, -0.00474341912f, 0.00355559262f, 0.985432267f, 0.0102736847f,
+    0.336309254f, 0.47291851f, -0.00467079645f, 0.00332368468f, 0.982129753f, 0.0131023787f,
+    0.312194049f, 0.463043034f, -0.00458220858f, 0.00309152505f, 0.978081405f, 0.0166122429f,
+    0.28958109f, 0.453686982f, -0.0044833757f, 0.00286379992f, 0.973132968f, 0.0209446177f,
+    0.266888678f, 0.442407995f, -0.00437423401f, 0.00264089275f, 0.967103839f, 0.0262653735f,
+    0.24425602f, 0.429235399f, -0.0042434046f, 0.00241674925f, 0.959779084f, 0.0327683501f,
+    0.222789302f, 0.41598925f, -0.00411275355f, 0.00220467546f, 0.950908363f, 0.0406789333f,
+    0.201817781f, 0.401440412f, -0.00396990171f, 0.00199784292f, 0.940198958f, 0.050257545f,
+    0.181179151f, 0.385088176f, -0.00380474259f, 0.00179214496f, 0.927307129f, 0.0618035421f,
+    0.161186561f, 0.367340684f, -0.00363408448f, 0.00159658561f, 0.911832869f, 0.0756585374f,
+    0.14257814f, 0.349854678f, -0.00345745822f, 0.00141100842f, 0.893311441f, 0.0922086388f,
+    0.123970129f, 0.329123676f, -0.00325597846f, 0.00122840458f, 0.871197045f, 0.111884892f,
+    0.107048586f, 0.309258968f, -0.0030586631f, 0.00106071681f, 0.844858408f, 0.135160387f,
+    0.0906775147f, 0.287046045f, -0.00283948518f, 0.000898957602f, 0.813557386f, 0.162538499f,
+    0.075525403f, 0.264191955f, -0.00261230418f, 0.000748751045f, 0.776426375f, 0.19452782f,
+    0.0615808181f, 0.240532443f, -0.00237557595f, 0.000610137882f, 0.732445717f, 0.231585473f,
+    0.0487479642f, 0.215459079f, -0.00212907488f, 0.000483692129f, 0.680401742f, 0.27399531f,
+    0.0372453779f, 0.189495683f, -0.00187094649f, 0.000369748799f, 0.618835509f, 0.321599692f,
+    0.0270352177f, 0.16205889f, -0.00160295656f, 0.000269532349f, 0.545986116f, 0.373192936f,
+    0.0184638277f, 0.134739831f, -0.00132993085f, 0.000184370045f, 0.459963232f, 0.425630629f,
+    0.011339888f, 0.105859928f, -0.00104443135f, 0.000113994414f, 0.358307958f, 0.469408423f,
+    0.00590175018f, 0.0765981227f, -0.000754951267f, 6.036989e-05f, 0.239744127f, 0.479151726f,
+    0.00219775457f, 0.0468636267f, -0.000460289768f, 2.39343735e-05f, 0.111883111f, 0.393296003f,
+    0.000324786379f, 0.0181170739f, -0.000182224045f, 6.18798595e-06f, 0.0172946658f, 0.134451658f,
+    1.0f, 0.0f, 0.0f, 0.0188483372f, 0.999998152f, 5.45305121e-13f,
+    0.998554885f, 0.0331141204f, -0.000486243429f, 0.0147516383f, 0.999996722f, 4.76519648e-13f,
+    0.997215331f, 0.055152256f, -0.000811319798f, 0.01472288f, 0.999992311f, 1.52572497e-12f,
+    0.994194448f, 0.0770617649f, -0.00113489095f, 0.0146795828f, 0.999983966f, 5.47577955e-12f,
+    0.989255488f, 0.0987354666f, -0.00145563844f, 0.0146146761f, 0.999970615f, 1.93923835e-11f,
+    0.984763622f, 0.120349452f, -0.00177484821f, 0.0145476647f, 0.999954879f, 6.91351074e-11f,
+    0.978775263f, 0.141682431f, -0.00209007552f, 0.0144602153f, 0.999935389f, 2.41290876e-10f,
+    0.972592533f, 0.162865803f, -0.00240232958f, 0.0143645564f, 0.999911487f, 7.92699739e-10f,
+    0.964578986f, 0.183603436f, -0.00270944042f, 0.0142504498f, 0.999883056f, 2.40007902e-09f,
+    0.956141412f, 0.204102993f, -0.00301174889f, 0.014123857f, 0.999851048f, 6.67120448e-09f,
+    0.947378695f, 0.224370733f, -0.00331036816f, 0.0139917731f, 0.999814928f, 1.71068706e-08f,
+    0.936327517f, 0.243883997f, -0.0035995373f, 0.0138323f, 0.999773741f, 4.07923828e-08f,
+    0.92451781f, 0.262948245f, -0.00388290058f, 0.0136640305f, 0.999728262f, 9.12119447e-08f,
+    0.912928522f, 0.281821549f, -0.00416011782f, 0.0134869469f, 0.999677241f, 1.92722382e-07f,
+    0.899192512f, 0.299774289f, -0.00442597223f, 0.0132864537f, 0.999620914f, 3.87394692e-07f,
+    0.885536194f, 0.317435175f, -0.00468717003f, 0.0130853904f, 0.999559343f, 7.45143552e-07f,
+    0.872005641f, 0.334862411f, -0.00494225463f, 0.0128793651f, 0.999490917f, 1.37830523e-06f,
+    0.855943203f, 0.350989223f, -0.00518156821f, 0.0126451282f, 0.999415994f, 2.46211494e-06f,
+    0.840615928f, 0.367056549f, -0.00541498326f, 0.0124098668f, 0.999333978f, 4.26284942e-06f,
+    0.822819352f, 0.381650954f, -0.0056357868f, 0.0121588241f, 0.999243736f, 7.17581815e-06f,
+    0.805114031f, 0.395842075f, -0.00584464893f, 0.0118956016f, 0.999143481f, 1.17757309e-05f,
+    0.787347615f, 0.409578055f, -0.00604607817f, 0.0116305565f, 0.999033153f, 1.88825015e-05f,
+    0.768015027f, 0.4220137f, -0.00623088051f, 0.0113469772f, 0.998909652f, 2.96461494e-05f,
+    0.748045564f, 0.433584392f, -0.00640165154f, 0.0110519789f, 0.998771608f, 4.56548223e-05f,
+    0.728232145f, 0.444698483f, -0.00656576175f, 0.0107592549f, 0.998614848f, 6.90707966e-05f,
+    0.707046807f, 0.454402417f, -0.00671146903f, 0.0104501098f, 0.998436511f, 0.000102800113f,
+    0.686248362f, 0.463745117f, -0.00685073622f, 0.0101446453f, 0.998231471f, 0.000150701642f,
+    0.665300548f, 0.47238934f, -0.00697245635f, 0.00982670952f, 0.997992456f, 0.000217843422f,
+    0.642682254f, 0.479167551f, -0.00707456283f, 0.00949540548f, 0.997713208f, 0.000310814445f,
+    0.619840443f, 0.48503533f, -0.0071642478f, 0.0091619594f, 0.997381628f, 0.000438097486f,
+    0.59727174f, 0.490361214f, -0.00724016782f, 0.00882530212f, 0.99698633f, 0.000610519084f,
+    0.574231386f, 0.49450323f, -0.00730111869f, 0.00848478451f, 0.996510863f, 0.000841783651f,
+    0.550914407f, 0.497556955f, -0.00734412344f, 0.00813804101f, 0.9959355f, 0.0011490999f,
+    0.52744329f, 0.499590069f, -0.00737348665f, 0.00779090263f, 0.995236278f, 0.00155392522f,
+    0.503152132f, 0.499874443f, -0.00738030067f, 0.00743501307f, 0.994382322f, 0.00208282098f,
+    0.479424745f, 0.499685496f, -0.00737676769f, 0.0070839026f, 0.993337274f, 0.00276847021f,
+    0.45494321f, 0.497621745f, -0.00734754466f, 0.00672358647f, 0.992057323f, 0.0036508115f,
+    0.431707621f, 0.495793372f, -0.00731682871f, 0.00637723412f, 0.990486324f, 0.00477839913f,
+    0.407169759f, 0.491260588f, -0.00725256186f, 0.00601717783f, 0.988560557f, 0.00620989641f,
+    0.383223236f, 0.486127436f, -0.00717916992f, 0.00566562219f, 0.986200213f, 0.00801580306f,
+    0.359225333f, 0.479519397f, -0.0070822211f, 0.00531164929f, 0.983312607f, 0.0102804368f,
+    0.335922629f, 0.472369134f, -0.00697366055f, 0.00496533839f, 0.979783714f, 0.0131040467f,
+    0.31263724f, 0.463698506f, -0.00684448797f, 0.00462081889f, 0.975481093f, 0.0166052897f,
+    0.289224774f, 0.453118235f, -0.0066935611f, 0.0042785788f, 0.970246911f, 0.0209238771f,
+    0.266725689f, 0.442132771f, -0.00653074821f, 0.00394588802f, 0.963894188f, 0.02622349f,
+    0.244673625f, 0.429961056f, -0.00634664809f, 0.0036176655f, 0.956201613f, 0.0326947272f,
+    0.222911075f, 0.416204959f, -0.00614462607f, 0.00329696387f, 0.946912944f, 0.0405584425f,
+    0.201836139f, 0.401458442f, -0.00592673616f, 0.00298573636f, 0.935724974f, 0.0500687473f,
+    0.181132033f, 0.384955704f, -0.00568662351f, 0.0026817196f, 0.922283411f, 0.0615157634f,
+    0.161362827f, 0.367728859f, -0.00542922737f, 0.00238845078f, 0.906174004f, 0.0752276182f,
+    0.142300829f, 0.349155992f, -0.00515880343f, 0.0021085809f, 0.886913478f, 0.0915705934f,
+    0.124277592f, 0.329908878f, -0.00486954814f, 0.00184047106f, 0.863935053f, 0.110946089f,
+    0.107100524f, 0.309376866f, -0.00456499401f, 0.00158648088f, 0.836577237f, 0.133780777f,
+    0.09064468f, 0.286901265f, -0.00423764111f, 0.0013450929f, 0.804062366f, 0.160504386f,
+    0.0755984113f, 0.264406085f, -0.00390143041f, 0.00112190738f, 0.765474021f, 0.191503286f,
+    0.0615726449f, 0.240458041f, -0.00354617718f, 0.000914718024f, 0.71973145f, 0.227025911f,
+    0.0487303995f, 0.215313837f, -0.00317604933f, 0.00072560698f, 0.665704906f, 0.267185509f,
+    0.0372001305f, 0.189194843f, -0.00279118121f, 0.000555504754f, 0.601963043f, 0.311575145f,
+    0.0271537155f, 0.162668705f, -0.00239589321f, 0.000406586973f, 0.526583254f, 0.358123988f,
+    0.0185084045f, 0.134929791f, -0.00198446098f, 0.000278929045f, 0.437635213f, 0.401931375f,
+    0.0114092333f, 0.106299184f, -0.00156143971f, 0.000174544795f, 0.33363831f, 0.431384712f,
+    0.00597543688f, 0.0771874264f, -0.00113083143f, 9.4780371e-05f, 0.216237009f, 0.421336055f,
+    0.00229936722f, 0.0482073724f, -0.000700931472f, 4.10904722e-05f, 0.0980144888f, 0.323023379f,
+    0.000432043482f, 0.0207985342f, -0.000319302402f, 1.66496302e-05f, 0.0194033682f, 0.111907423f,
+    1.0f, 0.0f, 0.0f, 0.0237072408f, 0.999994457f, 1.62699368e-11f,
+    0.998936117f, 0.0331261121f, -0.000677892473f, 0.0206066016f, 0.999992251f, 1.04081075e-11f,
+    0.997270107f, 0.0551537275f, -0.00113198685f, 0.0205671173f, 0.999985754f, 1.69740021e-11f,
+    0.993824005f, 0.077034913f, -0.00158372789f, 0.0205037054f, 0.999973297f, 4.14855546e-11f,
+    0.990257144f, 0.0988344103f, -0.00203283899f, 0.0204246081f, 0.999956071f, 1.04043781e-10f,
+    0.985225499f, 0.120402344f, -0.00247812178f, 0.0203246009f, 0.999933958f, 2.58019467e-10f,
+    0.979249418f, 0.141746566f, -0.00291885622f, 0.0202050321f, 0.999906301f, 6.41725451e-10f,
+    0.972913682f, 0.162921205f, -0.00335524441f, 0.0200721882f, 0.999872446f, 1.60387714e-09f,
+    0.965159416f, 0.183722764f, -0.00378365372f, 0.0199091863f, 0.999833941f, 3.97722877e-09f,
+    0.956492484f, 0.204176396f, -0.00420635985f, 0.0197342541f, 0.999789119f, 9.62425251e-09f,
+    0.94690001f, 0.22425133f, -0.00462074997f, 0.0195379164f, 0.999737799f, 2.24465495e-08f,
+    0.936582625f, 0.243944719f, -0.00502628228f, 0.0193221811f, 0.999679983f, 5.01392492e-08f,
+    0.924912214f, 0.26306054f, -0.00542179542f, 0.0190862734f, 0.999616385f, 1.07086954e-07f,
+    0.912879288f, 0.281814575f, -0.00580839394f, 0.0188371222f, 0.999545276f, 2.18939064e-07f,
+    0.900160849f, 0.300094932f, -0.0061841514f, 0.0185706783f, 0.999466598f, 4.29576858e-07f,
+    0.886428118f, 0.317756444f, -0.00654804055f, 0.0182865597f, 0.999380171f, 8.11390066e-07f,
+    0.871564388f, 0.334691375f, -0.00689821551f, 0.017982468f, 0.999285996f, 1.48003141e-06f,
+    0.855730176f, 0.350899845f, -0.00723475218f, 0.0176615361f, 0.999182045f, 2.61508944e-06f,
+    0.839483082f, 0.366559386f, -0.00755851064f, 0.0173280295f, 0.999067485f, 4.48844821e-06f,
+    0.822578967f, 0.381540298f, -0.0078670308f, 0.0169782154f, 0.998942018f, 7.50250865e-06f,
+    0.805253804f, 0.395909011f, -0.00816140138f, 0.016616445f, 0.998803616f, 1.2240811e-05f,
+    0.787247896f, 0.409521013f, -0.00844175462f, 0.0162445344f, 0.998651862f, 1.95340726e-05f,
+    0.768247783f, 0.422142327f, -0.00870155264f, 0.0158517696f, 0.998483419f, 3.05452631e-05f,
+    0.748473883f, 0.433827311f, -0.00894338638f, 0.0154455695f, 0.99829638f, 4.68777944e-05f,
+    0.728597939f, 0.444917291f, -0.00917018205f, 0.0150325475f, 0.998086631f, 7.07116196e-05f,
+    0.707504392f, 0.454693586f, -0.00937637221f, 0.0146049773f, 0.997850597f, 0.000104972729f,
+    0.686550021f, 0.463944852f, -0.00956479553f, 0.0141691351f, 0.997582197f, 0.000153542074f,
+    0.664900124f, 0.472096324f, -0.00973318424f, 0.013723094f, 0.997274756f, 0.00022151148f,
+    0.642961681f, 0.479373068f, -0.00988135766f, 0.0132681997f, 0.996919811f, 0.000315493613f,
+    0.620284915f, 0.485382885f, -0.0100065758f, 0.012802423f, 0.996506691f, 0.000443994155f,
+    0.597589016f, 0.490615636f, -0.0101116784f, 0.0123311253f, 0.996021092f, 0.000617860293f,
+    0.574344635f, 0.494589567f, -0.0101938453f, 0.0118521694f, 0.995447159f, 0.00085080805f,
+    0.550739348f, 0.497398615f, -0.0102536064f, 0.0113678072f, 0.994763494f, 0.00116004935f,
+    0.527414262f, 0.499555767f, -0.0102965999f, 0.0108853187f, 0.993945241f, 0.00156702264f,
+    0.503507912f, 0.500213981f, -0.0103079779f, 0.0103902891f, 0.992960453f, 0.00209824904f,
+    0.47930336f, 0.499549806f, -0.0102984831f, 0.00989559013f, 0.991771102f, 0.0027863218f,
+    0.45556581f, 0.498290032f, -0.0102695478f, 0.00940348394f, 0.990331292f, 0.00367104495f,
+    0.431340665f, 0.495357633f, -0.0102122333f, 0.00890695211f, 0.988583505f, 0.0048007411f,
+    0.407145441f, 0.491223782f, -0.0101283528f, 0.008409339f, 0.986460507f, 0.00623373734f,
+    0.383319467f, 0.486229926f, -0.0100232f, 0.00791637227f, 0.983881474f, 0.00804004446f,
+    0.359383017f, 0.479713231f, -0.00989342947f, 0.00742645329f, 0.980748773f, 0.0103032393f,
+    0.335671663f, 0.471999258f, -0.00973680336f, 0.00693922862f, 0.976947308f, 0.0131225316f,
+    0.31247133f, 0.463430673f, -0.00955560803f, 0.0064577437f, 0.97233808f, 0.0166151337f,
+    0.289536655f, 0.45358032f, -0.00935161673f, 0.00598435337f, 0.966757357f, 0.020918658f,
+    0.266862482f, 0.442328542f, -0.00912001729f, 0.00551716797f, 0.960014105f, 0.0261937696f,
+    0.244659171f, 0.42990616f, -0.0088618705f, 0.0050583398f, 0.951879561f, 0.0326269642f,
+    0.222875789f, 0.416111231f, -0.00857898593f, 0.00461025443f, 0.942087471f, 0.0404328927f,
+    0.201862052f, 0.401477396f, -0.00827387907f, 0.00417544832f, 0.930322826f, 0.0498569347f,
+    0.181181163f, 0.385026842f, -0.00793992821f, 0.0037518274f, 0.916217685f, 0.0611760356f,
+    0.161555961f, 0.36812833f, -0.00758469524f, 0.00334443757f, 0.899338722f, 0.0746982545f,
+    0.142437294f, 0.349449545f, -0.00720003434f, 0.00295099616f, 0.879175782f, 0.0907583535f,
+    0.124365106f, 0.330091059f, -0.00680035399f, 0.00257883035f, 0.85513407f, 0.109706543f,
+    0.107045427f, 0.309162319f, -0.00636950089f, 0.00222292426f, 0.826517344f, 0.131887868f,
+    0.0907970965f, 0.287324309f, -0.00591809582f, 0.0018877628f, 0.792772591f, 0.157822445f,
+    0.0755648762f, 0.264199555f, -0.00544380723f, 0.00157431141f, 0.752841949f, 0.187778264f,
+    0.0616067015f, 0.240499094f, -0.00495134993f, 0.00128557766f, 0.705543518f, 0.221822307f,
+    0.0488035753f, 0.215519309f, -0.00443533808f, 0.00102149253f, 0.649583042f, 0.259682834f,
+    0.0372952409f, 0.189538598f, -0.00389980618f, 0.000784636009f, 0.583470047f, 0.300286055f,
+    0.0271758623f, 0.16261448f, -0.00334292022f, 0.0005762449f, 0.505593181f, 0.340920925f,
+    0.0185586363f, 0.135018691f, -0.00277059153f, 0.00039900915f, 0.414550155f, 0.375581622f,
+    0.0115097938f, 0.106826738f, -0.00218313653f, 0.000253788283f, 0.310477048f, 0.392930329f,
+    0.00611320836f, 0.07823883f, -0.00159053702f, 0.000143366662f, 0.197054461f, 0.369273216f,
+    0.00244972156f, 0.0498478971f, -0.00100885332f, 7.00032178e-05f, 0.0899580121f, 0.26994133f,
+    0.000615764759f, 0.0244887937f, -0.000537779997f, 4.13801245e-05f, 0.0234351866f, 0.100506559f,
+    1.0f, 0.0f, 0.0f, 0.0298726298f, 0.999985278f, 2.72172979e-10f,
+    0.998878777f, 0.0331216082f, -0.000900878571f, 0.0274361949f, 0.999982834f, 1.71176379e-10f,
+    0.996923268f, 0.0551351644f, -0.00150530261f, 0.0273821428f, 0.999973714f, 1.8024604e-10f,
+    0.993852139f, 0.0770359486f, -0.00210692151f, 0.0273013413f, 0.999957979f, 3.05689529e-10f,
+    0.990132213f, 0.0988209918f, -0.00270487391f, 0.027196439f, 0.999934793f, 6.0439842e-10f,
+    0.985225141f, 0.120406359f, -0.00329766469f, 0.0270630103f, 0.99990499f, 1.21121391e-09f,
+    0.979535222f, 0.141788304f, -0.00388465612f, 0.0269054528f, 0.999867737f, 2.40826625e-09f,
+    0.972717464f, 0.162890807f, -0.00446409779f, 0.0267192218f, 0.999823153f, 4.77917173e-09f,
+    0.964816391f, 0.183654845f, -0.00503529655f, 0.0265076607f, 0.99977082f, 9.52532719e-09f,
+    0.95656395f, 0.20419243f, -0.00559794297f, 0.0262745935f, 0.999711156f, 1.90710203e-08f,
+    0.946962833f, 0.224266559f, -0.00614935672f, 0.0260124058f, 0.999643087f, 3.8152951e-08f,
+    0.93642652f, 0.243905321f, -0.00668897619f, 0.0257245544f, 0.999567032f, 7.56784928e-08f,
+    0.925046861f, 0.263096511f, -0.00721633341f, 0.0254137572f, 0.999481857f, 1.47753511e-07f,
+    0.91310674f, 0.281882226f, -0.00773088867f, 0.0250818562f, 0.999387085f, 2.82419052e-07f,
+    0.900118887f, 0.300084025f, -0.0082304934f, 0.0247254446f, 0.999282181f, 5.26815711e-07f,
+    0.886339903f, 0.317726374f, -0.00871461164f, 0.0243465863f, 0.999167085f, 9.57692009e-07f,
+    0.871412337f, 0.334635943f, -0.00918058958f, 0.0239416379f, 0.999040961f, 1.69642374e-06f,
+    0.855907679f, 0.350973219f, -0.00962956715f, 0.0235171095f, 0.998902082f, 2.9299847e-06f,
+    0.840104759f, 0.36682722f, -0.0100632152f, 0.0230793748f, 0.998750567f, 4.93965717e-06f,
+    0.82291609f, 0.381690949f, -0.0104730232f, 0.0226115771f, 0.998583734f, 8.13956922e-06f,
+    0.80502671f, 0.395796359f, -0.0108624715f, 0.0221250299f, 0.998401225f, 1.31277311e-05f,
+    0.787021816f, 0.409397036f, -0.0112331631f, 0.0216253493f, 0.998200655f, 2.07523426e-05f,
+    0.768150866f, 0.422083527f, -0.0115805939f, 0.021105919f, 0.997979105f, 3.21973203e-05f,
+    0.748634577f, 0.433917791f, -0.0119049661f, 0.020569738f, 0.997735143f, 4.90905659e-05f,
+    0.728435159f, 0.444813281f, -0.0122049144f, 0.0200168695f, 0.99746263f, 7.36403381e-05f,
+    0.707707763f, 0.454815775f, -0.0124796573f, 0.0194483735f, 0.997157037f, 0.000108804605f,
+    0.686633885f, 0.463996589f, -0.0127303069f, 0.0188682191f, 0.996814728f, 0.000158499708f,
+    0.664850712f, 0.472054422f, -0.0129519105f, 0.0182711463f, 0.996425986f, 0.000227855373f,
+    0.642706513f, 0.479173392f, -0.0131482612f, 0.0176648796f, 0.995982826f, 0.000323522952f,
+    0.620283723f, 0.485371739f, -0.0133182034f, 0.017049551f, 0.995472074f, 0.000454047258f,
+    0.597396791f, 0.490443885f, -0.0134561565f, 0.0164200645f, 0.994880736f, 0.000630310329f,
+    0.574296117f, 0.494538426f, -0.013568202f, 0.0157860499f, 0.994190335f, 0.000866053102f,
+    0.550731421f, 0.497375876f, -0.0136478143f, 0.0151415905f, 0.993378997f, 0.00117849722f,
+    0.527267873f, 0.499397576f, -0.013700028f, 0.0144943297f, 0.992420137f, 0.00158907217f,
+    0.503342986f, 0.500032425f, -0.0137191853f, 0.0138399331f, 0.991280138f, 0.00212424272f,
+    0.479319811f, 0.49954474f, -0.0137079712f, 0.0131831327f, 0.989918888f, 0.00281650131f,
+    0.455453128f, 0.49814561f, -0.0136659024f, 0.0125250993f, 0.988289237f, 0.00370546547f,
+    0.431438923f, 0.495447636f, -0.0135907475f, 0.0118655553f, 0.986330867f, 0.00483915582f,
+    0.407332242f, 0.49141717f, -0.0134807453f, 0.0112049477f, 0.983974457f, 0.00627544057f,
+    0.383261561f, 0.486129135f, -0.0133401491f, 0.0105486028f, 0.981134415f, 0.00808361545f,
+    0.359408855f, 0.479716152f, -0.0131631335f, 0.00989361946f, 0.977709591f, 0.0103462245f,
+    0.335885584f, 0.472266823f, -0.0129576223f, 0.00924777053f, 0.973579705f, 0.0131609887f,
+    0.312664509f, 0.463682592f, -0.0127198137f, 0.00860963203f, 0.96860075f, 0.0166428164f,
+    0.289577365f, 0.453607112f, -0.0124414694f, 0.00797555596f, 0.962601602f, 0.0209259856f,
+    0.267056495f, 0.442609578f, -0.0121364957f, 0.00735644111f, 0.955381453f, 0.0261661205f,
+    0.244618461f, 0.429788888f, -0.0117915869f, 0.00674569979f, 0.946698308f, 0.0325416997f,
+    0.222959951f, 0.416215062f, -0.0114142327f, 0.0061497991f, 0.936270297f, 0.040254958f,
+    0.201879084f, 0.401458144f, -0.0110059194f, 0.00557121309f, 0.923762321f, 0.0495310798f,
+    0.181382015f, 0.385391533f, -0.0105627039f, 0.00500968751f, 0.908784568f, 0.0606158078f,
+    0.1616918f, 0.36836645f, -0.0100924177f, 0.00446883263f, 0.891125619f, 0.0738902539f,
+    0.142571703f, 0.349698335f, -0.00958309323f, 0.00394559279f, 0.870190144f, 0.0896707103f,
+    0.124444567f, 0.330215871f, -0.00904432684f, 0.00344676361f, 0.845278382f, 0.108251937f,
+    0.10713581f, 0.309321016f, -0.00847498979f, 0.00297354721f, 0.815683901f, 0.12995854f,
+    0.0908918455f, 0.287500322f, -0.00787605532f, 0.00252805185f, 0.780578911f, 0.155068994f,
+    0.0757176578f, 0.264603615f, -0.00724627264f, 0.00211172388f, 0.73899734f, 0.183741748f,
+    0.0616896302f, 0.240650773f, -0.00658578938f, 0.00172665925f, 0.689823329f, 0.215880707f,
+    0.04888881f, 0.215712234f, -0.005899054f, 0.00137607916f, 0.631790757f, 0.250885695f,
+    0.0374213606f, 0.18993701f, -0.00518613541f, 0.00106193731f, 0.563545704f, 0.287197262f,
+    0.0273526739f, 0.163332582f, -0.00444758823f, 0.00078588695f, 0.484000087f, 0.3217915f,
+    0.0187000595f, 0.135586157f, -0.00368646276f, 0.000549933931f, 0.392571509f, 0.348839939f,
+    0.0116980234f, 0.107849635f, -0.00291655608f, 0.000358638325f, 0.290031731f, 0.356030762f,
+    0.00633947784f, 0.0799132064f, -0.00214808527f, 0.000214198895f, 0.182517946f, 0.323719054f,
+    0.00271481881f, 0.0526669882f, -0.00141323486f, 0.000120057673f, 0.0865551084f, 0.230698287f,
+    0.000917907164f, 0.0296687465f, -0.000879352388f, 9.41683611e-05f, 0.0289033093f, 0.0948485583f,
+    1.0f, 0.0f, 0.0f, 0.0371651202f, 0.999966323f, 2.89650659e-09f,
+    0.99879688f, 0.0331176631f, -0.00115549611f, 0.0352404639f, 0.999963522f, 1.92903027e-09f,
+    0.996987641f, 0.055138763f, -0.00193185662f, 0.0351740867f, 0.999951959f, 1.6852304e-09f,
+    0.994086087f, 0.0770538896f, -0.00270466646f, 0.0350723006f, 0.999931157f, 2.11641593e-09f,
+    0.990111828f, 0.098820217f, -0.00347209815f, 0.0349319689f, 0.99990201f, 3.34563777e-09f,
+    0.985377133f, 0.120423436f, -0.00423391815f, 0.0347654782f, 0.999863207f, 5.70641623e-09f,
+    0.979444683f, 0.141777083f, -0.00498721143f, 0.0345590562f, 0.999815464f, 9.83903714e-09f,
+    0.972736239f, 0.162891045f, -0.00573176658f, 0.0343227386f, 0.999758482f, 1.68906027e-08f,
+    0.965033531f, 0.183695763f, -0.00646528928f, 0.034050867f, 0.999691188f, 2.88989828e-08f,
+    0.956478298f, 0.204173848f, -0.00718713086f, 0.0337482095f, 0.999614477f, 4.94918879e-08f,
+    0.946835339f, 0.224233925f, -0.00789482612f, 0.0334100351f, 0.99952662f, 8.50996358e-08f,
+    0.93634522f, 0.243883669f, -0.00858824234f, 0.0330425575f, 0.999428272f, 1.46971828e-07f,
+    0.925188959f, 0.263135165f, -0.00926626753f, 0.0326466113f, 0.99931848f, 2.54402238e-07f,
+    0.913075864f, 0.28187272f, -0.00992664415f, 0.0322191603f, 0.999196351f, 4.39702717e-07f,
+    0.900062501f, 0.300060958f, -0.0105679072f, 0.0317607112f, 0.999060869f, 7.55651399e-07f,
+    0.886097908f, 0.317635059f, -0.0111885266f, 0.0312715545f, 0.99891299f, 1.28632678e-06f,
+    0.871526301f, 0.334673792f, -0.0117883477f, 0.030755708f, 0.998749793f, 2.1625026e-06f,
+    0.856019258f, 0.35101226f, -0.0123652909f, 0.0302117579f, 0.998571575f, 3.58303737e-06f,
+    0.839817047f, 0.36669752f, -0.0129177701f, 0.0296398401f, 0.998376071f, 5.84400732e-06f,
+    0.822982311f, 0.381716281f, -0.013447023f, 0.0290463604f, 0.998162687f, 9.37775894e-06f,
+    0.805317044f, 0.395934284f, -0.0139475344f, 0.0284228921f, 0.997928262f, 1.48043164e-05f,
+    0.786988616f, 0.40937537f, -0.0144224688f, 0.0277795419f, 0.997671068f, 2.29982925e-05f,
+    0.767989099f, 0.421989739f, -0.0148674641f, 0.0271109249f, 0.997388065f, 3.51745293e-05f,
+    0.748445749f, 0.433800548f, -0.0152831404f, 0.0264215358f, 0.997076035f, 5.29969257e-05f,
+    0.728404939f, 0.444786757f, -0.0156690795f, 0.0257135667f, 0.996730983f, 7.87144891e-05f,
+    0.707642615f, 0.454764843f, -0.0160211753f, 0.0249831285f, 0.996347427f, 0.000115330848f,
+    0.686554968f, 0.463928252f, -0.0163443387f, 0.0242407676f, 0.99591732f, 0.000166811529f,
+    0.664800346f, 0.472004592f, -0.0166288819f, 0.0234746095f, 0.995433629f, 0.000238338485f,
+    0.642835736f, 0.479256421f, -0.0168816559f, 0.0226975735f, 0.994886816f, 0.000336615689f,
+    0.620357931f, 0.485407144f, -0.0170982052f, 0.021905873f, 0.99426204f, 0.000470236468f,
+    0.59748596f, 0.490498126f, -0.0172774885f, 0.0211008806f, 0.993546128f, 0.000650122995f,
+    0.574364007f, 0.494572341f, -0.01741983f, 0.0202855151f, 0.992718935f, 0.000890040305f,
+    0.550869942f, 0.497480005f, -0.017523136f, 0.0194598753f, 0.991756141f, 0.00120720768f,
+    0.527330577f, 0.499435872f, -0.0175883621f, 0.0186274499f, 0.99063015f, 0.00162299932f,
+    0.503398538f, 0.500064909f, -0.0176109001f, 0.0177858602f, 0.9893049f, 0.00216376572f,
+    0.479481399f, 0.499690026f, -0.0175986402f, 0.0169454403f, 0.987738788f, 0.00286176242f,
+    0.455384463f, 0.498040974f, -0.0175410509f, 0.0160980932f, 0.985880375f, 0.00375621859f,
+    0.431439579f, 0.495417029f, -0.0174459964f, 0.0152535718f, 0.983665764f, 0.00489449408f,
+    0.407346576f, 0.491403669f, -0.017304752f, 0.0144064035f, 0.981019497f, 0.00633338839f,
+    0.383450359f, 0.486328036f, -0.0171239115f, 0.01356465f, 0.977851808f, 0.00814050436f,
+    0.359722376f, 0.480096102f, -0.0168993976f, 0.0127272084f, 0.974053025f, 0.0103955902f,
+    0.336142182f, 0.472581089f, -0.016631037f, 0.0118963849f, 0.969490588f, 0.0131918378f,
+    0.312598258f, 0.463532597f, -0.0163154807f, 0.0110723646f, 0.964008212f, 0.0166368205f,
+    0.289588988f, 0.453562856f, -0.0159620605f, 0.0102639953f, 0.957419157f, 0.0208533425f,
+    0.267181903f, 0.442754686f, -0.0155692957f, 0.00947093591f, 0.949590325f, 0.0260020718f,
+    0.244871929f, 0.430164576f, -0.0151274502f, 0.00868657324f, 0.940480173f, 0.0323227271f,
+    0.223115116f, 0.416433722f, -0.01464736f, 0.00792282075f, 0.929585397f, 0.0399681516f,
+    0.201988831f, 0.401592255f, -0.0141238254f, 0.00717880065f, 0.916573167f, 0.0491649844f,
+    0.181494191f, 0.385532916f, -0.013558995f, 0.00645781215f, 0.901054561f, 0.0601646043f,
+    0.16170992f, 0.368303776f, -0.0129501913f, 0.00576083874f, 0.882569671f, 0.0732396841f,
+    0.142740473f, 0.349992514f, -0.0123037919f, 0.00509297941f, 0.860587955f, 0.0886765867f,
+    0.124655448f, 0.33063516f, -0.0116158444f, 0.00445468212f, 0.834483087f, 0.106759593f,
+    0.107310869f, 0.309674084f, -0.0108803008f, 0.00384625071f, 0.803530812f, 0.127742618f,
+    0.0910847485f, 0.287929028f, -0.0101100979f, 0.00327498559f, 0.766888916f, 0.151797459f,
+    0.0758944303f, 0.26501292f, -0.00930041634f, 0.00274154614f, 0.723595023f, 0.178923458f,
+    0.0619139485f, 0.241267532f, -0.00845358986f, 0.00224922947f, 0.672578037f, 0.208794221f,
+    0.0491474271f, 0.216516733f, -0.00756911514f, 0.00180000055f, 0.61280036f, 0.240620121f,
+    0.0376426056f, 0.190628365f, -0.00665557431f, 0.00139695429f, 0.543394983f, 0.27302739f,
+    0.0275861062f, 0.164184257f, -0.00571768126f, 0.00104411889f, 0.463277906f, 0.3024275f,
+    0.0190179553f, 0.137117624f, -0.00475439988f, 0.000744231394f, 0.372253329f, 0.322052211f,
+    0.0120242499f, 0.109675258f, -0.00378066488f, 0.000500997005f, 0.272885412f, 0.321404696f,
+    0.00670951232f, 0.0825898498f, -0.00282372697f, 0.000319083832f, 0.17253609f, 0.285178632f,
+    0.00312794093f, 0.0567761101f, -0.00194729795f, 0.000205629214f, 0.0867097825f, 0.201591596f,
+    0.00136736012f, 0.0359049663f, -0.00137988024f, 0.000194778258f, 0.0355292857f, 0.0922168344f,
+    1.0f, 0.0f, 0.0f, 0.0455758758f, 0.999928236f, 2.12784723e-08f,
+    0.998882651f, 0.0331209153f, -0.00144254952f, 0.0440220907f, 0.999925435f, 1.51298529e-08f,
+    0.996884644f, 0.0551324449f, -0.00241201138f, 0.0439375266f, 0.999910653f, 1.25450921e-08f,
+    0.994056404f, 0.077052027f, -0.00337711885f, 0.0438108183f, 0.999885499f, 1.31695277e-08f,
+    0.990124702f, 0.0988195986f, -0.00433583744f, 0.0436391346f, 0.999848664f, 1.71538801e-08f,
+    0.985282898f, 0.120411448f, -0.00528663443f, 0.0434260778f, 0.999800682f, 2.52047361e-08f,
+    0.979513168f, 0.141784102f, -0.00622795383f, 0.0431729704f, 0.999740958f, 3.87165784e-08f,
+    0.972673833f, 0.162878022f, -0.00715695787f, 0.042872861f, 0.999669611f, 6.00348997e-08f,
+    0.965095818f, 0.183704138f, -0.00807385892f, 0.0425385609f, 0.999585211f, 9.29340729e-08f,
+    0.956405461f, 0.204156965f, -0.0089743305f, 0.0421560556f, 0.999488771f, 1.43447124e-07f,
+    0.946937323f, 0.224255547f, -0.00985903759f, 0.041738335f, 0.999378443f, 2.21249422e-07f,
+    0.936555982f, 0.243936628f, -0.0107256826f, 0.0412823446f, 0.999254525f, 3.41887898e-07f,
+    0.925212801f, 0.263138354f, -0.0115709025f, 0.0407826044f, 0.999116898f, 5.30269403e-07f,
+    0.913037837f, 0.281855494f, -0.0123953344f, 0.0402485728f, 0.998963535f, 8.25949371e-07f,
+    0.900047183f, 0.300050557f, -0.0131955752f, 0.039674975f, 0.998794675f, 1.29093974e-06f,
+    0.886257946f, 0.317686081f, -0.0139720775f, 0.0390690602f, 0.998607099f, 2.02095066e-06f,
+    0.871494532f, 0.334657013f, -0.0147196576f, 0.0384215303f, 0.998402774f, 3.16124783e-06f,
+    0.856152415f, 0.351061016f, -0.0154408496f, 0.0377447531f, 0.998177528f, 4.92850131e-06f,
+    0.83993119f, 0.366741568f, -0.0161310639f, 0.0370318629f, 0.997932255f, 7.64046035e-06f,
+    0.823040962f, 0.381734461f, -0.0167908818f, 0.0362890661f, 0.997663677f, 1.17554027e-05f,
+    0.805456877f, 0.395991355f, -0.0174171887f, 0.0355139375f, 0.997368634f, 1.79240469e-05f,
+    0.787029266f, 0.409385026f, -0.0180079509f, 0.0347067751f, 0.997046471f, 2.70566306e-05f,
+    0.768153787f, 0.422066838f, -0.0185646769f, 0.0338746868f, 0.996691942f, 4.04088569e-05f,
+    0.748600364f, 0.433875471f, -0.0190836024f, 0.0330144688f, 0.996301949f, 5.96900427e-05f,
+    0.728566945f, 0.444870621f, -0.0195653625f, 0.0321310125f, 0.995871246f, 8.71990051e-05f,
+    0.707771003f, 0.454830974f, -0.0200042371f, 0.0312186349f, 0.995393276f, 0.000125991137f,
+    0.686612725f, 0.463950455f, -0.020404527f, 0.0302879121f, 0.994860113f, 0.000180083895f,
+    0.664927661f, 0.472077727f, -0.0207608603f, 0.0293340255f, 0.994263828f, 0.000254705228f,
+    0.642856181f, 0.479251504f, -0.0210753623f, 0.028363537f, 0.993591905f, 0.000356592995f,
+    0.620410919f, 0.485430837f, -0.0213448796f, 0.0273752697f, 0.99282968f, 0.000494349049f,
+    0.597500384f, 0.490480661f, -0.0215656515f, 0.0263678711f, 0.991960585f, 0.000678860059f,
+    0.574396908f, 0.49457404f, -0.0217430666f, 0.0253513157f, 0.990962863f, 0.000923780841f,
+    0.550969481f, 0.497537971f, -0.0218724385f, 0.0243228376f, 0.989808857f, 0.00124609144f,
+    0.527272463f, 0.499344975f, -0.0219521523f, 0.0232838299f, 0.98846662f, 0.00166671968f,
+    0.503482401f, 0.500111282f, -0.02198001f, 0.0222352967f, 0.986895204f, 0.00221121963f,
+    0.479578048f, 0.499746114f, -0.0219612718f, 0.02118567f, 0.985046566f, 0.0029104813f,
+    0.455503404f, 0.498127252f, -0.0218845811f, 0.0201269928f, 0.98285836f, 0.00380144059f,
+    0.431541741f, 0.495486856f, -0.0217635632f, 0.0190752f, 0.98025918f, 0.00492774183f,
+    0.407570958f, 0.491621286f, -0.0215826854f, 0.0180194415f, 0.977162004f, 0.00634043012f,
+    0.383569777f, 0.48642084f, -0.021354096f, 0.0169700962f, 0.97358501f, 0.00811852328f,
+    0.35972625f, 0.480037063f, -0.0210747309f, 0.0159240626f, 0.969545543f, 0.0103696836f,
+    0.336241812f, 0.4726533f, -0.0207456052f, 0.0148894293f, 0.964731097f, 0.0131637836f,
+    0.312932163f, 0.463950425f, -0.0203631055f, 0.0138661163f, 0.958988369f, 0.0166118294f,
+    0.289832473f, 0.45385924f, -0.0199218281f, 0.0128532965f, 0.952138007f, 0.020842813f,
+    0.267240793f, 0.442758769f, -0.019430887f, 0.0118598677f, 0.943967581f, 0.0260054432f,
+    0.244965792f, 0.430229068f, -0.0188818704f, 0.0108832819f, 0.934227049f, 0.0322695449f,
+    0.223348156f, 0.416746974f, -0.018284237f, 0.00993187074f, 0.922622204f, 0.039826639f,
+    0.202173486f, 0.401825428f, -0.0176262483f, 0.00900194608f, 0.908808112f, 0.0488895401f,
+    0.181681395f, 0.385787636f, -0.0169234425f, 0.00810444728f, 0.892382443f, 0.0596898124f,
+    0.161853313f, 0.36846301f, -0.0161617603f, 0.0072351573f, 0.872872531f, 0.0724714473f,
+    0.142848954f, 0.35007602f, -0.0153524345f, 0.00640227739f, 0.849730134f, 0.0874790624f,
+    0.124757595f, 0.33069405f, -0.0144844623f, 0.00560413906f, 0.8223207f, 0.104936071f,
+    0.107548594f, 0.310106456f, -0.0135738617f, 0.00485018687f, 0.789916098f, 0.125008449f,
+    0.0912949443f, 0.288308114f, -0.0126051037f, 0.00413771672f, 0.751695335f, 0.147744715f,
+    0.0761719123f, 0.265643299f, -0.011595143f, 0.00347465556f, 0.706885099f, 0.173097819f,
+    0.0621668883f, 0.241851985f, -0.0105455071f, 0.00286193471f, 0.654738426f, 0.200910747f,
+    0.0493948087f, 0.217105657f, -0.0094493553f, 0.00230245525f, 0.593992949f, 0.230016485f,
+    0.0379499048f, 0.191528574f, -0.00831589103f, 0.00180122419f, 0.523804247f, 0.258521855f,
+    0.0279544014f, 0.165494367f, -0.00715646055f, 0.00136478955f, 0.443560004f, 0.282416195f,
+    0.019419333f, 0.138789788f, -0.00596843055f, 0.000993328751f, 0.354338318f, 0.2960051f,
+    0.0125358561f, 0.11251808f, -0.00479416177f, 0.000696232426f, 0.259381801f, 0.289838314f,
+    0.00724970084f, 0.0862399191f, -0.0036497484f, 0.000475198351f, 0.166605085f, 0.253103018f,
+    0.00370530388f, 0.0618544631f, -0.00264376146f, 0.000346291199f, 0.0896234065f, 0.17991811f,
+    0.0020387671f, 0.0440134667f, -0.00209215446f, 0.000372105162f, 0.0431612954f, 0.0911847502f,
+    1.0f, 0.0f, 0.0f, 0.0550836623f, 0.999852121f, 1.13912222e-07f,
+    0.99888885f, 0.0331202112f, -0.00176347641f, 0.0537826195f, 0.999850333f, 8.59573674e-08f,
+    0.996919453f, 0.0551340245f, -0.00294719939f, 0.0536754616f, 0.99983412f, 7.14441128e-08f,
+    0.994055688f, 0.0770514235f, -0.00412573805f, 0.0535208322f, 0.999803782f, 6.90826525e-08f,
+    0.990167379f, 0.0988231227f, -0.00529663218f, 0.0533128344f, 0.999759138f, 7.8806579e-08f,
+    0.985307276f, 0.120412812f, -0.00645755371f, 0.0530513898f, 0.999700725f, 1.01845451e-07f,
+    0.979517639f, 0.141784579f, -0.0076067457f, 0.0527404025f, 0.999627709f, 1.409026e-07f,
+    0.972801626f, 0.162896976f, -0.00874204841f, 0.0523796417f, 0.999540031f, 2.00495293e-07f,
+    0.965052307f, 0.183694065f, -0.00986033119f, 0.0519640408f, 0.999436498f, 2.87544225e-07f,
+    0.956534445f, 0.204179257f, -0.0109613249f, 0.051504463f, 0.999317527f, 4.12350914e-07f,
+    0.946972966f, 0.224261627f, -0.012041064f, 0.050991971f, 0.999181926f, 5.90177308e-07f,
+    0.936568558f, 0.243934378f, -0.0130985575f, 0.0504326932f, 0.999029994f, 8.43711177e-07f,
+    0.92525059f, 0.263145804f, -0.0141311372f, 0.0498249866f, 0.998858571f, 1.20682989e-06f,
+    0.913060606f, 0.28185606f, -0.015137447f, 0.049172312f, 0.998668551f, 1.73020771e-06f,
+    0.900082767f, 0.30005607f, -0.0161147546f, 0.048473224f, 0.998459399f, 2.48946412e-06f,
+    0.886283398f, 0.317689151f, -0.0170610975f, 0.0477291085f, 0.998227715f, 3.59675209e-06f,
+    0.871606886f, 0.334691644f, -0.0179752242f, 0.0469431654f, 0.997974157f, 5.21693391e-06f,
+    0.856178045f, 0.351061195f, -0.0188537426f, 0.046112746f, 0.997695446f, 7.58969463e-06f,
+    0.839982569f, 0.366753429f, -0.0196961965f, 0.0452430472f, 0.997390211f, 1.10592146e-05f,
+    0.823082209f, 0.381744415f, -0.0205010939f, 0.044336047f, 0.997054636f, 1.61135576e-05f,
+    0.805445194f, 0.395973206f, -0.0212651137f, 0.0433898568f, 0.996688306f, 2.34357267e-05f,
+    0.787125945f, 0.40942052f, -0.0219867527f, 0.0424068123f, 0.996285796f, 3.3969427e-05f,
+    0.768061936f, 0.422002524f, -0.022662947f, 0.0413863324f, 0.995842516f, 4.90019775e-05f,
+    0.748615742f, 0.43386513f, -0.0232962482f, 0.040337991f, 0.995354474f, 7.02680627e-05f,
+    0.728441894f, 0.444775343f, -0.023880329f, 0.0392551273f, 0.994815171f, 0.000100076693f,
+    0.707857251f, 0.454864979f, -0.0244201161f, 0.0381504595f, 0.994215012f, 0.000141465454f,
+    0.686679602f, 0.463975757f, -0.0249057263f, 0.0370125398f, 0.993545532f, 0.000198382142f,
+    0.665013254f, 0.472108752f, -0.0253403019f, 0.0358509347f, 0.992793083f, 0.00027589692f,
+    0.642887592f, 0.479240745f, -0.0257204361f, 0.0346650295f, 0.9919433f, 0.000380440528f,
+    0.620491624f, 0.485458136f, -0.026044853f, 0.0334576443f, 0.990975797f, 0.000520061934f,
+    0.597664595f, 0.49057883f, -0.0263131056f, 0.0322323777f, 0.989866853f, 0.000704699429f,
+    0.57444489f, 0.494573563f, -0.0265212227f, 0.0309887808f, 0.988587141f, 0.000946453481f,
+    0.551143646f, 0.497648269f, -0.0266731028f, 0.029735567f, 0.987101436f, 0.00125986966f,
+    0.527590692f, 0.499599367f, -0.0267652087f, 0.0284726042f, 0.985368311f, 0.0016622697f,
+    0.50375104f, 0.500320613f, -0.0268035382f, 0.0271951351f, 0.98367101f, 0.00220921659f,
+    0.479852736f, 0.499967098f, -0.0267806947f, 0.0259109158f, 0.981703162f, 0.00291434908f,
+    0.455798835f, 0.498386353f, -0.0266977176f, 0.0246247929f, 0.979401112f, 0.00381580391f,
+    0.43178311f, 0.49568516f, -0.0265517738f, 0.0233374629f, 0.976699054f, 0.00496040704f,
+    0.407725811f, 0.491730094f, -0.0263416823f, 0.0220513158f, 0.973516464f, 0.00640422665f,
+    0.383763522f, 0.486580074f, -0.0260637291f, 0.0207669437f, 0.969758034f, 0.00821398944f,
+    0.359955102f, 0.480241179f, -0.0257235989f, 0.0194923952f, 0.96531117f, 0.0104685575f,
+    0.336311191f, 0.472640097f, -0.0253179818f, 0.0182283781f, 0.960042775f, 0.0132604763f,
+    0.313120008f, 0.464107931f, -0.0248523671f, 0.0169820618f, 0.953791738f, 0.0166975185f,
+    0.290118754f, 0.454182178f, -0.0243144967f, 0.0157483034f, 0.946372032f, 0.0209041052f,
+    0.267427355f, 0.442929298f, -0.0237125251f, 0.0145361302f, 0.937563002f, 0.0260224156f,
+    0.245163649f, 0.430419922f, -0.0230446961f, 0.0133477943f, 0.927103877f, 0.032212954f,
+    0.223522142f, 0.416904271f, -0.0223073084f, 0.0121847251f, 0.914691508f, 0.0396540537f,
+    0.202445433f, 0.402177811f, -0.0215108562f, 0.011056182f, 0.89996773f, 0.0485394411f,
+    0.181845978f, 0.385918885f, -0.0206421446f, 0.00995872915f, 0.882518232f, 0.0590734631f,
+    0.162211806f, 0.369047105f, -0.0197151806f, 0.00890297629f, 0.861864269f, 0.0714612752f,
+    0.14313978f, 0.350506186f, -0.018712474f, 0.00788464025f, 0.837453723f, 0.0858933926f,
+    0.125105023f, 0.331301004f, -0.0176605191f, 0.00691881403f, 0.80867064f, 0.102520615f,
+    0.107846111f, 0.310605019f, -0.0165436771f, 0.00599877676f, 0.775092959f, 0.121611737f,
+    0.0916790515f, 0.289101809f, -0.0153738875f, 0.00513231428f, 0.735948145f, 0.143252254f,
+    0.0765349492f, 0.266399562f, -0.0141492309f, 0.00432474772f, 0.690152943f, 0.167101681f,
+    0.0625619665f, 0.24276647f, -0.0128720794f, 0.00357835065f, 0.636991084f, 0.19277899f,
+    0.0498319194f, 0.218267635f, -0.0115431407f, 0.00289948285f, 0.57536453f, 0.21885778f,
+    0.0384355374f, 0.193001732f, -0.0101704821f, 0.00229285751f, 0.504849732f, 0.243243605f,
+    0.028495213f, 0.16739127f, -0.00877269264f, 0.0017643153f, 0.425657332f, 0.262548983f,
+    0.0200416427f, 0.141404897f, -0.00735798385f, 0.00131825835f, 0.339202166f, 0.27110213f,
+    0.0131948777f, 0.115730599f, -0.00597081427f, 0.000961993879f, 0.249550194f, 0.261883765f,
+    0.00798620936f, 0.0907835811f, -0.00465944363f, 0.000704787031f, 0.16415976f, 0.226566091f,
+    0.00447824784f, 0.0676742941f, -0.0035427243f, 0.000567984942f, 0.0947080478f, 0.163592592f,
+    0.00294105685f, 0.0526772663f, -0.00304366043f, 0.000657503784f, 0.0517249331f, 0.0909899697f,
+    1.0f, 0.0f, 0.0f, 0.0655984879f, 0.99968493f, 4.56961999e-07f,
+    0.998914599f, 0.0331207886f, -0.00212108763f, 0.0645126328f, 0.999689162f, 3.64602272e-07f,
+    0.996928334f, 0.055135034f, -0.00354005955f, 0.0643868744f, 0.999675393f, 3.10816404e-07f,
+    0.99400866f, 0.0770463571f, -0.00495253038f, 0.0641982704f, 0.999643326f, 2.93009521e-07f,
+    0.990148127f, 0.0988202095f, -0.00635618623f, 0.0639504269f, 0.999593735f, 3.10754501e-07f,
+    0.985301793f, 0.120411441f, -0.00774822664f, 0.0636405647f, 0.999526203f, 3.66009488e-07f,
+    0.979480982f, 0.141776383f, -0.0091254618f, 0.0632652119f, 0.999439478f, 4.63410714e-07f,
+    0.972816348f, 0.162896946f, -0.0104862135f, 0.0628320202f, 0.999333918f, 6.10710515e-07f,
+    0.965053618f, 0.183691591f, -0.011826871f, 0.0623350479f, 0.999209404f, 8.19463196e-07f,
+    0.956423998f, 0.204153016f, -0.0131459972f, 0.0617814809f, 0.999064863f, 1.1060996e-06f,
+    0.946988761f, 0.224259108f, -0.014440285f, 0.0611681379f, 0.998898864f, 1.49358004e-06f,
+    0.936597764f, 0.24393487f, -0.0157076698f, 0.0604979657f, 0.998711824f, 2.01392118e-06f,
+    0.925284207f, 0.263148159f, -0.0169455986f, 0.0597713701f, 0.99850136f, 2.71193107e-06f,
+    0.913124144f, 0.28186959f, -0.0181512441f, 0.0589885116f, 0.998267353f, 3.65067626e-06f,
+    0.900164306f, 0.300072819f, -0.0193217937f, 0.0581495613f, 0.998007238f, 4.91922492e-06f,
+    0.886363566f, 0.317706317f, -0.0204561464f, 0.0572598539f, 0.99771899f, 6.64344407e-06f,
+    0.87166965f, 0.334704965f, -0.0215493683f, 0.0563136674f, 0.997400939f, 9.0006688e-06f,
+    0.856303513f, 0.351097882f, -0.0226033051f, 0.0553237498f, 0.997050285f, 1.22391393e-05f,
+    0.840056479f, 0.366769642f, -0.0236097705f, 0.0542770103f, 0.996663034f, 1.67033086e-05f,
+    0.823109508f, 0.381740332f, -0.0245716423f, 0.0531878658f, 0.996236384f, 2.28654117e-05f,
+    0.805507839f, 0.395984858f, -0.0254849289f, 0.0520538464f, 0.99576354f, 3.13644668e-05f,
+    0.78727293f, 0.409475237f, -0.0263476316f, 0.0508774035f, 0.995239556f, 4.30516229e-05f,
+    0.7682212f, 0.422067016f, -0.0271543823f, 0.0496546477f, 0.994656682f, 5.90411801e-05f,
+    0.748713672f, 0.433898658f, -0.0279091299f, 0.0483991653f, 0.994003594f, 8.07645629e-05f,
+    0.72869122f, 0.444897234f, -0.0286062472f, 0.0471068211f, 0.993270159f, 0.000110023509f,
+    0.708056092f, 0.454957485f, -0.0292417724f, 0.045777183f, 0.992441535f, 0.000149040075f,
+    0.686904669f, 0.464086086f, -0.0298148245f, 0.0444150493f, 0.991500676f, 0.000200507653f,
+    0.665215254f, 0.472212225f, -0.0303234756f, 0.0430233888f, 0.990429461f, 0.000267652154f,
+    0.643232405f, 0.479456574f, -0.030784661f, 0.0416066386f, 0.989519536f, 0.000372750656f,
+    0.620648265f, 0.485530436f, -0.0311773717f, 0.0401592068f, 0.988516033f, 0.000515526626f,
+    0.597897828f, 0.49072212f, -0.0315071121f, 0.0386942327f, 0.98738271f, 0.000706235296f,
+    0.574758112f, 0.49478361f, -0.031770654f, 0.0372120105f, 0.986096501f, 0.000958748278f,
+    0.551379621f, 0.497799665f, -0.0319592394f, 0.0357066244f, 0.98462826f, 0.00129031227f,
+    0.527746081f, 0.499678373f, -0.0320775323f, 0.0341883749f, 0.982946157f, 0.00172222755f,
+    0.503839672f, 0.500334203f, -0.0321232937f, 0.0326590799f, 0.981007516f, 0.00228060083f,
+    0.480103403f, 0.500149369f, -0.0320993923f, 0.0311258696f, 0.978764236f, 0.00299722562f,
+    0.455989569f, 0.498498797f, -0.0319970734f, 0.0295843389f, 0.976156116f, 0.00391053222f,
+    0.431845546f, 0.495655477f, -0.0318126082f, 0.0280357301f, 0.973114252f, 0.00506668538f,
+    0.407918155f, 0.491849631f, -0.0315610766f, 0.0264978241f, 0.969554424f, 0.00652073091f,
+    0.383988112f, 0.486740977f, -0.0312314611f, 0.0249646902f, 0.96537441f, 0.00833786372f,
+    0.36028564f, 0.480545402f, -0.0308271572f, 0.0234430917f, 0.960459232f, 0.0105946781f,
+    0.336682439f, 0.47301811f, -0.0303362962f, 0.0219282992f, 0.954664946f, 0.0133804493f,
+    0.313320339f, 0.464241505f, -0.0297673158f, 0.020431079f, 0.947825849f, 0.0167981815f,
+    0.290338159f, 0.454351038f, -0.0291228089f, 0.0189571828f, 0.939746916f, 0.0209655296f,
+    0.267822683f, 0.443377852f, -0.0284017082f, 0.0175097436f, 0.930196643f, 0.0260149129f,
+    0.245580226f, 0.430931419f, -0.0275942646f, 0.0160870068f, 0.918907404f, 0.032092981f,
+    0.223886758f, 0.417341352f, -0.0267064814f, 0.0146972509f, 0.90556407f, 0.0393585861f,
+    0.20277904f, 0.402563781f, -0.0257469006f, 0.0133493086f, 0.889806271f, 0.0479784794f,
+    0.182343245f, 0.386675298f, -0.0246988684f, 0.0120386453f, 0.871224403f, 0.0581210218f,
+    0.162625074f, 0.369634956f, -0.0235838555f, 0.0107773198f, 0.849503994f, 0.0700172707f,
+    0.143671766f, 0.351416141f, -0.0224024989f, 0.00956527051f, 0.824302316f, 0.0839583725f,
+    0.125496551f, 0.331877202f, -0.0211424101f, 0.00840538088f, 0.794781983f, 0.100008972f,
+    0.108346343f, 0.311530441f, -0.0198139641f, 0.00730706286f, 0.760220051f, 0.118202031f,
+    0.0921303779f, 0.289905161f, -0.0184157379f, 0.00627092924f, 0.720057249f, 0.138611063f,
+    0.0770349354f, 0.267394215f, -0.0169535615f, 0.00530668115f, 0.673266232f, 0.160771772f,
+    0.0631641895f, 0.244210124f, -0.015433616f, 0.00442072563f, 0.619072497f, 0.183897778f,
+    0.0504618511f, 0.219905376f, -0.0138538135f, 0.00361214066f, 0.557241559f, 0.207054213f,
+    0.0391757749f, 0.195266947f, -0.0122365979f, 0.00289345463f, 0.487264007f, 0.227808982f,
+    0.0292861778f, 0.170160621f, -0.0105889887f, 0.00226711854f, 0.409911007f, 0.24301222f,
+    0.0209165197f, 0.144999176f, -0.00895580836f, 0.00174274389f, 0.327193975f, 0.248214409f,
+    0.0141721815f, 0.120579071f, -0.00737325521f, 0.00132929767f, 0.243043631f, 0.23713015f,
+    0.00900460221f, 0.096727863f, -0.0059012752f, 0.00103858032f, 0.164623037f, 0.204403564f,
+    0.00552613568f, 0.0749202445f, -0.00470192544f, 0.000905839493f, 0.101544969f, 0.151056617f,
+    0.00420236355f, 0.0632418841f, -0.00430644816f, 0.0010974498f, 0.0611805245f, 0.0911234319f,
+    1.0f, 0.0f, 0.0f, 0.0771645755f, 0.999213815f, 1.29477064e-06f,
+    0.998907983f, 0.0331219286f, -0.00252781273f, 0.0762077719f, 0.999264121f, 1.121796e-06f,
+    0.996938109f, 0.0551338121f, -0.00420015026f, 0.0760629401f, 0.999283016f, 1.01139892e-06f,
+    0.994037211f, 0.0770480335f, -0.00586539228f, 0.0758424327f, 0.999271512f, 9.70976316e-07f,
+    0.990199089f, 0.0988219082f, -0.00752055412f, 0.0755504668f, 0.999231935f, 1.0063776e-06f,
+    0.985260785f, 0.12040399f, -0.00916148536f, 0.0751786754f, 0.999165475f, 1.1240661e-06f,
+    0.979562104f, 0.141784921f, -0.0107868202f, 0.0747434422f, 0.999071598f, 1.33251046e-06f,
+    0.972744524f, 0.162882894f, -0.0123911342f, 0.0742278472f, 0.998951614f, 1.64313974e-06f,
+    0.965104699f, 0.183693409f, -0.0139728123f, 0.0736439899f, 0.998803437f, 2.07106973e-06f,
+    0.956553161f, 0.204174921f, -0.015528677f, 0.0729912072f, 0.998628378f, 2.63576726e-06f,
+    0.947031498f, 0.224261865f, -0.0170552544f, 0.0722685233f, 0.998423815f, 3.36169524e-06f,
+    0.936659336f, 0.243944243f, -0.0185491554f, 0.0714759976f, 0.998188496f, 4.2790648e-06f,
+    0.92530185f, 0.263142556f, -0.0200066827f, 0.0706128851f, 0.997920096f, 5.42460111e-06f,
+    0.91316855f, 0.281870633f, -0.0214271434f, 0.0696891397f, 0.997616231f, 6.84210818e-06f,
+    0.90015626f, 0.300058305f, -0.0228059608f, 0.0687003434f, 0.997272432f, 8.5825186e-06f,
+    0.886397839f, 0.317702323f, -0.0241403542f, 0.0676490441f, 0.996886313f, 1.07024107e-05f,
+    0.871746898f, 0.334715754f, -0.0254259072f, 0.0665330961f, 0.996450484f, 1.32599589e-05f,
+    0.856304228f, 0.35108f, -0.026660949f, 0.065358676f, 0.99595964f, 1.63060631e-05f,
+    0.840183556f, 0.366801947f, -0.0278432872f, 0.0641294643f, 0.995405018f, 1.98691105e-05f,
+    0.823247313f, 0.381778508f, -0.0289675687f, 0.062842302f, 0.994777262f, 2.39313904e-05f,
+    0.805611908f, 0.39601019f, -0.0300325342f, 0.0615034401f, 0.994066596f, 2.83981208e-05f,
+    0.787346303f, 0.409483284f, -0.0310372319f, 0.0601132512f, 0.993303537f, 3.41928644e-05f,
+    0.768440545f, 0.42215243f, -0.0319988951f, 0.0586778186f, 0.99273181f, 5.00964379e-05f,
+    0.748892069f, 0.433961093f, -0.0328968391f, 0.0571971275f, 0.992102385f, 7.26855287e-05f,
+    0.728779912f, 0.444906056f, -0.0337274857f, 0.0556714274f, 0.991409421f, 0.000104429499f,
+    0.708158255f, 0.454977483f, -0.0344909802f, 0.054107219f, 0.990642965f, 0.000148578256f,
+    0.686972797f, 0.464086235f, -0.0351796411f, 0.0524987467f, 0.989793837f, 0.000209366073f,
+    0.665346324f, 0.472249955f, -0.0357980467f, 0.0508591942f, 0.988850474f, 0.00029225758f,
+    0.643371999f, 0.479495287f, -0.0363426916f, 0.0491888933f, 0.987798154f, 0.000404242892f,
+    0.620934546f, 0.485685796f, -0.0368068218f, 0.0474843942f, 0.986619294f, 0.000554187864f,
+    0.598013401f, 0.490742713f, -0.0371917635f, 0.0457534455f, 0.985292375f, 0.000753245142f,
+    0.574915707f, 0.494838387f, -0.0374959819f, 0.0439996496f, 0.983791769f, 0.00101533229f,
+    0.551617205f, 0.497921705f, -0.037719436f, 0.0422280803f, 0.982088745f, 0.00135768997f,
+    0.52792567f, 0.499747574f, -0.0378590636f, 0.040440511f, 0.980145872f, 0.00180151197f,
+    0.504225552f, 0.500609577f, -0.0379126258f, 0.0386396274f, 0.977917254f, 0.00237266859f,
+    0.480234951f, 0.500165939f, -0.0378777459f, 0.036828313f, 0.975352168f, 0.00310249929f,
+    0.456276983f, 0.498680562f, -0.0377561152f, 0.035013333f, 0.972387373f, 0.00402870774f,
+    0.432194054f, 0.495914012f, -0.0375383161f, 0.0331911743f, 0.968947113f, 0.00519629382f,
+    0.40825367f, 0.492102474f, -0.0372370519f, 0.0313783064f, 0.964942157f, 0.0066585443f,
+    0.384317935f, 0.486988336f, -0.036841657f, 0.0295702741f, 0.960265219f, 0.00847803894f,
+    0.360680938f, 0.480892003f, -0.0363586321f, 0.0277772881f, 0.954791725f, 0.0107275518f,
+    0.337114781f, 0.473418176f, -0.0357721709f, 0.0259923823f, 0.948372781f, 0.0134908631f,
+    0.313729882f, 0.464618921f, -0.0350995064f, 0.0242335442f, 0.940835059f, 0.0168631431f,
+    0.290746987f, 0.454741389f, -0.034331616f, 0.0224991012f, 0.93197453f, 0.020951109f,
+    0.268197209f, 0.4437249f, -0.0334666967f, 0.0207931083f, 0.921557248f, 0.0258722454f,
+    0.246067017f, 0.431477815f, -0.0325097293f, 0.0191237591f, 0.90931499f, 0.0317534581f,
+    0.224417314f, 0.417982668f, -0.0314625949f, 0.0174919907f, 0.895106673f, 0.0387835093f,
+    0.203329951f, 0.403273374f, -0.0303319469f, 0.0159016233f, 0.878736436f, 0.0471950322f,
+    0.182842255f, 0.387296647f, -0.0291109644f, 0.0143586872f, 0.85961628f, 0.0571202114f,
+    0.163138747f, 0.37032038f, -0.0278017707f, 0.0128721874f, 0.837161481f, 0.0686728358f,
+    0.144182906f, 0.352107853f, -0.0264092684f, 0.0114464518f, 0.810959756f, 0.0820335075f,
+    0.126084283f, 0.332799524f, -0.0249316059f, 0.0100826658f, 0.780536234f, 0.0973822027f,
+    0.108958989f, 0.312534064f, -0.0233755521f, 0.00879350025f, 0.745001197f, 0.114593722f,
+    0.0928698629f, 0.291370302f, -0.0217279885f, 0.00757906819f, 0.703678668f, 0.133470252f,
+    0.0778139457f, 0.26905939f, -0.0200147387f, 0.00645063119f, 0.656086266f, 0.153708905f,
+    0.0639338791f, 0.245934889f, -0.018233059f, 0.00540888077f, 0.601769805f, 0.174716666f,
+    0.0513901487f, 0.222376063f, -0.0164006073f, 0.00446823798f, 0.540063262f, 0.194851726f,
+    0.0401544534f, 0.198185205f, -0.0145280715f, 0.00362931285f, 0.471453726f, 0.212456435f,
+    0.0303810257f, 0.173899665f, -0.0126506314f, 0.00290301768f, 0.396778882f, 0.224616528f,
+    0.0221213866f, 0.149779126f, -0.01079854f, 0.00229849387f, 0.318112016f, 0.227174386f,
+    0.0154275345f, 0.126248047f, -0.00902650319f, 0.00182788912f, 0.239594832f, 0.215518549f,
+    0.0103130443f, 0.1035413f, -0.00741314981f, 0.00151037611f, 0.167590797f, 0.186102316f,
+    0.00691591902f, 0.0835566372f, -0.00617036549f, 0.00140121672f, 0.109824829f, 0.141166508f,
+    0.00576645788f, 0.0738604888f, -0.00588515168f, 0.00172849058f, 0.0714939386f, 0.0913157314f,
+    1.0f, 0.0f, 0.0f, 0.0896742046f, 0.997493148f, 7.7155255e-07f,
+    0.998901367f, 0.0331254341f, -0.00305095478f, 0.0888141021f, 0.997785568f, 1.43308125e-06f,
+    0.996953905f, 0.0551357456f, -0.00497904466f, 0.08865311f, 0.997995853f, 1.82507665e-06f,
+    0.994054317f, 0.0770482272f, -0.00690274732f, 0.0884072632f, 0.998130381f, 2.10113308e-06f,
+    0.990178764f, 0.0988207757f, -0.00881731231f, 0.0880729407f, 0.998196244f, 2.36105279e-06f,
+    0.98531729f, 0.120407008f, -0.0107179321f, 0.087648727f, 0.998199582f, 2.66763209e-06f,
+    0.97954601f, 0.141777784f, -0.0126006659f, 0.0871397629f, 0.998145461f, 3.05781441e-06f,
+    0.972820878f, 0.162889197f, -0.0144612389f, 0.0865467489f, 0.998036027f, 3.54874373e-06f,
+    0.965183675f, 0.183704913f, -0.0162951425f, 0.0858687162f, 0.997872412f, 4.13920679e-06f,
+    0.956556678f, 0.204167008f, -0.0180980228f, 0.0851061046f, 0.99765408f, 4.80636891e-06f,
+    0.947035253f, 0.224250972f, -0.0198662486f, 0.0842627361f, 0.997379541f, 5.49742936e-06f,
+    0.936647177f, 0.243928745f, -0.0215953942f, 0.083338581f, 0.997045815f, 6.11524183e-06f,
+    0.925381422f, 0.263149083f, -0.0232819133f, 0.082337141f, 0.996646166f, 6.49672347e-06f,
+    0.91323328f, 0.281873107f, -0.0249212235f, 0.0812581629f, 0.99617672f, 6.38293977e-06f,
+    0.900280654f, 0.300078243f, -0.0265098903f, 0.0801049918f, 0.995629847f, 5.38047289e-06f,
+    0.886452854f, 0.317698479f, -0.0280546732f, 0.0788788721f, 0.995123982f, 4.75530533e-06f,
+    0.871886969f, 0.33474353f, -0.0295627173f, 0.0775868446f, 0.994756043f, 6.87043485e-06f,
+    0.856425583f, 0.351103842f, -0.0310127418f, 0.0762233958f, 0.994344711f, 9.95473874e-06f,
+    0.840235054f, 0.366793483f, -0.0324029103f, 0.0747940913f, 0.993889511f, 1.44254709e-05f,
+    0.823325574f, 0.381778866f, -0.0337300189f, 0.0733011439f, 0.99338603f, 2.08636466e-05f,
+    0.805782914f, 0.396055132f, -0.034991961f, 0.0717487857f, 0.992831767f, 3.00688134e-05f,
+    0.787493765f, 0.409519881f, -0.0361823142f, 0.0701323822f, 0.992220521f, 4.31289518e-05f,
+    0.768506527f, 0.422141373f, -0.0372979678f, 0.0684549063f, 0.99154681f, 6.15084646e-05f,
+    0.749041021f, 0.433998674f, -0.0383444391f, 0.0667345822f, 0.990804791f, 8.71578886e-05f,
+    0.729028881f, 0.445002794f, -0.0393111743f, 0.0649596751f, 0.989987731f, 0.000122649115f,
+    0.708308399f, 0.455009639f, -0.0401940569f, 0.0631315783f, 0.989083648f, 0.000171341075f,
+    0.687193334f, 0.464161396f, -0.0409986041f, 0.0612661801f, 0.988082886f, 0.000237578715f,
+    0.665532768f, 0.472308159f, -0.0417120308f, 0.0593514144f, 0.986970782f, 0.000326934096f,
+    0.643486381f, 0.479499966f, -0.0423430465f, 0.0574066192f, 0.985732496f, 0.000446490827f,
+    0.621114135f, 0.485737741f, -0.0428821594f, 0.0554252155f, 0.984347761f, 0.000605177891f,
+    0.598338366f, 0.490908206f, -0.0433294475f, 0.0534139834f, 0.98279357f, 0.000814160623f,
+    0.575239241f, 0.495005935f, -0.043681968f, 0.0513756759f, 0.981040955f, 0.00108729128f,
+    0.551864207f, 0.49801898f, -0.0439367071f, 0.0493131205f, 0.97905618f, 0.00144161866f,
+    0.528363705f, 0.500028968f, -0.0440937392f, 0.0472327806f, 0.976800501f, 0.00189795846f,
+    0.504581988f, 0.500812829f, -0.0441501327f, 0.0451376438f, 0.974223435f, 0.00248153391f,
+    0.480644196f, 0.500431776f, -0.0441020839f, 0.0430300608f, 0.971269131f, 0.00322265085f,
+    0.456659466f, 0.498929232f, -0.0439529344f, 0.0409194306f, 0.967869639f, 0.00415741513f,
+    0.43266508f, 0.496265113f, -0.0436944626f, 0.0388041846f, 0.96394074f, 0.00532846572f,
+    0.408752084f, 0.492483199f, -0.043333292f, 0.0366964005f, 0.959390759f, 0.00678564655f,
+    0.384866983f, 0.487455368f, -0.0428654663f, 0.0345983654f, 0.954104781f, 0.0085866591f,
+    0.361184448f, 0.481302053f, -0.0422898643f, 0.0325151123f, 0.947952747f, 0.0107975388f,
+    0.337607324f, 0.473832548f, -0.0415952913f, 0.0304442458f, 0.940783858f, 0.0134929717f,
+    0.3143453f, 0.465221435f, -0.0407991409f, 0.0284010191f, 0.932507336f, 0.0167731214f,
+    0.291401058f, 0.455413133f, -0.0399061963f, 0.0263903178f, 0.923003256f, 0.020760294f,
+    0.268842429f, 0.444406062f, -0.0389161929f, 0.0244105514f, 0.912193775f, 0.0256210342f,
+    0.246649787f, 0.432080865f, -0.0378105864f, 0.0224646218f, 0.899589598f, 0.0314473137f,
+    0.225067809f, 0.418723524f, -0.0366085619f, 0.020572057f, 0.88481766f, 0.038359616f,
+    0.203973666f, 0.404028654f, -0.0352901258f, 0.0187260173f, 0.867551744f, 0.0465022214f,
+    0.183580965f, 0.388282806f, -0.0338784643f, 0.0169384871f, 0.84758091f, 0.0560955703f,
+    0.163921237f, 0.371415406f, -0.0323657468f, 0.0152139394f, 0.8243348f, 0.0672521442f,
+    0.144939646f, 0.353182793f, -0.0307370313f, 0.0135546857f, 0.797191024f, 0.0800185055f,
+    0.126942441f, 0.334181607f, -0.0290208273f, 0.011979579f, 0.765594006f, 0.0944065601f,
+    0.109845914f, 0.314073473f, -0.027207436f, 0.0104872603f, 0.729068756f, 0.110380411f,
+    0.0938550606f, 0.29326418f, -0.025319472f, 0.00908539165f, 0.687289298f, 0.127929568f,
+    0.0788506716f, 0.27123487f, -0.0233366527f, 0.00777826551f, 0.639396489f, 0.146403864f,
+    0.0651054904f, 0.248704925f, -0.021293899f, 0.00658199936f, 0.585054696f, 0.164980635f,
+    0.0526390672f, 0.225631475f, -0.019204786f, 0.00549725071f, 0.524468064f, 0.182748303f,
+    0.0415247902f, 0.202227309f, -0.01709144f, 0.00453547947f, 0.457799911f, 0.197737947f,
+    0.0318638235f, 0.178844482f, -0.0149857383f, 0.00370682124f, 0.386158377f, 0.207326531f,
+    0.0236994438f, 0.155709088f, -0.0129284244f, 0.00302308123f, 0.311846316f, 0.208096728f,
+    0.0170724317f, 0.133279771f, -0.0109833283f, 0.00250109145f, 0.238766447f, 0.196451098f,
+    0.0119462376f, 0.111202687f, -0.00924320612f, 0.002163606f, 0.172608763f, 0.170768112f,
+    0.00856000744f, 0.0920582563f, -0.00796429906f, 0.00209454633f, 0.119306549f, 0.133098051f,
+    0.00792456698f, 0.087315388f, -0.00791851431f, 0.00263204845f, 0.0826171637f, 0.091383338f,
+    1.0f, 0.0f, 0.0f, 0.103202976f, 0.996806562f, 1.45126899e-06f,
+    0.998900473f, 0.0331277214f, -0.00354148401f, 0.102404885f, 0.996682227f, 1.7329387e-06f,
+    0.996949255f, 0.0551374406f, -0.00578892324f, 0.102193221f, 0.996518254f, 2.0580585e-06f,
+    0.994032145f, 0.0770486742f, -0.00802377146f, 0.101883851f, 0.996309638f, 2.40795384e-06f,
+    0.990175605f, 0.0988214239f, -0.0102415308f, 0.101476967f, 0.996054947f, 2.74582635e-06f,
+    0.985366762f, 0.120413795f, -0.0124369068f, 0.100967057f, 0.995748997f, 3.00614784e-06f,
+    0.979551911f, 0.141777515f, -0.0146055548f, 0.100359261f, 0.995384336f, 3.0796582e-06f,
+    0.97285825f, 0.162890449f, -0.0167124327f, 0.099683471f, 0.995294869f, 3.01520777e-06f,
+    0.965189874f, 0.183695212f, -0.0187812876f, 0.0989116132f, 0.995164216f, 2.2209224e-06f,
+    0.956609309f, 0.204164833f, -0.0208370406f, 0.0980506465f, 0.995096147f, 1.75355751e-06f,
+    0.947106123f, 0.224253356f, -0.0228736456f, 0.0971015617f, 0.995081365f, 2.133002e-06f,
+    0.936774433f, 0.243942961f, -0.0248710178f, 0.0960578397f, 0.994994581f, 2.65104518e-06f,
+    0.925494969f, 0.263159573f, -0.0268236883f, 0.0949188024f, 0.994842768f, 3.38738823e-06f,
+    0.913327098f, 0.28187868f, -0.0287280343f, 0.0936907083f, 0.994627893f, 4.4393737e-06f,
+    0.90041858f, 0.300099343f, -0.0305798277f, 0.0923760459f, 0.994353771f, 5.9359736e-06f,
+    0.886623919f, 0.317732096f, -0.0323746316f, 0.0909764841f, 0.994020879f, 8.05435775e-06f,
+    0.871972799f, 0.334741831f, -0.0341072157f, 0.0894913748f, 0.993630469f, 1.10404108e-05f,
+    0.856547654f, 0.351114661f, -0.0357726403f, 0.0879214555f, 0.993182361f, 1.52350885e-05f,
+    0.840452552f, 0.366845518f, -0.0373716429f, 0.0862809643f, 0.992674708f, 2.11081351e-05f,
+    0.823536813f, 0.381831825f, -0.0388953052f, 0.0845600814f, 0.992103398f, 2.930146e-05f,
+    0.805937052f, 0.39608103f, -0.0403432585f, 0.0827695727f, 0.991467774f, 4.06841464e-05f,
+    0.787667751f, 0.409553379f, -0.0417117923f, 0.0809117183f, 0.990760386f, 5.64221518e-05f,
+    0.768803656f, 0.422241867f, -0.0429968685f, 0.0789883882f, 0.989976764f, 7.80647097e-05f,
+    0.749311686f, 0.434085339f, -0.0441951379f, 0.0770029724f, 0.989109576f, 0.000107651744f,
+    0.729198396f, 0.445033282f, -0.0453021824f, 0.0749568939f, 0.98814863f, 0.000147845101f,
+    0.708548486f, 0.455081552f, -0.0463161469f, 0.0728561282f, 0.987084389f, 0.000202085561f,
+    0.687531769f, 0.464298368f, -0.0472388752f, 0.0707116351f, 0.98590368f, 0.000274784281f,
+    0.665917158f, 0.472475559f, -0.0480572917f, 0.0685118586f, 0.984591126f, 0.000371544244f,
+    0.643927276f, 0.479714662f, -0.0487748608f, 0.0662703738f, 0.983127832f, 0.000499426736f,
+    0.621502399f, 0.485913455f, -0.0493891761f, 0.0639916584f, 0.981491208f, 0.000667248096f,
+    0.598753691f, 0.491108209f, -0.049893599f, 0.0616748333f, 0.97965467f, 0.000885929505f,
+    0.575682521f, 0.495237261f, -0.0502917171f, 0.0593320318f, 0.977586746f, 0.00116888247f,
+    0.552308977f, 0.498256028f, -0.0505763143f, 0.0569619983f, 0.975249112f, 0.00153243146f,
+    0.528690219f, 0.500154734f, -0.0507405587f, 0.0545647591f, 0.972598672f, 0.00199627876f,
+    0.505072653f, 0.501100004f, -0.0508006662f, 0.0521652177f, 0.969580054f, 0.00258398009f,
+    0.481188774f, 0.500781953f, -0.0507320017f, 0.0497444794f, 0.966133237f, 0.00332345325f,
+    0.457231462f, 0.499312013f, -0.0505419038f, 0.0473180264f, 0.962184608f, 0.0042474661f,
+    0.433352977f, 0.496794671f, -0.0502353348f, 0.0448972955f, 0.957650185f, 0.00539411139f,
+    0.409460336f, 0.49305132f, -0.0498124771f, 0.0424815975f, 0.952540576f, 0.00682166032f,
+    0.385580629f, 0.488048673f, -0.0492656268f, 0.0400716104f, 0.946735799f, 0.00858745445f,
+    0.361989051f, 0.482030958f, -0.0486100093f, 0.0376792923f, 0.94022584f, 0.0107784681f,
+    0.338462591f, 0.474639177f, -0.0478381179f, 0.0353043564f, 0.932865083f, 0.0134860389f,
+    0.315167099f, 0.466016501f, -0.0469404049f, 0.0329567492f, 0.924296141f, 0.0167707559f,
+    0.292166442f, 0.456158847f, -0.0459085591f, 0.0306376554f, 0.91431427f, 0.0207278188f,
+    0.269614726f, 0.445173621f, -0.0447615534f, 0.0283666458f, 0.902683616f, 0.0254601035f,
+    0.247433692f, 0.432883382f, -0.0434865691f, 0.0261340197f, 0.889297903f, 0.0311279278f,
+    0.225944892f, 0.419724226f, -0.0421147086f, 0.0239632726f, 0.873883009f, 0.0378840156f,
+    0.204894423f, 0.405144721f, -0.0406060927f, 0.0218449403f, 0.855903208f, 0.045806814f,
+    0.184511766f, 0.389445692f, -0.0389776789f, 0.0197958313f, 0.834954202f, 0.0550019108f,
+    0.164898381f, 0.372730047f, -0.0372309349f, 0.0178232361f, 0.810600042f, 0.0655488968f,
+    0.14605996f, 0.354902983f, -0.0353664421f, 0.0159311332f, 0.782456458f, 0.0775233507f,
+    0.128023714f, 0.335852444f, -0.0333933309f, 0.0141215278f, 0.750284553f, 0.0910773203f,
+    0.111074015f, 0.316197634f, -0.0313388556f, 0.0124182589f, 0.713335216f, 0.106015421f,
+    0.0951178148f, 0.29557538f, -0.0291758832f, 0.0108196223f, 0.670990586f, 0.121948987f,
+    0.0802949965f, 0.274257958f, -0.0269385371f, 0.00933457352f, 0.623207569f, 0.138627067f,
+    0.0666449293f, 0.252231628f, -0.0246437471f, 0.00797094591f, 0.569792032f, 0.155392081f,
+    0.0542830452f, 0.229803488f, -0.022305131f, 0.00673949858f, 0.510634303f, 0.170970291f,
+    0.0432930812f, 0.207227513f, -0.0199569613f, 0.00565252639f, 0.446275473f, 0.183683887f,
+    0.0337503031f, 0.184776574f, -0.0176292229f, 0.00472152093f, 0.37795949f, 0.19114393f,
+    0.0256432481f, 0.162480921f, -0.0153760603f, 0.00396040827f, 0.308080614f, 0.190732807f,
+    0.0190630034f, 0.140883803f, -0.0132772746f, 0.00339135434f, 0.240311489f, 0.179963216f,
+    0.0139859552f, 0.119865067f, -0.0114431623f, 0.00304979249f, 0.179324299f, 0.157818124f,
+    0.010720158f, 0.102603182f, -0.0101681976f, 0.00305013848f, 0.12979655f, 0.126295194f,
+    0.0103728659f, 0.0993253142f, -0.0102841305f, 0.00381427677f, 0.09448798f, 0.0912443921f,
+    1.0f, 0.0f, 0.0f, 0.117638402f, 0.995421827f, 2.19093886e-06f,
+    0.998893738f, 0.0331187956f, -0.00393129094f, 0.116930425f, 0.995139599f, 2.01747162e-06f,
+    0.996945262f, 0.0551277287f, -0.00647434918f, 0.116681077f, 0.994787157f, 1.52868654e-06f,
+    0.994059503f, 0.0770381019f, -0.00902260188f, 0.11633002f, 0.99454695f, 1.19099957e-06f,
+    0.990201771f, 0.0988100469f, -0.0115724234f, 0.115875326f, 0.994422138f, 1.31309696e-06f,
+    0.985360563f, 0.120399229f, -0.014100383f, 0.11530742f, 0.994266152f, 1.48455354e-06f,
+    0.979595482f, 0.141769722f, -0.0166015197f, 0.11462602f, 0.994075894f, 1.71857027e-06f,
+    0.972895861f, 0.162883222f, -0.019071823f, 0.113837995f, 0.993850529f, 2.0333207e-06f,
+    0.965243816f, 0.183694124f, -0.0215053502f, 0.112936474f, 0.993590415f, 2.45353704e-06f,
+    0.956674218f, 0.204168051f, -0.0238985866f, 0.11193008f, 0.993293166f, 3.01275441e-06f,
+    0.94719243f, 0.224263236f, -0.0262460969f, 0.110816039f, 0.992958665f, 3.75643413e-06f,
+    0.936831236f, 0.24394539f, -0.0285430718f, 0.109595902f, 0.992583454f, 4.74629996e-06f,
+    0.92558831f, 0.263176382f, -0.0307858232f, 0.108275004f, 0.992165327f, 6.06632693e-06f,
+    0.913457334f, 0.281899482f, -0.0329315476f, 0.106895909f, 0.992139876f, 7.93672007e-06f,
+    0.900532365f, 0.300111026f, -0.0350193568f, 0.105418995f, 0.992036998f, 1.03392722e-05f,
+    0.886683047f, 0.317722946f, -0.0370438769f, 0.103836343f, 0.991829932f, 1.35140417e-05f,
+    0.872134387f, 0.334768683f, -0.0390029177f, 0.102160372f, 0.991523325f, 1.77713264e-05f,
+    0.856774569f, 0.351163894f, -0.0408896506f, 0.100389563f, 0.991120338f, 2.35125935e-05f,
+    0.840635419f, 0.366876662f, -0.0426986031f, 0.0985262394f, 0.990622759f, 3.12671255e-05f,
+    0.82377696f, 0.381885231f, -0.0444254279f, 0.0965753943f, 0.990031064f, 4.17367082e-05f,
+    0.806264579f, 0.396176189f, -0.0460678376f, 0.0945455581f, 0.989343643f, 5.58497122e-05f,
+    0.787959814f, 0.409628123f, -0.0476166233f, 0.0924304426f, 0.988556802f, 7.48279999e-05f,
+    0.7690835f, 0.42231521f, -0.049070321f, 0.090240106f, 0.987666428f, 0.000100268502f,
+    0.749615014f, 0.434166312f, -0.0504276901f, 0.0879834145f, 0.986666083f, 0.000134241258f,
+    0.72958374f, 0.445163518f, -0.0516813584f, 0.0856583118f, 0.985544324f, 0.000179408089f,
+    0.708958149f, 0.455233365f, -0.052825667f, 0.0832661688f, 0.984291136f, 0.000239161134f,
+    0.687880635f, 0.464407772f, -0.0538632832f, 0.0808216631f, 0.982890666f, 0.000317787053f,
+    0.666340172f, 0.472635597f, -0.0547846109f, 0.0783197209f, 0.981326044f, 0.000420655386f,
+    0.644416869f, 0.479929328f, -0.0555913076f, 0.0757727101f, 0.979575694f, 0.000554430706f,
+    0.621947467f, 0.486096442f, -0.0562773682f, 0.073181428f, 0.977615595f, 0.000727313163f,
+    0.599335015f, 0.491401225f, -0.056837935f, 0.0705490038f, 0.975413978f, 0.000949302223f,
+    0.576350629f, 0.49560675f, -0.0572726801f, 0.0678840056f, 0.97293818f, 0.00123248238f,
+    0.552974463f, 0.498635292f, -0.0575761907f, 0.0651891306f, 0.970146835f, 0.00159133528f,
+    0.529421628f, 0.500599921f, -0.0577495769f, 0.0624698885f, 0.96703279f, 0.00204608939f,
+    0.505821347f, 0.501577795f, -0.0578060374f, 0.0597373545f, 0.963656902f, 0.0026294624f,
+    0.481970757f, 0.501299441f, -0.0577224679f, 0.0569889024f, 0.959818542f, 0.00335848425f,
+    0.458136141f, 0.4999834f, -0.0575201586f, 0.0542383008f, 0.955614865f, 0.00428242981f,
+    0.434294194f, 0.497515529f, -0.0571984611f, 0.0514859743f, 0.951026857f, 0.00545761036f,
+    0.410218835f, 0.493584454f, -0.0567229204f, 0.0487260818f, 0.94575125f, 0.00691190083f,
+    0.386490464f, 0.488771349f, -0.0561166927f, 0.0459870882f, 0.939673901f, 0.00869950093f,
+    0.36276406f, 0.482600689f, -0.0553646088f, 0.0432637557f, 0.932658255f, 0.010881871f,
+    0.339325279f, 0.475349128f, -0.0544786453f, 0.0405729823f, 0.92455256f, 0.0135278245f,
+    0.316113085f, 0.466857612f, -0.0534456298f, 0.0379021727f, 0.915336311f, 0.0167491809f,
+    0.293200165f, 0.457147628f, -0.0522876121f, 0.035274107f, 0.90481317f, 0.0206505451f,
+    0.270689994f, 0.446272373f, -0.0509891212f, 0.0326912776f, 0.892642975f, 0.0253170691f,
+    0.248608887f, 0.434195995f, -0.0495508388f, 0.0301642306f, 0.878507972f, 0.0308403317f,
+    0.227037743f, 0.42092067f, -0.0479616113f, 0.0276939161f, 0.862106144f, 0.0373198166f,
+    0.206107035f, 0.406599909f, -0.046240326f, 0.02529913f, 0.843097746f, 0.0448461547f,
+    0.185774341f, 0.391049564f, -0.0443769582f, 0.0229761153f, 0.821236312f, 0.0535414964f,
+    0.16621457f, 0.374518126f, -0.0423981696f, 0.0207370557f, 0.796315968f, 0.0635768026f,
+    0.147436649f, 0.356883645f, -0.0403116457f, 0.0185989924f, 0.767714441f, 0.07493072f,
+    0.129586846f, 0.338385105f, -0.0380828306f, 0.0165583268f, 0.734839916f, 0.0874697715f,
+    0.112704448f, 0.319022208f, -0.0357615165f, 0.0146358274f, 0.697494209f, 0.101146609f,
+    0.0968521833f, 0.298834026f, -0.0333470628f, 0.0128310053f, 0.65541774f, 0.115796804f,
+    0.0821479335f, 0.278031379f, -0.0308600683f, 0.0111545017f, 0.608365655f, 0.131045043f,
+    0.0687018037f, 0.256961942f, -0.0283274204f, 0.0096266605f, 0.555991948f, 0.145977214f,
+    0.0564653017f, 0.235249519f, -0.0257401094f, 0.00824426301f, 0.498584628f, 0.159574509f,
+    0.0456131473f, 0.213648081f, -0.0231712516f, 0.007035363f, 0.436787009f, 0.170223653f,
+    0.0361653753f, 0.192103207f, -0.0206461027f, 0.00600347528f, 0.372096419f, 0.176218599f,
+    0.0281435978f, 0.170837924f, -0.0182162654f, 0.00517151505f, 0.306624621f, 0.17508924f,
+    0.0215830281f, 0.14993827f, -0.0159846861f, 0.0045642741f, 0.24380751f, 0.165493071f,
+    0.0164872278f, 0.12958546f, -0.0140684359f, 0.0042310087f, 0.187432364f, 0.146737173f,
+    0.0132825496f, 0.113242701f, -0.0127935726f, 0.00432277657f, 0.141131699f, 0.120350137f,
+    0.0133432811f, 0.112259455f, -0.0131130973f, 0.0053681382f, 0.107033342f, 0.0908590183f,
+    1.0f, 0.0f, 0.0f, 0.133098096f, 0.993655026f, 2.18801824e-06f,
+    0.998902321f, 0.0331133641f, -0.00439039432f, 0.132417664f, 0.993621826f, 2.22212066e-06f,
+    0.996992469f, 0.0551223159f, -0.00730861956f, 0.132158458f, 0.993551433f, 2.31424337e-06f,
+    0.994067013f, 0.0770333484f, -0.010213187f, 0.131773204f, 0.993443966f, 2.47049161e-06f,
+    0.990209877f, 0.0988027528f, -0.0130981458f, 0.131256118f, 0.99329704f, 2.70088299e-06f,
+    0.985392094f, 0.120391123f, -0.0159582794f, 0.130612642f, 0.993111849f, 3.02000853e-06f,
+    0.979635656f, 0.141764089f, -0.0187881142f, 0.129843444f, 0.992886305f, 3.44796308e-06f,
+    0.972939849f, 0.162874997f, -0.0215818696f, 0.128947586f, 0.992619693f, 4.0116638e-06f,
+    0.965265512f, 0.183678925f, -0.0243342556f, 0.127927572f, 0.992310822f, 4.74665012e-06f,
+    0.956758201f, 0.204163954f, -0.0270407088f, 0.126789004f, 0.991957903f, 5.69952908e-06f,
+    0.94729495f, 0.224259675f, -0.0296950247f, 0.125529289f, 0.991557777f, 6.93132142e-06f,
+    0.936926544f, 0.243939459f, -0.0322912224f, 0.124147847f, 0.991110563f, 8.52191079e-06f,
+    0.925737441f, 0.263183415f, -0.0348251909f, 0.122651741f, 0.990611434f, 1.05760892e-05f,
+    0.913571477f, 0.281898379f, -0.0372902788f, 0.121038347f, 0.990058541f, 1.32315326e-05f,
+    0.900663912f, 0.300119132f, -0.0396832712f, 0.11931669f, 0.989448309f, 1.66693662e-05f,
+    0.88688463f, 0.31775856f, -0.0419977978f, 0.117485598f, 0.988775253f, 2.11280239e-05f,
+    0.872335076f, 0.334804654f, -0.0442300849f, 0.115551397f, 0.988036573f, 2.69210122e-05f,
+    0.857005358f, 0.351215571f, -0.0463743657f, 0.113514788f, 0.987226725f, 3.44597465e-05f,
+    0.840855896f, 0.366919279f, -0.0483971983f, 0.111419812f, 0.986700654f, 4.43193421e-05f,
+    0.824077785f, 0.381959319f, -0.0503180996f, 0.109247975f, 0.986206234f, 5.71475466e-05f,
+    0.806521893f, 0.396224052f, -0.0521422252f, 0.106974892f, 0.985561669f, 7.38463787e-05f,
+    0.788349032f, 0.409740388f, -0.0538660139f, 0.104609497f, 0.984765291f, 9.55958167e-05f,
+    0.769511819f, 0.422439843f, -0.0554839484f, 0.10215681f, 0.983813584f, 0.000123894089f,
+    0.750091136f, 0.434322685f, -0.0569920912f, 0.0996237174f, 0.982700408f, 0.000160635827f,
+    0.73004812f, 0.445313722f, -0.0583838858f, 0.097012721f, 0.981416881f, 0.000208202517f,
+    0.709586024f, 0.455485195f, -0.0596568212f, 0.0943328962f, 0.979953587f, 0.0002695648f,
+    0.688490808f, 0.464651734f, -0.0607991442f, 0.091578275f, 0.978295982f, 0.000348399684f,
+    0.667051256f, 0.472956985f, -0.0618158244f, 0.0887691528f, 0.976426959f, 0.000449222163f,
+    0.64514178f, 0.480260879f, -0.0627072975f, 0.0859055594f, 0.974396229f, 0.000580807391f,
+    0.622832417f, 0.486567736f, -0.063472189f, 0.0829890817f, 0.972229123f, 0.000754376582f,
+    0.600080788f, 0.491765022f, -0.0640912279f, 0.0800212175f, 0.969791055f, 0.00097525242f,
+    0.577169061f, 0.496048391f, -0.064586781f, 0.0770320818f, 0.967104197f, 0.00125817559f,
+    0.553877294f, 0.49915868f, -0.0649425611f, 0.0739978328f, 0.964232504f, 0.00162640924f,
+    0.53037709f, 0.501188874f, -0.0651682615f, 0.0709354579f, 0.961158454f, 0.00210644305f,
+    0.506728649f, 0.502131343f, -0.0652485341f, 0.067856811f, 0.957669377f, 0.0027114728f,
+    0.482958049f, 0.501953423f, -0.0651757568f, 0.0647628605f, 0.953702927f, 0.0034689249f,
+    0.459089577f, 0.500598431f, -0.064949885f, 0.0616630241f, 0.949181736f, 0.00441081775f,
+    0.435187995f, 0.498089135f, -0.0645577088f, 0.0585541092f, 0.944019496f, 0.00557418214f,
+    0.411338955f, 0.494427502f, -0.0640102178f, 0.0554551594f, 0.938123345f, 0.00700226612f,
+    0.387562394f, 0.48958239f, -0.0633246973f, 0.0523738228f, 0.931546509f, 0.00877270568f,
+    0.363926858f, 0.48354584f, -0.0624871217f, 0.0493101589f, 0.924113274f, 0.010946976f,
+    0.340536982f, 0.476388901f, -0.0614969358f, 0.0462771431f, 0.915606081f, 0.0135893514f,
+    0.317297965f, 0.467884749f, -0.0603341237f, 0.0432727076f, 0.905791044f, 0.0167656299f,
+    0.294377446f, 0.458183706f, -0.0590073839f, 0.0403125547f, 0.894462466f, 0.0205545165f,
+    0.271976799f, 0.447504908f, -0.0575308949f, 0.0374148563f, 0.88138938f, 0.0250373557f,
+    0.249990717f, 0.435612977f, -0.0558894761f, 0.0345774442f, 0.866315365f, 0.0302946102f,
+    0.228563294f, 0.422638416f, -0.0541071929f, 0.0318110883f, 0.849160492f, 0.0364720747f,
+    0.207688585f, 0.408491611f, -0.0521877818f, 0.0291206408f, 0.829685628f, 0.0437034592f,
+    0.187463075f, 0.393234432f, -0.0501157865f, 0.026514696f, 0.807356238f, 0.0520174466f,
+    0.16800575f, 0.376973748f, -0.047900755f, 0.02401191f, 0.781698585f, 0.0614022128f,
+    0.14935258f, 0.359724581f, -0.0455461256f, 0.0216137134f, 0.752500951f, 0.0719047859f,
+    0.131632954f, 0.341669798f, -0.0430878513f, 0.0193358809f, 0.719542742f, 0.0835634246f,
+    0.114792295f, 0.322547168f, -0.0405053906f, 0.0171743557f, 0.682473302f, 0.0962659642f,
+    0.0991776139f, 0.303206474f, -0.0378711633f, 0.0151658552f, 0.640945315f, 0.109752432f,
+    0.0846032202f, 0.283041835f, -0.0351369418f, 0.0132997306f, 0.594651401f, 0.123465292f,
+    0.071271956f, 0.262559891f, -0.0323517472f, 0.0115973419f, 0.543635547f, 0.136718974f,
+    0.0591791905f, 0.241763085f, -0.0295419786f, 0.0100709843f, 0.488249958f, 0.148485661f,
+    0.0484846011f, 0.221133426f, -0.0267715137f, 0.00873709843f, 0.429414421f, 0.157660514f,
+    0.0390741564f, 0.200269595f, -0.0240454711f, 0.00760835316f, 0.368290067f, 0.162304416f,
+    0.0310559273f, 0.179512903f, -0.0214567073f, 0.00670525897f, 0.30726102f, 0.161197603f,
+    0.0245046895f, 0.159250706f, -0.0191022996f, 0.00606881781f, 0.248988301f, 0.152881086f,
+    0.0195254702f, 0.140273318f, -0.017158309f, 0.0057755271f, 0.196668699f, 0.137084991f,
+    0.0166323818f, 0.12673004f, -0.0160135962f, 0.00602923892f, 0.153187856f, 0.115123436f,
+    0.0172032882f, 0.127795726f, -0.0165526457f, 0.00741721177f, 0.12017481f, 0.0902175009f,
+    1.0f, 0.0f, 0.0f, 0.149430424f, 0.991526961f, 2.90048956e-06f,
+    0.998884082f, 0.0331110209f, -0.00492708199f, 0.148798123f, 0.991491139f, 2.95248788e-06f,
+    0.996974528f, 0.0551168025f, -0.00819776487f, 0.148510724f, 0.9914096f, 3.09773282e-06f,
+    0.994069934f, 0.0770239234f, -0.0114526497f, 0.148075238f, 0.991282642f, 3.34506603e-06f,
+    0.990237415f, 0.098792322f, -0.0146857891f, 0.147498414f, 0.991108f, 3.70836119e-06f,
+    0.985433042f, 0.120380424f, -0.0178904086f, 0.146775633f, 0.990887046f, 4.20720426e-06f,
+    0.979652286f, 0.141743526f, -0.0210603196f, 0.145909622f, 0.990617216f, 4.8677507e-06f,
+    0.972990274f, 0.162857056f, -0.0241898987f, 0.144906372f, 0.990296602f, 5.72393037e-06f,
+    0.965365887f, 0.183666736f, -0.0272722617f, 0.14376238f, 0.98992449f, 6.81895744e-06f,
+    0.956827581f, 0.204141572f, -0.0303017348f, 0.142482281f, 0.989497781f, 8.20735022e-06f,
+    0.947396457f, 0.224242851f, -0.0332717933f, 0.141066611f, 0.98901391f, 9.95754272e-06f,
+    0.937071979f, 0.243930936f, -0.0361773632f, 0.139521211f, 0.988469779f, 1.21552357e-05f,
+    0.925870121f, 0.263165414f, -0.0390103944f, 0.137840718f, 0.987862289f, 1.49077805e-05f,
+    0.913811862f, 0.281914473f, -0.0417662077f, 0.136033401f, 0.987186313f, 1.83497559e-05f,
+    0.90088743f, 0.300127804f, -0.044438418f, 0.134100556f, 0.986438453f, 2.26501852e-05f,
+    0.887130857f, 0.317773521f, -0.0470213518f, 0.132046074f, 0.985611022f, 2.80214244e-05f,
+    0.87259984f, 0.334827274f, -0.0495110638f, 0.129878402f, 0.98470068f, 3.47306304e-05f,
+    0.857315958f, 0.351254463f, -0.0518998206f, 0.127595305f, 0.983698845f, 4.31138469e-05f,
+    0.841343582f, 0.367033571f, -0.0541852899f, 0.125208244f, 0.982598603f, 5.35928302e-05f,
+    0.824620783f, 0.382107258f, -0.0563582927f, 0.122712895f, 0.981390178f, 6.66964406e-05f,
+    0.807236552f, 0.396464616f, -0.0584154464f, 0.120117761f, 0.980064809f, 8.30851859e-05f,
+    0.789125681f, 0.410022616f, -0.0603509694f, 0.117426246f, 0.978610396f, 0.000103582082f,
+    0.77042371f, 0.422818244f, -0.0621590316f, 0.114640906f, 0.977030814f, 0.000129453008f,
+    0.751030982f, 0.434718013f, -0.0638208538f, 0.111846492f, 0.976054311f, 0.00016662202f,
+    0.731120884f, 0.445799559f, -0.0653587952f, 0.108966276f, 0.97485739f, 0.000214214786f,
+    0.71059972f, 0.455948204f, -0.0667594671f, 0.105993636f, 0.973431885f, 0.000274957798f,
+    0.689546883f, 0.465149969f, -0.0680327863f, 0.102944024f, 0.97184521f, 0.00035518597f,
+    0.668018878f, 0.473406941f, -0.0691762641f, 0.0998228714f, 0.970107436f, 0.000461796881f,
+    0.646129012f, 0.480740041f, -0.070181191f, 0.0966390669f, 0.968155921f, 0.000600405561f,
+    0.623801231f, 0.487032413f, -0.0710536763f, 0.0933935791f, 0.966079235f, 0.000786766701f,
+    0.601160884f, 0.49233216f, -0.0717731416f, 0.0900961682f, 0.963710248f, 0.00102535693f,
+    0.578171909f, 0.496567369f, -0.0723327994f, 0.0867509916f, 0.961016119f, 0.00132881722f,
+    0.554920971f, 0.499721766f, -0.0727329776f, 0.0833701715f, 0.957958281f, 0.00171223935f,
+    0.531451404f, 0.501783729f, -0.0729628056f, 0.0799529403f, 0.954488754f, 0.0021934961f,
+    0.507946908f, 0.502885699f, -0.0730380192f, 0.076527819f, 0.950552702f, 0.00279355166f,
+    0.484096676f, 0.502636313f, -0.0729349852f, 0.0730706602f, 0.946158886f, 0.0035446363f,
+    0.460315138f, 0.501400292f, -0.0726762116f, 0.0696104169f, 0.941272736f, 0.0044851061f,
+    0.436451465f, 0.498949349f, -0.0722567812f, 0.0661466196f, 0.935853362f, 0.00566149969f,
+    0.412641734f, 0.495351583f, -0.0716613904f, 0.0626872778f, 0.929690897f, 0.00710869348f,
+    0.388903379f, 0.490563065f, -0.0708886608f, 0.059244711f, 0.922638834f, 0.008871492f,
+    0.365417957f, 0.484751165f, -0.069948487f, 0.0558367856f, 0.914559901f, 0.0110034524f,
+    0.341996104f, 0.477570325f, -0.0688080266f, 0.0524471439f, 0.905297637f, 0.0135628255f,
+    0.318888932f, 0.469289988f, -0.0674965978f, 0.0491087995f, 0.894679666f, 0.0166115705f,
+    0.296184301f, 0.459958732f, -0.066018112f, 0.0458281413f, 0.882573545f, 0.0202287771f,
+    0.273778439f, 0.449321479f, -0.0643631369f, 0.042594038f, 0.868926227f, 0.0245348308f,
+    0.251899958f, 0.437660366f, -0.0625658035f, 0.0394337326f, 0.853550494f, 0.029644873f,
+    0.230483755f, 0.424781919f, -0.0605894476f, 0.0363505669f, 0.835913002f, 0.0355745666f,
+    0.209702417f, 0.410857081f, -0.058442343f, 0.0333555415f, 0.815771878f, 0.0423958674f,
+    0.189646035f, 0.396007776f, -0.0561442003f, 0.0304694511f, 0.792793691f, 0.0501426123f,
+    0.170304582f, 0.380110443f, -0.0537014306f, 0.0276876036f, 0.766902566f, 0.0589431413f,
+    0.151810616f, 0.363330483f, -0.0511270799f, 0.0250245966f, 0.737751544f, 0.0688030347f,
+    0.134209678f, 0.345708996f, -0.0484455861f, 0.0224936269f, 0.705086946f, 0.0797300115f,
+    0.117550671f, 0.327224344f, -0.0456318632f, 0.0201059058f, 0.668283761f, 0.0913910791f,
+    0.102082618f, 0.308508098f, -0.042743884f, 0.0178802572f, 0.627375424f, 0.103638791f,
+    0.0876775384f, 0.289069593f, -0.0397819728f, 0.0158273634f, 0.582122028f, 0.115919255f,
+    0.0744603872f, 0.269290924f, -0.0367613174f, 0.0139526874f, 0.532756209f, 0.127626047f,
+    0.062522918f, 0.249385461f, -0.0337597467f, 0.0122805694f, 0.479816049f, 0.13804625f,
+    0.0518580563f, 0.229276747f, -0.0307732299f, 0.0108236866f, 0.423875898f, 0.145743027f,
+    0.0426165797f, 0.209551543f, -0.0279085096f, 0.00960894022f, 0.366551787f, 0.149741068f,
+    0.0346578769f, 0.189604312f, -0.0251858328f, 0.00864963327f, 0.309634119f, 0.148696885f,
+    0.0280672126f, 0.169804543f, -0.0227320604f, 0.00799786672f, 0.25554204f, 0.141741246f,
+    0.0233536214f, 0.153066263f, -0.020801669f, 0.00777598796f, 0.206846565f, 0.128655776f,
+    0.0205485914f, 0.140303582f, -0.0196969528f, 0.00819261931f, 0.165837973f, 0.11038886f,
+    0.0218044277f, 0.144126415f, -0.0205292255f, 0.0100047095f, 0.133833125f, 0.0893265903f,
+    1.0f, 0.0f, 0.0f, 0.166710764f, 0.989051819f, 3.62125797e-06f,
+    0.998896956f, 0.0331054814f, -0.00549316034f, 0.166089952f, 0.989018202f, 3.72706404e-06f,
+    0.996999204f, 0.0551093407f, -0.00912810583f, 0.16577211f, 0.988926649f, 3.96184669e-06f,
+    0.994094729f, 0.0770086125f, -0.0127451355f, 0.165286571f, 0.988776803f, 4.33707055e-06f,
+    0.99027127f, 0.0987729058f, -0.0163373761f, 0.164641723f, 0.988568366f, 4.86821955e-06f,
+    0.985463262f, 0.120355047f, -0.0198975541f, 0.163837403f, 0.988299549f, 5.57504518e-06f,
+    0.97970289f, 0.141717464f, -0.023418285f, 0.162873149f, 0.987968862f, 6.48173682e-06f,
+    0.973039567f, 0.162824824f, -0.0268922895f, 0.161751047f, 0.987572908f, 7.61700358e-06f,
+    0.965467989f, 0.183639869f, -0.0303138625f, 0.160480127f, 0.987110615f, 9.01397107e-06f,
+    0.956980467f, 0.204119742f, -0.0336746722f, 0.159055084f, 0.986577988f, 1.07099777e-05f,
+    0.947539747f, 0.224215597f, -0.0369668566f, 0.157474875f, 0.985971928f, 1.2746169e-05f,
+    0.937252641f, 0.243905604f, -0.0401843414f, 0.155747205f, 0.985288143f, 1.5166831e-05f,
+    0.926074803f, 0.263144612f, -0.0433206968f, 0.153876111f, 0.984522045f, 1.80185525e-05f,
+    0.914050102f, 0.28190127f, -0.0463683605f, 0.151862755f, 0.983668327f, 2.13490621e-05f,
+    0.901123524f, 0.300109565f, -0.0493200719f, 0.149708614f, 0.982721627f, 2.52059363e-05f,
+    0.887468219f, 0.317788243f, -0.0521725677f, 0.147428006f, 0.981674373f, 2.96349608e-05f,
+    0.873015165f, 0.334866077f, -0.0549195968f, 0.145016968f, 0.980538368f, 3.49022521e-05f,
+    0.857777417f, 0.351306021f, -0.0575786307f, 0.142487332f, 0.979450583f, 4.32835004e-05f,
+    0.841858149f, 0.367114305f, -0.0601198748f, 0.13983652f, 0.978251159f, 5.36580483e-05f,
+    0.82520324f, 0.382220954f, -0.0625383705f, 0.137071267f, 0.976934552f, 6.64873223e-05f,
+    0.807789564f, 0.396556288f, -0.0648237392f, 0.134186983f, 0.975488782f, 8.23569426e-05f,
+    0.789754331f, 0.410159498f, -0.0670030564f, 0.131204844f, 0.974076748f, 0.000105876716f,
+    0.77102071f, 0.42293492f, -0.0690389127f, 0.128112748f, 0.972523391f, 0.000135892929f,
+    0.751832902f, 0.434968352f, -0.0709364712f, 0.124935947f, 0.970817804f, 0.000174078974f,
+    0.731913865f, 0.446054727f, -0.0726916716f, 0.121655971f, 0.969035983f, 0.000225897951f,
+    0.711463451f, 0.456257075f, -0.0743108168f, 0.118294366f, 0.967179f, 0.000296766986f,
+    0.690465748f, 0.465517223f, -0.0757668316f, 0.114845186f, 0.965131819f, 0.000388289773f,
+    0.669113219f, 0.473903179f, -0.0770398006f, 0.111421563f, 0.963467836f, 0.000505823584f,
+    0.647187829f, 0.481203318f, -0.0781333819f, 0.107910246f, 0.961581409f, 0.000655857672f,
+    0.624913454f, 0.487551242f, -0.0790737346f, 0.104346231f, 0.959365547f, 0.000846237061f,
+    0.602282584f, 0.492862135f, -0.0798331127f, 0.100707129f, 0.956792533f, 0.0010863418f,
+    0.579473197f, 0.497245759f, -0.0804312304f, 0.0970328748f, 0.953831375f, 0.00138729939f,
+    0.556272864f, 0.500464201f, -0.0808677748f, 0.0933056101f, 0.95061475f, 0.00177669327f,
+    0.532880247f, 0.502610922f, -0.0811175779f, 0.0895330682f, 0.946963727f, 0.00226481538f,
+    0.509281218f, 0.50362736f, -0.0812067166f, 0.0857356489f, 0.942958772f, 0.00288763363f,
+    0.485506475f, 0.503480613f, -0.0811059326f, 0.0819172412f, 0.938387513f, 0.00365997944f,
+    0.461859375f, 0.502395213f, -0.0808182806f, 0.0780935213f, 0.933174491f, 0.00461133104f,
+    0.438002229f, 0.499966919f, -0.0803280771f, 0.0742612705f, 0.92723161f, 0.00577516295f,
+    0.41432029f, 0.496530741f, -0.079648681f, 0.0704452395f, 0.920457006f, 0.00718897302f,
+    0.39067319f, 0.491892248f, -0.0787689686f, 0.0666467249f, 0.912735403f, 0.00889408682f,
+    0.367302477f, 0.486250669f, -0.0776922926f, 0.0628772005f, 0.903962433f, 0.0109394277f,
+    0.343996912f, 0.479266703f, -0.0764340311f, 0.0591426864f, 0.894149423f, 0.0134073002f,
+    0.32091713f, 0.471068621f, -0.074997358f, 0.0554512925f, 0.883173883f, 0.0163771473f,
+    0.298250735f, 0.461836755f, -0.0733767971f, 0.0518118925f, 0.870812833f, 0.0199221149f,
+    0.275991172f, 0.451483518f, -0.0715698674f, 0.0482413247f, 0.856772482f, 0.0240935404f,
+    0.254193842f, 0.440008819f, -0.0695733726f, 0.0447554514f, 0.840718627f, 0.0289327167f,
+    0.232994065f, 0.427569151f, -0.0673887655f, 0.0413629822f, 0.822424829f, 0.0344933197f,
+    0.212312952f, 0.413938254f, -0.0650295764f, 0.0380573496f, 0.801930487f, 0.0409262441f,
+    0.192413628f, 0.399507076f, -0.0625414401f, 0.0348739997f, 0.778941274f, 0.0482924916f,
+    0.173211828f, 0.384002268f, -0.059893772f, 0.0318043828f, 0.753129721f, 0.0566247292f,
+    0.15489392f, 0.367758095f, -0.0571087971f, 0.0288772397f, 0.72404784f, 0.0658507645f,
+    0.137426868f, 0.35061413f, -0.054173775f, 0.0260945577f, 0.691418707f, 0.0758571923f,
+    0.121062599f, 0.333095163f, -0.0511545204f, 0.0234827325f, 0.655183017f, 0.0865761414f,
+    0.105691835f, 0.314882725f, -0.0480250716f, 0.0210461039f, 0.615015507f, 0.0975933671f,
+    0.0914874673f, 0.296324909f, -0.0448418669f, 0.0188023709f, 0.571120679f, 0.108605258f,
+    0.0784360915f, 0.277409434f, -0.0416448899f, 0.0167651158f, 0.523748398f, 0.119126849f,
+    0.0666342899f, 0.258370936f, -0.0384465158f, 0.0149558373f, 0.473139256f, 0.128139213f,
+    0.0560079738f, 0.238806188f, -0.0352643542f, 0.0133739561f, 0.420328021f, 0.134849072f,
+    0.0466681235f, 0.219158828f, -0.0322333239f, 0.0120660719f, 0.366618037f, 0.138395369f,
+    0.0389127024f, 0.200663462f, -0.0294417031f, 0.0110775987f, 0.313585758f, 0.137652531f,
+    0.0322823562f, 0.181172028f, -0.0268941782f, 0.0104251951f, 0.263258725f, 0.131939739f,
+    0.0273270421f, 0.163509846f, -0.0248591788f, 0.0102521162f, 0.217769086f, 0.121140108f,
+    0.0254637897f, 0.15618448f, -0.024063088f, 0.0109801339f, 0.178970367f, 0.1059919f,
+    0.0271296222f, 0.160523474f, -0.0250462499f, 0.0132078184f, 0.147929937f, 0.0882045627f,
+    1.0f, 0.0f, 0.0f, 0.184846178f, 0.985955179f, 4.29510828e-06f,
+    0.998924971f, 0.0330984592f, -0.00608714158f, 0.184252009f, 0.985924065f, 4.53439588e-06f,
+    0.997011304f, 0.0550934672f, -0.0100892251f, 0.183895811f, 0.98581624f, 4.87791885e-06f,
+    0.994126737f, 0.0769895837f, -0.0140712783f, 0.183359668f, 0.985631108f, 5.33622961e-06f,
+    0.990315199f, 0.0987457186f, -0.0180253554f, 0.182648614f, 0.98536694f, 5.91522894e-06f,
+    0.985514939f, 0.120319955f, -0.0219417457f, 0.181750566f, 0.985021889f, 6.61513832e-06f,
+    0.979783714f, 0.14167884f, -0.0258138794f, 0.180683672f, 0.984595358f, 7.4285872e-06f,
+    0.973142862f, 0.162783325f, -0.0296329577f, 0.179443359f, 0.984083712f, 8.33773629e-06f,
+    0.965577543f, 0.183589339f, -0.0333904848f, 0.178030133f, 0.983484149f, 9.31022169e-06f,
+    0.957127392f, 0.204068929f, -0.0370791294f, 0.17645067f, 0.982791781f, 1.02939393e-05f,
+    0.947745383f, 0.224168032f, -0.0407014601f, 0.174707353f, 0.982071579f, 1.16403926e-05f,
+    0.93745929f, 0.243857265f, -0.0442587845f, 0.172805473f, 0.981368721f, 1.39113463e-05f,
+    0.926301897f, 0.263098538f, -0.0477261394f, 0.170743689f, 0.980573952f, 1.65713082e-05f,
+    0.914278209f, 0.2818501f, -0.0510967337f, 0.168528631f, 0.979682028f, 1.96479214e-05f,
+    0.901462138f, 0.300090522f, -0.0543615036f, 0.16615878f, 0.978686512f, 2.3161052e-05f,
+    0.88783139f, 0.317772418f, -0.057542216f, 0.163653597f, 0.977728426f, 2.88274259e-05f,
+    0.873446524f, 0.33487317f, -0.0606114566f, 0.161007643f, 0.976691306f, 3.61545353e-05f,
+    0.858311296f, 0.351355195f, -0.0635564774f, 0.158220679f, 0.975540936f, 4.5202949e-05f,
+    0.842370689f, 0.367152423f, -0.066368863f, 0.155294314f, 0.974270761f, 5.63365575e-05f,
+    0.825762868f, 0.382273257f, -0.0690460801f, 0.152244151f, 0.972869277f, 6.99916636e-05f,
+    0.808406711f, 0.396641612f, -0.0716079846f, 0.149067715f, 0.9714939f, 9.07555805e-05f,
+    0.790405333f, 0.410255969f, -0.0740291476f, 0.145775333f, 0.970010877f, 0.000118331453f,
+    0.771801651f, 0.423100799f, -0.0762970299f, 0.142370731f, 0.968379319f, 0.000153835106f,
+    0.752502918f, 0.435069084f, -0.0783998519f, 0.138849437f, 0.966583788f, 0.000199353643f,
+    0.732724607f, 0.446231604f, -0.0803407282f, 0.135234937f, 0.964607239f, 0.000257450476f,
+    0.712310374f, 0.456457496f, -0.0821054429f, 0.131519198f, 0.962430716f, 0.00033125066f,
+    0.691496313f, 0.465836942f, -0.0836967379f, 0.127723083f, 0.960033953f, 0.000424535276f,
+    0.670125782f, 0.47421205f, -0.0851014778f, 0.123841509f, 0.957391083f, 0.000541846675f,
+    0.648413897f, 0.481693625f, -0.0863432214f, 0.119895265f, 0.954592168f, 0.000695029448f,
+    0.626251936f, 0.488143981f, -0.0873994976f, 0.115877762f, 0.951558769f, 0.000891390897f,
+    0.603745222f, 0.49357447f, -0.0882614926f, 0.111825727f, 0.948487639f, 0.00114352349f,
+    0.580976903f, 0.498006076f, -0.0889325663f, 0.107817486f, 0.945688963f, 0.00146659708f,
+    0.557783782f, 0.501229823f, -0.0893967152f, 0.103740655f, 0.942420661f, 0.00187055429f,
+    0.534455121f, 0.503438234f, -0.0896591991f, 0.0996180922f, 0.938635647f, 0.00237240572f,
+    0.510969281f, 0.504574955f, -0.0897229239f, 0.0954684615f, 0.934279144f, 0.0029917846f,
+    0.487365901f, 0.504603624f, -0.089579083f, 0.091296792f, 0.929286897f, 0.00375111122f,
+    0.463714272f, 0.503536344f, -0.0892199427f, 0.0871095955f, 0.923587143f, 0.00467565982f,
+    0.440095574f, 0.501392841f, -0.0886550099f, 0.0829277933f, 0.917110801f, 0.00579538895f,
+    0.416479647f, 0.498073488f, -0.0878867581f, 0.0787494853f, 0.90988493f, 0.00716040237f,
+    0.392836422f, 0.493457317f, -0.0869160444f, 0.074578844f, 0.901871085f, 0.00882536173f,
+    0.3695274f, 0.487934083f, -0.0857879817f, 0.0704467893f, 0.893100262f, 0.0108723668f,
+    0.346374184f, 0.481203258f, -0.0844338834f, 0.0663491264f, 0.883087158f, 0.0133090308f,
+    0.323509872f, 0.473338842f, -0.0828589275f, 0.0623031072f, 0.871666789f, 0.0161850844f,
+    0.300809622f, 0.464105457f, -0.0810529068f, 0.0583135933f, 0.858659267f, 0.0195495412f,
+    0.278767854f, 0.454157054f, -0.0790533498f, 0.0544152409f, 0.843911231f, 0.0234575775f,
+    0.25709483f, 0.442956239f, -0.0768886879f, 0.0505930297f, 0.827651024f, 0.0280828383f,
+    0.236109346f, 0.430969954f, -0.0745515674f, 0.046878919f, 0.809341967f, 0.0334275551f,
+    0.215558484f, 0.417676747f, -0.0720198378f, 0.0432636067f, 0.788789153f, 0.0395591632f,
+    0.195843294f, 0.403686762f, -0.0693337247f, 0.0397791602f, 0.765734494f, 0.0465278924f,
+    0.176786587f, 0.388638973f, -0.0664537624f, 0.036427293f, 0.739733636f, 0.0542525388f,
+    0.158701122f, 0.373087257f, -0.0634631887f, 0.0332423635f, 0.710785389f, 0.0627903044f,
+    0.141551763f, 0.35689494f, -0.0603354126f, 0.0302231945f, 0.678560019f, 0.0720036551f,
+    0.125288919f, 0.339853764f, -0.0570744313f, 0.0273802094f, 0.642890513f, 0.0816879645f,
+    0.110111631f, 0.322409481f, -0.0537528396f, 0.0247386228f, 0.603907585f, 0.0916961879f,
+    0.0960845202f, 0.304674387f, -0.0503859334f, 0.0223084111f, 0.561635733f, 0.101667441f,
+    0.0832278877f, 0.286762297f, -0.0469936058f, 0.0201135837f, 0.516171992f, 0.110926412f,
+    0.0713787824f, 0.267868787f, -0.0436004922f, 0.0181608237f, 0.468144149f, 0.11885874f,
+    0.0609527975f, 0.249555156f, -0.0403088257f, 0.0164793115f, 0.418508649f, 0.124941334f,
+    0.0516581349f, 0.230529428f, -0.0371305533f, 0.0150951827f, 0.368183553f, 0.128071025f,
+    0.0436489843f, 0.211450964f, -0.0341997892f, 0.0140596516f, 0.3187626f, 0.127692416f,
+    0.0373028368f, 0.193828031f, -0.0316290334f, 0.0134490347f, 0.271872073f, 0.123131648f,
+    0.0327209122f, 0.17873399f, -0.0297212619f, 0.0134474458f, 0.22927314f, 0.114306271f,
+    0.0310967341f, 0.172008425f, -0.0289771724f, 0.0144219166f, 0.192489907f, 0.101856008f,
+    0.0333635435f, 0.177503765f, -0.0301554333f, 0.0171370655f, 0.162388325f, 0.086872302f,
+    1.0f, 0.0f, 0.0f, 0.203838974f, 0.982220292f, 4.93799826e-06f,
+    0.99892503f, 0.0330850258f, -0.00668340595f, 0.203223065f, 0.981979489f, 4.94653159e-06f,
+    0.997007132f, 0.0550702959f, -0.0110616805f, 0.202816665f, 0.981727004f, 5.1150796e-06f,
+    0.994137764f, 0.0769507214f, -0.0153994961f, 0.202225253f, 0.981491327f, 5.36576999e-06f,
+    0.990317583f, 0.098697938f, -0.0197266899f, 0.201451555f, 0.981275916f, 5.8673827e-06f,
+    0.985582292f, 0.120269619f, -0.0240260474f, 0.200492144f, 0.981023133f, 6.59642637e-06f,
+    0.979882538f, 0.141621709f, -0.0282780379f, 0.199338332f, 0.980675459f, 7.38947301e-06f,
+    0.973252058f, 0.162719429f, -0.0324730091f, 0.19799006f, 0.980229616f, 8.2368415e-06f,
+    0.965735674f, 0.183527768f, -0.0366028212f, 0.196456119f, 0.979683042f, 9.10977633e-06f,
+    0.957297504f, 0.204001933f, -0.0406856388f, 0.194745556f, 0.979180634f, 1.08524209e-05f,
+    0.947957098f, 0.224103466f, -0.0446930937f, 0.192853764f, 0.978610158f, 1.31402576e-05f,
+    0.937734187f, 0.243800357f, -0.0486112721f, 0.190781698f, 0.977937937f, 1.58935272e-05f,
+    0.926603556f, 0.263039708f, -0.0524294823f, 0.188526019f, 0.977163672f, 1.91655618e-05f,
+    0.914627433f, 0.281796515f, -0.0561410263f, 0.186098173f, 0.976278543f, 2.30039514e-05f,
+    0.901862323f, 0.300048381f, -0.0597379841f, 0.183504447f, 0.97527957f, 2.74463928e-05f,
+    0.888239264f, 0.317729622f, -0.0632227734f, 0.18075034f, 0.97420913f, 3.318565e-05f,
+    0.873880088f, 0.334836125f, -0.0666115955f, 0.17784816f, 0.973163724f, 4.24095524e-05f,
+    0.858748019f, 0.351314306f, -0.0698650256f, 0.174791723f, 0.971997619f, 5.41234804e-05f,
+    0.842915773f, 0.367145002f, -0.0729743317f, 0.171584025f, 0.970701993f, 6.89474327e-05f,
+    0.826384962f, 0.382301509f, -0.0759357437f, 0.168239966f, 0.969266295f, 8.76417325e-05f,
+    0.809043705f, 0.396668136f, -0.0787330642f, 0.16474615f, 0.967681348f, 0.000111132998f,
+    0.791174173f, 0.410346866f, -0.0813695639f, 0.161131725f, 0.965933323f, 0.000140544274f,
+    0.772593021f, 0.423193276f, -0.0838314071f, 0.157389134f, 0.964007378f, 0.000177228445f,
+    0.753488302f, 0.435265541f, -0.0861169398f, 0.153535247f, 0.961888611f, 0.000222805524f,
+    0.733731151f, 0.446437478f, -0.0882316381f, 0.1495689f, 0.959644854f, 0.000282283843f,
+    0.713412881f, 0.456720948f, -0.0901673213f, 0.145490348f, 0.957267821f, 0.000360472419f,
+    0.692700744f, 0.466161996f, -0.0919157639f, 0.141330302f, 0.954654098f, 0.00045875166f,
+    0.671409845f, 0.474601597f, -0.0934893787f, 0.137072653f, 0.951949418f, 0.000590791984f,
+    0.649729609f, 0.482105166f, -0.094862707f, 0.132742301f, 0.948961675f, 0.000757471484f,
+    0.62768966f, 0.488642633f, -0.0960239395f, 0.128338531f, 0.945659816f, 0.000966677617f,
+    0.605325997f, 0.49419564f, -0.0969713181f, 0.123874664f, 0.942005157f, 0.00122772111f,
+    0.58261919f, 0.498696804f, -0.0976962298f, 0.119355291f, 0.937955379f, 0.00155147805f,
+    0.559584081f, 0.502088428f, -0.0981924385f, 0.114788182f, 0.933461905f, 0.00195052242f,
+    0.536473691f, 0.504534781f, -0.0984632969f, 0.110203952f, 0.928532183f, 0.00243924069f,
+    0.513118923f, 0.505801499f, -0.0984934717f, 0.105714679f, 0.923934162f, 0.00304060103f,
+    0.489605218f, 0.505934358f, -0.0983242691f, 0.101199225f, 0.918804049f, 0.00378518458f,
+    0.466094047f, 0.505029082f, -0.0979377031f, 0.096660234f, 0.913033664f, 0.00469924649f,
+    0.442488581f, 0.502922535f, -0.0973577574f, 0.0921090692f, 0.906700313f, 0.00583695108f,
+    0.419006735f, 0.49978289f, -0.0965530649f, 0.0875645354f, 0.899504006f, 0.00721529592f,
+    0.395603865f, 0.495503694f, -0.0955222473f, 0.0830483735f, 0.891280949f, 0.00886392407f,
+    0.372396827f, 0.490143418f, -0.0942432582f, 0.0785554796f, 0.881911039f, 0.010820345f,
+    0.349385142f, 0.483649492f, -0.0927428827f, 0.0741139054f, 0.87133038f, 0.0131332763f,
+    0.326564133f, 0.475891083f, -0.0910046399f, 0.0697071254f, 0.859515369f, 0.015872838f,
+    0.304211676f, 0.467239052f, -0.0891037583f, 0.0653914437f, 0.846399128f, 0.019125225f,
+    0.282298028f, 0.457547456f, -0.0869775191f, 0.0611458011f, 0.831674695f, 0.0229263827f,
+    0.260826796f, 0.446788102f, -0.0846499652f, 0.056994088f, 0.815190613f, 0.0273420326f,
+    0.239930689f, 0.435053259f, -0.0821333379f, 0.0529495105f, 0.796769619f, 0.0324468203f,
+    0.219712764f, 0.422463924f, -0.0794227198f, 0.0490398966f, 0.775995195f, 0.038212277f,
+    0.20017007f, 0.408985853f, -0.0765206441f, 0.0452665463f, 0.752743423f, 0.0446733981f,
+    0.181334376f, 0.394561321f, -0.0734655708f, 0.0416475497f, 0.726917088f, 0.0518769808f,
+    0.163486838f, 0.379689276f, -0.0702495947f, 0.0381994285f, 0.698177278f, 0.0597094297f,
+    0.146458238f, 0.363981366f, -0.0669006705f, 0.0349357128f, 0.666465998f, 0.0681009069f,
+    0.13049379f, 0.347985238f, -0.0634944215f, 0.0318822935f, 0.631875634f, 0.0770117417f,
+    0.115444273f, 0.331097901f, -0.0599627383f, 0.02902475f, 0.594181061f, 0.0861029997f,
+    0.101638041f, 0.314406633f, -0.0564304963f, 0.0264304969f, 0.553491354f, 0.0949876904f,
+    0.0887292624f, 0.296680629f, -0.0528483726f, 0.0240760949f, 0.51015079f, 0.103201099f,
+    0.0771035701f, 0.27898103f, -0.0493220091f, 0.0219905339f, 0.464866698f, 0.110440023f,
+    0.0663726777f, 0.259885222f, -0.0458283722f, 0.020187635f, 0.418150961f, 0.11583823f,
+    0.0574438646f, 0.242682502f, -0.0426216498f, 0.0187737383f, 0.371141583f, 0.118870899f,
+    0.049376186f, 0.223833457f, -0.0395598151f, 0.0177091174f, 0.325013012f, 0.118797608f,
+    0.0431330167f, 0.207212433f, -0.0369740613f, 0.0171634965f, 0.281250417f, 0.115299478f,
+    0.0388635583f, 0.193724632f, -0.0351040661f, 0.0173304845f, 0.241255492f, 0.108142115f,
+    0.0374660492f, 0.187889963f, -0.0344604701f, 0.0186135136f, 0.206310198f, 0.0979439393f,
+    0.0405323468f, 0.195133522f, -0.0358983278f, 0.0219108108f, 0.177133411f, 0.0853532925f,
+    1.0f, 0.0f, 0.0f, 0.223684877f, 0.978067458f, 5.75756349e-06f,
+    0.998923779f, 0.0330555625f, -0.00717279827f, 0.223089591f, 0.977942348f, 5.61849038e-06f,
+    0.997003734f, 0.0550240241f, -0.0119694034f, 0.222652227f, 0.977717102f, 5.51147241e-06f,
+    0.994168222f, 0.0769030973f, -0.0167674534f, 0.222016647f, 0.977535486f, 5.86871647e-06f,
+    0.990354955f, 0.098645702f, -0.0215384979f, 0.221168533f, 0.977295756f, 6.52390781e-06f,
+    0.985635996f, 0.120210052f, -0.0262668971f, 0.220112547f, 0.976961792f, 7.39818006e-06f,
+    0.979969025f, 0.141558319f, -0.0309411436f, 0.218838945f, 0.976533294f, 8.49815206e-06f,
+    0.973379374f, 0.162651986f, -0.0355521105f, 0.217357755f, 0.976005912f, 9.82317852e-06f,
+    0.965879381f, 0.183451876f, -0.0400812589f, 0.215680778f, 0.975450099f, 1.14337108e-05f,
+    0.957485139f, 0.203920245f, -0.0445143282f, 0.213822588f, 0.974915802f, 1.3313329e-05f,
+    0.94818747f, 0.224016994f, -0.0488575958f, 0.211760417f, 0.974259853f, 1.52587136e-05f,
+    0.938024819f, 0.243714958f, -0.053135097f, 0.209513098f, 0.973612309f, 1.83912125e-05f,
+    0.927001715f, 0.262973249f, -0.057323724f, 0.207075834f, 0.972914636f, 2.28560439e-05f,
+    0.91506952f, 0.281738728f, -0.0613956824f, 0.20444043f, 0.972097039f, 2.83850586e-05f,
+    0.902346551f, 0.299994022f, -0.0653433651f, 0.201618642f, 0.971154392f, 3.52082679e-05f,
+    0.888784766f, 0.317684233f, -0.0691585317f, 0.19861944f, 0.970080078f, 4.35927213e-05f,
+    0.874460101f, 0.334795952f, -0.0728315189f, 0.195446014f, 0.968866348f, 5.38470958e-05f,
+    0.859414458f, 0.351299524f, -0.0763556063f, 0.192109734f, 0.967505693f, 6.63267565e-05f,
+    0.843630373f, 0.367143482f, -0.0797196701f, 0.188610345f, 0.965986669f, 8.14383238e-05f,
+    0.827188075f, 0.382327855f, -0.0829185471f, 0.1849619f, 0.964300096f, 9.96443341e-05f,
+    0.809985816f, 0.396751434f, -0.0859538466f, 0.18115814f, 0.962505341f, 0.000123114805f,
+    0.792183936f, 0.410460174f, -0.0888347551f, 0.177222207f, 0.960629523f, 0.00015474527f,
+    0.773755908f, 0.423381776f, -0.0915253535f, 0.17314817f, 0.958560526f, 0.000194024091f,
+    0.754632413f, 0.435441881f, -0.0940406471f, 0.168943778f, 0.956383824f, 0.00024613319f,
+    0.735022604f, 0.44670108f, -0.0963710845f, 0.16462104f, 0.954059303f, 0.000314413744f,
+    0.714851201f, 0.457075387f, -0.098493211f, 0.160185859f, 0.951496959f, 0.000400374352f,
+    0.694177508f, 0.466546148f, -0.100402839f, 0.155650795f, 0.948674321f, 0.000508072728f,
+    0.67301482f, 0.475072265f, -0.102083139f, 0.151008993f, 0.945565701f, 0.000642332365f,
+    0.651403069f, 0.48262465f, -0.103556708f, 0.146288872f, 0.942234516f, 0.000811953214f,
+    0.629562199f, 0.489310801f, -0.104807146f, 0.141506016f, 0.938554823f, 0.00102154771f,
+    0.607266009f, 0.494921178f, -0.105807967f, 0.136641189f, 0.934489965f, 0.00127900753f,
+    0.584743679f, 0.499589592f, -0.106593512f, 0.13173674f, 0.930074632f, 0.00159879506f,
+    0.561811268f, 0.50307256f, -0.107125588f, 0.12676172f, 0.925254643f, 0.0019939281f,
+    0.53873384f, 0.505563021f, -0.107441932f, 0.121767528f, 0.920021653f, 0.00248330017f,
+    0.515502393f, 0.506982863f, -0.107542276f, 0.116736092f, 0.914452195f, 0.00310064573f,
+    0.492145479f, 0.507321358f, -0.107400827f, 0.11168462f, 0.908337533f, 0.00386072905f,
+    0.468887955f, 0.506725192f, -0.107027791f, 0.106699303f, 0.901810944f, 0.00478155958f,
+    0.445486575f, 0.504865766f, -0.106380403f, 0.101810396f, 0.895238459f, 0.00589296455f,
+    0.42214933f, 0.501918733f, -0.105476178f, 0.0969252437f, 0.887700319f, 0.00721786637f,
+    0.398846507f, 0.497792393f, -0.104322702f, 0.0920533761f, 0.879178584f, 0.00879667979f,
+    0.375823766f, 0.492688864f, -0.102962404f, 0.0872250348f, 0.869688511f, 0.0106894914f,
+    0.353038222f, 0.48655498f, -0.101381823f, 0.0824391022f, 0.859116793f, 0.0129499901f,
+    0.330465525f, 0.479210705f, -0.0995561108f, 0.0776975304f, 0.847275436f, 0.0156192742f,
+    0.30838871f, 0.471017152f, -0.0975191072f, 0.0730442405f, 0.833984792f, 0.0187421925f,
+    0.286632955f, 0.461678654f, -0.0952693149f, 0.0684731826f, 0.819183588f, 0.0224008318f,
+    0.265338242f, 0.451299489f, -0.0927724987f, 0.0639973134f, 0.802514255f, 0.0265945643f,
+    0.244820148f, 0.440315366f, -0.0900672972f, 0.0596621148f, 0.78373915f, 0.0313306823f,
+    0.22474122f, 0.428152621f, -0.0871933848f, 0.0554568991f, 0.763036847f, 0.0367535092f,
+    0.205422267f, 0.415233552f, -0.0841015354f, 0.051395487f, 0.739917099f, 0.0427752882f,
+    0.186916396f, 0.401657194f, -0.0808523446f, 0.0475169942f, 0.71427238f, 0.0493863672f,
+    0.169169933f, 0.387251794f, -0.0774555802f, 0.0438210703f, 0.68606472f, 0.0565761589f,
+    0.152325898f, 0.372157931f, -0.073944591f, 0.0403094254f, 0.655373514f, 0.064378567f,
+    0.136498258f, 0.356777877f, -0.0703453869f, 0.0370399021f, 0.62177366f, 0.0724534169f,
+    0.121747769f, 0.341026694f, -0.0666768178f, 0.0340083092f, 0.585482657f, 0.0806547776f,
+    0.107817948f, 0.324231982f, -0.0629385933f, 0.0312302355f, 0.546561658f, 0.0885803103f,
+    0.095088914f, 0.30730176f, -0.0592133552f, 0.028717909f, 0.505587816f, 0.0960908532f,
+    0.083608672f, 0.29044795f, -0.0555915609f, 0.0265374761f, 0.462839514f, 0.102574885f,
+    0.0731094778f, 0.272555232f, -0.0520233586f, 0.024664104f, 0.419062525f, 0.107550934f,
+    0.0640291125f, 0.255285233f, -0.0486774109f, 0.0231912602f, 0.375108093f, 0.110440008f,
+    0.0560628846f, 0.237315014f, -0.045564495f, 0.0221417751f, 0.332078874f, 0.110754892f,
+    0.0499950312f, 0.221756756f, -0.0429719165f, 0.021690296f, 0.291183084f, 0.108187146f,
+    0.0460958779f, 0.210224092f, -0.0412303545f, 0.0221021958f, 0.253593683f, 0.102546982f,
+    0.0449044928f, 0.204345033f, -0.0405606031f, 0.0236745756f, 0.220347896f, 0.0942182466f,
+    0.0487542003f, 0.212764084f, -0.0421940573f, 0.0275802407f, 0.192092195f, 0.0836725086f,
+    1.0f, 0.0f, 0.0f, 0.244307935f, 0.973272622f, 6.94589107e-06f,
+    0.998929858f, 0.0330374241f, -0.00787035469f, 0.243764594f, 0.973346293f, 7.31166165e-06f,
+    0.997045457f, 0.0549966209f, -0.0130816046f, 0.243321747f, 0.973304152f, 7.73966076e-06f,
+    0.994198561f, 0.0768571571f, -0.0182680469f, 0.242637843f, 0.973145902f, 8.24701056e-06f,
+    0.990438104f, 0.0985773653f, -0.02341846f, 0.24172239f, 0.97287178f, 8.8279221e-06f,
+    0.985705018f, 0.120121062f, -0.0285199247f, 0.240564153f, 0.972477853f, 9.45110696e-06f,
+    0.980097711f, 0.141460776f, -0.0335642323f, 0.239188537f, 0.971967399f, 1.00671505e-05f,
+    0.973526418f, 0.162542447f, -0.0385923237f, 0.237597808f, 0.971538186f, 1.17849731e-05f,
+    0.966088355f, 0.183343187f, -0.0435443409f, 0.235786512f, 0.970999181f, 1.39601198e-05f,
+    0.957721472f, 0.203807354f, -0.048407726f, 0.233748302f, 0.970346332f, 1.6666283e-05f,
+    0.948495448f, 0.223911732f, -0.0531720109f, 0.231490329f, 0.969575524f, 1.9983132e-05f,
+    0.938402593f, 0.243613973f, -0.0578277521f, 0.229022518f, 0.968682826f, 2.39946476e-05f,
+    0.927416384f, 0.262869626f, -0.0623603538f, 0.22633341f, 0.967661262f, 2.87864823e-05f,
+    0.915618181f, 0.281663597f, -0.066763714f, 0.22344549f, 0.966507435f, 3.44414875e-05f,
+    0.9029603f, 0.29992485f, -0.0710112527f, 0.220386609f, 0.965387881f, 4.11530636e-05f,
+    0.889485836f, 0.317632377f, -0.0751074031f, 0.217140213f, 0.964155972f, 4.88459991e-05f,
+    0.875271082f, 0.334766924f, -0.0790654793f, 0.213712856f, 0.962817788f, 5.84877926e-05f,
+    0.860324979f, 0.351301253f, -0.0828906596f, 0.210111737f, 0.961422443f, 7.18070733e-05f,
+    0.844608247f, 0.367165774f, -0.0865420476f, 0.20633103f, 0.959852874f, 8.79262589e-05f,
+    0.828234732f, 0.382371902f, -0.0900228694f, 0.202385396f, 0.958135664f, 0.000108176668f,
+    0.811128318f, 0.396832824f, -0.0933616012f, 0.19827792f, 0.956434906f, 0.000137413852f,
+    0.793394208f, 0.41057241f, -0.0965103507f, 0.194019943f, 0.954556227f, 0.000174429675f,
+    0.775054097f, 0.423532575f, -0.0994549245f, 0.189614668f, 0.952468872f, 0.000220762842f,
+    0.756089687f, 0.435675293f, -0.102182649f, 0.185063198f, 0.950153172f, 0.000278502004f,
+    0.736616313f, 0.447011113f, -0.104697868f, 0.180396676f, 0.947590828f, 0.000350119197f,
+    0.716562748f, 0.457447112f, -0.106975444f, 0.175593838f, 0.944760084f, 0.000438515097f,
+    0.69601357f, 0.466989875f, -0.109018058f, 0.170682356f, 0.941637516f, 0.000547063304f,
+    0.675046623f, 0.475650251f, -0.110822931f, 0.165677741f, 0.938197494f, 0.000679729739f,
+    0.653601348f, 0.48332569f, -0.112401813f, 0.16056852f, 0.934552193f, 0.00084854546f,
+    0.631803334f, 0.490051925f, -0.113729857f, 0.155383795f, 0.930533409f, 0.00105444877f,
+    0.609663963f, 0.495795429f, -0.114833929f, 0.150135502f, 0.926239729f, 0.00131320162f,
+    0.587099493f, 0.500427663f, -0.115721919f, 0.144811258f, 0.921775281f, 0.00164606702f,
+    0.564620554f, 0.504352927f, -0.116388611f, 0.139459655f, 0.916941941f, 0.00206263829f,
+    0.541623294f, 0.506929994f, -0.116763033f, 0.134042829f, 0.911573112f, 0.00257034204f,
+    0.518588126f, 0.508543909f, -0.116872162f, 0.128610581f, 0.905606687f, 0.00318493578f,
+    0.495408207f, 0.509076953f, -0.116707452f, 0.123161964f, 0.899008036f, 0.00392655982f,
+    0.472275078f, 0.508645475f, -0.116280898f, 0.117715411f, 0.891745508f, 0.0048201778f,
+    0.448955715f, 0.506936193f, -0.115576528f, 0.112277173f, 0.883700192f, 0.0058861943f,
+    0.425861508f, 0.504351974f, -0.114642844f, 0.10686598f, 0.874980748f, 0.00718048681f,
+    0.402867913f, 0.500642717f, -0.113465086f, 0.101629488f, 0.866411209f, 0.00874608476f,
+    0.380029261f, 0.495817751f, -0.112022519f, 0.0964600593f, 0.856938183f, 0.010596483f,
+    0.357544214f, 0.49010852f, -0.110348098f, 0.091352649f, 0.846280098f, 0.0127790477f,
+    0.335290223f, 0.483299285f, -0.108441301f, 0.0863005668f, 0.83441186f, 0.0153617933f,
+    0.31334573f, 0.475385666f, -0.106266439f, 0.0813168287f, 0.821037769f, 0.0183559805f,
+    0.291942f, 0.466697782f, -0.103841834f, 0.0764449537f, 0.805915952f, 0.0217697211f,
+    0.270996124f, 0.456984788f, -0.101226091f, 0.0716848895f, 0.78924793f, 0.0257263239f,
+    0.250458658f, 0.446115404f, -0.0983557701f, 0.0670405328f, 0.770612538f, 0.0301924124f,
+    0.230727702f, 0.434702814f, -0.0952978507f, 0.0625599027f, 0.749918818f, 0.0351961106f,
+    0.211925447f, 0.42297107f, -0.0920937434f, 0.0582672469f, 0.727092385f, 0.0407593064f,
+    0.193544894f, 0.409824371f, -0.0886995047f, 0.054129716f, 0.702083826f, 0.0469015576f,
+    0.175947338f, 0.395874143f, -0.0851528794f, 0.0501718633f, 0.674807727f, 0.053619992f,
+    0.159325615f, 0.381624281f, -0.0814967155f, 0.0464579985f, 0.6449458f, 0.0607005544f,
+    0.143735334f, 0.367054224f, -0.0777576342f, 0.042996861f, 0.612567365f, 0.0680283681f,
+    0.129205197f, 0.35219714f, -0.073944658f, 0.0398004651f, 0.577748179f, 0.0753637627f,
+    0.115064248f, 0.335109383f, -0.0700092241f, 0.0368130244f, 0.540906608f, 0.0826420113f,
+    0.102622606f, 0.319332987f, -0.0661973879f, 0.0341868624f, 0.502173305f, 0.0894451514f,
+    0.090727739f, 0.301524878f, -0.0623488314f, 0.0318468586f, 0.461982012f, 0.0953418836f,
+    0.0806700364f, 0.285533994f, -0.0587679483f, 0.0299443994f, 0.421011239f, 0.0999909565f,
+    0.0713308305f, 0.26766035f, -0.0552658997f, 0.028415272f, 0.379941881f, 0.102784857f,
+    0.0636886954f, 0.251432985f, -0.0521908663f, 0.0274447538f, 0.339793503f, 0.103470802f,
+    0.0583123155f, 0.238943562f, -0.0497652143f, 0.027214773f, 0.301523238f, 0.101670623f,
+    0.054264728f, 0.226688087f, -0.0479101427f, 0.0277775172f, 0.266160667f, 0.0973518416f,
+    0.0542357378f, 0.224720597f, -0.047633402f, 0.0299364384f, 0.234520555f, 0.0906213969f,
+    0.0578844398f, 0.230566457f, -0.0490573943f, 0.0342553705f, 0.207193613f, 0.0818535611f,
+    1.0f, 0.0f, 0.0f, 0.265671492f, 0.967486501f, 7.71681698e-06f,
+    0.998952568f, 0.0330174603f, -0.00856610201f, 0.265090287f, 0.967394769f, 7.97385201e-06f,
+    0.997061849f, 0.0549549796f, -0.014186726f, 0.264588296f, 0.967223704f, 8.23244955e-06f,
+    0.994224548f, 0.0767959058f, -0.0198242851f, 0.263853192f, 0.967085242f, 9.00174928e-06f,
+    0.99048841f, 0.0985076725f, -0.0254176259f, 0.26287201f, 0.966861963f, 1.00318848e-05f,
+    0.985806763f, 0.120036155f, -0.030937219f, 0.261663377f, 0.96665597f, 1.14636614e-05f,
+    0.980234504f, 0.141355276f, -0.036398612f, 0.260209054f, 0.966316998f, 1.3114327e-05f,
+    0.973725796f, 0.162423611f, -0.0417875722f, 0.258499563f, 0.965844989f, 1.5034123e-05f,
+    0.966319025f, 0.183202833f, -0.0470927246f, 0.256546974f, 0.965235114f, 1.72554992e-05f,
+    0.958045602f, 0.203657866f, -0.0523015969f, 0.254354417f, 0.964484632f, 1.97895006e-05f,
+    0.948870122f, 0.223746672f, -0.0574006066f, 0.251920074f, 0.963590205f, 2.26196171e-05f,
+    0.938872099f, 0.243450224f, -0.0623922795f, 0.249264792f, 0.962607324f, 2.60208308e-05f,
+    0.927975893f, 0.262708426f, -0.067272611f, 0.246381238f, 0.961554527f, 3.03827546e-05f,
+    0.916273177f, 0.281512558f, -0.0720506534f, 0.243290886f, 0.960471034f, 3.67187677e-05f,
+    0.903695703f, 0.299795121f, -0.0766757131f, 0.239974707f, 0.959234357f, 4.42660094e-05f,
+    0.890366971f, 0.317546308f, -0.0811430439f, 0.236459136f, 0.957838237f, 5.31710139e-05f,
+    0.876258612f, 0.334723413f, -0.0854855329f, 0.232749075f, 0.956424534f, 6.61263548e-05f,
+    0.861388862f, 0.351278096f, -0.0896552503f, 0.228838444f, 0.954869688f, 8.26673131e-05f,
+    0.845809698f, 0.36719808f, -0.093637459f, 0.224741429f, 0.953139305f, 0.00010316119f,
+    0.829505324f, 0.382420927f, -0.0974095911f, 0.220493346f, 0.95141679f, 0.000128548054f,
+    0.812542677f, 0.396943301f, -0.100977838f, 0.216085315f, 0.949527323f, 0.00015968064f,
+    0.794952154f, 0.410728276f, -0.104328647f, 0.211503565f, 0.947410703f, 0.000197667949f,
+    0.776717722f, 0.423732132f, -0.107452936f, 0.206758857f, 0.945049465f, 0.000243818737f,
+    0.757962584f, 0.435977727f, -0.110353924f, 0.201884508f, 0.942428052f, 0.000299620442f,
+    0.738526344f, 0.447324723f, -0.113042139f, 0.196853176f, 0.93969059f, 0.000371351634f,
+    0.718632758f, 0.457855582f, -0.115502395f, 0.191699982f, 0.936721027f, 0.000460749317f,
+    0.698259115f, 0.467505723f, -0.117705904f, 0.186425731f, 0.933436513f, 0.000569137454f,
+    0.677455425f, 0.476279587f, -0.119702511f, 0.181050375f, 0.930008709f, 0.000709542888f,
+    0.656179667f, 0.484077781f, -0.121456452f, 0.175569341f, 0.926329792f, 0.000887154252f,
+    0.634527326f, 0.490920722f, -0.122964554f, 0.169992194f, 0.92238766f, 0.00111235853f,
+    0.612525046f, 0.496791601f, -0.124197476f, 0.164342687f, 0.918022275f, 0.0013878363f,
+    0.590307057f, 0.501719534f, -0.125153929f, 0.158629775f, 0.913220763f, 0.00172437576f,
+    0.567755163f, 0.50556004f, -0.125833213f, 0.152857974f, 0.907981694f, 0.00213619764f,
+    0.545167685f, 0.508521855f, -0.126230121f, 0.147061065f, 0.902179182f, 0.0026315893f,
+    0.522383392f, 0.510424554f, -0.126327693f, 0.14123641f, 0.895751119f, 0.00322332559f,
+    0.499379635f, 0.511158168f, -0.126147002f, 0.135374233f, 0.888822854f, 0.0039458368f,
+    0.476405531f, 0.510934293f, -0.125756532f, 0.129536927f, 0.881433129f, 0.00483607035f,
+    0.45346114f, 0.50968194f, -0.125082016f, 0.123698398f, 0.873344004f, 0.00590933766f,
+    0.430477589f, 0.507260025f, -0.124098063f, 0.117882326f, 0.86433351f, 0.00717526535f,
+    0.40779686f, 0.504017353f, -0.122860298f, 0.112111032f, 0.854500473f, 0.0086895898f,
+    0.38531816f, 0.499785364f, -0.121386632f, 0.106406018f, 0.843770802f, 0.0104977377f,
+    0.362767488f, 0.494065851f, -0.119576402f, 0.100871451f, 0.832629919f, 0.0126023069f,
+    0.34089312f, 0.487838328f, -0.117537819f, 0.0955398455f, 0.820512056f, 0.0150228171f,
+    0.319348305f, 0.480586141f, -0.115268208f, 0.0902811512f, 0.80713433f, 0.0178542249f,
+    0.298132032f, 0.472263992f, -0.11272227f, 0.0851090848f, 0.792165458f, 0.0210940875f,
+    0.277388602f, 0.46297884f, -0.109950542f, 0.0800702274f, 0.775504947f, 0.0247735698f,
+    0.257389516f, 0.453173399f, -0.106973752f, 0.0751772374f, 0.757095933f, 0.0289324f,
+    0.238120586f, 0.442737043f, -0.103844628f, 0.0704675168f, 0.736858726f, 0.0335989408f,
+    0.219081938f, 0.430738926f, -0.100466721f, 0.0658657849f, 0.71477133f, 0.038829878f,
+    0.201069295f, 0.418495953f, -0.096970953f, 0.061498601f, 0.690516889f, 0.0445459709f,
+    0.183746129f, 0.405383408f, -0.0932769254f, 0.0573262796f, 0.663995862f, 0.0506696887f,
+    0.167539909f, 0.392267734f, -0.0895309672f, 0.0534511022f, 0.635134339f, 0.0570796207f,
+    0.152126193f, 0.378407598f, -0.0856306851f, 0.0498002768f, 0.604077697f, 0.0636784434f,
+    0.137121156f, 0.362572432f, -0.0816051364f, 0.0463637412f, 0.571116507f, 0.0704454407f,
+    0.123560905f, 0.347188681f, -0.077672556f, 0.0432890132f, 0.536280096f, 0.0770955384f,
+    0.111067288f, 0.331684172f, -0.0737365186f, 0.0405359752f, 0.499798208f, 0.0832899064f,
+    0.0992698744f, 0.314549327f, -0.0697878227f, 0.0380980782f, 0.462135226f, 0.0887509212f,
+    0.0894528925f, 0.299738199f, -0.0661824346f, 0.036197871f, 0.423751473f, 0.0930008367f,
+    0.0798265412f, 0.281311929f, -0.0625553951f, 0.0346287414f, 0.385456353f, 0.0958221853f,
+    0.072247237f, 0.265368462f, -0.0593713224f, 0.0336843319f, 0.347986072f, 0.0968340263f,
+    0.0673412159f, 0.254830033f, -0.0569953769f, 0.0336535461f, 0.312153101f, 0.0956846997f,
+    0.0642108768f, 0.246129856f, -0.0554690585f, 0.0346600451f, 0.278862983f, 0.0925008729f,
+    0.0644689798f, 0.244282082f, -0.0551992729f, 0.0372330621f, 0.248756394f, 0.0871544629f,
+    0.0688823685f, 0.250673085f, -0.056601502f, 0.0421279967f, 0.222369581f, 0.0799206346f,
+    1.0f, 0.0f, 0.0f, 0.287828773f, 0.961219668f, 8.86956059e-06f,
+    0.998944104f, 0.0329732448f, -0.00917008147f, 0.287199497f, 0.961101472f, 9.0244057e-06f,
+    0.997107685f, 0.0548929907f, -0.0152913276f, 0.286663234f, 0.960926294f, 9.58661258e-06f,
+    0.994280994f, 0.0767177939f, -0.0213793181f, 0.28584373f, 0.960626304f, 1.04105729e-05f,
+    0.990576804f, 0.0984098688f, -0.0274192113f, 0.284756035f, 0.960205674f, 1.14963523e-05f,
+    0.985932231f, 0.119911827f, -0.0333407223f, 0.283440977f, 0.959869564f, 1.30166563e-05f,
+    0.980401933f, 0.141209319f, -0.0391952768f, 0.281858146f, 0.959387243f, 1.46300708e-05f,
+    0.973957121f, 0.162255481f, -0.0449688397f, 0.280007839f, 0.958755374f, 1.63169043e-05f,
+    0.966622293f, 0.183017001f, -0.0506619699f, 0.277895063f, 0.958015561f, 1.82871099e-05f,
+    0.95840627f, 0.203466117f, -0.0562953204f, 0.275543302f, 0.957262456f, 2.13698277e-05f,
+    0.949365914f, 0.223559096f, -0.0617870651f, 0.272981048f, 0.956544816f, 2.51113997e-05f,
+    0.939440548f, 0.243254945f, -0.0671520531f, 0.270159245f, 0.95566386f, 2.93215817e-05f,
+    0.928685486f, 0.262532771f, -0.0724097714f, 0.267105907f, 0.954697549f, 3.48782705e-05f,
+    0.917056143f, 0.281340808f, -0.0775478631f, 0.263806015f, 0.953659296f, 4.26118131e-05f,
+    0.904618204f, 0.299645156f, -0.0825274363f, 0.260274172f, 0.952450752f, 5.20597168e-05f,
+    0.891398251f, 0.317418128f, -0.0873361453f, 0.256517172f, 0.951066673f, 6.35513279e-05f,
+    0.87743181f, 0.334624648f, -0.0919815451f, 0.252550125f, 0.949575961f, 7.81331764e-05f,
+    0.862718046f, 0.351221323f, -0.096434243f, 0.248373449f, 0.947891772f, 9.57595257e-05f,
+    0.847276986f, 0.367178917f, -0.100681372f, 0.243992195f, 0.94600302f, 0.000116932541f,
+    0.831092715f, 0.382445961f, -0.104706749f, 0.239402711f, 0.943899155f, 0.000142200399f,
+    0.814327776f, 0.397039652f, -0.108527608f, 0.234645918f, 0.941616118f, 0.000173251596f,
+    0.796863675f, 0.410896391f, -0.112135395f, 0.229703948f, 0.939184487f, 0.000212606436f,
+    0.778805614f, 0.423980057f, -0.115501247f, 0.224601403f, 0.936499536f, 0.000259790279f,
+    0.760172129f, 0.436278135f, -0.118624046f, 0.219364673f, 0.933691502f, 0.000317287282f,
+    0.740898967f, 0.447716981f, -0.121537261f, 0.213997781f, 0.930957437f, 0.000393404945f,
+    0.721217752f, 0.458377749f, -0.124209419f, 0.208501562f, 0.92797029f, 0.000488403777f,
+    0.701045096f, 0.468160748f, -0.126647115f, 0.202875853f, 0.924780011f, 0.000610142248f,
+    0.68032825f, 0.476981789f, -0.128817156f, 0.197120368f, 0.921309352f, 0.000761665637f,
+    0.659269869f, 0.484948367f, -0.130712688f, 0.191266045f, 0.917485297f, 0.0009475876f,
+    0.637810469f, 0.491939217f, -0.132311717f, 0.185315266f, 0.913243413f, 0.00117302442f,
+    0.616131902f, 0.498057961f, -0.133612573f, 0.179288015f, 0.908547044f, 0.00144463265f,
+    0.594193399f, 0.503225684f, -0.134612799f, 0.1732025f, 0.90335542f, 0.00176970474f,
+    0.571891844f, 0.507294416f, -0.135323822f, 0.167041361f, 0.897774994f, 0.00216741557f,
+    0.549579203f, 0.510524929f, -0.135813862f, 0.160867885f, 0.891871333f, 0.00266322377f,
+    0.526878536f, 0.512551546f, -0.1360102f, 0.154632017f, 0.885524213f, 0.00327361026f,
+    0.504174888f, 0.51363194f, -0.135896847f, 0.148395255f, 0.878480136f, 0.00400008867f,
+    0.481481284f, 0.51374495f, -0.135460719f, 0.142156303f, 0.870683968f, 0.00486002583f,
+    0.458835602f, 0.512837589f, -0.13477543f, 0.135925427f, 0.862357795f, 0.00591097539f,
+    0.436148733f, 0.510818362f, -0.133793965f, 0.129717439f, 0.853238702f, 0.00716458261f,
+    0.413852751f, 0.508120656f, -0.132532641f, 0.123598829f, 0.843096673f, 0.00862721913f,
+    0.391513467f, 0.504122555f, -0.130912438f, 0.117504418f, 0.831854939f, 0.0103222262f,
+    0.369485974f, 0.499305069f, -0.129059702f, 0.111503467f, 0.819665551f, 0.0123207942f,
+    0.347723097f, 0.493368298f, -0.126913384f, 0.105587862f, 0.806258917f, 0.0146320872f,
+    0.326438844f, 0.486602515f, -0.124541633f, 0.0999917164f, 0.792590082f, 0.0172910281f,
+    0.305400908f, 0.47863102f, -0.121900149f, 0.0945507586f, 0.77788806f, 0.020338133f,
+    0.285257012f, 0.470459759f, -0.119079687f, 0.0892778188f, 0.761643231f, 0.0237997621f,
+    0.265633225f, 0.461385131f, -0.116049282f, 0.0841488764f, 0.743781745f, 0.027712645f,
+    0.246122286f, 0.450715572f, -0.112769529f, 0.0791348442f, 0.724241078f, 0.0321201421f,
+    0.22783044f, 0.440256387f, -0.109327428f, 0.0743531883f, 0.702682078f, 0.0369337834f,
+    0.209862128f, 0.428346902f, -0.105701558f, 0.06977088f, 0.679169536f, 0.0421712026f,
+    0.192867234f, 0.416038036f, -0.101877682f, 0.0654160082f, 0.653504133f, 0.0477005616f,
+    0.176906198f, 0.403695136f, -0.0980319977f, 0.0613715015f, 0.625893474f, 0.053519737f,
+    0.160894394f, 0.388648391f, -0.0939208642f, 0.0574563332f, 0.596534789f, 0.0596380904f,
+    0.146538407f, 0.374682993f, -0.0899356827f, 0.0539333373f, 0.565422118f, 0.0658827871f,
+    0.133282781f, 0.360478312f, -0.085898459f, 0.0507331751f, 0.532544672f, 0.0719276965f,
+    0.120324321f, 0.343938559f, -0.0817932189f, 0.0478381142f, 0.498274207f, 0.0775882974f,
+    0.109151796f, 0.328914404f, -0.0778925493f, 0.0454137623f, 0.462993771f, 0.0826029852f,
+    0.0989189968f, 0.312963367f, -0.0740918294f, 0.0434167795f, 0.427191019f, 0.0866415501f,
+    0.08983697f, 0.296725452f, -0.0705539063f, 0.0419539139f, 0.391483426f, 0.0894601271f,
+    0.0820862204f, 0.280798197f, -0.0672564805f, 0.0410494357f, 0.356526047f, 0.0907818004f,
+    0.0780422613f, 0.272984833f, -0.0650572479f, 0.0413337834f, 0.322979629f, 0.0902274773f,
+    0.0751399323f, 0.264457256f, -0.0635477379f, 0.0426597297f, 0.29161638f, 0.0879504755f,
+    0.0751902983f, 0.261115789f, -0.0630632117f, 0.045526173f, 0.262985736f, 0.0837962329f,
+    0.0813432634f, 0.271567076f, -0.0647096485f, 0.0512365662f, 0.23755528f, 0.0778956264f,
+    1.0f, 0.0f, 0.0f, 0.310577929f, 0.954087615f, 1.01619935e-05f,
+    0.99896574f, 0.0329242721f, -0.00981422886f, 0.309966505f, 0.953945339f, 1.03786479e-05f,
+    0.997121274f, 0.054804232f, -0.0163116865f, 0.309372514f, 0.953654587f, 1.07466349e-05f,
+    0.994343579f, 0.0765847638f, -0.022765154f, 0.308493137f, 0.953272402f, 1.13163278e-05f,
+    0.990638912f, 0.0982310995f, -0.0291702822f, 0.307322651f, 0.952786803f, 1.20086243e-05f,
+    0.986062527f, 0.119720809f, -0.0355717726f, 0.305900395f, 0.95231688f, 1.34314078e-05f,
+    0.980585217f, 0.140997395f, -0.0418973565f, 0.304186136f, 0.951700568f, 1.5098125e-05f,
+    0.974229515f, 0.162035391f, -0.0481487289f, 0.302197129f, 0.951012969f, 1.72709733e-05f,
+    0.96701622f, 0.182793811f, -0.0542916991f, 0.299945772f, 0.950221181f, 1.97750633e-05f,
+    0.958891571f, 0.203230754f, -0.060332004f, 0.297480136f, 0.949644625f, 2.39646997e-05f,
+    0.949917972f, 0.223315671f, -0.0662523583f, 0.294737607f, 0.948905051f, 2.89963627e-05f,
+    0.940125465f, 0.243024066f, -0.0720389411f, 0.29172495f, 0.947997093f, 3.50402224e-05f,
+    0.929508209f, 0.262317896f, -0.0776780099f, 0.288450807f, 0.946914494f, 4.22701378e-05f,
+    0.918037832f, 0.281149179f, -0.0831532404f, 0.284912348f, 0.945652068f, 5.08617813e-05f,
+    0.905826092f, 0.299504578f, -0.088451378f, 0.281147003f, 0.944246531f, 6.10203278e-05f,
+    0.892724395f, 0.317278087f, -0.0935414359f, 0.277161717f, 0.94279778f, 7.29588646e-05f,
+    0.8789289f, 0.3345204f, -0.0984457731f, 0.272952855f, 0.941158712f, 8.70208969e-05f,
+    0.864373982f, 0.35115242f, -0.103181154f, 0.26851958f, 0.939416707f, 0.000105208906f,
+    0.849107027f, 0.367155612f, -0.10769783f, 0.263870567f, 0.937447309f, 0.000126590734f,
+    0.833104253f, 0.382476211f, -0.111977071f, 0.25899896f, 0.935238361f, 0.000151530854f,
+    0.816472173f, 0.397113174f, -0.116062298f, 0.253946334f, 0.932907701f, 0.000183341093f,
+    0.799145281f, 0.411005825f, -0.119936734f, 0.248695314f, 0.93045187f, 0.00022464263f,
+    0.781198502f, 0.424141079f, -0.12357787f, 0.243257195f, 0.927831531f, 0.000276858016f,
+    0.762802541f, 0.436586857f, -0.12701945f, 0.237680197f, 0.925097048f, 0.000345518114f,
+    0.743761003f, 0.448151499f, -0.130175829f, 0.231928855f, 0.922065914f, 0.000429473032f,
+    0.724307001f, 0.458952516f, -0.133045509f, 0.226031318f, 0.91871506f, 0.000531544269f,
+    0.704119802f, 0.468722343f, -0.135611564f, 0.219987482f, 0.915020525f, 0.0006549065f,
+    0.683754086f, 0.477769881f, -0.137888953f, 0.213874057f, 0.911106944f, 0.000803163566f,
+    0.662921548f, 0.485865355f, -0.139863715f, 0.207661301f, 0.906986296f, 0.000982420519f,
+    0.641926885f, 0.493183285f, -0.14156501f, 0.201374173f, 0.902507842f, 0.00120010006f,
+    0.62056303f, 0.499584734f, -0.143026739f, 0.195008963f, 0.897795975f, 0.00147486303f,
+    0.598814607f, 0.504947543f, -0.144186437f, 0.18852964f, 0.892750144f, 0.00181591336f,
+    0.577041388f, 0.509497464f, -0.14506042f, 0.182034984f, 0.887188792f, 0.00222680531f,
+    0.554785013f, 0.512845576f, -0.145567939f, 0.175457761f, 0.881025255f, 0.00271514524f,
+    0.532386839f, 0.51514858f, -0.145770282f, 0.16884324f, 0.874355435f, 0.00330511644f,
+    0.509854198f, 0.516419947f, -0.14570877f, 0.162208587f, 0.867254078f, 0.00403152732f,
+    0.487537026f, 0.51696533f, -0.145341203f, 0.155598968f, 0.859438002f, 0.00489403028f,
+    0.465272307f, 0.516554534f, -0.144641519f, 0.149015993f, 0.850791693f, 0.0059050126f,
+    0.443174452f, 0.515276372f, -0.143637687f, 0.142494231f, 0.841270864f, 0.0070860479f,
+    0.420959264f, 0.512715936f, -0.142317325f, 0.135976017f, 0.830997586f, 0.00848956034f,
+    0.398932934f, 0.509232938f, -0.140682995f, 0.129522905f, 0.819729269f, 0.0101238498f,
+    0.377412438f, 0.505109847f, -0.138791919f, 0.123202518f, 0.807367325f, 0.0120096272f,
+    0.355654657f, 0.499339312f, -0.136589572f, 0.116930835f, 0.79399395f, 0.01420647f,
+    0.33463791f, 0.493129939f, -0.134127721f, 0.110793725f, 0.779389203f, 0.0167236347f,
+    0.31415838f, 0.486303091f, -0.131434128f, 0.104823291f, 0.763522208f, 0.0195925701f,
+    0.294266671f, 0.478591919f, -0.128541216f, 0.099298574f, 0.747801483f, 0.0228591152f,
+    0.274430811f, 0.469196528f, -0.125379339f, 0.0938882679f, 0.730535984f, 0.0265395306f,
+    0.255972803f, 0.460562438f, -0.122130334f, 0.088775903f, 0.711472392f, 0.0305806305f,
+    0.237331703f, 0.449580073f, -0.118510194f, 0.0837373659f, 0.690648675f, 0.0350044258f,
+    0.219989136f, 0.439017504f, -0.114777245f, 0.0789925233f, 0.66791755f, 0.0397286303f,
+    0.203128889f, 0.427327901f, -0.110922307f, 0.0744893625f, 0.643493712f, 0.0447992012f,
+    0.187181562f, 0.415124506f, -0.106962517f, 0.0702128261f, 0.617509484f, 0.050244417f,
+    0.171440855f, 0.400912255f, -0.102844991f, 0.0661655739f, 0.589846611f, 0.0559243821f,
+    0.157159328f, 0.387326717f, -0.0987560451f, 0.0625228062f, 0.560400665f, 0.0615687668f,
+    0.143807918f, 0.373171628f, -0.0946445912f, 0.0592331067f, 0.529478312f, 0.0670646504f,
+    0.130962491f, 0.357234389f, -0.0904328898f, 0.0562253483f, 0.497447103f, 0.0723265409f,
+    0.120077007f, 0.343237996f, -0.0865357593f, 0.0538223349f, 0.464461297f, 0.0769209564f,
+    0.109876096f, 0.327668697f, -0.0826447234f, 0.0517966412f, 0.431131899f, 0.0808044076f,
+    0.100361958f, 0.310494721f, -0.0788875446f, 0.0502705723f, 0.397890747f, 0.0836593807f,
+    0.0940321982f, 0.299285412f, -0.076023072f, 0.0498000272f, 0.365252435f, 0.0851558745f,
+    0.0898530036f, 0.290648311f, -0.0736750886f, 0.0502143465f, 0.333893538f, 0.0852150247f,
+    0.0871919021f, 0.282471985f, -0.0720741227f, 0.0518282987f, 0.304349899f, 0.0836893693f,
+    0.0884342715f, 0.282095492f, -0.0719402432f, 0.0554459915f, 0.27714631f, 0.0805414841f,
+    0.0940803662f, 0.288898051f, -0.0731839985f, 0.0615376942f, 0.252690673f, 0.075798586f,
+    1.0f, 0.0f, 0.0f, 0.333981127f, 0.946089923f, 1.13182841e-05f,
+    0.998959064f, 0.0328419469f, -0.010366004f, 0.333379716f, 0.946078598f, 1.1586415e-05f,
+    0.997132599f, 0.0546832569f, -0.0173007697f, 0.332784534f, 0.945934296f, 1.2108314e-05f,
+    0.994395614f, 0.0764221847f, -0.0242003296f, 0.331877321f, 0.945629179f, 1.28272777e-05f,
+    0.990745604f, 0.0980364904f, -0.0310469586f, 0.330644399f, 0.945162416f, 1.37190082e-05f,
+    0.986231923f, 0.119487055f, -0.0378681943f, 0.329126894f, 0.944633603f, 1.52026296e-05f,
+    0.980803907f, 0.140739381f, -0.0446429551f, 0.327308774f, 0.944032073f, 1.75021178e-05f,
+    0.97452569f, 0.161745593f, -0.0513217449f, 0.325194955f, 0.943298519f, 2.04254447e-05f,
+    0.967391491f, 0.182478517f, -0.0578891598f, 0.322798043f, 0.942459226f, 2.40667887e-05f,
+    0.959455311f, 0.202910259f, -0.064332962f, 0.320106745f, 0.941452086f, 2.83769277e-05f,
+    0.95067209f, 0.223012075f, -0.0706369057f, 0.317122042f, 0.940270722f, 3.33988173e-05f,
+    0.941094398f, 0.242753014f, -0.0767863914f, 0.313854277f, 0.938911259f, 3.91549365e-05f,
+    0.93058598f, 0.262051612f, -0.0827311873f, 0.310356468f, 0.937585175f, 4.58447284e-05f,
+    0.919340074f, 0.280903786f, -0.0885276049f, 0.306653559f, 0.936324954f, 5.47664313e-05f,
+    0.907174468f, 0.299235344f, -0.0941325128f, 0.302663177f, 0.934854925f, 6.49785361e-05f,
+    0.894230068f, 0.317027569f, -0.099536255f, 0.29841283f, 0.933167219f, 7.65504155e-05f,
+    0.880609155f, 0.33430478f, -0.10476473f, 0.293933123f, 0.931343496f, 9.0806323e-05f,
+    0.866191387f, 0.350959569f, -0.109810226f, 0.289212823f, 0.929421484f, 0.000108883432f,
+    0.851122677f, 0.367020756f, -0.114685215f, 0.284271836f, 0.927428722f, 0.000133180743f,
+    0.835362494f, 0.382416666f, -0.119313896f, 0.279162884f, 0.92541182f, 0.00016289184f,
+    0.818831444f, 0.397099644f, -0.12372271f, 0.273822069f, 0.923280239f, 0.000201604984f,
+    0.801802874f, 0.411119014f, -0.127880365f, 0.268304586f, 0.920876205f, 0.000248525117f,
+    0.78414017f, 0.424370468f, -0.13175568f, 0.262579739f, 0.918182075f, 0.000305085036f,
+    0.765966475f, 0.436893135f, -0.135344774f, 0.256676078f, 0.915180862f, 0.0003728921f,
+    0.747258008f, 0.448653251f, -0.138675109f, 0.250620812f, 0.911950529f, 0.00045625589f,
+    0.72791183f, 0.459486663f, -0.141685426f, 0.244387344f, 0.908373713f, 0.000555455161f,
+    0.708146274f, 0.469503462f, -0.144392118f, 0.238013655f, 0.904464066f, 0.000674294366f,
+    0.688106179f, 0.478787959f, -0.146878541f, 0.231531724f, 0.900438786f, 0.000826730102f,
+    0.667777598f, 0.487265199f, -0.149098828f, 0.224951103f, 0.896148801f, 0.00101671915f,
+    0.64683938f, 0.494677603f, -0.150989383f, 0.218235493f, 0.891493559f, 0.00124892255f,
+    0.625784338f, 0.501312912f, -0.152548715f, 0.211454839f, 0.886399448f, 0.00152583595f,
+    0.604393065f, 0.506983459f, -0.153787047f, 0.20464389f, 0.881152868f, 0.00185854232f,
+    0.582687199f, 0.511601806f, -0.154760003f, 0.197775662f, 0.875577211f, 0.0022709812f,
+    0.560699642f, 0.51520437f, -0.155402154f, 0.190831721f, 0.869525373f, 0.00277243042f,
+    0.538741589f, 0.517962098f, -0.155711159f, 0.183890179f, 0.862803459f, 0.00336435204f,
+    0.516896367f, 0.519959271f, -0.155660987f, 0.176940128f, 0.855356097f, 0.00405749725f,
+    0.495027155f, 0.520984113f, -0.155289859f, 0.170006782f, 0.847224236f, 0.00487440825f,
+    0.473303795f, 0.521247268f, -0.154633597f, 0.163090676f, 0.838495135f, 0.00585267972f,
+    0.451111376f, 0.519934058f, -0.15359056f, 0.156164661f, 0.828915417f, 0.00699333753f,
+    0.429254144f, 0.517871678f, -0.152238443f, 0.149318904f, 0.818440318f, 0.00831655227f,
+    0.407874495f, 0.515269935f, -0.150675684f, 0.142576262f, 0.80725956f, 0.00988687295f,
+    0.386043727f, 0.510874212f, -0.148717508f, 0.135860398f, 0.794999421f, 0.0116893928f,
+    0.365130395f, 0.506323457f, -0.146508366f, 0.129290223f, 0.781675339f, 0.013761797f,
+    0.344532192f, 0.500867367f, -0.144060448f, 0.122875489f, 0.76722306f, 0.0161357168f,
+    0.324335039f, 0.494617045f, -0.141341388f, 0.116565339f, 0.751657426f, 0.0188665502f,
+    0.304274559f, 0.486944467f, -0.138330609f, 0.110425852f, 0.734619379f, 0.0219074208f,
+    0.285040766f, 0.478859663f, -0.135098934f, 0.104674801f, 0.717000544f, 0.0252819508f,
+    0.266239494f, 0.469602048f, -0.131642535f, 0.0992855877f, 0.698630333f, 0.0289895386f,
+    0.248509094f, 0.460439473f, -0.128063679f, 0.0941807553f, 0.678613901f, 0.0329975076f,
+    0.231459111f, 0.450648665f, -0.124356322f, 0.0892864391f, 0.657200396f, 0.0374015979f,
+    0.214626938f, 0.439117551f, -0.120449319f, 0.0845675021f, 0.634315073f, 0.0421787724f,
+    0.198094338f, 0.425820053f, -0.116322301f, 0.0800551772f, 0.609818578f, 0.0472257622f,
+    0.183139101f, 0.413556635f, -0.112238616f, 0.0759860948f, 0.583598554f, 0.0523438342f,
+    0.169124067f, 0.400730342f, -0.108091854f, 0.0722572431f, 0.555921555f, 0.057481721f,
+    0.155649334f, 0.386523813f, -0.103896089f, 0.0688416734f, 0.527100682f, 0.062626496f,
+    0.143082187f, 0.371473849f, -0.0996413976f, 0.0658291057f, 0.497087151f, 0.0673650354f,
+    0.131964207f, 0.357157826f, -0.095612213f, 0.0633400306f, 0.466457933f, 0.0717445686f,
+    0.122221902f, 0.343189716f, -0.0918452293f, 0.0614521988f, 0.435464144f, 0.0754682571f,
+    0.113295436f, 0.328146756f, -0.0882108212f, 0.0601108298f, 0.404539943f, 0.0783368871f,
+    0.106335185f, 0.314738959f, -0.0850029439f, 0.0596181974f, 0.374093801f, 0.0799671263f,
+    0.102787949f, 0.307850957f, -0.0827999339f, 0.0603853315f, 0.344795823f, 0.0805526599f,
+    0.100121349f, 0.299369812f, -0.0810812339f, 0.0622985363f, 0.316993773f, 0.0796745941f,
+    0.101983957f, 0.299763739f, -0.0808584839f, 0.0663889274f, 0.291181892f, 0.0773844346f,
+    0.108095579f, 0.305967152f, -0.0819830298f, 0.0730971768f, 0.267721176f, 0.0736479312f,
+    1.0f, 0.0f, 0.0f, 0.357973248f, 0.937229156f, 1.28122247e-05f,
+    0.998965144f, 0.0327818878f, -0.0111272223f, 0.357306331f, 0.937099218f, 1.30677981e-05f,
+    0.99717021f, 0.054568436f, -0.018457599f, 0.356719404f, 0.937134743f, 1.41140508e-05f,
+    0.994461179f, 0.0762605891f, -0.0257596653f, 0.355797291f, 0.936999917f, 1.53630845e-05f,
+    0.990872502f, 0.0978141129f, -0.0330121741f, 0.354539126f, 0.936686039f, 1.68776514e-05f,
+    0.986413896f, 0.119213067f, -0.0401983634f, 0.352957577f, 0.93619138f, 1.87115274e-05f,
+    0.981079221f, 0.140403181f, -0.0472979434f, 0.351033688f, 0.93551451f, 2.08913534e-05f,
+    0.974886954f, 0.161352381f, -0.0542953685f, 0.348791212f, 0.934651852f, 2.34142317e-05f,
+    0.967931628f, 0.182045296f, -0.0611762181f, 0.346248657f, 0.93359977f, 2.62417907e-05f,
+    0.960173786f, 0.202448428f, -0.0679743513f, 0.34341675f, 0.932481706f, 3.01562795e-05f,
+    0.95157373f, 0.222538948f, -0.0746297985f, 0.340268493f, 0.931192517f, 3.47774876e-05f,
+    0.94226253f, 0.242310882f, -0.0811377317f, 0.336844265f, 0.929747164f, 4.01992729e-05f,
+    0.932021737f, 0.261656672f, -0.0875089169f, 0.333132565f, 0.928218365f, 4.71454914e-05f,
+    0.920874953f, 0.280532628f, -0.0937194452f, 0.329131097f, 0.926573098f, 5.58971333e-05f,
+    0.908833861f, 0.298880041f, -0.0997360423f, 0.32483831f, 0.924776673f, 6.6336499e-05f,
+    0.895938218f, 0.316673607f, -0.105577737f, 0.320278168f, 0.92292738f, 8.02475479e-05f,
+    0.882466912f, 0.333944947f, -0.111156344f, 0.315572053f, 0.921218991f, 9.73492351e-05f,
+    0.868340254f, 0.350688696f, -0.11655502f, 0.310627639f, 0.919384003f, 0.00011969015f,
+    0.85340488f, 0.366766572f, -0.121700816f, 0.305420309f, 0.917300224f, 0.000146492283f,
+    0.837787032f, 0.382185638f, -0.126616329f, 0.299990058f, 0.915070176f, 0.000179718336f,
+    0.821605802f, 0.396990329f, -0.13127555f, 0.294356048f, 0.912649512f, 0.000219797163f,
+    0.804912388f, 0.411131412f, -0.135656312f, 0.288520724f, 0.909939349f, 0.000267280178f,
+    0.787632883f, 0.424568832f, -0.139742255f, 0.282487273f, 0.906921804f, 0.000323126267f,
+    0.769663393f, 0.437164456f, -0.143518507f, 0.276306242f, 0.903852105f, 0.000389671884f,
+    0.751172781f, 0.44903031f, -0.147074029f, 0.269955248f, 0.900675833f, 0.000475480192f,
+    0.73232621f, 0.460149884f, -0.150357723f, 0.263451815f, 0.897244513f, 0.000581705361f,
+    0.712937295f, 0.470440865f, -0.15334402f, 0.256777525f, 0.893541992f, 0.000713273417f,
+    0.693240404f, 0.479933977f, -0.156009138f, 0.249979466f, 0.889461279f, 0.00087107945f,
+    0.67319572f, 0.488615096f, -0.158360973f, 0.243074059f, 0.885015845f, 0.00106124661f,
+    0.652712643f, 0.496373087f, -0.160378948f, 0.236034751f, 0.880209565f, 0.0012918018f,
+    0.631854296f, 0.503153801f, -0.162108406f, 0.228905141f, 0.875097513f, 0.00157723192f,
+    0.610546589f, 0.508910656f, -0.16347149f, 0.221666589f, 0.869517922f, 0.00192023301f,
+    0.58919847f, 0.513831615f, -0.164474458f, 0.214388341f, 0.86336571f, 0.00232423772f,
+    0.567783058f, 0.517957449f, -0.16512756f, 0.20708628f, 0.856710017f, 0.00280114333f,
+    0.546667099f, 0.521539032f, -0.165514633f, 0.199905306f, 0.84975785f, 0.00336155179f,
+    0.524983764f, 0.523752093f, -0.165521756f, 0.192588672f, 0.842354715f, 0.00404053228f,
+    0.503566742f, 0.525294662f, -0.165215269f, 0.185339019f, 0.834214449f, 0.00483155716f,
+    0.481826752f, 0.52555275f, -0.164562643f, 0.178085029f, 0.825407207f, 0.00576154748f,
+    0.460305512f, 0.52509594f, -0.163638473f, 0.170872107f, 0.815999687f, 0.0068706153f,
+    0.439093292f, 0.523886323f, -0.162375778f, 0.163738966f, 0.805673659f, 0.00814824086f,
+    0.417418927f, 0.521002829f, -0.160726845f, 0.156611755f, 0.794477701f, 0.00962781534f,
+    0.396409303f, 0.517658532f, -0.15880172f, 0.149624243f, 0.782308996f, 0.011326476f,
+    0.375804722f, 0.513685107f, -0.156678408f, 0.142779201f, 0.769318163f, 0.0133126108f,
+    0.355621666f, 0.508917332f, -0.15420948f, 0.136035964f, 0.755161762f, 0.0155642061f,
+    0.335543722f, 0.502968311f, -0.151452184f, 0.129480183f, 0.73970145f, 0.0180719607f,
+    0.315920919f, 0.49616909f, -0.148402408f, 0.123062998f, 0.723035157f, 0.0208866447f,
+    0.296853215f, 0.488638163f, -0.145075157f, 0.116838105f, 0.704991162f, 0.0239837766f,
+    0.278401405f, 0.480369866f, -0.141566902f, 0.110948771f, 0.685885012f, 0.0273631215f,
+    0.26099053f, 0.471809089f, -0.138065159f, 0.105680235f, 0.667263865f, 0.0311729796f,
+    0.243801087f, 0.461850673f, -0.134311646f, 0.100581691f, 0.647193968f, 0.0353096202f,
+    0.226892099f, 0.450218379f, -0.130290538f, 0.0956718251f, 0.625602007f, 0.0397197604f,
+    0.211301684f, 0.439091831f, -0.126291633f, 0.0912163258f, 0.602386475f, 0.0442628339f,
+    0.196157947f, 0.426522434f, -0.12203978f, 0.0869742483f, 0.577789187f, 0.0489323512f,
+    0.182363302f, 0.414510489f, -0.117912717f, 0.0831727907f, 0.552063823f, 0.0537484996f,
+    0.168925241f, 0.400496334f, -0.113604106f, 0.0797032639f, 0.525065303f, 0.0583795942f,
+    0.15609014f, 0.384909511f, -0.109252959f, 0.0766067281f, 0.497233301f, 0.0628324896f,
+    0.14541778f, 0.371963501f, -0.105283953f, 0.0741914362f, 0.468816638f, 0.0669796988f,
+    0.135577694f, 0.357963473f, -0.101455554f, 0.0723460466f, 0.440054327f, 0.0705709457f,
+    0.127650023f, 0.345662206f, -0.0979791209f, 0.0712713972f, 0.411305457f, 0.0734001771f,
+    0.120119922f, 0.33093375f, -0.0945548564f, 0.0708279833f, 0.382988513f, 0.0752327219f,
+    0.11707142f, 0.325176001f, -0.0924144685f, 0.0719555467f, 0.35561654f, 0.0761979744f,
+    0.114832193f, 0.317304552f, -0.0906070396f, 0.0742198899f, 0.329492152f, 0.0758854374f,
+    0.118117236f, 0.320443183f, -0.0905755162f, 0.0790738687f, 0.305043906f, 0.0743232295f,
+    0.123995282f, 0.324591517f, -0.0913552344f, 0.0862548724f, 0.282598346f, 0.0714615881f,
+    1.0f, 0.0f, 0.0f, 0.382430792f, 0.927508891f, 1.42426807e-05f,
+    0.99898845f, 0.0326934084f, -0.0117777511f, 0.381765574f, 0.927366674f, 1.46150496e-05f,
+    0.997197449f, 0.0544214211f, -0.0195851661f, 0.381057143f, 0.927042246f, 1.52595294e-05f,
+    0.994535506f, 0.0760508776f, -0.0273122117f, 0.3800143f, 0.926610589f, 1.62424094e-05f,
+    0.990998089f, 0.0975360572f, -0.0349230729f, 0.378660381f, 0.926112175f, 1.74814977e-05f,
+    0.986630142f, 0.118854746f, -0.0424499512f, 0.377017558f, 0.925655663f, 1.93139094e-05f,
+    0.981461525f, 0.139988676f, -0.0499197319f, 0.375084102f, 0.925204873f, 2.19415961e-05f,
+    0.975385189f, 0.160880476f, -0.0572879426f, 0.372798353f, 0.924550295f, 2.4883504e-05f,
+    0.96858871f, 0.181531698f, -0.0645501986f, 0.370196462f, 0.923713088f, 2.82611381e-05f,
+    0.960991681f, 0.201902911f, -0.0717286766f, 0.367275059f, 0.922785044f, 3.27825146e-05f,
+    0.952695072f, 0.221991524f, -0.0787605345f, 0.364048868f, 0.921647906f, 3.79221674e-05f,
+    0.943566263f, 0.241730809f, -0.0856449902f, 0.360510498f, 0.920336604f, 4.40006952e-05f,
+    0.933624804f, 0.261112839f, -0.0924006999f, 0.356668353f, 0.918923259f, 5.20433714e-05f,
+    0.922814488f, 0.280048639f, -0.098970443f, 0.352501392f, 0.917328835f, 6.17696132e-05f,
+    0.911065996f, 0.298457116f, -0.105409153f, 0.3480452f, 0.915708363f, 7.53795393e-05f,
+    0.898542583f, 0.316343963f, -0.111621983f, 0.343292028f, 0.913873017f, 9.1835951e-05f,
+    0.885331392f, 0.333723247f, -0.117592975f, 0.338264793f, 0.911802053f, 0.000111441215f,
+    0.871383131f, 0.350508064f, -0.123301975f, 0.332961231f, 0.909484982f, 0.000134589354f,
+    0.856561542f, 0.366607666f, -0.128730878f, 0.327386469f, 0.906909823f, 0.000161665885f,
+    0.841188967f, 0.382100791f, -0.133815065f, 0.321674764f, 0.90433079f, 0.000193063563f,
+    0.82532382f, 0.396997511f, -0.138630599f, 0.31573537f, 0.901540875f, 0.000230527236f,
+    0.808909476f, 0.411247909f, -0.143252894f, 0.309618324f, 0.898658633f, 0.000279087806f,
+    0.791729271f, 0.424705923f, -0.147594228f, 0.303275317f, 0.895546675f, 0.000338891201f,
+    0.773959219f, 0.437399864f, -0.151665851f, 0.296733588f, 0.892322302f, 0.000413645117f,
+    0.755810201f, 0.44942224f, -0.155458927f, 0.290030748f, 0.888858318f, 0.000505495991f,
+    0.737323284f, 0.460741907f, -0.158909798f, 0.283158571f, 0.88502413f, 0.0006143137f,
+    0.718403459f, 0.471292853f, -0.162046969f, 0.276197493f, 0.881073952f, 0.000744204503f,
+    0.699096859f, 0.481036782f, -0.1648954f, 0.269117624f, 0.877011776f, 0.000905491528f,
+    0.679418445f, 0.489967376f, -0.167452618f, 0.261932284f, 0.872631848f, 0.0011033999f,
+    0.659093261f, 0.497779518f, -0.169603437f, 0.254572868f, 0.867783308f, 0.00133770541f,
+    0.638566136f, 0.504825294f, -0.171390533f, 0.247129545f, 0.862447381f, 0.00161383522f,
+    0.617982507f, 0.511139452f, -0.172853753f, 0.239654928f, 0.856640637f, 0.00194076926f,
+    0.597310543f, 0.516714633f, -0.173947677f, 0.23210901f, 0.850324631f, 0.00232551969f,
+    0.576257169f, 0.521205485f, -0.174748883f, 0.224490568f, 0.843694448f, 0.00279720756f,
+    0.555290163f, 0.5249331f, -0.175171003f, 0.216862887f, 0.836417913f, 0.00334517681f,
+    0.534446657f, 0.52799803f, -0.175301909f, 0.209257647f, 0.828641713f, 0.00399712659f,
+    0.512859106f, 0.529417098f, -0.17506814f, 0.201620638f, 0.820552647f, 0.00477343146f,
+    0.491612673f, 0.530272543f, -0.174521819f, 0.194092914f, 0.811888576f, 0.00567364367f,
+    0.471006185f, 0.530830026f, -0.1736954f, 0.186675996f, 0.80247438f, 0.00671857642f,
+    0.449909449f, 0.529814482f, -0.172465101f, 0.179228231f, 0.792313755f, 0.00793198403f,
+    0.428637475f, 0.527508378f, -0.170922846f, 0.171818659f, 0.781451344f, 0.00935478043f,
+    0.408055156f, 0.524918795f, -0.169097245f, 0.164528593f, 0.769716024f, 0.0110005504f,
+    0.387871891f, 0.521460414f, -0.166950896f, 0.157425568f, 0.756807506f, 0.0128380358f,
+    0.368577242f, 0.518126488f, -0.164599553f, 0.150553092f, 0.742852151f, 0.0149127105f,
+    0.3480286f, 0.511551559f, -0.161650881f, 0.143552199f, 0.727822363f, 0.0172461383f,
+    0.328772306f, 0.505395293f, -0.158593565f, 0.136909321f, 0.711578548f, 0.0198190119f,
+    0.310107082f, 0.498680055f, -0.155403331f, 0.13051562f, 0.694305182f, 0.0227018408f,
+    0.292051882f, 0.49124217f, -0.151995525f, 0.124256089f, 0.676059186f, 0.0259625819f,
+    0.274012476f, 0.482159317f, -0.148260906f, 0.118172146f, 0.656435072f, 0.0294906497f,
+    0.257533431f, 0.473483115f, -0.144566149f, 0.113011025f, 0.637453496f, 0.0332997963f,
+    0.240547374f, 0.461879015f, -0.140522167f, 0.108055681f, 0.617025554f, 0.0372703709f,
+    0.225219995f, 0.45128414f, -0.136428133f, 0.103465766f, 0.595329106f, 0.0414336547f,
+    0.21033822f, 0.439336002f, -0.13225396f, 0.099179171f, 0.572539449f, 0.0458115377f,
+    0.19682312f, 0.428174883f, -0.128152102f, 0.0954140797f, 0.548496962f, 0.0501695201f,
+    0.183588952f, 0.414882958f, -0.12383502f, 0.0919192433f, 0.523498297f, 0.0544792078f,
+    0.171086311f, 0.400399595f, -0.119568303f, 0.088872835f, 0.497782409f, 0.0587074198f,
+    0.160206869f, 0.386824787f, -0.115444042f, 0.0864243731f, 0.47143966f, 0.0625990704f,
+    0.150907949f, 0.374211133f, -0.111630619f, 0.0847086757f, 0.444797993f, 0.0660569891f,
+    0.143101811f, 0.362346083f, -0.108170539f, 0.0838666633f, 0.418099225f, 0.0687878355f,
+    0.136970177f, 0.351514101f, -0.105101131f, 0.0838959366f, 0.391856581f, 0.070901908f,
+    0.13384451f, 0.345122486f, -0.102853946f, 0.0853369385f, 0.366296291f, 0.0721123591f,
+    0.131721243f, 0.336988926f, -0.10077896f, 0.0878440142f, 0.341796011f, 0.0722926408f,
+    0.135183677f, 0.339578301f, -0.100560166f, 0.0931958705f, 0.318691075f, 0.0713571608f,
+    0.141518578f, 0.343412429f, -0.101032831f, 0.100900866f, 0.297279954f, 0.0692549795f,
+    1.0f, 0.0f, 0.0f, 0.407364994f, 0.916817069f, 1.55968955e-05f,
+    0.998998523f, 0.032546822f, -0.0122654429f, 0.406672269f, 0.91666913f, 1.58176317e-05f,
+    0.997232497f, 0.0541956238f, -0.0204673186f, 0.405962765f, 0.916447401f, 1.65899746e-05f,
+    0.994612813f, 0.0757451952f, -0.0286060777f, 0.404901415f, 0.916102111f, 1.77545007e-05f,
+    0.991160572f, 0.0971682221f, -0.0366821066f, 0.403475493f, 0.915555835f, 1.91309446e-05f,
+    0.986929178f, 0.118441515f, -0.0447357483f, 0.401723623f, 0.914933324f, 2.12113791e-05f,
+    0.981875241f, 0.139528587f, -0.0526759252f, 0.399600685f, 0.914172769f, 2.3765886e-05f,
+    0.976026595f, 0.160371482f, -0.0604307204f, 0.397203743f, 0.913368225f, 2.67232044e-05f,
+    0.96949172f, 0.180985302f, -0.0680626705f, 0.39449659f, 0.91248709f, 3.02980061e-05f,
+    0.962064087f, 0.201308489f, -0.0755861923f, 0.391502291f, 0.911703408f, 3.54713193e-05f,
+    0.953883827f, 0.22134164f, -0.0829798952f, 0.388176411f, 0.910733521f, 4.16883413e-05f,
+    0.944935024f, 0.241061315f, -0.0902657211f, 0.38453266f, 0.909648776f, 4.99932794e-05f,
+    0.935223818f, 0.260418743f, -0.0973713398f, 0.380576789f, 0.908373713f, 5.99735686e-05f,
+    0.924729943f, 0.279350221f, -0.104269326f, 0.376283318f, 0.906862676f, 7.17234216e-05f,
+    0.913395822f, 0.297823727f, -0.110940553f, 0.371662378f, 0.905104637f, 8.54064783e-05f,
+    0.901324034f, 0.31579864f, -0.117372148f, 0.366742164f, 0.903094113f, 0.000101148209f,
+    0.888481379f, 0.333230108f, -0.123539455f, 0.361511588f, 0.900820315f, 0.000119012257f,
+    0.874956906f, 0.350136936f, -0.129504815f, 0.356023848f, 0.898415446f, 0.000141209108f,
+    0.860249043f, 0.366221517f, -0.135217473f, 0.350203395f, 0.895859063f, 0.00016887681f,
+    0.845357001f, 0.381919682f, -0.140720084f, 0.344217718f, 0.893129289f, 0.000203365023f,
+    0.829661369f, 0.396890849f, -0.14597021f, 0.33793509f, 0.890287161f, 0.000247458986f,
+    0.813290417f, 0.41114369f, -0.150916383f, 0.331421912f, 0.887179732f, 0.000300767657f,
+    0.796435118f, 0.424723238f, -0.155467674f, 0.324822873f, 0.884058475f, 0.000363614701f,
+    0.779263258f, 0.43768695f, -0.159705102f, 0.318059951f, 0.880597711f, 0.000437385926f,
+    0.761498988f, 0.449912667f, -0.163640842f, 0.311069429f, 0.876912236f, 0.000528317702f,
+    0.743443668f, 0.461488754f, -0.167296439f, 0.303937972f, 0.872971117f, 0.000640211278f,
+    0.724787652f, 0.472125858f, -0.170604825f, 0.296621442f, 0.868699849f, 0.000775285996f,
+    0.705858588f, 0.482139081f, -0.173549786f, 0.28918165f, 0.8640095f, 0.000933987321f,
+    0.686144173f, 0.491002202f, -0.176115707f, 0.28155762f, 0.858983159f, 0.00112358923f,
+    0.666273355f, 0.4991211f, -0.178353772f, 0.273912996f, 0.853728175f, 0.00134609349f,
+    0.646331608f, 0.506584942f, -0.180289134f, 0.266217411f, 0.848342538f, 0.00161609286f,
+    0.626298368f, 0.513338804f, -0.181941137f, 0.258495569f, 0.842669487f, 0.00194068241f,
+    0.606318057f, 0.519491255f, -0.183250666f, 0.250735283f, 0.836533129f, 0.0023221476f,
+    0.585990071f, 0.524575353f, -0.184204563f, 0.242879838f, 0.829973578f, 0.00277852127f,
+    0.565392554f, 0.528756738f, -0.184817344f, 0.234985933f, 0.822928011f, 0.00332164578f,
+    0.544578612f, 0.531879187f, -0.185059398f, 0.227084547f, 0.815275848f, 0.00395581406f,
+    0.523694277f, 0.534022629f, -0.184906378f, 0.219149306f, 0.807007492f, 0.00469520409f,
+    0.503043413f, 0.535546362f, -0.184449688f, 0.211293712f, 0.798102081f, 0.00555706397f,
+    0.482308835f, 0.536092222f, -0.183648899f, 0.203471377f, 0.788683116f, 0.00656465767f,
+    0.461237967f, 0.53511399f, -0.182541087f, 0.195726424f, 0.778935969f, 0.00774854515f,
+    0.441070765f, 0.534130096f, -0.181104735f, 0.188156322f, 0.768194079f, 0.00908104796f,
+    0.421327472f, 0.532634854f, -0.179354146f, 0.180735216f, 0.756518066f, 0.0105863512f,
+    0.401508719f, 0.529764116f, -0.177234396f, 0.173347414f, 0.744021177f, 0.0123073086f,
+    0.381257772f, 0.525166512f, -0.174711585f, 0.166037202f, 0.730506122f, 0.0142328274f,
+    0.362477601f, 0.521286786f, -0.172074988f, 0.159061313f, 0.715999007f, 0.0163808744f,
+    0.342996806f, 0.515007973f, -0.169142783f, 0.152126253f, 0.700740278f, 0.0188494138f,
+    0.324769229f, 0.50898093f, -0.166042998f, 0.145470887f, 0.684381247f, 0.0215916019f,
+    0.306752831f, 0.501712501f, -0.162598506f, 0.138963088f, 0.66684252f, 0.0245932359f,
+    0.289579332f, 0.494166315f, -0.159026071f, 0.132798538f, 0.648082674f, 0.0278427228f,
+    0.272977829f, 0.485901386f, -0.155130059f, 0.126849174f, 0.628023386f, 0.0312756859f,
+    0.256024837f, 0.474698812f, -0.151067644f, 0.121719688f, 0.608808935f, 0.0349386968f,
+    0.240289137f, 0.463321984f, -0.146931008f, 0.116975486f, 0.588810086f, 0.0388521589f,
+    0.226259843f, 0.453336149f, -0.142880857f, 0.112779446f, 0.567603171f, 0.0428486727f,
+    0.21257852f, 0.441565901f, -0.138691857f, 0.108956568f, 0.545334697f, 0.0468483232f,
+    0.199089289f, 0.427854776f, -0.134249598f, 0.105336219f, 0.522318959f, 0.0509224124f,
+    0.186733603f, 0.413908631f, -0.129980385f, 0.102349907f, 0.498538524f, 0.0548555255f,
+    0.176330462f, 0.401637286f, -0.12603426f, 0.100133345f, 0.47422117f, 0.058544673f,
+    0.166733995f, 0.388320625f, -0.121998437f, 0.098396264f, 0.449602544f, 0.0618645884f,
+    0.159572035f, 0.37796554f, -0.118539453f, 0.0977880284f, 0.424905539f, 0.0645551234f,
+    0.154205993f, 0.369032949f, -0.115724191f, 0.0982708409f, 0.400617301f, 0.0668862015f,
+    0.151020199f, 0.361746281f, -0.113172852f, 0.0998788625f, 0.376800507f, 0.0683003366f,
+    0.155028149f, 0.368329644f, -0.112651959f, 0.104317583f, 0.353869319f, 0.0688876584f,
+    0.155553252f, 0.361698866f, -0.111281678f, 0.10933353f, 0.332089067f, 0.0684845671f,
+    0.161527842f, 0.363594711f, -0.111176766f, 0.117333896f, 0.311730683f, 0.067042239f,
+    1.0f, 0.0f, 0.0f, 0.432720065f, 0.905236125f, 1.71597203e-05f,
+    0.999007761f, 0.0324124172f, -0.0129027562f, 0.431968212f, 0.905132353f, 1.75859732e-05f,
+    0.997275412f, 0.0539419875f, -0.0214174073f, 0.431272686f, 0.905008316f, 1.8566061e-05f,
+    0.994706094f, 0.0753885582f, -0.0299028922f, 0.430185944f, 0.904709101f, 1.9812569e-05f,
+    0.991362631f, 0.0967141762f, -0.038346488f, 0.428736508f, 0.904248893f, 2.14211177e-05f,
+    0.987222314f, 0.117889524f, -0.0467412397f, 0.426910788f, 0.903632164f, 2.34798663e-05f,
+    0.982339561f, 0.138896376f, -0.055095166f, 0.424749166f, 0.902898729f, 2.6356649e-05f,
+    0.976613164f, 0.159683317f, -0.0633481815f, 0.422206134f, 0.901983976f, 2.98942596e-05f,
+    0.970275939f, 0.180279508f, -0.0715197176f, 0.419364363f, 0.901068926f, 3.49618458e-05f,
+    0.963130534f, 0.200585783f, -0.0795155689f, 0.416170806f, 0.899989009f, 4.10040011e-05f,
+    0.955355585f, 0.220629677f, -0.0872653946f, 0.412708431f, 0.898856401f, 4.81064199e-05f,
+    0.946629524f, 0.240322426f, -0.0948032141f, 0.408863157f, 0.897525668f, 5.62235437e-05f,
+    0.937336981f, 0.25966242f, -0.102086864f, 0.404803544f, 0.896115422f, 6.54011383e-05f,
+    0.927151561f, 0.278581351f, -0.10915406f, 0.400366366f, 0.894459784f, 7.56732261e-05f,
+    0.916194975f, 0.297068328f, -0.11609596f, 0.395660847f, 0.892719865f, 8.89965086e-05f,
+    0.904353499f, 0.315024495f, -0.122803934f, 0.390574783f, 0.890774667f, 0.000104891653f,
+    0.891911805f, 0.332540214f, -0.129360542f, 0.385217577f, 0.888756871f, 0.000125910112f,
+    0.878441691f, 0.349359006f, -0.135668457f, 0.379552692f, 0.886521637f, 0.00015151246f,
+    0.86441499f, 0.36568284f, -0.141712457f, 0.37359482f, 0.884061575f, 0.000182797434f,
+    0.85003233f, 0.381540447f, -0.14746733f, 0.367420971f, 0.881302238f, 0.000219398964f,
+    0.83475405f, 0.396652192f, -0.152862102f, 0.36090681f, 0.878229558f, 0.000261805922f,
+    0.818415761f, 0.410862595f, -0.157981783f, 0.354156822f, 0.874968648f, 0.000313665834f,
+    0.802144647f, 0.424707115f, -0.162833363f, 0.347229958f, 0.871491611f, 0.00037723998f,
+    0.785084605f, 0.437708706f, -0.167364433f, 0.340044916f, 0.867787123f, 0.000455523143f,
+    0.767773807f, 0.45013985f, -0.17153734f, 0.332753688f, 0.863852501f, 0.000547765696f,
+    0.750123024f, 0.461882621f, -0.175384939f, 0.325409949f, 0.859957695f, 0.000660643389f,
+    0.732318163f, 0.47304073f, -0.178877145f, 0.317945808f, 0.855645835f, 0.000791958068f,
+    0.714050412f, 0.483451158f, -0.181998253f, 0.310334623f, 0.850931227f, 0.000945155858f,
+    0.694639564f, 0.492492765f, -0.184733242f, 0.30242455f, 0.845980942f, 0.00113361771f,
+    0.67516917f, 0.50092119f, -0.187188551f, 0.294507235f, 0.840679765f, 0.00135910732f,
+    0.655481398f, 0.508565247f, -0.189222455f, 0.286448956f, 0.834914267f, 0.00162213738f,
+    0.635962129f, 0.515766859f, -0.190990925f, 0.278399259f, 0.828802943f, 0.00193857856f,
+    0.616408408f, 0.52218926f, -0.192424536f, 0.270318031f, 0.822504878f, 0.00231801718f,
+    0.596626818f, 0.527839839f, -0.193529055f, 0.262259245f, 0.815896928f, 0.0027633477f,
+    0.576324046f, 0.532261312f, -0.194225445f, 0.254110038f, 0.808813751f, 0.00328414608f,
+    0.555883527f, 0.535692215f, -0.194559395f, 0.24595727f, 0.801237106f, 0.00388972182f,
+    0.535815418f, 0.538711131f, -0.194570422f, 0.237827539f, 0.793159485f, 0.00459933933f,
+    0.515115678f, 0.540284216f, -0.19425413f, 0.229676217f, 0.784595907f, 0.00544302352f,
+    0.494289964f, 0.540619195f, -0.193477675f, 0.22151804f, 0.775247455f, 0.00640331209f,
+    0.474622637f, 0.541402757f, -0.192433074f, 0.213596031f, 0.765058994f, 0.00748551125f,
+    0.454896182f, 0.540901661f, -0.191078082f, 0.20576188f, 0.754337966f, 0.00873386487f,
+    0.435600013f, 0.539973676f, -0.189464316f, 0.198123366f, 0.743200481f, 0.0101574259f,
+    0.415762872f, 0.537245512f, -0.187433913f, 0.190555617f, 0.731131673f, 0.0117460433f,
+    0.396634072f, 0.534103751f, -0.185157046f, 0.183119684f, 0.718340635f, 0.0135621559f,
+    0.377573311f, 0.5300017f, -0.182670578f, 0.175851256f, 0.704779208f, 0.0156397205f,
+    0.35886392f, 0.524938822f, -0.179823577f, 0.16872564f, 0.690171897f, 0.0179369599f,
+    0.340729535f, 0.519132674f, -0.176714361f, 0.161796138f, 0.674586952f, 0.0204870049f,
+    0.323395312f, 0.512982428f, -0.173422039f, 0.155217767f, 0.657825828f, 0.0232381579f,
+    0.306087434f, 0.505417526f, -0.169785932f, 0.148808077f, 0.639977038f, 0.0261989143f,
+    0.288866043f, 0.496241689f, -0.165838748f, 0.142574012f, 0.621098578f, 0.0293788947f,
+    0.272288263f, 0.486222088f, -0.161746323f, 0.136604637f, 0.601311147f, 0.0328191817f,
+    0.257300317f, 0.476455837f, -0.157783836f, 0.131930754f, 0.582562327f, 0.0363980308f,
+    0.243195221f, 0.466098219f, -0.153682336f, 0.127725303f, 0.562933326f, 0.0400289372f,
+    0.229308084f, 0.454172194f, -0.149387136f, 0.123760782f, 0.542553186f, 0.0438191108f,
+    0.216451943f, 0.44170779f, -0.145155057f, 0.120351873f, 0.521352589f, 0.0476060957f,
+    0.204711437f, 0.429441273f, -0.141064122f, 0.117597349f, 0.499465227f, 0.0512837693f,
+    0.193937361f, 0.41633597f, -0.136872068f, 0.115294166f, 0.477108717f, 0.0548027381f,
+    0.186218604f, 0.407462418f, -0.133335143f, 0.114207283f, 0.454386324f, 0.0579209179f,
+    0.178608358f, 0.395779699f, -0.12968497f, 0.113621593f, 0.431698024f, 0.0607260391f,
+    0.172768965f, 0.385584474f, -0.126500189f, 0.114139877f, 0.409205228f, 0.0631050542f,
+    0.169960856f, 0.378574848f, -0.123852447f, 0.11609643f, 0.387087971f, 0.0647274479f,
+    0.173119783f, 0.381866902f, -0.122870862f, 0.120710514f, 0.36568293f, 0.0656628758f,
+    0.174726069f, 0.377471477f, -0.121379688f, 0.126282841f, 0.345211029f, 0.065709725f,
+    0.182713166f, 0.382207364f, -0.12156409f, 0.13547869f, 0.325920522f, 0.0648356527f,
+    1.0f, 0.0f, 0.0f, 0.45828709f, 0.892784953f, 1.87780224e-05f,
+    0.999016166f, 0.0322276354f, -0.0134351123f, 0.457584321f, 0.892651677f, 1.91743857e-05f,
+    0.997314632f, 0.0536510721f, -0.0223524459f, 0.45681119f, 0.892354488f, 1.98984144e-05f,
+    0.994826734f, 0.0749951005f, -0.0312869586f, 0.455665439f, 0.891942263f, 2.12212981e-05f,
+    0.991567075f, 0.0962023586f, -0.040104676f, 0.45416373f, 0.89145869f, 2.30944734e-05f,
+    0.987555206f, 0.117266737f, -0.0488623641f, 0.452342212f, 0.891024411f, 2.60439028e-05f,
+    0.982804656f, 0.138149887f, -0.0575029217f, 0.450148165f, 0.890402675f, 2.95302652e-05f,
+    0.977351427f, 0.158831328f, -0.0660268515f, 0.447565109f, 0.889561653f, 3.35928016e-05f,
+    0.971275091f, 0.179297f, -0.0744154453f, 0.44461754f, 0.888497233f, 3.82484868e-05f,
+    0.964492083f, 0.199576959f, -0.0826441869f, 0.441309184f, 0.887189686f, 4.34120921e-05f,
+    0.957072496f, 0.219598144f, -0.090741396f, 0.43766737f, 0.885719895f, 4.95893e-05f,
+    0.948621511f, 0.239295527f, -0.098730728f, 0.433636785f, 0.884188652f, 5.78292384e-05f,
+    0.939488709f, 0.258631706f, -0.106516123f, 0.429334372f, 0.882553458f, 6.77929274e-05f,
+    0.929646313f, 0.277588904f, -0.114054769f, 0.424769789f, 0.881031394f, 8.05572708e-05f,
+    0.918851495f, 0.296012014f, -0.121351786f, 0.419851333f, 0.879366398f, 9.59270983e-05f,
+    0.907471657f, 0.31399861f, -0.128390148f, 0.414723426f, 0.877686501f, 0.000114970651f,
+    0.895243168f, 0.331459045f, -0.135159999f, 0.409270316f, 0.875714362f, 0.00013701804f,
+    0.882348955f, 0.348405927f, -0.141629919f, 0.40347141f, 0.873440266f, 0.000162281955f,
+    0.869117022f, 0.364940584f, -0.147871375f, 0.397440493f, 0.870950758f, 0.000192738604f,
+    0.855010033f, 0.380808592f, -0.153816417f, 0.391075641f, 0.868216991f, 0.000229112557f,
+    0.83998251f, 0.395937353f, -0.159513146f, 0.384429604f, 0.865325928f, 0.000274588063f,
+    0.824397624f, 0.410445869f, -0.164932668f, 0.377572596f, 0.862195849f, 0.000329849485f,
+    0.808393657f, 0.424370259f, -0.170017958f, 0.370424569f, 0.858810425f, 0.000396544056f,
+    0.792069256f, 0.437716633f, -0.174753562f, 0.363112897f, 0.855060518f, 0.000473878055f,
+    0.775401056f, 0.450438261f, -0.179107502f, 0.355610698f, 0.850927472f, 0.000562678266f,
+    0.758389413f, 0.462547272f, -0.183169171f, 0.347990125f, 0.846526265f, 0.000668837922f,
+    0.740653157f, 0.473743826f, -0.186904997f, 0.340067327f, 0.841988564f, 0.000802212453f,
+    0.722171128f, 0.483938992f, -0.190197885f, 0.332150072f, 0.837310731f, 0.00095701823f,
+    0.703540742f, 0.493496358f, -0.193112165f, 0.32412532f, 0.832345486f, 0.00113970635f,
+    0.684692085f, 0.502282321f, -0.195708036f, 0.315967262f, 0.827101171f, 0.00136089011f,
+    0.665789545f, 0.510519743f, -0.198030561f, 0.307758182f, 0.821577489f, 0.00162965257f,
+    0.647038519f, 0.518266082f, -0.19997789f, 0.299555898f, 0.815506876f, 0.00193892478f,
+    0.627987802f, 0.52515322f, -0.201536879f, 0.291253835f, 0.808999777f, 0.00230249809f,
+    0.60821259f, 0.530751646f, -0.202651054f, 0.282816261f, 0.802029073f, 0.00272517884f,
+    0.588223994f, 0.535444498f, -0.203434795f, 0.27436313f, 0.794712603f, 0.00322453305f,
+    0.568392873f, 0.539492607f, -0.20392555f, 0.265950084f, 0.787298739f, 0.00382315251f,
+    0.548788667f, 0.542957723f, -0.204046041f, 0.257619649f, 0.779204309f, 0.00450713187f,
+    0.528256834f, 0.544596314f, -0.203707278f, 0.249248222f, 0.770522714f, 0.00528243324f,
+    0.508895874f, 0.546568811f, -0.203195542f, 0.241078451f, 0.761377394f, 0.00618461892f,
+    0.489132613f, 0.547149718f, -0.202205881f, 0.232818276f, 0.751654267f, 0.00721502211f,
+    0.470120966f, 0.547623038f, -0.201047495f, 0.224844992f, 0.741239071f, 0.0083879577f,
+    0.451365083f, 0.547339857f, -0.199521914f, 0.216929987f, 0.730105937f, 0.00971779414f,
+    0.431616634f, 0.544889987f, -0.197651923f, 0.209057227f, 0.718607366f, 0.0112483595f,
+    0.412768424f, 0.542140663f, -0.195554048f, 0.201410219f, 0.706597328f, 0.0129867429f,
+    0.394116402f, 0.538587987f, -0.19318071f, 0.193995029f, 0.693651855f, 0.0149159459f,
+    0.375424296f, 0.533493519f, -0.190377414f, 0.186634168f, 0.679792106f, 0.0170578118f,
+    0.358104795f, 0.528973877f, -0.187456757f, 0.179700285f, 0.664896846f, 0.0193822961f,
+    0.340402693f, 0.52227658f, -0.184037581f, 0.172792196f, 0.649022877f, 0.0219015516f,
+    0.324153334f, 0.516505659f, -0.180651665f, 0.166374847f, 0.63223809f, 0.0246354863f,
+    0.306739748f, 0.507198155f, -0.176774442f, 0.159899637f, 0.614645362f, 0.0276292358f,
+    0.290617466f, 0.497975796f, -0.172811583f, 0.153862149f, 0.596031487f, 0.0307837613f,
+    0.275680304f, 0.489214957f, -0.168808848f, 0.148364261f, 0.57649821f, 0.0340223201f,
+    0.261661559f, 0.479120225f, -0.164774716f, 0.144137263f, 0.558655143f, 0.037466459f,
+    0.248208672f, 0.467906266f, -0.160574019f, 0.140267983f, 0.539997041f, 0.0410024896f,
+    0.235450834f, 0.455807149f, -0.1563171f, 0.136922464f, 0.520550549f, 0.0445120372f,
+    0.223415524f, 0.442927569f, -0.152038515f, 0.134099126f, 0.500524282f, 0.0479875281f,
+    0.213305727f, 0.43139571f, -0.148010969f, 0.13210535f, 0.480017871f, 0.0513096489f,
+    0.20491071f, 0.420713216f, -0.144192889f, 0.131018147f, 0.459167778f, 0.054291036f,
+    0.198761672f, 0.412389308f, -0.140953615f, 0.130990833f, 0.43838948f, 0.057205718f,
+    0.194741696f, 0.405478001f, -0.138086587f, 0.132234171f, 0.417604864f, 0.0595733002f,
+    0.189752266f, 0.393626273f, -0.134592652f, 0.133836448f, 0.397135198f, 0.0613856278f,
+    0.192485377f, 0.394846469f, -0.133233562f, 0.138718337f, 0.37721023f, 0.0625931323f,
+    0.198504552f, 0.398695529f, -0.132113189f, 0.145424455f, 0.358034194f, 0.0630277321f,
+    0.204923704f, 0.398655891f, -0.131502241f, 0.154674426f, 0.339825273f, 0.062646158f,
+    1.0f, 0.0f, 0.0f, 0.484455466f, 0.879479647f, 2.05539272e-05f,
+    0.999035656f, 0.0320125856f, -0.0139177246f, 0.483500063f, 0.879410923f, 2.10493927e-05f,
+    0.997383535f, 0.0532924347f, -0.0231993068f, 0.482761115f, 0.8792606f, 2.21553037e-05f,
+    0.994960725f, 0.0744875446f, -0.0324358419f, 0.481590807f, 0.878878772f, 2.36372107e-05f,
+    0.991853178f, 0.0955631211f, -0.0416004956f, 0.480009586f, 0.87825948f, 2.54994466e-05f,
+    0.988077402f, 0.116473578f, -0.0506724417f, 0.478048533f, 0.877399027f, 2.77185209e-05f,
+    0.983522475f, 0.13721396f, -0.0596145988f, 0.475672662f, 0.876421034f, 3.04900932e-05f,
+    0.978496253f, 0.157834113f, -0.0684837475f, 0.473025292f, 0.875452816f, 3.43980282e-05f,
+    0.972711742f, 0.178252369f, -0.0772269964f, 0.470073342f, 0.874527216f, 3.96903488e-05f,
+    0.966125965f, 0.198436841f, -0.0857646465f, 0.466740578f, 0.873455703f, 4.57508395e-05f,
+    0.959033072f, 0.218384877f, -0.0942069143f, 0.46313712f, 0.872221589f, 5.32242157e-05f,
+    0.950810015f, 0.237972602f, -0.102458142f, 0.459024787f, 0.870779753f, 6.21604486e-05f,
+    0.941866159f, 0.257267743f, -0.110565968f, 0.45456177f, 0.869207978f, 7.35505964e-05f,
+    0.932256818f, 0.276164562f, -0.11844375f, 0.4497765f, 0.867381752f, 8.67024428e-05f,
+    0.921989262f, 0.294680625f, -0.126058549f, 0.444631308f, 0.865277946f, 0.00010162963f,
+    0.911024809f, 0.312711954f, -0.133407205f, 0.439229548f, 0.863179982f, 0.000120025383f,
+    0.899016619f, 0.330150753f, -0.140436187f, 0.433508962f, 0.860930681f, 0.000141486307f,
+    0.886448622f, 0.34711346f, -0.14720726f, 0.427558273f, 0.85862869f, 0.000167960112f,
+    0.87348187f, 0.363588184f, -0.153701827f, 0.421428859f, 0.856378913f, 0.000200956682f,
+    0.859691918f, 0.379444629f, -0.159919515f, 0.414987683f, 0.853887439f, 0.000240784182f,
+    0.845403254f, 0.394813389f, -0.16582188f, 0.408320099f, 0.851067126f, 0.000286823022f,
+    0.830698609f, 0.40959838f, -0.171360284f, 0.401366293f, 0.847895682f, 0.000339430699f,
+    0.815605223f, 0.423823863f, -0.176583052f, 0.394179136f, 0.844446003f, 0.000401079014f,
+    0.799663961f, 0.437292814f, -0.181528986f, 0.386707425f, 0.840839505f, 0.000477693306f,
+    0.783548415f, 0.450272799f, -0.186183929f, 0.379108131f, 0.836945951f, 0.000569411844f,
+    0.767136514f, 0.462618679f, -0.19051756f, 0.371339977f, 0.832775176f, 0.000678579963f,
+    0.749326468f, 0.473689556f, -0.194405586f, 0.36324206f, 0.828272283f, 0.000806833094f,
+    0.731341302f, 0.484185904f, -0.198033661f, 0.354988843f, 0.823616207f, 0.000966543797f,
+    0.713398993f, 0.494161725f, -0.201329544f, 0.346679777f, 0.818600297f, 0.00115549378f,
+    0.69551754f, 0.503645658f, -0.204211324f, 0.338412881f, 0.813315213f, 0.00137381745f,
+    0.677098572f, 0.512196839f, -0.20659931f, 0.329991251f, 0.807834029f, 0.00163040729f,
+    0.659063458f, 0.520396113f, -0.208698601f, 0.321669638f, 0.801877618f, 0.00192704203f,
+    0.640660048f, 0.527780652f, -0.210468873f, 0.313242674f, 0.795602441f, 0.00228102691f,
+    0.621022582f, 0.533413708f, -0.211766154f, 0.304504573f, 0.789004028f, 0.0027069035f,
+    0.601549983f, 0.538550377f, -0.212733164f, 0.295894235f, 0.781818211f, 0.00319551257f,
+    0.582482755f, 0.543312132f, -0.213261023f, 0.287315518f, 0.773967624f, 0.00374579872f,
+    0.562993288f, 0.546883821f, -0.213436469f, 0.278713107f, 0.765668154f, 0.00438791513f,
+    0.542966068f, 0.549000919f, -0.213164315f, 0.270124555f, 0.757140994f, 0.00512258289f,
+    0.523994505f, 0.551296055f, -0.212716311f, 0.261736363f, 0.748149574f, 0.00597799057f,
+    0.505431592f, 0.553152442f, -0.211946294f, 0.253500521f, 0.738485277f, 0.00694123888f,
+    0.486761153f, 0.554031909f, -0.210864648f, 0.245295808f, 0.728387833f, 0.00804885104f,
+    0.468253076f, 0.554054856f, -0.209537029f, 0.237169191f, 0.717882574f, 0.00933290366f,
+    0.448382139f, 0.551486969f, -0.207717583f, 0.228990376f, 0.706701934f, 0.0107784579f,
+    0.430248559f, 0.549925268f, -0.205756247f, 0.221199512f, 0.694698334f, 0.0123875961f,
+    0.411237001f, 0.545751512f, -0.203405842f, 0.213512138f, 0.682459056f, 0.0141893867f,
+    0.393799692f, 0.542355835f, -0.200801313f, 0.206163183f, 0.669288099f, 0.0161416624f,
+    0.37629655f, 0.537727535f, -0.197910294f, 0.199047267f, 0.655240595f, 0.0182683971f,
+    0.359384984f, 0.532202899f, -0.194700673f, 0.192052364f, 0.64043802f, 0.0206126347f,
+    0.343158275f, 0.526461065f, -0.191443771f, 0.185436502f, 0.624879956f, 0.0231919251f,
+    0.326109707f, 0.517766297f, -0.187684372f, 0.178873166f, 0.60838598f, 0.0259386394f,
+    0.310629725f, 0.509887576f, -0.183918387f, 0.17287302f, 0.590951979f, 0.0287961606f,
+    0.29509303f, 0.499933928f, -0.179863662f, 0.166995838f, 0.572845519f, 0.031872794f,
+    0.28058508f, 0.490088969f, -0.175700337f, 0.161795884f, 0.554589093f, 0.0350728706f,
+    0.267941952f, 0.480147272f, -0.171657071f, 0.158140555f, 0.53757292f, 0.0383447371f,
+    0.255869627f, 0.469306141f, -0.167544574f, 0.155003086f, 0.519881964f, 0.0416380279f,
+    0.244188413f, 0.457093209f, -0.163325295f, 0.152357951f, 0.501637757f, 0.0449163616f,
+    0.236165598f, 0.449526519f, -0.159739345f, 0.151020452f, 0.482892752f, 0.0480162874f,
+    0.226263463f, 0.436187178f, -0.155641273f, 0.149811551f, 0.463954359f, 0.0510300435f,
+    0.220443428f, 0.428208798f, -0.152256027f, 0.149976164f, 0.444909811f, 0.0539046042f,
+    0.217156187f, 0.42190209f, -0.149275333f, 0.15157941f, 0.425787866f, 0.0562652126f,
+    0.212633312f, 0.411558628f, -0.145900011f, 0.153751776f, 0.406918049f, 0.0582538061f,
+    0.215335086f, 0.411209464f, -0.144063517f, 0.158833504f, 0.388434142f, 0.0596738085f,
+    0.221953481f, 0.414811492f, -0.142724812f, 0.166112378f, 0.370540977f, 0.0604403503f,
+    0.22931242f, 0.4157722f, -0.141755044f, 0.175909922f, 0.353424221f, 0.0604827814f,
+    1.0f, 0.0f, 0.0f, 0.510234952f, 0.86515063f, 2.20275269e-05f,
+    0.999025464f, 0.0317853689f, -0.014516077f, 0.50948f, 0.86492312f, 2.23782281e-05f,
+    0.997432053f, 0.0528836697f, -0.02405506f, 0.508660138f, 0.864555597f, 2.31523954e-05f,
+    0.99517101f, 0.0738843083f, -0.0334975012f, 0.507547677f, 0.864325047f, 2.48909691e-05f,
+    0.992203712f, 0.0947563872f, -0.0428657271f, 0.506022751f, 0.86390996f, 2.69661195e-05f,
+    0.988664687f, 0.115520194f, -0.0522332303f, 0.504105151f, 0.863369644f, 2.98283685e-05f,
+    0.984358966f, 0.136112168f, -0.0614912622f, 0.501771688f, 0.862573683f, 3.31132796e-05f,
+    0.979538798f, 0.156587571f, -0.0706706941f, 0.499067336f, 0.861590326f, 3.71815186e-05f,
+    0.974065244f, 0.176863298f, -0.0797464922f, 0.495980561f, 0.860415757f, 4.2221367e-05f,
+    0.96778059f, 0.197032303f, -0.0887360647f, 0.492496312f, 0.859113336f, 4.88524565e-05f,
+    0.960927784f, 0.216916084f, -0.0975546464f, 0.488694489f, 0.857685328f, 5.70046432e-05f,
+    0.953095376f, 0.236421809f, -0.106053732f, 0.484518975f, 0.856244326f, 6.64768959e-05f,
+    0.944837928f, 0.255684674f, -0.114337273f, 0.480105102f, 0.854732513f, 7.77636669e-05f,
+    0.93578583f, 0.27457878f, -0.122411571f, 0.475328863f, 0.852977216f, 9.08011862e-05f,
+    0.9258672f, 0.293049455f, -0.13025564f, 0.470125586f, 0.851000428f, 0.000106138476f,
+    0.914855182f, 0.310962737f, -0.13790372f, 0.464527458f, 0.84887439f, 0.000125312727f,
+    0.903271854f, 0.328432649f, -0.145360082f, 0.458666086f, 0.846580029f, 0.000149201136f,
+    0.891302109f, 0.345522195f, -0.15247725f, 0.452430993f, 0.843982458f, 0.0001766356f,
+    0.878868639f, 0.362099469f, -0.159166634f, 0.446097553f, 0.841316342f, 0.000207781675f,
+    0.865582883f, 0.378058195f, -0.165543497f, 0.439408809f, 0.838404655f, 0.000244157738f,
+    0.851519525f, 0.393358022f, -0.171577543f, 0.432546973f, 0.835494518f, 0.000287972944f,
+    0.837115169f, 0.408112079f, -0.17741096f, 0.425507575f, 0.832550704f, 0.000343404361f,
+    0.822885156f, 0.422691494f, -0.182981461f, 0.418346584f, 0.829467237f, 0.000409925415f,
+    0.807676613f, 0.436414897f, -0.188149676f, 0.410862088f, 0.826028883f, 0.000486872072f,
+    0.792540073f, 0.449781597f, -0.193070129f, 0.403268218f, 0.82236284f, 0.000579318264f,
+    0.776519537f, 0.462328404f, -0.197693333f, 0.395390421f, 0.818518817f, 0.000693940208f,
+    0.759423375f, 0.473755389f, -0.201854184f, 0.387215018f, 0.81427902f, 0.000826778065f,
+    0.742084444f, 0.48454231f, -0.205635816f, 0.378878176f, 0.809687078f, 0.00098215288f,
+    0.724715948f, 0.494745642f, -0.209044203f, 0.370425463f, 0.804718018f, 0.00116351817f,
+    0.707574904f, 0.504715204f, -0.212144837f, 0.362012506f, 0.799342573f, 0.00137354003f,
+    0.689783156f, 0.513701677f, -0.214816138f, 0.353308171f, 0.793677866f, 0.00162439502f,
+    0.67201072f, 0.522126794f, -0.217219368f, 0.3447043f, 0.78787142f, 0.00192616193f,
+    0.653430045f, 0.529159606f, -0.219038188f, 0.33600086f, 0.781813085f, 0.00227285479f,
+    0.634652257f, 0.535511971f, -0.22045356f, 0.327318341f, 0.775200725f, 0.0026659756f,
+    0.616496563f, 0.541632175f, -0.221563473f, 0.318688214f, 0.768151164f, 0.00312146754f,
+    0.598030031f, 0.546924591f, -0.222321868f, 0.310024202f, 0.76068002f, 0.00365145877f,
+    0.578234136f, 0.550046325f, -0.222621948f, 0.301174164f, 0.752790868f, 0.00427067885f,
+    0.55924648f, 0.55317986f, -0.222527832f, 0.292416662f, 0.744268477f, 0.00496788509f,
+    0.540784061f, 0.556108475f, -0.222181469f, 0.283839554f, 0.735227048f, 0.00576524669f,
+    0.522584558f, 0.558364868f, -0.221629173f, 0.275480092f, 0.726120234f, 0.00669141253f,
+    0.504115462f, 0.559414804f, -0.220697671f, 0.267104834f, 0.716468334f, 0.00775715709f,
+    0.485207081f, 0.558968186f, -0.219304472f, 0.258746892f, 0.706104279f, 0.00895049889f,
+    0.466436148f, 0.557482421f, -0.217511177f, 0.250443488f, 0.695087135f, 0.0102914693f,
+    0.448200047f, 0.555762947f, -0.215532869f, 0.242443725f, 0.683505356f, 0.0117801921f,
+    0.430190533f, 0.552907944f, -0.213242635f, 0.234624133f, 0.671320856f, 0.0134106772f,
+    0.413346201f, 0.550547659f, -0.210860997f, 0.227246761f, 0.658718705f, 0.0152047928f,
+    0.396460474f, 0.546614766f, -0.208213806f, 0.220012948f, 0.645804048f, 0.0172126628f,
+    0.379273266f, 0.540846169f, -0.20520696f, 0.21289216f, 0.632138789f, 0.0194163863f,
+    0.363267004f, 0.535266936f, -0.202000543f, 0.206115544f, 0.61764127f, 0.0217887703f,
+    0.348029941f, 0.52947855f, -0.198631182f, 0.199775264f, 0.602265239f, 0.0242802966f,
+    0.331296533f, 0.519849956f, -0.194808424f, 0.193395421f, 0.58625412f, 0.0269880425f,
+    0.316073656f, 0.510711133f, -0.190865949f, 0.187429547f, 0.569477975f, 0.0298332516f,
+    0.302271754f, 0.502078116f, -0.186949074f, 0.181998014f, 0.551990151f, 0.0328051187f,
+    0.289309442f, 0.492193729f, -0.182897747f, 0.177716196f, 0.535280645f, 0.035861101f,
+    0.277478665f, 0.481876731f, -0.178849399f, 0.174740002f, 0.519295812f, 0.0389621817f,
+    0.266383737f, 0.470466971f, -0.1746369f, 0.172259063f, 0.502773166f, 0.0420527123f,
+    0.25804311f, 0.462130815f, -0.170842066f, 0.170943245f, 0.485793948f, 0.0450159833f,
+    0.249261364f, 0.45058614f, -0.166872725f, 0.170031369f, 0.468640268f, 0.0480260402f,
+    0.243409991f, 0.442394465f, -0.163422465f, 0.170554668f, 0.451227993f, 0.0507863536f,
+    0.240859449f, 0.437682122f, -0.16053918f, 0.172716305f, 0.433746129f, 0.0531923771f,
+    0.237227827f, 0.428159386f, -0.156984314f, 0.175210863f, 0.416411817f, 0.055295065f,
+    0.239776462f, 0.42717573f, -0.154790521f, 0.180610657f, 0.39934063f, 0.0568982624f,
+    0.24586165f, 0.428518265f, -0.15312013f, 0.188346952f, 0.38271746f, 0.0579473712f,
+    0.256010443f, 0.432786435f, -0.151316956f, 0.198076397f, 0.366701841f, 0.0583534203f,
+    1.0f, 0.0f, 0.0f, 0.536414266f, 0.850091517f, 2.3739889e-05f,
+    0.999046624f, 0.0314700641f, -0.0148373824f, 0.535707116f, 0.849961758f, 2.42247716e-05f,
+    0.997512579f, 0.0523871109f, -0.024741808f, 0.534917951f, 0.849704981f, 2.53044145e-05f,
+    0.995298684f, 0.0731953159f, -0.0345635079f, 0.533699036f, 0.849253535f, 2.68036856e-05f,
+    0.992553651f, 0.093908146f, -0.044339247f, 0.53208971f, 0.848664939f, 2.88739811e-05f,
+    0.989141107f, 0.114471406f, -0.0539921522f, 0.53016299f, 0.848115861f, 3.19591745e-05f,
+    0.985103607f, 0.134851441f, -0.0634671152f, 0.527862728f, 0.847572863f, 3.59912447e-05f,
+    0.980514467f, 0.155122712f, -0.0728629977f, 0.525225103f, 0.846807063f, 4.08165615e-05f,
+    0.975318611f, 0.175235704f, -0.0821045414f, 0.522138059f, 0.84576714f, 4.62605822e-05f,
+    0.96949774f, 0.195218235f, -0.0912189558f, 0.518657684f, 0.844514012f, 5.27144402e-05f,
+    0.962808073f, 0.21490857f, -0.100175522f, 0.514766514f, 0.843039036f, 6.03283843e-05f,
+    0.955734551f, 0.234473854f, -0.1089347f, 0.510540426f, 0.8412956f, 6.88165455e-05f,
+    0.947591364f, 0.253599316f, -0.117576167f, 0.505892992f, 0.839454412f, 7.97899193e-05f,
+    0.938755989f, 0.272394866f, -0.126074612f, 0.500872433f, 0.837560654f, 9.42149418e-05f,
+    0.929130256f, 0.290787965f, -0.13421534f, 0.495552808f, 0.835557342f, 0.000110846966f,
+    0.91897577f, 0.308782697f, -0.142055169f, 0.490061313f, 0.833535731f, 0.000130350803f,
+    0.908235431f, 0.326367736f, -0.149636477f, 0.484213442f, 0.831316829f, 0.000153124012f,
+    0.896856606f, 0.343442619f, -0.156956777f, 0.478047371f, 0.8288517f, 0.000179671464f,
+    0.884674132f, 0.360051274f, -0.164011046f, 0.47149685f, 0.826184571f, 0.000211668201f,
+    0.871458769f, 0.375956208f, -0.170845017f, 0.464593619f, 0.823401213f, 0.00025213536f,
+    0.858514369f, 0.391582668f, -0.177347243f, 0.457674772f, 0.820524633f, 0.000299766398f,
+    0.845070601f, 0.406745732f, -0.183454603f, 0.450543702f, 0.81744194f, 0.000354885269f,
+    0.831020594f, 0.421254158f, -0.189250037f, 0.443149447f, 0.814266443f, 0.000422445504f,
+    0.816764235f, 0.435288697f, -0.194719493f, 0.43569985f, 0.811024964f, 0.000504198077f,
+    0.80187881f, 0.44868058f, -0.199750453f, 0.4279055f, 0.8074072f, 0.000598620391f,
+    0.785997391f, 0.461127669f, -0.20440641f, 0.419925511f, 0.803490102f, 0.000708136649f,
+    0.769586384f, 0.47271046f, -0.208660483f, 0.411715031f, 0.799309254f, 0.000835585583f,
+    0.753200054f, 0.483977586f, -0.21258527f, 0.40341863f, 0.794778943f, 0.000983740552f,
+    0.736652493f, 0.494585633f, -0.216186047f, 0.394937843f, 0.789990067f, 0.00116108987f,
+    0.719621539f, 0.504543483f, -0.219457999f, 0.386286229f, 0.784933329f, 0.00137445843f,
+    0.702706039f, 0.513947129f, -0.222323701f, 0.377564341f, 0.779431641f, 0.00162002991f,
+    0.685867548f, 0.522889435f, -0.224889904f, 0.368951529f, 0.773497701f, 0.0019011437f,
+    0.667421818f, 0.530116022f, -0.226906672f, 0.359987289f, 0.767173588f, 0.00222611264f,
+    0.649388194f, 0.536897719f, -0.228558704f, 0.351084828f, 0.76069808f, 0.00260574627f,
+    0.631864011f, 0.543566167f, -0.229912013f, 0.342381239f, 0.754134357f, 0.00305138575f,
+    0.613146007f, 0.548414588f, -0.230732366f, 0.333530128f, 0.747005165f, 0.00355468364f,
+    0.594453633f, 0.55254817f, -0.231198415f, 0.324711233f, 0.739399433f, 0.00413023494f,
+    0.57655257f, 0.556548893f, -0.231412038f, 0.316024005f, 0.731351078f, 0.00479403837f,
+    0.558178544f, 0.559482396f, -0.231317177f, 0.307262093f, 0.722981989f, 0.00557814818f,
+    0.540415883f, 0.562174439f, -0.230895519f, 0.298658103f, 0.714007437f, 0.00646467647f,
+    0.522822917f, 0.564023495f, -0.230064228f, 0.29017362f, 0.704481602f, 0.00745394174f,
+    0.503830731f, 0.563545823f, -0.228731588f, 0.281665027f, 0.694654107f, 0.00856640935f,
+    0.486218244f, 0.563450217f, -0.22720857f, 0.27357614f, 0.684081972f, 0.00978741515f,
+    0.468539745f, 0.56216675f, -0.225224927f, 0.265520126f, 0.672824442f, 0.0111310994f,
+    0.450596243f, 0.55958569f, -0.22295329f, 0.257563263f, 0.661049724f, 0.0126412939f,
+    0.433490694f, 0.556642056f, -0.220464468f, 0.2497008f, 0.64897722f, 0.0143434471f,
+    0.416496068f, 0.552676618f, -0.217903063f, 0.242246866f, 0.636543393f, 0.0162181556f,
+    0.400729954f, 0.54890871f, -0.215202987f, 0.235222653f, 0.623911202f, 0.0182503369f,
+    0.385309666f, 0.544139087f, -0.212289244f, 0.228601009f, 0.610462785f, 0.020400105f,
+    0.370031267f, 0.538360536f, -0.209117278f, 0.222129881f, 0.596428633f, 0.0227553509f,
+    0.35382089f, 0.529455006f, -0.205349043f, 0.21558103f, 0.581678748f, 0.0252573825f,
+    0.338686466f, 0.520695627f, -0.201663077f, 0.209623516f, 0.56628114f, 0.0279228147f,
+    0.325049341f, 0.51248157f, -0.197947577f, 0.204191118f, 0.550212801f, 0.0306971874f,
+    0.311774433f, 0.502977192f, -0.193908006f, 0.198977262f, 0.533514261f, 0.0335570611f,
+    0.300457388f, 0.493307024f, -0.189872324f, 0.195887387f, 0.518774927f, 0.0364845656f,
+    0.291342348f, 0.485649168f, -0.186203986f, 0.194206133f, 0.50388217f, 0.0393621735f,
+    0.281688124f, 0.474529773f, -0.181969628f, 0.192579344f, 0.4886657f, 0.0422827564f,
+    0.275129318f, 0.467058152f, -0.178405374f, 0.192366511f, 0.473172218f, 0.0452238731f,
+    0.269054234f, 0.458149046f, -0.174839333f, 0.193223059f, 0.457356095f, 0.0478909686f,
+    0.266188115f, 0.452142239f, -0.171546325f, 0.195437074f, 0.441452503f, 0.0503207855f,
+    0.26606822f, 0.448354751f, -0.168679908f, 0.199309021f, 0.425604701f, 0.0524991825f,
+    0.265232444f, 0.439978123f, -0.165156648f, 0.203865603f, 0.409918517f, 0.0542592853f,
+    0.270859092f, 0.440489352f, -0.16278334f, 0.211577713f, 0.394551635f, 0.0555448942f,
+    0.280730635f, 0.442898601f, -0.160787672f, 0.222021803f, 0.379643708f, 0.0562649146f,
+    1.0f, 0.0f, 0.0f, 0.562590837f, 0.834126055f, 2.52463415e-05f,
+    0.999038577f, 0.0311291534f, -0.0152264535f, 0.561887145f, 0.83393079f, 2.56456733e-05f,
+    0.997581542f, 0.0518140234f, -0.0253770482f, 0.561098278f, 0.833655357f, 2.67630876e-05f,
+    0.995450199f, 0.0723688602f, -0.0354294218f, 0.559890449f, 0.833301961f, 2.85546721e-05f,
+    0.992881179f, 0.09285146f, -0.0454452373f, 0.558336496f, 0.832899034f, 3.12405828e-05f,
+    0.989723861f, 0.113160558f, -0.0553697348f, 0.556362629f, 0.832224727f, 3.43320717e-05f,
+    0.986005962f, 0.133381352f, -0.0652082637f, 0.553926945f, 0.831325889f, 3.80158526e-05f,
+    0.981745362f, 0.153492406f, -0.0748972744f, 0.551133811f, 0.830343664f, 4.26408806e-05f,
+    0.976814926f, 0.173403352f, -0.0842504948f, 0.548062503f, 0.829342902f, 4.78430484e-05f,
+    0.971209586f, 0.193152115f, -0.0934862867f, 0.544634223f, 0.828309655f, 5.4398366e-05f,
+    0.964843333f, 0.212701336f, -0.102641553f, 0.540804982f, 0.827119231f, 6.26233596e-05f,
+    0.957886755f, 0.231985509f, -0.111710049f, 0.536635935f, 0.825803041f, 7.31104956e-05f,
+    0.95052135f, 0.251078546f, -0.120608248f, 0.532120705f, 0.824281752f, 8.56471306e-05f,
+    0.942384303f, 0.269803464f, -0.129250482f, 0.527196407f, 0.82246536f, 9.98299147e-05f,
+    0.933498681f, 0.288264304f, -0.137631908f, 0.521862268f, 0.820376396f, 0.000115942712f,
+    0.923809707f, 0.306242675f, -0.14579463f, 0.516185701f, 0.818072796f, 0.000134964415f,
+    0.913437486f, 0.323785812f, -0.153802425f, 0.510191798f, 0.815761209f, 0.000159643751f,
+    0.902365327f, 0.340884984f, -0.16144979f, 0.503849506f, 0.81345284f, 0.000189627026f,
+    0.891013563f, 0.357570678f, -0.168781519f, 0.497420609f, 0.810942709f, 0.000224040719f,
+    0.878674269f, 0.373675317f, -0.175745621f, 0.490608513f, 0.808217347f, 0.0002636094f,
+    0.866072059f, 0.389300257f, -0.182514384f, 0.483546525f, 0.805379927f, 0.00031301775f,
+    0.853040695f, 0.404482543f, -0.188943863f, 0.476198465f, 0.802241445f, 0.000370962574f,
+    0.839602649f, 0.419154286f, -0.194996282f, 0.468666524f, 0.798907936f, 0.000438873016f,
+    0.825934589f, 0.433263004f, -0.200533509f, 0.460983634f, 0.795386553f, 0.000515664928f,
+    0.811932385f, 0.446988761f, -0.205768213f, 0.453186303f, 0.79156673f, 0.000604994362f,
+    0.796353936f, 0.459307671f, -0.21047473f, 0.445088327f, 0.787775338f, 0.000710870489f,
+    0.780651093f, 0.471255809f, -0.214889899f, 0.436894178f, 0.783683658f, 0.000835290586f,
+    0.764511645f, 0.482485324f, -0.219008714f, 0.428445846f, 0.779395223f, 0.000986997271f,
+    0.748713851f, 0.493447036f, -0.2228356f, 0.419988453f, 0.774798036f, 0.00116446591f,
+    0.733032644f, 0.504018128f, -0.226292983f, 0.411545664f, 0.769890964f, 0.0013657636f,
+    0.716774821f, 0.51372391f, -0.22929436f, 0.402869016f, 0.76459533f, 0.00159677467f,
+    0.699646711f, 0.522355735f, -0.231911361f, 0.39400503f, 0.758980572f, 0.00186796754f,
+    0.682245851f, 0.530153096f, -0.234251618f, 0.385150224f, 0.753049731f, 0.00218595727f,
+    0.665124536f, 0.537582099f, -0.236077517f, 0.376119286f, 0.74663651f, 0.00254686712f,
+    0.647970498f, 0.544403315f, -0.237590387f, 0.367173314f, 0.739806294f, 0.00295927445f,
+    0.630324781f, 0.550079465f, -0.238730505f, 0.358352005f, 0.732934594f, 0.00343960291f,
+    0.611677647f, 0.55413872f, -0.239446759f, 0.349419296f, 0.725951374f, 0.00400705822f,
+    0.594018698f, 0.558278263f, -0.239846751f, 0.34060955f, 0.718468428f, 0.00465464871f,
+    0.57667309f, 0.562102258f, -0.239858881f, 0.33190152f, 0.710400939f, 0.00538147567f,
+    0.559253871f, 0.564938486f, -0.239454389f, 0.323205769f, 0.70181191f, 0.00619846769f,
+    0.542321861f, 0.567363679f, -0.238817513f, 0.314773381f, 0.692674458f, 0.00711682392f,
+    0.523900688f, 0.567374051f, -0.237524971f, 0.306154221f, 0.682882071f, 0.0081252493f,
+    0.506596923f, 0.567526162f, -0.236056045f, 0.29791832f, 0.672866046f, 0.00924632419f,
+    0.489997327f, 0.567510962f, -0.234521359f, 0.289990902f, 0.662590206f, 0.0105277626f,
+    0.47106123f, 0.5636338f, -0.232242003f, 0.281642258f, 0.651766479f, 0.0119630145f,
+    0.455020189f, 0.562082231f, -0.230123043f, 0.274065435f, 0.640304267f, 0.0135424705f,
+    0.43885991f, 0.559097111f, -0.227525383f, 0.266507059f, 0.628214419f, 0.0152572393f,
+    0.423516333f, 0.556050658f, -0.224890128f, 0.259454489f, 0.615767956f, 0.0170875285f,
+    0.407337606f, 0.550166309f, -0.221926242f, 0.252461702f, 0.603517592f, 0.019112844f,
+    0.392855346f, 0.545376837f, -0.218958378f, 0.245970517f, 0.590699434f, 0.0212993976f,
+    0.377268046f, 0.537566423f, -0.215571135f, 0.239495799f, 0.577311754f, 0.0236640628f,
+    0.362274081f, 0.528907657f, -0.212001964f, 0.233428821f, 0.563250303f, 0.0261491369f,
+    0.349557996f, 0.522022724f, -0.208528355f, 0.228104204f, 0.548518956f, 0.0287163667f,
+    0.335680097f, 0.511827052f, -0.204504937f, 0.222696587f, 0.533255696f, 0.0314065702f,
+    0.324104011f, 0.502686143f, -0.200663671f, 0.218643203f, 0.51824677f, 0.0341580212f,
+    0.315461934f, 0.495495588f, -0.197079346f, 0.217249364f, 0.505007207f, 0.0369117595f,
+    0.307517886f, 0.487330019f, -0.193234593f, 0.216228575f, 0.491447181f, 0.0397669971f,
+    0.300807029f, 0.479101092f, -0.189360917f, 0.216057673f, 0.477517545f, 0.0425856076f,
+    0.296456337f, 0.472781867f, -0.18611683f, 0.217766598f, 0.463257998f, 0.0451735072f,
+    0.290587753f, 0.461156011f, -0.18161884f, 0.219032392f, 0.448893547f, 0.0476403646f,
+    0.293727517f, 0.462616086f, -0.179425761f, 0.22438252f, 0.434487909f, 0.0498670228f,
+    0.293944627f, 0.45610711f, -0.175749004f, 0.229470313f, 0.420156837f, 0.0517468005f,
+    0.299375415f, 0.454707026f, -0.173011839f, 0.237608433f, 0.40603438f, 0.0532331578f,
+    0.309211612f, 0.456328034f, -0.170213029f, 0.24797833f, 0.392238051f, 0.0542225763f,
+    1.0f, 0.0f, 0.0f, 0.588798046f, 0.817421615f, 2.67993091e-05f,
+    0.99905324f, 0.0307385232f, -0.0155492779f, 0.588150442f, 0.817425489f, 2.76433293e-05f,
+    0.997655213f, 0.0511203185f, -0.0258114506f, 0.587357759f, 0.817160726f, 2.8747696e-05f,
+    0.995747328f, 0.0714038387f, -0.0360399894f, 0.586138904f, 0.816646934f, 3.01855707e-05f,
+    0.99330622f, 0.0915867239f, -0.0462837182f, 0.584494948f, 0.815995097f, 3.23752793e-05f,
+    0.990464687f, 0.111619741f, -0.0563765466f, 0.582433224f, 0.815155566f, 3.50334485e-05f,
+    0.987090707f, 0.131596282f, -0.0663865209f, 0.580064654f, 0.814356804f, 3.88071021e-05f,
+    0.982985854f, 0.151455373f, -0.0763050467f, 0.577326119f, 0.813547075f, 4.38251627e-05f,
+    0.978170514f, 0.171229601f, -0.0862243101f, 0.574180603f, 0.812683582f, 5.06453725e-05f,
+    0.972905397f, 0.190890014f, -0.095979251f, 0.570642769f, 0.811542928f, 5.8527763e-05f,
+    0.966979265f, 0.210270047f, -0.105402917f, 0.566751182f, 0.810270131f, 6.74859621e-05f,
+    0.960649908f, 0.229349986f, -0.114425518f, 0.562666476f, 0.808993697f, 7.74825749e-05f,
+    0.953647196f, 0.248226508f, -0.123283647f, 0.558154285f, 0.807549894f, 8.92388853e-05f,
+    0.9461025f, 0.26687482f, -0.132080242f, 0.553406656f, 0.805983245f, 0.000103893552f,
+    0.937305152f, 0.285022855f, -0.140752926f, 0.548112273f, 0.804323196f, 0.000122885045f,
+    0.928056002f, 0.302885383f, -0.149144903f, 0.542492568f, 0.802344978f, 0.000144514139f,
+    0.918487966f, 0.320421934f, -0.157220766f, 0.536514878f, 0.800040543f, 0.000168784725f,
+    0.908494174f, 0.33767122f, -0.165090397f, 0.530261338f, 0.797533453f, 0.000197801346f,
+    0.896460176f, 0.353899568f, -0.172653854f, 0.523418486f, 0.794841945f, 0.000233269719f,
+    0.885220468f, 0.370240331f, -0.17994833f, 0.516580045f, 0.792024672f, 0.000275183644f,
+    0.873341203f, 0.385938227f, -0.186764345f, 0.509468257f, 0.78911674f, 0.000323231099f,
+    0.861233115f, 0.401230901f, -0.193241179f, 0.502251446f, 0.785904408f, 0.000377254008f,
+    0.84847194f, 0.415959239f, -0.199338734f, 0.494659692f, 0.782414198f, 0.000439476746f,
+    0.835368812f, 0.430318981f, -0.205251813f, 0.486900121f, 0.77892828f, 0.00051636342f,
+    0.820879221f, 0.44355312f, -0.210702524f, 0.478760511f, 0.775199354f, 0.000605405075f,
+    0.805911064f, 0.456104577f, -0.215861872f, 0.470666945f, 0.771592438f, 0.000715913193f,
+    0.791182756f, 0.46831733f, -0.220640197f, 0.462388486f, 0.767635942f, 0.000843684713f,
+    0.77663517f, 0.480243444f, -0.224921376f, 0.454233944f, 0.763514161f, 0.000987248495f,
+    0.76157397f, 0.491445482f, -0.2287146f, 0.445796013f, 0.759034038f, 0.00115024159f,
+    0.746357203f, 0.502086818f, -0.232311234f, 0.43730551f, 0.754357696f, 0.00134629698f,
+    0.731086016f, 0.512264729f, -0.23560138f, 0.428816676f, 0.749321699f, 0.0015722675f,
+    0.714435041f, 0.520969748f, -0.238369837f, 0.419931948f, 0.74398154f, 0.001833927f,
+    0.697651863f, 0.529078424f, -0.240781397f, 0.411041796f, 0.73837328f, 0.00213267957f,
+    0.681882918f, 0.537469566f, -0.243030354f, 0.402352154f, 0.732448101f, 0.0024799332f,
+    0.665004134f, 0.544224143f, -0.244796664f, 0.393301755f, 0.726220191f, 0.00288725155f,
+    0.647320747f, 0.549868166f, -0.24617599f, 0.3841694f, 0.719605446f, 0.00335927703f,
+    0.629153728f, 0.554285824f, -0.24708879f, 0.374975443f, 0.712501824f, 0.00389371626f,
+    0.612543464f, 0.559110522f, -0.247578695f, 0.366302937f, 0.705318868f, 0.00448809192f,
+    0.595934033f, 0.563211501f, -0.247724995f, 0.35772118f, 0.69768095f, 0.00515976595f,
+    0.579629958f, 0.566983163f, -0.247568384f, 0.349325955f, 0.689520419f, 0.00590919051f,
+    0.562847018f, 0.569373846f, -0.246859416f, 0.340718985f, 0.680879414f, 0.00674723182f,
+    0.544882536f, 0.569790423f, -0.245852008f, 0.332196683f, 0.67180723f, 0.00769352913f,
+    0.527867496f, 0.570334792f, -0.244587034f, 0.323786646f, 0.662314177f, 0.00876727793f,
+    0.511522889f, 0.570457458f, -0.243086174f, 0.31561774f, 0.652476907f, 0.00996645726f,
+    0.49421671f, 0.568215549f, -0.241263255f, 0.30757767f, 0.642521381f, 0.0113086663f,
+    0.477535099f, 0.565697789f, -0.239030823f, 0.299703807f, 0.631905317f, 0.0127606783f,
+    0.462552726f, 0.564190924f, -0.236799076f, 0.292536378f, 0.620609164f, 0.0143102398f,
+    0.446650714f, 0.560343444f, -0.234023049f, 0.285110384f, 0.608871162f, 0.0160369072f,
+    0.431365907f, 0.556009829f, -0.231175721f, 0.278037637f, 0.596877635f, 0.0179164521f,
+    0.415951699f, 0.549927235f, -0.228343874f, 0.2714203f, 0.585267961f, 0.0199751202f,
+    0.402284026f, 0.544839144f, -0.225303605f, 0.265192091f, 0.573016584f, 0.0221587382f,
+    0.388808697f, 0.538143277f, -0.222022325f, 0.25931868f, 0.560183883f, 0.0244343337f,
+    0.373847842f, 0.528110266f, -0.218300596f, 0.253400117f, 0.546887219f, 0.0268765651f,
+    0.361980528f, 0.521057665f, -0.214875191f, 0.248431891f, 0.533037126f, 0.0294180233f,
+    0.351355582f, 0.514158368f, -0.211434305f, 0.244129315f, 0.518628359f, 0.0319869854f,
+    0.340961456f, 0.504180312f, -0.20740886f, 0.241615504f, 0.506083786f, 0.034660574f,
+    0.333520174f, 0.49670592f, -0.20386599f, 0.241175473f, 0.494104534f, 0.0374447219f,
+    0.327653497f, 0.489596605f, -0.20000571f, 0.241500184f, 0.481660753f, 0.0401031785f,
+    0.32374692f, 0.483468533f, -0.196503684f, 0.243385747f, 0.468928635f, 0.0426436216f,
+    0.317460924f, 0.471421838f, -0.191734374f, 0.244746804f, 0.456051767f, 0.0451313257f,
+    0.321427464f, 0.473052144f, -0.189324021f, 0.250571758f, 0.443050176f, 0.0473828316f,
+    0.323295832f, 0.468339771f, -0.185568273f, 0.256291389f, 0.430048943f, 0.0493595451f,
+    0.326780975f, 0.463725418f, -0.181845546f, 0.263928056f, 0.417157233f, 0.0510127991f,
+    0.337500304f, 0.465405017f, -0.178817093f, 0.274955869f, 0.404475421f, 0.0522309951f,
+    1.0f, 0.0f, 0.0f, 0.614880562f, 0.800024688f, 2.8301487e-05f,
+    0.999030709f, 0.0302858762f, -0.0158093758f, 0.61420542f, 0.799897015f, 2.88857173e-05f,
+    0.99774164f, 0.0503780097f, -0.0263187457f, 0.613402486f, 0.799541235f, 2.98845516e-05f,
+    0.995976269f, 0.0703242272f, -0.0366575606f, 0.61226815f, 0.79921329f, 3.17293488e-05f,
+    0.993705451f, 0.0901778862f, -0.0469644442f, 0.61072731f, 0.798881531f, 3.44660475e-05f,
+    0.991040111f, 0.109943978f, -0.0572962202f, 0.608829141f, 0.798373878f, 3.80204474e-05f,
+    0.987765253f, 0.129649341f, -0.06759388f, 0.606457651f, 0.797663212f, 4.25552607e-05f,
+    0.984039247f, 0.149272263f, -0.077745758f, 0.603616595f, 0.796664894f, 4.77702852e-05f,
+    0.979770243f, 0.168716967f, -0.0876394883f, 0.600381196f, 0.795489371f, 5.36802145e-05f,
+    0.975030005f, 0.188094482f, -0.0973973796f, 0.59684515f, 0.794130921f, 6.05514506e-05f,
+    0.969521284f, 0.207278684f, -0.107026242f, 0.592893481f, 0.792813122f, 6.94726259e-05f,
+    0.963350117f, 0.22623834f, -0.116597928f, 0.588672221f, 0.79144907f, 8.09372941e-05f,
+    0.956491709f, 0.244926646f, -0.125904679f, 0.584046304f, 0.789944649f, 9.45994834e-05f,
+    0.949408352f, 0.263360143f, -0.134784877f, 0.579234004f, 0.788351715f, 0.00010996584f,
+    0.941269457f, 0.281388909f, -0.143334597f, 0.574008465f, 0.786560118f, 0.000127265492f,
+    0.932676613f, 0.299040109f, -0.151709005f, 0.568499982f, 0.784707427f, 0.000148340958f,
+    0.923480153f, 0.316415727f, -0.159923434f, 0.562645853f, 0.782715619f, 0.000174204077f,
+    0.913723946f, 0.333345413f, -0.167862177f, 0.556415915f, 0.780456483f, 0.000204333948f,
+    0.902888894f, 0.349743098f, -0.175469935f, 0.54992491f, 0.777852178f, 0.000237895874f,
+    0.892249882f, 0.365979135f, -0.18274875f, 0.543016136f, 0.774993002f, 0.00027625903f,
+    0.880847573f, 0.381576657f, -0.189759657f, 0.535774887f, 0.771924436f, 0.000321558007f,
+    0.869377673f, 0.397031099f, -0.19660908f, 0.528456092f, 0.768726885f, 0.000376665383f,
+    0.857210457f, 0.411850184f, -0.203059733f, 0.52096796f, 0.765556812f, 0.000441655313f,
+    0.844383061f, 0.426022202f, -0.209201902f, 0.513203859f, 0.762381494f, 0.000521700189f,
+    0.830559671f, 0.439296484f, -0.214885429f, 0.505108476f, 0.758825779f, 0.000612683245f,
+    0.816637456f, 0.452246517f, -0.220157191f, 0.49689728f, 0.754861236f, 0.000714102993f,
+    0.802607715f, 0.464502841f, -0.22509858f, 0.488597095f, 0.750823736f, 0.000832008664f,
+    0.788781404f, 0.476757169f, -0.229739755f, 0.480476856f, 0.746891797f, 0.000974084542f,
+    0.774449289f, 0.488191813f, -0.233897254f, 0.472040087f, 0.742570639f, 0.00113515568f,
+    0.759879827f, 0.498826474f, -0.237608463f, 0.463617533f, 0.738256872f, 0.00132376037f,
+    0.745624721f, 0.50962323f, -0.241085887f, 0.45535028f, 0.733638942f, 0.0015403172f,
+    0.729963303f, 0.518634915f, -0.244073659f, 0.446663499f, 0.728709161f, 0.00179103692f,
+    0.713936865f, 0.527014375f, -0.24677588f, 0.437944859f, 0.72347343f, 0.00208277395f,
+    0.697794318f, 0.534880757f, -0.249063045f, 0.428956479f, 0.717934728f, 0.00242477003f,
+    0.681971133f, 0.542275012f, -0.251120716f, 0.420202255f, 0.712109149f, 0.00281536835f,
+    0.66528213f, 0.548433125f, -0.252591848f, 0.411213607f, 0.705840945f, 0.00325053488f,
+    0.647638559f, 0.552979648f, -0.253598213f, 0.402085006f, 0.69915545f, 0.00374333607f,
+    0.631519079f, 0.558056176f, -0.25436458f, 0.393189877f, 0.692041039f, 0.00430019666f,
+    0.616103411f, 0.563361108f, -0.254879564f, 0.384771198f, 0.684696317f, 0.0049213795f,
+    0.599884629f, 0.566905856f, -0.254745603f, 0.376200914f, 0.677247882f, 0.00562237017f,
+    0.583985627f, 0.569831729f, -0.254426479f, 0.3678433f, 0.6694116f, 0.00641759159f,
+    0.567698658f, 0.571747363f, -0.253765702f, 0.359418362f, 0.661213398f, 0.00732711516f,
+    0.550163686f, 0.571354568f, -0.252769411f, 0.351181298f, 0.652468979f, 0.00833123364f,
+    0.533715725f, 0.571383834f, -0.251313925f, 0.342820108f, 0.64327985f, 0.00945977867f,
+    0.51761806f, 0.570624173f, -0.24954389f, 0.334814399f, 0.633442461f, 0.0106730461f,
+    0.501504958f, 0.568687201f, -0.247377962f, 0.327072799f, 0.623537421f, 0.011976894f,
+    0.485930145f, 0.566211343f, -0.245165423f, 0.319605142f, 0.613310933f, 0.0134505406f,
+    0.471249789f, 0.563888252f, -0.242813945f, 0.312503159f, 0.602596581f, 0.0150591265f,
+    0.455540389f, 0.558789909f, -0.239843756f, 0.305145949f, 0.591375649f, 0.0168177076f,
+    0.441446513f, 0.554506838f, -0.237045646f, 0.29853183f, 0.579880238f, 0.0187127627f,
+    0.427416265f, 0.54885453f, -0.234124005f, 0.292283624f, 0.568828166f, 0.0207203459f,
+    0.414533526f, 0.543175757f, -0.231166035f, 0.286509007f, 0.557299495f, 0.0228828415f,
+    0.402243048f, 0.537081659f, -0.228105038f, 0.281152815f, 0.545298576f, 0.0251820888f,
+    0.389396727f, 0.528354526f, -0.224605173f, 0.275932878f, 0.532774627f, 0.0275505278f,
+    0.378429443f, 0.521008849f, -0.221296266f, 0.271553606f, 0.519785166f, 0.0300065875f,
+    0.368234217f, 0.512882411f, -0.217663571f, 0.267951787f, 0.507074654f, 0.0325928442f,
+    0.362049103f, 0.507107854f, -0.214252546f, 0.268063307f, 0.496567577f, 0.0352487229f,
+    0.35574308f, 0.498770297f, -0.210069835f, 0.268462628f, 0.485596389f, 0.0377851054f,
+    0.35411185f, 0.49565497f, -0.206724226f, 0.271047562f, 0.474351078f, 0.0402861983f,
+    0.349257171f, 0.48552984f, -0.202347606f, 0.273447931f, 0.462905675f, 0.0427582003f,
+    0.351827949f, 0.484214872f, -0.199406594f, 0.27936244f, 0.451280057f, 0.0450310409f,
+    0.355676949f, 0.481901109f, -0.195351943f, 0.285455465f, 0.439586729f, 0.0470914468f,
+    0.35921821f, 0.476695418f, -0.191143125f, 0.293285221f, 0.427913219f, 0.0488813892f,
+    0.36798957f, 0.474986136f, -0.187104955f, 0.303808391f, 0.41634649f, 0.0502934046f,
+    1.0f, 0.0f, 0.0f, 0.640818775f, 0.782033086f, 2.99231688e-05f,
+    0.999049425f, 0.0297938026f, -0.0160218608f, 0.640144825f, 0.781855643f, 3.04201185e-05f,
+    0.997822344f, 0.0495201983f, -0.0265825074f, 0.639444172f, 0.781719744f, 3.18616512e-05f,
+    0.996127307f, 0.069153145f, -0.0371906012f, 0.638290584f, 0.78141892f, 3.39623912e-05f,
+    0.99405247f, 0.0886543319f, -0.0477618054f, 0.636694312f, 0.780864716f, 3.66266904e-05f,
+    0.991654754f, 0.108030744f, -0.0581605136f, 0.634688079f, 0.780091524f, 3.97855401e-05f,
+    0.988632739f, 0.12732774f, -0.0682415143f, 0.632299602f, 0.779328763f, 4.36682858e-05f,
+    0.985169053f, 0.146522701f, -0.078392297f, 0.629576862f, 0.778565466f, 4.90943421e-05f,
+    0.981277168f, 0.165748119f, -0.0884605199f, 0.62647289f, 0.777571917f, 5.55042025e-05f,
+    0.976507306f, 0.184786558f, -0.0984900221f, 0.622958899f, 0.776416481f, 6.36223631e-05f,
+    0.971363485f, 0.203650266f, -0.10830874f, 0.618965805f, 0.775004327f, 7.29979365e-05f,
+    0.965745687f, 0.222404107f, -0.117792308f, 0.614667714f, 0.773447633f, 8.34873281e-05f,
+    0.959535301f, 0.240865603f, -0.127129167f, 0.610046923f, 0.771721542f, 9.58290257e-05f,
+    0.952696562f, 0.259116828f, -0.136267945f, 0.605117977f, 0.769953489f, 0.000110857436f,
+    0.944677055f, 0.276901186f, -0.145266086f, 0.599720359f, 0.768133104f, 0.000129928652f,
+    0.936814666f, 0.294472039f, -0.153796852f, 0.594243586f, 0.766263366f, 0.000151453874f,
+    0.928429425f, 0.311647952f, -0.161908343f, 0.588580787f, 0.764249444f, 0.000175199224f,
+    0.91922605f, 0.328358561f, -0.169724405f, 0.582475841f, 0.761951029f, 0.00020184819f,
+    0.909056127f, 0.344675541f, -0.177436829f, 0.576024592f, 0.759698749f, 0.000235792293f,
+    0.898863852f, 0.360657275f, -0.184951425f, 0.569374204f, 0.757279277f, 0.000276175269f,
+    0.888385713f, 0.376387268f, -0.192224428f, 0.562499642f, 0.754614055f, 0.000323375833f,
+    0.876901209f, 0.391434014f, -0.199226201f, 0.555121183f, 0.751785338f, 0.000381131103f,
+    0.865733087f, 0.406381965f, -0.205876514f, 0.547602177f, 0.748612285f, 0.000446455815f,
+    0.853909075f, 0.420779735f, -0.212162048f, 0.539846063f, 0.745157361f, 0.000520463625f,
+    0.841168463f, 0.434299767f, -0.218037575f, 0.532002926f, 0.741571605f, 0.000604646921f,
+    0.827606857f, 0.447039485f, -0.223502845f, 0.523828089f, 0.738119304f, 0.000707250729f,
+    0.814739525f, 0.459832102f, -0.228690252f, 0.515811443f, 0.734277248f, 0.000821892987f,
+    0.800786495f, 0.471664637f, -0.233484864f, 0.507254303f, 0.730252028f, 0.000958820397f,
+    0.787036777f, 0.483170569f, -0.237954065f, 0.498791814f, 0.726022303f, 0.00111646368f,
+    0.773847818f, 0.494536281f, -0.242028415f, 0.490570009f, 0.721859753f, 0.00129786017f,
+    0.760051072f, 0.50530827f, -0.245796561f, 0.482196748f, 0.717458427f, 0.00150954165f,
+    0.745490253f, 0.514938474f, -0.249104366f, 0.473907709f, 0.713095129f, 0.00175608322f,
+    0.729198217f, 0.522709429f, -0.251871556f, 0.465130806f, 0.708394289f, 0.00204132521f,
+    0.714511275f, 0.531176925f, -0.254295766f, 0.456467956f, 0.703244686f, 0.00236138306f,
+    0.699731648f, 0.538979471f, -0.256401718f, 0.447977751f, 0.697640419f, 0.00271757529f,
+    0.683509767f, 0.545313299f, -0.257934272f, 0.439017057f, 0.691700995f, 0.00312457257f,
+    0.66742301f, 0.550803542f, -0.259217024f, 0.430251062f, 0.685454071f, 0.00358344009f,
+    0.651694f, 0.556276858f, -0.260198832f, 0.421569705f, 0.678928554f, 0.00409967173f,
+    0.636545777f, 0.56141001f, -0.260942638f, 0.412991017f, 0.672071099f, 0.00468660193f,
+    0.620863616f, 0.565339386f, -0.261285722f, 0.404246807f, 0.66489774f, 0.00535800168f,
+    0.604985595f, 0.568062544f, -0.261047095f, 0.395733774f, 0.657889545f, 0.00611786824f,
+    0.590019584f, 0.571192801f, -0.26077649f, 0.387769401f, 0.650431216f, 0.00696642417f,
+    0.572788119f, 0.570927739f, -0.259803861f, 0.379361868f, 0.642507911f, 0.00791269913f,
+    0.557270348f, 0.571316719f, -0.258503497f, 0.37133649f, 0.633958459f, 0.0089246789f,
+    0.542363226f, 0.571546078f, -0.257024974f, 0.363626301f, 0.624973655f, 0.0100371949f,
+    0.526683927f, 0.570234179f, -0.255237967f, 0.355873257f, 0.61564517f, 0.0112932334f,
+    0.510381579f, 0.566907823f, -0.252948254f, 0.348112077f, 0.60629648f, 0.012666598f,
+    0.495909035f, 0.564522386f, -0.250716239f, 0.340993315f, 0.596575558f, 0.0141767999f,
+    0.48100087f, 0.560219824f, -0.247935295f, 0.33371526f, 0.586370647f, 0.0158182345f,
+    0.467433184f, 0.556680501f, -0.245318577f, 0.327368706f, 0.575631917f, 0.0175514072f,
+    0.45476073f, 0.552874744f, -0.242518842f, 0.321287513f, 0.564787447f, 0.0194209404f,
+    0.440567017f, 0.545596302f, -0.239490271f, 0.31518203f, 0.554498374f, 0.0214558691f,
+    0.428752422f, 0.539687574f, -0.236536503f, 0.309850931f, 0.543701887f, 0.0235901959f,
+    0.418275952f, 0.534208894f, -0.233466744f, 0.305036515f, 0.532430232f, 0.0258068778f,
+    0.407573551f, 0.527510524f, -0.230350807f, 0.300634056f, 0.520816922f, 0.0281607397f,
+    0.397902936f, 0.520996094f, -0.227269486f, 0.296766907f, 0.508815408f, 0.0306722205f,
+    0.390719861f, 0.513437092f, -0.223481238f, 0.295880497f, 0.49881658f, 0.0331628658f,
+    0.387054771f, 0.509037912f, -0.21992296f, 0.297583908f, 0.489293516f, 0.0355989635f,
+    0.382061422f, 0.500195444f, -0.215531141f, 0.299217165f, 0.479507715f, 0.0380849503f,
+    0.382205844f, 0.497448713f, -0.211891204f, 0.303251415f, 0.469447702f, 0.0405164622f,
+    0.382080764f, 0.491431832f, -0.207837164f, 0.308312774f, 0.459171742f, 0.0428116471f,
+    0.38607046f, 0.488967985f, -0.203690067f, 0.315021843f, 0.448764503f, 0.0449421406f,
+    0.390238971f, 0.48362416f, -0.19887805f, 0.322771698f, 0.438295305f, 0.046838101f,
+    0.400181711f, 0.483478338f, -0.194644108f, 0.333977282f, 0.427843422f, 0.0484125614f,
+    1.0f, 0.0f, 0.0f, 0.666532993f, 0.763385057f, 3.13306045e-05f,
+    0.999082685f, 0.0292168129f, -0.016148692f, 0.665962756f, 0.763369322f, 3.21849948e-05f,
+    0.997941077f, 0.0485392474f, -0.0267764423f, 0.665211856f, 0.763058126f, 3.32844756e-05f,
+    0.996349394f, 0.0677452758f, -0.0373892635f, 0.664000213f, 0.762565076f, 3.49173242e-05f,
+    0.994535983f, 0.0868416876f, -0.0480148941f, 0.662495017f, 0.762078762f, 3.76475909e-05f,
+    0.992269516f, 0.105810381f, -0.0584110729f, 0.660571039f, 0.761530519f, 4.11301662e-05f,
+    0.989438772f, 0.124729015f, -0.0688299239f, 0.65817678f, 0.760813892f, 4.55693262e-05f,
+    0.986113071f, 0.14367637f, -0.079207316f, 0.655359149f, 0.759911358f, 5.11293874e-05f,
+    0.982345045f, 0.162414551f, -0.0891744718f, 0.652208149f, 0.758944392f, 5.74995938e-05f,
+    0.978139699f, 0.181056336f, -0.0989883691f, 0.648758173f, 0.757840574f, 6.4959655e-05f,
+    0.973531604f, 0.199571982f, -0.108693853f, 0.644925594f, 0.756514907f, 7.36267248e-05f,
+    0.968030393f, 0.217882797f, -0.118376195f, 0.640710831f, 0.755123794f, 8.47805131e-05f,
+    0.962093294f, 0.236103594f, -0.127890259f, 0.636074007f, 0.753532887f, 9.80767218e-05f,
+    0.955933988f, 0.254055232f, -0.137079835f, 0.631233215f, 0.751725197f, 0.000112813221f,
+    0.948684633f, 0.271592587f, -0.145930529f, 0.625940382f, 0.749692798f, 0.000128977423f,
+    0.941223085f, 0.289090753f, -0.154761672f, 0.620410919f, 0.747694194f, 0.000149640793f,
+    0.933269441f, 0.306177258f, -0.163413584f, 0.614622355f, 0.745658517f, 0.000175046851f,
+    0.924777567f, 0.322863936f, -0.171573788f, 0.608698368f, 0.743581057f, 0.000203984455f,
+    0.915144742f, 0.338885427f, -0.179317087f, 0.602383137f, 0.741494477f, 0.00023824106f,
+    0.905677378f, 0.354773641f, -0.186913624f, 0.595879734f, 0.73925215f, 0.000279726664f,
+    0.895934463f, 0.370362043f, -0.194215775f, 0.589135349f, 0.736795366f, 0.000327406509f,
+    0.885891497f, 0.385604441f, -0.201127544f, 0.582197249f, 0.734054267f, 0.00038004783f,
+    0.875225365f, 0.400299668f, -0.207693487f, 0.574820817f, 0.731115162f, 0.000440740871f,
+    0.864103258f, 0.414595664f, -0.214095876f, 0.567268968f, 0.728009343f, 0.000513881911f,
+    0.851474464f, 0.427925944f, -0.220139235f, 0.559347868f, 0.72465694f, 0.000597825157f,
+    0.838822544f, 0.440924078f, -0.225950986f, 0.551281512f, 0.721089005f, 0.000696959789f,
+    0.825991213f, 0.453403115f, -0.231348425f, 0.542984128f, 0.717402995f, 0.000812149839f,
+    0.813507438f, 0.465681583f, -0.236365482f, 0.534891427f, 0.713726461f, 0.000944205211f,
+    0.800594985f, 0.477322608f, -0.241047218f, 0.526599407f, 0.709834516f, 0.00109724945f,
+    0.787778914f, 0.488794178f, -0.245462209f, 0.518271267f, 0.705670238f, 0.00127389154f,
+    0.773912251f, 0.499197245f, -0.249386176f, 0.50975287f, 0.701437414f, 0.00148086599f,
+    0.759834886f, 0.508660257f, -0.252818137f, 0.501280606f, 0.697051227f, 0.00171549886f,
+    0.746140182f, 0.517949224f, -0.25581032f, 0.49293685f, 0.692453742f, 0.00197484414f,
+    0.731729925f, 0.526186049f, -0.258374214f, 0.484683752f, 0.687804103f, 0.00227154605f,
+    0.717606843f, 0.534046829f, -0.260533094f, 0.476252884f, 0.682800949f, 0.00260767341f,
+    0.703481078f, 0.541485012f, -0.262465179f, 0.467964649f, 0.677460313f, 0.00298772706f,
+    0.687122226f, 0.54679203f, -0.263920307f, 0.459224671f, 0.67186439f, 0.00342562399f,
+    0.671964943f, 0.55230397f, -0.265074849f, 0.45063892f, 0.665857613f, 0.00391429942f,
+    0.656985223f, 0.557182729f, -0.26602152f, 0.442065716f, 0.659682393f, 0.00447990885f,
+    0.64175272f, 0.561147213f, -0.266608238f, 0.433479071f, 0.653230369f, 0.00511607341f,
+    0.626487076f, 0.564397812f, -0.266685486f, 0.424740076f, 0.646338642f, 0.00582338637f,
+    0.611866593f, 0.567524076f, -0.266586691f, 0.416782051f, 0.639493346f, 0.00661813049f,
+    0.597837985f, 0.570138276f, -0.266035825f, 0.409196347f, 0.632240117f, 0.00746699888f,
+    0.581869185f, 0.569883347f, -0.264840275f, 0.401155889f, 0.624602079f, 0.00840906333f,
+    0.566212654f, 0.56912452f, -0.263514817f, 0.393277049f, 0.616669893f, 0.00948031712f,
+    0.551718473f, 0.568778217f, -0.262006432f, 0.385734469f, 0.608294725f, 0.0106577054f,
+    0.536048055f, 0.566167593f, -0.259997874f, 0.378001422f, 0.599501014f, 0.0119605418f,
+    0.521165133f, 0.563059211f, -0.257890046f, 0.370871961f, 0.590677142f, 0.0133760823f,
+    0.507562578f, 0.560353279f, -0.255419761f, 0.364076644f, 0.581402183f, 0.0148691274f,
+    0.494377702f, 0.556907594f, -0.252792865f, 0.357661366f, 0.571681201f, 0.0164784491f,
+    0.48088479f, 0.551996112f, -0.249759719f, 0.3511042f, 0.561603963f, 0.0182479378f,
+    0.468319148f, 0.547126353f, -0.246827021f, 0.345282137f, 0.551665187f, 0.0201226324f,
+    0.456933767f, 0.541731238f, -0.24417524f, 0.340248138f, 0.542072237f, 0.0221031699f,
+    0.446416944f, 0.536345243f, -0.241384223f, 0.33563301f, 0.532049f, 0.0241989065f,
+    0.436658055f, 0.53075999f, -0.238505185f, 0.331302524f, 0.521712601f, 0.026462812f,
+    0.428123474f, 0.525531471f, -0.2357108f, 0.327621311f, 0.511010349f, 0.0288602933f,
+    0.419968247f, 0.518348277f, -0.232119143f, 0.325371176f, 0.500853837f, 0.0312016569f,
+    0.415249825f, 0.51158613f, -0.228015468f, 0.326765686f, 0.492764443f, 0.0335748605f,
+    0.409452915f, 0.501853228f, -0.22326602f, 0.32830736f, 0.484385192f, 0.0360305943f,
+    0.414578587f, 0.504580915f, -0.22047323f, 0.334319144f, 0.475671798f, 0.0384070762f,
+    0.412209809f, 0.495793462f, -0.215531096f, 0.338725179f, 0.466716737f, 0.0407125987f,
+    0.41489023f, 0.49052754f, -0.210618794f, 0.344973922f, 0.457573175f, 0.0428958982f,
+    0.422321975f, 0.489491194f, -0.206208333f, 0.354244769f, 0.448297232f, 0.0448789336f,
+    0.43151474f, 0.486963838f, -0.200874329f, 0.364532441f, 0.438958943f, 0.0465905629f,
+    1.0f, 0.0f, 0.0f, 0.691990614f, 0.744251788f, 3.26798872e-05f,
+    0.999094486f, 0.0286048912f, -0.016225351f, 0.691370785f, 0.744122863f, 3.3308097e-05f,
+    0.997930408f, 0.047494147f, -0.0269784853f, 0.690644562f, 0.743879437f, 3.46331508e-05f,
+    0.996535659f, 0.0662102029f, -0.0374620184f, 0.689574003f, 0.743612945f, 3.66541026e-05f,
+    0.994933844f, 0.0848851502f, -0.0480440371f, 0.688183129f, 0.743243814f, 3.95226052e-05f,
+    0.992973626f, 0.103438579f, -0.0586078949f, 0.686291039f, 0.742641866f, 4.3086231e-05f,
+    0.990531087f, 0.121948734f, -0.0690516084f, 0.683868468f, 0.741749823f, 4.71395579e-05f,
+    0.987642467f, 0.140390202f, -0.0792737529f, 0.681156337f, 0.740863085f, 5.22616028e-05f,
+    0.98415935f, 0.158766672f, -0.0893533453f, 0.678032756f, 0.739949524f, 5.85797898e-05f,
+    0.98004663f, 0.177064404f, -0.0994709432f, 0.674559712f, 0.738912582f, 6.66665946e-05f,
+    0.9757604f, 0.195189029f, -0.109288923f, 0.670852244f, 0.737800598f, 7.61682386e-05f,
+    0.970832229f, 0.213085502f, -0.11877802f, 0.666819453f, 0.736602724f, 8.70091026e-05f,
+    0.96572578f, 0.230995655f, -0.128084928f, 0.662459016f, 0.735130489f, 9.89660475e-05f,
+    0.960029125f, 0.248601571f, -0.137456134f, 0.657814145f, 0.733601987f, 0.000114486946f,
+    0.95309025f, 0.265862375f, -0.146619961f, 0.652606368f, 0.731846929f, 0.000132742905f,
+    0.946212292f, 0.283079445f, -0.15550977f, 0.647216797f, 0.729841352f, 0.000153177956f,
+    0.938765943f, 0.299883127f, -0.164126739f, 0.641424835f, 0.727882564f, 0.000178050235f,
+    0.930057049f, 0.316131294f, -0.172595441f, 0.635168374f, 0.725790739f, 0.00020863484f,
+    0.921272933f, 0.33223629f, -0.180694774f, 0.628808796f, 0.723482847f, 0.000242796668f,
+    0.912873209f, 0.348034114f, -0.188240156f, 0.622540057f, 0.721114159f, 0.00028022335f,
+    0.903744757f, 0.363405138f, -0.195400596f, 0.616035163f, 0.718791664f, 0.000324536173f,
+    0.894100845f, 0.378373921f, -0.202425569f, 0.609213889f, 0.716332793f, 0.000378394179f,
+    0.884055793f, 0.392841727f, -0.209073722f, 0.60202229f, 0.713558435f, 0.000438931194f,
+    0.87366277f, 0.407089591f, -0.215551794f, 0.594730377f, 0.710618973f, 0.000510491023f,
+    0.862112463f, 0.4204714f, -0.221745476f, 0.587165594f, 0.707664251f, 0.000594864367f,
+    0.850468814f, 0.433461577f, -0.227614388f, 0.579463243f, 0.704448819f, 0.000690445188f,
+    0.83804208f, 0.445756555f, -0.233056679f, 0.571242034f, 0.700967729f, 0.000800592417f,
+    0.826064467f, 0.457958937f, -0.238262951f, 0.563031554f, 0.697214127f, 0.000927307236f,
+    0.813469231f, 0.469442397f, -0.243067428f, 0.554550946f, 0.693370879f, 0.00107579737f,
+    0.801175892f, 0.480796844f, -0.247598097f, 0.546475172f, 0.68960911f, 0.00124815514f,
+    0.788728893f, 0.491446972f, -0.251528472f, 0.53806603f, 0.685438097f, 0.0014367199f,
+    0.776145458f, 0.501664162f, -0.255210191f, 0.529760897f, 0.680947959f, 0.00164958253f,
+    0.762292564f, 0.510613561f, -0.258249402f, 0.521350145f, 0.67651695f, 0.00189282652f,
+    0.748162866f, 0.518972456f, -0.261078805f, 0.512969911f, 0.671971202f, 0.00217455602f,
+    0.735145628f, 0.527258694f, -0.263717592f, 0.50514102f, 0.667582691f, 0.00249667023f,
+    0.722025752f, 0.535023332f, -0.265769422f, 0.497129798f, 0.662904501f, 0.00285272859f,
+    0.706871867f, 0.540664971f, -0.267395347f, 0.488623351f, 0.658009052f, 0.00326679647f,
+    0.691656768f, 0.545744061f, -0.268821269f, 0.480189949f, 0.652829528f, 0.00374304969f,
+    0.677253485f, 0.55067867f, -0.269960999f, 0.471960932f, 0.64723438f, 0.00427139783f,
+    0.663080573f, 0.55535233f, -0.270780176f, 0.463663816f, 0.641324282f, 0.00487089017f,
+    0.649216712f, 0.559432685f, -0.271324754f, 0.455539882f, 0.635152459f, 0.00553630572f,
+    0.635474324f, 0.56317544f, -0.271417946f, 0.447538316f, 0.628534615f, 0.00624888064f,
+    0.621410429f, 0.565317869f, -0.270970255f, 0.439525157f, 0.621928394f, 0.00705020921f,
+    0.607594311f, 0.567181647f, -0.270434588f, 0.432129085f, 0.615345657f, 0.00796303153f,
+    0.591482401f, 0.565692961f, -0.269144237f, 0.424217373f, 0.608309269f, 0.00896244217f,
+    0.576876283f, 0.565171897f, -0.267816156f, 0.416744858f, 0.6009112f, 0.010078501f,
+    0.563166738f, 0.564325809f, -0.266223699f, 0.409584224f, 0.593031406f, 0.0112900939f,
+    0.548277199f, 0.561110318f, -0.263780594f, 0.401970923f, 0.584617794f, 0.0125747714f,
+    0.535878241f, 0.55973047f, -0.261831552f, 0.395846903f, 0.57628417f, 0.0139601696f,
+    0.521668494f, 0.555124104f, -0.259310842f, 0.389226586f, 0.567756236f, 0.0155090736f,
+    0.508323014f, 0.550105095f, -0.256385297f, 0.382772923f, 0.558727622f, 0.0171494093f,
+    0.496480972f, 0.54591012f, -0.253460646f, 0.377059311f, 0.549227357f, 0.0188793056f,
+    0.486887872f, 0.543208778f, -0.250880003f, 0.372270077f, 0.540340483f, 0.0207257681f,
+    0.475039512f, 0.535812438f, -0.248010948f, 0.367205083f, 0.53161478f, 0.0227356646f,
+    0.465982169f, 0.531238914f, -0.245501548f, 0.363188714f, 0.522501349f, 0.0249069314f,
+    0.458130211f, 0.526750922f, -0.242687866f, 0.359554708f, 0.512935162f, 0.0271208324f,
+    0.452436686f, 0.523264587f, -0.240111917f, 0.357088506f, 0.502969325f, 0.0293518305f,
+    0.447448015f, 0.516666651f, -0.23594664f, 0.358297169f, 0.495981008f, 0.0316876806f,
+    0.4417454f, 0.507147372f, -0.231091574f, 0.360184491f, 0.488957942f, 0.034090247f,
+    0.445192099f, 0.506608188f, -0.227534324f, 0.36578235f, 0.481572002f, 0.0364289992f,
+    0.444158047f, 0.498742819f, -0.222024441f, 0.369917393f, 0.473908216f, 0.0387303978f,
+    0.447368175f, 0.494734734f, -0.217472464f, 0.377534479f, 0.466007501f, 0.040949259f,
+    0.452853501f, 0.489730746f, -0.21179451f, 0.38547045f, 0.457913131f, 0.0430025943f,
+    0.463179857f, 0.488845497f, -0.206406951f, 0.396574289f, 0.449686766f, 0.0448284857f,
+    1.0f, 0.0f, 0.0f, 0.717061996f, 0.724626601f, 3.38512509e-05f,
+    0.99904865f, 0.0279039927f, -0.0162100792f, 0.716439486f, 0.724476516f, 3.44358305e-05f,
+    0.998005867f, 0.0463367775f, -0.0269486904f, 0.715797842f, 0.72432518f, 3.59713194e-05f,
+    0.996780813f, 0.0646260083f, -0.0375958867f, 0.714779794f, 0.723997474f, 3.80647143e-05f,
+    0.99523139f, 0.0827682167f, -0.0482145287f, 0.713271856f, 0.723469794f, 4.07134648e-05f,
+    0.993418813f, 0.100731902f, -0.058449626f, 0.71152389f, 0.723003387f, 4.41483535e-05f,
+    0.991205871f, 0.118745103f, -0.0687356666f, 0.709324241f, 0.722478628f, 4.86418539e-05f,
+    0.988457561f, 0.136666194f, -0.0790765658f, 0.706702173f, 0.721798658f, 5.43556162e-05f,
+    0.985444903f, 0.154693365f, -0.089359954f, 0.703694344f, 0.720915198f, 6.12150398e-05f,
+    0.982099235f, 0.172514528f, -0.0994307846f, 0.700301528f, 0.719782412f, 6.88473083e-05f,
+    0.978071094f, 0.190357462f, -0.109238148f, 0.696575761f, 0.71866715f, 7.79369584e-05f,
+    0.973830342f, 0.207994267f, -0.119019091f, 0.692734778f, 0.717532575f, 8.93385222e-05f,
+    0.968812287f, 0.225380182f, -0.128539756f, 0.688358009f, 0.716277719f, 0.000102731334f,
+    0.963718176f, 0.242655054f, -0.137684569f, 0.68399775f, 0.715023577f, 0.000118074204f,
+    0.957354128f, 0.259446234f, -0.146711662f, 0.679092765f, 0.71358645f, 0.000136399627f,
+    0.950737417f, 0.276146978f, -0.155632749f, 0.673860848f, 0.711953104f, 0.000158437135f,
+    0.943736851f, 0.292677134f, -0.164212823f, 0.668167293f, 0.709987521f, 0.000182689881f,
+    0.936176062f, 0.308798462f, -0.172555581f, 0.662126601f, 0.707784235f, 0.000210141952f,
+    0.927932918f, 0.324435383f, -0.180638f, 0.655997038f, 0.705577195f, 0.000242579088f,
+    0.919778526f, 0.340083718f, -0.188584968f, 0.64948225f, 0.703258872f, 0.000282116875f,
+    0.910939395f, 0.355241984f, -0.196098343f, 0.64266336f, 0.70071131f, 0.000325484289f,
+    0.902307332f, 0.370297909f, -0.203256011f, 0.636191547f, 0.698400438f, 0.000377597753f,
+    0.892774582f, 0.384553432f, -0.209949166f, 0.629324198f, 0.696112692f, 0.000439430034f,
+    0.883704185f, 0.398662359f, -0.216398358f, 0.622517943f, 0.693494201f, 0.000508545199f,
+    0.873766243f, 0.412368476f, -0.222496599f, 0.615300536f, 0.690599263f, 0.00058724964f,
+    0.861929476f, 0.424829453f, -0.228177249f, 0.607408762f, 0.687473714f, 0.000678311102f,
+    0.849941015f, 0.436819702f, -0.23371397f, 0.599524021f, 0.68419528f, 0.000785483513f,
+    0.838145554f, 0.448637426f, -0.238951221f, 0.591405571f, 0.680909932f, 0.00091140758f,
+    0.826926231f, 0.460417718f, -0.243851662f, 0.583427846f, 0.677232444f, 0.00104942196f,
+    0.815344393f, 0.471541643f, -0.248411253f, 0.575358391f, 0.673264325f, 0.00120297447f,
+    0.803332925f, 0.482427806f, -0.252549767f, 0.567031145f, 0.669279993f, 0.00138007372f,
+    0.791861534f, 0.492719918f, -0.256498754f, 0.559114158f, 0.66546917f, 0.00158744236f,
+    0.778753459f, 0.501877904f, -0.260010391f, 0.550839543f, 0.661359787f, 0.00182146544f,
+    0.765275896f, 0.51032567f, -0.263099164f, 0.542516649f, 0.657095432f, 0.00208705524f,
+    0.752967834f, 0.518673897f, -0.265819788f, 0.534628272f, 0.652813971f, 0.00238650152f,
+    0.739552796f, 0.526001275f, -0.268126935f, 0.526281536f, 0.64842397f, 0.00273809605f,
+    0.726405203f, 0.53267318f, -0.270173937f, 0.51857996f, 0.644214511f, 0.00313696638f,
+    0.712436676f, 0.538063824f, -0.271852672f, 0.51072681f, 0.639727116f, 0.00358419283f,
+    0.697535157f, 0.542443335f, -0.273039848f, 0.502512395f, 0.634902358f, 0.0040888004f,
+    0.684638798f, 0.547506094f, -0.273909003f, 0.494593769f, 0.629606009f, 0.00463721436f,
+    0.672075093f, 0.552463174f, -0.274560302f, 0.487068206f, 0.623882771f, 0.00523171527f,
+    0.658159435f, 0.55561918f, -0.274637282f, 0.478845507f, 0.617943287f, 0.00590908062f,
+    0.644682467f, 0.558276892f, -0.274773806f, 0.471048653f, 0.611947894f, 0.00667957542f,
+    0.631084919f, 0.559833467f, -0.274350107f, 0.463345915f, 0.605816305f, 0.00752580911f,
+    0.617712975f, 0.560855567f, -0.273658633f, 0.456210315f, 0.599772274f, 0.00847852044f,
+    0.602560222f, 0.559129238f, -0.272307336f, 0.448772073f, 0.593250632f, 0.0095098177f,
+    0.589081764f, 0.558514357f, -0.270668149f, 0.441701472f, 0.586243987f, 0.0106110312f,
+    0.576422274f, 0.557303071f, -0.268987834f, 0.435198486f, 0.578842878f, 0.0118039288f,
+    0.562995315f, 0.554657996f, -0.266728491f, 0.428092718f, 0.571156323f, 0.0131441606f,
+    0.549766123f, 0.551013827f, -0.264478922f, 0.421877056f, 0.563615203f, 0.0145773711f,
+    0.537561536f, 0.547176957f, -0.261891067f, 0.41584453f, 0.555676579f, 0.0161081087f,
+    0.52557981f, 0.542756557f, -0.258995414f, 0.410067946f, 0.547296524f, 0.0177257657f,
+    0.514894903f, 0.538672745f, -0.256091416f, 0.404899329f, 0.538697839f, 0.0194553193f,
+    0.504443109f, 0.533548713f, -0.253519773f, 0.400156796f, 0.530997276f, 0.0213864185f,
+    0.494956136f, 0.528149426f, -0.250942379f, 0.395832628f, 0.523095846f, 0.0234448221f,
+    0.48818168f, 0.524625719f, -0.248399049f, 0.392742783f, 0.514638722f, 0.0254805777f,
+    0.483875573f, 0.523032844f, -0.246111408f, 0.390509337f, 0.505920112f, 0.0276332144f,
+    0.477416664f, 0.516149223f, -0.242380247f, 0.390307367f, 0.498922408f, 0.0299191419f,
+    0.474239379f, 0.508520722f, -0.237709031f, 0.393058449f, 0.493214875f, 0.032252755f,
+    0.477371693f, 0.507581532f, -0.233646974f, 0.398544967f, 0.487134129f, 0.0345616341f,
+    0.476655632f, 0.500076354f, -0.228180945f, 0.403397769f, 0.480738878f, 0.036856804f,
+    0.4833f, 0.498713911f, -0.223218471f, 0.411115557f, 0.474062145f, 0.0391005576f,
+    0.485699654f, 0.490553558f, -0.217006117f, 0.41888988f, 0.467137903f, 0.0412067696f,
+    0.496453136f, 0.489332706f, -0.211127639f, 0.429998934f, 0.460020334f, 0.0431269705f,
+    1.0f, 0.0f, 0.0f, 0.741768897f, 0.704696655f, 3.50614646e-05f,
+    0.999070168f, 0.0271242093f, -0.0160435773f, 0.741193116f, 0.704572916f, 3.56810961e-05f,
+    0.998077691f, 0.0450142324f, -0.0265730079f, 0.740580082f, 0.704414546f, 3.70551061e-05f,
+    0.996872544f, 0.062766403f, -0.0371647514f, 0.739561856f, 0.704051673f, 3.89310226e-05f,
+    0.995514274f, 0.0803863853f, -0.0477962159f, 0.738224745f, 0.703616023f, 4.17282754e-05f,
+    0.993766248f, 0.0979664177f, -0.0584565029f, 0.736476183f, 0.703125894f, 4.57148817e-05f,
+    0.991796792f, 0.115457147f, -0.0688943341f, 0.734206259f, 0.702462554f, 5.03997362e-05f,
+    0.989545882f, 0.132890806f, -0.0789081827f, 0.731660247f, 0.701798141f, 5.58346546e-05f,
+    0.986716926f, 0.150136292f, -0.0888164267f, 0.728813887f, 0.701170146f, 6.2639956e-05f,
+    0.983442783f, 0.167477936f, -0.0987352952f, 0.725565255f, 0.700363457f, 7.0801907e-05f,
+    0.979746819f, 0.184791505f, -0.108637378f, 0.722028077f, 0.699374616f, 8.0559963e-05f,
+    0.975751162f, 0.201905534f, -0.118391551f, 0.718039274f, 0.698129773f, 9.16159115e-05f,
+    0.971350014f, 0.21902363f, -0.127913505f, 0.713733792f, 0.696820974f, 0.000104712788f,
+    0.966418982f, 0.235771015f, -0.137297079f, 0.709255815f, 0.695506334f, 0.000120723824f,
+    0.960837245f, 0.252302647f, -0.146350831f, 0.704570055f, 0.694081306f, 0.000138739575f,
+    0.955127656f, 0.268522739f, -0.154863775f, 0.699651539f, 0.692658961f, 0.000158794443f,
+    0.949236333f, 0.284829885f, -0.163356721f, 0.694505811f, 0.691110194f, 0.000182872245f,
+    0.942410111f, 0.30052945f, -0.171690732f, 0.688869059f, 0.689365804f, 0.000211346094f,
+    0.93482542f, 0.316027045f, -0.17971383f, 0.682881951f, 0.68730998f, 0.000242633017f,
+    0.926683545f, 0.33098945f, -0.187687516f, 0.67665273f, 0.685134172f, 0.000280533335f,
+    0.918442428f, 0.345880777f, -0.195301741f, 0.670021892f, 0.682913065f, 0.000325314933f,
+    0.909820616f, 0.36037302f, -0.202602595f, 0.663259983f, 0.680440366f, 0.000375488162f,
+    0.901548922f, 0.37492162f, -0.209684819f, 0.656450629f, 0.677784145f, 0.000432870031f,
+    0.89246875f, 0.388666332f, -0.216085225f, 0.649519145f, 0.67539537f, 0.000499312649f,
+    0.883639097f, 0.402176678f, -0.222221315f, 0.642815769f, 0.673046649f, 0.000576935359f,
+    0.872052312f, 0.414168656f, -0.228056684f, 0.635420322f, 0.670525849f, 0.000669538509f,
+    0.861765504f, 0.426418602f, -0.233564749f, 0.628124475f, 0.667620718f, 0.000770931307f,
+    0.851274848f, 0.438206255f, -0.238624498f, 0.620545626f, 0.664361238f, 0.000881257991f,
+    0.840721965f, 0.450005352f, -0.243579462f, 0.612797797f, 0.660987079f, 0.00101184996f,
+    0.829299808f, 0.460754037f, -0.24829489f, 0.604785979f, 0.657592595f, 0.00116507686f,
+    0.818496943f, 0.471901149f, -0.252848744f, 0.596961737f, 0.654055893f, 0.00133938761f,
+    0.807266474f, 0.482138067f, -0.256997019f, 0.588722765f, 0.65025872f, 0.0015375514f,
+    0.796138465f, 0.492083013f, -0.260759175f, 0.580918968f, 0.646468759f, 0.00175773725f,
+    0.783572376f, 0.500394225f, -0.264129519f, 0.572938979f, 0.642704904f, 0.00201184908f,
+    0.769901276f, 0.507789969f, -0.267254829f, 0.564539313f, 0.638823748f, 0.00231261062f,
+    0.757969022f, 0.515543044f, -0.269895554f, 0.556789398f, 0.634947896f, 0.00264705159f,
+    0.745645642f, 0.522591889f, -0.272082031f, 0.548912406f, 0.630782008f, 0.0030210726f,
+    0.732936978f, 0.528628886f, -0.273726821f, 0.541270912f, 0.626604438f, 0.00343908533f,
+    0.720140219f, 0.53397876f, -0.274911076f, 0.53376466f, 0.622276962f, 0.00389149459f,
+    0.706943572f, 0.538470089f, -0.275911391f, 0.526509821f, 0.617620945f, 0.00438950025f,
+    0.694233537f, 0.542749286f, -0.276618987f, 0.518837631f, 0.61282742f, 0.00496354839f,
+    0.680918396f, 0.545912623f, -0.276986986f, 0.510977268f, 0.60774368f, 0.0056119808f,
+    0.667897701f, 0.548630476f, -0.277173489f, 0.503419757f, 0.60229975f, 0.00632828753f,
+    0.654770017f, 0.550584733f, -0.277079701f, 0.495763272f, 0.596713305f, 0.00713279936f,
+    0.641958773f, 0.551900148f, -0.276510477f, 0.488452703f, 0.59101975f, 0.00800420996f,
+    0.629303038f, 0.552173674f, -0.275461018f, 0.481736958f, 0.585374534f, 0.00894845091f,
+    0.617570102f, 0.552373648f, -0.27415216f, 0.475335747f, 0.57930553f, 0.00996195339f,
+    0.602955699f, 0.549785852f, -0.272340566f, 0.468294531f, 0.572998524f, 0.0111124674f,
+    0.590170443f, 0.54714787f, -0.270415843f, 0.461763233f, 0.566284955f, 0.0123542044f,
+    0.578032851f, 0.544541299f, -0.268273145f, 0.455547065f, 0.559258103f, 0.0136930812f,
+    0.566963553f, 0.541877627f, -0.265961438f, 0.449946076f, 0.552391648f, 0.0151133602f,
+    0.55659771f, 0.539096177f, -0.263500631f, 0.444675565f, 0.545158625f, 0.0166452359f,
+    0.544435859f, 0.533135235f, -0.260405302f, 0.438796759f, 0.53758806f, 0.0183193944f,
+    0.533464849f, 0.528025627f, -0.257505149f, 0.433813602f, 0.530230105f, 0.0201363154f,
+    0.526545167f, 0.52518183f, -0.255504549f, 0.430558085f, 0.523382962f, 0.0220318045f,
+    0.518182158f, 0.519787908f, -0.252703667f, 0.426773131f, 0.516162813f, 0.0239757076f,
+    0.513650119f, 0.518057227f, -0.250347525f, 0.424283713f, 0.50860709f, 0.0260433331f,
+    0.506394565f, 0.510795951f, -0.247061849f, 0.422241688f, 0.501580834f, 0.0282687973f,
+    0.508996725f, 0.509872139f, -0.243384719f, 0.427392662f, 0.497149408f, 0.0305154081f,
+    0.50859797f, 0.504338205f, -0.238492355f, 0.43208304f, 0.492352754f, 0.0328030661f,
+    0.511170805f, 0.500141978f, -0.233226389f, 0.437971473f, 0.487203151f, 0.0350870229f,
+    0.516231f, 0.496665478f, -0.22753711f, 0.445125043f, 0.481731892f, 0.0373425186f,
+    0.519911885f, 0.489877373f, -0.220674798f, 0.452368557f, 0.47596696f, 0.0394894034f,
+    0.528651893f, 0.485964775f, -0.214442402f, 0.463635206f, 0.46995464f, 0.0414861999f,
+    1.0f, 0.0f, 0.0f, 0.766036272f, 0.684450448f, 3.6086607e-05f,
+    0.999045372f, 0.0262991656f, -0.0158493817f, 0.765513837f, 0.684409678f, 3.68498004e-05f,
+    0.998012483f, 0.043671634f, -0.026440084f, 0.764903724f, 0.684228599f, 3.82470389e-05f,
+    0.996960282f, 0.0608954579f, -0.0370036028f, 0.764007807f, 0.683959305f, 4.04837338e-05f,
+    0.995638311f, 0.0778239965f, -0.0472190194f, 0.762726724f, 0.68360275f, 4.32886773e-05f,
+    0.994287908f, 0.0947186276f, -0.0574723668f, 0.761027694f, 0.683040023f, 4.66427591e-05f,
+    0.992526352f, 0.111656256f, -0.0678125247f, 0.758927226f, 0.682396889f, 5.11081453e-05f,
+    0.990275681f, 0.128546864f, -0.0780612081f, 0.756340683f, 0.681672752f, 5.67484276e-05f,
+    0.987618446f, 0.145363614f, -0.0881739184f, 0.753352642f, 0.680791199f, 6.33870004e-05f,
+    0.984790206f, 0.16206263f, -0.0979103148f, 0.750183225f, 0.679980457f, 7.1349481e-05f,
+    0.981399238f, 0.178717986f, -0.107505456f, 0.746798813f, 0.679105341f, 8.08507175e-05f,
+    0.977337837f, 0.195272729f, -0.116963685f, 0.742899895f, 0.678195298f, 9.23848565e-05f,
+    0.973525941f, 0.211772963f, -0.126340285f, 0.738923967f, 0.677049518f, 0.000105478393f,
+    0.969525278f, 0.228232026f, -0.135547236f, 0.73454988f, 0.675696373f, 0.000120149489f,
+    0.964156568f, 0.244175509f, -0.144591197f, 0.729842305f, 0.674290419f, 0.000137591458f,
+    0.958400488f, 0.260085166f, -0.153438658f, 0.724802434f, 0.672773659f, 0.000158045834f,
+    0.95300287f, 0.275843292f, -0.161992148f, 0.719765604f, 0.67122817f, 0.000181297539f,
+    0.947257757f, 0.291440815f, -0.170138761f, 0.714647949f, 0.669915199f, 0.000209289166f,
+    0.940411091f, 0.30627811f, -0.17819269f, 0.709237337f, 0.668444455f, 0.000242502851f,
+    0.933008134f, 0.320980638f, -0.185986206f, 0.703328013f, 0.666724503f, 0.00028017335f,
+    0.925952375f, 0.335581779f, -0.193566173f, 0.69729197f, 0.664730132f, 0.000322268781f,
+    0.918248177f, 0.349991381f, -0.200944006f, 0.69083631f, 0.662531555f, 0.000371040398f,
+    0.910177529f, 0.363749236f, -0.208007351f, 0.684198737f, 0.660287023f, 0.000427508203f,
+    0.901422977f, 0.377354443f, -0.214909866f, 0.677226901f, 0.657953382f, 0.000495562213f,
+    0.892915368f, 0.390622616f, -0.221345887f, 0.670217931f, 0.655370235f, 0.000570427976f,
+    0.883611619f, 0.403159469f, -0.227042273f, 0.663503945f, 0.652906001f, 0.000651916605f,
+    0.87412864f, 0.415319026f, -0.232449636f, 0.656577289f, 0.650481343f, 0.000747981132f,
+    0.863828182f, 0.426511258f, -0.237775192f, 0.649529874f, 0.647981346f, 0.000860896078f,
+    0.853123486f, 0.437604994f, -0.242732763f, 0.641979039f, 0.645228565f, 0.000989847234f,
+    0.843355417f, 0.44872278f, -0.247561187f, 0.634682834f, 0.642202497f, 0.00113550189f,
+    0.833003879f, 0.459457397f, -0.251942933f, 0.626817346f, 0.638911366f, 0.00130004447f,
+    0.822696686f, 0.469516426f, -0.256125659f, 0.619214356f, 0.635437489f, 0.0014830617f,
+    0.811241627f, 0.478906751f, -0.260141075f, 0.611020744f, 0.632024825f, 0.00170558575f,
+    0.799129248f, 0.487289935f, -0.263931781f, 0.603024781f, 0.628471017f, 0.00195829314f,
+    0.788039923f, 0.495760918f, -0.267075866f, 0.595252335f, 0.624946833f, 0.00223437836f,
+    0.77526629f, 0.502712309f, -0.269838095f, 0.58736527f, 0.621208012f, 0.00254456233f,
+    0.764531434f, 0.510313034f, -0.272252291f, 0.57997632f, 0.617376804f, 0.00289058266f,
+    0.753561735f, 0.517069161f, -0.274072081f, 0.572698534f, 0.613447368f, 0.00326510379f,
+    0.742152095f, 0.523224175f, -0.275494367f, 0.565532923f, 0.609461427f, 0.00368348579f,
+    0.729018331f, 0.527329028f, -0.276417583f, 0.558023989f, 0.605590284f, 0.00416665804f,
+    0.715923905f, 0.530852318f, -0.27735728f, 0.550878882f, 0.6016047f, 0.00471521495f,
+    0.703279495f, 0.533875704f, -0.278004706f, 0.54378444f, 0.597273827f, 0.00532145659f,
+    0.690775335f, 0.536774457f, -0.278162748f, 0.536170483f, 0.592683673f, 0.00600015558f,
+    0.678434193f, 0.538728654f, -0.278198987f, 0.528974891f, 0.587752879f, 0.00674475776f,
+    0.666411996f, 0.540667057f, -0.277778625f, 0.52171737f, 0.582500517f, 0.00754456082f,
+    0.65544951f, 0.542049885f, -0.277213693f, 0.515370667f, 0.577322364f, 0.00840780139f,
+    0.642676651f, 0.541404188f, -0.275978625f, 0.508712649f, 0.572384953f, 0.00939594768f,
+    0.631089866f, 0.540870726f, -0.274634093f, 0.50256741f, 0.567048311f, 0.0104686664f,
+    0.61912185f, 0.538928628f, -0.272814214f, 0.496256828f, 0.561319828f, 0.0116268257f,
+    0.608369946f, 0.537739158f, -0.270894617f, 0.490565628f, 0.555172682f, 0.0128600309f,
+    0.595930994f, 0.533580065f, -0.268588632f, 0.484768867f, 0.54895407f, 0.0141992783f,
+    0.584723353f, 0.529777706f, -0.266031802f, 0.479097903f, 0.542847872f, 0.0156613439f,
+    0.574212492f, 0.525898516f, -0.263549387f, 0.474075675f, 0.536385357f, 0.0172571819f,
+    0.56423831f, 0.521688759f, -0.260653883f, 0.469027668f, 0.529537141f, 0.0189620145f,
+    0.556401134f, 0.517750502f, -0.257993788f, 0.465300262f, 0.52340126f, 0.0206897836f,
+    0.551354766f, 0.516163111f, -0.256119221f, 0.462776214f, 0.517393708f, 0.0225627292f,
+    0.545392275f, 0.512334824f, -0.253746599f, 0.45988524f, 0.511037707f, 0.0245718881f,
+    0.538547575f, 0.506880224f, -0.25099349f, 0.456816941f, 0.504355371f, 0.0267090797f,
+    0.543285489f, 0.50791657f, -0.247801781f, 0.462611854f, 0.500765681f, 0.0288926829f,
+    0.542371571f, 0.501479864f, -0.242366061f, 0.466942191f, 0.497220308f, 0.031146571f,
+    0.542010248f, 0.493758589f, -0.236270264f, 0.471881717f, 0.493295819f, 0.0334185958f,
+    0.546038032f, 0.488986224f, -0.230145365f, 0.478894085f, 0.48901096f, 0.0356698968f,
+    0.55136168f, 0.484217286f, -0.223381743f, 0.487031639f, 0.484395772f, 0.037847165f,
+    0.562289834f, 0.481890678f, -0.216314867f, 0.497292012f, 0.479484797f, 0.0399059318f,
+    1.0f, 0.0f, 0.0f, 0.789832354f, 0.664041996f, 3.71198948e-05f,
+    0.999061167f, 0.0254161283f, -0.0156416912f, 0.789345801f, 0.663985014f, 3.78507902e-05f,
+    0.998076081f, 0.0421663672f, -0.0259492509f, 0.788736165f, 0.663677871f, 3.8906539e-05f,
+    0.996979773f, 0.0587439649f, -0.0362351872f, 0.787820041f, 0.663417935f, 4.09768691e-05f,
+    0.995825052f, 0.0751833692f, -0.0464744903f, 0.786680758f, 0.663095832f, 4.38405441e-05f,
+    0.994400382f, 0.0914778262f, -0.0567268953f, 0.785064518f, 0.662655652f, 4.75629131e-05f,
+    0.992772341f, 0.107662171f, -0.0666904449f, 0.783107579f, 0.662211299f, 5.22123191e-05f,
+    0.990913272f, 0.123797268f, -0.0766333863f, 0.780715346f, 0.661590338f, 5.77032333e-05f,
+    0.988732576f, 0.140010282f, -0.0865229368f, 0.77783531f, 0.660796225f, 6.4129621e-05f,
+    0.98591274f, 0.1561694f, -0.0963418856f, 0.774682343f, 0.660016119f, 7.23224584e-05f,
+    0.983030319f, 0.172442034f, -0.106068246f, 0.771236897f, 0.658995748f, 8.16115062e-05f,
+    0.979679763f, 0.188217089f, -0.115237363f, 0.767473459f, 0.658038378f, 9.21389801e-05f,
+    0.976181924f, 0.204093695f, -0.1242631f, 0.763789713f, 0.657024562f, 0.000104435137f,
+    0.972004652f, 0.21986334f, -0.133298725f, 0.759570241f, 0.655897498f, 0.000119400764f,
+    0.967708051f, 0.235602975f, -0.142206386f, 0.755109608f, 0.654697597f, 0.000136857241f,
+    0.962653041f, 0.250927776f, -0.151103318f, 0.750453711f, 0.653404117f, 0.000157644041f,
+    0.957021236f, 0.266059577f, -0.159816399f, 0.745412767f, 0.65206188f, 0.00018245494f,
+    0.951815724f, 0.281218499f, -0.168286502f, 0.740286291f, 0.650533438f, 0.000210436236f,
+    0.945662975f, 0.296032667f, -0.17624864f, 0.734780133f, 0.648950398f, 0.000241300659f,
+    0.938878f, 0.310093403f, -0.183752358f, 0.729482055f, 0.647581398f, 0.000277253217f,
+    0.93239665f, 0.324095964f, -0.191079155f, 0.723806798f, 0.646056175f, 0.000318595412f,
+    0.925172746f, 0.337953985f, -0.198331714f, 0.717714012f, 0.644382358f, 0.000368032488f,
+    0.918002725f, 0.351506442f, -0.205363184f, 0.711553752f, 0.642421782f, 0.000423243851f,
+    0.910767913f, 0.365007341f, -0.212143943f, 0.705138564f, 0.640213251f, 0.000484638993f,
+    0.903217614f, 0.377848357f, -0.218555912f, 0.698411882f, 0.637990594f, 0.000555051432f,
+    0.894500494f, 0.390530914f, -0.224839926f, 0.691404283f, 0.635669649f, 0.000638417841f,
+    0.884893477f, 0.402084619f, -0.230669901f, 0.68445164f, 0.633274376f, 0.00073280069f,
+    0.875126362f, 0.413059592f, -0.235882297f, 0.677852869f, 0.631122589f, 0.000840554188f,
+    0.865656614f, 0.424026012f, -0.240751594f, 0.670909286f, 0.628828824f, 0.000963241851f,
+    0.856494129f, 0.43462643f, -0.245333716f, 0.664027989f, 0.626222789f, 0.00109713175f,
+    0.846600115f, 0.445067853f, -0.249890819f, 0.656797767f, 0.62361902f, 0.00125826197f,
+    0.835808575f, 0.454192579f, -0.254225492f, 0.649084806f, 0.620855808f, 0.00144883082f,
+    0.826235116f, 0.464230299f, -0.258244634f, 0.641713917f, 0.617681623f, 0.00165461854f,
+    0.816161215f, 0.473389387f, -0.261876851f, 0.6340909f, 0.61433959f, 0.00188466231f,
+    0.804921925f, 0.481254876f, -0.265187323f, 0.626348078f, 0.610780001f, 0.00214146846f,
+    0.794646978f, 0.489223063f, -0.268124908f, 0.618762791f, 0.607373297f, 0.00242947997f,
+    0.783065796f, 0.495707214f, -0.270501673f, 0.611395836f, 0.603913426f, 0.00273882248f,
+    0.772654712f, 0.502563715f, -0.272666931f, 0.604206264f, 0.600333452f, 0.00308776228f,
+    0.761638522f, 0.508476973f, -0.274454057f, 0.597191155f, 0.596999526f, 0.00349871931f,
+    0.750103533f, 0.513572752f, -0.27593857f, 0.590194643f, 0.59354496f, 0.00396223692f,
+    0.737646639f, 0.516861916f, -0.276748806f, 0.583146155f, 0.590179503f, 0.00447682198f,
+    0.726503313f, 0.520903528f, -0.277501255f, 0.576432705f, 0.586682379f, 0.00505121751f,
+    0.713490546f, 0.522963464f, -0.277838677f, 0.569610119f, 0.58284837f, 0.00567747001f,
+    0.702778161f, 0.525538802f, -0.277848691f, 0.562973857f, 0.578615248f, 0.00634959992f,
+    0.691493094f, 0.527629435f, -0.277496397f, 0.556114972f, 0.574108362f, 0.00708418293f,
+    0.679970622f, 0.528772056f, -0.277278125f, 0.549537122f, 0.56950146f, 0.00792440958f,
+    0.667954087f, 0.528411448f, -0.276391447f, 0.542840838f, 0.565164864f, 0.00885250233f,
+    0.656809151f, 0.527979434f, -0.275155246f, 0.537044227f, 0.560808778f, 0.00985059235f,
+    0.646298647f, 0.526977479f, -0.273675531f, 0.531451523f, 0.556084156f, 0.0109284213f,
+    0.635655642f, 0.525520563f, -0.271892101f, 0.525830269f, 0.551020324f, 0.0121015264f,
+    0.625095487f, 0.523378551f, -0.269700378f, 0.520079195f, 0.545587182f, 0.0133654177f,
+    0.614454806f, 0.519953251f, -0.267461151f, 0.514791906f, 0.540331125f, 0.0147562809f,
+    0.604367018f, 0.51622355f, -0.265092492f, 0.509805679f, 0.534950316f, 0.0162808374f,
+    0.596604884f, 0.513909459f, -0.262523293f, 0.505556524f, 0.529084265f, 0.01784648f,
+    0.587709665f, 0.509067357f, -0.259322852f, 0.501040816f, 0.523344159f, 0.0194675606f,
+    0.583593249f, 0.508229852f, -0.257707f, 0.499103338f, 0.518324316f, 0.0212443657f,
+    0.576159775f, 0.502883077f, -0.255299181f, 0.49558118f, 0.513170362f, 0.023206152f,
+    0.571602046f, 0.500059664f, -0.253065497f, 0.49326697f, 0.50759083f, 0.0252488945f,
+    0.575665832f, 0.501929283f, -0.250280321f, 0.4973647f, 0.504051149f, 0.0273740981f,
+    0.571917951f, 0.491794765f, -0.244306445f, 0.50122422f, 0.501731753f, 0.0295879543f,
+    0.576141119f, 0.488392413f, -0.2386747f, 0.507745564f, 0.499010235f, 0.0318403021f,
+    0.576319396f, 0.480193049f, -0.231611326f, 0.513475239f, 0.495896161f, 0.0340782478f,
+    0.582941353f, 0.475601912f, -0.22469613f, 0.521959782f, 0.492420584f, 0.0362775214f,
+    0.592240691f, 0.472633392f, -0.217162177f, 0.531852424f, 0.4886069f, 0.0383856259f,
+    1.0f, 0.0f, 0.0f, 0.813068926f, 0.643451631f, 3.79146841e-05f,
+    0.999063253f, 0.0244850758f, -0.0153714065f, 0.812614202f, 0.643346965f, 3.85300991e-05f,
+    0.99812156f, 0.0405980982f, -0.0254849568f, 0.812135816f, 0.64323467f, 3.99912569e-05f,
+    0.997157753f, 0.056541875f, -0.0354735963f, 0.811415613f, 0.643115759f, 4.22728444e-05f,
+    0.996037722f, 0.0723441914f, -0.0454888232f, 0.810275137f, 0.642749369f, 4.49724357e-05f,
+    0.994861186f, 0.0879664943f, -0.0555211753f, 0.808738768f, 0.642168581f, 4.82303658e-05f,
+    0.99324739f, 0.103393883f, -0.0652749091f, 0.806841791f, 0.641664743f, 5.24837887e-05f,
+    0.991399825f, 0.118980162f, -0.0751687437f, 0.804552674f, 0.64117676f, 5.82684079e-05f,
+    0.989447653f, 0.134427667f, -0.084672384f, 0.801965117f, 0.640663981f, 6.49766589e-05f,
+    0.987242699f, 0.149853677f, -0.0941337943f, 0.799105465f, 0.639981985f, 7.2631592e-05f,
+    0.984577477f, 0.165424317f, -0.103621185f, 0.795683324f, 0.639131904f, 8.16767642e-05f,
+    0.981453955f, 0.180846915f, -0.113118798f, 0.792179286f, 0.63838017f, 9.33840201e-05f,
+    0.978479028f, 0.196130827f, -0.122392885f, 0.788424611f, 0.637375534f, 0.000106177366f,
+    0.975074053f, 0.211330801f, -0.131233245f, 0.784498811f, 0.636473775f, 0.000121260564f,
+    0.971194386f, 0.226389572f, -0.139903799f, 0.780428648f, 0.635592222f, 0.000139495241f,
+    0.966424167f, 0.241064653f, -0.148376778f, 0.775933802f, 0.634439588f, 0.000159779651f,
+    0.961542487f, 0.255728126f, -0.15659748f, 0.77117312f, 0.633035719f, 0.000181801181f,
+    0.956499338f, 0.270210147f, -0.164707661f, 0.766002536f, 0.631536245f, 0.000207522229f,
+    0.951231241f, 0.284373254f, -0.172655955f, 0.760745406f, 0.629934132f, 0.000237146553f,
+    0.944399655f, 0.29822135f, -0.180425182f, 0.754967332f, 0.628329933f, 0.000272612146f,
+    0.93768549f, 0.311543316f, -0.187948987f, 0.749290645f, 0.62686187f, 0.000314782665f,
+    0.931543171f, 0.324836224f, -0.194767445f, 0.743700743f, 0.625381231f, 0.000360255246f,
+    0.925471842f, 0.338160127f, -0.201508552f, 0.738323927f, 0.623826087f, 0.000411529414f,
+    0.918536484f, 0.351104528f, -0.208170444f, 0.73224318f, 0.622218192f, 0.000473121589f,
+    0.911304176f, 0.363567829f, -0.214648306f, 0.725960672f, 0.620388985f, 0.000542523223f,
+    0.9041664f, 0.37595281f, -0.221072942f, 0.719597638f, 0.618387341f, 0.000623247062f,
+    0.896672368f, 0.38801828f, -0.227056727f, 0.713210821f, 0.616343796f, 0.000713749032f,
+    0.886571944f, 0.398598611f, -0.232429415f, 0.705708027f, 0.614053428f, 0.000814011495f,
+    0.877763271f, 0.409102678f, -0.237630755f, 0.699444592f, 0.611924112f, 0.000929503003f,
+    0.868044078f, 0.418941319f, -0.242393821f, 0.692896366f, 0.61013478f, 0.00107047323f,
+    0.858420074f, 0.428356767f, -0.246663064f, 0.685857773f, 0.608006656f, 0.00122578687f,
+    0.85010457f, 0.43822208f, -0.250743985f, 0.679284632f, 0.605519176f, 0.00139388035f,
+    0.841052175f, 0.447681338f, -0.254572093f, 0.672362208f, 0.602876604f, 0.00158434047f,
+    0.831376314f, 0.456166029f, -0.258134335f, 0.665003419f, 0.600066781f, 0.0018015661f,
+    0.821930528f, 0.464997977f, -0.261354655f, 0.657757223f, 0.596897185f, 0.00203508744f,
+    0.813094974f, 0.473257422f, -0.264434367f, 0.650813699f, 0.593627214f, 0.00229167822f,
+    0.802451551f, 0.480199784f, -0.267178088f, 0.643263817f, 0.590359926f, 0.00258836756f,
+    0.791133523f, 0.486136675f, -0.269807369f, 0.636057377f, 0.587637126f, 0.00294280425f,
+    0.779926836f, 0.491539508f, -0.272125959f, 0.628959119f, 0.584653795f, 0.00333416834f,
+    0.769419491f, 0.496592641f, -0.273696959f, 0.622348905f, 0.581838131f, 0.00376779865f,
+    0.759377778f, 0.501543462f, -0.27494812f, 0.615767002f, 0.578759909f, 0.00424793735f,
+    0.748956203f, 0.505455196f, -0.275532633f, 0.609606922f, 0.575779378f, 0.00477249362f,
+    0.738715947f, 0.508901834f, -0.275867283f, 0.603482783f, 0.572610378f, 0.00534007559f,
+    0.728232861f, 0.51135534f, -0.275980264f, 0.597352028f, 0.569273591f, 0.00596069731f,
+    0.715903699f, 0.512371242f, -0.275882334f, 0.590782106f, 0.565754116f, 0.0066721933f,
+    0.704546452f, 0.513203502f, -0.275614768f, 0.58420974f, 0.561960399f, 0.00746831764f,
+    0.692943156f, 0.513151526f, -0.274971217f, 0.57748121f, 0.557899654f, 0.00832609553f,
+    0.682947636f, 0.513239324f, -0.274205267f, 0.572156012f, 0.554287016f, 0.00926004816f,
+    0.672411799f, 0.512040496f, -0.272758454f, 0.566600263f, 0.550604999f, 0.0102785584f,
+    0.662571251f, 0.511126399f, -0.271114975f, 0.561332285f, 0.546554685f, 0.011374793f,
+    0.652275383f, 0.508687675f, -0.269254714f, 0.555981576f, 0.542201281f, 0.0125872893f,
+    0.641970634f, 0.505970418f, -0.26713863f, 0.550532281f, 0.537557065f, 0.0139251975f,
+    0.63296926f, 0.502730012f, -0.264907867f, 0.54589957f, 0.533201754f, 0.0153470961f,
+    0.624724507f, 0.499915659f, -0.262164116f, 0.541472793f, 0.528360367f, 0.0167883914f,
+    0.618373334f, 0.498151749f, -0.25970453f, 0.53811729f, 0.523236513f, 0.0183443036f,
+    0.611684859f, 0.494199425f, -0.257239193f, 0.534719586f, 0.519037068f, 0.0200558286f,
+    0.604385018f, 0.489166409f, -0.255019188f, 0.531299055f, 0.514965475f, 0.021928167f,
+    0.60185957f, 0.487811267f, -0.253341496f, 0.52986896f, 0.510487974f, 0.0238758493f,
+    0.603418767f, 0.488091767f, -0.25077334f, 0.531278312f, 0.507002652f, 0.0259481389f,
+    0.603674769f, 0.482361883f, -0.245140821f, 0.536463559f, 0.505879879f, 0.0281182174f,
+    0.607440174f, 0.478542864f, -0.239519507f, 0.543725133f, 0.504341006f, 0.0303431358f,
+    0.608747423f, 0.470496476f, -0.232022658f, 0.549077094f, 0.50238502f, 0.0325658731f,
+    0.612374544f, 0.463414073f, -0.224215373f, 0.556053102f, 0.500038028f, 0.034778282f,
+    0.622852325f, 0.461557835f, -0.21671249f, 0.566648364f, 0.497317642f, 0.0369244255f,
+    1.0f, 0.0f, 0.0f, 0.835783303f, 0.622823f, 3.8641123e-05f,
+    0.999035418f, 0.0234747715f, -0.0149922688f, 0.835348845f, 0.622732282f, 3.92667753e-05f,
+    0.998047233f, 0.0389419012f, -0.0248572491f, 0.834835351f, 0.622499943f, 4.04437524e-05f,
+    0.997093856f, 0.0541781411f, -0.0345500857f, 0.834099889f, 0.622263074f, 4.23674137e-05f,
+    0.995957434f, 0.0693309829f, -0.0443418026f, 0.833133757f, 0.622035146f, 4.52236745e-05f,
+    0.994800866f, 0.0842826217f, -0.0540649295f, 0.831897676f, 0.621948183f, 4.94484411e-05f,
+    0.99365598f, 0.0990794674f, -0.0636845082f, 0.830295086f, 0.621586442f, 5.40704459e-05f,
+    0.992269516f, 0.113947377f, -0.0732679591f, 0.828115523f, 0.620979369f, 5.92280485e-05f,
+    0.990681052f, 0.128722176f, -0.082851164f, 0.825691342f, 0.620461404f, 6.60073565e-05f,
+    0.988580644f, 0.143529013f, -0.0923383385f, 0.822923362f, 0.619968235f, 7.4508469e-05f,
+    0.986153424f, 0.158132896f, -0.101291619f, 0.819928646f, 0.619409502f, 8.37596162e-05f,
+    0.983150005f, 0.172748491f, -0.110203631f, 0.816204011f, 0.618706584f, 9.45321008e-05f,
+    0.980135918f, 0.187389925f, -0.119331799f, 0.812736511f, 0.617886424f, 0.000107800799f,
+    0.976772249f, 0.201807559f, -0.128065675f, 0.808667958f, 0.616900086f, 0.000122415207f,
+    0.973644733f, 0.216401979f, -0.136556447f, 0.804535389f, 0.61567229f, 0.000138030082f,
+    0.969825923f, 0.230603322f, -0.144611105f, 0.800263464f, 0.614665568f, 0.000156712689f,
+    0.965262949f, 0.244289532f, -0.152506709f, 0.795894802f, 0.61368674f, 0.000178639952f,
+    0.96052134f, 0.258162946f, -0.160548866f, 0.791410446f, 0.612640619f, 0.000205279488f,
+    0.955389678f, 0.271696806f, -0.168459564f, 0.786416531f, 0.611384988f, 0.000236143882f,
+    0.949907601f, 0.285213411f, -0.17604284f, 0.78109467f, 0.609950304f, 0.000269932963f,
+    0.944313526f, 0.298220456f, -0.183377519f, 0.775865674f, 0.608416438f, 0.000307223556f,
+    0.937899649f, 0.311162621f, -0.190639913f, 0.769979179f, 0.60689342f, 0.000352922041f,
+    0.931989014f, 0.323882133f, -0.197286591f, 0.764422119f, 0.605405867f, 0.000402827223f,
+    0.925457835f, 0.336013466f, -0.203654155f, 0.758824408f, 0.604109287f, 0.000462169643f,
+    0.919370651f, 0.348193794f, -0.209924996f, 0.753337324f, 0.602657318f, 0.000529306708f,
+    0.912699223f, 0.359989941f, -0.215836376f, 0.747247756f, 0.601001024f, 0.000603598601f,
+    0.905786455f, 0.371390998f, -0.221635103f, 0.741030574f, 0.599141359f, 0.000687423046f,
+    0.898683608f, 0.382579625f, -0.227457568f, 0.734689474f, 0.59729135f, 0.000788277073f,
+    0.88878572f, 0.392392159f, -0.23284547f, 0.72777313f, 0.595453441f, 0.000904889777f,
+    0.879366875f, 0.401838988f, -0.237579584f, 0.720926762f, 0.593419611f, 0.00102973753f,
+    0.871650755f, 0.411652178f, -0.241851181f, 0.714913547f, 0.591574967f, 0.00117046584f,
+    0.862796724f, 0.420496285f, -0.245708287f, 0.708581626f, 0.589788556f, 0.00133057195f,
+    0.854355276f, 0.429105908f, -0.24932839f, 0.702089906f, 0.587735713f, 0.00150874443f,
+    0.846175075f, 0.437977105f, -0.252687961f, 0.695778728f, 0.585349917f, 0.00169925205f,
+    0.838266134f, 0.446479231f, -0.255964518f, 0.689318419f, 0.582831442f, 0.00191500655f,
+    0.828940213f, 0.454085171f, -0.259329319f, 0.682465732f, 0.580346882f, 0.00217429316f,
+    0.81922102f, 0.461340606f, -0.262467444f, 0.675209641f, 0.577714801f, 0.00247209962f,
+    0.80934149f, 0.467681944f, -0.265363306f, 0.668057084f, 0.574945927f, 0.00280219875f,
+    0.798916519f, 0.473173082f, -0.267583638f, 0.661094308f, 0.572400808f, 0.00316400803f,
+    0.788635969f, 0.478396714f, -0.269612968f, 0.654312074f, 0.56986481f, 0.00356875733f,
+    0.779203475f, 0.483025759f, -0.271029145f, 0.648543298f, 0.567448139f, 0.00400914624f,
+    0.770402789f, 0.487462223f, -0.271941096f, 0.642633736f, 0.564751565f, 0.00448174309f,
+    0.760611713f, 0.490533471f, -0.272195667f, 0.636983812f, 0.562308609f, 0.00500655547f,
+    0.751247346f, 0.493811578f, -0.272537231f, 0.631363094f, 0.559754372f, 0.00561209535f,
+    0.740307212f, 0.495504707f, -0.272666097f, 0.625225723f, 0.557212412f, 0.00629575038f,
+    0.730799615f, 0.497310877f, -0.272566229f, 0.619476855f, 0.55427897f, 0.0070253727f,
+    0.719337702f, 0.496866852f, -0.272037804f, 0.613224983f, 0.551044226f, 0.00782758184f,
+    0.709673166f, 0.497224569f, -0.271538824f, 0.607490599f, 0.54757309f, 0.00870240014f,
+    0.699762225f, 0.496578723f, -0.270408273f, 0.602535605f, 0.544806004f, 0.00965330936f,
+    0.689572394f, 0.494662911f, -0.268971413f, 0.597449124f, 0.541842878f, 0.0107091572f,
+    0.679597497f, 0.492493093f, -0.267243922f, 0.592232764f, 0.53853631f, 0.0118657015f,
+    0.669159949f, 0.489511907f, -0.265293986f, 0.586947322f, 0.534890532f, 0.013143166f,
+    0.661625564f, 0.48759079f, -0.263135701f, 0.582636714f, 0.531107426f, 0.0144484369f,
+    0.653827965f, 0.484730333f, -0.260706544f, 0.57863158f, 0.527362645f, 0.0158242919f,
+    0.647614479f, 0.482866704f, -0.258339733f, 0.575181007f, 0.523285449f, 0.0173193514f,
+    0.640101075f, 0.478844166f, -0.255563647f, 0.571287394f, 0.519526184f, 0.0189504158f,
+    0.633464754f, 0.474530816f, -0.253493428f, 0.56811285f, 0.516424596f, 0.0207326077f,
+    0.635175407f, 0.477074474f, -0.252574325f, 0.567966342f, 0.513059497f, 0.0226072688f,
+    0.631905138f, 0.474393249f, -0.250281513f, 0.566245079f, 0.509617269f, 0.0246126745f,
+    0.633591413f, 0.469271988f, -0.244509012f, 0.571884453f, 0.509657621f, 0.0267264601f,
+    0.637432694f, 0.465184897f, -0.238154456f, 0.578104615f, 0.509284735f, 0.0289213452f,
+    0.637836337f, 0.456266463f, -0.230846405f, 0.584409595f, 0.508473814f, 0.0311287716f,
+    0.64183706f, 0.449428737f, -0.222799405f, 0.591267526f, 0.507246673f, 0.03334691f,
+    0.653085649f, 0.44803381f, -0.21479997f, 0.601123214f, 0.505613863f, 0.0355212502f,
+    1.0f, 0.0f, 0.0f, 0.857929051f, 0.602180898f, 3.91969297e-05f,
+    0.999034822f, 0.0223889742f, -0.0145356935f, 0.857463777f, 0.602059007f, 3.97170552e-05f,
+    0.998078942f, 0.0371456221f, -0.0240160059f, 0.857114851f, 0.602032661f, 4.12320187e-05f,
+    0.997159064f, 0.0517422743f, -0.0336176045f, 0.856519222f, 0.60195148f, 4.35496113e-05f,
+    0.996089458f, 0.0661951974f, -0.0431424119f, 0.855485499f, 0.601611733f, 4.62067437e-05f,
+    0.99505049f, 0.0804438442f, -0.0525625348f, 0.854264557f, 0.601249754f, 4.96774119e-05f,
+    0.99374938f, 0.0946045071f, -0.0619264692f, 0.852770269f, 0.601008594f, 5.44746545e-05f,
+    0.992304802f, 0.108609438f, -0.0711127743f, 0.850887656f, 0.600748301f, 6.03793196e-05f,
+    0.991002083f, 0.12252219f, -0.0801422447f, 0.848681986f, 0.600231469f, 6.67020577e-05f,
+    0.98922807f, 0.13639766f, -0.0892115906f, 0.845867991f, 0.599589348f, 7.41540352e-05f,
+    0.98683238f, 0.150381193f, -0.0983570367f, 0.842829347f, 0.598972201f, 8.36904001e-05f,
+    0.984615266f, 0.164334461f, -0.10705857f, 0.839562476f, 0.598301947f, 9.42426705e-05f,
+    0.982062221f, 0.178114012f, -0.115214743f, 0.836038768f, 0.597616911f, 0.000105560808f,
+    0.979155242f, 0.191890463f, -0.123565964f, 0.832452357f, 0.596932054f, 0.00011949076f,
+    0.975984812f, 0.205518976f, -0.132033601f, 0.828578234f, 0.596134901f, 0.000136099625f,
+    0.972547293f, 0.219169423f, -0.140339479f, 0.824511409f, 0.595290363f, 0.000155349087f,
+    0.967787445f, 0.232337713f, -0.148540616f, 0.820022941f, 0.594383717f, 0.000178409755f,
+    0.963670731f, 0.245482698f, -0.156106859f, 0.815878689f, 0.593497515f, 0.000203766467f,
+    0.959854066f, 0.258636266f, -0.163311109f, 0.811448753f, 0.592483759f, 0.000231052982f,
+    0.955721557f, 0.271530628f, -0.170654178f, 0.806862712f, 0.591466129f, 0.000264300819f,
+    0.950064361f, 0.283930063f, -0.17766735f, 0.801517308f, 0.590170443f, 0.000300420594f,
+    0.944126844f, 0.295983464f, -0.184914291f, 0.796492219f, 0.588849425f, 0.000344029162f,
+    0.937987626f, 0.307973325f, -0.191749915f, 0.790800869f, 0.587548673f, 0.0003942904f,
+    0.932391763f, 0.320005029f, -0.198225945f, 0.78501308f, 0.586025834f, 0.000448671286f,
+    0.926919162f, 0.331501096f, -0.204118431f, 0.779815555f, 0.584754109f, 0.000510238053f,
+    0.920877755f, 0.343248814f, -0.209809348f, 0.77441448f, 0.58346045f, 0.000581130153f,
+    0.913361192f, 0.353487343f, -0.215538681f, 0.768353105f, 0.582211137f, 0.000668160617f,
+    0.906383216f, 0.364030361f, -0.220935568f, 0.762187481f, 0.580760062f, 0.00076307141f,
+    0.900706589f, 0.374640554f, -0.226199359f, 0.756443679f, 0.5790084f, 0.000865433773f,
+    0.892572582f, 0.384212285f, -0.231203452f, 0.750393748f, 0.57727778f, 0.000983699108f,
+    0.883212566f, 0.39288038f, -0.235582948f, 0.743435621f, 0.575415134f, 0.00111480069f,
+    0.875948012f, 0.401578218f, -0.239424095f, 0.737493813f, 0.573702812f, 0.0012581459f,
+    0.867993832f, 0.410145432f, -0.242771968f, 0.731831133f, 0.572131991f, 0.00141589553f,
+    0.860271454f, 0.417972654f, -0.246285275f, 0.726090848f, 0.570627689f, 0.00160374877f,
+    0.851480305f, 0.425639391f, -0.249684677f, 0.719656944f, 0.569001913f, 0.00182522961f,
+    0.842685997f, 0.432686329f, -0.252967596f, 0.713253856f, 0.567136168f, 0.00207496574f,
+    0.834359586f, 0.439950734f, -0.256010711f, 0.706808746f, 0.565015376f, 0.00235011824f,
+    0.825928032f, 0.446524143f, -0.258914649f, 0.700462103f, 0.562704325f, 0.0026539478f,
+    0.817096412f, 0.452728987f, -0.261470348f, 0.693676114f, 0.560287118f, 0.00299118971f,
+    0.809025466f, 0.458928943f, -0.263693333f, 0.687648416f, 0.558032393f, 0.00335944979f,
+    0.79957813f, 0.463125199f, -0.265273094f, 0.681262851f, 0.555859566f, 0.00375843048f,
+    0.791510105f, 0.467883021f, -0.266505957f, 0.675894856f, 0.554009318f, 0.00420751609f,
+    0.781778157f, 0.470983505f, -0.26747191f, 0.670201421f, 0.552074492f, 0.00472103665f,
+    0.770965576f, 0.472500205f, -0.267730564f, 0.664674103f, 0.550412893f, 0.0053017363f,
+    0.762910128f, 0.475530684f, -0.267858833f, 0.659646928f, 0.548400402f, 0.00592492055f,
+    0.754171491f, 0.477149546f, -0.2678186f, 0.654338062f, 0.546361268f, 0.00661461148f,
+    0.744577944f, 0.477862775f, -0.267547578f, 0.648853004f, 0.544066429f, 0.00736644724f,
+    0.735590756f, 0.478592873f, -0.267088324f, 0.643479943f, 0.541444004f, 0.00818265602f,
+    0.725913584f, 0.478209496f, -0.266358882f, 0.638052106f, 0.538781941f, 0.00908588897f,
+    0.716545582f, 0.476884604f, -0.265060216f, 0.633327067f, 0.536835253f, 0.010087871f,
+    0.707586408f, 0.475135088f, -0.263705343f, 0.628708601f, 0.534584343f, 0.011206327f,
+    0.697946191f, 0.472339571f, -0.261749715f, 0.623737574f, 0.531888068f, 0.0123821972f,
+    0.690959573f, 0.471059382f, -0.25973323f, 0.619804919f, 0.528747141f, 0.0135921119f,
+    0.68398422f, 0.468963385f, -0.2576406f, 0.616140366f, 0.526034832f, 0.0149223693f,
+    0.676176369f, 0.465617359f, -0.255201906f, 0.612026334f, 0.523053646f, 0.0163765512f,
+    0.66868335f, 0.461945057f, -0.252564996f, 0.608042181f, 0.519907892f, 0.0179437734f,
+    0.663740695f, 0.459144115f, -0.250500411f, 0.605426013f, 0.517565191f, 0.0196194462f,
+    0.665572643f, 0.461594373f, -0.249815851f, 0.60553962f, 0.515266001f, 0.0214255787f,
+    0.66169709f, 0.458866179f, -0.247791246f, 0.602891386f, 0.512597978f, 0.0233587138f,
+    0.663103342f, 0.454062551f, -0.242511436f, 0.607579112f, 0.513063967f, 0.0254136138f,
+    0.665290058f, 0.448525727f, -0.235800445f, 0.613527298f, 0.513840199f, 0.0275749322f,
+    0.671245098f, 0.444274783f, -0.228626996f, 0.620738626f, 0.514161587f, 0.0297628697f,
+    0.674732149f, 0.437859029f, -0.220521823f, 0.627915144f, 0.514044464f, 0.0319808088f,
+    0.682154834f, 0.432755888f, -0.211886093f, 0.63645184f, 0.513494313f, 0.0341747627f,
+    1.0f, 0.0f, 0.0f, 0.879443765f, 0.581626236f, 3.96517171e-05f,
+    0.999100447f, 0.0213186629f, -0.0140959602f, 0.879073083f, 0.581574619f, 4.03237245e-05f,
+    0.998113692f, 0.0352682136f, -0.023124503f, 0.878685176f, 0.581427038f, 4.15217983e-05f,
+    0.997083783f, 0.0491481833f, -0.0323503464f, 0.878099024f, 0.581281066f, 4.35715119e-05f,
+    0.996096849f, 0.0628322065f, -0.0413642861f, 0.877295732f, 0.58112818f, 4.63939468e-05f,
+    0.99502635f, 0.0763820261f, -0.0504709482f, 0.876162767f, 0.58087337f, 5.00258466e-05f,
+    0.993876994f, 0.089676626f, -0.0594795384f, 0.87462604f, 0.580389678f, 5.40476867e-05f,
+    0.992732286f, 0.102870271f, -0.0684149414f, 0.872871637f, 0.579927564f, 5.91069875e-05f,
+    0.991053164f, 0.115978271f, -0.0772322267f, 0.870817304f, 0.579636455f, 6.58808203e-05f,
+    0.989366591f, 0.12902838f, -0.085651502f, 0.868390322f, 0.579241216f, 7.33097622e-05f,
+    0.987901747f, 0.142172769f, -0.0940009281f, 0.86560154f, 0.578672349f, 8.13974111e-05f,
+    0.985730112f, 0.155297056f, -0.102725223f, 0.862466335f, 0.578151047f, 9.20119783e-05f,
+    0.983462334f, 0.168513581f, -0.11133828f, 0.85925597f, 0.577554882f, 0.000104311526f,
+    0.981112003f, 0.181679994f, -0.119483151f, 0.85583806f, 0.577001691f, 0.000118158547f,
+    0.97805512f, 0.194486871f, -0.12751016f, 0.852362335f, 0.576572597f, 0.000135325332f,
+    0.97480458f, 0.207223117f, -0.135261327f, 0.848341346f, 0.575921774f, 0.000153963978f,
+    0.971902311f, 0.220044747f, -0.142885491f, 0.844382584f, 0.575043738f, 0.000173971566f,
+    0.967559457f, 0.232355773f, -0.150411889f, 0.840050459f, 0.574191749f, 0.000197749716f,
+    0.963566482f, 0.244543359f, -0.157639295f, 0.835773587f, 0.573317885f, 0.000224517353f,
+    0.959369659f, 0.256498069f, -0.164595813f, 0.831477761f, 0.5726161f, 0.000256602652f,
+    0.955174565f, 0.268549383f, -0.171534449f, 0.826942563f, 0.571811199f, 0.000294142403f,
+    0.950133801f, 0.280266583f, -0.178104222f, 0.82205224f, 0.570848286f, 0.000334575103f,
+    0.945041239f, 0.291865677f, -0.184718296f, 0.817169547f, 0.569746614f, 0.000380795245f,
+    0.939790964f, 0.303146839f, -0.1911356f, 0.811892688f, 0.568428636f, 0.00043158856f,
+    0.933300316f, 0.313970178f, -0.197450086f, 0.806014419f, 0.567409933f, 0.00049574743f,
+    0.927417815f, 0.324690938f, -0.203482911f, 0.800654769f, 0.566272616f, 0.000567235227f,
+    0.921824515f, 0.33467868f, -0.208580196f, 0.795578241f, 0.565234244f, 0.000643092382f,
+    0.915983021f, 0.344613731f, -0.213583618f, 0.790186107f, 0.564090431f, 0.000729562715f,
+    0.910323441f, 0.35497424f, -0.218420789f, 0.784660459f, 0.56273967f, 0.000825047668f,
+    0.904192328f, 0.36460942f, -0.22318393f, 0.778995097f, 0.561383367f, 0.000933136849f,
+    0.898451805f, 0.374271125f, -0.2278689f, 0.773546457f, 0.559858084f, 0.00105172652f,
+    0.889645755f, 0.382400751f, -0.232114479f, 0.767195463f, 0.558424115f, 0.00118823221f,
+    0.880883574f, 0.389773071f, -0.236148715f, 0.761232495f, 0.557143092f, 0.00134870189f,
+    0.872921765f, 0.397294074f, -0.239648223f, 0.755601645f, 0.556148529f, 0.00153762242f,
+    0.86423552f, 0.403882831f, -0.242785782f, 0.749873877f, 0.555142939f, 0.00174732658f,
+    0.85729897f, 0.411118388f, -0.245780215f, 0.74444586f, 0.553844631f, 0.00197473262f,
+    0.849649251f, 0.417761296f, -0.248574063f, 0.738567114f, 0.55234921f, 0.00222925632f,
+    0.841975927f, 0.424109787f, -0.25126195f, 0.732828557f, 0.550596952f, 0.00250978488f,
+    0.83405906f, 0.430167586f, -0.253563195f, 0.726454318f, 0.548628867f, 0.00281596277f,
+    0.826260507f, 0.435575873f, -0.255794823f, 0.720110178f, 0.546566665f, 0.00315411226f,
+    0.819200158f, 0.441653401f, -0.257968068f, 0.714697003f, 0.544742346f, 0.0035296008f,
+    0.810387969f, 0.445765048f, -0.259616077f, 0.70853579f, 0.543213725f, 0.00396568701f,
+    0.801787436f, 0.448838383f, -0.260953546f, 0.703340352f, 0.542140663f, 0.00446819793f,
+    0.792960644f, 0.451785266f, -0.261741459f, 0.698330343f, 0.540815473f, 0.00500117103f,
+    0.784792483f, 0.453813881f, -0.261759669f, 0.693486512f, 0.539716721f, 0.00559234619f,
+    0.777172565f, 0.456055403f, -0.261634618f, 0.688925564f, 0.538284838f, 0.00623046467f,
+    0.76883024f, 0.457237333f, -0.261496276f, 0.684420526f, 0.536822975f, 0.00693165697f,
+    0.758296549f, 0.45635277f, -0.260889381f, 0.678785503f, 0.535139799f, 0.00770413131f,
+    0.750211895f, 0.456878275f, -0.26055181f, 0.674008191f, 0.533192337f, 0.00856120698f,
+    0.741170943f, 0.455800623f, -0.259515226f, 0.668886602f, 0.531549811f, 0.00951612275f,
+    0.732417166f, 0.454177052f, -0.258114129f, 0.664458752f, 0.530256271f, 0.010564493f,
+    0.72582823f, 0.453055322f, -0.256590664f, 0.660927951f, 0.528524339f, 0.0116476873f,
+    0.7189008f, 0.451943964f, -0.254731834f, 0.657073081f, 0.526444197f, 0.0128105935f,
+    0.713770926f, 0.451755285f, -0.252767205f, 0.653310239f, 0.524369657f, 0.0140853561f,
+    0.704616845f, 0.446546227f, -0.250545174f, 0.649338484f, 0.522444427f, 0.0154837184f,
+    0.695945442f, 0.441894203f, -0.247941151f, 0.644962907f, 0.52012229f, 0.0169906449f,
+    0.692702889f, 0.441000581f, -0.245920882f, 0.642892957f, 0.518361151f, 0.0185843129f,
+    0.692672193f, 0.441482484f, -0.2449909f, 0.642128408f, 0.517092347f, 0.020316869f,
+    0.691867471f, 0.441121668f, -0.243691087f, 0.640610754f, 0.515493512f, 0.0221847314f,
+    0.692214966f, 0.436735034f, -0.239300877f, 0.643784761f, 0.516107023f, 0.024180809f,
+    0.695582688f, 0.432243913f, -0.232364103f, 0.649837732f, 0.518005371f, 0.0262966603f,
+    0.69799912f, 0.425662845f, -0.224597082f, 0.655892849f, 0.519446969f, 0.0284651667f,
+    0.703433514f, 0.420321971f, -0.216370448f, 0.663079023f, 0.520430624f, 0.0306769181f,
+    0.711443126f, 0.415642172f, -0.207772896f, 0.672053635f, 0.52095741f, 0.0328835547f,
+    1.0f, 0.0f, 0.0f, 0.900264025f, 0.561195493f, 3.99390592e-05f,
+    0.999145567f, 0.020157963f, -0.0135585843f, 0.899983704f, 0.56114763f, 4.05988831e-05f,
+    0.998217225f, 0.0332764238f, -0.0221107695f, 0.899717748f, 0.561127603f, 4.19691278e-05f,
+    0.997244775f, 0.0464506187f, -0.030961059f, 0.899215519f, 0.561013877f, 4.40047806e-05f,
+    0.996080101f, 0.059384685f, -0.0395937823f, 0.898314118f, 0.560781777f, 4.65162193e-05f,
+    0.995117903f, 0.0721875578f, -0.0481928289f, 0.89735496f, 0.560565472f, 4.98408481e-05f,
+    0.993891954f, 0.0847911984f, -0.0567205325f, 0.896220624f, 0.560474694f, 5.44223149e-05f,
+    0.992716372f, 0.0972072482f, -0.0652181134f, 0.894733727f, 0.560212493f, 5.96511054e-05f,
+    0.992005348f, 0.109530978f, -0.0737032294f, 0.893005192f, 0.559723377f, 6.53362949e-05f,
+    0.990759552f, 0.121879697f, -0.0823330432f, 0.890646577f, 0.559304595f, 7.27879597e-05f,
+    0.988757074f, 0.134147704f, -0.0904207379f, 0.888257444f, 0.559033573f, 8.16274478e-05f,
+    0.987033486f, 0.146271393f, -0.0983706042f, 0.885616004f, 0.558682382f, 9.16397039e-05f,
+    0.984502435f, 0.158537775f, -0.106529661f, 0.882323802f, 0.558248758f, 0.000103939376f,
+    0.982324958f, 0.170681328f, -0.114560716f, 0.878895044f, 0.557657242f, 0.000117597556f,
+    0.980252147f, 0.182931542f, -0.122370176f, 0.875383139f, 0.556962669f, 0.000132512432f,
+    0.977946639f, 0.195092827f, -0.129768565f, 0.871963978f, 0.556501627f, 0.000149969273f,
+    0.975005865f, 0.207108453f, -0.136949927f, 0.868153691f, 0.556098521f, 0.000170510699f,
+    0.972220302f, 0.21895045f, -0.144259676f, 0.864661872f, 0.555516899f, 0.000193742948f,
+    0.96732229f, 0.230098829f, -0.151552185f, 0.860287189f, 0.554899931f, 0.000221446942f,
+    0.963455379f, 0.24154757f, -0.15849486f, 0.856055081f, 0.55420512f, 0.000251788442f,
+    0.959640741f, 0.252981395f, -0.164822638f, 0.851739824f, 0.553583086f, 0.000285622722f,
+    0.955604672f, 0.263872504f, -0.170884281f, 0.847259164f, 0.552886128f, 0.000323229935f,
+    0.950597584f, 0.274629205f, -0.177163973f, 0.842685938f, 0.552169919f, 0.000368711451f,
+    0.944936872f, 0.284614533f, -0.183449745f, 0.838068306f, 0.551386774f, 0.00042213031f,
+    0.940327585f, 0.295434415f, -0.189369187f, 0.832931817f, 0.550388515f, 0.000479261624f,
+    0.935418725f, 0.30562073f, -0.195125416f, 0.827848256f, 0.54925257f, 0.00054177508f,
+    0.930025876f, 0.315697491f, -0.2005945f, 0.822413981f, 0.548251569f, 0.00061379309f,
+    0.924678147f, 0.325165898f, -0.205442429f, 0.817319155f, 0.547428071f, 0.000694010989f,
+    0.919889152f, 0.334641874f, -0.21019128f, 0.812924922f, 0.546724498f, 0.000785575248f,
+    0.914583564f, 0.3437033f, -0.214815572f, 0.807998836f, 0.545861125f, 0.000887936563f,
+    0.908990085f, 0.352944404f, -0.21942611f, 0.802667499f, 0.54490006f, 0.00100554642f,
+    0.902006507f, 0.361205071f, -0.224084407f, 0.796884358f, 0.543958545f, 0.00114434678f,
+    0.894542456f, 0.368446529f, -0.22843875f, 0.790986359f, 0.543049634f, 0.00130254764f,
+    0.885920644f, 0.37546882f, -0.232186109f, 0.785045207f, 0.542115569f, 0.00147767621f,
+    0.878418624f, 0.381650895f, -0.235072836f, 0.779967666f, 0.541275918f, 0.0016653738f,
+    0.872143209f, 0.38854143f, -0.237699315f, 0.775280774f, 0.540467918f, 0.00187465653f,
+    0.864703178f, 0.394444823f, -0.240109339f, 0.77001667f, 0.539559007f, 0.00210963236f,
+    0.857616007f, 0.400469422f, -0.242280349f, 0.764472365f, 0.538417041f, 0.00236336933f,
+    0.85090661f, 0.406412601f, -0.244594961f, 0.759158075f, 0.537106335f, 0.00264988537f,
+    0.843296945f, 0.411742151f, -0.246618599f, 0.753070891f, 0.535598516f, 0.00296545471f,
+    0.835824192f, 0.416738898f, -0.249196678f, 0.747507691f, 0.534160197f, 0.00333925197f,
+    0.826820552f, 0.420454025f, -0.251294047f, 0.741211355f, 0.533039987f, 0.00376648572f,
+    0.820022941f, 0.424716324f, -0.252917826f, 0.736177862f, 0.532016516f, 0.00421637809f,
+    0.81329304f, 0.427938402f, -0.253938556f, 0.732150674f, 0.531390131f, 0.00471959868f,
+    0.806110501f, 0.430895418f, -0.254233569f, 0.727415621f, 0.530662894f, 0.00526167452f,
+    0.798263371f, 0.432355314f, -0.253913879f, 0.723007202f, 0.530128121f, 0.00586118316f,
+    0.791735172f, 0.434053153f, -0.253665f, 0.719029725f, 0.529334605f, 0.00651737209f,
+    0.782587349f, 0.433657825f, -0.253249019f, 0.714336753f, 0.528527915f, 0.00724756112f,
+    0.774398863f, 0.43376708f, -0.252917558f, 0.709782183f, 0.527489424f, 0.00806178432f,
+    0.764925957f, 0.432687253f, -0.252277523f, 0.704170644f, 0.526218653f, 0.00897801016f,
+    0.758479714f, 0.432602823f, -0.251092315f, 0.700867414f, 0.525555491f, 0.00993716531f,
+    0.752655625f, 0.431889832f, -0.249620974f, 0.697784245f, 0.524805546f, 0.010946285f,
+    0.745894313f, 0.430696696f, -0.247959539f, 0.69413507f, 0.523770154f, 0.0120646181f,
+    0.73839283f, 0.428321183f, -0.246010765f, 0.689745665f, 0.522414625f, 0.0133026894f,
+    0.731794298f, 0.425982356f, -0.244218007f, 0.686485529f, 0.521468282f, 0.0146490103f,
+    0.724197865f, 0.422151804f, -0.241972849f, 0.682492912f, 0.520189762f, 0.0161044374f,
+    0.722015262f, 0.421690732f, -0.24007237f, 0.680562437f, 0.519004822f, 0.0176241621f,
+    0.718552053f, 0.419222057f, -0.238601223f, 0.678480983f, 0.518576682f, 0.0192826912f,
+    0.7170977f, 0.418452829f, -0.237483159f, 0.676875889f, 0.518003285f, 0.0210786499f,
+    0.720450997f, 0.418249726f, -0.234458372f, 0.679290593f, 0.518778324f, 0.0230187699f,
+    0.723438799f, 0.41261059f, -0.227401972f, 0.685753107f, 0.521779835f, 0.0250831358f,
+    0.725698888f, 0.405712575f, -0.219358608f, 0.691346645f, 0.52433008f, 0.0272306893f,
+    0.729518652f, 0.39953813f, -0.21082662f, 0.69784081f, 0.526404679f, 0.029432686f,
+    0.74058646f, 0.397271007f, -0.202093869f, 0.706570446f, 0.528002977f, 0.0316460244f,
+    1.0f, 0.0f, 0.0f, 0.920516431f, 0.540995181f, 4.01557154e-05f,
+    0.999207199f, 0.0189208463f, -0.0129482038f, 0.92023778f, 0.540919244f, 4.07298139e-05f,
+    0.998253584f, 0.0313396193f, -0.0212196745f, 0.919969082f, 0.540825427f, 4.19568278e-05f,
+    0.997219265f, 0.0436141565f, -0.0294938255f, 0.919487f, 0.540722072f, 4.38551797e-05f,
+    0.99631089f, 0.0557877608f, -0.0376427472f, 0.919029832f, 0.540805638f, 4.68770813e-05f,
+    0.995340228f, 0.0678956062f, -0.0459651873f, 0.918112576f, 0.540728033f, 5.050248e-05f,
+    0.994254708f, 0.079734914f, -0.0541028306f, 0.917052329f, 0.540469527f, 5.44505383e-05f,
+    0.992899418f, 0.0915000588f, -0.0623191111f, 0.915549159f, 0.540314257f, 5.96986902e-05f,
+    0.991709411f, 0.10299021f, -0.0702065751f, 0.914200127f, 0.54031086f, 6.6244007e-05f,
+    0.990638793f, 0.114360183f, -0.0781036094f, 0.912350595f, 0.540096581f, 7.34346977e-05f,
+    0.989127159f, 0.125821859f, -0.0862250701f, 0.910008013f, 0.539752722f, 8.20390997e-05f,
+    0.98770535f, 0.137410015f, -0.094180502f, 0.907438457f, 0.539323092f, 9.18735168e-05f,
+    0.986401677f, 0.148435459f, -0.101409122f, 0.904937506f, 0.539092481f, 0.000103049519f,
+    0.984172821f, 0.159715474f, -0.108584516f, 0.901805401f, 0.538707435f, 0.000115406343f,
+    0.98194921f, 0.171036392f, -0.116104819f, 0.89870584f, 0.538285136f, 0.000130610075f,
+    0.979655743f, 0.182172418f, -0.123535745f, 0.895027757f, 0.537672341f, 0.000147354469f,
+    0.976824462f, 0.193588391f, -0.13096638f, 0.891130745f, 0.537115812f, 0.00016746686f,
+    0.974122703f, 0.204418793f, -0.137739971f, 0.887700379f, 0.536827505f, 0.000190407198f,
+    0.971930683f, 0.215628847f, -0.144293308f, 0.884329677f, 0.536523461f, 0.00021580045f,
+    0.967741489f, 0.226033002f, -0.150799453f, 0.88048625f, 0.536017835f, 0.000243722025f,
+    0.963841379f, 0.236536145f, -0.157344207f, 0.876166224f, 0.535482824f, 0.000276375067f,
+    0.959650695f, 0.246578351f, -0.163764909f, 0.871771932f, 0.535110712f, 0.000316050311f,
+    0.955657184f, 0.256828487f, -0.169431761f, 0.867679417f, 0.534833014f, 0.000359868311f,
+    0.952500224f, 0.26693657f, -0.175007761f, 0.863819063f, 0.534324706f, 0.000406934356f,
+    0.948033273f, 0.276482642f, -0.180628508f, 0.859686971f, 0.533745408f, 0.000460993469f,
+    0.94318068f, 0.286131322f, -0.185990945f, 0.85502547f, 0.533017397f, 0.000520037545f,
+    0.938266516f, 0.295384139f, -0.191552684f, 0.850091219f, 0.532228529f, 0.000589544186f,
+    0.933000028f, 0.304516643f, -0.196790546f, 0.844880164f, 0.531466901f, 0.000666894193f,
+    0.928553283f, 0.31368798f, -0.201669812f, 0.840250373f, 0.53085494f, 0.000752798398f,
+    0.923143744f, 0.322126448f, -0.206187502f, 0.835709333f, 0.530579388f, 0.000855677295f,
+    0.917392015f, 0.330087602f, -0.210621044f, 0.830969036f, 0.530284047f, 0.000973976625f,
+    0.911629319f, 0.33800441f, -0.214953914f, 0.825986147f, 0.529756069f, 0.00110634766f,
+    0.906205833f, 0.34576115f, -0.219053805f, 0.820713162f, 0.529053628f, 0.00125157274f,
+    0.899599135f, 0.352817982f, -0.222784042f, 0.81519258f, 0.528260291f, 0.00140909769f,
+    0.894015431f, 0.359779626f, -0.226255581f, 0.810240567f, 0.527615845f, 0.00158559124f,
+    0.88586694f, 0.364926189f, -0.228719383f, 0.805146694f, 0.52718538f, 0.00178154872f,
+    0.880465209f, 0.370933414f, -0.230847508f, 0.800783873f, 0.526757419f, 0.00199409691f,
+    0.873657286f, 0.376268208f, -0.23300375f, 0.796201825f, 0.526377261f, 0.00223888503f,
+    0.867165565f, 0.381780475f, -0.234993011f, 0.791244984f, 0.525754809f, 0.00250685378f,
+    0.85972327f, 0.386494458f, -0.237197503f, 0.785845876f, 0.525086164f, 0.00282242289f,
+    0.851303697f, 0.390417218f, -0.239409864f, 0.780375779f, 0.524205446f, 0.00317950384f,
+    0.844330549f, 0.394825011f, -0.241268739f, 0.774639666f, 0.523037493f, 0.00355827855f,
+    0.837916374f, 0.398930252f, -0.243207604f, 0.769754052f, 0.522282004f, 0.00398268411f,
+    0.831748128f, 0.402554035f, -0.244501874f, 0.765155852f, 0.52178961f, 0.00444110529f,
+    0.825168073f, 0.405368716f, -0.244919971f, 0.761066139f, 0.521720827f, 0.00495172944f,
+    0.818935096f, 0.407168627f, -0.244977251f, 0.757171035f, 0.521694601f, 0.00550804334f,
+    0.812582135f, 0.408891708f, -0.244608179f, 0.753694117f, 0.521767974f, 0.00612525223f,
+    0.803170502f, 0.408134639f, -0.24381648f, 0.748614907f, 0.521650136f, 0.00681766775f,
+    0.794685245f, 0.407475173f, -0.243493259f, 0.744129479f, 0.521540284f, 0.00760666747f,
+    0.788186312f, 0.408059776f, -0.243118033f, 0.740074754f, 0.521093786f, 0.00845040474f,
+    0.782862484f, 0.40854758f, -0.242393598f, 0.736793578f, 0.520563424f, 0.00932888407f,
+    0.776981711f, 0.407956809f, -0.240762442f, 0.733552992f, 0.520750344f, 0.0102904961f,
+    0.77038306f, 0.406402826f, -0.239317238f, 0.73005712f, 0.520760715f, 0.0113751478f,
+    0.764083087f, 0.404839933f, -0.237941623f, 0.726913869f, 0.520425081f, 0.0125676272f,
+    0.757732213f, 0.402309507f, -0.236333728f, 0.723474562f, 0.520133197f, 0.0138737941f,
+    0.751207352f, 0.399523556f, -0.234371349f, 0.719868183f, 0.519868195f, 0.0152665284f,
+    0.74890244f, 0.399955451f, -0.232532427f, 0.717678785f, 0.519307971f, 0.0167214591f,
+    0.74336493f, 0.395514846f, -0.230694517f, 0.714757562f, 0.519676089f, 0.0183079652f,
+    0.742819071f, 0.394970745f, -0.229933292f, 0.713562369f, 0.520113766f, 0.0200332608f,
+    0.7481848f, 0.397101164f, -0.228525877f, 0.715507865f, 0.521074355f, 0.021919908f,
+    0.750558674f, 0.39146471f, -0.220948637f, 0.721131623f, 0.525164068f, 0.0239307974f,
+    0.749984264f, 0.382971019f, -0.212580815f, 0.725897014f, 0.528811634f, 0.0260569025f,
+    0.757231236f, 0.379174858f, -0.204245031f, 0.733229578f, 0.531968117f, 0.0282459743f,
+    0.764830887f, 0.37411803f, -0.195009544f, 0.740193307f, 0.534631312f, 0.0304605123f,
+    1.0f, 0.0f, 0.0f, 0.940078616f, 0.521036327f, 4.0224837e-05f,
+    0.999355495f, 0.0176105071f, -0.0121601168f, 0.939854145f, 0.520979166f, 4.07733896e-05f,
+    0.998391867f, 0.0292278919f, -0.0199963581f, 0.939721644f, 0.521040022f, 4.22434168e-05f,
+    0.997338653f, 0.0407405458f, -0.0279790405f, 0.939308226f, 0.520959735f, 4.41983102e-05f,
+    0.996315598f, 0.0521062613f, -0.0357679091f, 0.938593566f, 0.520759344f, 4.65470039e-05f,
+    0.995361269f, 0.0633833781f, -0.043566823f, 0.937933505f, 0.520678103f, 4.99590788e-05f,
+    0.99430126f, 0.0744368285f, -0.0511825755f, 0.937017441f, 0.520706713f, 5.44276809e-05f,
+    0.993102312f, 0.0853984579f, -0.0587800443f, 0.935737252f, 0.520594478f, 5.94297962e-05f,
+    0.992114663f, 0.096200265f, -0.0664454401f, 0.934460402f, 0.520424962f, 6.53522511e-05f,
+    0.990586817f, 0.107009791f, -0.0741478652f, 0.932745755f, 0.520319164f, 7.27791048e-05f,
+    0.989401102f, 0.117357723f, -0.0811700523f, 0.930955946f, 0.520305812f, 8.10029669e-05f,
+    0.988502443f, 0.127624273f, -0.0883188322f, 0.928923786f, 0.520119488f, 9.00446321e-05f,
+    0.986962855f, 0.138296574f, -0.0958381444f, 0.926386654f, 0.519868016f, 0.000101161037f,
+    0.985254169f, 0.148654848f, -0.102939732f, 0.923438489f, 0.51957953f, 0.000113376496f,
+    0.983567536f, 0.158945829f, -0.109716326f, 0.921146631f, 0.51957655f, 0.000128311018f,
+    0.981173038f, 0.169322357f, -0.116536878f, 0.918042004f, 0.519422412f, 0.00014548529f,
+    0.97892189f, 0.179492861f, -0.123254649f, 0.914542615f, 0.519029856f, 0.000163916411f,
+    0.976757109f, 0.189885199f, -0.130115494f, 0.910994112f, 0.518496037f, 0.000184767239f,
+    0.97450012f, 0.200008944f, -0.136799678f, 0.907427251f, 0.518069744f, 0.000208834128f,
+    0.971361279f, 0.210022181f, -0.142984003f, 0.903805077f, 0.518017054f, 0.000237777582f,
+    0.967973113f, 0.219624579f, -0.149220526f, 0.900518179f, 0.517954051f, 0.000271474884f,
+    0.964058816f, 0.229298651f, -0.155222982f, 0.896232009f, 0.517652452f, 0.000307823211f,
+    0.961176395f, 0.238725409f, -0.161107346f, 0.892614543f, 0.517267108f, 0.000347164052f,
+    0.957617104f, 0.248048469f, -0.166384578f, 0.888839602f, 0.517187893f, 0.000392849965f,
+    0.954156995f, 0.256930798f, -0.171367869f, 0.884934723f, 0.517112851f, 0.000444144534f,
+    0.949749172f, 0.2658149f, -0.17656973f, 0.881032228f, 0.516905963f, 0.000503335847f,
+    0.946734607f, 0.274782419f, -0.181652039f, 0.877120912f, 0.516574919f, 0.000567913696f,
+    0.941502512f, 0.283122063f, -0.1869151f, 0.872898459f, 0.516211808f, 0.00064362539f,
+    0.93583411f, 0.291359365f, -0.192023143f, 0.867739975f, 0.515727222f, 0.000730164349f,
+    0.931035399f, 0.299223363f, -0.196948856f, 0.86303252f, 0.515385509f, 0.000829269586f,
+    0.925466359f, 0.306631207f, -0.200988218f, 0.858465374f, 0.515408397f, 0.000941798033f,
+    0.921381056f, 0.314148098f, -0.20472984f, 0.854569793f, 0.515316665f, 0.00106173567f,
+    0.916853786f, 0.321320713f, -0.208261609f, 0.850079358f, 0.515061378f, 0.00119335449f,
+    0.911593556f, 0.328308016f, -0.211703926f, 0.845101833f, 0.514605224f, 0.00133864232f,
+    0.905575514f, 0.334712267f, -0.215180993f, 0.840084851f, 0.514176309f, 0.00150192773f,
+    0.899823964f, 0.340605915f, -0.218334869f, 0.835077345f, 0.513908744f, 0.00168688479f,
+    0.8942765f, 0.346090466f, -0.22073102f, 0.830692589f, 0.513997138f, 0.00189461058f,
+    0.889268458f, 0.351943225f, -0.222698882f, 0.826653004f, 0.514123797f, 0.00212325715f,
+    0.882507265f, 0.356224477f, -0.224634945f, 0.822178245f, 0.514353633f, 0.00239067199f,
+    0.874701738f, 0.360197067f, -0.226627693f, 0.817627966f, 0.51436758f, 0.00269265287f,
+    0.868519902f, 0.364300817f, -0.228391334f, 0.81311661f, 0.514053404f, 0.00301304809f,
+    0.861162364f, 0.367878318f, -0.23010546f, 0.808017492f, 0.513581932f, 0.00336961844f,
+    0.855453968f, 0.371770293f, -0.231767669f, 0.803024769f, 0.512849927f, 0.00375617226f,
+    0.849841058f, 0.375598282f, -0.233338445f, 0.798457205f, 0.512602925f, 0.00418819208f,
+    0.844240844f, 0.378930956f, -0.234295428f, 0.794451177f, 0.512776077f, 0.00465863105f,
+    0.838245213f, 0.38097468f, -0.234473541f, 0.790804207f, 0.513258755f, 0.00518281246f,
+    0.831690371f, 0.381877393f, -0.234259605f, 0.787096024f, 0.51404345f, 0.00577832572f,
+    0.822829306f, 0.381283194f, -0.23364909f, 0.782889605f, 0.514817834f, 0.00644957926f,
+    0.815662622f, 0.380643517f, -0.233123928f, 0.779117584f, 0.51537019f, 0.00718144234f,
+    0.810590148f, 0.381575584f, -0.232575402f, 0.776003301f, 0.515697896f, 0.00794406515f,
+    0.805178821f, 0.382327527f, -0.231830657f, 0.772227943f, 0.515760481f, 0.00876022782f,
+    0.799803376f, 0.382096589f, -0.230781823f, 0.769307196f, 0.516492665f, 0.00969824567f,
+    0.794031978f, 0.380582601f, -0.229433835f, 0.766314149f, 0.517425299f, 0.0107383598f,
+    0.788075745f, 0.379310638f, -0.228198469f, 0.763248503f, 0.518088579f, 0.0118895788f,
+    0.781703353f, 0.377146363f, -0.226717383f, 0.759619534f, 0.518424809f, 0.0131462384f,
+    0.776486397f, 0.374792933f, -0.225159615f, 0.757032931f, 0.519149661f, 0.0144680534f,
+    0.772239089f, 0.373292565f, -0.223216623f, 0.753818393f, 0.51944977f, 0.0158715434f,
+    0.768922031f, 0.371125489f, -0.221490681f, 0.751597941f, 0.520382702f, 0.0173825156f,
+    0.768467903f, 0.371063083f, -0.220978916f, 0.750249684f, 0.521839678f, 0.0190545674f,
+    0.77143681f, 0.372284681f, -0.220833451f, 0.750235677f, 0.522993028f, 0.0208765119f,
+    0.774032831f, 0.366774201f, -0.213077724f, 0.755934179f, 0.528160632f, 0.0228368863f,
+    0.776415765f, 0.360408783f, -0.204745293f, 0.760947466f, 0.532893002f, 0.0249407087f,
+    0.782610118f, 0.355959415f, -0.196264371f, 0.76786375f, 0.537122071f, 0.0271138269f,
+    0.789112926f, 0.350577354f, -0.186926022f, 0.77422291f, 0.540843964f, 0.0293253046f,
+    1.0f, 0.0f, 0.0f, 0.958980918f, 0.501396f, 4.02035257e-05f,
+    0.999400139f, 0.0163442437f, -0.0114754671f, 0.958807111f, 0.50135231f, 4.07643347e-05f,
+    0.998510301f, 0.0269798767f, -0.0187061243f, 0.958578825f, 0.501302063f, 4.19137723e-05f,
+    0.997423112f, 0.0376864672f, -0.0261246096f, 0.958245218f, 0.501263618f, 4.37892086e-05f,
+    0.996431887f, 0.0482128449f, -0.0333569907f, 0.957811952f, 0.501294434f, 4.64739205e-05f,
+    0.995625854f, 0.058704868f, -0.0406816676f, 0.957208812f, 0.501233757f, 4.97335168e-05f,
+    0.994540989f, 0.0690235794f, -0.0479892418f, 0.956315637f, 0.501104057f, 5.361699e-05f,
+    0.993174911f, 0.0792501122f, -0.0551202931f, 0.955294847f, 0.501110792f, 5.86968417e-05f,
+    0.992179215f, 0.0891458616f, -0.0620651357f, 0.954124808f, 0.501046062f, 6.4426451e-05f,
+    0.991302967f, 0.0989938453f, -0.0689675957f, 0.952668905f, 0.500853658f, 7.06701176e-05f,
+    0.9900437f, 0.108768292f, -0.0761329308f, 0.950989008f, 0.500759363f, 7.87071258e-05f,
+    0.988688469f, 0.118435115f, -0.0831257328f, 0.949366033f, 0.500718713f, 8.80551597e-05f,
+    0.98747927f, 0.127885357f, -0.0897316039f, 0.947676003f, 0.500929356f, 9.91748529e-05f,
+    0.985905945f, 0.137468219f, -0.0966302007f, 0.945433736f, 0.501026392f, 0.000112344715f,
+    0.984368265f, 0.146905065f, -0.103510246f, 0.942714214f, 0.500903964f, 0.000126640982f,
+    0.983243048f, 0.156258017f, -0.109726921f, 0.940085649f, 0.500883162f, 0.000142300123f,
+    0.981483996f, 0.165455282f, -0.115591422f, 0.937246323f, 0.500950992f, 0.000159996736f,
+    0.979012728f, 0.174901336f, -0.12172325f, 0.934274733f, 0.500915408f, 0.000180562376f,
+    0.976152718f, 0.184190556f, -0.128315002f, 0.930854201f, 0.500858724f, 0.000206206081f,
+    0.974085808f, 0.193407267f, -0.134776413f, 0.927292705f, 0.500542581f, 0.000233737141f,
+    0.971916735f, 0.202684253f, -0.140420511f, 0.923561096f, 0.500275373f, 0.000262704998f,
+    0.968995452f, 0.211389467f, -0.14581345f, 0.920706272f, 0.500282705f, 0.000296638376f,
+    0.966112971f, 0.220046833f, -0.151176766f, 0.917106628f, 0.500300169f, 0.00033472685f,
+    0.961914837f, 0.228576466f, -0.15677245f, 0.913048327f, 0.500233233f, 0.00037926223f,
+    0.959204257f, 0.236825854f, -0.162034497f, 0.910021961f, 0.50021863f, 0.000428208907f,
+    0.955545604f, 0.245134577f, -0.166416645f, 0.906074107f, 0.500507593f, 0.00048429778f,
+    0.951842666f, 0.252998739f, -0.171098813f, 0.902362168f, 0.500750959f, 0.000549217453f,
+    0.947726548f, 0.260751039f, -0.175939888f, 0.898676455f, 0.500821233f, 0.000622761203f,
+    0.943351805f, 0.268314064f, -0.180747002f, 0.894755244f, 0.500869334f, 0.000707055966f,
+    0.938026547f, 0.27525112f, -0.185443386f, 0.890301287f, 0.500710547f, 0.000800311973f,
+    0.934657931f, 0.282879084f, -0.189628258f, 0.885934234f, 0.500433505f, 0.000897878956f,
+    0.93048358f, 0.289858729f, -0.19317098f, 0.881756127f, 0.500552535f, 0.00100903143f,
+    0.926642358f, 0.296500564f, -0.196350336f, 0.878147483f, 0.500787437f, 0.00113093003f,
+    0.922639966f, 0.303067982f, -0.199589655f, 0.874194264f, 0.501058578f, 0.00127091818f,
+    0.916627944f, 0.308582634f, -0.202849418f, 0.869453371f, 0.501172006f, 0.00142873963f,
+    0.911308229f, 0.314177752f, -0.206160873f, 0.864897311f, 0.501134396f, 0.00160208123f,
+    0.905960739f, 0.319860101f, -0.209053293f, 0.8602404f, 0.501251101f, 0.00179389387f,
+    0.900101125f, 0.324217618f, -0.211279437f, 0.856102347f, 0.501821578f, 0.00202149898f,
+    0.895048797f, 0.328469962f, -0.213202462f, 0.852643788f, 0.502533495f, 0.00227763294f,
+    0.890010178f, 0.333294153f, -0.214644432f, 0.848944247f, 0.503188908f, 0.00254940218f,
+    0.884635508f, 0.337223858f, -0.21611236f, 0.844905138f, 0.50364238f, 0.00285146013f,
+    0.879248679f, 0.340452313f, -0.21746695f, 0.840646863f, 0.503819644f, 0.00317719928f,
+    0.87369138f, 0.344091862f, -0.218957037f, 0.836240828f, 0.50380826f, 0.0035418875f,
+    0.868724823f, 0.348337173f, -0.220417634f, 0.831516206f, 0.503597379f, 0.00393747445f,
+    0.862477958f, 0.351003557f, -0.221869722f, 0.827581167f, 0.504013181f, 0.0043855235f,
+    0.857358038f, 0.353396684f, -0.222660199f, 0.824144185f, 0.504957378f, 0.00489213876f,
+    0.850922704f, 0.35460037f, -0.222751632f, 0.820189774f, 0.506111383f, 0.00546015427f,
+    0.843389153f, 0.35390383f, -0.222165808f, 0.816880763f, 0.507677972f, 0.0060953428f,
+    0.836540878f, 0.353719026f, -0.221284881f, 0.813536406f, 0.508946955f, 0.0067664911f,
+    0.832204223f, 0.354353219f, -0.22047478f, 0.810538769f, 0.510071456f, 0.00747194234f,
+    0.827771604f, 0.355275661f, -0.220113039f, 0.807858467f, 0.511071861f, 0.00827246811f,
+    0.821832657f, 0.354759544f, -0.219560847f, 0.80440414f, 0.512007594f, 0.00917126704f,
+    0.816426814f, 0.353608519f, -0.218158036f, 0.801605761f, 0.513836443f, 0.0101644192f,
+    0.811003745f, 0.352481037f, -0.216977164f, 0.798850775f, 0.51541996f, 0.0112676602f,
+    0.805561423f, 0.350608379f, -0.215656221f, 0.79569751f, 0.516644239f, 0.0124578979f,
+    0.800570488f, 0.348617613f, -0.214214399f, 0.793246448f, 0.518042564f, 0.0137075856f,
+    0.79657191f, 0.346810132f, -0.21261479f, 0.790417612f, 0.519345522f, 0.0150634907f,
+    0.794192851f, 0.345937967f, -0.211023256f, 0.788007557f, 0.520875335f, 0.0165222306f,
+    0.793565392f, 0.345211834f, -0.210626155f, 0.786706388f, 0.523195803f, 0.0181355365f,
+    0.794451475f, 0.345567524f, -0.21056892f, 0.785619378f, 0.525289237f, 0.0198943801f,
+    0.795292854f, 0.340401232f, -0.203783929f, 0.789652288f, 0.530780494f, 0.0218102708f,
+    0.798604488f, 0.334479898f, -0.195446804f, 0.794862449f, 0.536576211f, 0.0238783024f,
+    0.807169616f, 0.331746012f, -0.187054694f, 0.802109957f, 0.541869044f, 0.0260342211f,
+    0.812139869f, 0.325791001f, -0.177670881f, 0.807868242f, 0.546643019f, 0.0282386206f,
+    1.0f, 0.0f, 0.0f, 0.97722286f, 0.482089907f, 4.00353783e-05f,
+    0.999491513f, 0.0149953254f, -0.0106822066f, 0.977099836f, 0.482064545f, 4.05876926e-05f,
+    0.998671472f, 0.0247939471f, -0.0173800904f, 0.977002978f, 0.482169449f, 4.1994921e-05f,
+    0.997667849f, 0.0345596075f, -0.0242248271f, 0.97669065f, 0.482108772f, 4.37013441e-05f,
+    0.996609986f, 0.0442262739f, -0.030899277f, 0.976175606f, 0.482007802f, 4.59005423e-05f,
+    0.995565772f, 0.0538426749f, -0.0376626141f, 0.975701749f, 0.482059032f, 4.9162707e-05f,
+    0.994689643f, 0.0633855611f, -0.0443308502f, 0.975075781f, 0.482128859f, 5.32187914e-05f,
+    0.993692279f, 0.0726611912f, -0.0509780683f, 0.974097431f, 0.482076764f, 5.77180654e-05f,
+    0.992488027f, 0.0821295828f, -0.0578221194f, 0.973156333f, 0.482114166f, 6.34962125e-05f,
+    0.991368949f, 0.0912188664f, -0.064291954f, 0.972124994f, 0.482290894f, 7.05456987e-05f,
+    0.990339577f, 0.100152358f, -0.0707240328f, 0.97086519f, 0.482349396f, 7.83076102e-05f,
+    0.989267111f, 0.10906063f, -0.0774181262f, 0.969320476f, 0.482376158f, 8.76781705e-05f,
+    0.988252103f, 0.117842123f, -0.0839186534f, 0.967681289f, 0.482362866f, 9.82168422e-05f,
+    0.986806154f, 0.126153648f, -0.0898841694f, 0.965606272f, 0.482324272f, 0.000109469693f,
+    0.985722065f, 0.134683117f, -0.0956390575f, 0.963508844f, 0.482424885f, 0.000122327852f,
+    0.983951271f, 0.143067285f, -0.101778075f, 0.961164951f, 0.482539743f, 0.000137793904f,
+    0.981871188f, 0.15168795f, -0.108241551f, 0.95852989f, 0.482657492f, 0.00015657529f,
+    0.980224788f, 0.160061404f, -0.11380928f, 0.95609498f, 0.482974738f, 0.000177666428f,
+    0.978320539f, 0.168164f, -0.118983023f, 0.953161657f, 0.483216196f, 0.000199953007f,
+    0.976731956f, 0.176366255f, -0.124348126f, 0.950368762f, 0.483288109f, 0.00022438365f,
+    0.974541306f, 0.184476584f, -0.130077884f, 0.947183311f, 0.483283073f, 0.00025322556f,
+    0.972111464f, 0.192964569f, -0.135688826f, 0.943576813f, 0.483212173f, 0.000285338407f,
+    0.969891191f, 0.200996161f, -0.140822589f, 0.940444887f, 0.483406186f, 0.000322642765f,
+    0.966479421f, 0.208672822f, -0.145817176f, 0.937301159f, 0.483659029f, 0.000365156535f,
+    0.963260233f, 0.216126993f, -0.150955498f, 0.934072196f, 0.483893633f, 0.000413324247f,
+    0.95976913f, 0.223592028f, -0.156007722f, 0.930535197f, 0.484154552f, 0.000467828097f,
+    0.955937207f, 0.230549693f, -0.160047516f, 0.926761329f, 0.484678417f, 0.000529457f,
+    0.953089714f, 0.237626493f, -0.164226487f, 0.923898935f, 0.485264122f, 0.000601162028f,
+    0.950172365f, 0.244786531f, -0.168166399f, 0.920242131f, 0.485614151f, 0.000677641365f,
+    0.947271526f, 0.25157994f, -0.172023714f, 0.916659772f, 0.485801488f, 0.000758482201f,
+    0.943047702f, 0.258294553f, -0.175955847f, 0.912744522f, 0.485966206f, 0.00084984547f,
+    0.939171433f, 0.264596105f, -0.180030331f, 0.908719957f, 0.486129016f, 0.000954998832f,
+    0.934756398f, 0.270611882f, -0.183742985f, 0.9050951f, 0.486511707f, 0.00107583951f,
+    0.931197107f, 0.276620746f, -0.186644197f, 0.90160954f, 0.487247318f, 0.00120843563f,
+    0.927560091f, 0.282346219f, -0.189445868f, 0.898169875f, 0.487956434f, 0.00135317596f,
+    0.922292948f, 0.287290066f, -0.192343637f, 0.894372225f, 0.48851642f, 0.00151442061f,
+    0.915571332f, 0.291468173f, -0.195535272f, 0.889279008f, 0.489023626f, 0.00170943222f,
+    0.910353124f, 0.296450943f, -0.198504657f, 0.885191619f, 0.489669859f, 0.001923793f,
+    0.906382799f, 0.300623f, -0.200167641f, 0.881860852f, 0.490601301f, 0.00215338846f,
+    0.902169287f, 0.304407328f, -0.201254442f, 0.8786093f, 0.491638809f, 0.00240610354f,
+    0.898167014f, 0.308468908f, -0.20235306f, 0.875718951f, 0.492771894f, 0.00268151308f,
+    0.893087626f, 0.311541915f, -0.203525871f, 0.872012436f, 0.493765622f, 0.00299250428f,
+    0.888962984f, 0.315000415f, -0.20487991f, 0.868617296f, 0.494524896f, 0.00333184516f,
+    0.883654594f, 0.318299532f, -0.206259474f, 0.864298224f, 0.495087236f, 0.00371319405f,
+    0.878326178f, 0.321427494f, -0.207925007f, 0.859876096f, 0.495498717f, 0.00414483901f,
+    0.873467267f, 0.323967129f, -0.209290624f, 0.856175065f, 0.496699095f, 0.00462887995f,
+    0.867719114f, 0.325361192f, -0.20955579f, 0.852632225f, 0.498399109f, 0.00517247198f,
+    0.861876607f, 0.325491756f, -0.209287599f, 0.849508405f, 0.500237465f, 0.00575847365f,
+    0.856383204f, 0.325240791f, -0.208257258f, 0.847199082f, 0.502357483f, 0.0063777389f,
+    0.852156222f, 0.326000273f, -0.20732443f, 0.844700277f, 0.504196405f, 0.00705447327f,
+    0.848229051f, 0.326416671f, -0.207011312f, 0.842332363f, 0.506117046f, 0.00782919675f,
+    0.843668997f, 0.326778114f, -0.206545621f, 0.839097381f, 0.507715881f, 0.00867216568f,
+    0.838445544f, 0.32573846f, -0.205522507f, 0.836469173f, 0.509903729f, 0.00962263159f,
+    0.833465636f, 0.324852884f, -0.2042588f, 0.833797038f, 0.512375891f, 0.010676912f,
+    0.82919693f, 0.323402107f, -0.20324029f, 0.831769943f, 0.51454252f, 0.011806136f,
+    0.824553072f, 0.321793675f, -0.201903298f, 0.829126775f, 0.516575813f, 0.0129994359f,
+    0.820466578f, 0.319977432f, -0.200494945f, 0.826191664f, 0.518863201f, 0.0143073425f,
+    0.817364156f, 0.31863296f, -0.199106291f, 0.82356286f, 0.521037698f, 0.0157140903f,
+    0.816057682f, 0.31787324f, -0.19865419f, 0.822052121f, 0.524157822f, 0.0172640439f,
+    0.817111671f, 0.318041831f, -0.198978156f, 0.82107234f, 0.527241349f, 0.0189674776f,
+    0.819026709f, 0.314549237f, -0.193570673f, 0.824150324f, 0.533017993f, 0.0208356977f,
+    0.82029593f, 0.307693481f, -0.185059533f, 0.828831017f, 0.539865375f, 0.0228670146f,
+    0.828619719f, 0.305019647f, -0.176587209f, 0.835569739f, 0.546212316f, 0.0250050575f,
+    0.834226012f, 0.299990714f, -0.167283595f, 0.841069221f, 0.552030861f, 0.0271986425f,
+    1.0f, 0.0f, 0.0f, 0.994765878f, 0.463201672f, 3.98197371e-05f,
+    0.999573946f, 0.0136218425f, -0.00981396344f, 0.994652629f, 0.463153183f, 4.0274801e-05f,
+    0.998834252f, 0.0224935431f, -0.0160011221f, 0.99449712f, 0.463120043f, 4.13179187e-05f,
+    0.997893333f, 0.0314387828f, -0.0223330501f, 0.994281292f, 0.463222772f, 4.32589368e-05f,
+    0.996989727f, 0.0402762778f, -0.0285115317f, 0.994121313f, 0.463435918f, 4.60729207e-05f,
+    0.995905399f, 0.0490037389f, -0.0346552841f, 0.993542433f, 0.463422298f, 4.89812846e-05f,
+    0.994858623f, 0.0576925874f, -0.0409856141f, 0.992996752f, 0.463478416f, 5.28347045e-05f,
+    0.993934989f, 0.0662805513f, -0.0471850745f, 0.992454827f, 0.463707745f, 5.79388798e-05f,
+    0.992955148f, 0.0747664794f, -0.0531238392f, 0.99152863f, 0.463829309f, 6.34146563e-05f,
+    0.991806269f, 0.0831497461f, -0.0592918247f, 0.990537107f, 0.463905901f, 6.99158118e-05f,
+    0.99047488f, 0.0913710073f, -0.0652966797f, 0.989292681f, 0.464022398f, 7.76098314e-05f,
+    0.989599824f, 0.0992454514f, -0.0707897395f, 0.988165498f, 0.464154154f, 8.58806452e-05f,
+    0.988636553f, 0.107268699f, -0.0763965845f, 0.986775219f, 0.464235514f, 9.516297e-05f,
+    0.987508416f, 0.115116403f, -0.0824112967f, 0.985240042f, 0.46436438f, 0.000106628853f,
+    0.985912859f, 0.122790776f, -0.0883164555f, 0.983460009f, 0.464520812f, 0.000119787663f,
+    0.98407954f, 0.130486459f, -0.0938967764f, 0.981597722f, 0.464830905f, 0.000135562092f,
+    0.982905209f, 0.137907967f, -0.0991715118f, 0.97952795f, 0.465021014f, 0.000152144014f,
+    0.98189348f, 0.145043299f, -0.104399547f, 0.97704494f, 0.465102434f, 0.000169805047f,
+    0.980260611f, 0.152565345f, -0.109632231f, 0.974643588f, 0.465406984f, 0.000191377781f,
+    0.97882992f, 0.15973042f, -0.114358254f, 0.972324133f, 0.465866953f, 0.00021557766f,
+    0.976697147f, 0.167090073f, -0.119195729f, 0.969753563f, 0.466344595f, 0.000243446862f,
+    0.974371731f, 0.174052745f, -0.124349385f, 0.967051864f, 0.466699988f, 0.000275356957f,
+    0.972502291f, 0.181643784f, -0.129670292f, 0.963829815f, 0.466921538f, 0.000311078387f,
+    0.970393181f, 0.188711733f, -0.134541675f, 0.960560858f, 0.467260301f, 0.00035136033f,
+    0.968009889f, 0.195367768f, -0.138905749f, 0.957751811f, 0.467810005f, 0.000396994146f,
+    0.964406133f, 0.202073187f, -0.1433824f, 0.954306483f, 0.4682872f, 0.000449489162f,
+    0.960539162f, 0.208453044f, -0.147982463f, 0.950841427f, 0.468675315f, 0.00050848024f,
+    0.958241403f, 0.214792177f, -0.151454598f, 0.947601199f, 0.469312936f, 0.000569955911f,
+    0.955980837f, 0.221108139f, -0.154474109f, 0.944941401f, 0.470076263f, 0.000637582154f,
+    0.953327477f, 0.227224007f, -0.157809272f, 0.941842675f, 0.470829159f, 0.000715301197f,
+    0.949702501f, 0.233117715f, -0.161653787f, 0.938687623f, 0.471532375f, 0.000807106378f,
+    0.946657479f, 0.238894179f, -0.165419132f, 0.935449481f, 0.472155005f, 0.000907386362f,
+    0.943392813f, 0.244710892f, -0.169178873f, 0.931792796f, 0.47269994f, 0.00101747434f,
+    0.940360665f, 0.250539482f, -0.172457248f, 0.92830199f, 0.473375171f, 0.00113863254f,
+    0.936620057f, 0.255114019f, -0.174992248f, 0.925488889f, 0.474449486f, 0.00127650145f,
+    0.931267321f, 0.259477407f, -0.177850753f, 0.922098279f, 0.475745678f, 0.00144216849f,
+    0.92518121f, 0.263208181f, -0.180699289f, 0.918367863f, 0.476919949f, 0.00162614649f,
+    0.921287417f, 0.267926157f, -0.183415174f, 0.914501965f, 0.477794349f, 0.00181986485f,
+    0.917541504f, 0.272074699f, -0.185975268f, 0.911002576f, 0.478803247f, 0.00203375053f,
+    0.914300084f, 0.276050359f, -0.18727763f, 0.908246517f, 0.480284184f, 0.00227081054f,
+    0.910811424f, 0.27963981f, -0.188109949f, 0.905576706f, 0.48184672f, 0.00253583235f,
+    0.906418145f, 0.282206744f, -0.188873366f, 0.902844131f, 0.483501971f, 0.00282325177f,
+    0.902511179f, 0.285100639f, -0.190012738f, 0.900199175f, 0.485049814f, 0.00314759184f,
+    0.89765656f, 0.287818909f, -0.191294f, 0.896524251f, 0.486416221f, 0.0035150866f,
+    0.892782331f, 0.290489584f, -0.192728475f, 0.892525077f, 0.487550706f, 0.00392570114f,
+    0.888074815f, 0.293354869f, -0.194286674f, 0.888249159f, 0.488531649f, 0.0043865121f,
+    0.883906186f, 0.295383632f, -0.195522785f, 0.885344803f, 0.490459204f, 0.00489598187f,
+    0.87847358f, 0.29551518f, -0.194955915f, 0.882353425f, 0.492838115f, 0.00543535454f,
+    0.873865366f, 0.295638144f, -0.193977311f, 0.880001307f, 0.49543792f, 0.00601062318f,
+    0.8694399f, 0.295547515f, -0.193111956f, 0.87793237f, 0.498223722f, 0.00667578587f,
+    0.866242766f, 0.296125591f, -0.192533001f, 0.876098096f, 0.500803947f, 0.00740600331f,
+    0.861795306f, 0.29627642f, -0.192065045f, 0.872993886f, 0.503300309f, 0.00821741857f,
+    0.857220709f, 0.296258003f, -0.191582426f, 0.870101631f, 0.505712032f, 0.00912575889f,
+    0.853690743f, 0.2952905f, -0.190232322f, 0.868110538f, 0.509013891f, 0.0101151802f,
+    0.849538684f, 0.293843538f, -0.189195767f, 0.866704166f, 0.512049377f, 0.0111776339f,
+    0.845849335f, 0.292660356f, -0.188080817f, 0.863978982f, 0.514767408f, 0.0123329237f,
+    0.842342615f, 0.291390151f, -0.187031597f, 0.861594141f, 0.517999828f, 0.0135949822f,
+    0.839101315f, 0.290285021f, -0.185904086f, 0.858778954f, 0.520839989f, 0.0149589023f,
+    0.838089883f, 0.289373726f, -0.185519457f, 0.857748032f, 0.52473402f, 0.0164416656f,
+    0.83786267f, 0.288803518f, -0.186073974f, 0.856130779f, 0.528799236f, 0.0180898439f,
+    0.839456379f, 0.286322713f, -0.182089195f, 0.857907474f, 0.534875512f, 0.0199101791f,
+    0.842061222f, 0.28089124f, -0.173589274f, 0.862756491f, 0.542763531f, 0.0219047926f,
+    0.8477754f, 0.276712358f, -0.164870098f, 0.867889404f, 0.550155163f, 0.0240235236f,
+    0.853005886f, 0.271555036f, -0.15551123f, 0.872122645f, 0.557010949f, 0.0262035877f,
+    1.0f, 0.0f, 0.0f, 1.01166332f, 0.444708407f, 3.94388335e-05f,
+    0.999616563f, 0.0122762332f, -0.00903788395f, 1.0115819f, 0.444723785f, 3.99955825e-05f,
+    0.998987913f, 0.020294765f, -0.01470605f, 1.01152897f, 0.444835633f, 4.13222697e-05f,
+    0.998232305f, 0.0282387864f, -0.0202746261f, 1.01131606f, 0.444799751f, 4.2846732e-05f,
+    0.997208178f, 0.0362558626f, -0.0260727871f, 1.01095402f, 0.444855005f, 4.5214194e-05f,
+    0.996304512f, 0.0441126935f, -0.0316868648f, 1.01073492f, 0.445052117f, 4.8525133e-05f,
+    0.995351791f, 0.0518454351f, -0.037073236f, 1.01023757f, 0.445170075f, 5.21982365e-05f,
+    0.994246364f, 0.0595617034f, -0.0426751748f, 1.00951445f, 0.445218563f, 5.64709371e-05f,
+    0.993149519f, 0.0672594383f, -0.048416622f, 1.00890052f, 0.44540289f, 6.20642386e-05f,
+    0.992231309f, 0.0746541321f, -0.0535395816f, 1.00809824f, 0.445613503f, 6.8141213e-05f,
+    0.991085052f, 0.0819357112f, -0.0586986579f, 1.00704575f, 0.445763975f, 7.47764425e-05f,
+    0.990029395f, 0.0894205198f, -0.064270407f, 1.00610483f, 0.446028739f, 8.32376609e-05f,
+    0.988710821f, 0.096557565f, -0.0692661107f, 1.00498474f, 0.446378708f, 9.26982757e-05f,
+    0.987295926f, 0.103707537f, -0.0746218562f, 1.00375926f, 0.446732223f, 0.000104210936f,
+    0.986472964f, 0.110785052f, -0.0799074918f, 1.00251687f, 0.447051823f, 0.000117003503f,
+    0.985671341f, 0.117300779f, -0.0849377364f, 1.0009582f, 0.447257608f, 0.000130322805f,
+    0.984197378f, 0.123932637f, -0.0897769183f, 0.999271095f, 0.447635621f, 0.000145888131f,
+    0.98250246f, 0.130584314f, -0.0947020575f, 0.997422397f, 0.448128343f, 0.000164629149f,
+    0.981382668f, 0.137010604f, -0.0995485559f, 0.995571852f, 0.448543668f, 0.000184785764f,
+    0.979647756f, 0.143694744f, -0.104745686f, 0.993377745f, 0.448994726f, 0.0002089794f,
+    0.978222847f, 0.1500099f, -0.109010369f, 0.991369545f, 0.449691087f, 0.000236125692f,
+    0.976649046f, 0.155999154f, -0.113160349f, 0.989381969f, 0.450364679f, 0.00026585735f,
+    0.974774063f, 0.162175432f, -0.117456496f, 0.986932397f, 0.450989157f, 0.000299580628f,
+    0.973157585f, 0.168284431f, -0.121958964f, 0.984291673f, 0.451466441f, 0.000336877711f,
+    0.970704734f, 0.174785137f, -0.126634508f, 0.981010675f, 0.451987982f, 0.000381520949f,
+    0.968869328f, 0.180498838f, -0.130437762f, 0.978443742f, 0.452661306f, 0.000429292239f,
+    0.966588557f, 0.186251521f, -0.13375856f, 0.975524485f, 0.453330219f, 0.000479122624f,
+    0.963983059f, 0.191909671f, -0.13750802f, 0.972293317f, 0.45391041f, 0.000536680222f,
+    0.961485445f, 0.197381437f, -0.141255155f, 0.969294369f, 0.454725057f, 0.000604414963f,
+    0.958312929f, 0.202533022f, -0.143987745f, 0.966936052f, 0.455987573f, 0.000680656696f,
+    0.955912828f, 0.207926899f, -0.146923065f, 0.964295268f, 0.457140148f, 0.000764989352f,
+    0.95295465f, 0.212955162f, -0.150063112f, 0.961573184f, 0.458228618f, 0.000857917359f,
+    0.950540721f, 0.218099117f, -0.15336521f, 0.958940983f, 0.459197074f, 0.000959570985f,
+    0.94704318f, 0.222885564f, -0.156788051f, 0.955166936f, 0.460142225f, 0.00107585278f,
+    0.942710757f, 0.227683067f, -0.16034466f, 0.951518357f, 0.461372912f, 0.0012191718f,
+    0.940085173f, 0.231923729f, -0.162867725f, 0.949486911f, 0.462938339f, 0.00137534935f,
+    0.935818195f, 0.235708043f, -0.164979443f, 0.946421385f, 0.464499563f, 0.00153972534f,
+    0.932385325f, 0.239265114f, -0.167202741f, 0.943207324f, 0.466069818f, 0.00172155979f,
+    0.929331958f, 0.243640289f, -0.169731021f, 0.939973235f, 0.467449486f, 0.00192361779f,
+    0.925683737f, 0.246995881f, -0.17210269f, 0.937162876f, 0.468956202f, 0.0021475025f,
+    0.923306584f, 0.25026679f, -0.172908425f, 0.934782922f, 0.470974565f, 0.0023910345f,
+    0.91933471f, 0.252872974f, -0.173482463f, 0.932600379f, 0.473078161f, 0.00266746408f,
+    0.915336251f, 0.254853666f, -0.17421636f, 0.930340886f, 0.475323081f, 0.0029796618f,
+    0.910564363f, 0.256873488f, -0.175212502f, 0.92762357f, 0.477423221f, 0.00332980137f,
+    0.906916499f, 0.259429187f, -0.176472023f, 0.924675763f, 0.479308158f, 0.00371882878f,
+    0.902714789f, 0.261691213f, -0.177968115f, 0.921136439f, 0.480977684f, 0.00415815366f,
+    0.899337709f, 0.26426059f, -0.179167166f, 0.917541444f, 0.482633203f, 0.00462593464f,
+    0.894920766f, 0.265107065f, -0.179286033f, 0.914677382f, 0.48534286f, 0.00512126461f,
+    0.889996409f, 0.265095085f, -0.178748548f, 0.912235498f, 0.488299012f, 0.00567697315f,
+    0.886407733f, 0.265224755f, -0.177642331f, 0.910613239f, 0.491870672f, 0.00630896585f,
+    0.883043706f, 0.265455991f, -0.176808298f, 0.908766806f, 0.495235234f, 0.00700677466f,
+    0.879570544f, 0.265386939f, -0.176467493f, 0.906682968f, 0.498551339f, 0.00779235782f,
+    0.8759166f, 0.265667766f, -0.176205248f, 0.903847516f, 0.50160253f, 0.00865093339f,
+    0.87277329f, 0.26502347f, -0.175012857f, 0.902097702f, 0.505308747f, 0.00958311837f,
+    0.86935693f, 0.263770282f, -0.173795596f, 0.900951684f, 0.509192467f, 0.0105783949f,
+    0.866582692f, 0.263194293f, -0.173058286f, 0.899092734f, 0.512864292f, 0.0117007028f,
+    0.864105165f, 0.262288839f, -0.172341362f, 0.897066057f, 0.516752958f, 0.0129189985f,
+    0.861205459f, 0.261271834f, -0.17158936f, 0.894560516f, 0.520563424f, 0.0142428651f,
+    0.858710766f, 0.260047704f, -0.170993179f, 0.89248693f, 0.524933219f, 0.0156686082f,
+    0.859340191f, 0.260052532f, -0.171940148f, 0.890919983f, 0.529967308f, 0.0172599144f,
+    0.859184206f, 0.257691681f, -0.169503063f, 0.891367018f, 0.536358774f, 0.0190318879f,
+    0.860768676f, 0.251726121f, -0.160795078f, 0.895156085f, 0.545276165f, 0.0209883507f,
+    0.867393136f, 0.248291448f, -0.152186275f, 0.900192916f, 0.553702652f, 0.0230870545f,
+    0.872624218f, 0.243625641f, -0.143013731f, 0.904244483f, 0.561588168f, 0.0252516735f,
+    1.0f, 0.0f, 0.0f, 1.02788675f, 0.426696718f, 3.90363493e-05f,
+    0.999759078f, 0.0108115906f, -0.00806474686f, 1.027789f, 0.426681459f, 3.94814961e-05f,
+    0.999228656f, 0.0179210883f, -0.0131076286f, 1.02773297f, 0.426743031f, 4.05947321e-05f,
+    0.998495042f, 0.0249913447f, -0.0182308033f, 1.02760494f, 0.426822156f, 4.22862176e-05f,
+    0.997692168f, 0.031911362f, -0.0230256505f, 1.027408f, 0.426956147f, 4.45603073e-05f,
+    0.996722579f, 0.0388995223f, -0.0280788206f, 1.0270294f, 0.426971853f, 4.71843668e-05f,
+    0.995670974f, 0.0458710752f, -0.0332860835f, 1.02651644f, 0.427101225f, 5.07979094e-05f,
+    0.994758487f, 0.052572038f, -0.037813548f, 1.02603436f, 0.427319139f, 5.4986187e-05f,
+    0.993853271f, 0.059296824f, -0.0425956883f, 1.0254885f, 0.427495092f, 5.97712096e-05f,
+    0.992630839f, 0.0661519468f, -0.0479203798f, 1.02484417f, 0.427732289f, 6.59021971e-05f,
+    0.991679609f, 0.0727294981f, -0.0527492575f, 1.0241884f, 0.428093761f, 7.29381572e-05f,
+    0.990538597f, 0.0791899487f, -0.0573473573f, 1.023422f, 0.428529143f, 8.10338606e-05f,
+    0.989430606f, 0.0859144852f, -0.0624552257f, 1.02250469f, 0.428932548f, 9.08332731e-05f,
+    0.988425314f, 0.0921111777f, -0.0668646619f, 1.02147281f, 0.429351926f, 0.000101043042f,
+    0.98751235f, 0.0980688035f, -0.0709410086f, 1.02060592f, 0.429857433f, 0.000112376489f,
+    0.986215472f, 0.104065269f, -0.0757882223f, 1.01931798f, 0.430390388f, 0.000126735787f,
+    0.985199511f, 0.110544294f, -0.0804384425f, 1.01804852f, 0.430817783f, 0.000141725453f,
+    0.983439565f, 0.116330326f, -0.0851743892f, 1.01645708f, 0.43137306f, 0.000159583753f,
+    0.981955588f, 0.121979624f, -0.0894001499f, 1.01522887f, 0.432156652f, 0.000180310948f,
+    0.980730534f, 0.127659082f, -0.093683742f, 1.01357615f, 0.432791561f, 0.000202797193f,
+    0.979546785f, 0.133162454f, -0.0979609713f, 1.01152861f, 0.433391273f, 0.000227479701f,
+    0.978569031f, 0.13865982f, -0.101854824f, 1.00994706f, 0.434137553f, 0.000255318097f,
+    0.97639811f, 0.14361462f, -0.10540016f, 1.00818121f, 0.435081959f, 0.000287764386f,
+    0.974916518f, 0.149065942f, -0.109156683f, 1.00620008f, 0.436032563f, 0.000325394503f,
+    0.974168837f, 0.154103622f, -0.112860508f, 1.00434601f, 0.436800092f, 0.000364412961f,
+    0.973029733f, 0.159097284f, -0.116574392f, 1.00144935f, 0.437399298f, 0.000405482482f,
+    0.970680237f, 0.164215162f, -0.120233178f, 0.99944675f, 0.438360453f, 0.000456495414f,
+    0.968280673f, 0.16915755f, -0.123466372f, 0.997455537f, 0.439455211f, 0.000512648898f,
+    0.966043174f, 0.17372255f, -0.126772389f, 0.994762301f, 0.440471679f, 0.000575233833f,
+    0.963917732f, 0.178868577f, -0.130183935f, 0.99177289f, 0.441457361f, 0.000645844033f,
+    0.962057889f, 0.183168665f, -0.132216722f, 0.989613354f, 0.442898154f, 0.000722978031f,
+    0.959835589f, 0.187213823f, -0.134423047f, 0.987419724f, 0.444349229f, 0.000808861165f,
+    0.956978023f, 0.191548645f, -0.137267217f, 0.98506695f, 0.445827246f, 0.000909869676f,
+    0.953311741f, 0.195870057f, -0.140707597f, 0.981902719f, 0.447353303f, 0.00103252451f,
+    0.950735629f, 0.200093582f, -0.144071937f, 0.979540467f, 0.448785305f, 0.00116297102f,
+    0.949429572f, 0.204370692f, -0.146913126f, 0.977102458f, 0.450219065f, 0.00129993691f,
+    0.94500041f, 0.207317829f, -0.148495123f, 0.974007726f, 0.452079147f, 0.00145474577f,
+    0.94158107f, 0.210609362f, -0.150338918f, 0.971799254f, 0.454028279f, 0.00162542704f,
+    0.938848734f, 0.213779137f, -0.152277261f, 0.968942761f, 0.456087083f, 0.00181481475f,
+    0.936151922f, 0.217515543f, -0.15447548f, 0.965802073f, 0.457940906f, 0.00202188874f,
+    0.933380842f, 0.220580727f, -0.156580105f, 0.963068426f, 0.460030109f, 0.00225949613f,
+    0.931087792f, 0.223082498f, -0.157265261f, 0.961592734f, 0.462692022f, 0.00252366788f,
+    0.927236915f, 0.224694178f, -0.157735646f, 0.960015535f, 0.465351999f, 0.00282046129f,
+    0.923505783f, 0.2263356f, -0.15813531f, 0.957538009f, 0.468131125f, 0.00315069547f,
+    0.92031306f, 0.228627428f, -0.159157455f, 0.95518142f, 0.470789045f, 0.0035295214f,
+    0.917222321f, 0.230667561f, -0.160174593f, 0.952299356f, 0.473135799f, 0.00393367885f,
+    0.915075302f, 0.233005479f, -0.161288425f, 0.949322164f, 0.475203961f, 0.00435793912f,
+    0.910616875f, 0.234044522f, -0.161993369f, 0.946277976f, 0.477705836f, 0.00482214754f,
+    0.906178296f, 0.234191984f, -0.161957428f, 0.944300354f, 0.481359273f, 0.00536740478f,
+    0.902432144f, 0.23445867f, -0.161067799f, 0.942063749f, 0.485216051f, 0.00596362818f,
+    0.899638772f, 0.234409511f, -0.160153747f, 0.941084385f, 0.489436299f, 0.0066385651f,
+    0.896743238f, 0.234640718f, -0.159605175f, 0.939446211f, 0.493445337f, 0.00738972193f,
+    0.894172072f, 0.234636009f, -0.159324393f, 0.937218964f, 0.497359097f, 0.0082009472f,
+    0.891940653f, 0.234480545f, -0.158426836f, 0.934863269f, 0.50126034f, 0.00906836055f,
+    0.888543725f, 0.233474731f, -0.157283664f, 0.934282064f, 0.506047964f, 0.0100222509f,
+    0.886299133f, 0.232531592f, -0.156638935f, 0.933066666f, 0.510587096f, 0.0110994717f,
+    0.883578479f, 0.231966943f, -0.156116024f, 0.930519342f, 0.515133679f, 0.012280426f,
+    0.88093096f, 0.231102347f, -0.155621201f, 0.927810431f, 0.519900143f, 0.0135602616f,
+    0.879285038f, 0.230186149f, -0.155470908f, 0.926649511f, 0.524894774f, 0.0149444547f,
+    0.879088283f, 0.230497941f, -0.156554073f, 0.924684227f, 0.530769646f, 0.0164815187f,
+    0.879979968f, 0.229379863f, -0.155844867f, 0.924499452f, 0.537472069f, 0.0181964617f,
+    0.88087678f, 0.223262265f, -0.147113994f, 0.927991867f, 0.547409356f, 0.0201171078f,
+    0.8856107f, 0.219145998f, -0.138462201f, 0.931846976f, 0.55685997f, 0.0221936274f,
+    0.890191495f, 0.215013862f, -0.129388526f, 0.934864461f, 0.565767109f, 0.0243411046f,
+    1.0f, 0.0f, 0.0f, 1.04335797f, 0.409130841f, 3.84631821e-05f,
+    0.999744296f, 0.00949142501f, -0.00733604748f, 1.04334629f, 0.409160227f, 3.89933339e-05f,
+    0.99945271f, 0.0155834137f, -0.0115805147f, 1.04338658f, 0.40930301f, 4.02055521e-05f,
+    0.998888254f, 0.0216169562f, -0.0158707555f, 1.04323578f, 0.409368873f, 4.16851217e-05f,
+    0.998143137f, 0.0276630912f, -0.0202688351f, 1.043028f, 0.409472883f, 4.3745571e-05f,
+    0.997285604f, 0.0337322131f, -0.0246590171f, 1.04283333f, 0.409760743f, 4.67945683e-05f,
+    0.996451855f, 0.039682731f, -0.0287644248f, 1.04256535f, 0.409986347f, 5.0103492e-05f,
+    0.995546877f, 0.0457601883f, -0.0334025286f, 1.04226077f, 0.410191953f, 5.42121961e-05f,
+    0.99460572f, 0.0516591556f, -0.0377602577f, 1.04181111f, 0.410484672f, 5.91523349e-05f,
+    0.993627191f, 0.0573551245f, -0.0417878814f, 1.04133725f, 0.410888761f, 6.49130816e-05f,
+    0.992487609f, 0.0633649379f, -0.0463618971f, 1.04063749f, 0.411233008f, 7.18476149e-05f,
+    0.99155283f, 0.0692983717f, -0.0510618798f, 1.03982627f, 0.411452979f, 7.947228e-05f,
+    0.990423143f, 0.0746522248f, -0.0547511317f, 1.03917801f, 0.411979526f, 8.79830914e-05f,
+    0.989336073f, 0.0803205967f, -0.0588585883f, 1.03838718f, 0.412588477f, 9.83665523e-05f,
+    0.98820883f, 0.0858110711f, -0.0630538762f, 1.0375042f, 0.41310811f, 0.00010978205f,
+    0.987128258f, 0.0909204558f, -0.0665325224f, 1.0367496f, 0.413828373f, 0.000122504542f,
+    0.985827029f, 0.0962996036f, -0.0704213008f, 1.03565645f, 0.414595485f, 0.000138032701f,
+    0.984811187f, 0.10142085f, -0.0745525286f, 1.03463697f, 0.415196687f, 0.00015498545f,
+    0.983565569f, 0.106620379f, -0.0784485489f, 1.03319848f, 0.415758401f, 0.000172971355f,
+    0.981948614f, 0.111425065f, -0.0821616948f, 1.03194737f, 0.416553587f, 0.000194119639f,
+    0.98044157f, 0.116167359f, -0.0855499953f, 1.03066778f, 0.417497903f, 0.000217743887f,
+    0.979105413f, 0.120936863f, -0.0895517096f, 1.0290699f, 0.418392509f, 0.000246037758f,
+    0.978172243f, 0.125672534f, -0.0932706147f, 1.02774465f, 0.419276536f, 0.000276327773f,
+    0.977097988f, 0.12995486f, -0.095722504f, 1.02630544f, 0.420410335f, 0.000307868206f,
+    0.976096332f, 0.13438724f, -0.0986704305f, 1.0251838f, 0.421581328f, 0.000344618165f,
+    0.974723756f, 0.138531983f, -0.101934411f, 1.02375996f, 0.422762424f, 0.000387254462f,
+    0.973874569f, 0.142804772f, -0.10551358f, 1.0218873f, 0.423790157f, 0.000434383954f,
+    0.971645772f, 0.14710407f, -0.109009042f, 1.02014506f, 0.424965769f, 0.000488376361f,
+    0.969739735f, 0.151070952f, -0.111753568f, 1.01840508f, 0.426354378f, 0.000547901262f,
+    0.968159616f, 0.154756412f, -0.114526071f, 1.01649845f, 0.4277668f, 0.000613378477f,
+    0.966733575f, 0.159095824f, -0.117759146f, 1.01412141f, 0.429113984f, 0.000687893946f,
+    0.964273214f, 0.162685618f, -0.119811095f, 1.01236224f, 0.430950969f, 0.000775478489f,
+    0.961624563f, 0.166204363f, -0.122013003f, 1.01085782f, 0.432920754f, 0.000878356339f,
+    0.959480762f, 0.169392973f, -0.124192543f, 1.00871527f, 0.434679866f, 0.000986911589f,
+    0.958632171f, 0.17299594f, -0.126480132f, 1.0063895f, 0.436357677f, 0.0011009234f,
+    0.957219243f, 0.176585153f, -0.129204988f, 1.00417054f, 0.438094944f, 0.00123161788f,
+    0.954441488f, 0.179837331f, -0.131523639f, 1.00111377f, 0.439895719f, 0.00137276342f,
+    0.950924098f, 0.182068646f, -0.13258183f, 0.998892665f, 0.442141354f, 0.00152938766f,
+    0.947784126f, 0.18481192f, -0.133845165f, 0.996275067f, 0.444425851f, 0.00170350063f,
+    0.945207953f, 0.187649846f, -0.135650054f, 0.993524015f, 0.446973026f, 0.00190606725f,
+    0.943176568f, 0.190530717f, -0.137964636f, 0.99125582f, 0.449372739f, 0.00212934148f,
+    0.94111681f, 0.193182766f, -0.139794886f, 0.989145041f, 0.452079386f, 0.00238311337f,
+    0.938147366f, 0.194554254f, -0.140200987f, 0.988548636f, 0.45536533f, 0.00266660447f,
+    0.93471539f, 0.195909187f, -0.14056927f, 0.987048149f, 0.458639801f, 0.00299050682f,
+    0.932574511f, 0.197374284f, -0.140844211f, 0.985242248f, 0.461913824f, 0.00333914929f,
+    0.931129575f, 0.199303105f, -0.141329557f, 0.983162582f, 0.464965284f, 0.00370571739f,
+    0.929737151f, 0.201400369f, -0.142072096f, 0.980900884f, 0.467743933f, 0.00409731921f,
+    0.924371898f, 0.202362031f, -0.143438011f, 0.977523863f, 0.470417351f, 0.00455719326f,
+    0.920225263f, 0.202676475f, -0.144030124f, 0.975524664f, 0.474062592f, 0.00506577129f,
+    0.917021453f, 0.203016579f, -0.143584117f, 0.973625124f, 0.478478491f, 0.00564288395f,
+    0.914705396f, 0.203105882f, -0.142411187f, 0.972293317f, 0.483316869f, 0.00628740387f,
+    0.913040221f, 0.202941328f, -0.141591609f, 0.971435249f, 0.488078058f, 0.00699715363f,
+    0.911287367f, 0.203231171f, -0.141195983f, 0.969729662f, 0.49275285f, 0.00776829384f,
+    0.909655035f, 0.203633904f, -0.141047314f, 0.967950463f, 0.497160733f, 0.0085863322f,
+    0.906590223f, 0.202072576f, -0.139727503f, 0.967275441f, 0.502562404f, 0.00950505771f,
+    0.90428865f, 0.201538384f, -0.138922319f, 0.965854406f, 0.507947266f, 0.0105241872f,
+    0.902448416f, 0.201386273f, -0.138816878f, 0.964096546f, 0.513147295f, 0.0116731972f,
+    0.900582194f, 0.200733036f, -0.138819575f, 0.962657988f, 0.518861055f, 0.0129131563f,
+    0.898662686f, 0.199981064f, -0.138869017f, 0.960426748f, 0.524522543f, 0.0142584397f,
+    0.89826709f, 0.199742034f, -0.140126854f, 0.958523929f, 0.531197429f, 0.0157462768f,
+    0.898335695f, 0.199476644f, -0.141140908f, 0.957089782f, 0.538225234f, 0.0174050927f,
+    0.899673164f, 0.194187641f, -0.13237299f, 0.960044384f, 0.549168825f, 0.0192898046f,
+    0.902460814f, 0.189532012f, -0.123767473f, 0.962950826f, 0.559632778f, 0.021341376f,
+    0.905247092f, 0.184987292f, -0.114892311f, 0.965265334f, 0.569553077f, 0.0234701429f,
+    1.0f, 0.0f, 0.0f, 1.05824924f, 0.392087072f, 3.78707227e-05f,
+    0.999842107f, 0.00799902249f, -0.00623657368f, 1.05826819f, 0.392131388f, 3.83677143e-05f,
+    0.9995116f, 0.0132491561f, -0.0101339417f, 1.05811501f, 0.392156363f, 3.92696456e-05f,
+    0.999100387f, 0.0185488872f, -0.0141939428f, 1.05813134f, 0.392360121f, 4.10863322e-05f,
+    0.998503923f, 0.0235107113f, -0.0175455865f, 1.05804503f, 0.392623812f, 4.33304631e-05f,
+    0.99786222f, 0.0286451504f, -0.021333266f, 1.05790305f, 0.392823011f, 4.59742914e-05f,
+    0.997024953f, 0.0339045525f, -0.0252823979f, 1.05764163f, 0.393083721f, 4.93799198e-05f,
+    0.996259987f, 0.0388362445f, -0.028632788f, 1.05748081f, 0.393529058f, 5.35409818e-05f,
+    0.995407045f, 0.0437963381f, -0.0323279873f, 1.05720806f, 0.393910021f, 5.82993125e-05f,
+    0.994520009f, 0.048974935f, -0.0363866165f, 1.05683601f, 0.394258052f, 6.39793579e-05f,
+    0.993662775f, 0.0537308604f, -0.0395439602f, 1.05633152f, 0.394744486f, 7.02086618e-05f,
+    0.992873192f, 0.058524888f, -0.0429289974f, 1.05586743f, 0.395220429f, 7.72993735e-05f,
+    0.991632521f, 0.0635066926f, -0.046893239f, 1.05525875f, 0.395640731f, 8.57393534e-05f,
+    0.990583777f, 0.0682078823f, -0.0506794117f, 1.05433559f, 0.396066606f, 9.49590467e-05f,
+    0.989452422f, 0.0729449987f, -0.053967867f, 1.05378485f, 0.39681831f, 0.000106115469f,
+    0.988428533f, 0.0775250867f, -0.0575767905f, 1.05298984f, 0.397555083f, 0.000118983233f,
+    0.987484932f, 0.0820931718f, -0.0607571527f, 1.05237901f, 0.398369133f, 0.000133043126f,
+    0.98667562f, 0.0863169059f, -0.0634954572f, 1.05183983f, 0.399296284f, 0.000148568462f,
+    0.985455692f, 0.0906838253f, -0.0666866526f, 1.05090857f, 0.40019995f, 0.000166401514f,
+    0.983917654f, 0.0950339213f, -0.0703225732f, 1.04975414f, 0.401007354f, 0.000186560981f,
+    0.982393205f, 0.0992317125f, -0.0738315955f, 1.04867864f, 0.401947945f, 0.000210074839f,
+    0.981225014f, 0.103182301f, -0.0765193105f, 1.04766583f, 0.403053552f, 0.000235176456f,
+    0.980427265f, 0.107288726f, -0.0792363808f, 1.0463773f, 0.404131025f, 0.000261583598f,
+    0.979087293f, 0.111326084f, -0.0829236954f, 1.04524267f, 0.405277282f, 0.00029500798f,
+    0.977663517f, 0.115029439f, -0.0854376778f, 1.04426897f, 0.406696111f, 0.000330916926f,
+    0.976333559f, 0.118681803f, -0.0877673626f, 1.04333901f, 0.408226222f, 0.000370884547f,
+    0.975129247f, 0.12224222f, -0.0905746445f, 1.04214072f, 0.409796417f, 0.000417975301f,
+    0.974711537f, 0.125971586f, -0.0935234204f, 1.04108095f, 0.411194921f, 0.000467770355f,
+    0.972845554f, 0.129090279f, -0.0966136009f, 1.03977776f, 0.412580162f, 0.000523967668f,
+    0.971164703f, 0.132443845f, -0.0989467055f, 1.03846979f, 0.414276689f, 0.000586893933f,
+    0.969447076f, 0.13574326f, -0.101630874f, 1.03707218f, 0.416107535f, 0.000662327569f,
+    0.967921495f, 0.138984904f, -0.104603142f, 1.03514659f, 0.417832464f, 0.000747999584f,
+    0.967063904f, 0.141636893f, -0.106012911f, 1.03391111f, 0.419882238f, 0.000838656619f,
+    0.966165245f, 0.144215509f, -0.106889263f, 1.03287792f, 0.421979457f, 0.00093350152f,
+    0.964651227f, 0.146811172f, -0.108462527f, 1.03136241f, 0.424101293f, 0.00104388478f,
+    0.963988841f, 0.14939262f, -0.11028152f, 1.02981818f, 0.426081866f, 0.00116086029f,
+    0.962073624f, 0.152315095f, -0.112469122f, 1.02772534f, 0.42816031f, 0.00129106664f,
+    0.958236158f, 0.154304057f, -0.114630908f, 1.02528119f, 0.430424333f, 0.00144024368f,
+    0.95549041f, 0.156420201f, -0.115456529f, 1.02349687f, 0.433171123f, 0.00160870038f,
+    0.953316927f, 0.158334687f, -0.116648458f, 1.02159166f, 0.435932308f, 0.00179596851f,
+    0.95123297f, 0.160668746f, -0.118252829f, 1.0192709f, 0.438892424f, 0.00201077526f,
+    0.949988902f, 0.163067833f, -0.120594181f, 1.01763189f, 0.441782266f, 0.00225162623f,
+    0.947221339f, 0.164826706f, -0.122031748f, 1.01613629f, 0.445133924f, 0.00252553239f,
+    0.945694923f, 0.165992543f, -0.121801876f, 1.01549673f, 0.448996872f, 0.00282503176f,
+    0.944571316f, 0.167085424f, -0.121440127f, 1.01366377f, 0.452736646f, 0.00314169377f,
+    0.943967342f, 0.168290898f, -0.121369042f, 1.0126878f, 0.456444621f, 0.00347970123f,
+    0.942111969f, 0.169648886f, -0.122038864f, 1.01077235f, 0.460054666f, 0.00386457704f,
+    0.937595129f, 0.170358837f, -0.123270035f, 1.00842154f, 0.463438153f, 0.0043011033f,
+    0.933815598f, 0.171569362f, -0.124620698f, 1.0064472f, 0.466935307f, 0.00478820922f,
+    0.931622446f, 0.171822965f, -0.124570727f, 1.00478578f, 0.471705854f, 0.0053378283f,
+    0.929786026f, 0.171929225f, -0.123811044f, 1.00332367f, 0.476893514f, 0.00595195452f,
+    0.928804994f, 0.171893105f, -0.122583739f, 1.00263131f, 0.48244381f, 0.00662063621f,
+    0.927495956f, 0.171716183f, -0.121855155f, 1.00124133f, 0.487786233f, 0.00734742824f,
+    0.925829291f, 0.171973363f, -0.121826597f, 1.00005364f, 0.493082702f, 0.00813454948f,
+    0.923248231f, 0.171112582f, -0.121054783f, 0.99941808f, 0.498739839f, 0.00901094731f,
+    0.92169404f, 0.170752242f, -0.120302074f, 0.998016119f, 0.505021155f, 0.00999200158f,
+    0.920299113f, 0.170374677f, -0.120282561f, 0.996757627f, 0.511024654f, 0.0110910181f,
+    0.918646991f, 0.169949099f, -0.120655634f, 0.99548924f, 0.517455161f, 0.0122992201f,
+    0.91682601f, 0.169342354f, -0.121094868f, 0.993215382f, 0.52378428f, 0.0136086512f,
+    0.916630089f, 0.169571862f, -0.122541204f, 0.991560638f, 0.531253994f, 0.0150479041f,
+    0.916795015f, 0.169946134f, -0.125216812f, 0.989515603f, 0.538769722f, 0.0166629665f,
+    0.916657865f, 0.164370745f, -0.116707675f, 0.991967082f, 0.55056119f, 0.0185025726f,
+    0.918293417f, 0.15956752f, -0.108259812f, 0.994519472f, 0.562027752f, 0.0205281358f,
+    0.920604944f, 0.155430511f, -0.0996098891f, 0.996041536f, 0.572952151f, 0.0226370972f,
+    1.0f, 0.0f, 0.0f, 1.07291889f, 0.375565588f, 3.72193426e-05f,
+    0.999840975f, 0.00671054935f, -0.00548838452f, 1.07248926f, 0.375647992f, 3.77883698e-05f,
+    0.999662519f, 0.0108905239f, -0.00856621005f, 1.07247066f, 0.375735372f, 3.87772343e-05f,
+    0.999395251f, 0.015039525f, -0.0115297111f, 1.07236576f, 0.375824869f, 4.01119432e-05f,
+    0.998915553f, 0.0194040854f, -0.0149196815f, 1.07219851f, 0.375969768f, 4.20984907e-05f,
+    0.998404324f, 0.023534026f, -0.017851945f, 1.07204449f, 0.376261294f, 4.47707062e-05f,
+    0.997802198f, 0.0276258644f, -0.0208140891f, 1.07193279f, 0.376595795f, 4.80022027e-05f,
+    0.997021914f, 0.0318816938f, -0.0240756422f, 1.07164645f, 0.376937211f, 5.19142013e-05f,
+    0.996291578f, 0.0360457152f, -0.027228374f, 1.07142544f, 0.377336442f, 5.6528821e-05f,
+    0.995647609f, 0.0399896763f, -0.0297412165f, 1.07128835f, 0.377919376f, 6.17952901e-05f,
+    0.994733751f, 0.0440744422f, -0.0328428484f, 1.07094669f, 0.378430486f, 6.78531142e-05f,
+    0.993949056f, 0.0480131619f, -0.0358470939f, 1.07067895f, 0.379040927f, 7.4972857e-05f,
+    0.993302524f, 0.0519405827f, -0.0384258479f, 1.07037139f, 0.379784763f, 8.29657802e-05f,
+    0.992192745f, 0.0559800975f, -0.0417556353f, 1.0699718f, 0.380548239f, 9.29488742e-05f,
+    0.991236508f, 0.060097713f, -0.0453309305f, 1.06944096f, 0.381158352f, 0.000103801744f,
+    0.990375698f, 0.063830629f, -0.0480333008f, 1.06880653f, 0.381864667f, 0.000115105649f,
+    0.989556849f, 0.0676030368f, -0.0506941006f, 1.0681386f, 0.382774204f, 0.000128459607f,
+    0.988596797f, 0.0713607594f, -0.0535122715f, 1.06756914f, 0.383687913f, 0.000143218916f,
+    0.987461209f, 0.0747027919f, -0.0556404926f, 1.06723595f, 0.384904951f, 0.000160795986f,
+    0.986503541f, 0.0782688186f, -0.0581622794f, 1.06652761f, 0.386044174f, 0.000180689254f,
+    0.98556143f, 0.0818854347f, -0.0608594269f, 1.06584907f, 0.387085855f, 0.000201686707f,
+    0.984037161f, 0.0853489116f, -0.0638610944f, 1.06497002f, 0.388159871f, 0.00022537398f,
+    0.982659817f, 0.0888083875f, -0.066400215f, 1.06412065f, 0.389525354f, 0.000253460486f,
+    0.981768847f, 0.0919250101f, -0.0687187687f, 1.06321585f, 0.390905023f, 0.000283422414f,
+    0.980580747f, 0.0953798816f, -0.0716578066f, 1.06217802f, 0.39231807f, 0.000318607927f,
+    0.979275465f, 0.0984340608f, -0.0740933567f, 1.06139779f, 0.393899441f, 0.000358070567f,
+    0.978471696f, 0.101356126f, -0.0757001638f, 1.06077182f, 0.395697117f, 0.000400059042f,
+    0.977488697f, 0.104243092f, -0.0777701288f, 1.06006896f, 0.397505045f, 0.000448325474f,
+    0.976257145f, 0.107150532f, -0.080071561f, 1.05906081f, 0.399263889f, 0.000501357543f,
+    0.973896384f, 0.110156968f, -0.0830149949f, 1.05767798f, 0.401056021f, 0.000565867813f,
+    0.972849905f, 0.11276222f, -0.0851601064f, 1.05684555f, 0.403047651f, 0.000637572899f,
+    0.972080708f, 0.115450911f, -0.0868772194f, 1.05553353f, 0.405060709f, 0.000713451416f,
+    0.971991241f, 0.117474683f, -0.0886826366f, 1.05460906f, 0.407005876f, 0.000792291714f,
+    0.970343053f, 0.119731955f, -0.0895770267f, 1.05363345f, 0.409330338f, 0.000884363311f,
+    0.969424903f, 0.121244363f, -0.0897908434f, 1.05297911f, 0.411745608f, 0.000981150661f,
+    0.968482852f, 0.123111434f, -0.0906460583f, 1.05199492f, 0.414176226f, 0.00108933519f,
+    0.96717304f, 0.125342444f, -0.0925315991f, 1.05094647f, 0.416651994f, 0.00121878809f,
+    0.963994324f, 0.127193123f, -0.0947229713f, 1.04918671f, 0.419172257f, 0.00136168755f,
+    0.961529553f, 0.129340976f, -0.0967733562f, 1.0474571f, 0.421960086f, 0.00152231369f,
+    0.960113168f, 0.130776167f, -0.0974243358f, 1.04652786f, 0.425239563f, 0.00170399144f,
+    0.958836555f, 0.132357448f, -0.0984532088f, 1.04496372f, 0.428469181f, 0.00190628495f,
+    0.957884967f, 0.13394168f, -0.0998632461f, 1.04375744f, 0.431816876f, 0.00213294616f,
+    0.956116736f, 0.135655612f, -0.101941496f, 1.04228354f, 0.435186714f, 0.00238787988f,
+    0.955760777f, 0.136908889f, -0.102279671f, 1.04180074f, 0.439135671f, 0.0026605993f,
+    0.955238938f, 0.137342528f, -0.101289019f, 1.04101253f, 0.443435371f, 0.00294983806f,
+    0.954187095f, 0.138113037f, -0.100717686f, 1.04017329f, 0.447729528f, 0.00326721417f,
+    0.952431381f, 0.138937265f, -0.101011217f, 1.03865469f, 0.452039748f, 0.00364273088f,
+    0.948720396f, 0.139585614f, -0.102106318f, 1.03763497f, 0.456196368f, 0.00406021252f,
+    0.946031392f, 0.140660018f, -0.103653409f, 1.03541136f, 0.46009177f, 0.00452572061f,
+    0.944470584f, 0.141279787f, -0.10457471f, 1.03371894f, 0.464678675f, 0.00504374411f,
+    0.94342643f, 0.141306981f, -0.103916667f, 1.03251064f, 0.470354974f, 0.00562316692f,
+    0.942850828f, 0.141105533f, -0.102602802f, 1.03228629f, 0.476507127f, 0.00626199041f,
+    0.94246769f, 0.140889227f, -0.10152775f, 1.03165257f, 0.482576162f, 0.0069435183f,
+    0.940672517f, 0.140604734f, -0.1015018f, 1.0310638f, 0.488659441f, 0.0077034859f,
+    0.938815415f, 0.140523508f, -0.101532303f, 1.0300082f, 0.494735062f, 0.0085478127f,
+    0.937253833f, 0.139637828f, -0.100603923f, 1.0288291f, 0.501754403f, 0.00948980078f,
+    0.9363361f, 0.13934733f, -0.100601651f, 1.02768922f, 0.508605063f, 0.0105405869f,
+    0.935293257f, 0.139061093f, -0.101328149f, 1.02681565f, 0.515691817f, 0.0117147565f,
+    0.933781207f, 0.138920441f, -0.102195106f, 1.02486277f, 0.522827446f, 0.0129886242f,
+    0.933283925f, 0.138971955f, -0.103798702f, 1.02318132f, 0.530946851f, 0.014382571f,
+    0.933395505f, 0.139602393f, -0.107067883f, 1.02130342f, 0.539402544f, 0.0159611348f,
+    0.933208823f, 0.135209829f, -0.100091726f, 1.02306938f, 0.551597714f, 0.0177563727f,
+    0.93380177f, 0.130517989f, -0.0917605907f, 1.02472615f, 0.564051986f, 0.0197517686f,
+    0.934280992f, 0.125656724f, -0.0834370181f, 1.02601862f, 0.575970948f, 0.0218402725f,
+    1.0f, 0.0f, 0.0f, 1.08607936f, 0.359552026f, 3.64790467e-05f,
+    0.999902189f, 0.00527639547f, -0.00437410921f, 1.08605206f, 0.359632432f, 3.69859918e-05f,
+    0.99982363f, 0.00861398783f, -0.00695503177f, 1.0860765f, 0.359710127f, 3.78704135e-05f,
+    0.999498487f, 0.0119537683f, -0.00953449495f, 1.08597171f, 0.359922588f, 3.94437884e-05f,
+    0.999285221f, 0.0151031055f, -0.0117416093f, 1.0859673f, 0.360183835f, 4.14366659e-05f,
+    0.998845339f, 0.0183680244f, -0.0141918994f, 1.0857302f, 0.360365897f, 4.3675911e-05f,
+    0.998457253f, 0.0217634756f, -0.016966043f, 1.08564401f, 0.360685199f, 4.68488979e-05f,
+    0.998004615f, 0.0247392878f, -0.0188154709f, 1.08549631f, 0.361106217f, 5.03768206e-05f,
+    0.997435749f, 0.0279132873f, -0.0211994089f, 1.08518386f, 0.36146453f, 5.43888054e-05f,
+    0.996699274f, 0.031335067f, -0.0241749547f, 1.08499348f, 0.362018138f, 5.99202067e-05f,
+    0.996097088f, 0.0344557576f, -0.0263839252f, 1.08484864f, 0.36267668f, 6.59284051e-05f,
+    0.995375514f, 0.0376124606f, -0.0287630763f, 1.08473539f, 0.363458484f, 7.31427644e-05f,
+    0.994566202f, 0.040964365f, -0.0316333398f, 1.08454323f, 0.364200801f, 8.15830572e-05f,
+    0.994084001f, 0.0437829532f, -0.0333146304f, 1.08429182f, 0.365074843f, 9.03318214e-05f,
+    0.993313789f, 0.0466856249f, -0.0351198651f, 1.08397365f, 0.365939736f, 9.9853336e-05f,
+    0.992491186f, 0.0497878343f, -0.0376195014f, 1.08364272f, 0.366765559f, 0.000111022404f,
+    0.991556227f, 0.0528330915f, -0.0401914902f, 1.08299387f, 0.367562205f, 0.000123238424f,
+    0.990855873f, 0.0558258519f, -0.0426215343f, 1.08274019f, 0.368714392f, 0.000138907024f,
+    0.989872515f, 0.0588851236f, -0.0450299866f, 1.08218253f, 0.369786978f, 0.000155534959f,
+    0.989232838f, 0.0614418946f, -0.0464218333f, 1.08181167f, 0.37107867f, 0.000173021894f,
+    0.988485694f, 0.0640901923f, -0.0481181778f, 1.08154106f, 0.37255758f, 0.00019435749f,
+    0.987558901f, 0.066809617f, -0.0502003171f, 1.08110762f, 0.373875648f, 0.000217429566f,
+    0.986098528f, 0.0696174577f, -0.0526446886f, 1.08027399f, 0.375116765f, 0.000242494061f,
+    0.984969914f, 0.0723171756f, -0.0549381822f, 1.0796082f, 0.376661837f, 0.000273131882f,
+    0.984227419f, 0.0747653395f, -0.0566072315f, 1.07904279f, 0.378292888f, 0.000305820489f,
+    0.983201146f, 0.07749255f, -0.0587703325f, 1.0783056f, 0.379934579f, 0.000342448591f,
+    0.982232094f, 0.0799195617f, -0.0607686639f, 1.07780969f, 0.381670475f, 0.000382485945f,
+    0.981009245f, 0.0820908844f, -0.0619449131f, 1.07711554f, 0.383731872f, 0.000427821215f,
+    0.980135441f, 0.0845742822f, -0.0637117624f, 1.07659423f, 0.385915518f, 0.000482793432f,
+    0.97882843f, 0.0868727192f, -0.0655701682f, 1.0758996f, 0.388070405f, 0.000543175207f,
+    0.977998435f, 0.0890404284f, -0.0674690828f, 1.07506502f, 0.390039265f, 0.000605662237f,
+    0.977283895f, 0.0909279659f, -0.0685246587f, 1.07438493f, 0.392166466f, 0.000671246671f,
+    0.976254165f, 0.0927275121f, -0.0696860775f, 1.07341111f, 0.394498378f, 0.000748202496f,
+    0.975138724f, 0.0946585163f, -0.0709617138f, 1.0725081f, 0.396801323f, 0.000829134427f,
+    0.974070907f, 0.0961908773f, -0.0714931414f, 1.07217133f, 0.399523765f, 0.000923128566f,
+    0.972993731f, 0.0975493863f, -0.0716574416f, 1.07168961f, 0.402452201f, 0.00103226013f,
+    0.972113371f, 0.0989603922f, -0.0724503472f, 1.07097685f, 0.40532285f, 0.00115340482f,
+    0.969790161f, 0.1006843f, -0.074073121f, 1.0698638f, 0.408201784f, 0.00129127584f,
+    0.967833519f, 0.102394946f, -0.0761784911f, 1.06870115f, 0.411141247f, 0.00144487224f,
+    0.966500938f, 0.104020342f, -0.0777080953f, 1.06742585f, 0.414438218f, 0.00161601813f,
+    0.965716481f, 0.104997829f, -0.0780006945f, 1.06685984f, 0.418145746f, 0.00180680875f,
+    0.965003967f, 0.106103323f, -0.078886278f, 1.06593585f, 0.421858549f, 0.00202373532f,
+    0.964153647f, 0.107257858f, -0.079964377f, 1.06527245f, 0.425585598f, 0.00225509633f,
+    0.963914156f, 0.108210526f, -0.0813213512f, 1.06470406f, 0.429375172f, 0.00250041997f,
+    0.963376164f, 0.108596765f, -0.080404453f, 1.06408155f, 0.434038848f, 0.0027670057f,
+    0.96239835f, 0.108750053f, -0.0797261894f, 1.06385744f, 0.438899755f, 0.00308348518f,
+    0.961363494f, 0.109217584f, -0.0793966874f, 1.06317031f, 0.443850666f, 0.00343523198f,
+    0.958476186f, 0.10984093f, -0.0799371004f, 1.06221044f, 0.448671281f, 0.00383355655f,
+    0.957365096f, 0.110414363f, -0.081222184f, 1.06113505f, 0.453296065f, 0.00427531544f,
+    0.956138372f, 0.110961333f, -0.0827882886f, 1.05941129f, 0.457871139f, 0.00476831663f,
+    0.955708444f, 0.111056931f, -0.0825474709f, 1.05879617f, 0.463770568f, 0.005313084f,
+    0.955875993f, 0.110745862f, -0.0815875009f, 1.05883324f, 0.470279962f, 0.00591194304f,
+    0.955745518f, 0.11026825f, -0.0802913085f, 1.05860221f, 0.477158189f, 0.00656400202f,
+    0.953725517f, 0.109961875f, -0.0799481347f, 1.05795503f, 0.483903855f, 0.00729273772f,
+    0.952661216f, 0.109902039f, -0.0806296021f, 1.05728805f, 0.490601599f, 0.00810612645f,
+    0.951997995f, 0.109306499f, -0.0798277929f, 1.05663443f, 0.498166829f, 0.00901342649f,
+    0.951259732f, 0.108835258f, -0.0798271894f, 1.05556571f, 0.505856574f, 0.0100203259f,
+    0.950577676f, 0.10875681f, -0.0808309615f, 1.05497766f, 0.513581336f, 0.011158647f,
+    0.94953984f, 0.108797833f, -0.0821360201f, 1.05356908f, 0.521636128f, 0.0123998998f,
+    0.948952079f, 0.108946949f, -0.0839221254f, 1.05203259f, 0.530287921f, 0.0137536572f,
+    0.948928893f, 0.109882265f, -0.0877799466f, 1.05041528f, 0.539672196f, 0.0152945956f,
+    0.949186802f, 0.106451608f, -0.0824447274f, 1.05173242f, 0.552281797f, 0.0170467421f,
+    0.949292064f, 0.102211803f, -0.0743542239f, 1.05349278f, 0.565713108f, 0.0190104675f,
+    0.949155927f, 0.0972388312f, -0.0663686693f, 1.05424881f, 0.578617632f, 0.0210780818f,
+    1.0f, 0.0f, 0.0f, 1.09909987f, 0.344097376f, 3.57304853e-05f,
+    0.999995112f, 0.00400090823f, -0.00367586268f, 1.09905756f, 0.344177663f, 3.62375358e-05f,
+    0.999917269f, 0.00629282417f, -0.00534958206f, 1.09912097f, 0.344309896f, 3.71730457e-05f,
+    0.999725997f, 0.00843760744f, -0.00678743282f, 1.09891319f, 0.344447434f, 3.83578044e-05f,
+    0.999487758f, 0.011031772f, -0.00903761014f, 1.0988363f, 0.344700843f, 4.03234772e-05f,
+    0.999261677f, 0.0133183906f, -0.0107637485f, 1.09889698f, 0.345100313f, 4.29303764e-05f,
+    0.999053061f, 0.015499521f, -0.0122394534f, 1.09877419f, 0.345475703f, 4.57378119e-05f,
+    0.998687208f, 0.0180520061f, -0.0145574817f, 1.09870005f, 0.345928699f, 4.95312488e-05f,
+    0.998374104f, 0.0203601122f, -0.0162850246f, 1.0986104f, 0.346483231f, 5.39433859e-05f,
+    0.997970343f, 0.022478791f, -0.0176868066f, 1.09853566f, 0.347081035f, 5.87421564e-05f,
+    0.997373343f, 0.025110364f, -0.0200292077f, 1.09835553f, 0.347679138f, 6.48194982e-05f,
+    0.996888518f, 0.0273803752f, -0.0218147654f, 1.09808481f, 0.348325193f, 7.1393355e-05f,
+    0.996552885f, 0.0292384941f, -0.0228392202f, 1.0978061f, 0.349024177f, 7.8057441e-05f,
+    0.99598664f, 0.0314533263f, -0.0244917255f, 1.0975883f, 0.349829197f, 8.62011802e-05f,
+    0.995429218f, 0.0336041339f, -0.0259710606f, 1.09737742f, 0.350804955f, 9.5659816e-05f,
+    0.994893432f, 0.0356532931f, -0.0274839979f, 1.0972985f, 0.351933777f, 0.000106978492f,
+    0.994211257f, 0.0379354283f, -0.0293610059f, 1.0971483f, 0.35307917f, 0.000120080636f,
+    0.993513465f, 0.0402156748f, -0.0313985422f, 1.09670472f, 0.354107797f, 0.000133887661f,
+    0.992900014f, 0.0423586294f, -0.0329743214f, 1.09644222f, 0.355245411f, 0.000148738487f,
+    0.992219806f, 0.0444821715f, -0.0346105844f, 1.09612834f, 0.356583804f, 0.000166741738f,
+    0.991643131f, 0.046276778f, -0.0358032174f, 1.09575856f, 0.357885182f, 0.000185059107f,
+    0.991064131f, 0.0480529442f, -0.0365582928f, 1.09566307f, 0.359569609f, 0.000207457444f,
+    0.990287662f, 0.0499839857f, -0.0380486399f, 1.09546411f, 0.361236036f, 0.0002334725f,
+    0.989288688f, 0.0520429574f, -0.0398607589f, 1.09497094f, 0.362745315f, 0.000260828238f,
+    0.988353074f, 0.0540721491f, -0.0417034477f, 1.09432209f, 0.364373684f, 0.000291737349f,
+    0.987777352f, 0.0556228869f, -0.0424772128f, 1.09393299f, 0.366258651f, 0.000324559311f,
+    0.986783981f, 0.0575333163f, -0.0440526381f, 1.0934068f, 0.368138433f, 0.000363418396f,
+    0.985768557f, 0.0597231388f, -0.0461561829f, 1.09299064f, 0.370107055f, 0.000410172186f,
+    0.985319853f, 0.0610783249f, -0.0469054095f, 1.0926429f, 0.372438073f, 0.000460398878f,
+    0.98482281f, 0.0625586584f, -0.0474785008f, 1.09239638f, 0.374840885f, 0.000513115025f,
+    0.983768582f, 0.0639355779f, -0.0482229069f, 1.09180593f, 0.377196819f, 0.000568199728f,
+    0.983020723f, 0.0656308606f, -0.0496878512f, 1.09131503f, 0.379526585f, 0.00063204614f,
+    0.982227147f, 0.0669201314f, -0.0504832044f, 1.09076273f, 0.382025927f, 0.000700521749f,
+    0.981409371f, 0.0683246627f, -0.0513567999f, 1.09032285f, 0.384747475f, 0.000781177543f,
+    0.98029089f, 0.0698259324f, -0.0527482778f, 1.08980799f, 0.387535334f, 0.000874428835f,
+    0.979763091f, 0.0709756389f, -0.0529639907f, 1.08951986f, 0.390687257f, 0.000977420365f,
+    0.979342401f, 0.0717724115f, -0.052773606f, 1.08938015f, 0.394055903f, 0.00109412498f,
+    0.97799474f, 0.072751008f, -0.0532190241f, 1.08877683f, 0.397298545f, 0.00122303842f,
+    0.976233125f, 0.0740557685f, -0.0544846691f, 1.08785987f, 0.400522888f, 0.00136825093f,
+    0.975057006f, 0.0754483789f, -0.0563620515f, 1.08689094f, 0.403850198f, 0.00152925577f,
+    0.974168122f, 0.076597847f, -0.0573730022f, 1.08636308f, 0.407725185f, 0.00171526673f,
+    0.973878384f, 0.0771494806f, -0.0573656f, 1.0859462f, 0.411851078f, 0.00191397127f,
+    0.973337352f, 0.0779121593f, -0.0576431453f, 1.08552909f, 0.41596669f, 0.00212240801f,
+    0.972379327f, 0.0788310766f, -0.0583955385f, 1.08474267f, 0.420087457f, 0.00234656408f,
+    0.971476674f, 0.0795070305f, -0.0591522418f, 1.08421683f, 0.424603403f, 0.00260744686f,
+    0.97105962f, 0.0795198977f, -0.0581517704f, 1.08418345f, 0.430037856f, 0.00290985405f,
+    0.970263779f, 0.0799268857f, -0.0575284734f, 1.08393729f, 0.435483426f, 0.00324902521f,
+    0.96882242f, 0.0800669566f, -0.0572988279f, 1.0835036f, 0.440927088f, 0.00362035795f,
+    0.967635155f, 0.0804794878f, -0.0581350178f, 1.08270121f, 0.446242064f, 0.0040418962f,
+    0.967013299f, 0.0810557604f, -0.0597444288f, 1.08181417f, 0.451325148f, 0.00450885668f,
+    0.966799021f, 0.0814956427f, -0.0606795028f, 1.08108008f, 0.457035065f, 0.00502029341f,
+    0.967098534f, 0.0809418559f, -0.059688814f, 1.0809598f, 0.463880807f, 0.00557729881f,
+    0.966541111f, 0.0802875608f, -0.0580892675f, 1.08097947f, 0.471417576f, 0.00619639456f,
+    0.965637624f, 0.0800554827f, -0.0575377755f, 1.08093643f, 0.47887221f, 0.00690032262f,
+    0.96544826f, 0.0799650177f, -0.0582546517f, 1.08075535f, 0.486385107f, 0.00768830953f,
+    0.965017617f, 0.079486914f, -0.0581734665f, 1.0803206f, 0.49428755f, 0.00856168009f,
+    0.964918911f, 0.0791018158f, -0.0582427122f, 1.07999063f, 0.502816319f, 0.0095342556f,
+    0.9644804f, 0.0789637417f, -0.0593652427f, 1.07936394f, 0.511139154f, 0.0106307995f,
+    0.963992119f, 0.0791799352f, -0.0611005947f, 1.0784868f, 0.520101964f, 0.0118458364f,
+    0.963406444f, 0.0794732496f, -0.0631713346f, 1.07723784f, 0.529344916f, 0.0131610259f,
+    0.963350773f, 0.0803376883f, -0.0674787015f, 1.07618213f, 0.5395872f, 0.0146587109f,
+    0.964005351f, 0.0781382844f, -0.0638677701f, 1.07722437f, 0.552622437f, 0.0163700376f,
+    0.963760257f, 0.074013792f, -0.0560060591f, 1.07841825f, 0.567018986f, 0.0183025002f,
+    0.963081896f, 0.0698744133f, -0.0484202355f, 1.07875049f, 0.580898941f, 0.0203489326f,
+    1.0f, 0.0f, 0.0f, 1.11126041f, 0.32916376f, 3.49080656e-05f,
+    1.00000215f, 0.00255131116f, -0.00249991403f, 1.11130655f, 0.329250693f, 3.53685937e-05f,
+    0.999920785f, 0.0041070641f, -0.00390850054f, 1.11128199f, 0.329364985f, 3.62178398e-05f,
+    0.999902606f, 0.00561186392f, -0.00534286257f, 1.11138535f, 0.32962665f, 3.77759025e-05f,
+    0.999777257f, 0.006737608f, -0.0059566847f, 1.11129403f, 0.329908311f, 3.95291063e-05f,
+    0.999625742f, 0.00834239274f, -0.00730158389f, 1.11130702f, 0.33024776f, 4.18927957e-05f,
+    0.999471128f, 0.00999704748f, -0.0089220209f, 1.11127472f, 0.330669194f, 4.5014327e-05f,
+    0.999315441f, 0.0110787908f, -0.00945094042f, 1.11118817f, 0.331195205f, 4.83840704e-05f,
+    0.99905467f, 0.0126022166f, -0.0106825633f, 1.11114275f, 0.331736982f, 5.24699826e-05f,
+    0.998901069f, 0.0140180141f, -0.0119016366f, 1.1109997f, 0.332341701f, 5.7331963e-05f,
+    0.998679221f, 0.0150288874f, -0.0122681791f, 1.1109035f, 0.332974434f, 6.22537482e-05f,
+    0.998493731f, 0.0163391456f, -0.0131018311f, 1.11074948f, 0.333636075f, 6.78622455e-05f,
+    0.998090506f, 0.0179907102f, -0.0147916982f, 1.11043906f, 0.334412634f, 7.51644839e-05f,
+    0.997892559f, 0.0192560591f, -0.0156942215f, 1.11043954f, 0.33535713f, 8.31560319e-05f,
+    0.997508883f, 0.0207327604f, -0.017137181f, 1.11034787f, 0.336404562f, 9.30955721e-05f,
+    0.99707514f, 0.0222783852f, -0.0185570177f, 1.11020553f, 0.337435871f, 0.000103886203f,
+    0.996906102f, 0.0231094286f, -0.0186485704f, 1.11014509f, 0.338716179f, 0.000115195151f,
+    0.996496379f, 0.024296267f, -0.0193585996f, 1.10999966f, 0.339966714f, 0.000127984313f,
+    0.996096969f, 0.0256603286f, -0.0205433071f, 1.10972333f, 0.34117201f, 0.000142326375f,
+    0.995775342f, 0.0269987658f, -0.021823654f, 1.10947752f, 0.342412174f, 0.000158219627f,
+    0.995320976f, 0.0282857195f, -0.0228212997f, 1.1092701f, 0.34397459f, 0.000177599271f,
+    0.99493742f, 0.0296302736f, -0.0240641441f, 1.10917592f, 0.345503211f, 0.000198903115f,
+    0.994671583f, 0.0302574988f, -0.0237904042f, 1.10904074f, 0.347330064f, 0.000221567432f,
+    0.994204164f, 0.0312109403f, -0.0240605045f, 1.10881066f, 0.349123806f, 0.000246842363f,
+    0.993677974f, 0.0324061513f, -0.0251183342f, 1.10862696f, 0.350912571f, 0.000275284983f,
+    0.99293834f, 0.0339198969f, -0.0268204473f, 1.108181f, 0.352722019f, 0.000308585353f,
+    0.992438138f, 0.0350493677f, -0.0276061837f, 1.10806084f, 0.354959816f, 0.000347938912f,
+    0.991941035f, 0.0360654555f, -0.0283532888f, 1.10776949f, 0.357114524f, 0.000389146269f,
+    0.991527915f, 0.0372077934f, -0.0293704104f, 1.10738945f, 0.359194726f, 0.000432519417f,
+    0.99110043f, 0.0376833156f, -0.0290059745f, 1.10693872f, 0.36158517f, 0.000477637223f,
+    0.990638852f, 0.0383342169f, -0.0289959144f, 1.10681605f, 0.364243567f, 0.000530546822f,
+    0.990080535f, 0.0393321514f, -0.0297344308f, 1.106709f, 0.367043287f, 0.000591325166f,
+    0.989454687f, 0.0405938029f, -0.0311509892f, 1.10640323f, 0.369831771f, 0.000660834019f,
+    0.988915384f, 0.0416939668f, -0.0321586505f, 1.10624158f, 0.372815907f, 0.000740460237f,
+    0.988548398f, 0.0424781442f, -0.0327650569f, 1.10616684f, 0.375965863f, 0.000828264281f,
+    0.987960219f, 0.0435145684f, -0.0338532664f, 1.10594618f, 0.379131138f, 0.00092712685f,
+    0.987739682f, 0.043914523f, -0.0333534926f, 1.10578978f, 0.382659823f, 0.00103537505f,
+    0.987308621f, 0.0440596826f, -0.0325936824f, 1.10563421f, 0.386373073f, 0.00115681766f,
+    0.986453891f, 0.0445953682f, -0.0327279344f, 1.10520673f, 0.389995903f, 0.00129252498f,
+    0.98557204f, 0.04555903f, -0.0338050202f, 1.1046524f, 0.393578559f, 0.00144834025f,
+    0.984698117f, 0.0466655456f, -0.0354539678f, 1.10393381f, 0.397326112f, 0.00161763001f,
+    0.984395087f, 0.046996735f, -0.0352203883f, 1.10365641f, 0.401676953f, 0.00179571589f,
+    0.983947515f, 0.0471999273f, -0.0348392352f, 1.10331368f, 0.406187415f, 0.00198845961f,
+    0.98328501f, 0.0477876849f, -0.0352180898f, 1.10300231f, 0.410871029f, 0.00220641517f,
+    0.982672751f, 0.0487623923f, -0.0366970487f, 1.10266829f, 0.415569454f, 0.00246399501f,
+    0.98225683f, 0.0490285978f, -0.0366345905f, 1.10244691f, 0.42095983f, 0.00275174552f,
+    0.982140362f, 0.0486950912f, -0.0352533534f, 1.10256362f, 0.426983297f, 0.00306827598f,
+    0.981286049f, 0.0486399941f, -0.0346746072f, 1.10251892f, 0.433027148f, 0.00342705031f,
+    0.980694175f, 0.0489386953f, -0.0347622037f, 1.10215092f, 0.438939065f, 0.0038236808f,
+    0.980046511f, 0.0495376587f, -0.0359205343f, 1.10162294f, 0.444716096f, 0.00426396448f,
+    0.9794662f, 0.0502275787f, -0.0374471657f, 1.10062242f, 0.450435311f, 0.00474235276f,
+    0.979311049f, 0.0499673635f, -0.0367568173f, 1.10042262f, 0.457550436f, 0.00526250154f,
+    0.979140162f, 0.0494060442f, -0.0355283879f, 1.10058236f, 0.465436876f, 0.00585560407f,
+    0.97878617f, 0.0491417274f, -0.0347661749f, 1.1007148f, 0.473684043f, 0.00653289584f,
+    0.97844249f, 0.0491816476f, -0.0352502428f, 1.10061324f, 0.481861293f, 0.00729472609f,
+    0.978209853f, 0.049381271f, -0.0360578187f, 1.10039818f, 0.490205497f, 0.00814107247f,
+    0.977798343f, 0.0491434634f, -0.036019519f, 1.10015428f, 0.499474943f, 0.00908163656f,
+    0.977614582f, 0.049348291f, -0.0372242443f, 1.09976459f, 0.508573532f, 0.010139171f,
+    0.977178693f, 0.0497138873f, -0.0392875895f, 1.09926832f, 0.518232584f, 0.0113182105f,
+    0.976896882f, 0.0502973832f, -0.041822169f, 1.09861863f, 0.52814585f, 0.0126022156f,
+    0.976492345f, 0.0516090579f, -0.0464014374f, 1.09810913f, 0.539169192f, 0.0140568046f,
+    0.97701174f, 0.0502601862f, -0.0445097573f, 1.09866643f, 0.552626848f, 0.0157241542f,
+    0.976051509f, 0.0468736216f, -0.0369291306f, 1.099298f, 0.567978144f, 0.0176265426f,
+    0.976907492f, 0.0431920551f, -0.02979948f, 1.09960938f, 0.582823515f, 0.019651331f,
+    1.0f, 0.0f, 0.0f, 1.12295234f, 0.314792097f, 3.40936713e-05f,
+    1.00009668f, 0.00135799043f, -0.00189495855f, 1.12312198f, 0.314902306f, 3.4611403e-05f,
+    1.00001085f, 0.00181872083f, -0.0022232153f, 1.12305069f, 0.314990163f, 3.53438008e-05f,
+    0.999993861f, 0.00235583866f, -0.00270106294f, 1.12300515f, 0.315191835f, 3.66027562e-05f,
+    0.999975383f, 0.00303428737f, -0.00361723942f, 1.1230222f, 0.315454304f, 3.8423681e-05f,
+    0.999914646f, 0.00340460357f, -0.00372322672f, 1.12302816f, 0.315824986f, 4.06578292e-05f,
+    0.999850333f, 0.00365617941f, -0.00372494687f, 1.12289977f, 0.316214383f, 4.31307781e-05f,
+    0.999820471f, 0.00448916852f, -0.00474120863f, 1.12286735f, 0.31668362f, 4.65444791e-05f,
+    0.999713957f, 0.00485588331f, -0.00493200775f, 1.12283063f, 0.31723997f, 5.02777584e-05f,
+    0.999718785f, 0.00507329823f, -0.00478069903f, 1.12275338f, 0.317881763f, 5.43120004e-05f,
+    0.999613225f, 0.00572798913f, -0.00571626239f, 1.12276244f, 0.318655372f, 5.97698272e-05f,
+    0.999704182f, 0.00599733926f, -0.00569370575f, 1.12294245f, 0.319549859f, 6.56910051e-05f,
+    0.999536455f, 0.00649451604f, -0.00612456957f, 1.12282622f, 0.320470005f, 7.25715654e-05f,
+    0.999437213f, 0.0073297983f, -0.00722140493f, 1.12276351f, 0.321389973f, 8.08265904e-05f,
+    0.999351501f, 0.00775677152f, -0.00759618077f, 1.12265205f, 0.322369158f, 8.94162949e-05f,
+    0.999216557f, 0.00799585413f, -0.00748670427f, 1.12250257f, 0.323433936f, 9.83928039e-05f,
+    0.999135196f, 0.00856068265f, -0.00810566638f, 1.12232482f, 0.324568212f, 0.000109221721f,
+    0.999015987f, 0.00876983348f, -0.00795713998f, 1.12233233f, 0.325943053f, 0.00012134909f,
+    0.998894751f, 0.00895859674f, -0.00793285668f, 1.12227118f, 0.32740891f, 0.000134950358f,
+    0.998757005f, 0.00959854852f, -0.00868197903f, 1.12228179f, 0.328950137f, 0.000151562825f,
+    0.998633742f, 0.0101950429f, -0.00940810889f, 1.12210059f, 0.330435812f, 0.00016914279f,
+    0.998598576f, 0.0106734792f, -0.0097679887f, 1.12203443f, 0.332032531f, 0.000188299164f,
+    0.9984411f, 0.010985544f, -0.00999014731f, 1.12182903f, 0.333730131f, 0.000209086516f,
+    0.998407841f, 0.0109523246f, -0.00940119196f, 1.12182355f, 0.335720181f, 0.000233190251f,
+    0.998335838f, 0.0110725919f, -0.00910269935f, 1.12187648f, 0.33779785f, 0.000260949251f,
+    0.998201787f, 0.0115844626f, -0.00963647012f, 1.12182438f, 0.339850187f, 0.000293210876f,
+    0.997913182f, 0.0122458031f, -0.0105788875f, 1.1214776f, 0.341819406f, 0.000327485468f,
+    0.997809649f, 0.0122925062f, -0.0102926968f, 1.1213491f, 0.344063282f, 0.000362560997f,
+    0.997668684f, 0.0124661708f, -0.0100680701f, 1.12117875f, 0.346507519f, 0.000401146623f,
+    0.997397661f, 0.0131245647f, -0.0111077446f, 1.12103248f, 0.348961443f, 0.00044823403f,
+    0.997252047f, 0.0132204508f, -0.0108804004f, 1.12094092f, 0.351754278f, 0.000499585643f,
+    0.997089088f, 0.013479773f, -0.0108416053f, 1.12097216f, 0.354765862f, 0.000558380154f,
+    0.996942282f, 0.0139165362f, -0.0113766231f, 1.12099051f, 0.357905775f, 0.000626059365f,
+    0.996664226f, 0.0146123087f, -0.0124207288f, 1.12091696f, 0.361051053f, 0.00070113613f,
+    0.996585906f, 0.0150108812f, -0.0129476814f, 1.12097311f, 0.364378035f, 0.000784387696f,
+    0.996415913f, 0.0152692245f, -0.0130205294f, 1.12085652f, 0.36787045f, 0.000875517318f,
+    0.996355295f, 0.0158098005f, -0.013732953f, 1.12084007f, 0.371387661f, 0.000978571712f,
+    0.996310174f, 0.0153922988f, -0.0124999583f, 1.12087607f, 0.375380039f, 0.00109202415f,
+    0.996182382f, 0.0150657976f, -0.0113936048f, 1.12090111f, 0.379448891f, 0.00122173037f,
+    0.996036112f, 0.0150526334f, -0.0111718448f, 1.1206634f, 0.383411229f, 0.00136379653f,
+    0.995733619f, 0.015481079f, -0.011727972f, 1.12016881f, 0.387299776f, 0.00151512458f,
+    0.995348155f, 0.016083004f, -0.0129109444f, 1.11969912f, 0.391482145f, 0.00168104039f,
+    0.995158255f, 0.0159091689f, -0.0120980442f, 1.11960649f, 0.396461755f, 0.00186480244f,
+    0.994927526f, 0.0161511116f, -0.0123630743f, 1.11950064f, 0.401521236f, 0.00208624476f,
+    0.994722843f, 0.0166764185f, -0.0131567298f, 1.11945403f, 0.40681985f, 0.00233149296f,
+    0.99447763f, 0.0173016321f, -0.0144511042f, 1.11925495f, 0.412105769f, 0.00260320609f,
+    0.99442023f, 0.0168476831f, -0.0130515425f, 1.11943018f, 0.41837129f, 0.0029045085f,
+    0.99431479f, 0.0164418519f, -0.0119091924f, 1.11963224f, 0.42485556f, 0.00324276811f,
+    0.994179785f, 0.0162662882f, -0.0114757083f, 1.11969388f, 0.431488723f, 0.00362260174f,
+    0.994000018f, 0.0166044217f, -0.0119990325f, 1.11943424f, 0.437880754f, 0.00403875485f,
+    0.993686557f, 0.0172391906f, -0.0134769473f, 1.11871219f, 0.444073826f, 0.00448787166f,
+    0.9935835f, 0.0174831282f, -0.0139847742f, 1.11833668f, 0.451100826f, 0.00497765699f,
+    0.993532836f, 0.0170667507f, -0.0128879594f, 1.11847067f, 0.459266335f, 0.00554080075f,
+    0.993457556f, 0.0165518094f, -0.0117654083f, 1.11881435f, 0.468227714f, 0.00619433075f,
+    0.993325591f, 0.0165870357f, -0.0119779995f, 1.11881876f, 0.477066636f, 0.0069303452f,
+    0.99311322f, 0.0173142422f, -0.0135487998f, 1.11858749f, 0.485913247f, 0.00774560589f,
+    0.993006349f, 0.0171609577f, -0.0133779142f, 1.1185168f, 0.495825827f, 0.00865271781f,
+    0.992814243f, 0.0177009422f, -0.0146034164f, 1.11824811f, 0.505732179f, 0.00966894347f,
+    0.992485344f, 0.0185951386f, -0.016972851f, 1.11789656f, 0.516037226f, 0.0108133778f,
+    0.992174745f, 0.0197169837f, -0.0199433565f, 1.11741865f, 0.526618838f, 0.0120689915f,
+    0.991209269f, 0.0217470098f, -0.0247759223f, 1.11716974f, 0.538419902f, 0.0134845283f,
+    0.991338253f, 0.02165916f, -0.0246354099f, 1.11744881f, 0.552305996f, 0.0151087074f,
+    0.991945326f, 0.0183303785f, -0.0173771735f, 1.11821163f, 0.568600416f, 0.0169808287f,
+    0.992514908f, 0.015165342f, -0.0107142981f, 1.11821568f, 0.584399343f, 0.0189837944f,
+};
+
+} // namespace
+
+const LTCTable& LTC::getBuiltinTable() {
+    static const LTCTable table = [] {
+        LTCTable result;
+        result.matrix.resize(kBuiltinTableSize, kBuiltinTableSize);
+        result.magnitude.resize(kBuiltinTableSize, kBuiltinTableSize);
+        for (int y = 0; y < kBuiltinTableSize; ++y) {
+            for (int x = 0; x < kBuiltinTableSize; ++x) {
+                const float* cell = kBuiltinTable + (y * kBuiltinTableSize + x) * 6;
+                result.matrix.at(x, y) = glm::vec4(cell[0], cell[1], cell[2], cell[3]);
+                result.magnitude.at(x, y) = glm::vec4(cell[4], cell[5], 0.0f, 1.0f);
+            }
+        }
+        return result;
+    }();
+    return table;
+}
+
+} // namespace ElementalRenderer
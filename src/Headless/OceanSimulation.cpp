@@ -0,0 +1,253 @@
+/**
+ * @file OceanSimulation.cpp
+ * @brief Implementation of the Tessendorf FFT ocean
+ */
+
+#include "Headless/OceanSimulation.h"
+#include "Headless/Parallel.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace ElementalRenderer {
+
+namespace {
+
+const int kRowGrain = 8;
+const float kPi = 3.14159265358979f;
+const float kGravity = 9.81f;
+
+unsigned char toByte(float value) {
+    return static_cast<unsigned char>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+}
+
+} // namespace
+
+OceanSimulation::OceanSimulation(const OceanSettings& settings)
+    : m_settings(settings)
+    , m_fft(settings.resolution)
+    , m_expectedVariance(0.0f) {
+    initializeSpectrum();
+}
+
+void OceanSimulation::setSettings(const OceanSettings& settings) {
+    m_settings = settings;
+    m_fft = FFT2D(settings.resolution);
+    initializeSpectrum();
+}
+
+float OceanSimulation::waveNumberAt(int index) const {
+    const int n = m_fft.getSize();
+    const int signedIndex = index < n / 2 ? index : index - n;
+    return 2.0f * kPi * static_cast<float>(signedIndex) / m_settings.patchSize;
+}
+
+float OceanSimulation::dispersion(float k) const {
+    if (m_settings.depth > 0.0f) {
+        return std::sqrt(kGravity * k * std::tanh(k * m_settings.depth));
+    }
+    return std::sqrt(kGravity * k);
+}
+
+float OceanSimulation::evaluateSpectrum(const glm::vec2& k) const {
+    const float kLength = glm::length(k);
+    if (kLength < 1e-6f) {
+        return 0.0f;
+    }
+
+    // cos^2 spreading around the wind, damped for waves running against it
+    glm::vec2 wind = m_settings.windDirection;
+    wind = glm::length(wind) > 0.0f ? glm::normalize(wind) : glm::vec2(1.0f, 0.0f);
+    const float cosine = glm::dot(k / kLength, wind);
+    float spreading = cosine * cosine;
+    if (cosine < 0.0f) {
+        spreading *= m_settings.upwindDamping;
+    }
+    const float suppression = std::exp(-kLength * kLength * m_settings.smallWaveLength * m_settings.smallWaveLength);
+
+    if (m_settings.spectrum == OceanSpectrum::PHILLIPS) {
+        const float largestWave = m_settings.windSpeed * m_settings.windSpeed / kGravity;
+        const float kl = kLength * largestWave;
+        const float k2 = kLength * kLength;
+        return m_settings.phillipsConstant * std::exp(-1.0f / (kl * kl)) / (k2 * k2) * spreading * suppression;
+    }
+
+    // JONSWAP frequency spectrum, moved to wave numbers through the dispersion relation
+    const float wind10 = std::max(m_settings.windSpeed, 0.1f);
+    const float fetch = std::max(m_settings.fetch, 1.0f);
+    const float alpha = 0.076f * std::pow(wind10 * wind10 / (fetch * kGravity), 0.22f);
+    const float peakOmega = 22.0f * std::cbrt(kGravity * kGravity / (wind10 * fetch));
+    const float omega = dispersion(kLength);
+    const float sigma = omega <= peakOmega ? 0.07f : 0.09f;
+    const float peakDelta = (omega - peakOmega) / (sigma * peakOmega);
+    const float peakShape = std::pow(m_settings.peakEnhancement, std::exp(-0.5f * peakDelta * peakDelta));
+    const float ratio = peakOmega / omega;
+    const float omegaSpectrum = alpha * kGravity * kGravity / std::pow(omega, 5.0f)
+                              * std::exp(-1.25f * ratio * ratio * ratio * ratio) * peakShape;
+
+    float dOmegaDk = kGravity / (2.0f * omega);
+    if (m_settings.depth > 0.0f) {
+        const float kd = kLength * m_settings.depth;
+        const float sech = 1.0f / std::cosh(kd);
+        dOmegaDk = kGravity * (std::tanh(kd) + kd * sech * sech) / (2.0f * omega);
+    }
+    // (2 / pi) cos^2 integrates to one over the downwind half plane
+    return omegaSpectrum * dOmegaDk / kLength * (2.0f / kPi) * spreading * suppression;
+}
+
+void OceanSimulation::initializeSpectrum() {
+    const int n = m_fft.getSize();
+    const size_t count = static_cast<size_t>(n) * n;
+    const float dk = 2.0f * kPi / m_settings.patchSize;
+
+    m_h0.assign(count, glm::vec2(0.0f));
+    m_h0MinusConj.assign(count, glm::vec2(0.0f));
+    m_omega.assign(count, 0.0f);
+    m_expectedVariance = 0.0f;
+
+    std::mt19937 rng(m_settings.seed);
+    std::normal_distribution<float> gaussian(0.0f, 1.0f);
+    for (int z = 0; z < n; ++z) {
+        for (int x = 0; x < n; ++x) {
+            const size_t i = static_cast<size_t>(z) * n + x;
+            const glm::vec2 k(waveNumberAt(x), waveNumberAt(z));
+            // Nyquist waves have no distinct -k partner, so their derivatives would not be real
+            const bool nyquist = x == n / 2 || z == n / 2;
+            const float energy = nyquist ? 0.0f : evaluateSpectrum(k) * dk * dk;
+            // E|h0|^2 = energy / 2 (two unit gaussians), so h0(k) and conj(h0(-k)) together carry the energy
+            const float amplitude = 0.5f * std::sqrt(energy);
+            const float xi0 = gaussian(rng);
+            const float xi1 = gaussian(rng);
+            m_h0[i] = glm::vec2(xi0, xi1) * amplitude;
+            m_omega[i] = dispersion(glm::length(k));
+            m_expectedVariance += energy;
+        }
+    }
+    for (int z = 0; z < n; ++z) {
+        for (int x = 0; x < n; ++x) {
+            const glm::vec2& mirrored = m_h0[static_cast<size_t>((n - z) % n) * n + (n - x) % n];
+            m_h0MinusConj[static_cast<size_t>(z) * n + x] = glm::vec2(mirrored.x, -mirrored.y);
+        }
+    }
+
+    for (int plane = 0; plane < 4; ++plane) {
+        m_real[plane].assign(count, 0.0f);
+        m_imag[plane].assign(count, 0.0f);
+    }
+    m_displacement.resize(n, n);
+    m_normals.resize(n, n, glm::vec4(0.0f, 1.0f, 0.0f, 0.0f));
+}
+
+void OceanSimulation::update(float time) {
+    const int n = m_fft.getSize();
+
+    // Advance every wave analytically and build the packed spectra:
+    // (height + i dx), (dz + i slopeX), (slopeZ + i dxx), (dzz + i dxz)
+    Parallel::forRange(0, n, kRowGrain, [&](int rowBegin, int rowEnd) {
+        for (int z = rowBegin; z < rowEnd; ++z) {
+            const float kz = waveNumberAt(z);
+            for (int x = 0; x < n; ++x) {
+                const size_t i = static_cast<size_t>(z) * n + x;
+                const float kx = waveNumberAt(x);
+                const float kLength = std::sqrt(kx * kx + kz * kz);
+                const float kInv = kLength > 0.0f ? 1.0f / kLength : 0.0f;
+
+                const float c = std::cos(m_omega[i] * time);
+                const float s = std::sin(m_omega[i] * time);
+                const glm::vec2& a = m_h0[i];
+                const glm::vec2& b = m_h0MinusConj[i];
+                const float hr = a.x * c - a.y * s + b.x * c + b.y * s;
+                const float hi = a.x * s + a.y * c - b.x * s + b.y * c;
+
+                // -i k / |k| h and i k h
+                const float dxr = hi * kx * kInv, dxi = -hr * kx * kInv;
+                const float dzr = hi * kz * kInv, dzi = -hr * kz * kInv;
+                const float sxr = -hi * kx, sxi = hr * kx;
+                const float szr = -hi * kz, szi = hr * kz;
+                // k k^T / |k| h
+                const float fxx = kx * kx * kInv, fzz = kz * kz * kInv, fxz = kx * kz * kInv;
+
+                // A + iB for real fields A and B
+                m_real[0][i] = hr - dxi;
+                m_imag[0][i] = hi + dxr;
+                m_real[1][i] = dzr - sxi;
+                m_imag[1][i] = dzi + sxr;
+                m_real[2][i] = szr - hi * fxx;
+                m_imag[2][i] = szi + hr * fxx;
+                m_real[3][i] = hr * fzz - hi * fxz;
+                m_imag[3][i] = hi * fzz + hr * fxz;
+            }
+        }
+    });
+
+    for (int plane = 0; plane < 4; ++plane) {
+        m_fft.inverse(m_real[plane].data(), m_imag[plane].data());
+    }
+
+    const float lambda = m_settings.choppiness;
+    Parallel::forRange(0, n, kRowGrain, [&](int rowBegin, int rowEnd) {
+        for (int z = rowBegin; z < rowEnd; ++z) {
+            glm::vec4* displacement = m_displacement.getRow(z);
+            glm::vec4* normals = m_normals.getRow(z);
+            for (int x = 0; x < n; ++x) {
+                const size_t i = static_cast<size_t>(z) * n + x;
+                const float dxx = lambda * m_imag[2][i];
+                const float dzz = lambda * m_real[3][i];
+                const float dxz = lambda * m_imag[3][i];
+                const float jacobian = (1.0f + dxx) * (1.0f + dzz) - dxz * dxz;
+                displacement[x] = glm::vec4(lambda * m_imag[0][i], m_real[0][i], lambda * m_real[1][i], jacobian);
+
+                const glm::vec3 normal = glm::normalize(glm::vec3(-m_imag[1][i], 1.0f, -m_real[2][i]));
+                normals[x] = glm::vec4(normal, 0.0f);
+            }
+        }
+    });
+}
+
+glm::vec3 OceanSimulation::sampleDisplacement(const glm::vec2& worldXZ) const {
+    const int n = m_fft.getSize();
+    const float gx = worldXZ.x / m_settings.patchSize * static_cast<float>(n);
+    const float gz = worldXZ.y / m_settings.patchSize * static_cast<float>(n);
+    const float fx = std::floor(gx);
+    const float fz = std::floor(gz);
+    const float tx = gx - fx;
+    const float tz = gz - fz;
+    auto wrap = [n](float v) { return ((static_cast<int>(v) % n) + n) % n; };
+    const int x0 = wrap(fx), x1 = (x0 + 1) % n;
+    const int z0 = wrap(fz), z1 = (z0 + 1) % n;
+
+    const glm::vec4 bottom = glm::mix(m_displacement.at(x0, z0), m_displacement.at(x1, z0), tx);
+    const glm::vec4 top = glm::mix(m_displacement.at(x0, z1), m_displacement.at(x1, z1), tx);
+    const glm::vec4 value = glm::mix(bottom, top, tz);
+    return glm::vec3(value.x, value.y, value.z);
+}
+
+void OceanSimulation::encodeWaterMaps(std::vector<unsigned char>& dudvMap, std::vector<unsigned char>& normalMap) const {
+    const int n = m_fft.getSize();
+    dudvMap.resize(static_cast<size_t>(n) * n * 4);
+    normalMap.resize(dudvMap.size());
+    Parallel::forRange(0, n, kRowGrain, [&](int rowBegin, int rowEnd) {
+        for (int z = rowBegin; z < rowEnd; ++z) {
+            const glm::vec4* displacement = m_displacement.getRow(z);
+            const glm::vec4* normals = m_normals.getRow(z);
+            for (int x = 0; x < n; ++x) {
+                const size_t o = (static_cast<size_t>(z) * n + x) * 4;
+                const glm::vec4& normal = normals[x];
+                const float slopeX = -normal.x / normal.y;
+                const float slopeZ = -normal.z / normal.y;
+                dudvMap[o + 0] = toByte(slopeX * 0.5f + 0.5f);
+                dudvMap[o + 1] = toByte(slopeZ * 0.5f + 0.5f);
+                dudvMap[o + 2] = toByte(1.0f - displacement[x].w);
+                dudvMap[o + 3] = 255;
+
+                // The water shader decodes (r * 2 - 1, b * 3, g * 2 - 1)
+                normalMap[o + 0] = toByte(normal.x * 0.5f + 0.5f);
+                normalMap[o + 1] = toByte(normal.z * 0.5f + 0.5f);
+                normalMap[o + 2] = toByte(normal.y / 3.0f);
+                normalMap[o + 3] = 255;
+            }
+        }
+    });
+}
+
+} // namespace ElementalRenderer
@@ -0,0 +1,365 @@
+/**
+ * @file PainterlyFilter.cpp
+ * @brief Implementation of the anisotropic Kuwahara filter
+ */
+
+#include "Headless/PainterlyFilter.h"
+#include "Headless/CPUPostProcessor.h"
+#include "Headless/Parallel.h"
+#include "Headless/PixelKernels.h"
+#include "Headless/SIMD.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace ElementalRenderer {
+
+using SIMD::Float4;
+using PixelKernels::boxLine;
+using PixelKernels::clampIndex;
+
+namespace {
+
+const int kRowGrain = 8;
+const int kMaxFrames = 8;
+const int kMaxLevels = 4;
+
+// Smallest tile side in units of the canvas margin. Each side of a tile then
+// carries at most a quarter of its size in margin, so the canvas stays within
+// about 2.25x the tile area (before rotation) whatever the radius.
+const int kTileMarginRatio = 4;
+
+// Keeps sector weights finite in flat regions, where all sectors then blend equally
+const float kVarianceEpsilon = 1e-4f;
+
+// Bilinear lookup in pixel space (integer coordinates are texel centers), clamp-to-edge
+inline Float4 sampleBilinear(const glm::vec4* data, int width, int height, float x, float y) {
+    const float fx = std::floor(x);
+    const float fy = std::floor(y);
+    const int ix = static_cast<int>(fx);
+    const int iy = static_cast<int>(fy);
+    const int x0 = clampIndex(ix, width), x1 = clampIndex(ix + 1, width);
+    const int y0 = clampIndex(iy, height), y1 = clampIndex(iy + 1, height);
+    const glm::vec4* row0 = data + static_cast<size_t>(y0) * width;
+    const glm::vec4* row1 = data + static_cast<size_t>(y1) * width;
+    const Float4 tx = Float4::splat(x - fx);
+    Float4 top = SIMD::mix(Float4::load(row0[x0]), Float4::load(row0[x1]), tx);
+    Float4 bottom = SIMD::mix(Float4::load(row1[x0]), Float4::load(row1[x1]), tx);
+    return SIMD::mix(top, bottom, Float4::splat(y - fy));
+}
+
+inline int canvasMargin(int largestHalf) {
+    // Sector lookups reach 2 * half from a pixel; one extra texel covers bilinear taps
+    return 2 * largestHalf + 2;
+}
+
+// One quantized filter shape: frame rotation plus sector box half-sizes in frame axes
+struct SectorShape {
+    int frame;
+    int halfU;
+    int halfV;
+};
+
+struct FilterContext {
+    const Image* prepared;          // rgb plus |rgb|^2 in w
+    const Image* source;
+    Image* result;
+    std::vector<std::uint8_t> shapeIndex;
+    std::vector<SectorShape> shapes;
+    std::vector<float> cosines;
+    std::vector<float> sines;
+    float sharpness;
+    int tileSize;
+};
+
+// Canvas in frame coordinates (u, v) covering a tile plus margin
+struct Canvas {
+    int u0 = 0;
+    int v0 = 0;
+    int width = 0;
+    int height = 0;
+    std::vector<glm::vec4> pixels;
+};
+
+void buildCanvas(const FilterContext& ctx, int frame, int x0, int y0, int x1, int y1, int margin, Canvas& canvas) {
+    const float c = ctx.cosines[frame];
+    const float s = ctx.sines[frame];
+
+    float uMin = 1e30f, uMax = -1e30f, vMin = 1e30f, vMax = -1e30f;
+    const float xs[2] = {static_cast<float>(x0), static_cast<float>(x1 - 1)};
+    const float ys[2] = {static_cast<float>(y0), static_cast<float>(y1 - 1)};
+    for (float x : xs) {
+        for (float y : ys) {
+            const float u = x * c + y * s;
+            const float v = -x * s + y * c;
+            uMin = std::min(uMin, u);
+            uMax = std::max(uMax, u);
+            vMin = std::min(vMin, v);
+            vMax = std::max(vMax, v);
+        }
+    }
+
+    canvas.u0 = static_cast<int>(std::floor(uMin)) - margin;
+    canvas.v0 = static_cast<int>(std::floor(vMin)) - margin;
+    canvas.width = static_cast<int>(std::ceil(uMax)) + margin - canvas.u0 + 1;
+    canvas.height = static_cast<int>(std::ceil(vMax)) + margin - canvas.v0 + 1;
+    canvas.pixels.resize(static_cast<size_t>(canvas.width) * canvas.height);
+
+    const Image& prepared = *ctx.prepared;
+    for (int j = 0; j < canvas.height; ++j) {
+        const float v = static_cast<float>(canvas.v0 + j);
+        glm::vec4* row = &canvas.pixels[static_cast<size_t>(j) * canvas.width];
+        for (int i = 0; i < canvas.width; ++i) {
+            const float u = static_cast<float>(canvas.u0 + i);
+            sampleBilinear(prepared.getRow(0), prepared.getWidth(), prepared.getHeight(),
+                           u * c - v * s, u * s + v * c).store(row[i]);
+        }
+    }
+}
+
+void boxFilterCanvas(const Canvas& canvas, int halfU, int halfV, std::vector<glm::vec4>& scratch,
+                     std::vector<glm::vec4>& out) {
+    scratch.resize(canvas.pixels.size());
+    out.resize(canvas.pixels.size());
+    for (int j = 0; j < canvas.height; ++j) {
+        const size_t offset = static_cast<size_t>(j) * canvas.width;
+        boxLine(&canvas.pixels[offset], &scratch[offset], 1, canvas.width, halfU);
+    }
+    for (int i = 0; i < canvas.width; ++i) {
+        boxLine(&scratch[i], &out[i], canvas.width, canvas.height, halfV);
+    }
+}
+
+void filterTile(const FilterContext& ctx, int tile, int tilesX) {
+    const Image& source = *ctx.source;
+    const int width = source.getWidth();
+    const int height = source.getHeight();
+    const int x0 = (tile % tilesX) * ctx.tileSize;
+    const int y0 = (tile / tilesX) * ctx.tileSize;
+    const int x1 = std::min(width, x0 + ctx.tileSize);
+    const int y1 = std::min(height, y0 + ctx.tileSize);
+
+    std::uint64_t used = 0;
+    for (int y = y0; y < y1; ++y) {
+        for (int x = x0; x < x1; ++x) {
+            used |= std::uint64_t(1) << ctx.shapeIndex[static_cast<size_t>(y) * width + x];
+        }
+    }
+
+    Canvas canvas;
+    std::vector<glm::vec4> scratch, filtered;
+    const float q = ctx.sharpness * 0.5f;
+
+    for (int frame = 0; frame < static_cast<int>(ctx.cosines.size()); ++frame) {
+        int largestHalf = 0;
+        for (size_t shape = 0; shape < ctx.shapes.size(); ++shape) {
+            if ((used >> shape) & 1u && ctx.shapes[shape].frame == frame) {
+                largestHalf = std::max(largestHalf, std::max(ctx.shapes[shape].halfU, ctx.shapes[shape].halfV));
+            }
+        }
+        if (largestHalf == 0) {
+            continue;
+        }
+
+        buildCanvas(ctx, frame, x0, y0, x1, y1, canvasMargin(largestHalf), canvas);
+        const float c = ctx.cosines[frame];
+        const float s = ctx.sines[frame];
+
+        for (size_t shape = 0; shape < ctx.shapes.size(); ++shape) {
+            if (!((used >> shape) & 1u) || ctx.shapes[shape].frame != frame) {
+                continue;
+            }
+            const int halfU = ctx.shapes[shape].halfU;
+            const int halfV = ctx.shapes[shape].halfV;
+            boxFilterCanvas(canvas, halfU, halfV, scratch, filtered);
+
+            for (int y = y0; y < y1; ++y) {
+                const std::uint8_t* shapeRow = &ctx.shapeIndex[static_cast<size_t>(y) * width];
+                glm::vec4* out = ctx.result->getRow(y);
+                const glm::vec4* in = source.getRow(y);
+                for (int x = x0; x < x1; ++x) {
+                    if (shapeRow[x] != shape) {
+                        continue;
+                    }
+                    const float cu = static_cast<float>(x) * c + static_cast<float>(y) * s - canvas.u0;
+                    const float cv = -static_cast<float>(x) * s + static_cast<float>(y) * c - canvas.v0;
+
+                    Float4 means[4];
+                    float variances[4];
+                    float smallest = 1e30f;
+                    for (int k = 0; k < 4; ++k) {
+                        const float du = (k & 1) ? static_cast<float>(halfU) : -static_cast<float>(halfU);
+                        const float dv = (k & 2) ? static_cast<float>(halfV) : -static_cast<float>(halfV);
+                        means[k] = sampleBilinear(filtered.data(), canvas.width, canvas.height, cu + du, cv + dv);
+                        const float meanSquare = means[k].lane(3);
+                        variances[k] = std::max(meanSquare - SIMD::dot3(means[k], means[k]).lane(0), 0.0f);
+                        smallest = std::min(smallest, variances[k]);
+                    }
+
+                    Float4 sum = Float4::splat(0.0f);
+                    float weightSum = 0.0f;
+                    for (int k = 0; k < 4; ++k) {
+                        const float weight = std::pow((smallest + kVarianceEpsilon) / (variances[k] + kVarianceEpsilon), q);
+                        sum = sum + means[k] * Float4::splat(weight);
+                        weightSum += weight;
+                    }
+                    SIMD::withW(sum / Float4::splat(weightSum), Float4::load(in[x])).store(out[x]);
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+PainterlySettings PainterlySettings::illustration(float edgeSoftness) {
+    edgeSoftness = std::min(std::max(edgeSoftness, 0.0f), 1.0f);
+    PainterlySettings settings;
+    settings.radius = 4 + static_cast<int>(std::round(4.0f * edgeSoftness));
+    settings.sharpness = 12.0f - 8.0f * edgeSoftness;
+    settings.tensorSigma = 2.0f;
+    return settings;
+}
+
+PainterlySettings PainterlySettings::watercolor(float wetness) {
+    wetness = std::min(std::max(wetness, 0.0f), 1.0f);
+    PainterlySettings settings;
+    settings.radius = 6 + static_cast<int>(std::round(8.0f * wetness));
+    settings.sharpness = 8.0f - 5.0f * wetness;
+    settings.tensorSigma = 3.0f;
+    settings.alpha = 0.5f;
+    return settings;
+}
+
+void PainterlyFilter::computeStructureTensor(const Image& source, float sigma, Image& tensor) {
+    const int width = source.getWidth();
+    const int height = source.getHeight();
+    Image raw(width, height);
+
+    Parallel::forRange(0, height, kRowGrain, [&](int rowBegin, int rowEnd) {
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            const glm::vec4* above = source.getRow(clampIndex(y - 1, height));
+            const glm::vec4* row = source.getRow(y);
+            const glm::vec4* below = source.getRow(clampIndex(y + 1, height));
+            glm::vec4* out = raw.getRow(y);
+            for (int x = 0; x < width; ++x) {
+                const int l = clampIndex(x - 1, width);
+                const int r = clampIndex(x + 1, width);
+                // Sobel, scaled so a unit ramp has unit gradient
+                Float4 gx = (Float4::load(above[r]) + Float4::load(row[r]) * Float4::splat(2.0f) + Float4::load(below[r])
+                           - Float4::load(above[l]) - Float4::load(row[l]) * Float4::splat(2.0f) - Float4::load(below[l]))
+                          * Float4::splat(0.125f);
+                Float4 gy = (Float4::load(below[l]) + Float4::load(below[x]) * Float4::splat(2.0f) + Float4::load(below[r])
+                           - Float4::load(above[l]) - Float4::load(above[x]) * Float4::splat(2.0f) - Float4::load(above[r]))
+                          * Float4::splat(0.125f);
+                out[x] = glm::vec4(SIMD::dot3(gx, gx).lane(0), SIMD::dot3(gx, gy).lane(0), SIMD::dot3(gy, gy).lane(0), 0.0f);
+            }
+        }
+    });
+
+    CPUPostProcessor::gaussianBlur(raw, tensor, sigma);
+}
+
+void PainterlyFilter::apply(const Image& source, Image& destination, const PainterlySettings& settings) {
+    const int width = source.getWidth();
+    const int height = source.getHeight();
+    if (source.isEmpty()) {
+        destination = source;
+        return;
+    }
+
+    const int frames = std::min(std::max(settings.orientationFrames, 1), kMaxFrames);
+    const int levels = std::min(std::max(settings.anisotropyLevels, 1), kMaxLevels);
+    const int radius = std::max(settings.radius, 1);
+    const float alpha = std::max(settings.alpha, 1e-3f);
+    const float pi = 3.14159265358979f;
+
+    FilterContext ctx;
+    ctx.source = &source;
+    ctx.sharpness = std::max(settings.sharpness, 0.0f);
+    for (int frame = 0; frame < frames; ++frame) {
+        const float angle = static_cast<float>(frame) * pi / static_cast<float>(2 * frames);
+        ctx.cosines.push_back(std::cos(angle));
+        ctx.sines.push_back(std::sin(angle));
+    }
+
+    // Shape index = (frame * 2 + swapped) * levels + level; at most 64 shapes
+    for (int frame = 0; frame < frames; ++frame) {
+        for (int swapped = 0; swapped < 2; ++swapped) {
+            for (int level = 0; level < levels; ++level) {
+                const float anisotropy = levels > 1 ? static_cast<float>(level) / (levels - 1) : 0.0f;
+                const float major = radius * (alpha + anisotropy) / alpha;
+                const float minor = radius * alpha / (alpha + anisotropy);
+                const int halfMajor = std::max(1, static_cast<int>(std::round(major * 0.5f)));
+                const int halfMinor = std::max(1, static_cast<int>(std::round(minor * 0.5f)));
+                ctx.shapes.push_back(swapped ? SectorShape{frame, halfMinor, halfMajor}
+                                             : SectorShape{frame, halfMajor, halfMinor});
+            }
+        }
+    }
+
+    // Large radii get larger tiles, so the margin does not dominate the canvas
+    int largestHalf = 0;
+    for (const SectorShape& shape : ctx.shapes) {
+        largestHalf = std::max(largestHalf, std::max(shape.halfU, shape.halfV));
+    }
+    ctx.tileSize = std::max(std::max(settings.tileSize, 16), kTileMarginRatio * canvasMargin(largestHalf));
+
+    Image tensor;
+    computeStructureTensor(source, settings.tensorSigma, tensor);
+
+    // Quantize the edge tangent and anisotropy of every pixel
+    ctx.shapeIndex.resize(static_cast<size_t>(width) * height);
+    const float binWidth = pi / static_cast<float>(2 * frames);
+    Parallel::forRange(0, height, kRowGrain, [&](int rowBegin, int rowEnd) {
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            const glm::vec4* row = tensor.getRow(y);
+            for (int x = 0; x < width; ++x) {
+                const float e = row[x].x, f = row[x].y, g = row[x].z;
+                const float root = std::sqrt((e - g) * (e - g) + 4.0f * f * f);
+                const float lambda1 = 0.5f * (e + g + root);
+                const float lambda2 = 0.5f * (e + g - root);
+                const float anisotropy = lambda1 + lambda2 > 1e-8f ? (lambda1 - lambda2) / (lambda1 + lambda2) : 0.0f;
+
+                // The gradient direction is 0.5 * atan2(2F, E - G); edges run perpendicular to it
+                float tangent = 0.5f * std::atan2(2.0f * f, e - g) + 0.5f * pi;
+                int bin = static_cast<int>(std::round(tangent / binWidth)) % (2 * frames);
+                if (bin < 0) {
+                    bin += 2 * frames;
+                }
+                const int frame = bin % frames;
+                const int swapped = bin >= frames ? 1 : 0;
+                const int level = static_cast<int>(std::round(anisotropy * (levels - 1)));
+                ctx.shapeIndex[static_cast<size_t>(y) * width + x] =
+                    static_cast<std::uint8_t>((frame * 2 + swapped) * levels + level);
+            }
+        }
+    });
+
+    Image prepared(width, height);
+    Parallel::forRange(0, height, kRowGrain, [&](int rowBegin, int rowEnd) {
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            const glm::vec4* in = source.getRow(y);
+            glm::vec4* out = prepared.getRow(y);
+            for (int x = 0; x < width; ++x) {
+                out[x] = glm::vec4(in[x].x, in[x].y, in[x].z,
+                                   in[x].x * in[x].x + in[x].y * in[x].y + in[x].z * in[x].z);
+            }
+        }
+    });
+    ctx.prepared = &prepared;
+
+    Image result(width, height);
+    ctx.result = &result;
+
+    const int tilesX = (width + ctx.tileSize - 1) / ctx.tileSize;
+    const int tilesY = (height + ctx.tileSize - 1) / ctx.tileSize;
+    Parallel::forEach(0, tilesX * tilesY, [&](int tile) {
+        filterTile(ctx, tile, tilesX);
+    });
+
+    destination = std::move(result);
+}
+
+} // namespace ElementalRenderer
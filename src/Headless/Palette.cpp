@@ -0,0 +1,276 @@
+/**
+ * @file Palette.cpp
+ * @brief Implementation of palette extraction and the palette LUT
+ */
+
+#include "Headless/Palette.h"
+#include "Headless/Parallel.h"
+#include <algorithm>
+#include <iostream>
+#include <limits>
+
+namespace ElementalRenderer {
+
+namespace {
+
+// Upper bound on colors fed to the extractors; larger images are subsampled
+const size_t kMaxSamples = 1u << 18;
+
+// Samples per k-means block; fixed so the merge order never depends on threads
+const int kSamplesPerBlock = 4096;
+
+inline float distanceSquared(const glm::vec3& a, const glm::vec3& b) {
+    glm::vec3 d = a - b;
+    return d.x * d.x + d.y * d.y + d.z * d.z;
+}
+
+int clampCount(int count) {
+    return std::min(std::max(count, 1), Palette::kMaxColors);
+}
+
+std::vector<glm::vec3> collectSamples(const Image& reference) {
+    const size_t total = static_cast<size_t>(reference.getWidth()) * reference.getHeight();
+    const size_t stride = std::max<size_t>(1, (total + kMaxSamples - 1) / kMaxSamples);
+
+    std::vector<glm::vec3> samples;
+    samples.reserve(total / stride + 1);
+    const glm::vec4* pixels = reference.getRow(0);
+    for (size_t i = 0; i < total; i += stride) {
+        const glm::vec4& p = pixels[i];
+        if (p.w > 0.0f) {
+            samples.emplace_back(glm::clamp(glm::vec3(p.x, p.y, p.z), glm::vec3(0.0f), glm::vec3(1.0f)));
+        }
+    }
+    return samples;
+}
+
+struct ColorBox {
+    size_t begin;
+    size_t end;
+    int axis;
+    float range;
+};
+
+ColorBox measureBox(const std::vector<glm::vec3>& samples, size_t begin, size_t end) {
+    glm::vec3 lo(std::numeric_limits<float>::max());
+    glm::vec3 hi(std::numeric_limits<float>::lowest());
+    for (size_t i = begin; i < end; ++i) {
+        lo = glm::min(lo, samples[i]);
+        hi = glm::max(hi, samples[i]);
+    }
+    glm::vec3 extent = hi - lo;
+    int axis = 0;
+    if (extent.y > extent[axis]) axis = 1;
+    if (extent.z > extent[axis]) axis = 2;
+    return {begin, end, axis, extent[axis]};
+}
+
+std::vector<glm::vec3> medianCutSamples(std::vector<glm::vec3>& samples, int count) {
+    std::vector<ColorBox> boxes;
+    if (samples.empty()) {
+        return {};
+    }
+    boxes.push_back(measureBox(samples, 0, samples.size()));
+
+    while (static_cast<int>(boxes.size()) < count) {
+        // Split the box with the widest extent, weighting by population so
+        // dominant colors receive more entries
+        int best = -1;
+        float bestScore = 0.0f;
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            if (boxes[i].end - boxes[i].begin < 2 || boxes[i].range <= 0.0f) {
+                continue;
+            }
+            float score = boxes[i].range * static_cast<float>(boxes[i].end - boxes[i].begin);
+            if (score > bestScore) {
+                bestScore = score;
+                best = static_cast<int>(i);
+            }
+        }
+        if (best < 0) {
+            break;
+        }
+
+        ColorBox box = boxes[best];
+        size_t middle = box.begin + (box.end - box.begin) / 2;
+        const int axis = box.axis;
+        std::nth_element(samples.begin() + box.begin, samples.begin() + middle, samples.begin() + box.end,
+                         [axis](const glm::vec3& a, const glm::vec3& b) { return a[axis] < b[axis]; });
+
+        // Keep equal values on one side so a single color never spans two boxes
+        const float pivot = samples[middle][axis];
+        auto first = samples.begin() + box.begin;
+        auto last = samples.begin() + box.end;
+        auto split = std::partition(first, last, [axis, pivot](const glm::vec3& c) { return c[axis] < pivot; });
+        if (split == first) {
+            split = std::partition(first, last, [axis, pivot](const glm::vec3& c) { return c[axis] <= pivot; });
+        }
+        middle = static_cast<size_t>(split - samples.begin());
+
+        boxes[best] = measureBox(samples, box.begin, middle);
+        boxes.push_back(measureBox(samples, middle, box.end));
+    }
+
+    std::vector<glm::vec3> colors;
+    colors.reserve(boxes.size());
+    for (const auto& box : boxes) {
+        glm::vec3 sum(0.0f);
+        for (size_t i = box.begin; i < box.end; ++i) {
+            sum += samples[i];
+        }
+        colors.push_back(sum / static_cast<float>(box.end - box.begin));
+    }
+    return colors;
+}
+
+struct ClusterSums {
+    std::vector<glm::vec3> sums;
+    std::vector<int> counts;
+};
+
+} // namespace
+
+Palette::Palette() {
+}
+
+Palette::Palette(const std::vector<glm::vec3>& colors)
+    : m_colors(colors) {
+    if (m_colors.size() > static_cast<size_t>(kMaxColors)) {
+        std::cerr << "Warning: Palette truncated to " << kMaxColors << " colors" << std::endl;
+        m_colors.resize(kMaxColors);
+    }
+}
+
+int Palette::findNearest(const glm::vec3& color) const {
+    int best = -1;
+    float bestDistance = std::numeric_limits<float>::max();
+    for (size_t i = 0; i < m_colors.size(); ++i) {
+        float d = distanceSquared(color, m_colors[i]);
+        if (d < bestDistance) {
+            bestDistance = d;
+            best = static_cast<int>(i);
+        }
+    }
+    return best;
+}
+
+Palette Palette::cga() {
+    return Palette({
+        glm::vec3(0.0f, 0.0f, 0.0f),    glm::vec3(0.0f, 0.0f, 0.67f),
+        glm::vec3(0.0f, 0.67f, 0.0f),   glm::vec3(0.0f, 0.67f, 0.67f),
+        glm::vec3(0.67f, 0.0f, 0.0f),   glm::vec3(0.67f, 0.0f, 0.67f),
+        glm::vec3(0.67f, 0.33f, 0.0f),  glm::vec3(0.67f, 0.67f, 0.67f),
+        glm::vec3(0.33f, 0.33f, 0.33f), glm::vec3(0.33f, 0.33f, 1.0f),
+        glm::vec3(0.33f, 1.0f, 0.33f),  glm::vec3(0.33f, 1.0f, 1.0f),
+        glm::vec3(1.0f, 0.33f, 0.33f),  glm::vec3(1.0f, 0.33f, 1.0f),
+        glm::vec3(1.0f, 1.0f, 0.33f),   glm::vec3(1.0f, 1.0f, 1.0f)
+    });
+}
+
+Palette Palette::medianCut(const Image& reference, int count) {
+    std::vector<glm::vec3> samples = collectSamples(reference);
+    return Palette(medianCutSamples(samples, clampCount(count)));
+}
+
+Palette Palette::kMeans(const Image& reference, int count, int maxIterations) {
+    std::vector<glm::vec3> samples = collectSamples(reference);
+    std::vector<glm::vec3> seeds = samples;
+    std::vector<glm::vec3> centers = medianCutSamples(seeds, clampCount(count));
+    if (centers.empty()) {
+        return Palette();
+    }
+
+    const int k = static_cast<int>(centers.size());
+    const int sampleCount = static_cast<int>(samples.size());
+    const int blocks = (sampleCount + kSamplesPerBlock - 1) / kSamplesPerBlock;
+    std::vector<ClusterSums> partials(blocks);
+
+    for (int iteration = 0; iteration < maxIterations; ++iteration) {
+        Parallel::forEach(0, blocks, [&](int block) {
+            ClusterSums& partial = partials[block];
+            partial.sums.assign(k, glm::vec3(0.0f));
+            partial.counts.assign(k, 0);
+
+            const int end = std::min(sampleCount, (block + 1) * kSamplesPerBlock);
+            for (int i = block * kSamplesPerBlock; i < end; ++i) {
+                int nearest = 0;
+                float nearestDistance = distanceSquared(samples[i], centers[0]);
+                for (int c = 1; c < k; ++c) {
+                    float d = distanceSquared(samples[i], centers[c]);
+                    if (d < nearestDistance) {
+                        nearestDistance = d;
+                        nearest = c;
+                    }
+                }
+                partial.sums[nearest] += samples[i];
+                partial.counts[nearest] += 1;
+            }
+        });
+
+        float largestShift = 0.0f;
+        for (int c = 0; c < k; ++c) {
+            glm::vec3 sum(0.0f);
+            int population = 0;
+            for (const auto& partial : partials) {
+                sum += partial.sums[c];
+                population += partial.counts[c];
+            }
+            // Empty clusters keep their previous center
+            if (population > 0) {
+                glm::vec3 updated = sum / static_cast<float>(population);
+                largestShift = std::max(largestShift, distanceSquared(updated, centers[c]));
+                centers[c] = updated;
+            }
+        }
+
+        if (largestShift < 1e-10f) {
+            break;
+        }
+    }
+
+    return Palette(centers);
+}
+
+PaletteLUT::PaletteLUT()
+    : m_resolution(0) {
+}
+
+PaletteLUT::PaletteLUT(const Palette& palette, int resolution)
+    : m_resolution(0) {
+    build(palette, resolution);
+}
+
+void PaletteLUT::build(const Palette& palette, int resolution) {
+    m_palette = palette;
+    m_indices.clear();
+    m_resolution = 0;
+    if (palette.isEmpty()) {
+        std::cerr << "Warning: Cannot build a palette LUT from an empty palette" << std::endl;
+        return;
+    }
+
+    m_resolution = std::min(std::max(resolution, 2), 256);
+    m_indices.resize(static_cast<size_t>(m_resolution) * m_resolution * m_resolution);
+
+    const float cell = 1.0f / static_cast<float>(m_resolution);
+    Parallel::forEach(0, m_resolution, [&](int b) {
+        for (int g = 0; g < m_resolution; ++g) {
+            for (int r = 0; r < m_resolution; ++r) {
+                glm::vec3 center((r + 0.5f) * cell, (g + 0.5f) * cell, (b + 0.5f) * cell);
+                m_indices[cellIndex(r, g, b)] = static_cast<std::uint8_t>(m_palette.findNearest(center));
+            }
+        }
+    });
+}
+
+void PaletteLUT::toRGB8(std::vector<unsigned char>& out) const {
+    out.resize(m_indices.size() * 3);
+    for (size_t i = 0; i < m_indices.size(); ++i) {
+        const glm::vec3& c = m_palette[m_indices[i]];
+        out[i * 3 + 0] = static_cast<unsigned char>(glm::clamp(c.x, 0.0f, 1.0f) * 255.0f + 0.5f);
+        out[i * 3 + 1] = static_cast<unsigned char>(glm::clamp(c.y, 0.0f, 1.0f) * 255.0f + 0.5f);
+        out[i * 3 + 2] = static_cast<unsigned char>(glm::clamp(c.z, 0.0f, 1.0f) * 255.0f + 0.5f);
+    }
+}
+
+} // namespace ElementalRenderer
@@ -0,0 +1,209 @@
+/**
+ * @file Parallel.cpp
+ * @brief Implementation of the shared worker pool
+ */
+
+#include "Headless/Parallel.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ElementalRenderer {
+namespace Parallel {
+
+namespace {
+
+// One parallel loop invocation. Workers hold a reference while draining so a
+// late wake-up never touches the counters of a newer job.
+struct Job {
+    const std::function<void(int)>* chunkFunc = nullptr;
+    int chunkCount = 0;
+    std::atomic<int> nextChunk{0};
+    std::atomic<int> remaining{0};
+    std::mutex doneMutex;
+    std::condition_variable doneCondition;
+
+    void drain() {
+        int chunk;
+        while ((chunk = nextChunk.fetch_add(1)) < chunkCount) {
+            (*chunkFunc)(chunk);
+            if (remaining.fetch_sub(1) == 1) {
+                std::lock_guard<std::mutex> lock(doneMutex);
+                doneCondition.notify_all();
+            }
+        }
+    }
+};
+
+thread_local bool t_insideLoop = false;
+
+class WorkerPool {
+public:
+    static WorkerPool& instance() {
+        static WorkerPool pool;
+        return pool;
+    }
+
+    ~WorkerPool() {
+        stopWorkers();
+    }
+
+    unsigned int getThreadCount() const {
+        return m_threadCount.load();
+    }
+
+    void setThreadCount(unsigned int count) {
+        std::lock_guard<std::mutex> lock(m_submitMutex);
+        stopWorkers();
+        startWorkers(count);
+    }
+
+    void run(int chunkCount, const std::function<void(int)>& chunkFunc) {
+        if (chunkCount <= 0) {
+            return;
+        }
+
+        std::unique_lock<std::mutex> submit(m_submitMutex, std::defer_lock);
+        if (chunkCount == 1 || t_insideLoop || !submit.try_lock() || m_workers.empty()) {
+            runSerial(chunkCount, chunkFunc);
+            return;
+        }
+
+        auto job = std::make_shared<Job>();
+        job->chunkFunc = &chunkFunc;
+        job->chunkCount = chunkCount;
+        job->remaining = chunkCount;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_job = job;
+            ++m_generation;
+        }
+        m_wakeCondition.notify_all();
+
+        t_insideLoop = true;
+        job->drain();
+        t_insideLoop = false;
+
+        {
+            std::unique_lock<std::mutex> lock(job->doneMutex);
+            job->doneCondition.wait(lock, [&job]() { return job->remaining.load() == 0; });
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_job.reset();
+    }
+
+private:
+    std::vector<std::thread> m_workers;
+    std::atomic<unsigned int> m_threadCount{1};
+    std::mutex m_submitMutex;
+    std::mutex m_mutex;
+    std::condition_variable m_wakeCondition;
+    std::shared_ptr<Job> m_job;
+    unsigned long long m_generation = 0;
+    bool m_stopping = false;
+
+    WorkerPool() {
+        startWorkers(0);
+    }
+
+    static void runSerial(int chunkCount, const std::function<void(int)>& chunkFunc) {
+        bool wasInside = t_insideLoop;
+        t_insideLoop = true;
+        for (int chunk = 0; chunk < chunkCount; ++chunk) {
+            chunkFunc(chunk);
+        }
+        t_insideLoop = wasInside;
+    }
+
+    void startWorkers(unsigned int count) {
+        if (count == 0) {
+            count = std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        m_stopping = false;
+        for (unsigned int i = 1; i < count; ++i) {
+            m_workers.emplace_back([this]() { workerLoop(); });
+        }
+        m_threadCount = count;
+    }
+
+    void stopWorkers() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_wakeCondition.notify_all();
+
+        for (auto& worker : m_workers) {
+            worker.join();
+        }
+        m_workers.clear();
+    }
+
+    void workerLoop() {
+        t_insideLoop = true;
+        unsigned long long seenGeneration = 0;
+
+        for (;;) {
+            std::shared_ptr<Job> job;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_wakeCondition.wait(lock, [&]() {
+                    return m_stopping || (m_job && m_generation != seenGeneration);
+                });
+                if (m_stopping) {
+                    return;
+                }
+                seenGeneration = m_generation;
+                job = m_job;
+            }
+            job->drain();
+        }
+    }
+};
+
+} // namespace
+
+unsigned int getThreadCount() {
+    return WorkerPool::instance().getThreadCount();
+}
+
+void setThreadCount(unsigned int count) {
+    WorkerPool::instance().setThreadCount(count);
+}
+
+void forRange(int begin, int end, int grainSize, const std::function<void(int, int)>& body) {
+    if (end <= begin) {
+        return;
+    }
+
+    // Oversubscribe a little so uneven rows still balance across threads
+    const int count = end - begin;
+    const int targetChunks = static_cast<int>(getThreadCount()) * 4;
+    const int chunkSize = std::max(std::max(grainSize, 1), (count + targetChunks - 1) / targetChunks);
+    const int chunkCount = (count + chunkSize - 1) / chunkSize;
+
+    std::function<void(int)> chunkFunc = [&](int chunk) {
+        int chunkBegin = begin + chunk * chunkSize;
+        int chunkEnd = std::min(end, chunkBegin + chunkSize);
+        body(chunkBegin, chunkEnd);
+    };
+    WorkerPool::instance().run(chunkCount, chunkFunc);
+}
+
+void forEach(int begin, int end, const std::function<void(int)>& body) {
+    forRange(begin, end, 1, [&body](int chunkBegin, int chunkEnd) {
+        for (int i = chunkBegin; i < chunkEnd; ++i) {
+            body(i);
+        }
+    });
+}
+
+} // namespace Parallel
+} // namespace ElementalRenderer
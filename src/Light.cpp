@@ -6,10 +6,21 @@
 #include "Light.h"
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <cmath>
 #include <iostream>
 
 namespace ElementalRenderer {
 
+namespace {
+
+// Width axis of an area light: horizontal unless the light faces straight up or down
+glm::vec3 areaLightRight(const glm::vec3& direction) {
+    const glm::vec3 reference = std::abs(direction.y) < 0.999f ? glm::vec3(0.0f, 1.0f, 0.0f) : glm::vec3(0.0f, 0.0f, 1.0f);
+    return glm::normalize(glm::cross(reference, direction));
+}
+
+} // namespace
+
 Light::Light()
     : m_type(LightType::DIRECTIONAL)
     , m_color(1.0f, 1.0f, 1.0f)
@@ -106,6 +117,26 @@ std::shared_ptr<Light> Light::createSpotLight(
     return light;
 }
 
+std::shared_ptr<Light> Light::createAreaLight(
+    AreaLightShape shape,
+    const glm::vec3& position,
+    const glm::vec3& direction,
+    const glm::vec2& size,
+    const glm::vec3& color,
+    float intensity)
+{
+    auto light = std::make_shared<AreaLight>(
+        shape,
+        position,
+        direction,
+        size,
+        color,
+        intensity
+    );
+    
+    return light;
+}
+
 DirectionalLight::DirectionalLight()
     : Light(LightType::DIRECTIONAL)
     , m_direction(0.0f, -1.0f, 0.0f)
@@ -238,4 +269,76 @@ float SpotLight::getOuterAngle() const {
     return m_outerAngle;
 }
 
+// AreaLight implementation
+AreaLight::AreaLight()
+    : Light(LightType::AREA)
+    , m_shape(AreaLightShape::RECTANGLE)
+    , m_position(0.0f)
+    , m_direction(0.0f, -1.0f, 0.0f)
+    , m_size(1.0f)
+    , m_twoSided(false)
+{
+}
+
+AreaLight::AreaLight(AreaLightShape shape, const glm::vec3& position, const glm::vec3& direction,
+                     const glm::vec2& size, const glm::vec3& color, float intensity)
+    : Light(LightType::AREA)
+    , m_shape(shape)
+    , m_position(position)
+    , m_direction(glm::normalize(direction))
+    , m_size(glm::max(size, glm::vec2(0.0f)))
+    , m_twoSided(false)
+{
+    setColor(color);
+    setIntensity(intensity);
+}
+
+void AreaLight::setShape(AreaLightShape shape) {
+    m_shape = shape;
+}
+
+AreaLightShape AreaLight::getShape() const {
+    return m_shape;
+}
+
+void AreaLight::setPosition(const glm::vec3& position) {
+    m_position = position;
+}
+
+glm::vec3 AreaLight::getPosition() const {
+    return m_position;
+}
+
+void AreaLight::setDirection(const glm::vec3& direction) {
+    m_direction = glm::normalize(direction);
+}
+
+glm::vec3 AreaLight::getDirection() const {
+    return m_direction;
+}
+
+void AreaLight::setSize(const glm::vec2& size) {
+    m_size = glm::max(size, glm::vec2(0.0f));
+}
+
+glm::vec2 AreaLight::getSize() const {
+    return m_size;
+}
+
+void AreaLight::setTwoSided(bool twoSided) {
+    m_twoSided = twoSided;
+}
+
+bool AreaLight::isTwoSided() const {
+    return m_twoSided;
+}
+
+glm::vec3 AreaLight::getAxisX() const {
+    return areaLightRight(m_direction) * (0.5f * m_size.x);
+}
+
+glm::vec3 AreaLight::getAxisY() const {
+    return glm::cross(areaLightRight(m_direction), m_direction) * (0.5f * m_size.y);
+}
+
 } // namespace ElementalRenderer
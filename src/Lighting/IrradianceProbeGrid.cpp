@@ -0,0 +1,271 @@
+/**
+ * @file IrradianceProbeGrid.cpp
+ * @brief Implementation of the spherical-harmonic irradiance probe grid
+ */
+
+#include "Lighting/IrradianceProbeGrid.h"
+#include "PathTracing/PathTracer.h"
+#include "Headless/Parallel.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace ElementalRenderer {
+
+namespace {
+
+const float kPi = 3.14159265358979f;
+const float kGoldenAngle = 2.39996322972865f;
+const int kCoefficientCount = 9;
+const float kVisibilitySharpness = 100.0f;  // Cosine power spreading each hit distance over nearby texels
+const float kMaxDistanceScale = 1.5f;       // Distances are clamped to this many cell diagonals
+
+// Uniform directions on the sphere along a Fibonacci spiral
+glm::vec3 sphereDirection(int index, int count) {
+    const float z = 1.0f - (2.0f * index + 1.0f) / static_cast<float>(count);
+    const float radius = std::sqrt(std::max(1.0f - z * z, 0.0f));
+    const float phi = kGoldenAngle * static_cast<float>(index);
+    return glm::vec3(std::cos(phi) * radius, std::sin(phi) * radius, z);
+}
+
+float signNotZero(float value) {
+    return value >= 0.0f ? 1.0f : -1.0f;
+}
+
+// Octahedral mapping of unit directions to [0, 1]^2
+glm::vec2 octahedralEncode(const glm::vec3& direction) {
+    const float sum = std::abs(direction.x) + std::abs(direction.y) + std::abs(direction.z);
+    glm::vec2 p(direction.x / sum, direction.y / sum);
+    if (direction.z < 0.0f) {
+        p = glm::vec2((1.0f - std::abs(p.y)) * signNotZero(p.x), (1.0f - std::abs(p.x)) * signNotZero(p.y));
+    }
+    return p * 0.5f + glm::vec2(0.5f);
+}
+
+glm::vec3 octahedralDecode(const glm::vec2& uv) {
+    const glm::vec2 f = uv * 2.0f - glm::vec2(1.0f);
+    glm::vec3 n(f.x, f.y, 1.0f - std::abs(f.x) - std::abs(f.y));
+    const float t = std::max(-n.z, 0.0f);
+    n.x += n.x >= 0.0f ? -t : t;
+    n.y += n.y >= 0.0f ? -t : t;
+    return glm::normalize(n);
+}
+
+int axisCell(float coordinate, int count, float& fraction) {
+    if (count < 2) {
+        fraction = 0.0f;
+        return 0;
+    }
+    coordinate = std::clamp(coordinate, 0.0f, static_cast<float>(count - 1));
+    const int cell = std::min(static_cast<int>(coordinate), count - 2);
+    fraction = coordinate - static_cast<float>(cell);
+    return cell;
+}
+
+} // namespace
+
+IrradianceProbeGrid::IrradianceProbeGrid()
+    : m_spacing(0.0f)
+    , m_baked(false) {
+}
+
+void IrradianceProbeGrid::place(const BoundingBox& bounds, const IrradianceProbeSettings& settings) {
+    m_settings = settings;
+    m_settings.counts = glm::max(settings.counts, glm::ivec3(1));
+    m_settings.samplesPerProbe = std::max(settings.samplesPerProbe, 1);
+    m_settings.visibilityResolution = std::max(settings.visibilityResolution, 2);
+    m_bounds = bounds.isEmpty() ? BoundingBox(glm::vec3(0.0f), glm::vec3(0.0f)) : bounds;
+
+    const glm::ivec3& counts = m_settings.counts;
+    const glm::vec3 extent = m_bounds.getExtent();
+    for (int axis = 0; axis < 3; ++axis) {
+        m_spacing[axis] = counts[axis] > 1 ? extent[axis] / static_cast<float>(counts[axis] - 1) : 0.0f;
+    }
+
+    const int resolution = m_settings.visibilityResolution;
+    m_irradianceAtlas.resize(counts.x * kCoefficientCount, counts.y * counts.z);
+    m_visibilityAtlas.resize(counts.x * resolution, counts.y * counts.z * resolution);
+    m_baked = false;
+}
+
+void IrradianceProbeGrid::bake(const PathTracer& tracer) {
+    const glm::ivec3& counts = m_settings.counts;
+    Parallel::forEach(0, getProbeCount(), [&](int index) {
+        bakeProbe(tracer, glm::ivec3(index % counts.x, (index / counts.x) % counts.y, index / (counts.x * counts.y)));
+    });
+    m_baked = true;
+}
+
+int IrradianceProbeGrid::rebake(const PathTracer& tracer, const BoundingBox& changed) {
+    if (!m_baked) {
+        bake(tracer);
+        return getProbeCount();
+    }
+
+    const BoundingBox reach(changed.min - m_spacing, changed.max + m_spacing);
+    std::vector<glm::ivec3> probes;
+    const glm::ivec3& counts = m_settings.counts;
+    for (int z = 0; z < counts.z; ++z) {
+        for (int y = 0; y < counts.y; ++y) {
+            for (int x = 0; x < counts.x; ++x) {
+                if (reach.contains(getProbePosition(glm::ivec3(x, y, z)))) {
+                    probes.emplace_back(x, y, z);
+                }
+            }
+        }
+    }
+    Parallel::forEach(0, static_cast<int>(probes.size()), [&](int index) {
+        bakeProbe(tracer, probes[index]);
+    });
+    return static_cast<int>(probes.size());
+}
+
+glm::vec3 IrradianceProbeGrid::getProbePosition(const glm::ivec3& probe) const {
+    return m_bounds.min + glm::vec3(probe) * m_spacing;
+}
+
+SphericalHarmonics9 IrradianceProbeGrid::getProbe(const glm::ivec3& probe) const {
+    SphericalHarmonics9 harmonics;
+    const int row = probe.y + m_settings.counts.y * probe.z;
+    const glm::vec4* texels = m_irradianceAtlas.getRow(row) + probe.x * kCoefficientCount;
+    for (int i = 0; i < kCoefficientCount; ++i) {
+        harmonics.coefficients[i] = glm::vec3(texels[i].x, texels[i].y, texels[i].z);
+    }
+    return harmonics;
+}
+
+glm::vec3 IrradianceProbeGrid::sampleIrradiance(const glm::vec3& position, const glm::vec3& normal) const {
+    if (!m_baked) {
+        return glm::vec3(0.0f);
+    }
+
+    // Offset along the normal so probes just behind the surface fail the visibility test
+    const glm::ivec3& counts = m_settings.counts;
+    float cellSize = 0.0f;
+    for (int axis = 0; axis < 3; ++axis) {
+        if (counts[axis] > 1) {
+            cellSize = cellSize > 0.0f ? std::min(cellSize, m_spacing[axis]) : m_spacing[axis];
+        }
+    }
+    const glm::vec3 biased = position + normal * (m_settings.normalBias * cellSize);
+
+    glm::ivec3 base;
+    glm::vec3 fraction;
+    for (int axis = 0; axis < 3; ++axis) {
+        const float coordinate = m_spacing[axis] > 0.0f ? (biased[axis] - m_bounds.min[axis]) / m_spacing[axis] : 0.0f;
+        base[axis] = axisCell(coordinate, counts[axis], fraction[axis]);
+    }
+
+    glm::vec3 sum(0.0f);
+    float weightSum = 0.0f;
+    for (int corner = 0; corner < 8; ++corner) {
+        const glm::ivec3 offset(corner & 1, (corner >> 1) & 1, (corner >> 2) & 1);
+        const glm::ivec3 probe = glm::min(base + offset, counts - glm::ivec3(1));
+        const glm::vec3 trilinear = glm::mix(glm::vec3(1.0f) - fraction, fraction, glm::vec3(offset));
+        const glm::vec3 probePosition = getProbePosition(probe);
+
+        // Smooth backface term: probes behind the surface contribute little
+        const glm::vec3 toProbe = probePosition - position;
+        const float toProbeLength = glm::length(toProbe);
+        const float facing = toProbeLength > 0.0f ? glm::dot(toProbe / toProbeLength, normal) : 1.0f;
+        float weight = (facing + 1.0f) * 0.5f;
+        weight = weight * weight + 0.2f;
+
+        weight *= visibilityWeight(probe, biased - probePosition);
+        weight = std::max(weight, 1e-6f);
+        // Crush small weights so faint light through walls fades out completely
+        if (weight < 0.2f) {
+            weight *= weight * weight / (0.2f * 0.2f);
+        }
+        weight *= trilinear.x * trilinear.y * trilinear.z;
+
+        sum += getProbe(probe).evaluateIrradiance(normal) * weight;
+        weightSum += weight;
+    }
+    return weightSum > 0.0f ? sum / weightSum : glm::vec3(0.0f);
+}
+
+void IrradianceProbeGrid::bakeProbe(const PathTracer& tracer, const glm::ivec3& probe) {
+    const glm::ivec3& counts = m_settings.counts;
+    const int sampleCount = m_settings.samplesPerProbe;
+    const int resolution = m_settings.visibilityResolution;
+    const uint32_t probeIndex = static_cast<uint32_t>(probe.x + counts.x * (probe.y + counts.y * probe.z));
+    const float maxDistance = kMaxDistanceScale * std::max(glm::length(m_spacing), 1e-3f);
+
+    std::vector<glm::vec3> texelDirections(static_cast<size_t>(resolution) * resolution);
+    for (int y = 0; y < resolution; ++y) {
+        for (int x = 0; x < resolution; ++x) {
+            texelDirections[static_cast<size_t>(y) * resolution + x] =
+                octahedralDecode(glm::vec2((x + 0.5f) / resolution, (y + 0.5f) / resolution));
+        }
+    }
+    std::vector<glm::vec3> distanceSums(texelDirections.size(), glm::vec3(0.0f));   // weight, d, d^2
+
+    SphericalHarmonics9 harmonics;
+    const float sampleWeight = 4.0f * kPi / static_cast<float>(sampleCount);
+    Ray ray;
+    ray.origin = getProbePosition(probe);
+    for (int i = 0; i < sampleCount; ++i) {
+        ray.direction = sphereDirection(i, sampleCount);
+        harmonics.addSample(ray.direction, tracer.tracePath(ray, probeIndex, static_cast<uint32_t>(i)), sampleWeight);
+
+        RayHit hit;
+        const float distance = tracer.getTriangleBVH().intersect(ray, hit) ? std::min(hit.t, maxDistance) : maxDistance;
+        for (size_t t = 0; t < texelDirections.size(); ++t) {
+            const float cosine = glm::dot(texelDirections[t], ray.direction);
+            if (cosine <= 0.0f) {
+                continue;
+            }
+            const float weight = std::pow(cosine, kVisibilitySharpness);
+            distanceSums[t] += glm::vec3(weight, weight * distance, weight * distance * distance);
+        }
+    }
+
+    const int row = probe.y + counts.y * probe.z;
+    glm::vec4* coefficients = m_irradianceAtlas.getRow(row) + probe.x * kCoefficientCount;
+    for (int i = 0; i < kCoefficientCount; ++i) {
+        coefficients[i] = glm::vec4(harmonics.coefficients[i], 1.0f);
+    }
+    for (int y = 0; y < resolution; ++y) {
+        glm::vec4* texels = m_visibilityAtlas.getRow(row * resolution + y) + probe.x * resolution;
+        for (int x = 0; x < resolution; ++x) {
+            const glm::vec3& sums = distanceSums[static_cast<size_t>(y) * resolution + x];
+            texels[x] = sums.x > 0.0f ? glm::vec4(sums.y / sums.x, sums.z / sums.x, 0.0f, 1.0f)
+                                      : glm::vec4(maxDistance, maxDistance * maxDistance, 0.0f, 1.0f);
+        }
+    }
+}
+
+float IrradianceProbeGrid::visibilityWeight(const glm::ivec3& probe, const glm::vec3& toPoint) const {
+    const float distance = glm::length(toPoint);
+    if (distance <= 0.0f) {
+        return 1.0f;
+    }
+
+    // Bilinear fetch of the moments within the probe's tile
+    const int resolution = m_settings.visibilityResolution;
+    const glm::vec2 uv = octahedralEncode(toPoint / distance) * static_cast<float>(resolution) - glm::vec2(0.5f);
+    const int x0 = std::clamp(static_cast<int>(std::floor(uv.x)), 0, resolution - 1);
+    const int y0 = std::clamp(static_cast<int>(std::floor(uv.y)), 0, resolution - 1);
+    const int x1 = std::min(x0 + 1, resolution - 1);
+    const int y1 = std::min(y0 + 1, resolution - 1);
+    const float fx = std::clamp(uv.x - static_cast<float>(x0), 0.0f, 1.0f);
+    const float fy = std::clamp(uv.y - static_cast<float>(y0), 0.0f, 1.0f);
+    const int tileX = probe.x * resolution;
+    const int tileY = (probe.y + m_settings.counts.y * probe.z) * resolution;
+    const glm::vec4 bottom = glm::mix(m_visibilityAtlas.at(tileX + x0, tileY + y0), m_visibilityAtlas.at(tileX + x1, tileY + y0), fx);
+    const glm::vec4 top = glm::mix(m_visibilityAtlas.at(tileX + x0, tileY + y1), m_visibilityAtlas.at(tileX + x1, tileY + y1), fx);
+    const glm::vec4 moments = glm::mix(bottom, top, fy);
+
+    // Chebyshev upper bound on the chance that the point is not occluded
+    const float mean = moments.x;
+    if (distance <= mean) {
+        return 1.0f;
+    }
+    const float variance = std::abs(moments.y - mean * mean);
+    const float delta = distance - mean;
+    const float probability = variance / (variance + delta * delta);
+    return probability * probability * probability;
+}
+
+} // namespace ElementalRenderer
@@ -0,0 +1,387 @@
+/**
+ * @file LightRegistry.cpp
+ * @brief Implementation of the structure-of-arrays light registry
+ */
+
+#include "Lighting/LightRegistry.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ElementalRenderer {
+
+namespace {
+
+const float kPi = 3.14159265358979f;
+
+float cosDegrees(float degrees) {
+    return std::cos(degrees * kPi / 180.0f);
+}
+
+float acosDegrees(float cosine) {
+    return std::acos(std::clamp(cosine, -1.0f, 1.0f)) * 180.0f / kPi;
+}
+
+// Move the last element into the hole, keeping the column dense
+struct SwapRemove {
+    uint32_t index;
+
+    template<typename T>
+    void operator()(std::vector<T>& column) const {
+        column[index] = column.back();
+        column.pop_back();
+    }
+};
+
+struct Grow {
+    template<typename T>
+    void operator()(std::vector<T>& column) const {
+        column.emplace_back();
+    }
+};
+
+struct Clear {
+    template<typename T>
+    void operator()(std::vector<T>& column) const {
+        column.clear();
+    }
+};
+
+void storeCommon(LightColumns& columns, uint32_t index, const LightDesc& desc, uint64_t version) {
+    columns.colors[index] = desc.color;
+    columns.intensities[index] = desc.intensity;
+    columns.castShadows[index] = desc.castShadows ? 1 : 0;
+    columns.versions[index] = version;
+}
+
+void readCommon(const LightColumns& columns, uint32_t index, LightDesc& desc) {
+    desc.color = columns.colors[index];
+    desc.intensity = columns.intensities[index];
+    desc.castShadows = columns.castShadows[index] != 0;
+}
+
+glm::vec4 packRadiance(const LightColumns& columns, uint32_t index, int flags) {
+    if (columns.castShadows[index]) {
+        flags |= PackedLight::kPackedCastShadows;
+    }
+    return glm::vec4(columns.colors[index] * columns.intensities[index], static_cast<float>(flags));
+}
+
+} // namespace
+
+LightDesc LightDesc::fromLight(const Light& light) {
+    LightDesc desc;
+    desc.type = light.getType();
+    desc.color = light.getColor();
+    desc.intensity = light.getIntensity();
+    desc.castShadows = light.getCastShadows();
+
+    if (const auto* directional = dynamic_cast<const DirectionalLight*>(&light)) {
+        desc.direction = directional->getDirection();
+    } else if (const auto* point = dynamic_cast<const PointLight*>(&light)) {
+        desc.position = point->getPosition();
+        desc.range = point->getRange();
+    } else if (const auto* spot = dynamic_cast<const SpotLight*>(&light)) {
+        desc.position = spot->getPosition();
+        desc.direction = spot->getDirection();
+        desc.range = spot->getRange();
+        desc.innerAngle = spot->getInnerAngle();
+        desc.outerAngle = spot->getOuterAngle();
+    } else if (const auto* area = dynamic_cast<const AreaLight*>(&light)) {
+        desc.position = area->getPosition();
+        desc.direction = area->getDirection();
+        desc.shape = area->getShape();
+        desc.axisX = area->getAxisX();
+        desc.axisY = area->getAxisY();
+        desc.twoSided = area->isTwoSided();
+    }
+    return desc;
+}
+
+LightRegistry::LightRegistry()
+    : m_version(0) {
+}
+
+LightHandle LightRegistry::add(const LightDesc& desc) {
+    uint32_t slot;
+    if (!m_freeSlots.empty()) {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    } else {
+        slot = static_cast<uint32_t>(m_slots.size());
+        m_slots.emplace_back();
+    }
+    ++m_version;
+    append(slot, desc);
+
+    LightHandle handle;
+    handle.slot = slot;
+    handle.generation = m_slots[slot].generation;
+    return handle;
+}
+
+bool LightRegistry::remove(LightHandle handle) {
+    if (!findSlot(handle)) {
+        return false;
+    }
+    Slot& slot = m_slots[handle.slot];
+    erase(slot.type, slot.index);
+    slot.alive = false;
+    ++slot.generation;
+    m_freeSlots.push_back(handle.slot);
+    ++m_version;
+    return true;
+}
+
+bool LightRegistry::update(LightHandle handle, const LightDesc& desc) {
+    if (!findSlot(handle)) {
+        return false;
+    }
+    ++m_version;
+    Slot& slot = m_slots[handle.slot];
+    if (slot.type != desc.type) {
+        erase(slot.type, slot.index);
+        append(handle.slot, desc);
+        return true;
+    }
+
+    store(slot, desc);
+    return true;
+}
+
+bool LightRegistry::contains(LightHandle handle) const {
+    return findSlot(handle) != nullptr;
+}
+
+bool LightRegistry::getDesc(LightHandle handle, LightDesc& desc) const {
+    const Slot* slot = findSlot(handle);
+    if (!slot) {
+        return false;
+    }
+    desc = LightDesc();
+    desc.type = slot->type;
+    const uint32_t i = slot->index;
+    switch (slot->type) {
+        case LightType::DIRECTIONAL:
+            readCommon(m_directional, i, desc);
+            desc.direction = m_directional.directions[i];
+            break;
+        case LightType::POINT:
+            readCommon(m_point, i, desc);
+            desc.position = m_point.positions[i];
+            desc.range = m_point.ranges[i];
+            break;
+        case LightType::SPOT:
+            readCommon(m_spot, i, desc);
+            desc.position = m_spot.positions[i];
+            desc.direction = m_spot.directions[i];
+            desc.range = m_spot.ranges[i];
+            desc.innerAngle = acosDegrees(m_spot.cosInner[i]);
+            desc.outerAngle = acosDegrees(m_spot.cosOuter[i]);
+            break;
+        case LightType::AREA:
+            readCommon(m_area, i, desc);
+            desc.position = m_area.positions[i];
+            desc.direction = glm::normalize(glm::cross(m_area.axesY[i], m_area.axesX[i]));
+            desc.axisX = m_area.axesX[i];
+            desc.axisY = m_area.axesY[i];
+            desc.shape = m_area.disk[i] ? AreaLightShape::DISK : AreaLightShape::RECTANGLE;
+            desc.twoSided = m_area.twoSided[i] != 0;
+            break;
+    }
+    return true;
+}
+
+void LightRegistry::clear() {
+    for (uint32_t i = 0; i < m_slots.size(); ++i) {
+        if (m_slots[i].alive) {
+            m_slots[i].alive = false;
+            ++m_slots[i].generation;
+            m_freeSlots.push_back(i);
+        }
+    }
+    m_directional.visit(Clear());
+    m_point.visit(Clear());
+    m_spot.visit(Clear());
+    m_area.visit(Clear());
+    ++m_version;
+}
+
+size_t LightRegistry::getLightCount() const {
+    return m_directional.size() + m_point.size() + m_spot.size() + m_area.size();
+}
+
+uint64_t LightRegistry::getVersion(LightHandle handle) const {
+    const Slot* slot = findSlot(handle);
+    if (!slot) {
+        return 0;
+    }
+    switch (slot->type) {
+        case LightType::DIRECTIONAL:
+            return m_directional.versions[slot->index];
+        case LightType::POINT:
+            return m_point.versions[slot->index];
+        case LightType::SPOT:
+            return m_spot.versions[slot->index];
+        case LightType::AREA:
+            return m_area.versions[slot->index];
+    }
+    return 0;
+}
+
+LightBufferLayout LightRegistry::pack(std::vector<PackedLight>& buffer) const {
+    LightBufferLayout layout;
+    layout.counts[static_cast<int>(LightType::DIRECTIONAL)] = static_cast<uint32_t>(m_directional.size());
+    layout.counts[static_cast<int>(LightType::POINT)] = static_cast<uint32_t>(m_point.size());
+    layout.counts[static_cast<int>(LightType::SPOT)] = static_cast<uint32_t>(m_spot.size());
+    layout.counts[static_cast<int>(LightType::AREA)] = static_cast<uint32_t>(m_area.size());
+    uint32_t offset = 0;
+    for (int type = 0; type < 4; ++type) {
+        layout.offsets[type] = offset;
+        offset += layout.counts[type];
+    }
+    buffer.resize(offset);
+
+    PackedLight* out = buffer.data();
+    const float directionalType = static_cast<float>(LightType::DIRECTIONAL);
+    for (uint32_t i = 0; i < m_directional.size(); ++i, ++out) {
+        out->positionType = glm::vec4(0.0f, 0.0f, 0.0f, directionalType);
+        out->directionRange = glm::vec4(m_directional.directions[i], 0.0f);
+        out->radianceFlags = packRadiance(m_directional, i, 0);
+        out->axisXCosInner = glm::vec4(0.0f);
+        out->axisYCosOuter = glm::vec4(0.0f);
+    }
+    const float pointType = static_cast<float>(LightType::POINT);
+    for (uint32_t i = 0; i < m_point.size(); ++i, ++out) {
+        out->positionType = glm::vec4(m_point.positions[i], pointType);
+        out->directionRange = glm::vec4(0.0f, 0.0f, 0.0f, m_point.ranges[i]);
+        out->radianceFlags = packRadiance(m_point, i, 0);
+        out->axisXCosInner = glm::vec4(0.0f);
+        out->axisYCosOuter = glm::vec4(0.0f);
+    }
+    const float spotType = static_cast<float>(LightType::SPOT);
+    for (uint32_t i = 0; i < m_spot.size(); ++i, ++out) {
+        out->positionType = glm::vec4(m_spot.positions[i], spotType);
+        out->directionRange = glm::vec4(m_spot.directions[i], m_spot.ranges[i]);
+        out->radianceFlags = packRadiance(m_spot, i, 0);
+        out->axisXCosInner = glm::vec4(0.0f, 0.0f, 0.0f, m_spot.cosInner[i]);
+        out->axisYCosOuter = glm::vec4(0.0f, 0.0f, 0.0f, m_spot.cosOuter[i]);
+    }
+    const float areaType = static_cast<float>(LightType::AREA);
+    for (uint32_t i = 0; i < m_area.size(); ++i, ++out) {
+        const int flags = (m_area.disk[i] ? PackedLight::kPackedDisk : 0)
+                        | (m_area.twoSided[i] ? PackedLight::kPackedTwoSided : 0);
+        out->positionType = glm::vec4(m_area.positions[i], areaType);
+        out->directionRange = glm::vec4(glm::normalize(glm::cross(m_area.axesY[i], m_area.axesX[i])), 0.0f);
+        out->radianceFlags = packRadiance(m_area, i, flags);
+        out->axisXCosInner = glm::vec4(m_area.axesX[i], 0.0f);
+        out->axisYCosOuter = glm::vec4(m_area.axesY[i], 0.0f);
+    }
+    return layout;
+}
+
+const LightRegistry::Slot* LightRegistry::findSlot(LightHandle handle) const {
+    if (handle.slot >= m_slots.size()) {
+        return nullptr;
+    }
+    const Slot& slot = m_slots[handle.slot];
+    return slot.alive && slot.generation == handle.generation ? &slot : nullptr;
+}
+
+void LightRegistry::append(uint32_t slotIndex, const LightDesc& desc) {
+    Slot& slot = m_slots[slotIndex];
+    slot.type = desc.type;
+    slot.alive = true;
+
+    LightColumns* columns = nullptr;
+    switch (desc.type) {
+        case LightType::DIRECTIONAL:
+            m_directional.visit(Grow());
+            columns = &m_directional;
+            break;
+        case LightType::POINT:
+            m_point.visit(Grow());
+            columns = &m_point;
+            break;
+        case LightType::SPOT:
+            m_spot.visit(Grow());
+            columns = &m_spot;
+            break;
+        case LightType::AREA:
+            m_area.visit(Grow());
+            columns = &m_area;
+            break;
+    }
+    slot.index = static_cast<uint32_t>(columns->size() - 1);
+    columns->slots[slot.index] = slotIndex;
+
+    store(slot, desc);
+}
+
+void LightRegistry::store(const Slot& slot, const LightDesc& desc) {
+    const uint32_t i = slot.index;
+    switch (slot.type) {
+        case LightType::DIRECTIONAL:
+            storeCommon(m_directional, i, desc, m_version);
+            m_directional.directions[i] = desc.direction;
+            break;
+        case LightType::POINT:
+            storeCommon(m_point, i, desc, m_version);
+            m_point.positions[i] = desc.position;
+            m_point.ranges[i] = desc.range;
+            break;
+        case LightType::SPOT:
+            storeCommon(m_spot, i, desc, m_version);
+            m_spot.positions[i] = desc.position;
+            m_spot.directions[i] = desc.direction;
+            m_spot.ranges[i] = desc.range;
+            m_spot.cosInner[i] = cosDegrees(desc.innerAngle);
+            m_spot.cosOuter[i] = cosDegrees(desc.outerAngle);
+            break;
+        case LightType::AREA:
+            storeCommon(m_area, i, desc, m_version);
+            m_area.positions[i] = desc.position;
+            m_area.axesX[i] = desc.axisX;
+            m_area.axesY[i] = desc.axisY;
+            m_area.disk[i] = desc.shape == AreaLightShape::DISK ? 1 : 0;
+            m_area.twoSided[i] = desc.twoSided ? 1 : 0;
+            break;
+    }
+}
+
+void LightRegistry::erase(LightType type, uint32_t index) {
+    LightColumns* columns = nullptr;
+    switch (type) {
+        case LightType::DIRECTIONAL:
+            columns = &m_directional;
+            break;
+        case LightType::POINT:
+            columns = &m_point;
+            break;
+        case LightType::SPOT:
+            columns = &m_spot;
+            break;
+        case LightType::AREA:
+            columns = &m_area;
+            break;
+    }
+    const uint32_t last = static_cast<uint32_t>(columns->size() - 1);
+    if (index != last) {
+        m_slots[columns->slots[last]].index = index;
+    }
+    switch (type) {
+        case LightType::DIRECTIONAL:
+            m_directional.visit(SwapRemove{index});
+            break;
+        case LightType::POINT:
+            m_point.visit(SwapRemove{index});
+            break;
+        case LightType::SPOT:
+            m_spot.visit(SwapRemove{index});
+            break;
+        case LightType::AREA:
+            m_area.visit(SwapRemove{index});
+            break;
+    }
+}
+
+} // namespace ElementalRenderer
@@ -0,0 +1,263 @@
+/**
+ * @file LightmapBaker.cpp
+ * @brief Implementation of the CPU lightmap baker
+ */
+
+#include "Lighting/LightmapBaker.h"
+#include "PathTracing/PathTracer.h"
+#include "Headless/Parallel.h"
+#include "PathTracing/RandomStream.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace ElementalRenderer {
+
+namespace {
+
+using RandomStream::Sampler;
+using RandomStream::hash32;
+using RandomStream::makeBasis;
+
+const float kPi = 3.14159265358979f;
+const float kEdgeEpsilon = -1e-6f;              // Texel centers on shared edges belong to both triangles
+const uint32_t kDirectSalt = 0x9e3779b9u;
+const uint32_t kIndirectSalt = 0x85ebca6bu;
+
+// Triangle and barycentric coordinates at a texel center
+struct TexelSample {
+    int triangle = -1;
+    glm::vec3 barycentric = glm::vec3(0.0f);
+};
+
+// Find the triangle under every texel center in lightmap space
+std::vector<TexelSample> rasterize(const LightmapSurface& surface, int width, int height) {
+    std::vector<TexelSample> texels(static_cast<size_t>(width) * height);
+    const glm::vec2 size(static_cast<float>(width), static_cast<float>(height));
+    const int triangleCount = static_cast<int>(surface.indices.size() / 3);
+    for (int t = 0; t < triangleCount; ++t) {
+        // Texel space with texel centers on integer coordinates
+        glm::vec2 corners[3];
+        for (int corner = 0; corner < 3; ++corner) {
+            corners[corner] = surface.lightmapCoords[surface.indices[3 * t + corner]] * size - glm::vec2(0.5f);
+        }
+        const glm::vec2 e1 = corners[1] - corners[0];
+        const glm::vec2 e2 = corners[2] - corners[0];
+        const float area = e1.x * e2.y - e1.y * e2.x;
+        if (area == 0.0f) {
+            continue;
+        }
+        const glm::vec2 lower = glm::min(corners[0], glm::min(corners[1], corners[2]));
+        const glm::vec2 upper = glm::max(corners[0], glm::max(corners[1], corners[2]));
+        const int x0 = std::max(static_cast<int>(std::ceil(lower.x)), 0);
+        const int y0 = std::max(static_cast<int>(std::ceil(lower.y)), 0);
+        const int x1 = std::min(static_cast<int>(std::floor(upper.x)), width - 1);
+        const int y1 = std::min(static_cast<int>(std::floor(upper.y)), height - 1);
+        for (int y = y0; y <= y1; ++y) {
+            for (int x = x0; x <= x1; ++x) {
+                const glm::vec2 d = glm::vec2(static_cast<float>(x), static_cast<float>(y)) - corners[0];
+                const float u = (d.x * e2.y - d.y * e2.x) / area;
+                const float v = (e1.x * d.y - e1.y * d.x) / area;
+                if (u < kEdgeEpsilon || v < kEdgeEpsilon || u + v > 1.0f - kEdgeEpsilon) {
+                    continue;
+                }
+                TexelSample& texel = texels[static_cast<size_t>(y) * width + x];
+                texel.triangle = t;
+                texel.barycentric = glm::vec3(1.0f - u - v, u, v);
+            }
+        }
+    }
+    return texels;
+}
+
+// Grow the covered texels outwards by averaging covered neighbours
+void dilate(Image& lightmap, std::vector<uint8_t>& covered, int passes) {
+    const int width = lightmap.getWidth();
+    const int height = lightmap.getHeight();
+    std::vector<std::pair<size_t, glm::vec4>> filled;
+    for (int pass = 0; pass < passes; ++pass) {
+        filled.clear();
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                if (covered[static_cast<size_t>(y) * width + x]) {
+                    continue;
+                }
+                glm::vec3 sum(0.0f);
+                int count = 0;
+                for (int dy = -1; dy <= 1; ++dy) {
+                    for (int dx = -1; dx <= 1; ++dx) {
+                        const int nx = x + dx;
+                        const int ny = y + dy;
+                        if (nx >= 0 && ny >= 0 && nx < width && ny < height && covered[static_cast<size_t>(ny) * width + nx]) {
+                            sum += glm::vec3(lightmap.at(nx, ny));
+                            ++count;
+                        }
+                    }
+                }
+                if (count > 0) {
+                    filled.emplace_back(static_cast<size_t>(y) * width + x, glm::vec4(sum / static_cast<float>(count), 0.0f));
+                }
+            }
+        }
+        for (const auto& texel : filled) {
+            lightmap.at(static_cast<int>(texel.first % width), static_cast<int>(texel.first / width)) = texel.second;
+            covered[texel.first] = 1;
+        }
+    }
+}
+
+} // namespace
+
+LightmapBaker::LightmapBaker()
+    : m_progress(0.0f)
+    , m_cancelRequested(false) {
+}
+
+void LightmapBaker::cancel() {
+    m_cancelRequested.store(true);
+}
+
+bool LightmapBaker::bake(const PathTracer& tracer, const LightmapSurface& surface, Image& lightmap) {
+    if (surface.lightmapCoords.size() != surface.positions.size()) {
+        std::cerr << "Warning: Lightmap surface has " << surface.lightmapCoords.size() << " lightmap coordinates for "
+                  << surface.positions.size() << " vertices" << std::endl;
+        return false;
+    }
+    for (unsigned int index : surface.indices) {
+        if (index >= surface.positions.size()) {
+            std::cerr << "Warning: Lightmap surface index " << index << " is out of range" << std::endl;
+            return false;
+        }
+    }
+
+    const int width = std::max(m_settings.width, 1);
+    const int height = std::max(m_settings.height, 1);
+    const int tileSize = std::max(m_settings.tileSize, 1);
+    const int tilesX = (width + tileSize - 1) / tileSize;
+    const int tilesY = (height + tileSize - 1) / tileSize;
+    const int tileCount = tilesX * tilesY;
+    const int directSamples = std::max(m_settings.directSamples, 0);
+    const int indirectSamples = m_settings.bounces > 0 ? std::max(m_settings.indirectSamples, 0) : 0;
+    const uint32_t directSeed = m_settings.seed ^ kDirectSalt;
+    const uint32_t pathOffset = hash32(m_settings.seed ^ kIndirectSalt);
+    m_progress.store(0.0f);
+
+    const TriangleBVH& bvh = tracer.getTriangleBVH();
+    const BoundingBox& bounds = bvh.getBounds();
+    const float offset = m_settings.bias * (bounds.isEmpty() ? 1.0f : std::max(glm::length(bounds.getExtent()), 1e-6f));
+
+    const std::vector<TexelSample> texels = rasterize(surface, width, height);
+    Image result(width, height, glm::vec4(0.0f));
+    std::atomic<int> completedTiles(0);
+    Parallel::forEach(0, tileCount, [&](int tile) {
+        if (m_cancelRequested.load(std::memory_order_relaxed)) {
+            return;
+        }
+        const int x0 = (tile % tilesX) * tileSize;
+        const int y0 = (tile / tilesX) * tileSize;
+        const int x1 = std::min(x0 + tileSize, width);
+        const int y1 = std::min(y0 + tileSize, height);
+        for (int y = y0; y < y1; ++y) {
+            for (int x = x0; x < x1; ++x) {
+                const uint32_t texelIndex = static_cast<uint32_t>(y * width + x);
+                const TexelSample& texel = texels[texelIndex];
+                if (texel.triangle < 0) {
+                    continue;
+                }
+
+                const unsigned int* triangle = &surface.indices[3 * static_cast<size_t>(texel.triangle)];
+                const glm::vec3& p0 = surface.positions[triangle[0]];
+                const glm::vec3& p1 = surface.positions[triangle[1]];
+                const glm::vec3& p2 = surface.positions[triangle[2]];
+                const glm::vec3 point = p0 * texel.barycentric.x + p1 * texel.barycentric.y + p2 * texel.barycentric.z;
+                glm::vec3 geometricNormal = glm::normalize(glm::cross(p1 - p0, p2 - p0));
+                glm::vec3 normal(0.0f);
+                for (int corner = 0; corner < 3; ++corner) {
+                    if (triangle[corner] < surface.normals.size()) {
+                        normal += surface.normals[triangle[corner]] * texel.barycentric[corner];
+                    }
+                }
+                const float normalLength = glm::length(normal);
+                normal = normalLength > 0.0f ? normal / normalLength : geometricNormal;
+                if (glm::dot(normal, geometricNormal) < 0.0f) {
+                    geometricNormal = -geometricNormal;
+                }
+                const glm::vec3 origin = point + geometricNormal * offset;
+
+                // Direct light through the light BVH, shadowed by the scene
+                glm::vec3 direct(0.0f);
+                for (int s = 0; s < directSamples; ++s) {
+                    Sampler sampler(directSeed, texelIndex, static_cast<uint32_t>(s));
+                    const float uLight = sampler.next();
+                    const glm::vec2 uPoint(sampler.next(), sampler.next());
+                    glm::vec3 direction;
+                    float distance;
+                    glm::vec3 radiance;
+                    if (!tracer.sampleDirectLight(point, normal, uLight, uPoint, direction, distance, radiance)) {
+                        continue;
+                    }
+                    const float cosTheta = glm::dot(normal, direction);
+                    if (cosTheta <= 0.0f || glm::dot(geometricNormal, direction) <= 0.0f) {
+                        continue;
+                    }
+                    Ray shadowRay;
+                    shadowRay.origin = origin;
+                    shadowRay.direction = direction;
+                    shadowRay.tMax = distance - 2.0f * offset;
+                    if (shadowRay.tMax > 0.0f && !bvh.occluded(shadowRay)) {
+                        direct += radiance * cosTheta;
+                    }
+                }
+
+                // Cosine-weighted gather: the mean radiance is irradiance / pi
+                glm::vec3 indirect(0.0f);
+                glm::vec3 tangent;
+                glm::vec3 bitangent;
+                makeBasis(normal, tangent, bitangent);
+                for (int s = 0; s < indirectSamples; ++s) {
+                    Sampler sampler(m_settings.seed, texelIndex, static_cast<uint32_t>(s));
+                    const float u = sampler.next();
+                    const float phi = 2.0f * kPi * sampler.next();
+                    const float radius = std::sqrt(u);
+                    Ray ray;
+                    ray.origin = origin;
+                    ray.direction = tangent * (radius * std::cos(phi)) + bitangent * (radius * std::sin(phi))
+                                  + normal * std::sqrt(std::max(1.0f - u, 0.0f));
+                    if (glm::dot(geometricNormal, ray.direction) <= 0.0f) {
+                        continue;
+                    }
+                    indirect += tracer.tracePath(ray, pathOffset + texelIndex, static_cast<uint32_t>(s), m_settings.bounces - 1);
+                }
+
+                glm::vec3 irradiance(0.0f);
+                if (directSamples > 0) {
+                    irradiance += direct / (static_cast<float>(directSamples) * kPi);
+                }
+                if (indirectSamples > 0) {
+                    irradiance += indirect / static_cast<float>(indirectSamples);
+                }
+                result.at(x, y) = glm::vec4(irradiance, 1.0f);
+            }
+        }
+
+        const int completed = completedTiles.fetch_add(1) + 1;
+        m_progress.store(static_cast<float>(completed) / static_cast<float>(tileCount), std::memory_order_relaxed);
+        if (m_progressCallback) {
+            std::lock_guard<std::mutex> lock(m_progressMutex);
+            m_progressCallback(completed, tileCount);
+        }
+    });
+
+    if (m_cancelRequested.exchange(false)) {
+        return false;
+    }
+    std::vector<uint8_t> covered(texels.size());
+    for (size_t i = 0; i < texels.size(); ++i) {
+        covered[i] = texels[i].triangle >= 0 ? 1 : 0;
+    }
+    dilate(result, covered, m_settings.dilation);
+    lightmap = std::move(result);
+    return true;
+}
+
+} // namespace ElementalRenderer
@@ -0,0 +1,205 @@
+/**
+ * @file LightmapUnwrapper.cpp
+ * @brief Implementation of lightmap chart generation and packing
+ */
+
+#include "Lighting/LightmapUnwrapper.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+
+namespace ElementalRenderer {
+
+namespace {
+
+const int kScaleIterations = 24;
+const float kMinChartExtent = 1e-6f;
+
+struct Chart {
+    int axis = 0;               // Dominant normal axis, 0 = x, 1 = y, 2 = z
+    glm::vec2 min = glm::vec2(std::numeric_limits<float>::max());
+    glm::vec2 max = glm::vec2(-std::numeric_limits<float>::max());
+    glm::ivec2 offset = glm::ivec2(0);  // Packed texel position, before padding
+};
+
+// Planar projection onto the two axes orthogonal to the dominant one
+glm::vec2 project(const glm::vec3& p, int axis) {
+    switch (axis) {
+        case 0: return glm::vec2(p.z, p.y);
+        case 1: return glm::vec2(p.x, p.z);
+        default: return glm::vec2(p.x, p.y);
+    }
+}
+
+// Signed dominant axis of a face normal: 0..5 for +x, -x, +y, -y, +z, -z
+int dominantDirection(const glm::vec3& normal) {
+    const glm::vec3 magnitude = glm::abs(normal);
+    int axis = 0;
+    if (magnitude.y > magnitude[axis]) {
+        axis = 1;
+    }
+    if (magnitude.z > magnitude[axis]) {
+        axis = 2;
+    }
+    return 2 * axis + (normal[axis] < 0.0f ? 1 : 0);
+}
+
+int findRoot(std::vector<int>& parents, int i) {
+    while (parents[i] != i) {
+        parents[i] = parents[parents[i]];
+        i = parents[i];
+    }
+    return i;
+}
+
+// Canonical vertex per distinct position, so charts connect across attribute seams
+std::vector<unsigned int> weldPositions(const std::vector<glm::vec3>& positions) {
+    std::vector<unsigned int> order(positions.size());
+    std::iota(order.begin(), order.end(), 0u);
+    auto less = [&](unsigned int a, unsigned int b) {
+        const glm::vec3& pa = positions[a];
+        const glm::vec3& pb = positions[b];
+        return pa.x != pb.x ? pa.x < pb.x : pa.y != pb.y ? pa.y < pb.y : pa.z < pb.z;
+    };
+    std::sort(order.begin(), order.end(), less);
+    std::vector<unsigned int> canonical(positions.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        const bool same = i > 0 && positions[order[i]] == positions[order[i - 1]];
+        canonical[order[i]] = same ? canonical[order[i - 1]] : order[i];
+    }
+    return canonical;
+}
+
+glm::ivec2 chartTexels(const Chart& chart, float scale) {
+    const glm::vec2 extent = (chart.max - chart.min) * scale;
+    return glm::ivec2(std::max(1, static_cast<int>(std::ceil(extent.x))),
+                      std::max(1, static_cast<int>(std::ceil(extent.y))));
+}
+
+// Shelf packing in the given order; fills the chart offsets on success
+bool pack(std::vector<Chart>& charts, const std::vector<int>& order, float scale, int resolution, int padding) {
+    int x = 0;
+    int y = 0;
+    int shelfHeight = 0;
+    for (int index : order) {
+        const glm::ivec2 size = chartTexels(charts[index], scale) + glm::ivec2(padding);
+        if (x + size.x + padding > resolution) {
+            x = 0;
+            y += shelfHeight;
+            shelfHeight = 0;
+        }
+        if (x + size.x + padding > resolution || y + size.y + padding > resolution) {
+            return false;
+        }
+        charts[index].offset = glm::ivec2(x, y);
+        x += size.x;
+        shelfHeight = std::max(shelfHeight, size.y);
+    }
+    return true;
+}
+
+} // namespace
+
+LightmapUnwrap LightmapUnwrapper::unwrap(const std::vector<glm::vec3>& positions, const std::vector<unsigned int>& indices,
+                                         const LightmapUnwrapSettings& settings) {
+    LightmapUnwrap result;
+    const int triangleCount = static_cast<int>(indices.size() / 3);
+    const int resolution = std::max(settings.resolution, 1);
+    const int padding = std::max(settings.padding, 0);
+    if (triangleCount == 0) {
+        return result;
+    }
+
+    // Union edge-adjacent triangles that face the same axis direction
+    const std::vector<unsigned int> canonical = weldPositions(positions);
+    std::vector<int> directions(triangleCount);
+    std::vector<int> parents(triangleCount);
+    std::unordered_map<uint64_t, int> edgeOwners;
+    edgeOwners.reserve(indices.size());
+    for (int t = 0; t < triangleCount; ++t) {
+        const glm::vec3& p0 = positions[indices[3 * t]];
+        directions[t] = dominantDirection(glm::cross(positions[indices[3 * t + 1]] - p0, positions[indices[3 * t + 2]] - p0));
+        parents[t] = t;
+        for (int corner = 0; corner < 3; ++corner) {
+            const uint64_t a = canonical[indices[3 * t + corner]];
+            const uint64_t b = canonical[indices[3 * t + (corner + 1) % 3]];
+            const uint64_t edge = a < b ? (a << 32) | b : (b << 32) | a;
+            auto owner = edgeOwners.emplace(edge, t);
+            if (!owner.second && directions[owner.first->second] == directions[t]) {
+                parents[findRoot(parents, t)] = findRoot(parents, owner.first->second);
+            }
+        }
+    }
+
+    std::vector<int> triangleCharts(triangleCount);
+    std::vector<int> rootCharts(triangleCount, -1);
+    std::vector<Chart> charts;
+    for (int t = 0; t < triangleCount; ++t) {
+        const int root = findRoot(parents, t);
+        if (rootCharts[root] < 0) {
+            rootCharts[root] = static_cast<int>(charts.size());
+            charts.emplace_back();
+            charts.back().axis = directions[t] / 2;
+        }
+        Chart& chart = charts[rootCharts[root]];
+        triangleCharts[t] = rootCharts[root];
+        for (int corner = 0; corner < 3; ++corner) {
+            const glm::vec2 projected = project(positions[indices[3 * t + corner]], chart.axis);
+            chart.min = glm::min(chart.min, projected);
+            chart.max = glm::max(chart.max, projected);
+        }
+    }
+
+    // Largest uniform scale at which the shelf packing still fits
+    std::vector<int> order(charts.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+        return charts[a].max.y - charts[a].min.y > charts[b].max.y - charts[b].min.y;
+    });
+    if (!pack(charts, order, 0.0f, resolution, padding)) {
+        return result;
+    }
+    float area = 0.0f;
+    for (const Chart& chart : charts) {
+        const glm::vec2 extent = glm::max(chart.max - chart.min, glm::vec2(kMinChartExtent));
+        area += extent.x * extent.y;
+    }
+    float low = 0.0f;
+    float high = static_cast<float>(resolution) / std::sqrt(area);
+    for (int i = 0; i < kScaleIterations; ++i) {
+        const float middle = 0.5f * (low + high);
+        if (pack(charts, order, middle, resolution, padding)) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+    pack(charts, order, low, resolution, padding);
+
+    // Split vertices shared by several charts
+    std::unordered_map<uint64_t, unsigned int> outputVertices;
+    result.indices.resize(indices.size());
+    for (int t = 0; t < triangleCount; ++t) {
+        const Chart& chart = charts[triangleCharts[t]];
+        for (int corner = 0; corner < 3; ++corner) {
+            const unsigned int vertex = indices[3 * t + corner];
+            const uint64_t key = (static_cast<uint64_t>(triangleCharts[t]) << 32) | vertex;
+            auto output = outputVertices.emplace(key, static_cast<unsigned int>(result.vertexMap.size()));
+            if (output.second) {
+                const glm::vec2 texel = glm::vec2(chart.offset + glm::ivec2(padding))
+                                      + (project(positions[vertex], chart.axis) - chart.min) * low;
+                result.vertexMap.push_back(vertex);
+                result.lightmapCoords.push_back(texel / static_cast<float>(resolution));
+            }
+            result.indices[3 * t + corner] = output.first->second;
+        }
+    }
+    result.chartCount = static_cast<int>(charts.size());
+    result.texelsPerUnit = low;
+    return result;
+}
+
+} // namespace ElementalRenderer
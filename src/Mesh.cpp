@@ -5,6 +5,8 @@
 
 #include "Mesh.h"
 #include "Material.h"
+#include "PathTracing/AmbientOcclusionBaker.h"
+#include "Lighting/LightmapUnwrapper.h"
 #include <iostream>
 #include <glm/gtc/constants.hpp>
 
@@ -15,6 +17,7 @@ Mesh::Mesh()
     , m_vao(0)
     , m_vbo(0)
     , m_ebo(0)
+    , m_occlusionVbo(0)
 {
 }
 
@@ -27,6 +30,7 @@ Mesh::Mesh(const std::vector<Vertex>& vertices, const std::vector<unsigned int>&
     , m_vao(0)
     , m_vbo(0)
     , m_ebo(0)
+    , m_occlusionVbo(0)
 {
     calculateTangents();
     setupMesh();
@@ -36,6 +40,7 @@ Mesh::~Mesh() {
     // glDeleteVertexArrays(1, &m_vao);
     // glDeleteBuffers(1, &m_vbo);
     // glDeleteBuffers(1, &m_ebo);
+    // glDeleteBuffers(1, &m_occlusionVbo);
 }
 
 bool Mesh::loadFromFile(const std::string& path) {
@@ -59,11 +64,76 @@ bool Mesh::loadFromFile(const std::string& path) {
 void Mesh::setData(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices) {
     m_vertices = vertices;
     m_indices = indices;
+    m_vertexOcclusion.clear();
     
     calculateTangents();
     setupMesh();
 }
 
+bool Mesh::setVertexOcclusion(const std::vector<uint8_t>& occlusion) {
+    if (!occlusion.empty() && occlusion.size() != m_vertices.size()) {
+        std::cerr << "Warning: Vertex occlusion has " << occlusion.size() << " values for "
+                  << m_vertices.size() << " vertices" << std::endl;
+        return false;
+    }
+
+    m_vertexOcclusion = occlusion;
+    setupMesh();
+    return true;
+}
+
+bool Mesh::bakeAmbientOcclusion(const AmbientOcclusionSettings& settings, const std::string& cacheDirectory) {
+    if (m_primitiveType != PrimitiveType::TRIANGLES) {
+        std::cerr << "Warning: Ambient occlusion can only be baked for triangle lists" << std::endl;
+        return false;
+    }
+
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> normals;
+    positions.reserve(m_vertices.size());
+    normals.reserve(m_vertices.size());
+    for (const Vertex& vertex : m_vertices) {
+        positions.push_back(vertex.position);
+        normals.push_back(vertex.normal);
+    }
+    return setVertexOcclusion(AmbientOcclusionBaker::bake(positions, normals, m_indices, settings, cacheDirectory).occlusion);
+}
+
+bool Mesh::bakeAmbientOcclusion() {
+    return bakeAmbientOcclusion(AmbientOcclusionSettings());
+}
+
+bool Mesh::generateLightmapCoords(const LightmapUnwrapSettings& settings) {
+    if (m_primitiveType != PrimitiveType::TRIANGLES) {
+        std::cerr << "Warning: Lightmap coordinates can only be generated for triangle lists" << std::endl;
+        return false;
+    }
+
+    std::vector<glm::vec3> positions;
+    positions.reserve(m_vertices.size());
+    for (const Vertex& vertex : m_vertices) {
+        positions.push_back(vertex.position);
+    }
+    const LightmapUnwrap unwrap = LightmapUnwrapper::unwrap(positions, m_indices, settings);
+    if (unwrap.indices.empty() && !m_indices.empty()) {
+        std::cerr << "Warning: Lightmap charts do not fit a " << settings.resolution << " texel atlas" << std::endl;
+        return false;
+    }
+
+    std::vector<Vertex> vertices;
+    vertices.reserve(unwrap.vertexMap.size());
+    for (size_t i = 0; i < unwrap.vertexMap.size(); ++i) {
+        vertices.push_back(m_vertices[unwrap.vertexMap[i]]);
+        vertices.back().lightmapCoords = unwrap.lightmapCoords[i];
+    }
+    setData(vertices, unwrap.indices);
+    return true;
+}
+
+bool Mesh::generateLightmapCoords() {
+    return generateLightmapCoords(LightmapUnwrapSettings());
+}
+
 void Mesh::setMaterial(std::shared_ptr<Material> material) {
     m_material = material;
 }
@@ -301,6 +371,16 @@ void Mesh::setupMesh() {
     glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, texCoords));
     glEnableVertexAttribArray(3);
     glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, tangent));
+    glEnableVertexAttribArray(6);
+    glVertexAttribPointer(6, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, lightmapCoords));
+    if (!m_vertexOcclusion.empty()) {
+        // Baked occlusion as a separate normalized byte stream
+        glGenBuffers(1, &m_occlusionVbo);
+        glBindBuffer(GL_ARRAY_BUFFER, m_occlusionVbo);
+        glBufferData(GL_ARRAY_BUFFER, m_vertexOcclusion.size(), m_vertexOcclusion.data(), GL_STATIC_DRAW);
+        glEnableVertexAttribArray(5);
+        glVertexAttribPointer(5, 1, GL_UNSIGNED_BYTE, GL_TRUE, 1, (void*)0);
+    }
     glBindVertexArray(0);
     */
     
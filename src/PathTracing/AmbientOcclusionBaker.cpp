@@ -0,0 +1,219 @@
+/**
+ * @file AmbientOcclusionBaker.cpp
+ * @brief Implementation of the per-vertex ambient occlusion baker
+ */
+
+#include "PathTracing/AmbientOcclusionBaker.h"
+#include "PathTracing/TriangleBVH.h"
+#include "PathTracing/RandomStream.h"
+#include "Headless/Parallel.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+namespace ElementalRenderer {
+
+namespace {
+
+using RandomStream::hash32;
+
+const float kPi = 3.14159265358979f;
+const int kPacketSize = 4;
+const int kVertexGrain = 64;
+
+const char kFileMagic[8] = {'E', 'R', 'A', 'O', '\0', '\0', '\0', '\0'};
+const uint32_t kFileVersion = 1;
+
+float radicalInverse(uint32_t bits) {
+    bits = (bits << 16u) | (bits >> 16u);
+    bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);
+    bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);
+    bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);
+    bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);
+    return static_cast<float>(bits) * 2.3283064365386963e-10f;
+}
+
+float toUnitFloat(uint32_t bits) {
+    return static_cast<float>(bits >> 8) * (1.0f / 16777216.0f);
+}
+
+void tangentFrame(const glm::vec3& n, glm::vec3& tangent, glm::vec3& bitangent) {
+    const glm::vec3 up = std::abs(n.z) < 0.999f ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(1.0f, 0.0f, 0.0f);
+    tangent = glm::normalize(glm::cross(up, n));
+    bitangent = glm::cross(n, tangent);
+}
+
+void hashBytes(uint64_t& hash, const void* data, size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull; // FNV-1a prime
+    }
+}
+
+// Vertex normals, falling back to area-weighted face normals where missing
+std::vector<glm::vec3> shadingNormals(const std::vector<glm::vec3>& positions, const std::vector<glm::vec3>& normals,
+                                      const std::vector<unsigned int>& indices) {
+    std::vector<glm::vec3> result(positions.size(), glm::vec3(0.0f));
+    std::vector<glm::vec3> faceSums(positions.size(), glm::vec3(0.0f));
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        const glm::vec3 faceNormal = glm::cross(positions[indices[i + 1]] - positions[indices[i]],
+                                                positions[indices[i + 2]] - positions[indices[i]]);
+        for (size_t corner = 0; corner < 3; ++corner) {
+            faceSums[indices[i + corner]] += faceNormal;
+        }
+    }
+    for (size_t v = 0; v < positions.size(); ++v) {
+        const glm::vec3 normal = v < normals.size() ? normals[v] : glm::vec3(0.0f);
+        const glm::vec3& chosen = glm::dot(normal, normal) > 0.0f ? normal : faceSums[v];
+        if (glm::dot(chosen, chosen) > 0.0f) {
+            result[v] = glm::normalize(chosen);
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+uint64_t AmbientOcclusionBaker::computeHash(const std::vector<glm::vec3>& positions, const std::vector<glm::vec3>& normals,
+                                            const std::vector<unsigned int>& indices, const AmbientOcclusionSettings& settings) {
+    uint64_t hash = 14695981039346656037ull; // FNV-1a offset basis
+    hashBytes(hash, &kFileVersion, sizeof(kFileVersion));
+    hashBytes(hash, &settings.rayCount, sizeof(settings.rayCount));
+    hashBytes(hash, &settings.maxDistance, sizeof(settings.maxDistance));
+    hashBytes(hash, &settings.bias, sizeof(settings.bias));
+    hashBytes(hash, &settings.seed, sizeof(settings.seed));
+    const uint64_t sizes[3] = {positions.size(), normals.size(), indices.size()};
+    hashBytes(hash, sizes, sizeof(sizes));
+    hashBytes(hash, positions.data(), positions.size() * sizeof(glm::vec3));
+    hashBytes(hash, normals.data(), normals.size() * sizeof(glm::vec3));
+    hashBytes(hash, indices.data(), indices.size() * sizeof(unsigned int));
+    return hash;
+}
+
+bool AmbientOcclusionBaker::saveToFile(const BakedAmbientOcclusion& baked, const std::string& filePath) {
+    std::ofstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    const uint64_t count = baked.occlusion.size();
+    file.write(kFileMagic, sizeof(kFileMagic));
+    file.write(reinterpret_cast<const char*>(&kFileVersion), sizeof(kFileVersion));
+    file.write(reinterpret_cast<const char*>(&baked.hash), sizeof(baked.hash));
+    file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    file.write(reinterpret_cast<const char*>(baked.occlusion.data()), static_cast<std::streamsize>(count));
+    return static_cast<bool>(file);
+}
+
+bool AmbientOcclusionBaker::loadFromFile(const std::string& filePath, BakedAmbientOcclusion& baked, uint64_t expectedHash) {
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    char magic[sizeof(kFileMagic)];
+    uint32_t version = 0;
+    uint64_t hash = 0;
+    uint64_t count = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    file.read(reinterpret_cast<char*>(&hash), sizeof(hash));
+    file.read(reinterpret_cast<char*>(&count), sizeof(count));
+    if (!file || std::memcmp(magic, kFileMagic, sizeof(magic)) != 0 || version != kFileVersion
+        || (expectedHash != 0 && hash != expectedHash) || count > (1ull << 32)) {
+        return false;
+    }
+
+    BakedAmbientOcclusion result;
+    result.hash = hash;
+    result.occlusion.resize(static_cast<size_t>(count));
+    file.read(reinterpret_cast<char*>(result.occlusion.data()), static_cast<std::streamsize>(count));
+    if (!file) {
+        return false;
+    }
+    baked = std::move(result);
+    return true;
+}
+
+BakedAmbientOcclusion AmbientOcclusionBaker::bake(const std::vector<glm::vec3>& positions, const std::vector<glm::vec3>& normals,
+                                                  const std::vector<unsigned int>& indices,
+                                                  const AmbientOcclusionSettings& settings, const std::string& cacheDirectory) {
+    BakedAmbientOcclusion baked;
+    baked.hash = computeHash(positions, normals, indices, settings);
+
+    std::string cachePath;
+    if (!cacheDirectory.empty()) {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016llx.ao", static_cast<unsigned long long>(baked.hash));
+        cachePath = (std::filesystem::path(cacheDirectory) / name).string();
+        if (loadFromFile(cachePath, baked, baked.hash) && baked.occlusion.size() == positions.size()) {
+            baked.loadedFromCache = true;
+            return baked;
+        }
+        baked.occlusion.clear();
+    }
+
+    TriangleBVH bvh;
+    bvh.build(positions, indices);
+    const std::vector<glm::vec3> vertexNormals = shadingNormals(positions, normals, indices);
+    const BoundingBox& bounds = bvh.getBounds();
+    const float offset = settings.bias * (bounds.isEmpty() ? 1.0f : std::max(glm::length(bounds.getExtent()), 1e-6f));
+    const int packetCount = std::max((settings.rayCount + kPacketSize - 1) / kPacketSize, 1);
+    const int rayCount = packetCount * kPacketSize;
+
+    baked.occlusion.assign(positions.size(), 255);
+    Parallel::forRange(0, static_cast<int>(positions.size()), kVertexGrain, [&](int begin, int end) {
+        for (int vertex = begin; vertex < end; ++vertex) {
+            const glm::vec3& normal = vertexNormals[vertex];
+            if (glm::dot(normal, normal) == 0.0f) {
+                continue;
+            }
+            glm::vec3 tangent;
+            glm::vec3 bitangent;
+            tangentFrame(normal, tangent, bitangent);
+
+            // Cranley-Patterson rotation of the shared point set, per vertex
+            const uint32_t key = hash32(settings.seed ^ hash32(static_cast<uint32_t>(vertex)));
+            const glm::vec2 rotation(toUnitFloat(key), toUnitFloat(hash32(key)));
+
+            Ray packet[kPacketSize];
+            int unoccluded = 0;
+            for (int p = 0; p < packetCount; ++p) {
+                for (int lane = 0; lane < kPacketSize; ++lane) {
+                    const int index = p * kPacketSize + lane;
+                    glm::vec2 u(static_cast<float>(index) / rayCount + rotation.x, radicalInverse(static_cast<uint32_t>(index)) + rotation.y);
+                    u -= glm::floor(u);
+
+                    // Cosine-distributed direction around the normal
+                    const float radius = std::sqrt(u.x);
+                    const float phi = 2.0f * kPi * u.y;
+                    const float z = std::sqrt(std::max(1.0f - u.x, 0.0f));
+                    Ray& ray = packet[lane];
+                    ray.origin = positions[vertex] + normal * offset;
+                    ray.direction = tangent * (radius * std::cos(phi)) + bitangent * (radius * std::sin(phi)) + normal * z;
+                    ray.tMax = settings.maxDistance;
+                }
+                const int occluded = bvh.occludedPacket(packet);
+                for (int lane = 0; lane < kPacketSize; ++lane) {
+                    unoccluded += (occluded >> lane) & 1 ? 0 : 1;
+                }
+            }
+            const float visibility = static_cast<float>(unoccluded) / static_cast<float>(rayCount);
+            baked.occlusion[vertex] = static_cast<uint8_t>(std::lround(visibility * 255.0f));
+        }
+    });
+
+    if (!cachePath.empty()) {
+        std::error_code error;
+        std::filesystem::create_directories(cacheDirectory, error);
+        if (!saveToFile(baked, cachePath)) {
+            std::cerr << "Warning: Could not write ambient occlusion cache '" << cachePath << "'" << std::endl;
+        }
+    }
+    return baked;
+}
+
+} // namespace ElementalRenderer
@@ -0,0 +1,401 @@
+/**
+ * @file LightBVH.cpp
+ * @brief Implementation of the light BVH
+ */
+
+#include "PathTracing/LightBVH.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+namespace ElementalRenderer {
+
+namespace {
+
+const float kPi = 3.14159265358979f;
+const float kOneMinusEpsilon = 0x1.fffffep-1f;
+const int kBucketCount = 12;
+
+float safeSqrt(float value) {
+    return std::sqrt(std::max(value, 0.0f));
+}
+
+float safeAcos(float value) {
+    return std::acos(std::clamp(value, -1.0f, 1.0f));
+}
+
+// cos(max(0, a - b)) and sin(max(0, a - b)) from the sines and cosines of a and b
+float cosSubClamped(float sinA, float cosA, float sinB, float cosB) {
+    return cosA > cosB ? 1.0f : cosA * cosB + sinA * sinB;
+}
+
+float sinSubClamped(float sinA, float cosA, float sinB, float cosB) {
+    return cosA > cosB ? 0.0f : sinA * cosB - cosA * sinB;
+}
+
+// Angle between unit vectors, accurate for nearly parallel vectors
+float angleBetween(const glm::vec3& a, const glm::vec3& b) {
+    if (glm::dot(a, b) < 0.0f) {
+        return kPi - 2.0f * std::asin(std::min(glm::length(a + b) * 0.5f, 1.0f));
+    }
+    return 2.0f * std::asin(std::min(glm::length(b - a) * 0.5f, 1.0f));
+}
+
+// Rodrigues rotation about a unit axis
+glm::vec3 rotate(const glm::vec3& v, const glm::vec3& axis, float angle) {
+    const float c = std::cos(angle);
+    const float s = std::sin(angle);
+    return v * c + glm::cross(axis, v) * s + axis * (glm::dot(axis, v) * (1.0f - c));
+}
+
+// Smallest cone around both cones (direction, cosTheta)
+void mergeCones(const glm::vec3& wa, float cosA, const glm::vec3& wb, float cosB, glm::vec3& w, float& cosTheta) {
+    const float thetaA = safeAcos(cosA);
+    const float thetaB = safeAcos(cosB);
+    const float thetaD = angleBetween(wa, wb);
+    if (std::min(thetaD + thetaB, kPi) <= thetaA) {
+        w = wa;
+        cosTheta = cosA;
+        return;
+    }
+    if (std::min(thetaD + thetaA, kPi) <= thetaB) {
+        w = wb;
+        cosTheta = cosB;
+        return;
+    }
+
+    const float thetaO = 0.5f * (thetaA + thetaD + thetaB);
+    const glm::vec3 axis = glm::cross(wa, wb);
+    if (thetaO >= kPi || glm::dot(axis, axis) < 1e-12f) {
+        w = wa;
+        cosTheta = -1.0f;
+        return;
+    }
+    w = glm::normalize(rotate(wa, glm::normalize(axis), thetaO - thetaA));
+    cosTheta = std::cos(thetaO);
+}
+
+float surfaceArea(const BoundingBox& box) {
+    const glm::vec3 extent = box.getExtent();
+    return 2.0f * (extent.x * extent.y + extent.y * extent.z + extent.z * extent.x);
+}
+
+// Surface area orientation heuristic cost of a bucket group
+float splitCost(const LightBounds& bounds, float regularization) {
+    if (bounds.power <= 0.0f) {
+        return 0.0f;
+    }
+    const float thetaO = safeAcos(bounds.cosThetaO);
+    const float thetaE = safeAcos(bounds.cosThetaE);
+    const float thetaW = std::min(thetaO + thetaE, kPi);
+    const float sinThetaO = std::sin(thetaO);
+    const float orientation = 2.0f * kPi * (1.0f - bounds.cosThetaO)
+                            + 0.5f * kPi * (2.0f * thetaW * sinThetaO - std::cos(thetaO - 2.0f * thetaW)
+                                            - 2.0f * thetaO * sinThetaO + bounds.cosThetaO);
+    // Groups of lights on a line or at one point still compare by power and orientation
+    const float area = std::max(surfaceArea(bounds.bounds), 1e-12f);
+    return bounds.power * orientation * regularization * area;
+}
+
+} // namespace
+
+float LightBounds::importance(const glm::vec3& point, const glm::vec3& normal) const {
+    if (power <= 0.0f) {
+        return 0.0f;
+    }
+    const glm::vec3 center = bounds.getCenter();
+    const float radius = 0.5f * glm::length(bounds.getExtent());
+    const glm::vec3 toPoint = point - center;
+    // Points inside the bounds see the lights at a distance of about the bounds' radius
+    const float distance2 = std::max(glm::dot(toPoint, toPoint), radius);
+
+    // Angle between the emission axis and the point, reduced by the cone and by the bounds' extent
+    const glm::vec3 toPointDirection = glm::dot(toPoint, toPoint) > 0.0f ? glm::normalize(toPoint) : direction;
+    float cosThetaW = glm::dot(direction, toPointDirection);
+    if (twoSided) {
+        cosThetaW = std::abs(cosThetaW);
+    }
+    const float sinThetaW = safeSqrt(1.0f - cosThetaW * cosThetaW);
+
+    const float radius2 = radius * radius;
+    const float cosThetaB = glm::dot(toPoint, toPoint) <= radius2 ? -1.0f : safeSqrt(1.0f - radius2 / glm::dot(toPoint, toPoint));
+    const float sinThetaB = safeSqrt(1.0f - cosThetaB * cosThetaB);
+    const float sinThetaO = safeSqrt(1.0f - cosThetaO * cosThetaO);
+
+    const float cosThetaX = cosSubClamped(sinThetaW, cosThetaW, sinThetaO, cosThetaO);
+    const float sinThetaX = sinSubClamped(sinThetaW, cosThetaW, sinThetaO, cosThetaO);
+    const float cosThetaP = cosSubClamped(sinThetaX, cosThetaX, sinThetaB, cosThetaB);
+    if (cosThetaP <= cosThetaE) {
+        return 0.0f;
+    }
+    float result = power * cosThetaP / distance2;
+
+    // Incident angle at the receiver, reduced by the bounds' extent
+    if (glm::dot(normal, normal) > 0.0f) {
+        const float cosThetaI = std::abs(glm::dot(-toPointDirection, normal));
+        const float sinThetaI = safeSqrt(1.0f - cosThetaI * cosThetaI);
+        result *= cosSubClamped(sinThetaI, cosThetaI, sinThetaB, cosThetaB);
+    }
+    return std::max(result, 0.0f);
+}
+
+LightBounds LightBounds::merge(const LightBounds& a, const LightBounds& b) {
+    if (a.power <= 0.0f) {
+        return b;
+    }
+    if (b.power <= 0.0f) {
+        return a;
+    }
+    LightBounds result;
+    result.bounds = a.bounds;
+    result.bounds.expand(b.bounds);
+    mergeCones(a.direction, a.cosThetaO, b.direction, b.cosThetaO, result.direction, result.cosThetaO);
+    result.cosThetaE = std::min(a.cosThetaE, b.cosThetaE);
+    result.power = a.power + b.power;
+    result.twoSided = a.twoSided || b.twoSided;
+    return result;
+}
+
+void LightBVH::build(const std::vector<LightEmitter>& emitters) {
+    m_emitters = emitters;
+    m_nodes.clear();
+    m_emitterLeaves.assign(m_emitters.size(), -1);
+    m_infiniteEmitters.clear();
+    m_dirtyNodes.clear();
+    m_needsRebuild = false;
+
+    std::vector<size_t> finite;
+    for (size_t i = 0; i < m_emitters.size(); ++i) {
+        if (m_emitters[i].infinite) {
+            m_infiniteEmitters.push_back(i);
+        } else if (m_emitters[i].bounds.power > 0.0f) {
+            finite.push_back(i);
+        }
+    }
+    if (!finite.empty()) {
+        m_nodes.reserve(2 * finite.size() - 1);
+        buildRecursive(finite, 0, finite.size(), -1);
+    }
+}
+
+int LightBVH::buildRecursive(std::vector<size_t>& indices, size_t begin, size_t end, int parent) {
+    const int nodeIndex = static_cast<int>(m_nodes.size());
+    m_nodes.emplace_back();
+    m_nodes[nodeIndex].parent = parent;
+    if (end - begin == 1) {
+        m_nodes[nodeIndex].emitter = static_cast<int>(indices[begin]);
+        m_nodes[nodeIndex].bounds = m_emitters[indices[begin]].bounds;
+        m_emitterLeaves[indices[begin]] = nodeIndex;
+        return nodeIndex;
+    }
+
+    BoundingBox centroids;
+    BoundingBox total;
+    for (size_t i = begin; i < end; ++i) {
+        const BoundingBox& box = m_emitters[indices[i]].bounds.bounds;
+        centroids.expand(box.getCenter());
+        total.expand(box);
+    }
+    const glm::vec3 centroidExtent = centroids.getExtent();
+    const glm::vec3 totalExtent = total.getExtent();
+    const float maxExtent = std::max(totalExtent.x, std::max(totalExtent.y, totalExtent.z));
+
+    // Bucketed surface area orientation heuristic over all three axes
+    float bestCost = std::numeric_limits<float>::max();
+    int bestAxis = -1;
+    int bestSplit = 0;
+    for (int axis = 0; axis < 3; ++axis) {
+        if (centroidExtent[axis] <= 0.0f) {
+            continue;
+        }
+        LightBounds buckets[kBucketCount];
+        for (size_t i = begin; i < end; ++i) {
+            const LightBounds& bounds = m_emitters[indices[i]].bounds;
+            const float offset = (bounds.bounds.getCenter()[axis] - centroids.min[axis]) / centroidExtent[axis];
+            const int bucket = std::min(static_cast<int>(offset * kBucketCount), kBucketCount - 1);
+            buckets[bucket] = LightBounds::merge(buckets[bucket], bounds);
+        }
+
+        LightBounds above[kBucketCount];
+        above[kBucketCount - 1] = buckets[kBucketCount - 1];
+        for (int b = kBucketCount - 2; b >= 0; --b) {
+            above[b] = LightBounds::merge(buckets[b], above[b + 1]);
+        }
+        const float regularization = maxExtent / std::max(totalExtent[axis], 1e-12f);
+        LightBounds below;
+        for (int split = 1; split < kBucketCount; ++split) {
+            below = LightBounds::merge(below, buckets[split - 1]);
+            if (below.power <= 0.0f || above[split].power <= 0.0f) {
+                continue;
+            }
+            const float cost = splitCost(below, regularization) + splitCost(above[split], regularization);
+            if (cost < bestCost) {
+                bestCost = cost;
+                bestAxis = axis;
+                bestSplit = split;
+            }
+        }
+    }
+
+    size_t middle = begin;
+    if (bestAxis >= 0) {
+        const int axis = bestAxis;
+        auto split = std::partition(indices.begin() + begin, indices.begin() + end, [&](size_t index) {
+            const float offset = (m_emitters[index].bounds.bounds.getCenter()[axis] - centroids.min[axis]) / centroidExtent[axis];
+            return std::min(static_cast<int>(offset * kBucketCount), kBucketCount - 1) < bestSplit;
+        });
+        middle = static_cast<size_t>(split - indices.begin());
+    }
+    if (middle == begin || middle == end) {
+        // Coincident lights: any balanced split is as good as another
+        middle = begin + (end - begin) / 2;
+    }
+
+    const int left = buildRecursive(indices, begin, middle, nodeIndex);
+    const int right = buildRecursive(indices, middle, end, nodeIndex);
+    Node& node = m_nodes[nodeIndex];
+    node.children[0] = left;
+    node.children[1] = right;
+    node.bounds = LightBounds::merge(m_nodes[left].bounds, m_nodes[right].bounds);
+    return nodeIndex;
+}
+
+void LightBVH::clear() {
+    build(std::vector<LightEmitter>());
+}
+
+LightBounds LightBVH::getRootBounds() const {
+    return m_nodes.empty() ? LightBounds() : m_nodes[0].bounds;
+}
+
+void LightBVH::updateEmitter(size_t index, const LightEmitter& emitter) {
+    if (index >= m_emitters.size()) {
+        return;
+    }
+    const bool wasInTree = m_emitterLeaves[index] >= 0;
+    const bool inTree = !emitter.infinite && emitter.bounds.power > 0.0f;
+    const bool wasInfinite = m_emitters[index].infinite;
+    m_emitters[index] = emitter;
+    if (wasInTree != inTree || wasInfinite != emitter.infinite) {
+        m_needsRebuild = true;
+        return;
+    }
+    for (int node = m_emitterLeaves[index]; node >= 0; node = m_nodes[node].parent) {
+        m_dirtyNodes.push_back(node);
+    }
+}
+
+size_t LightBVH::refit() {
+    if (m_needsRebuild) {
+        const std::vector<LightEmitter> emitters = m_emitters;
+        build(emitters);
+        return m_nodes.size();
+    }
+
+    // Children follow their parents, so descending order updates children first
+    std::sort(m_dirtyNodes.begin(), m_dirtyNodes.end(), std::greater<int>());
+    m_dirtyNodes.erase(std::unique(m_dirtyNodes.begin(), m_dirtyNodes.end()), m_dirtyNodes.end());
+    for (int index : m_dirtyNodes) {
+        Node& node = m_nodes[index];
+        if (node.emitter >= 0) {
+            node.bounds = m_emitters[node.emitter].bounds;
+        } else {
+            node.bounds = LightBounds::merge(m_nodes[node.children[0]].bounds, m_nodes[node.children[1]].bounds);
+        }
+    }
+    const size_t count = m_dirtyNodes.size();
+    m_dirtyNodes.clear();
+    return count;
+}
+
+float LightBVH::infiniteProbability() const {
+    if (m_infiniteEmitters.empty()) {
+        return 0.0f;
+    }
+    if (m_nodes.empty()) {
+        return 1.0f;
+    }
+    const float infiniteCount = static_cast<float>(m_infiniteEmitters.size());
+    return infiniteCount / (infiniteCount + 1.0f);
+}
+
+bool LightBVH::sample(const glm::vec3& point, const glm::vec3& normal, float u, size_t& emitterIndex, float& probability) const {
+    const float pInfinite = infiniteProbability();
+    if (u < pInfinite) {
+        u = std::min(u / pInfinite, kOneMinusEpsilon);
+        const size_t count = m_infiniteEmitters.size();
+        emitterIndex = m_infiniteEmitters[std::min(static_cast<size_t>(u * count), count - 1)];
+        probability = pInfinite / static_cast<float>(count);
+        return true;
+    }
+    if (m_nodes.empty()) {
+        return false;
+    }
+
+    u = std::min((u - pInfinite) / (1.0f - pInfinite), kOneMinusEpsilon);
+    float p = 1.0f - pInfinite;
+    int index = 0;
+    if (m_nodes[0].bounds.importance(point, normal) <= 0.0f) {
+        return false;
+    }
+    while (m_nodes[index].emitter < 0) {
+        const Node& node = m_nodes[index];
+        const float left = m_nodes[node.children[0]].bounds.importance(point, normal);
+        const float right = m_nodes[node.children[1]].bounds.importance(point, normal);
+        if (left + right <= 0.0f) {
+            return false;
+        }
+        const float pLeft = left / (left + right);
+        if (u < pLeft) {
+            index = node.children[0];
+            u = std::min(u / pLeft, kOneMinusEpsilon);
+            p *= pLeft;
+        } else {
+            index = node.children[1];
+            u = std::min((u - pLeft) / (1.0f - pLeft), kOneMinusEpsilon);
+            p *= 1.0f - pLeft;
+        }
+    }
+    emitterIndex = static_cast<size_t>(m_nodes[index].emitter);
+    probability = p;
+    return true;
+}
+
+float LightBVH::probability(const glm::vec3& point, const glm::vec3& normal, size_t emitterIndex) const {
+    if (emitterIndex >= m_emitters.size()) {
+        return 0.0f;
+    }
+    const float pInfinite = infiniteProbability();
+    if (m_emitters[emitterIndex].infinite) {
+        return pInfinite / static_cast<float>(m_infiniteEmitters.size());
+    }
+    int index = m_emitterLeaves[emitterIndex];
+    if (index < 0 || m_nodes[0].bounds.importance(point, normal) <= 0.0f) {
+        return 0.0f;
+    }
+
+    float p = 1.0f - pInfinite;
+    for (int parent = m_nodes[index].parent; parent >= 0; index = parent, parent = m_nodes[parent].parent) {
+        const Node& node = m_nodes[parent];
+        const float left = m_nodes[node.children[0]].bounds.importance(point, normal);
+        const float right = m_nodes[node.children[1]].bounds.importance(point, normal);
+        if (left + right <= 0.0f) {
+            return 0.0f;
+        }
+        p *= (index == node.children[0] ? left : right) / (left + right);
+    }
+    return p;
+}
+
+bool LightBVH::sampleUniform(float u, size_t& emitterIndex, float& probability) const {
+    if (m_emitters.empty()) {
+        return false;
+    }
+    const size_t count = m_emitters.size();
+    emitterIndex = std::min(static_cast<size_t>(std::min(u, kOneMinusEpsilon) * count), count - 1);
+    probability = 1.0f / static_cast<float>(count);
+    return true;
+}
+
+} // namespace ElementalRenderer
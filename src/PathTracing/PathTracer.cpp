@@ -0,0 +1,397 @@
+/**
+ * @file PathTracer.cpp
+ * @brief Implementation of the progressive CPU path tracer
+ */
+
+#include "PathTracing/PathTracer.h"
+#include "Headless/Parallel.h"
+#include "PathTracing/RandomStream.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ElementalRenderer {
+
+namespace {
+
+using RandomStream::Sampler;
+using RandomStream::makeBasis;
+
+const float kPi = 3.14159265358979f;
+// Shadow and bounce rays start this far off the surface, relative to the scene's scale
+const float kRayOffset = 1e-4f;
+// Paths may be terminated by Russian roulette from this bounce on
+const int kRouletteBounce = 2;
+// Separates the camera jitter sequence from the path sequence of a pixel
+const uint32_t kCameraSalt = 0x9e3779b9u;
+
+float luminance(const glm::vec3& color) {
+    return glm::dot(color, glm::vec3(0.2126f, 0.7152f, 0.0722f));
+}
+
+// Uniform point on the unit disk (Shirley-Chiu concentric mapping)
+glm::vec2 sampleDisk(float u, float v) {
+    const float x = 2.0f * u - 1.0f;
+    const float y = 2.0f * v - 1.0f;
+    if (x == 0.0f && y == 0.0f) {
+        return glm::vec2(0.0f);
+    }
+    if (std::abs(x) > std::abs(y)) {
+        const float angle = 0.25f * kPi * (y / x);
+        return glm::vec2(x * std::cos(angle), x * std::sin(angle));
+    }
+    const float angle = 0.5f * kPi - 0.25f * kPi * (x / y);
+    return glm::vec2(y * std::cos(angle), y * std::sin(angle));
+}
+
+glm::vec3 sampleCosineHemisphere(const glm::vec3& normal, float u, float v) {
+    const glm::vec2 disk = sampleDisk(u, v);
+    const float z = std::sqrt(std::max(0.0f, 1.0f - disk.x * disk.x - disk.y * disk.y));
+    glm::vec3 tangent;
+    glm::vec3 bitangent;
+    makeBasis(normal, tangent, bitangent);
+    return tangent * disk.x + bitangent * disk.y + normal * z;
+}
+
+float smoothStep(float edge0, float edge1, float x) {
+    if (edge1 <= edge0) {
+        return x >= edge1 ? 1.0f : 0.0f;
+    }
+    const float t = std::clamp((x - edge0) / (edge1 - edge0), 0.0f, 1.0f);
+    return t * t * (3.0f - 2.0f * t);
+}
+
+// MainFragmentShader.glsl's point light attenuation
+float attenuation(float distance) {
+    return 1.0f / (1.0f + 0.09f * distance + 0.032f * distance * distance);
+}
+
+} // namespace
+
+void PathTracerScene::addMesh(const std::vector<glm::vec3>& meshPositions, const std::vector<glm::vec3>& meshNormals,
+                              const std::vector<unsigned int>& meshIndices, const PathTracerMaterial& material) {
+    const unsigned int base = static_cast<unsigned int>(positions.size());
+    positions.insert(positions.end(), meshPositions.begin(), meshPositions.end());
+    if (meshNormals.size() == meshPositions.size()) {
+        normals.insert(normals.end(), meshNormals.begin(), meshNormals.end());
+    } else {
+        // Zero normals select the geometric normal
+        normals.resize(positions.size(), glm::vec3(0.0f));
+    }
+
+    const uint32_t materialIndex = static_cast<uint32_t>(materials.size());
+    materials.push_back(material);
+    for (size_t i = 0; i + 2 < meshIndices.size(); i += 3) {
+        indices.push_back(base + meshIndices[i]);
+        indices.push_back(base + meshIndices[i + 1]);
+        indices.push_back(base + meshIndices[i + 2]);
+        triangleMaterials.push_back(materialIndex);
+    }
+}
+
+PathTracer::PathTracer()
+    : m_inverseViewProjection(1.0f)
+    , m_sampleCount(0)
+    , m_cancelRequested(false) {
+    reset();
+}
+
+void PathTracer::setScene(const PathTracerScene& scene) {
+    m_scene = scene;
+    const size_t triangleCount = m_scene.indices.size() / 3;
+    m_scene.normals.resize(m_scene.positions.size(), glm::vec3(0.0f));
+    m_scene.triangleMaterials.resize(triangleCount, 0);
+    if (m_scene.materials.empty()) {
+        m_scene.materials.emplace_back();
+    }
+    for (uint32_t& material : m_scene.triangleMaterials) {
+        material = std::min(material, static_cast<uint32_t>(m_scene.materials.size() - 1));
+    }
+
+    m_triangleBVH.build(m_scene.positions, m_scene.indices);
+    std::vector<LightEmitter> emitters;
+    emitters.reserve(m_scene.lights.size());
+    for (const PathTracerLight& light : m_scene.lights) {
+        emitters.push_back(makeEmitter(light));
+    }
+    m_lightBVH.build(emitters);
+    reset();
+}
+
+void PathTracer::setSettings(const PathTracerSettings& settings) {
+    m_settings = settings;
+    m_settings.width = std::max(settings.width, 0);
+    m_settings.height = std::max(settings.height, 0);
+    m_settings.maxBounces = std::max(settings.maxBounces, 0);
+    m_settings.tileSize = std::max(settings.tileSize, 1);
+    reset();
+}
+
+void PathTracer::setCamera(const glm::mat4& view, const glm::mat4& projection) {
+    m_inverseViewProjection = glm::inverse(projection * view);
+    reset();
+}
+
+void PathTracer::reset() {
+    m_accumulation.assign(static_cast<size_t>(m_settings.width) * m_settings.height, glm::vec3(0.0f));
+    m_sampleCount = 0;
+}
+
+void PathTracer::cancel() {
+    m_cancelRequested.store(true);
+}
+
+bool PathTracer::renderPass() {
+    const int width = m_settings.width;
+    const int height = m_settings.height;
+    const int tileSize = m_settings.tileSize;
+    const int tilesX = (width + tileSize - 1) / tileSize;
+    const int tilesY = (height + tileSize - 1) / tileSize;
+    const uint32_t sampleIndex = static_cast<uint32_t>(m_sampleCount);
+
+    std::vector<glm::vec3> pass(m_accumulation.size());
+    Parallel::forEach(0, tilesX * tilesY, [&](int tile) {
+        if (m_cancelRequested.load(std::memory_order_relaxed)) {
+            return;
+        }
+        const int x0 = (tile % tilesX) * tileSize;
+        const int y0 = (tile / tilesX) * tileSize;
+        const int x1 = std::min(x0 + tileSize, width);
+        const int y1 = std::min(y0 + tileSize, height);
+        for (int y = y0; y < y1; ++y) {
+            for (int x = x0; x < x1; ++x) {
+                const uint32_t pixelIndex = static_cast<uint32_t>(y * width + x);
+                Sampler jitter(m_settings.seed ^ kCameraSalt, pixelIndex, sampleIndex);
+                const float ndcX = 2.0f * (x + jitter.next()) / width - 1.0f;
+                const float ndcY = 2.0f * (y + jitter.next()) / height - 1.0f;
+                glm::vec4 nearPoint = m_inverseViewProjection * glm::vec4(ndcX, ndcY, -1.0f, 1.0f);
+                glm::vec4 farPoint = m_inverseViewProjection * glm::vec4(ndcX, ndcY, 1.0f, 1.0f);
+                nearPoint /= nearPoint.w;
+                farPoint /= farPoint.w;
+
+                Ray ray;
+                ray.origin = glm::vec3(nearPoint);
+                ray.direction = glm::normalize(glm::vec3(farPoint) - glm::vec3(nearPoint));
+                pass[pixelIndex] = tracePath(ray, pixelIndex, sampleIndex);
+            }
+        }
+    });
+
+    if (m_cancelRequested.exchange(false)) {
+        return false;
+    }
+    for (size_t i = 0; i < pass.size(); ++i) {
+        m_accumulation[i] += pass[i];
+    }
+    ++m_sampleCount;
+    return true;
+}
+
+Image PathTracer::getImage() const {
+    Image image(m_settings.width, m_settings.height, glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+    if (m_sampleCount == 0) {
+        return image;
+    }
+    const float scale = 1.0f / static_cast<float>(m_sampleCount);
+    for (int y = 0; y < m_settings.height; ++y) {
+        glm::vec4* row = image.getRow(y);
+        for (int x = 0; x < m_settings.width; ++x) {
+            row[x] = glm::vec4(m_accumulation[static_cast<size_t>(y) * m_settings.width + x] * scale, 1.0f);
+        }
+    }
+    return image;
+}
+
+glm::vec3 PathTracer::tracePath(const Ray& cameraRay, uint32_t pixelIndex, uint32_t sampleIndex) const {
+    return tracePath(cameraRay, pixelIndex, sampleIndex, m_settings.maxBounces);
+}
+
+glm::vec3 PathTracer::tracePath(const Ray& cameraRay, uint32_t pixelIndex, uint32_t sampleIndex, int maxBounces) const {
+    Sampler sampler(m_settings.seed, pixelIndex, sampleIndex);
+    const BoundingBox& sceneBounds = m_triangleBVH.getBounds();
+    const float sceneScale = sceneBounds.isEmpty() ? 1.0f
+        : std::max(1.0f, std::max(glm::length(sceneBounds.min), glm::length(sceneBounds.max)));
+    const float offset = kRayOffset * sceneScale;
+
+    glm::vec3 radiance(0.0f);
+    glm::vec3 throughput(1.0f);
+    Ray ray = cameraRay;
+    for (int bounce = 0;; ++bounce) {
+        RayHit hit;
+        if (!m_triangleBVH.intersect(ray, hit)) {
+            radiance += throughput * m_scene.environment;
+            break;
+        }
+
+        const unsigned int* triangle = &m_scene.indices[3 * static_cast<size_t>(hit.triangle)];
+        const float w = 1.0f - hit.u - hit.v;
+        const glm::vec3& p0 = m_scene.positions[triangle[0]];
+        const glm::vec3& p1 = m_scene.positions[triangle[1]];
+        const glm::vec3& p2 = m_scene.positions[triangle[2]];
+        const glm::vec3 point = p0 * w + p1 * hit.u + p2 * hit.v;
+        const glm::vec3 view = -glm::normalize(ray.direction);
+
+        // Face both normals towards the incoming ray
+        glm::vec3 geometricNormal = glm::normalize(glm::cross(p1 - p0, p2 - p0));
+        if (glm::dot(geometricNormal, view) < 0.0f) {
+            geometricNormal = -geometricNormal;
+        }
+        glm::vec3 normal = m_scene.normals[triangle[0]] * w + m_scene.normals[triangle[1]] * hit.u
+                         + m_scene.normals[triangle[2]] * hit.v;
+        const float normalLength = glm::length(normal);
+        normal = normalLength > 0.0f ? normal / normalLength : geometricNormal;
+        if (glm::dot(normal, geometricNormal) < 0.0f) {
+            normal = -normal;
+        }
+        const glm::vec3 origin = point + geometricNormal * offset;
+
+        const PathTracerMaterial& material = m_scene.materials[m_scene.triangleMaterials[hit.triangle]];
+        radiance += throughput * material.emission;
+
+        // Next-event estimation towards one light chosen by the light BVH
+        glm::vec3 lightDirection;
+        float lightDistance;
+        glm::vec3 lightRadiance;
+        const float uLight = sampler.next();
+        const glm::vec2 uPoint(sampler.next(), sampler.next());
+        if (sampleDirectLight(point, normal, uLight, uPoint, lightDirection, lightDistance, lightRadiance)
+            && glm::dot(normal, lightDirection) > 0.0f && glm::dot(geometricNormal, lightDirection) > 0.0f) {
+            Ray shadowRay;
+            shadowRay.origin = origin;
+            shadowRay.direction = lightDirection;
+            shadowRay.tMax = lightDistance - 2.0f * offset;
+            if (shadowRay.tMax > 0.0f && !m_triangleBVH.occluded(shadowRay)) {
+                radiance += throughput * lightRadiance
+                          * BRDF::evaluate(material.model, material.brdf, normal, lightDirection, view);
+            }
+        }
+        if (bounce >= maxBounces) {
+            break;
+        }
+
+        // Cosine-weighted bounce: BRDF::evaluate() includes the cosine, the pdf is cos / pi
+        const glm::vec3 direction = sampleCosineHemisphere(normal, sampler.next(), sampler.next());
+        const float cosTheta = glm::dot(normal, direction);
+        if (cosTheta <= 0.0f || glm::dot(geometricNormal, direction) <= 0.0f) {
+            break;
+        }
+        throughput *= BRDF::evaluate(material.model, material.brdf, normal, direction, view) * (kPi / cosTheta);
+
+        if (bounce >= kRouletteBounce) {
+            const float survival = std::min(std::max(throughput.x, std::max(throughput.y, throughput.z)), 0.95f);
+            if (sampler.next() >= survival) {
+                break;
+            }
+            throughput /= survival;
+        }
+        if (throughput.x <= 0.0f && throughput.y <= 0.0f && throughput.z <= 0.0f) {
+            break;
+        }
+
+        ray.origin = origin;
+        ray.direction = direction;
+        ray.tMax = std::numeric_limits<float>::max();
+    }
+    return radiance;
+}
+
+bool PathTracer::sampleDirectLight(const glm::vec3& point, const glm::vec3& normal, float uLight, const glm::vec2& uPoint,
+                                   glm::vec3& direction, float& distance, glm::vec3& radiance) const {
+    size_t index;
+    float selection;
+    if (!m_lightBVH.sample(point, normal, uLight, index, selection) || selection <= 0.0f) {
+        return false;
+    }
+
+    const PathTracerLight& light = m_scene.lights[index];
+    switch (light.type) {
+        case PathTracerLight::Type::DIRECTIONAL:
+            direction = -light.direction;
+            distance = std::numeric_limits<float>::max();
+            radiance = light.radiance;
+            break;
+        case PathTracerLight::Type::POINT:
+        case PathTracerLight::Type::SPOT: {
+            const glm::vec3 toLight = light.position - point;
+            distance = glm::length(toLight);
+            if (distance <= 0.0f) {
+                return false;
+            }
+            direction = toLight / distance;
+            radiance = light.radiance * attenuation(distance);
+            if (light.type == PathTracerLight::Type::SPOT) {
+                radiance *= smoothStep(light.cosOuter, light.cosInner, glm::dot(-direction, light.direction));
+            }
+            break;
+        }
+        case PathTracerLight::Type::AREA: {
+            // Uniform point on the light, converted from area to solid angle measure
+            const glm::vec2 local = light.disk ? sampleDisk(uPoint.x, uPoint.y) : uPoint * 2.0f - glm::vec2(1.0f);
+            const glm::vec3 lightPoint = light.position + light.axisX * local.x + light.axisY * local.y;
+            const float halfExtents = glm::length(light.axisX) * glm::length(light.axisY);
+            const float area = light.disk ? kPi * halfExtents : 4.0f * halfExtents;
+            const glm::vec3 toLight = lightPoint - point;
+            const float distance2 = glm::dot(toLight, toLight);
+            if (distance2 <= 0.0f || area <= 0.0f) {
+                return false;
+            }
+            distance = std::sqrt(distance2);
+            direction = toLight / distance;
+            float cosLight = -glm::dot(glm::normalize(glm::cross(light.axisY, light.axisX)), direction);
+            if (light.twoSided) {
+                cosLight = std::abs(cosLight);
+            }
+            if (cosLight <= 0.0f) {
+                return false;
+            }
+            radiance = light.radiance * (cosLight * area / distance2);
+            break;
+        }
+    }
+    radiance /= selection;
+    return true;
+}
+
+LightEmitter PathTracer::makeEmitter(const PathTracerLight& light) {
+    LightEmitter emitter;
+    const float intensity = luminance(light.radiance);
+    LightBounds& bounds = emitter.bounds;
+
+    switch (light.type) {
+        case PathTracerLight::Type::DIRECTIONAL:
+            emitter.infinite = true;
+            bounds.power = intensity;
+            break;
+        case PathTracerLight::Type::POINT:
+            bounds.bounds = BoundingBox(light.position, light.position);
+            bounds.power = 4.0f * kPi * intensity;
+            break;
+        case PathTracerLight::Type::SPOT: {
+            const float cosInner = std::clamp(light.cosInner, -1.0f, 1.0f);
+            const float cosOuter = std::clamp(std::min(light.cosOuter, cosInner), -1.0f, 1.0f);
+            bounds.bounds = BoundingBox(light.position, light.position);
+            bounds.direction = light.direction;
+            bounds.cosThetaO = cosInner;
+            bounds.cosThetaE = std::cos(std::acos(cosOuter) - std::acos(cosInner));
+            bounds.power = 2.0f * kPi * (1.0f - 0.5f * (cosInner + cosOuter)) * intensity;
+            break;
+        }
+        case PathTracerLight::Type::AREA: {
+            for (int corner = 0; corner < 4; ++corner) {
+                bounds.bounds.expand(light.position + ((corner & 1) ? light.axisX : -light.axisX)
+                                     + ((corner & 2) ? light.axisY : -light.axisY));
+            }
+            const float halfExtents = glm::length(light.axisX) * glm::length(light.axisY);
+            const float emittingArea = light.disk ? kPi * halfExtents : 4.0f * halfExtents;
+            bounds.direction = glm::normalize(glm::cross(light.axisY, light.axisX));
+            bounds.cosThetaO = 1.0f;
+            bounds.cosThetaE = 0.0f;
+            bounds.twoSided = light.twoSided;
+            bounds.power = kPi * emittingArea * intensity * (light.twoSided ? 2.0f : 1.0f);
+            break;
+        }
+    }
+    return emitter;
+}
+
+} // namespace ElementalRenderer
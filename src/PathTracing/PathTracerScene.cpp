@@ -0,0 +1,90 @@
+/**
+ * @file PathTracerScene.cpp
+ * @brief Conversion of scenes for the path tracer
+ */
+
+#include "PathTracing/PathTracer.h"
+#include "Scene.h"
+#include "Mesh.h"
+#include "Material.h"
+#include "Light.h"
+#include <cmath>
+#include <iostream>
+
+namespace ElementalRenderer {
+
+PathTracerScene PathTracerScene::fromScene(const Scene& scene) {
+    PathTracerScene result;
+    result.environment = scene.getAmbientLight();
+
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> normals;
+    for (const std::shared_ptr<Mesh>& mesh : scene.getMeshes()) {
+        if (!mesh) {
+            continue;
+        }
+        if (mesh->getPrimitiveType() != Mesh::PrimitiveType::TRIANGLES) {
+            std::cerr << "Warning: path tracer skips a mesh that is not a triangle list" << std::endl;
+            continue;
+        }
+
+        positions.clear();
+        normals.clear();
+        for (const Vertex& vertex : mesh->getVertices()) {
+            positions.push_back(vertex.position);
+            normals.push_back(vertex.normal);
+        }
+
+        PathTracerMaterial material;
+        if (const std::shared_ptr<Material> source = mesh->getMaterial()) {
+            material.brdf.albedo = source->getVec3("albedo", glm::vec3(1.0f));
+            material.brdf.metallic = source->getFloat("metallic", 0.0f);
+            material.brdf.roughness = source->getFloat("roughness", 0.5f);
+            material.brdf.ao = source->getFloat("ao", 1.0f);
+            material.emission = material.brdf.albedo * source->getFloat("emissive", 0.0f);
+        }
+        result.addMesh(positions, normals, mesh->getIndices(), material);
+    }
+
+    for (const std::shared_ptr<Light>& light : scene.getLights()) {
+        if (light) {
+            result.lights.push_back(makeLight(*light));
+        } else {
+            // Keep light indices aligned with the scene
+            PathTracerLight dark;
+            dark.radiance = glm::vec3(0.0f);
+            result.lights.push_back(dark);
+        }
+    }
+    return result;
+}
+
+PathTracerLight PathTracerScene::makeLight(const Light& light) {
+    PathTracerLight result;
+    result.radiance = light.getColor() * light.getIntensity();
+
+    if (const auto* directional = dynamic_cast<const DirectionalLight*>(&light)) {
+        result.type = PathTracerLight::Type::DIRECTIONAL;
+        result.direction = glm::normalize(directional->getDirection());
+    } else if (const auto* point = dynamic_cast<const PointLight*>(&light)) {
+        result.type = PathTracerLight::Type::POINT;
+        result.position = point->getPosition();
+    } else if (const auto* spot = dynamic_cast<const SpotLight*>(&light)) {
+        result.type = PathTracerLight::Type::SPOT;
+        result.position = spot->getPosition();
+        result.direction = glm::normalize(spot->getDirection());
+        result.cosInner = std::cos(glm::radians(spot->getInnerAngle()));
+        result.cosOuter = std::cos(glm::radians(spot->getOuterAngle()));
+    } else if (const auto* area = dynamic_cast<const AreaLight*>(&light)) {
+        result.type = PathTracerLight::Type::AREA;
+        result.position = area->getPosition();
+        result.direction = glm::normalize(area->getDirection());
+        result.axisX = area->getAxisX();
+        result.axisY = area->getAxisY();
+        result.disk = area->getShape() == AreaLightShape::DISK;
+        result.twoSided = area->isTwoSided();
+    }
+    return result;
+}
+
+} // namespace ElementalRenderer
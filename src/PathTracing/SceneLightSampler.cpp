@@ -0,0 +1,66 @@
+/**
+ * @file SceneLightSampler.cpp
+ * @brief Implementation of the scene light sampler
+ */
+
+#include "PathTracing/SceneLightSampler.h"
+#include "PathTracing/PathTracer.h"
+#include "Light.h"
+
+namespace ElementalRenderer {
+
+SceneLightSampler::SceneLightSampler(const Scene& scene)
+    : m_scene(scene)
+    , m_needsRebuild(false) {
+    m_bvh.build(gatherEmitters());
+}
+
+void SceneLightSampler::onSceneChange(const SceneChange& change) {
+    switch (change.type) {
+        case SceneChangeType::LIGHT_CHANGED:
+            m_changedLights.push_back(change.index);
+            break;
+        case SceneChangeType::LIGHT_ADDED:
+        case SceneChangeType::LIGHT_REMOVED:
+        case SceneChangeType::CLEARED:
+            m_needsRebuild = true;
+            break;
+        default:
+            break;
+    }
+}
+
+void SceneLightSampler::update() {
+    if (m_needsRebuild) {
+        m_bvh.build(gatherEmitters());
+        m_needsRebuild = false;
+        m_changedLights.clear();
+        return;
+    }
+    if (m_changedLights.empty()) {
+        return;
+    }
+    for (size_t index : m_changedLights) {
+        const std::shared_ptr<Light> light = m_scene.getLight(index);
+        if (light) {
+            m_bvh.updateEmitter(index, makeEmitter(*light));
+        }
+    }
+    m_changedLights.clear();
+    m_bvh.refit();
+}
+
+std::vector<LightEmitter> SceneLightSampler::gatherEmitters() const {
+    std::vector<LightEmitter> emitters;
+    emitters.reserve(m_scene.getLights().size());
+    for (const std::shared_ptr<Light>& light : m_scene.getLights()) {
+        emitters.push_back(light ? makeEmitter(*light) : LightEmitter());
+    }
+    return emitters;
+}
+
+LightEmitter SceneLightSampler::makeEmitter(const Light& light) {
+    return PathTracer::makeEmitter(PathTracerScene::makeLight(light));
+}
+
+} // namespace ElementalRenderer
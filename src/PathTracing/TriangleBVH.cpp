@@ -0,0 +1,432 @@
+/**
+ * @file TriangleBVH.cpp
+ * @brief Implementation of the four-wide triangle BVH
+ */
+
+#include "PathTracing/TriangleBVH.h"
+#include "Headless/SIMD.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ElementalRenderer {
+
+namespace {
+
+using SIMD::Float4;
+
+const int kBinCount = 16;
+const uint32_t kMaxLeafTriangles = 4;
+// Deeper subtrees become (larger) leaves, which bounds the traversal stack
+const int kMaxDepth = 64;
+const int kStackSize = 3 * kMaxDepth + 4;
+// Relative cost of visiting a node versus testing a triangle
+const float kTraversalCost = 1.0f;
+
+float surfaceArea(const BoundingBox& box) {
+    if (box.isEmpty()) {
+        return 0.0f;
+    }
+    const glm::vec3 extent = box.getExtent();
+    return 2.0f * (extent.x * extent.y + extent.y * extent.z + extent.z * extent.x);
+}
+
+} // namespace
+
+void TriangleBVH::clear() {
+    m_nodes.clear();
+    m_triangles.clear();
+    m_bounds = BoundingBox();
+}
+
+void TriangleBVH::build(const std::vector<glm::vec3>& positions, const std::vector<unsigned int>& indices) {
+    clear();
+    const uint32_t triangleCount = static_cast<uint32_t>(indices.size() / 3);
+    if (triangleCount == 0) {
+        return;
+    }
+
+    std::vector<BoundingBox> boxes(triangleCount);
+    std::vector<uint32_t> order(triangleCount);
+    for (uint32_t i = 0; i < triangleCount; ++i) {
+        for (int corner = 0; corner < 3; ++corner) {
+            boxes[i].expand(positions[indices[3 * i + corner]]);
+        }
+        m_bounds.expand(boxes[i]);
+        order[i] = i;
+    }
+
+    std::vector<BuildNode> buildNodes;
+    buildNodes.reserve(2 * triangleCount);
+    buildRecursive(buildNodes, order, boxes, 0, triangleCount, 0);
+
+    m_triangles.resize(triangleCount);
+    for (uint32_t i = 0; i < triangleCount; ++i) {
+        const uint32_t index = order[i];
+        const glm::vec3& v0 = positions[indices[3 * index]];
+        m_triangles[i].v0 = v0;
+        m_triangles[i].edge1 = positions[indices[3 * index + 1]] - v0;
+        m_triangles[i].edge2 = positions[indices[3 * index + 2]] - v0;
+        m_triangles[i].index = index;
+    }
+
+    m_nodes.reserve(buildNodes.size() / 2 + 1);
+    collapse(buildNodes, 0);
+}
+
+int TriangleBVH::buildRecursive(std::vector<BuildNode>& nodes, std::vector<uint32_t>& order,
+                                const std::vector<BoundingBox>& boxes, uint32_t begin, uint32_t end, int depth) {
+    const int nodeIndex = static_cast<int>(nodes.size());
+    nodes.emplace_back();
+
+    BoundingBox bounds;
+    BoundingBox centroids;
+    for (uint32_t i = begin; i < end; ++i) {
+        bounds.expand(boxes[order[i]]);
+        centroids.expand(boxes[order[i]].getCenter());
+    }
+    nodes[nodeIndex].bounds = bounds;
+
+    const uint32_t count = end - begin;
+    auto makeLeaf = [&]() {
+        nodes[nodeIndex].first = begin;
+        nodes[nodeIndex].count = count;
+        return nodeIndex;
+    };
+    if (count == 1 || depth >= kMaxDepth) {
+        return makeLeaf();
+    }
+
+    // Binned surface area heuristic along the widest centroid axis
+    const glm::vec3 centroidExtent = centroids.getExtent();
+    int axis = 0;
+    if (centroidExtent.y > centroidExtent[axis]) {
+        axis = 1;
+    }
+    if (centroidExtent.z > centroidExtent[axis]) {
+        axis = 2;
+    }
+
+    uint32_t middle = begin;
+    if (centroidExtent[axis] > 0.0f) {
+        BoundingBox binBounds[kBinCount];
+        uint32_t binCounts[kBinCount] = {};
+        const float scale = kBinCount / centroidExtent[axis];
+        auto binOf = [&](uint32_t triangle) {
+            const int bin = static_cast<int>((boxes[triangle].getCenter()[axis] - centroids.min[axis]) * scale);
+            return std::min(bin, kBinCount - 1);
+        };
+        for (uint32_t i = begin; i < end; ++i) {
+            const int bin = binOf(order[i]);
+            binBounds[bin].expand(boxes[order[i]]);
+            ++binCounts[bin];
+        }
+
+        float areaAbove[kBinCount];
+        uint32_t countAbove[kBinCount];
+        BoundingBox above;
+        uint32_t aboveCount = 0;
+        for (int bin = kBinCount - 1; bin > 0; --bin) {
+            above.expand(binBounds[bin]);
+            aboveCount += binCounts[bin];
+            areaAbove[bin] = surfaceArea(above);
+            countAbove[bin] = aboveCount;
+        }
+
+        float bestCost = std::numeric_limits<float>::max();
+        int bestSplit = -1;
+        BoundingBox below;
+        uint32_t belowCount = 0;
+        for (int split = 1; split < kBinCount; ++split) {
+            below.expand(binBounds[split - 1]);
+            belowCount += binCounts[split - 1];
+            if (belowCount == 0 || countAbove[split] == 0) {
+                continue;
+            }
+            const float cost = surfaceArea(below) * belowCount + areaAbove[split] * countAbove[split];
+            if (cost < bestCost) {
+                bestCost = cost;
+                bestSplit = split;
+            }
+        }
+
+        const float area = surfaceArea(bounds);
+        const float splitCost = kTraversalCost + (area > 0.0f ? bestCost / area : static_cast<float>(count));
+        if (count <= kMaxLeafTriangles && (bestSplit < 0 || splitCost >= static_cast<float>(count))) {
+            return makeLeaf();
+        }
+        if (bestSplit >= 0) {
+            auto split = std::partition(order.begin() + begin, order.begin() + end,
+                                        [&](uint32_t triangle) { return binOf(triangle) < bestSplit; });
+            middle = static_cast<uint32_t>(split - order.begin());
+        }
+    } else if (count <= kMaxLeafTriangles) {
+        return makeLeaf();
+    }
+    if (middle == begin || middle == end) {
+        // Coincident centroids: any balanced split is as good as another
+        middle = begin + count / 2;
+    }
+
+    const int left = buildRecursive(nodes, order, boxes, begin, middle, depth + 1);
+    const int right = buildRecursive(nodes, order, boxes, middle, end, depth + 1);
+    nodes[nodeIndex].children[0] = left;
+    nodes[nodeIndex].children[1] = right;
+    return nodeIndex;
+}
+
+int TriangleBVH::collapse(const std::vector<BuildNode>& nodes, int buildIndex) {
+    // Open the largest interior child until the node has four children
+    int slots[4] = {buildIndex, -1, -1, -1};
+    int slotCount = 1;
+    if (nodes[buildIndex].count == 0) {
+        slots[0] = nodes[buildIndex].children[0];
+        slots[1] = nodes[buildIndex].children[1];
+        slotCount = 2;
+    }
+    while (slotCount < 4) {
+        int largest = -1;
+        float largestArea = -1.0f;
+        for (int i = 0; i < slotCount; ++i) {
+            const BuildNode& child = nodes[slots[i]];
+            if (child.count == 0 && surfaceArea(child.bounds) > largestArea) {
+                largest = i;
+                largestArea = surfaceArea(child.bounds);
+            }
+        }
+        if (largest < 0) {
+            break;
+        }
+        const BuildNode& opened = nodes[slots[largest]];
+        slots[largest] = opened.children[0];
+        slots[slotCount++] = opened.children[1];
+    }
+
+    const int nodeIndex = static_cast<int>(m_nodes.size());
+    m_nodes.emplace_back();
+    for (int i = 0; i < 4; ++i) {
+        int32_t child = -1;
+        uint32_t count = 0;
+        BoundingBox box;
+        if (i < slotCount) {
+            const BuildNode& buildNode = nodes[slots[i]];
+            box = buildNode.bounds;
+            if (buildNode.count > 0) {
+                child = static_cast<int32_t>(buildNode.first);
+                count = buildNode.count;
+            } else {
+                child = collapse(nodes, slots[i]);
+            }
+        }
+        // Recursion may have reallocated the node array
+        Node& node = m_nodes[nodeIndex];
+        for (int axis = 0; axis < 3; ++axis) {
+            node.bounds[axis][i] = box.min[axis];
+            node.bounds[axis + 3][i] = box.max[axis];
+        }
+        node.children[i] = child;
+        node.counts[i] = count;
+    }
+    return nodeIndex;
+}
+
+template<bool AnyHit>
+bool TriangleBVH::traverse(const Ray& ray, RayHit* hit) const {
+    if (m_nodes.empty()) {
+        return false;
+    }
+
+    const glm::vec3 invDirection = 1.0f / ray.direction;
+    // Slab planes the ray enters through, per axis
+    const int nearX = invDirection.x < 0.0f ? 3 : 0;
+    const int nearY = invDirection.y < 0.0f ? 4 : 1;
+    const int nearZ = invDirection.z < 0.0f ? 5 : 2;
+    const int farX = 3 - nearX;
+    const int farY = 5 - nearY;
+    const int farZ = 7 - nearZ;
+    const Float4 originX = Float4::splat(ray.origin.x);
+    const Float4 originY = Float4::splat(ray.origin.y);
+    const Float4 originZ = Float4::splat(ray.origin.z);
+    const Float4 invX = Float4::splat(invDirection.x);
+    const Float4 invY = Float4::splat(invDirection.y);
+    const Float4 invZ = Float4::splat(invDirection.z);
+    const Float4 zero = Float4::splat(0.0f);
+
+    float tMax = ray.tMax;
+    bool found = false;
+    int stack[kStackSize];
+    int stackSize = 0;
+    stack[stackSize++] = 0;
+
+    while (stackSize > 0) {
+        const Node& node = m_nodes[stack[--stackSize]];
+        const Float4 tNear = SIMD::max(
+            SIMD::max((Float4::load(node.bounds[nearX]) - originX) * invX, (Float4::load(node.bounds[nearY]) - originY) * invY),
+            SIMD::max((Float4::load(node.bounds[nearZ]) - originZ) * invZ, zero));
+        const Float4 tFar = SIMD::min(
+            SIMD::min((Float4::load(node.bounds[farX]) - originX) * invX, (Float4::load(node.bounds[farY]) - originY) * invY),
+            SIMD::min((Float4::load(node.bounds[farZ]) - originZ) * invZ, Float4::splat(tMax)));
+        const int mask = SIMD::moveMask(SIMD::lessEqual(tNear, tFar));
+        if (mask == 0) {
+            continue;
+        }
+
+        float distances[4];
+        tNear.store(distances);
+        int interior[4];
+        int interiorCount = 0;
+        for (int i = 0; i < 4; ++i) {
+            if (!(mask & (1 << i))) {
+                continue;
+            }
+            if (node.counts[i] == 0) {
+                interior[interiorCount++] = i;
+                continue;
+            }
+
+            // Moller-Trumbore against each triangle of the leaf
+            const uint32_t last = static_cast<uint32_t>(node.children[i]) + node.counts[i];
+            for (uint32_t t = static_cast<uint32_t>(node.children[i]); t < last; ++t) {
+                const Triangle& triangle = m_triangles[t];
+                const glm::vec3 p = glm::cross(ray.direction, triangle.edge2);
+                const float determinant = glm::dot(triangle.edge1, p);
+                if (determinant == 0.0f) {
+                    continue;
+                }
+                const float invDeterminant = 1.0f / determinant;
+                const glm::vec3 s = ray.origin - triangle.v0;
+                const float u = glm::dot(s, p) * invDeterminant;
+                if (u < 0.0f || u > 1.0f) {
+                    continue;
+                }
+                const glm::vec3 q = glm::cross(s, triangle.edge1);
+                const float v = glm::dot(ray.direction, q) * invDeterminant;
+                if (v < 0.0f || u + v > 1.0f) {
+                    continue;
+                }
+                const float distance = glm::dot(triangle.edge2, q) * invDeterminant;
+                if (distance <= 0.0f || distance >= tMax) {
+                    continue;
+                }
+                if (AnyHit) {
+                    return true;
+                }
+                tMax = distance;
+                found = true;
+                hit->t = distance;
+                hit->u = u;
+                hit->v = v;
+                hit->triangle = triangle.index;
+            }
+        }
+
+        // Push the nearest child last so it is visited first
+        for (int i = 1; i < interiorCount; ++i) {
+            const int slot = interior[i];
+            int j = i;
+            for (; j > 0 && distances[interior[j - 1]] < distances[slot]; --j) {
+                interior[j] = interior[j - 1];
+            }
+            interior[j] = slot;
+        }
+        for (int i = 0; i < interiorCount; ++i) {
+            stack[stackSize++] = node.children[interior[i]];
+        }
+    }
+    return found;
+}
+
+bool TriangleBVH::intersect(const Ray& ray, RayHit& hit) const {
+    return traverse<false>(ray, &hit);
+}
+
+bool TriangleBVH::occluded(const Ray& ray) const {
+    return traverse<true>(ray, nullptr);
+}
+
+int TriangleBVH::occludedPacket(const Ray (&rays)[4]) const {
+    if (m_nodes.empty()) {
+        return 0;
+    }
+
+    // One ray per lane
+    const Float4 originX = Float4::set(rays[0].origin.x, rays[1].origin.x, rays[2].origin.x, rays[3].origin.x);
+    const Float4 originY = Float4::set(rays[0].origin.y, rays[1].origin.y, rays[2].origin.y, rays[3].origin.y);
+    const Float4 originZ = Float4::set(rays[0].origin.z, rays[1].origin.z, rays[2].origin.z, rays[3].origin.z);
+    const Float4 directionX = Float4::set(rays[0].direction.x, rays[1].direction.x, rays[2].direction.x, rays[3].direction.x);
+    const Float4 directionY = Float4::set(rays[0].direction.y, rays[1].direction.y, rays[2].direction.y, rays[3].direction.y);
+    const Float4 directionZ = Float4::set(rays[0].direction.z, rays[1].direction.z, rays[2].direction.z, rays[3].direction.z);
+    const Float4 one = Float4::splat(1.0f);
+    const Float4 invX = one / directionX;
+    const Float4 invY = one / directionY;
+    const Float4 invZ = one / directionZ;
+    const Float4 tMax = Float4::set(rays[0].tMax, rays[1].tMax, rays[2].tMax, rays[3].tMax);
+    const Float4 zero = Float4::splat(0.0f);
+
+    int active = 0xF;
+    int stack[kStackSize];
+    int stackSize = 0;
+    stack[stackSize++] = 0;
+
+    while (stackSize > 0) {
+        const Node& node = m_nodes[stack[--stackSize]];
+        for (int i = 0; i < 4; ++i) {
+            if (node.children[i] < 0) {
+                continue;
+            }
+
+            // Slab test of child i against every ray; the ray signs differ per
+            // lane, so both planes of each slab are ordered with min and max
+            const Float4 x0 = (Float4::splat(node.bounds[0][i]) - originX) * invX;
+            const Float4 x1 = (Float4::splat(node.bounds[3][i]) - originX) * invX;
+            const Float4 y0 = (Float4::splat(node.bounds[1][i]) - originY) * invY;
+            const Float4 y1 = (Float4::splat(node.bounds[4][i]) - originY) * invY;
+            const Float4 z0 = (Float4::splat(node.bounds[2][i]) - originZ) * invZ;
+            const Float4 z1 = (Float4::splat(node.bounds[5][i]) - originZ) * invZ;
+            const Float4 tNear = SIMD::max(SIMD::max(SIMD::min(x0, x1), SIMD::min(y0, y1)), SIMD::max(SIMD::min(z0, z1), zero));
+            const Float4 tFar = SIMD::min(SIMD::min(SIMD::max(x0, x1), SIMD::max(y0, y1)), SIMD::min(SIMD::max(z0, z1), tMax));
+            if ((SIMD::moveMask(SIMD::lessEqual(tNear, tFar)) & active) == 0) {
+                continue;
+            }
+            if (node.counts[i] == 0) {
+                stack[stackSize++] = node.children[i];
+                continue;
+            }
+
+            // Moller-Trumbore with the rays in lanes; a zero determinant gives
+            // infinite or NaN coordinates, which fail the comparisons below
+            const uint32_t last = static_cast<uint32_t>(node.children[i]) + node.counts[i];
+            for (uint32_t t = static_cast<uint32_t>(node.children[i]); t < last; ++t) {
+                const Triangle& triangle = m_triangles[t];
+                const Float4 e1x = Float4::splat(triangle.edge1.x);
+                const Float4 e1y = Float4::splat(triangle.edge1.y);
+                const Float4 e1z = Float4::splat(triangle.edge1.z);
+                const Float4 e2x = Float4::splat(triangle.edge2.x);
+                const Float4 e2y = Float4::splat(triangle.edge2.y);
+                const Float4 e2z = Float4::splat(triangle.edge2.z);
+                const Float4 px = directionY * e2z - directionZ * e2y;
+                const Float4 py = directionZ * e2x - directionX * e2z;
+                const Float4 pz = directionX * e2y - directionY * e2x;
+                const Float4 invDeterminant = one / (e1x * px + e1y * py + e1z * pz);
+                const Float4 sx = originX - Float4::splat(triangle.v0.x);
+                const Float4 sy = originY - Float4::splat(triangle.v0.y);
+                const Float4 sz = originZ - Float4::splat(triangle.v0.z);
+                const Float4 u = (sx * px + sy * py + sz * pz) * invDeterminant;
+                const Float4 qx = sy * e1z - sz * e1y;
+                const Float4 qy = sz * e1x - sx * e1z;
+                const Float4 qz = sx * e1y - sy * e1x;
+                const Float4 v = (directionX * qx + directionY * qy + directionZ * qz) * invDeterminant;
+                const Float4 distance = (e2x * qx + e2y * qy + e2z * qz) * invDeterminant;
+                const int hits = SIMD::moveMask(SIMD::lessEqual(zero, u)) & SIMD::moveMask(SIMD::lessEqual(zero, v))
+                               & SIMD::moveMask(SIMD::lessEqual(u + v, one)) & SIMD::moveMask(SIMD::lessThan(zero, distance))
+                               & SIMD::moveMask(SIMD::lessThan(distance, tMax));
+                active &= ~hits;
+                if (active == 0) {
+                    return 0xF;
+                }
+            }
+        }
+    }
+    return ~active & 0xF;
+}
+
+} // namespace ElementalRenderer
@@ -4,6 +4,7 @@
  */
 
 #include "Shaders/PostProcessShader.h"
+#include "Shaders/PostProcessFusion.h"
 #include <iostream>
 
 namespace ElementalRenderer {
@@ -35,5 +36,54 @@ void main() {
 }
 )";
 
+const char* PostProcessShader::s_upscaleFragmentShaderSource = R"(
+#version 410 core
+out vec4 FragColor;
+in vec2 TexCoords;
+
+uniform sampler2D screenTexture;
+uniform vec2 renderScale;   // Rendered size / texture size
+uniform float sharpness;
+
+// Bilinear lookup clamped to the texel centers of the rendered region
+vec4 sampleRendered(vec2 uv) {
+    vec2 halfTexel = 0.5 / vec2(textureSize(screenTexture, 0));
+    return texture(screenTexture, clamp(uv * renderScale, halfTexel, renderScale - halfTexel));
+}
+
+void main() {
+    vec2 texel = 1.0 / (vec2(textureSize(screenTexture, 0)) * renderScale);
+    vec4 center = sampleRendered(TexCoords);
+    if (sharpness <= 0.0) {
+        FragColor = center;
+        return;
+    }
+    vec3 east = sampleRendered(TexCoords + vec2(texel.x, 0.0)).rgb;
+    vec3 west = sampleRendered(TexCoords - vec2(texel.x, 0.0)).rgb;
+    vec3 north = sampleRendered(TexCoords + vec2(0.0, texel.y)).rgb;
+    vec3 south = sampleRendered(TexCoords - vec2(0.0, texel.y)).rgb;
+    vec3 lower = min(center.rgb, min(min(east, west), min(north, south)));
+    vec3 upper = max(center.rgb, max(max(east, west), max(north, south)));
+    vec3 mean = 0.25 * (east + west + north + south);
+    FragColor = vec4(clamp(center.rgb + (center.rgb - mean) * sharpness, lower, upper), center.a);
+}
+)";
+
+bool PostProcessShader::loadUpscale() {
+    return compile(s_vertexShaderSource, s_upscaleFragmentShaderSource);
+}
+
+bool PostProcessShader::loadFusedPass(const PostProcessPass& pass) {
+    const std::string fragmentSource = PostProcessFusion::generateFragmentShader(pass);
+    if (fragmentSource.empty() || !compile(s_vertexShaderSource, fragmentSource)) {
+        return false;
+    }
+
+    use();
+    for (const auto& uniform : PostProcessFusion::getUniformValues(pass)) {
+        setFloat(uniform.first, uniform.second);
+    }
+    return true;
+}
 
 } // namespace ElementalRenderer
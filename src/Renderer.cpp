@@ -1,5 +1,7 @@
 #include "../include/Renderer.h"
 #include "../include/ElementalRenderer.h"
+#include "Shaders/OutlineShader.h"
+#include "Shaders/PostProcessShader.h"
 #include <iostream>
 #include <glad/glad.h>  // OpenGL loader... should be included before other OpenGL-related headers
 #include <GLFW/glfw3.h>
@@ -12,6 +14,29 @@ int Renderer::s_viewportWidth = 800;
 int Renderer::s_viewportHeight = 600;
 float Renderer::s_clearColor[4] = {0.2f, 0.2f, 0.2f, 1.0f};
 std::unique_ptr<StyleShaderManager> Renderer::s_styleShaderManager = nullptr;
+bool Renderer::s_dynamicResolution = false;
+DynamicResolutionController Renderer::s_resolutionController;
+unsigned int Renderer::s_frameTimerQueries[2] = {0, 0};
+int Renderer::s_frameIndex = 0;
+unsigned int Renderer::s_sceneFramebuffer = 0;
+unsigned int Renderer::s_sceneColorTexture = 0;
+unsigned int Renderer::s_sceneDepthRenderbuffer = 0;
+unsigned int Renderer::s_sceneNormalDepthTexture = 0;
+glm::ivec2 Renderer::s_sceneTargetSize(0);
+unsigned int Renderer::s_quadVao = 0;
+unsigned int Renderer::s_quadVbo = 0;
+std::unique_ptr<PostProcessShader> Renderer::s_upscaleShader = nullptr;
+std::vector<PostProcessPass> Renderer::s_postProcessPasses;
+std::vector<std::unique_ptr<PostProcessShader>> Renderer::s_postProcessShaders;
+unsigned int Renderer::s_postProcessFramebuffer = 0;
+unsigned int Renderer::s_postProcessTexture = 0;
+glm::ivec2 Renderer::s_postProcessTargetSize(0);
+std::unique_ptr<OutlineShader> Renderer::s_outlineEdgeShader = nullptr;
+std::unique_ptr<OutlineShader> Renderer::s_outlineJumpFloodShader = nullptr;
+std::unique_ptr<OutlineShader> Renderer::s_outlineCompositeShader = nullptr;
+unsigned int Renderer::s_outlineSeedFramebuffers[2] = {0, 0};
+unsigned int Renderer::s_outlineSeedTextures[2] = {0, 0};
+glm::ivec2 Renderer::s_outlineSeedSize(0);
 
 // Private constructor and destructor
 Renderer::Renderer() {
@@ -30,6 +55,9 @@ bool Renderer::initialize(const RendererOptions& options) {
 
     s_viewportWidth = options.width;
     s_viewportHeight = options.height;
+    s_dynamicResolution = options.dynamicResolution;
+    s_resolutionController.setSettings(options.dynamicResolutionSettings);
+    s_frameIndex = 0;
 
     // Initialize GLFW and OpenGL here
     // ...
@@ -43,6 +71,17 @@ bool Renderer::initialize(const RendererOptions& options) {
     s_styleShaderManager->applyStyle(StyleShader::Style::DEFAULT);
 
     setupRenderState();
+    glGenQueries(2, s_frameTimerQueries);
+
+    createFullscreenQuad();
+    if (!createUpscalePass()) {
+        std::cerr << "Warning: Dynamic resolution upscale pass unavailable, rendering at the viewport size" << std::endl;
+        s_dynamicResolution = false;
+    }
+    createPostProcessShaders();
+    if (!createOutlinePass()) {
+        std::cerr << "Warning: Screen-space outline pass unavailable, ANIME style renders without outlines" << std::endl;
+    }
 
     s_initialized = true;
     return true;
@@ -54,6 +93,16 @@ void Renderer::shutdown() {
     }
 
     s_styleShaderManager.reset();
+    glDeleteQueries(2, s_frameTimerQueries);
+    destroyUpscalePass();
+    destroyPostProcessPasses();
+    destroyOutlinePass();
+    if (s_quadVao != 0) {
+        glDeleteVertexArrays(1, &s_quadVao);
+        glDeleteBuffers(1, &s_quadVbo);
+        s_quadVao = 0;
+        s_quadVbo = 0;
+    }
     // Cleanup GLFW and OpenGL here
     // ...
 
@@ -74,15 +123,42 @@ void Renderer::renderScene(const Scene& scene, const Camera& camera) {
         return;
     }
 
+    updateRenderResolution();
+    glBeginQuery(GL_TIME_ELAPSED, s_frameTimerQueries[s_frameIndex % 2]);
+
+    // Below the viewport size, with a post-processing stack or with outlines,
+    // the scene goes to the offscreen target and applyPostProcessing() draws
+    // it to the screen
+    const bool outlines = isOutlinePassActive();
+    const bool offscreen = (getRenderSize() != glm::ivec2(s_viewportWidth, s_viewportHeight)
+                            || !s_postProcessShaders.empty() || outlines) && ensureSceneTarget();
+    if (offscreen) {
+        // Outlined styles also write view-space normals and depth to the second attachment
+        const GLenum attachments[2] = {GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1};
+        glBindFramebuffer(GL_FRAMEBUFFER, s_sceneFramebuffer);
+        glDrawBuffers(outlines ? 2 : 1, attachments);
+    }
+
     glClearColor(s_clearColor[0], s_clearColor[1], s_clearColor[2], s_clearColor[3]);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    if (offscreen && outlines) {
+        // Zero depth marks background for the edge detection
+        const GLfloat background[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+        glClearBufferfv(GL_COLOR, 1, background);
+    }
 
     // Set up camera and scene for rendering
     // ...
 
+    const glm::ivec2 renderSize = getRenderSize();
+    glViewport(0, 0, renderSize.x, renderSize.y);
     renderSceneInternal();
+    glViewport(0, 0, s_viewportWidth, s_viewportHeight);
+
+    applyPostProcessing(offscreen);
 
-    applyPostProcessing();
+    glEndQuery(GL_TIME_ELAPSED);
+    ++s_frameIndex;
 }
 
 void Renderer::resize(int width, int height) {
@@ -92,6 +168,44 @@ void Renderer::resize(int width, int height) {
     glViewport(0, 0, width, height);
 }
 
+void Renderer::setDynamicResolution(bool enabled, const DynamicResolutionSettings& settings) {
+    if (enabled && s_initialized && !s_upscaleShader) {
+        std::cerr << "Warning: Dynamic resolution needs the upscale pass, which failed to load" << std::endl;
+        enabled = false;
+    }
+    s_dynamicResolution = enabled;
+    s_resolutionController.setSettings(settings);
+}
+
+bool Renderer::isDynamicResolutionEnabled() {
+    return s_dynamicResolution;
+}
+
+glm::ivec2 Renderer::getRenderSize() {
+    const glm::ivec2 viewportSize(s_viewportWidth, s_viewportHeight);
+    return s_dynamicResolution ? s_resolutionController.getRenderSize(viewportSize) : viewportSize;
+}
+
+const DynamicResolutionTelemetry& Renderer::getDynamicResolutionTelemetry() {
+    return s_resolutionController.getTelemetry();
+}
+
+void Renderer::setPostProcessStack(const std::vector<PostProcessStage>& stages) {
+    destroyPostProcessPasses();
+    for (auto& pass : PostProcessFusion::plan(stages).passes) {
+        if (pass.isCustom()) {
+            std::cerr << "Warning: Skipping custom post-processing stage " << pass.stages.front().customName << std::endl;
+            continue;
+        }
+        s_postProcessPasses.push_back(std::move(pass));
+    }
+
+    // Without a context the shaders are built by initialize()
+    if (s_initialized) {
+        createPostProcessShaders();
+    }
+}
+
 void Renderer::setClearColor(float r, float g, float b, float a) {
     s_clearColor[0] = r;
     s_clearColor[1] = g;
@@ -161,15 +275,348 @@ void Renderer::renderSceneInternal() {
     // shader->setVec3("viewPos", camera->getPosition());
 }
 
-void Renderer::applyPostProcessing() {
+void Renderer::updateRenderResolution() {
+    if (!s_dynamicResolution || s_frameIndex < 2) {
+        return;
+    }
+
+    // Read the query this frame is about to reuse, issued two frames ago; last
+    // frame's is rarely done yet. Pending results are skipped rather than waited
+    // for, and keep the current scale.
+    const unsigned int query = s_frameTimerQueries[s_frameIndex % 2];
+    GLint available = 0;
+    glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+    if (available) {
+        GLuint64 elapsed = 0;
+        glGetQueryObjectui64v(query, GL_QUERY_RESULT, &elapsed);
+        s_resolutionController.update(static_cast<float>(elapsed) * 1e-6f);
+    }
+}
+
+void Renderer::applyPostProcessing(bool offscreen) {
     if (!s_styleShaderManager) {
         return;
     }
 
+    const glm::ivec2 renderSize = getRenderSize();
+    const bool upscale = renderSize != glm::ivec2(s_viewportWidth, s_viewportHeight);
+    bool outlines = offscreen && isOutlinePassActive() && ensureOutlineTargets();
+    if (offscreen && (outlines ? 1 : 0) + (upscale ? 1 : 0) + s_postProcessShaders.size() > 1
+        && !ensurePostProcessTarget()) {
+        // The stack is dropped; without a second target only one draw is left
+        outlines = outlines && !upscale;
+    }
+    const size_t drawCount = (outlines ? 1 : 0) + (upscale ? 1 : 0) + s_postProcessShaders.size();
+    if (offscreen && drawCount == 0) {
+        // The stack was dropped after the scene was drawn; show it unprocessed
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, s_sceneFramebuffer);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+        glBlitFramebuffer(0, 0, s_viewportWidth, s_viewportHeight, 0, 0, s_viewportWidth, s_viewportHeight,
+                          GL_COLOR_BUFFER_BIT, GL_NEAREST);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    } else if (offscreen) {
+        // renderScene drew into the lower-left renderSize part of the scene target.
+        // Each draw reads the previous result and writes the other target; the
+        // last one writes the screen.
+        glDisable(GL_DEPTH_TEST);
+        glActiveTexture(GL_TEXTURE0);
+        glBindVertexArray(s_quadVao);
+
+        unsigned int sourceTexture = s_sceneColorTexture;
+        for (size_t i = 0; i < drawCount; ++i) {
+            const bool fromScene = sourceTexture == s_sceneColorTexture;
+            unsigned int target = 0;
+            if (i + 1 < drawCount) {
+                target = fromScene ? s_postProcessFramebuffer : s_sceneFramebuffer;
+            }
+            if (outlines && i == 0) {
+                drawOutlines(target, renderSize);
+                sourceTexture = s_postProcessTexture;
+                continue;
+            }
+            glBindFramebuffer(GL_FRAMEBUFFER, target);
+
+            const size_t stage = i - (outlines ? 1 : 0);
+            const bool upscaleDraw = upscale && stage == 0;
+            const PostProcessShader& shader = upscaleDraw ? *s_upscaleShader
+                                                          : *s_postProcessShaders[stage - (upscale ? 1 : 0)];
+            shader.use();
+            shader.setInt("screenTexture", 0);
+            if (upscaleDraw) {
+                shader.setVec2("renderScale", glm::vec2(renderSize) / glm::vec2(s_sceneTargetSize));
+                shader.setFloat("sharpness", s_resolutionController.getSettings().sharpness);
+            }
+            glBindTexture(GL_TEXTURE_2D, sourceTexture);
+            glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+            sourceTexture = fromScene ? s_postProcessTexture : s_sceneColorTexture;
+        }
+
+        glBindVertexArray(0);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glEnable(GL_DEPTH_TEST);
+    }
+
     auto currentStyle = s_styleShaderManager->getCurrentStyle();
     if (currentStyle == StyleShader::Style::PIXEL_ART) {
         // Apply pixel art post-processing
     }
 }
 
+void Renderer::createFullscreenQuad() {
+    // Full-screen triangle strip: position (x, y, z), texture coordinates (u, v)
+    const float quad[] = {
+        -1.0f, -1.0f, 0.0f, 0.0f, 0.0f,
+         1.0f, -1.0f, 0.0f, 1.0f, 0.0f,
+        -1.0f,  1.0f, 0.0f, 0.0f, 1.0f,
+         1.0f,  1.0f, 0.0f, 1.0f, 1.0f,
+    };
+    glGenVertexArrays(1, &s_quadVao);
+    glGenBuffers(1, &s_quadVbo);
+    glBindVertexArray(s_quadVao);
+    glBindBuffer(GL_ARRAY_BUFFER, s_quadVbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(quad), quad, GL_STATIC_DRAW);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), reinterpret_cast<void*>(0));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), reinterpret_cast<void*>(3 * sizeof(float)));
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+bool Renderer::createUpscalePass() {
+    s_upscaleShader = std::make_unique<PostProcessShader>();
+    if (!s_upscaleShader->loadUpscale()) {
+        s_upscaleShader.reset();
+        return false;
+    }
+    return true;
+}
+
+void Renderer::destroyUpscalePass() {
+    if (s_sceneFramebuffer != 0) {
+        glDeleteFramebuffers(1, &s_sceneFramebuffer);
+        glDeleteTextures(1, &s_sceneColorTexture);
+        glDeleteTextures(1, &s_sceneNormalDepthTexture);
+        glDeleteRenderbuffers(1, &s_sceneDepthRenderbuffer);
+        s_sceneFramebuffer = 0;
+        s_sceneColorTexture = 0;
+        s_sceneNormalDepthTexture = 0;
+        s_sceneDepthRenderbuffer = 0;
+        s_sceneTargetSize = glm::ivec2(0);
+    }
+    s_upscaleShader.reset();
+}
+
+bool Renderer::ensureSceneTarget() {
+    const glm::ivec2 viewportSize(s_viewportWidth, s_viewportHeight);
+    if (s_sceneFramebuffer != 0 && s_sceneTargetSize == viewportSize) {
+        return true;
+    }
+
+    // Sized to the viewport, so render size changes reuse it and only resizes reallocate
+    if (s_sceneFramebuffer == 0) {
+        glGenFramebuffers(1, &s_sceneFramebuffer);
+        glGenTextures(1, &s_sceneColorTexture);
+        glGenTextures(1, &s_sceneNormalDepthTexture);
+        glGenRenderbuffers(1, &s_sceneDepthRenderbuffer);
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, s_sceneFramebuffer);
+
+    glBindTexture(GL_TEXTURE_2D, s_sceneColorTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, viewportSize.x, viewportSize.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, s_sceneColorTexture, 0);
+
+    // Read with texelFetch by the outline pass, so no filtering
+    glBindTexture(GL_TEXTURE_2D, s_sceneNormalDepthTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA16F, viewportSize.x, viewportSize.y, 0, GL_RGBA, GL_FLOAT, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1, GL_TEXTURE_2D, s_sceneNormalDepthTexture, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glBindRenderbuffer(GL_RENDERBUFFER, s_sceneDepthRenderbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, viewportSize.x, viewportSize.y);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, s_sceneDepthRenderbuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    const bool complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if (!complete) {
+        std::cerr << "Warning: Dynamic resolution target is incomplete, rendering at the viewport size" << std::endl;
+        destroyUpscalePass();
+        s_dynamicResolution = false;
+        return false;
+    }
+    s_sceneTargetSize = viewportSize;
+    return true;
+}
+
+void Renderer::createPostProcessShaders() {
+    s_postProcessShaders.clear();
+    for (const PostProcessPass& pass : s_postProcessPasses) {
+        auto shader = std::make_unique<PostProcessShader>();
+        if (!shader->loadFusedPass(pass)) {
+            // A partial stack would change the look, so drop all of it
+            std::cerr << "Warning: Failed to load a fused post-processing pass, post-processing disabled" << std::endl;
+            s_postProcessShaders.clear();
+            return;
+        }
+        s_postProcessShaders.push_back(std::move(shader));
+    }
+}
+
+void Renderer::destroyPostProcessPasses() {
+    if (s_postProcessFramebuffer != 0) {
+        glDeleteFramebuffers(1, &s_postProcessFramebuffer);
+        glDeleteTextures(1, &s_postProcessTexture);
+        s_postProcessFramebuffer = 0;
+        s_postProcessTexture = 0;
+        s_postProcessTargetSize = glm::ivec2(0);
+    }
+    s_postProcessShaders.clear();
+}
+
+bool Renderer::ensurePostProcessTarget() {
+    const glm::ivec2 viewportSize(s_viewportWidth, s_viewportHeight);
+    if (s_postProcessFramebuffer != 0 && s_postProcessTargetSize == viewportSize) {
+        return true;
+    }
+
+    // Colour only: the passes draw full-screen quads without depth testing
+    if (s_postProcessFramebuffer == 0) {
+        glGenFramebuffers(1, &s_postProcessFramebuffer);
+        glGenTextures(1, &s_postProcessTexture);
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, s_postProcessFramebuffer);
+
+    glBindTexture(GL_TEXTURE_2D, s_postProcessTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, viewportSize.x, viewportSize.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, s_postProcessTexture, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    const bool complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if (!complete) {
+        std::cerr << "Warning: Post-processing target is incomplete, post-processing disabled" << std::endl;
+        destroyPostProcessPasses();
+        return false;
+    }
+    s_postProcessTargetSize = viewportSize;
+    return true;
+}
+
+bool Renderer::createOutlinePass() {
+    s_outlineEdgeShader = std::make_unique<OutlineShader>();
+    s_outlineJumpFloodShader = std::make_unique<OutlineShader>();
+    s_outlineCompositeShader = std::make_unique<OutlineShader>();
+    if (!s_outlineEdgeShader->loadEdgeDetectionShader() || !s_outlineJumpFloodShader->loadJumpFloodShader()
+        || !s_outlineCompositeShader->loadCompositeShader()) {
+        destroyOutlinePass();
+        return false;
+    }
+    return true;
+}
+
+void Renderer::destroyOutlinePass() {
+    if (s_outlineSeedFramebuffers[0] != 0) {
+        glDeleteFramebuffers(2, s_outlineSeedFramebuffers);
+        glDeleteTextures(2, s_outlineSeedTextures);
+        s_outlineSeedFramebuffers[0] = s_outlineSeedFramebuffers[1] = 0;
+        s_outlineSeedTextures[0] = s_outlineSeedTextures[1] = 0;
+        s_outlineSeedSize = glm::ivec2(0);
+    }
+    s_outlineEdgeShader.reset();
+    s_outlineJumpFloodShader.reset();
+    s_outlineCompositeShader.reset();
+}
+
+bool Renderer::ensureOutlineTargets() {
+    const glm::ivec2 viewportSize(s_viewportWidth, s_viewportHeight);
+    if (s_outlineSeedFramebuffers[0] != 0 && s_outlineSeedSize == viewportSize) {
+        return true;
+    }
+
+    // Seed coordinates in RG32F; the stages read them with texelFetch
+    if (s_outlineSeedFramebuffers[0] == 0) {
+        glGenFramebuffers(2, s_outlineSeedFramebuffers);
+        glGenTextures(2, s_outlineSeedTextures);
+    }
+    bool complete = true;
+    for (int i = 0; i < 2; ++i) {
+        glBindFramebuffer(GL_FRAMEBUFFER, s_outlineSeedFramebuffers[i]);
+        glBindTexture(GL_TEXTURE_2D, s_outlineSeedTextures[i]);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RG32F, viewportSize.x, viewportSize.y, 0, GL_RG, GL_FLOAT, nullptr);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, s_outlineSeedTextures[i], 0);
+        complete = complete && glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if (!complete) {
+        std::cerr << "Warning: Outline targets are incomplete, outlines disabled" << std::endl;
+        destroyOutlinePass();
+        return false;
+    }
+    s_outlineSeedSize = viewportSize;
+    return true;
+}
+
+bool Renderer::isOutlinePassActive() {
+    return s_outlineCompositeShader && s_styleShaderManager
+        && s_styleShaderManager->getCurrentStyle() == StyleShader::Style::ANIME;
+}
+
+void Renderer::drawOutlines(unsigned int target, const glm::ivec2& renderSize) {
+    float thickness = 0.0f;
+    for (const auto& parameter : s_styleShaderManager->getCurrentStyleParameters()) {
+        if (parameter.name == "outlineThickness") {
+            thickness = parameter.currentValue;
+        }
+    }
+    const EdgeSettings settings = EdgeSettings::fromOutlineThickness(thickness);
+
+    // All stages work on the lower-left renderSize part of their targets
+    glViewport(0, 0, renderSize.x, renderSize.y);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, s_outlineSeedFramebuffers[0]);
+    s_outlineEdgeShader->setEdgeSettings(settings);
+    s_outlineEdgeShader->setRenderSize(renderSize);
+    s_outlineEdgeShader->setInt("gNormalDepth", 0);
+    glBindTexture(GL_TEXTURE_2D, s_sceneNormalDepthTexture);
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+
+    int seed = 0;
+    s_outlineJumpFloodShader->setRenderSize(renderSize);
+    s_outlineJumpFloodShader->setInt("seedTexture", 0);
+    for (int step : OutlineShader::getJumpFloodSteps(settings.lineWidth)) {
+        glBindFramebuffer(GL_FRAMEBUFFER, s_outlineSeedFramebuffers[1 - seed]);
+        s_outlineJumpFloodShader->setJumpStep(step);
+        glBindTexture(GL_TEXTURE_2D, s_outlineSeedTextures[seed]);
+        glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+        seed = 1 - seed;
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, target);
+    s_outlineCompositeShader->setEdgeSettings(settings);
+    s_outlineCompositeShader->setInt("screenTexture", 0);
+    s_outlineCompositeShader->setInt("seedTexture", 1);
+    glBindTexture(GL_TEXTURE_2D, s_sceneColorTexture);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, s_outlineSeedTextures[seed]);
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glActiveTexture(GL_TEXTURE0);
+
+    glViewport(0, 0, s_viewportWidth, s_viewportHeight);
+}
+
 } // namespace ElementalRenderer
@@ -7,6 +7,7 @@
 #include "Mesh.h"
 #include "Light.h"
 #include "Material.h"
+#include "Lighting/IrradianceProbeGrid.h"
 #include <glm/glm.hpp>
 #include <iostream>
 
@@ -15,12 +16,14 @@ namespace ElementalRenderer {
 Scene::Scene()
     : m_name("Unnamed Scene")
     , m_ambientLight(0.1f, 0.1f, 0.1f)
+    , m_nextListenerHandle(0)
 {
 }
 
 Scene::Scene(const std::string& name)
     : m_name(name)
     , m_ambientLight(0.1f, 0.1f, 0.1f)
+    , m_nextListenerHandle(0)
 {
 }
 
@@ -37,6 +40,7 @@ size_t Scene::addMesh(std::shared_ptr<Mesh> mesh, const std::string& name) {
         m_meshNameMap[name] = index;
     }
     
+    notify(SceneChangeType::MESH_ADDED, index);
     return index;
 }
 
@@ -74,6 +78,7 @@ bool Scene::removeMesh(size_t index) {
     }
     
     m_meshes.erase(m_meshes.begin() + index);
+    notify(SceneChangeType::MESH_REMOVED, index);
     return true;
 }
 
@@ -93,6 +98,14 @@ const std::vector<std::shared_ptr<Mesh>>& Scene::getMeshes() const {
     return m_meshes;
 }
 
+std::vector<std::string> Scene::getMeshNames() const {
+    std::vector<std::string> names(m_meshes.size());
+    for (const auto& entry : m_meshNameMap) {
+        names[entry.second] = entry.first;
+    }
+    return names;
+}
+
 size_t Scene::addLight(std::shared_ptr<Light> light, const std::string& name) {
     if (!light) {
         std::cerr << "Warning: Attempted to add null light to scene" << std::endl;
@@ -101,11 +114,13 @@ size_t Scene::addLight(std::shared_ptr<Light> light, const std::string& name) {
     
     size_t index = m_lights.size();
     m_lights.push_back(light);
+    m_lightHandles.push_back(m_lightRegistry.add(LightDesc::fromLight(*light)));
     
     if (!name.empty()) {
         m_lightNameMap[name] = index;
     }
     
+    notify(SceneChangeType::LIGHT_ADDED, index);
     return index;
 }
 
@@ -143,6 +158,9 @@ bool Scene::removeLight(size_t index) {
     }
     
     m_lights.erase(m_lights.begin() + index);
+    m_lightRegistry.remove(m_lightHandles[index]);
+    m_lightHandles.erase(m_lightHandles.begin() + index);
+    notify(SceneChangeType::LIGHT_REMOVED, index);
     return true;
 }
 
@@ -162,6 +180,26 @@ const std::vector<std::shared_ptr<Light>>& Scene::getLights() const {
     return m_lights;
 }
 
+std::vector<std::string> Scene::getLightNames() const {
+    std::vector<std::string> names(m_lights.size());
+    for (const auto& entry : m_lightNameMap) {
+        names[entry.second] = entry.first;
+    }
+    return names;
+}
+
+const LightRegistry& Scene::getLightRegistry() const {
+    return m_lightRegistry;
+}
+
+LightHandle Scene::getLightHandle(size_t index) const {
+    if (index >= m_lightHandles.size()) {
+        return LightHandle();
+    }
+
+    return m_lightHandles[index];
+}
+
 void Scene::setAmbientLight(const glm::vec3& color) {
     m_ambientLight = color;
 }
@@ -170,6 +208,22 @@ glm::vec3 Scene::getAmbientLight() const {
     return m_ambientLight;
 }
 
+glm::vec3 Scene::getAmbientLight(const glm::vec3& position, const glm::vec3& normal) const {
+    if (m_irradianceProbes && m_irradianceProbes->isBaked()) {
+        return m_irradianceProbes->sampleIrradiance(position, normal);
+    }
+
+    return m_ambientLight;
+}
+
+void Scene::setIrradianceProbes(std::shared_ptr<const IrradianceProbeGrid> probes) {
+    m_irradianceProbes = std::move(probes);
+}
+
+std::shared_ptr<const IrradianceProbeGrid> Scene::getIrradianceProbes() const {
+    return m_irradianceProbes;
+}
+
 void Scene::setName(const std::string& name) {
     m_name = name;
 }
@@ -181,8 +235,41 @@ std::string Scene::getName() const {
 void Scene::clear() {
     m_meshes.clear();
     m_lights.clear();
+    m_lightHandles.clear();
+    m_lightRegistry.clear();
     m_meshNameMap.clear();
     m_lightNameMap.clear();
+    notify(SceneChangeType::CLEARED, 0);
+}
+
+size_t Scene::addListener(SceneListener listener) {
+    size_t handle = m_nextListenerHandle++;
+    m_listeners[handle] = std::move(listener);
+    return handle;
+}
+
+void Scene::removeListener(size_t handle) {
+    m_listeners.erase(handle);
+}
+
+void Scene::notifyMeshChanged(size_t index) {
+    if (index < m_meshes.size()) {
+        notify(SceneChangeType::MESH_CHANGED, index);
+    }
+}
+
+void Scene::notifyLightChanged(size_t index) {
+    if (index < m_lights.size()) {
+        m_lightRegistry.update(m_lightHandles[index], LightDesc::fromLight(*m_lights[index]));
+        notify(SceneChangeType::LIGHT_CHANGED, index);
+    }
+}
+
+void Scene::notify(SceneChangeType type, size_t index) {
+    SceneChange change{type, index};
+    for (const auto& entry : m_listeners) {
+        entry.second(change);
+    }
 }
 
 std::shared_ptr<Scene> Scene::createTestScene(const std::string& name) {
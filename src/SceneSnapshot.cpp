@@ -0,0 +1,435 @@
+/**
+ * @file SceneSnapshot.cpp
+ * @brief Implementation of the binary scene container
+ */
+
+#include "SceneSnapshot.h"
+#include "Light.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define ELEMENTAL_RENDERER_SNAPSHOT_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ElementalRenderer {
+
+namespace {
+
+const char kFileMagic[8] = {'E', 'R', 'S', 'N', 'A', 'P', '\0', '\0'};
+const uint32_t kFileVersion = 1;
+const size_t kSectionAlignment = 16;
+const size_t kSectionCount = static_cast<size_t>(SnapshotSectionType::COUNT);
+
+const char* kSectionNames[kSectionCount] = { "strings", "transforms", "meshes", "materials", "lights", "editor" };
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t sectionCount;
+    uint64_t fileSize;
+};
+
+struct SectionEntry {
+    uint32_t type;
+    uint32_t count;         // Records; bytes for the string section
+    uint64_t offset;
+    uint64_t size;
+};
+
+static_assert(sizeof(FileHeader) == 24, "FileHeader is part of the file format");
+static_assert(sizeof(SectionEntry) == 24, "SectionEntry is part of the file format");
+
+size_t alignUp(size_t value) {
+    return (value + kSectionAlignment - 1) / kSectionAlignment * kSectionAlignment;
+}
+
+size_t sectionIndex(SnapshotSectionType type) {
+    return static_cast<size_t>(type);
+}
+
+template<typename T>
+uint32_t append(std::vector<T>& records, const T& record) {
+    records.push_back(record);
+    return static_cast<uint32_t>(records.size() - 1);
+}
+
+bool validIndex(uint32_t index, uint32_t count) {
+    return index == kSnapshotNone || index < count;
+}
+
+} // namespace
+
+SceneSnapshotWriter::SceneSnapshotWriter() {
+}
+
+uint32_t SceneSnapshotWriter::addString(const std::string& value) {
+    if (value.empty()) {
+        return kSnapshotNone;
+    }
+    auto it = m_stringOffsets.find(value);
+    if (it != m_stringOffsets.end()) {
+        return it->second;
+    }
+    const uint32_t offset = static_cast<uint32_t>(m_strings.size());
+    m_strings.insert(m_strings.end(), value.begin(), value.end());
+    m_strings.push_back('\0');
+    m_stringOffsets.emplace(value, offset);
+    return offset;
+}
+
+uint32_t SceneSnapshotWriter::addTransform(const SnapshotTransform& transform) {
+    return append(m_transforms, transform);
+}
+
+uint32_t SceneSnapshotWriter::addMesh(const SnapshotMesh& mesh) {
+    return append(m_meshes, mesh);
+}
+
+uint32_t SceneSnapshotWriter::addMaterial(const SnapshotMaterial& material) {
+    return append(m_materials, material);
+}
+
+uint32_t SceneSnapshotWriter::addLight(const SnapshotLight& light) {
+    return append(m_lights, light);
+}
+
+void SceneSnapshotWriter::setEditorState(const SnapshotEditorState& state) {
+    m_editorState = state;
+}
+
+void SceneSnapshotWriter::writeToBuffer(std::vector<uint8_t>& buffer) const {
+    struct Source {
+        const void* data;
+        size_t size;
+        uint32_t count;
+    };
+    const Source sources[kSectionCount] = {
+        { m_strings.data(), m_strings.size(), static_cast<uint32_t>(m_strings.size()) },
+        { m_transforms.data(), m_transforms.size() * sizeof(SnapshotTransform), static_cast<uint32_t>(m_transforms.size()) },
+        { m_meshes.data(), m_meshes.size() * sizeof(SnapshotMesh), static_cast<uint32_t>(m_meshes.size()) },
+        { m_materials.data(), m_materials.size() * sizeof(SnapshotMaterial), static_cast<uint32_t>(m_materials.size()) },
+        { m_lights.data(), m_lights.size() * sizeof(SnapshotLight), static_cast<uint32_t>(m_lights.size()) },
+        { &m_editorState, sizeof(SnapshotEditorState), 1 }
+    };
+
+    SectionEntry entries[kSectionCount];
+    size_t offset = alignUp(sizeof(FileHeader) + sizeof(entries));
+    for (size_t i = 0; i < kSectionCount; ++i) {
+        entries[i].type = static_cast<uint32_t>(i);
+        entries[i].count = sources[i].count;
+        entries[i].offset = offset;
+        entries[i].size = sources[i].size;
+        offset = alignUp(offset + sources[i].size);
+    }
+
+    FileHeader header;
+    std::memcpy(header.magic, kFileMagic, sizeof(kFileMagic));
+    header.version = kFileVersion;
+    header.sectionCount = static_cast<uint32_t>(kSectionCount);
+    header.fileSize = offset;
+
+    buffer.assign(offset, 0);
+    std::memcpy(buffer.data(), &header, sizeof(header));
+    std::memcpy(buffer.data() + sizeof(header), entries, sizeof(entries));
+    for (size_t i = 0; i < kSectionCount; ++i) {
+        if (sources[i].size > 0) {
+            std::memcpy(buffer.data() + entries[i].offset, sources[i].data, sources[i].size);
+        }
+    }
+}
+
+bool SceneSnapshotWriter::saveToFile(const std::string& filePath) const {
+    std::vector<uint8_t> buffer;
+    writeToBuffer(buffer);
+
+    const std::string temporaryPath = filePath + ".tmp";
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        if (!file) {
+            file.close();
+            std::remove(temporaryPath.c_str());
+            return false;
+        }
+    }
+    // rename() does not replace an existing file everywhere
+    if (std::rename(temporaryPath.c_str(), filePath.c_str()) != 0) {
+        std::remove(filePath.c_str());
+        if (std::rename(temporaryPath.c_str(), filePath.c_str()) != 0) {
+            std::remove(temporaryPath.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+void SceneSnapshotWriter::clear() {
+    m_strings.clear();
+    m_stringOffsets.clear();
+    m_transforms.clear();
+    m_meshes.clear();
+    m_materials.clear();
+    m_lights.clear();
+    m_editorState = SnapshotEditorState();
+}
+
+SceneSnapshot::SceneSnapshot()
+    : m_data(nullptr)
+    , m_size(0)
+    , m_mapping(nullptr) {
+    for (auto& state : m_states) {
+        state.store(static_cast<uint8_t>(SectionState::UNCHECKED));
+    }
+}
+
+SceneSnapshot::~SceneSnapshot() {
+    close();
+}
+
+bool SceneSnapshot::open(const std::string& filePath) {
+    close();
+#ifdef ELEMENTAL_RENDERER_SNAPSHOT_MMAP
+    const int descriptor = ::open(filePath.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        return false;
+    }
+    struct stat status;
+    if (fstat(descriptor, &status) != 0 || status.st_size <= 0) {
+        ::close(descriptor);
+        return false;
+    }
+    const size_t size = static_cast<size_t>(status.st_size);
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    ::close(descriptor);
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+    m_mapping = mapping;
+    m_size = size;
+    if (!openMapped(static_cast<const uint8_t*>(mapping), size)) {
+        close();
+        return false;
+    }
+    return true;
+#else
+    std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return false;
+    }
+    const std::streamoff size = file.tellg();
+    if (size <= 0) {
+        return false;
+    }
+    std::vector<uint8_t> buffer(static_cast<size_t>(size));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+    return file && openBuffer(std::move(buffer));
+#endif
+}
+
+bool SceneSnapshot::openBuffer(std::vector<uint8_t> buffer) {
+    close();
+    m_buffer = std::move(buffer);
+    if (!openMapped(m_buffer.data(), m_buffer.size())) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void SceneSnapshot::close() {
+#ifdef ELEMENTAL_RENDERER_SNAPSHOT_MMAP
+    if (m_mapping) {
+        munmap(m_mapping, m_size);
+    }
+#endif
+    m_mapping = nullptr;
+    m_buffer.clear();
+    m_data = nullptr;
+    m_size = 0;
+    m_sections.fill(Section());
+    for (auto& state : m_states) {
+        state.store(static_cast<uint8_t>(SectionState::UNCHECKED));
+    }
+}
+
+bool SceneSnapshot::openMapped(const uint8_t* data, size_t size) {
+    FileHeader header;
+    if (size < sizeof(header) || reinterpret_cast<uintptr_t>(data) % alignof(SnapshotLight) != 0) {
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, kFileMagic, sizeof(kFileMagic)) != 0 || header.version != kFileVersion
+        || header.fileSize != size || header.sectionCount > (size - sizeof(header)) / sizeof(SectionEntry)) {
+        std::cerr << "Warning: Not a valid scene snapshot" << std::endl;
+        return false;
+    }
+
+    // Only the table is checked here; the section contents wait for their first access
+    std::array<bool, kSectionCount> seen{};
+    for (uint32_t i = 0; i < header.sectionCount; ++i) {
+        SectionEntry entry;
+        std::memcpy(&entry, data + sizeof(header) + i * sizeof(SectionEntry), sizeof(entry));
+        if (entry.offset % kSectionAlignment != 0 || entry.offset > size || entry.size > size - entry.offset) {
+            std::cerr << "Warning: Scene snapshot section " << i << " lies outside the file" << std::endl;
+            return false;
+        }
+        if (entry.type >= kSectionCount) {
+            continue;   // Written by a newer version
+        }
+        if (seen[entry.type]) {
+            std::cerr << "Warning: Scene snapshot repeats the " << kSectionNames[entry.type] << " section" << std::endl;
+            return false;
+        }
+        seen[entry.type] = true;
+        m_sections[entry.type].data = data + entry.offset;
+        m_sections[entry.type].size = static_cast<size_t>(entry.size);
+        m_sections[entry.type].count = entry.count;
+    }
+    m_data = data;
+    m_size = size;
+    return true;
+}
+
+bool SceneSnapshot::checkSection(SnapshotSectionType type) const {
+    std::atomic<uint8_t>& state = m_states[sectionIndex(type)];
+    const uint8_t current = state.load(std::memory_order_acquire);
+    if (current != static_cast<uint8_t>(SectionState::UNCHECKED)) {
+        return current == static_cast<uint8_t>(SectionState::VALID);
+    }
+
+    // Validation has no side effects, so concurrent first accesses may both run it
+    const bool valid = validate(type);
+    uint8_t expected = static_cast<uint8_t>(SectionState::UNCHECKED);
+    const uint8_t result = static_cast<uint8_t>(valid ? SectionState::VALID : SectionState::INVALID);
+    if (state.compare_exchange_strong(expected, result, std::memory_order_acq_rel) && !valid) {
+        std::cerr << "Warning: Scene snapshot " << kSectionNames[sectionIndex(type)]
+                  << " section is corrupt and was ignored" << std::endl;
+    }
+    return valid;
+}
+
+bool SceneSnapshot::validate(SnapshotSectionType type) const {
+    const Section& section = m_sections[sectionIndex(type)];
+    const Section& strings = m_sections[sectionIndex(SnapshotSectionType::STRINGS)];
+    auto validString = [this, &strings](uint32_t offset) {
+        return offset == kSnapshotNone || (checkSection(SnapshotSectionType::STRINGS) && offset < strings.size);
+    };
+    auto validSize = [&section](size_t recordSize) {
+        return static_cast<uint64_t>(section.count) * recordSize == section.size;
+    };
+
+    switch (type) {
+    case SnapshotSectionType::STRINGS:
+        return section.count == section.size && (section.size == 0 || section.data[section.size - 1] == '\0');
+
+    case SnapshotSectionType::TRANSFORMS:
+        return validSize(sizeof(SnapshotTransform));
+
+    case SnapshotSectionType::MESHES: {
+        if (!validSize(sizeof(SnapshotMesh))) {
+            return false;
+        }
+        const uint32_t transformCount = m_sections[sectionIndex(SnapshotSectionType::TRANSFORMS)].count;
+        const uint32_t materialCount = m_sections[sectionIndex(SnapshotSectionType::MATERIALS)].count;
+        const auto* meshes = reinterpret_cast<const SnapshotMesh*>(section.data);
+        for (uint32_t i = 0; i < section.count; ++i) {
+            if (!validString(meshes[i].name) || !validString(meshes[i].source)
+                || !validIndex(meshes[i].transform, transformCount) || !validIndex(meshes[i].material, materialCount)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    case SnapshotSectionType::MATERIALS: {
+        if (!validSize(sizeof(SnapshotMaterial))) {
+            return false;
+        }
+        const auto* materials = reinterpret_cast<const SnapshotMaterial*>(section.data);
+        for (uint32_t i = 0; i < section.count; ++i) {
+            if (!validString(materials[i].name)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    case SnapshotSectionType::LIGHTS: {
+        if (!validSize(sizeof(SnapshotLight))) {
+            return false;
+        }
+        const auto* lights = reinterpret_cast<const SnapshotLight*>(section.data);
+        for (uint32_t i = 0; i < section.count; ++i) {
+            if (!validString(lights[i].name) || lights[i].type > static_cast<uint32_t>(LightType::AREA)
+                || lights[i].shape > static_cast<uint32_t>(AreaLightShape::DISK)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    case SnapshotSectionType::EDITOR:
+        return section.count <= 1 && validSize(sizeof(SnapshotEditorState))
+            && (section.count == 0 || validString(reinterpret_cast<const SnapshotEditorState*>(section.data)->sceneName));
+
+    default:
+        return false;
+    }
+}
+
+template<typename T>
+SnapshotView<T> SceneSnapshot::view(SnapshotSectionType type) const {
+    SnapshotView<T> result;
+    if (isOpen() && checkSection(type)) {
+        const Section& section = m_sections[sectionIndex(type)];
+        result.data = reinterpret_cast<const T*>(section.data);
+        result.count = section.count;
+    }
+    return result;
+}
+
+SnapshotView<SnapshotTransform> SceneSnapshot::getTransforms() const {
+    return view<SnapshotTransform>(SnapshotSectionType::TRANSFORMS);
+}
+
+SnapshotView<SnapshotMesh> SceneSnapshot::getMeshes() const {
+    return view<SnapshotMesh>(SnapshotSectionType::MESHES);
+}
+
+SnapshotView<SnapshotMaterial> SceneSnapshot::getMaterials() const {
+    return view<SnapshotMaterial>(SnapshotSectionType::MATERIALS);
+}
+
+SnapshotView<SnapshotLight> SceneSnapshot::getLights() const {
+    return view<SnapshotLight>(SnapshotSectionType::LIGHTS);
+}
+
+bool SceneSnapshot::getEditorState(SnapshotEditorState& state) const {
+    const SnapshotView<SnapshotEditorState> editor = view<SnapshotEditorState>(SnapshotSectionType::EDITOR);
+    if (editor.empty()) {
+        return false;
+    }
+    state = editor[0];
+    return true;
+}
+
+const char* SceneSnapshot::getString(uint32_t offset) const {
+    if (offset == kSnapshotNone || !isOpen() || !checkSection(SnapshotSectionType::STRINGS)) {
+        return "";
+    }
+    const Section& strings = m_sections[sectionIndex(SnapshotSectionType::STRINGS)];
+    return offset < strings.size ? reinterpret_cast<const char*>(strings.data + offset) : "";
+}
+
+} // namespace ElementalRenderer
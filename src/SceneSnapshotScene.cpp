@@ -0,0 +1,169 @@
+/**
+ * @file SceneSnapshotScene.cpp
+ * @brief Conversion between scenes and snapshots
+ */
+
+#include "SceneSnapshot.h"
+#include "Scene.h"
+#include "Mesh.h"
+#include "Material.h"
+#include "Light.h"
+#include "Lighting/LightRegistry.h"
+#include <iostream>
+
+namespace ElementalRenderer {
+
+namespace {
+
+SnapshotMaterial describeMaterial(const Material& material) {
+    // Same properties and defaults as PathTracerScene::fromScene
+    SnapshotMaterial result;
+    result.albedo = material.getVec3("albedo", glm::vec3(1.0f));
+    result.metallic = material.getFloat("metallic", 0.0f);
+    result.roughness = material.getFloat("roughness", 0.5f);
+    result.ao = material.getFloat("ao", 1.0f);
+    result.emissive = material.getFloat("emissive", 0.0f);
+    return result;
+}
+
+SnapshotLight describeLight(const Light& light) {
+    const LightDesc desc = LightDesc::fromLight(light);
+    SnapshotLight result;
+    result.type = static_cast<uint32_t>(desc.type);
+    result.shape = static_cast<uint32_t>(desc.shape);
+    result.flags = (desc.castShadows ? SnapshotLight::kCastShadows : 0u) | (desc.twoSided ? SnapshotLight::kTwoSided : 0u);
+    result.position = desc.position;
+    result.range = desc.range;
+    result.direction = desc.direction;
+    result.innerAngle = desc.innerAngle;
+    result.color = desc.color;
+    result.intensity = desc.intensity;
+    result.size = glm::vec2(2.0f * glm::length(desc.axisX), 2.0f * glm::length(desc.axisY));
+    result.outerAngle = desc.outerAngle;
+    return result;
+}
+
+std::shared_ptr<Light> createLight(const SnapshotLight& record) {
+    std::shared_ptr<Light> light;
+    switch (static_cast<LightType>(record.type)) {
+    case LightType::DIRECTIONAL:
+        light = Light::createDirectionalLight(record.direction, record.color, record.intensity);
+        break;
+    case LightType::POINT:
+        light = Light::createPointLight(record.position, record.color, record.intensity, record.range);
+        break;
+    case LightType::SPOT:
+        light = Light::createSpotLight(record.position, record.direction, record.color, record.intensity,
+                                       record.range, record.innerAngle, record.outerAngle);
+        break;
+    case LightType::AREA:
+        light = Light::createAreaLight(static_cast<AreaLightShape>(record.shape), record.position, record.direction,
+                                       record.size, record.color, record.intensity);
+        if (auto area = std::dynamic_pointer_cast<AreaLight>(light)) {
+            area->setTwoSided((record.flags & SnapshotLight::kTwoSided) != 0);
+        }
+        break;
+    }
+    if (light) {
+        light->setCastShadows((record.flags & SnapshotLight::kCastShadows) != 0);
+    }
+    return light;
+}
+
+} // namespace
+
+void SceneSnapshotWriter::captureScene(const Scene& scene) {
+    const std::vector<std::string> meshNames = scene.getMeshNames();
+    std::unordered_map<const Material*, uint32_t> materialIndices;
+    const std::vector<std::shared_ptr<Mesh>>& meshes = scene.getMeshes();
+    m_meshes.reserve(m_meshes.size() + meshes.size());
+    m_transforms.reserve(m_transforms.size() + meshes.size());
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        if (!meshes[i]) {
+            continue;
+        }
+        SnapshotMesh record;
+        record.name = addString(meshNames[i]);
+        record.transform = addTransform(SnapshotTransform());
+        record.vertexCount = static_cast<uint32_t>(meshes[i]->getVertices().size());
+        record.indexCount = static_cast<uint32_t>(meshes[i]->getIndices().size());
+        if (const std::shared_ptr<Material> material = meshes[i]->getMaterial()) {
+            auto it = materialIndices.find(material.get());
+            if (it == materialIndices.end()) {
+                it = materialIndices.emplace(material.get(), addMaterial(describeMaterial(*material))).first;
+            }
+            record.material = it->second;
+        }
+        addMesh(record);
+    }
+
+    const std::vector<std::string> lightNames = scene.getLightNames();
+    const std::vector<std::shared_ptr<Light>>& lights = scene.getLights();
+    for (size_t i = 0; i < lights.size(); ++i) {
+        if (!lights[i]) {
+            continue;
+        }
+        SnapshotLight record = describeLight(*lights[i]);
+        record.name = addString(lightNames[i]);
+        addLight(record);
+    }
+
+    m_editorState.sceneName = addString(scene.getName());
+    m_editorState.ambientLight = scene.getAmbientLight();
+}
+
+bool SceneSnapshot::restoreScene(Scene& scene, const SnapshotMeshResolver& resolver) const {
+    if (!isOpen()) {
+        return false;
+    }
+    scene.clear();
+    SnapshotEditorState editor;
+    if (getEditorState(editor)) {
+        scene.setName(getString(editor.sceneName));
+        scene.setAmbientLight(editor.ambientLight);
+    }
+
+    // Built on first use and shared by every mesh that references the same record
+    const SnapshotView<SnapshotMaterial> materialRecords = getMaterials();
+    std::vector<std::shared_ptr<Material>> materials(materialRecords.size());
+
+    size_t unresolved = 0;
+    for (const SnapshotMesh& record : getMeshes()) {
+        const std::string name = getString(record.name);
+        std::shared_ptr<Mesh> mesh = resolver ? resolver(name, getString(record.source)) : nullptr;
+        if (!mesh) {
+            ++unresolved;
+            continue;
+        }
+        if (mesh->getVertices().size() != record.vertexCount || mesh->getIndices().size() != record.indexCount) {
+            std::cerr << "Warning: Mesh '" << name << "' has " << mesh->getVertices().size() << " vertices and "
+                      << mesh->getIndices().size() << " indices, the snapshot recorded " << record.vertexCount
+                      << " and " << record.indexCount << "; it was left out" << std::endl;
+            continue;
+        }
+        // The resolver's material carries textures and shaders the snapshot does not record
+        if (!mesh->getMaterial() && record.material < materials.size()) {
+            std::shared_ptr<Material>& material = materials[record.material];
+            if (!material) {
+                const SnapshotMaterial& parameters = materialRecords[record.material];
+                material = Material::createPBRMaterial(parameters.albedo, parameters.metallic, parameters.roughness);
+                material->setFloat("ao", parameters.ao);
+                material->setFloat("emissive", parameters.emissive);
+            }
+            mesh->setMaterial(material);
+        }
+        scene.addMesh(mesh, name);
+    }
+    if (unresolved > 0) {
+        std::cerr << "Warning: " << unresolved << " mesh references in the snapshot could not be resolved" << std::endl;
+    }
+
+    for (const SnapshotLight& record : getLights()) {
+        if (std::shared_ptr<Light> light = createLight(record)) {
+            scene.addLight(light, getString(record.name));
+        }
+    }
+    return true;
+}
+
+} // namespace ElementalRenderer
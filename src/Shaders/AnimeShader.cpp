@@ -24,13 +24,8 @@ bool AnimeShader::initialize() {
         createShaders();
 
         shader->use();
-        shader->setFloat("outlineThickness", floatParameters["outlineThickness"]);
         shader->setInt("colorBands", intParameters["colorBands"]);
         shader->setFloat("specularIntensity", floatParameters["specularIntensity"]);
-        shader->setVec3("outlineColor", 
-                        floatParameters["outlineColorR"],
-                        floatParameters["outlineColorG"],
-                        floatParameters["outlineColorB"]);
         
         return true;
     } catch (const std::exception& e) {
@@ -48,14 +43,10 @@ void AnimeShader::apply() {
 }
 
 void AnimeShader::setOutlineColor(float r, float g, float b) {
+    // Outlines are drawn by the screen-space pass, which reads getEdgeSettings()
     floatParameters["outlineColorR"] = r;
     floatParameters["outlineColorG"] = g;
     floatParameters["outlineColorB"] = b;
-    
-    if (shader) {
-        shader->use();
-        shader->setVec3("outlineColor", r, g, b);
-    }
 }
 
 void AnimeShader::setOutlineThickness(float thickness) {
@@ -66,6 +57,15 @@ void AnimeShader::setColorBands(int bands) {
     setIntParameter("colorBands", bands);
 }
 
+ElementalRenderer::EdgeSettings AnimeShader::getEdgeSettings() const {
+    ElementalRenderer::EdgeSettings settings =
+        ElementalRenderer::EdgeSettings::fromOutlineThickness(getFloatParameter("outlineThickness"));
+    settings.outlineColor = glm::vec3(getFloatParameter("outlineColorR"),
+                                      getFloatParameter("outlineColorG"),
+                                      getFloatParameter("outlineColorB"));
+    return settings;
+}
+
 void AnimeShader::setSpecularIntensity(float intensity) {
     setFloatParameter("specularIntensity", intensity);
 }
@@ -86,25 +86,20 @@ void AnimeShader::createShaders() {
         out vec3 FragPos;
         out vec3 Normal;
         out vec2 TexCoord;
-        out vec3 ViewPos;
+        out vec3 ViewNormal;
+        out float ViewDepth;
         
         uniform mat4 model;
         uniform mat4 view;
         uniform mat4 projection;
-        uniform float outlineThickness;
-        uniform bool isOutlinePass;
         
         void main() {
             FragPos = vec3(model * vec4(aPos, 1.0));
             Normal = mat3(transpose(inverse(model))) * aNormal;
             TexCoord = aTexCoord;
-            
-            if (isOutlinePass) {
-                vec3 extrudedPos = aPos + aNormal * outlineThickness;
-                gl_Position = projection * view * model * vec4(extrudedPos, 1.0);
-            } else {
-                gl_Position = projection * view * model * vec4(aPos, 1.0);
-            }
+            ViewNormal = mat3(view) * Normal;
+            ViewDepth = -(view * vec4(FragPos, 1.0)).z;
+            gl_Position = projection * view * vec4(FragPos, 1.0);
         }
     )";
     
@@ -113,8 +108,11 @@ void AnimeShader::createShaders() {
         in vec3 FragPos;
         in vec3 Normal;
         in vec2 TexCoord;
+        in vec3 ViewNormal;
+        in float ViewDepth;
         
-        out vec4 FragColor;
+        layout (location = 0) out vec4 FragColor;
+        layout (location = 1) out vec4 NormalDepth;   // Input of the screen-space outline pass
         
         uniform sampler2D diffuseTexture;
         uniform vec3 lightPos;
@@ -122,37 +120,30 @@ void AnimeShader::createShaders() {
         uniform vec3 lightColor;
         uniform vec3 objectColor;
         
-        uniform bool isOutlinePass;
-        uniform vec3 outlineColor;
-        
         uniform int colorBands;
         uniform float specularIntensity;
         
         void main() {
-            if (isOutlinePass) {
-                FragColor = vec4(outlineColor, 1.0);
-            } else {
-
-                vec3 norm = normalize(Normal);
-                vec3 lightDir = normalize(lightPos - FragPos);
+            vec3 norm = normalize(Normal);
+            vec3 lightDir = normalize(lightPos - FragPos);
 
-                float diff = max(dot(norm, lightDir), 0.0);
-                diff = floor(diff * float(colorBands)) / float(colorBands);
-                
-                vec3 diffuse = diff * lightColor;
+            float diff = max(dot(norm, lightDir), 0.0);
+            diff = floor(diff * float(colorBands)) / float(colorBands);
+            
+            vec3 diffuse = diff * lightColor;
 
-                vec3 viewDir = normalize(viewPos - FragPos);
-                vec3 reflectDir = reflect(-lightDir, norm);
-                float spec = pow(max(dot(viewDir, reflectDir), 0.0), 32.0) * specularIntensity;
-                spec = step(0.5, spec);
-                
-                vec3 specular = spec * lightColor;
-                float ambientStrength = 0.3;
-                vec3 ambient = ambientStrength * lightColor;
-                vec3 result = (ambient + diffuse) * objectColor + specular;
-                vec4 texColor = texture(diffuseTexture, TexCoord);
-                FragColor = vec4(result, 1.0) * texColor;
-            }
+            vec3 viewDir = normalize(viewPos - FragPos);
+            vec3 reflectDir = reflect(-lightDir, norm);
+            float spec = pow(max(dot(viewDir, reflectDir), 0.0), 32.0) * specularIntensity;
+            spec = step(0.5, spec);
+            
+            vec3 specular = spec * lightColor;
+            float ambientStrength = 0.3;
+            vec3 ambient = ambientStrength * lightColor;
+            vec3 result = (ambient + diffuse) * objectColor + specular;
+            vec4 texColor = texture(diffuseTexture, TexCoord);
+            FragColor = vec4(result, 1.0) * texColor;
+            NormalDepth = vec4(normalize(ViewNormal), ViewDepth);
         }
     )";
 
@@ -1,4 +1,6 @@
 #include "../../include/Shaders/CookTorranceModel.h"
+#include <glad/glad.h>
+#include <algorithm>
 
 CookTorranceModel::CookTorranceModel() : LightingModel("Cook-Torrance") {
     // Initialize default parameters
@@ -8,6 +10,13 @@ CookTorranceModel::CookTorranceModel() : LightingModel("Cook-Torrance") {
     parameters["distribution"] = static_cast<float>(DEFAULT_DISTRIBUTION);
 }
 
+CookTorranceModel::~CookTorranceModel() {
+    if (ltcMatrixTexture != 0) {
+        glDeleteTextures(1, &ltcMatrixTexture);
+        glDeleteTextures(1, &ltcMagnitudeTexture);
+    }
+}
+
 std::string CookTorranceModel::getDescription() const {
     return "Cook-Torrance microfacet specular reflection model is physically based "
            "and suitable for rendering metals, plastics, and other complex materials with "
@@ -22,6 +31,45 @@ void CookTorranceModel::applyToShader(std::shared_ptr<Shader> shader) {
     
     // Set other shader-specific configurations
     shader->setInt("lightingModel", 3); // ID for Cook-Torrance model
+    
+    // Area lights need the LTC tables; the built-in ones are uploaded on first use,
+    // since this is the first call made with a current GL context
+    if (!hasAreaLightTables()) {
+        setAreaLightTables(ElementalRenderer::LTC::getBuiltinTable());
+    }
+    shader->setInt("ltcTablesEnabled", hasAreaLightTables() ? 1 : 0);
+    if (hasAreaLightTables()) {
+        shader->setInt("ltcMatrix", LTC_MATRIX_UNIT);
+        shader->setInt("ltcMagnitude", LTC_MAGNITUDE_UNIT);
+        glActiveTexture(GL_TEXTURE0 + LTC_MATRIX_UNIT);
+        glBindTexture(GL_TEXTURE_2D, ltcMatrixTexture);
+        glActiveTexture(GL_TEXTURE0 + LTC_MAGNITUDE_UNIT);
+        glBindTexture(GL_TEXTURE_2D, ltcMagnitudeTexture);
+        glActiveTexture(GL_TEXTURE0);
+    }
+}
+
+void CookTorranceModel::setAreaLightTables(const ElementalRenderer::LTCTable& table) {
+    if (table.isEmpty()) {
+        return;
+    }
+    if (ltcMatrixTexture == 0) {
+        glGenTextures(1, &ltcMatrixTexture);
+        glGenTextures(1, &ltcMagnitudeTexture);
+    }
+    
+    const int size = table.getSize();
+    const ElementalRenderer::Image* images[2] = {&table.matrix, &table.magnitude};
+    const unsigned int textures[2] = {ltcMatrixTexture, ltcMagnitudeTexture};
+    for (int i = 0; i < 2; ++i) {
+        glBindTexture(GL_TEXTURE_2D, textures[i]);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA32F, size, size, 0, GL_RGBA, GL_FLOAT, images[i]->getData());
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
 }
 
 std::string CookTorranceModel::getShaderCode() const {
@@ -34,6 +34,9 @@ void CustomBRDFModel::applyToShader(std::shared_ptr<Shader> shader) {
     
     // Set other shader-specific configurations
     shader->setInt("lightingModel", 6); // ID for Custom BRDF model
+    
+    // Area lights are shaded with the Cook-Torrance LTC tables only
+    shader->setInt("ltcTablesEnabled", 0);
 }
 
 std::string CustomBRDFModel::getShaderCode() const {
@@ -49,6 +52,10 @@ void CustomBRDFModel::setCustomBRDF(const BRDFFunction& brdfFunction, const std:
     }
 }
 
+void CustomBRDFModel::setCPUBRDF(const ElementalRenderer::CustomBRDFCallback& cpuFunction) {
+    cpuBRDFFunction = cpuFunction;
+}
+
 void CustomBRDFModel::addParameter(const std::string& name, float defaultValue, float min, float max) {
     // Add the parameter to the parameters map
     parameters[name] = defaultValue;
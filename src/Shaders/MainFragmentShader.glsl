@@ -30,6 +30,21 @@ struct LightingParams {
 };
 uniform LightingParams lighting;
 
+// Rectangle and disk area lights, shaded with linearly transformed cosines
+// (tables fitted by ElementalRenderer::LTC and bound by CookTorranceModel)
+const int MAX_AREA_LIGHTS = 4;
+const int LTC_DISK_SEGMENTS = 12;
+uniform int areaLightCount;
+uniform vec3 areaLightCenters[MAX_AREA_LIGHTS];
+uniform vec3 areaLightAxesX[MAX_AREA_LIGHTS];     // Half extent (rectangle) or radius (disk)
+uniform vec3 areaLightAxesY[MAX_AREA_LIGHTS];     // The light emits along axisY x axisX
+uniform vec3 areaLightColors[MAX_AREA_LIGHTS];
+uniform int areaLightShapes[MAX_AREA_LIGHTS];     // 0 = rectangle, 1 = disk
+uniform int areaLightTwoSided[MAX_AREA_LIGHTS];
+uniform int ltcTablesEnabled;
+uniform sampler2D ltcMatrix;
+uniform sampler2D ltcMagnitude;
+
 const float PI = 3.14159265359;
 
 vec3 calculatePhong(vec3 normal, vec3 lightDir, vec3 viewDir, vec3 albedo, float specularPower);
@@ -43,6 +58,8 @@ vec3 calculateCustomBRDF(vec3 normal, vec3 lightDir, vec3 viewDir, vec3 albedo,
                         float param1, float param2, float param3, float param4);
 vec3 calculatePBR(vec3 normal, vec3 lightDir, vec3 viewDir, vec3 albedo, 
                  float roughness, float metallic, float ao);
+vec3 calculateAreaLights(vec3 normal, vec3 viewDir, vec3 position, vec3 albedo,
+                        float roughness, float metallic, float F0);
 
 vec3 calculateOrenNayar(vec3 normal, vec3 lightDir, vec3 viewDir, vec3 albedo, float roughness) {
     // Calculate angles
@@ -219,6 +236,104 @@ vec3 calculatePBR(vec3 normal, vec3 lightDir, vec3 viewDir, vec3 albedo,
     return result;
 }
 
+// Light polygon in the same winding as LTC::rectanglePolygon and LTC::diskPolygon
+int buildAreaLightPolygon(int light, out vec3 points[LTC_DISK_SEGMENTS]) {
+    vec3 center = areaLightCenters[light];
+    vec3 axisX = areaLightAxesX[light];
+    vec3 axisY = areaLightAxesY[light];
+    if (areaLightShapes[light] == 0) {
+        points[0] = center - axisX - axisY;
+        points[1] = center + axisX - axisY;
+        points[2] = center + axisX + axisY;
+        points[3] = center - axisX + axisY;
+        return 4;
+    }
+    // Push the vertices out so the polygon's area matches the disk's
+    float step = 2.0 * PI / float(LTC_DISK_SEGMENTS);
+    float areaScale = sqrt(step / sin(step));
+    for (int i = 0; i < LTC_DISK_SEGMENTS; ++i) {
+        float angle = step * float(i);
+        points[i] = center + (cos(angle) * axisX + sin(angle) * axisY) * areaScale;
+    }
+    return LTC_DISK_SEGMENTS;
+}
+
+float integrateLTCEdge(vec3 a, vec3 b) {
+    float cosine = clamp(dot(a, b), -1.0, 1.0);
+    vec3 edgeNormal = cross(a, b);
+    float sine = length(edgeNormal);
+    return edgeNormal.z * (sine > 1e-6 ? acos(cosine) / sine : 1.0);
+}
+
+// Cosine integral over a convex polygon clipped to z >= 0, divided by pi
+float integrateLTCPolygon(vec3 points[LTC_DISK_SEGMENTS], int count, bool twoSided) {
+    vec3 clipped[LTC_DISK_SEGMENTS + 1];
+    int clippedCount = 0;
+    for (int i = 0; i < count; ++i) {
+        vec3 a = points[i];
+        vec3 b = points[(i + 1) % count];
+        if (a.z >= 0.0) {
+            clipped[clippedCount++] = a;
+        }
+        if ((a.z >= 0.0) != (b.z >= 0.0)) {
+            clipped[clippedCount++] = a + (a.z / (a.z - b.z)) * (b - a);
+        }
+    }
+    if (clippedCount < 3) return 0.0;
+
+    float sum = 0.0;
+    for (int i = 0; i < clippedCount; ++i) {
+        sum += integrateLTCEdge(normalize(clipped[i]), normalize(clipped[(i + 1) % clippedCount]));
+    }
+    sum /= 2.0 * PI;
+    return min(twoSided ? abs(sum) : max(sum, 0.0), 1.0);
+}
+
+vec3 calculateAreaLights(vec3 normal, vec3 viewDir, vec3 position, vec3 albedo,
+                        float roughness, float metallic, float F0) {
+    if (ltcTablesEnabled == 0 || areaLightCount == 0) return vec3(0.0);
+
+    // Shading frame with the view direction in the xz-plane
+    float NdotV = clamp(dot(normal, viewDir), 1e-4, 1.0);
+    vec3 tangent = viewDir - normal * dot(normal, viewDir);
+    if (dot(tangent, tangent) < 1e-8) {
+        tangent = abs(normal.x) < 0.9 ? vec3(1.0, 0.0, 0.0) : vec3(0.0, 1.0, 0.0);
+        tangent -= normal * dot(normal, tangent);
+    }
+    tangent = normalize(tangent);
+    mat3 toLocal = transpose(mat3(tangent, cross(normal, tangent), normal));
+
+    // Table texel centers sit at (i + 0.5) / size, so the parameters are the texture coordinates
+    vec2 uv = vec2(sqrt(1.0 - NdotV), clamp(roughness, 0.01, 1.0));
+    vec4 matrixTexel = texture(ltcMatrix, uv);
+    mat3 inverseTransform = mat3(vec3(matrixTexel.x, 0.0, matrixTexel.z),
+                                 vec3(0.0, 1.0, 0.0),
+                                 vec3(matrixTexel.y, 0.0, matrixTexel.w));
+    vec4 magnitude = texture(ltcMagnitude, uv);
+    float specularScale = F0 * magnitude.x + magnitude.y;
+
+    vec3 result = vec3(0.0);
+    for (int light = 0; light < MAX_AREA_LIGHTS; ++light) {
+        if (light >= areaLightCount) break;
+
+        vec3 points[LTC_DISK_SEGMENTS];
+        int count = buildAreaLightPolygon(light, points);
+        for (int i = 0; i < count; ++i) {
+            points[i] = toLocal * (points[i] - position);
+        }
+        bool twoSided = areaLightTwoSided[light] != 0;
+        float diffuse = integrateLTCPolygon(points, count, twoSided);
+        for (int i = 0; i < count; ++i) {
+            points[i] = inverseTransform * points[i];
+        }
+        float specular = integrateLTCPolygon(points, count, twoSided) * specularScale;
+
+        // Same combination as calculateCookTorrance
+        result += albedo * ((1.0 - metallic) * diffuse + specular) * areaLightColors[light];
+    }
+    return result;
+}
+
 void main() {
     // Normalize vectors
     vec3 norm = normalize(Normal);
@@ -292,6 +407,10 @@ void main() {
         result += lightContribution * lightColors[i] * attenuation;
     }
     
+    // Area lights (no distance attenuation: the solid angle already falls off)
+    result += calculateAreaLights(norm, viewDir, FragPos, albedo,
+                                  lighting.roughness, lighting.metallic, lighting.fresnel);
+    
     // Add ambient lighting
     result += ambient;
     
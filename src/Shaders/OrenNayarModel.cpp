@@ -18,6 +18,9 @@ void OrenNayarModel::applyToShader(std::shared_ptr<Shader> shader) {
     
     // Set other shader-specific configurations if needed
     shader->setInt("lightingModel", 2); // ID for Oren-Nayar model
+    
+    // Area lights are shaded with the Cook-Torrance LTC tables only
+    shader->setInt("ltcTablesEnabled", 0);
 }
 
 std::string OrenNayarModel::getShaderCode() const {
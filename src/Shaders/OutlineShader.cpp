@@ -0,0 +1,211 @@
+/**
+ * @file OutlineShader.cpp
+ * @brief Screen-space outline shader implementation
+ */
+
+#include "Shaders/OutlineShader.h"
+#include <algorithm>
+
+namespace ElementalRenderer {
+
+// Full-screen quad shared by all outline stages
+const char* OutlineShader::s_vertexShaderSource = R"(
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec2 aTexCoords;
+
+out vec2 TexCoords;
+
+void main() {
+    TexCoords = aTexCoords;
+    gl_Position = vec4(aPos, 1.0);
+}
+)";
+
+// Edge detection: same thresholds as EdgeDetector::detectEdges
+const char* OutlineShader::s_edgeFragmentShaderSource = R"(
+#version 330 core
+out vec2 FragSeed;
+
+in vec2 TexCoords;
+
+uniform sampler2D gNormalDepth; // view-space normal in xyz, linear depth in w
+uniform int edgeOperator;       // 0: Sobel, 1: Roberts
+uniform float depthThreshold;
+uniform float slopeScale;
+uniform float normalThreshold;
+uniform vec2 renderSize;        // Rendered part in the lower left of the textures
+
+vec4 fetch(ivec2 p) {
+    return texelFetch(gNormalDepth, clamp(p, ivec2(0), ivec2(renderSize) - 1), 0);
+}
+
+bool isEdge(vec4 center, vec4 gx, vec4 gy, float meanTapDepth) {
+    if (sqrt(dot(gx.xyz, gx.xyz) + dot(gy.xyz, gy.xyz)) > normalThreshold)
+        return true;
+
+    float nz = max(center.z, 0.0);
+    float slope = min(sqrt(max(1.0 - nz * nz, 0.0)) / max(nz, 1e-3), 10.0);
+    float threshold = depthThreshold * center.w * (1.0 + slopeScale * slope);
+    float depthGradient = length(vec2(gx.w, gy.w));
+    return depthGradient > threshold && center.w <= meanTapDepth + 0.2 * depthGradient;
+}
+
+bool isRobertsEdge(vec4 center, vec4 topLeft, vec4 topRight, vec4 bottomLeft, vec4 bottomRight) {
+    if (min(min(topLeft.w, topRight.w), min(bottomLeft.w, bottomRight.w)) <= 0.0)
+        return true;
+    float meanDepth = (topLeft.w + topRight.w + bottomLeft.w + bottomRight.w) * 0.25;
+    return isEdge(center, bottomRight - topLeft, topRight - bottomLeft, meanDepth);
+}
+
+void main() {
+    ivec2 p = ivec2(gl_FragCoord.xy);
+    vec4 c = fetch(p);
+    FragSeed = vec2(-1.0);
+    if (c.w <= 0.0)
+        return;
+
+    bool edge;
+    if (edgeOperator == 1) {
+        // The four 2x2 blocks containing p, so near-side edges are found in every direction
+        edge = false;
+        for (int by = -1; by <= 0; by++) {
+            for (int bx = -1; bx <= 0; bx++) {
+                ivec2 o = p + ivec2(bx, by);
+                edge = edge || isRobertsEdge(c, fetch(o), fetch(o + ivec2(1, 0)),
+                                             fetch(o + ivec2(0, 1)), fetch(o + ivec2(1, 1)));
+            }
+        }
+    } else {
+        vec4 t[8] = vec4[](
+            fetch(p + ivec2(-1, -1)), fetch(p + ivec2(0, -1)), fetch(p + ivec2(1, -1)),
+            fetch(p + ivec2(-1,  0)),                          fetch(p + ivec2(1,  0)),
+            fetch(p + ivec2(-1,  1)), fetch(p + ivec2(0,  1)), fetch(p + ivec2(1,  1))
+        );
+        bool silhouette = false;
+        float tapDepth = 0.0;
+        for (int i = 0; i < 8; i++) {
+            silhouette = silhouette || t[i].w <= 0.0;
+            tapDepth += t[i].w;
+        }
+        if (silhouette) {
+            edge = true;
+        } else {
+            vec4 gx = (t[2] + 2.0 * t[4] + t[7] - t[0] - 2.0 * t[3] - t[5]) * 0.25;
+            vec4 gy = (t[5] + 2.0 * t[6] + t[7] - t[0] - 2.0 * t[1] - t[2]) * 0.25;
+            edge = isEdge(c, gx, gy, tapDepth / 8.0);
+        }
+    }
+
+    if (edge)
+        FragSeed = vec2(p);
+}
+)";
+
+// One jump-flood step over the seed target
+const char* OutlineShader::s_jumpFloodFragmentShaderSource = R"(
+#version 330 core
+out vec2 FragSeed;
+
+in vec2 TexCoords;
+
+uniform sampler2D seedTexture;
+uniform int stepSize;
+uniform vec2 renderSize;
+
+void main() {
+    ivec2 p = ivec2(gl_FragCoord.xy);
+    ivec2 size = ivec2(renderSize);
+
+    vec2 best = texelFetch(seedTexture, p, 0).xy;
+    float bestDistance = best.x < 0.0 ? 1e20 : dot(best - vec2(p), best - vec2(p));
+
+    for (int dy = -1; dy <= 1; dy++) {
+        for (int dx = -1; dx <= 1; dx++) {
+            ivec2 q = p + ivec2(dx, dy) * stepSize;
+            if (any(lessThan(q, ivec2(0))) || any(greaterThanEqual(q, size)))
+                continue;
+            vec2 seed = texelFetch(seedTexture, q, 0).xy;
+            if (seed.x < 0.0)
+                continue;
+            float d = dot(seed - vec2(p), seed - vec2(p));
+            if (d < bestDistance) {
+                bestDistance = d;
+                best = seed;
+            }
+        }
+    }
+
+    FragSeed = best;
+}
+)";
+
+// Blend the outline over the scene with anti-aliased coverage
+const char* OutlineShader::s_compositeFragmentShaderSource = R"(
+#version 330 core
+out vec4 FragColor;
+
+in vec2 TexCoords;
+
+uniform sampler2D screenTexture;
+uniform sampler2D seedTexture;
+uniform float lineWidth;
+uniform vec3 outlineColor;
+
+void main() {
+    vec2 p = floor(gl_FragCoord.xy);
+    vec4 color = texelFetch(screenTexture, ivec2(p), 0);
+    vec2 seed = texelFetch(seedTexture, ivec2(p), 0).xy;
+
+    float coverage = 0.0;
+    if (seed.x >= 0.0)
+        coverage = clamp(lineWidth * 0.5 + 0.5 - distance(seed, p), 0.0, 1.0);
+
+    FragColor = vec4(mix(color.rgb, outlineColor, coverage), max(color.a, coverage));
+}
+)";
+
+OutlineShader::OutlineShader()
+    : Shader() {
+}
+
+OutlineShader::~OutlineShader() {
+}
+
+bool OutlineShader::loadEdgeDetectionShader() {
+    return compile(s_vertexShaderSource, s_edgeFragmentShaderSource);
+}
+
+bool OutlineShader::loadJumpFloodShader() {
+    return compile(s_vertexShaderSource, s_jumpFloodFragmentShaderSource);
+}
+
+bool OutlineShader::loadCompositeShader() {
+    return compile(s_vertexShaderSource, s_compositeFragmentShaderSource);
+}
+
+void OutlineShader::setEdgeSettings(const EdgeSettings& settings) {
+    use();
+    setInt("edgeOperator", settings.edgeOperator == EdgeOperator::ROBERTS ? 1 : 0);
+    setFloat("depthThreshold", settings.depthThreshold);
+    setFloat("slopeScale", settings.slopeScale);
+    setFloat("normalThreshold", settings.normalThreshold);
+    setFloat("lineWidth", std::max(settings.lineWidth, 0.0f));
+    setVec3("outlineColor", settings.outlineColor);
+}
+
+void OutlineShader::setRenderSize(const glm::ivec2& size) {
+    use();
+    setVec2("renderSize", glm::vec2(size));
+}
+
+void OutlineShader::setJumpStep(int step) {
+    use();
+    setInt("stepSize", step);
+}
+
+std::vector<int> OutlineShader::getJumpFloodSteps(float lineWidth) {
+    return EdgeDetector::getJumpFloodSteps(std::max(lineWidth, 0.0f) * 0.5f + 0.5f);
+}
+
+} // namespace ElementalRenderer
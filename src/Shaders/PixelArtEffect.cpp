@@ -6,13 +6,16 @@
 PixelArtEffect::PixelArtEffect() 
     : ShaderEffect("Pixel Art Effect"), 
       framebuffer(0), 
-      outputTexture(0) {
+      outputTexture(0),
+      paletteLUTTexture(0),
+      customPalette(ElementalRenderer::Palette::cga()) {
 
     // Set default parameters
     intParameters["pixelSize"] = DEFAULT_PIXEL_SIZE;
     intParameters["colorDepth"] = DEFAULT_COLOR_DEPTH;
     intParameters["ditheringEnabled"] = 0; // off by default
     intParameters["paletteMode"] = 0; // RGB by default
+    intParameters["paletteLUTEnabled"] = 0; // built-in CGA palette until one is set
 }
 
 PixelArtEffect::~PixelArtEffect() {
@@ -24,6 +27,10 @@ PixelArtEffect::~PixelArtEffect() {
     if (outputTexture != 0) {
         glDeleteTextures(1, &outputTexture);
     }
+
+    if (paletteLUTTexture != 0) {
+        glDeleteTextures(1, &paletteLUTTexture);
+    }
 }
 
 bool PixelArtEffect::initialize() {
@@ -39,6 +46,13 @@ bool PixelArtEffect::initialize() {
         shader->setInt("colorDepth", intParameters["colorDepth"]);
         shader->setInt("ditheringEnabled", intParameters["ditheringEnabled"]);
         shader->setInt("paletteMode", intParameters["paletteMode"]);
+        shader->setInt("paletteLUT", 1);
+        shader->setInt("paletteLUTEnabled", intParameters["paletteLUTEnabled"]);
+
+        // A palette set before initialization still needs its texture
+        if (intParameters["paletteLUTEnabled"] != 0) {
+            uploadPaletteLUT();
+        }
 
         return true;
     } catch (const std::exception& e) {
@@ -72,6 +86,12 @@ void PixelArtEffect::apply() {
     glActiveTexture(GL_TEXTURE0);
     glBindTexture(GL_TEXTURE_2D, outputTexture);
 
+    if (paletteLUTTexture != 0) {
+        glActiveTexture(GL_TEXTURE1);
+        glBindTexture(GL_TEXTURE_3D, paletteLUTTexture);
+        glActiveTexture(GL_TEXTURE0);
+    }
+
     // Draw a full-screen quad
     // (This would use a quad mesh to render the processed texture)
 }
@@ -95,6 +115,21 @@ void PixelArtEffect::setPaletteMode(int mode) {
     setIntParameter("paletteMode", mode);
 }
 
+void PixelArtEffect::setCustomPalette(const ElementalRenderer::Palette& palette) {
+    if (palette.isEmpty()) {
+        std::cerr << "Warning: Ignoring empty custom palette" << std::endl;
+        return;
+    }
+
+    customPalette = palette;
+    setIntParameter("paletteLUTEnabled", 1);
+    setPaletteMode(1);
+
+    if (shader) {
+        uploadPaletteLUT();
+    }
+}
+
 void PixelArtEffect::createShaders() {
     // Create a new shader program
     shader = std::make_shared<Shader>();
@@ -125,6 +160,8 @@ void PixelArtEffect::createShaders() {
         uniform int colorDepth;
         uniform int ditheringEnabled;
         uniform int paletteMode;
+        uniform sampler3D paletteLUT;
+        uniform int paletteLUTEnabled;
 
         // Dithering matrix (Bayer 4x4)
         const float ditherMatrix[16] = float[](
@@ -196,8 +233,12 @@ void PixelArtEffect::createShaders() {
                     color = floor(color * levels) / levels;
                 }
             } else if (paletteMode == 1) {
-                // Custom palette
-                color = findClosestPaletteColor(color);
+                // Custom palette: the LUT cell holds the nearest entry to its center
+                if (paletteLUTEnabled == 1) {
+                    color = texture(paletteLUT, clamp(color, 0.0, 1.0)).rgb;
+                } else {
+                    color = findClosestPaletteColor(color);
+                }
             }
 
             // Output the final color
@@ -248,3 +289,25 @@ void PixelArtEffect::createFramebuffer(int width, int height) {
 
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
 }
+
+void PixelArtEffect::uploadPaletteLUT() {
+    ElementalRenderer::PaletteLUT lut(customPalette, PALETTE_LUT_RESOLUTION);
+    std::vector<unsigned char> texels;
+    lut.toRGB8(texels);
+
+    if (paletteLUTTexture == 0) {
+        glGenTextures(1, &paletteLUTTexture);
+    }
+
+    // Nearest filtering keeps every lookup an exact palette color
+    glBindTexture(GL_TEXTURE_3D, paletteLUTTexture);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage3D(GL_TEXTURE_3D, 0, GL_RGB8, lut.getResolution(), lut.getResolution(), lut.getResolution(),
+                 0, GL_RGB, GL_UNSIGNED_BYTE, texels.data());
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_3D, 0);
+}
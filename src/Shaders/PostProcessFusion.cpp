@@ -0,0 +1,501 @@
+/**
+ * @file PostProcessFusion.cpp
+ * @brief Implementation of the post-processing fusion planner
+ */
+
+#include "Shaders/PostProcessFusion.h"
+#include "Headless/CPUPostProcessor.h"
+#include "Headless/Image.h"
+#include "Headless/Parallel.h"
+#include "Headless/PixelKernels.h"
+#include "Headless/SIMD.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+
+namespace ElementalRenderer {
+
+using SIMD::Float4;
+
+namespace {
+
+const int kRowGrain = 8;
+
+// Bayer 4x4 matrix shared with PixelArtEffect
+const float kDitherMatrix[16] = {
+    0.0f / 16.0f,  8.0f / 16.0f,  2.0f / 16.0f, 10.0f / 16.0f,
+    12.0f / 16.0f, 4.0f / 16.0f, 14.0f / 16.0f,  6.0f / 16.0f,
+    3.0f / 16.0f, 11.0f / 16.0f,  1.0f / 16.0f,  9.0f / 16.0f,
+    15.0f / 16.0f, 7.0f / 16.0f, 13.0f / 16.0f,  5.0f / 16.0f
+};
+
+std::string uniformName(int stageIndex, const char* parameter) {
+    return "stage" + std::to_string(stageIndex) + parameter;
+}
+
+// --- CPU row kernels -------------------------------------------------------
+//
+// Head kernels fill a destination row from the pass input; tail kernels update
+// a row in place, so a fused pass touches each output row exactly once.
+// Grayscale, vignette and chromatic aberration come from PixelKernels.h,
+// shared with CPUPostProcessor.
+
+void pixelateRow(const Image& source, int y, int pixelSize, glm::vec4* out) {
+    const int width = source.getWidth();
+    const glm::vec2 grid(static_cast<float>(pixelSize) / static_cast<float>(width),
+                         static_cast<float>(pixelSize) / static_cast<float>(source.getHeight()));
+    const float v = (static_cast<float>(y) + 0.5f) / static_cast<float>(source.getHeight());
+    const float snappedV = std::floor(v / grid.y) * grid.y + grid.y * 0.5f;
+    for (int x = 0; x < width; ++x) {
+        const float u = (static_cast<float>(x) + 0.5f) / static_cast<float>(width);
+        const float snappedU = std::floor(u / grid.x) * grid.x + grid.x * 0.5f;
+        out[x] = source.sample(glm::vec2(snappedU, snappedV));
+    }
+}
+
+void quantizeRow(glm::vec4* row, int width, int y, int levels, bool dithering) {
+    const Float4 scale = Float4::splat(static_cast<float>(std::max(levels, 1)));
+    const Float4 opaque = Float4::splat(1.0f);
+    // gl_FragCoord counts rows from the bottom, which is row 0 of an Image
+    const float* ditherRow = kDitherMatrix + (y % 4) * 4;
+    for (int x = 0; x < width; ++x) {
+        Float4 color = Float4::load(row[x]);
+        if (dithering) {
+            color = color + Float4::splat(ditherRow[x % 4]) / scale;
+        }
+        SIMD::withW(SIMD::floor(color * scale) / scale, opaque).store(row[x]);
+    }
+}
+
+void toneMapRow(glm::vec4* row, int width, ToneMapOperator op, float exposure) {
+    const Float4 scale = Float4::set(exposure, exposure, exposure, 1.0f);
+    const Float4 one = Float4::splat(1.0f);
+    const Float4 zero = Float4::splat(0.0f);
+    for (int x = 0; x < width; ++x) {
+        Float4 original = Float4::load(row[x]);
+        Float4 c = original * scale;
+        Float4 mapped;
+        if (op == ToneMapOperator::REINHARD) {
+            mapped = c / (one + SIMD::max(c, zero));
+        } else {
+            // Narkowicz's fit of the ACES filmic curve
+            mapped = (c * (Float4::splat(2.51f) * c + Float4::splat(0.03f)))
+                   / (c * (Float4::splat(2.43f) * c + Float4::splat(0.59f)) + Float4::splat(0.14f));
+            mapped = SIMD::clamp(mapped, zero, one);
+        }
+        SIMD::withW(mapped, original).store(row[x]);
+    }
+}
+
+void applyTailStage(const PostProcessStage& stage, glm::vec4* row, int width, int height, int y) {
+    switch (stage.type) {
+        case PostProcessStageType::GRAYSCALE:
+            PixelKernels::grayscaleRow(row, row, width, stage.strength);
+            break;
+        case PostProcessStageType::VIGNETTE:
+            PixelKernels::vignetteRow(row, row, width, height, y, stage.strength);
+            break;
+        case PostProcessStageType::COLOR_QUANTIZE:
+            quantizeRow(row, width, y, stage.levels, stage.dithering);
+            break;
+        case PostProcessStageType::TONE_MAP:
+            toneMapRow(row, width, stage.toneMapOperator, stage.exposure);
+            break;
+        default:
+            break;
+    }
+}
+
+// Runs one non-custom pass; source and destination may alias only if the pass has no head
+void runPass(const PostProcessPass& pass, const Image& source, Image& destination) {
+    const int width = source.getWidth();
+    const int height = source.getHeight();
+    if (&source != &destination) {
+        destination.resize(width, height);
+    }
+    if (source.isEmpty()) {
+        return;
+    }
+
+    const PostProcessStage& first = pass.stages.front();
+    const bool hasHead = !first.isPerPixel();
+    const size_t tailBegin = hasHead ? 1 : 0;
+
+    // The blur needs a vertical neighbourhood of already filtered rows, so it
+    // runs as a whole-image kernel and the tail follows in place
+    const bool blurHead = hasHead && first.type == PostProcessStageType::BLUR;
+    if (blurHead) {
+        CPUPostProcessor::blur(source, destination, first.strength);
+    }
+
+    Parallel::forRange(0, height, kRowGrain, [&](int rowBegin, int rowEnd) {
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            glm::vec4* row = destination.getRow(y);
+            if (!blurHead) {
+                if (!hasHead) {
+                    if (&source != &destination) {
+                        std::copy(source.getRow(y), source.getRow(y) + width, row);
+                    }
+                } else if (first.type == PostProcessStageType::CHROMATIC_ABERRATION) {
+                    PixelKernels::chromaticAberrationRow(source.getRow(y), row, width, first.strength);
+                } else if (first.type == PostProcessStageType::PIXELATE) {
+                    pixelateRow(source, y, std::max(first.pixelSize, 1), row);
+                }
+            }
+            for (size_t i = tailBegin; i < pass.stages.size(); ++i) {
+                applyTailStage(pass.stages[i], row, width, height, y);
+            }
+        }
+    });
+}
+
+// --- GLSL generation -------------------------------------------------------
+
+void emitHead(std::ostringstream& glsl, const PostProcessStage& stage, int index) {
+    switch (stage.type) {
+        case PostProcessStageType::BLUR: {
+            const std::string strength = uniformName(index, "Strength");
+            glsl << "    {\n"
+                 << "        const float offset = 1.0 / 300.0;\n"
+                 << "        vec2 offsets[9] = vec2[](\n"
+                 << "            vec2(-offset,  offset), vec2(0.0,  offset), vec2(offset,  offset),\n"
+                 << "            vec2(-offset,  0.0),    vec2(0.0,  0.0),    vec2(offset,  0.0),\n"
+                 << "            vec2(-offset, -offset), vec2(0.0, -offset), vec2(offset, -offset)\n"
+                 << "        );\n"
+                 << "        float kernel[9] = float[](\n"
+                 << "            1.0 / 16, 2.0 / 16, 1.0 / 16,\n"
+                 << "            2.0 / 16, 4.0 / 16, 2.0 / 16,\n"
+                 << "            1.0 / 16, 2.0 / 16, 1.0 / 16\n"
+                 << "        );\n"
+                 << "        vec3 col = vec3(0.0);\n"
+                 << "        for (int i = 0; i < 9; i++)\n"
+                 << "            col += texture(screenTexture, TexCoords + offsets[i] * " << strength << ").rgb * kernel[i];\n"
+                 << "        col = mix(texture(screenTexture, TexCoords).rgb, col, " << strength << ");\n"
+                 << "        color = vec4(col, 1.0);\n"
+                 << "    }\n";
+            break;
+        }
+        case PostProcessStageType::CHROMATIC_ABERRATION: {
+            const std::string strength = uniformName(index, "Strength");
+            glsl << "    {\n"
+                 << "        float aberration = 0.01 * " << strength << ";\n"
+                 << "        color.r = texture(screenTexture, TexCoords + vec2(aberration, 0.0)).r;\n"
+                 << "        color.g = texture(screenTexture, TexCoords).g;\n"
+                 << "        color.b = texture(screenTexture, TexCoords - vec2(aberration, 0.0)).b;\n"
+                 << "        color.a = 1.0;\n"
+                 << "    }\n";
+            break;
+        }
+        case PostProcessStageType::PIXELATE:
+            glsl << "    {\n"
+                 << "        vec2 pixelGrid = vec2(" << uniformName(index, "PixelSize")
+                 << ") / vec2(textureSize(screenTexture, 0));\n"
+                 << "        vec2 pixelatedUV = floor(TexCoords / pixelGrid) * pixelGrid + pixelGrid * 0.5;\n"
+                 << "        color = texture(screenTexture, pixelatedUV);\n"
+                 << "    }\n";
+            break;
+        default:
+            glsl << "    color = texture(screenTexture, TexCoords);\n";
+            break;
+    }
+}
+
+void emitTail(std::ostringstream& glsl, const PostProcessStage& stage, int index) {
+    switch (stage.type) {
+        case PostProcessStageType::GRAYSCALE:
+            glsl << "    {\n"
+                 << "        float average = 0.2126 * color.r + 0.7152 * color.g + 0.0722 * color.b;\n"
+                 << "        color = vec4(mix(color.rgb, vec3(average), " << uniformName(index, "Strength") << "), 1.0);\n"
+                 << "    }\n";
+            break;
+        case PostProcessStageType::VIGNETTE:
+            glsl << "    {\n"
+                 << "        float distance = length(TexCoords - vec2(0.5));\n"
+                 << "        color = vec4(color.rgb * smoothstep(0.8, 0.2, distance * "
+                 << uniformName(index, "Strength") << "), 1.0);\n"
+                 << "    }\n";
+            break;
+        case PostProcessStageType::COLOR_QUANTIZE: {
+            const std::string levels = uniformName(index, "Levels");
+            if (stage.dithering) {
+                glsl << "    {\n"
+                     << "        int x = int(mod(gl_FragCoord.x, 4.0));\n"
+                     << "        int y = int(mod(gl_FragCoord.y, 4.0));\n"
+                     << "        float dither = ditherMatrix[y * 4 + x];\n"
+                     << "        color = vec4(floor((color.rgb + dither / " << levels << ") * " << levels << ") / "
+                     << levels << ", 1.0);\n"
+                     << "    }\n";
+            } else {
+                glsl << "    color = vec4(floor(color.rgb * " << levels << ") / " << levels << ", 1.0);\n";
+            }
+            break;
+        }
+        case PostProcessStageType::TONE_MAP:
+            glsl << "    color.rgb = "
+                 << (stage.toneMapOperator == ToneMapOperator::REINHARD ? "toneMapReinhard" : "toneMapACES")
+                 << "(color.rgb * " << uniformName(index, "Exposure") << ");\n";
+            break;
+        default:
+            break;
+    }
+}
+
+} // namespace
+
+bool PostProcessStage::isPerPixel() const {
+    switch (type) {
+        case PostProcessStageType::GRAYSCALE:
+        case PostProcessStageType::VIGNETTE:
+        case PostProcessStageType::COLOR_QUANTIZE:
+        case PostProcessStageType::TONE_MAP:
+            return true;
+        default:
+            return false;
+    }
+}
+
+PostProcessStage PostProcessStage::fromEffect(PostProcessEffect effect, float strength) {
+    switch (effect) {
+        case PostProcessEffect::BLUR:
+            return blur(strength);
+        case PostProcessEffect::GRAYSCALE:
+            return grayscale(strength);
+        case PostProcessEffect::VIGNETTE:
+            return vignette(strength);
+        case PostProcessEffect::CHROMATIC_ABERRATION:
+            return chromaticAberration(strength);
+        case PostProcessEffect::NONE:
+        case PostProcessEffect::CUSTOM:
+        default:
+            return custom("PostProcessShader");
+    }
+}
+
+PostProcessStage PostProcessStage::grayscale(float strength) {
+    PostProcessStage stage;
+    stage.type = PostProcessStageType::GRAYSCALE;
+    stage.strength = strength;
+    return stage;
+}
+
+PostProcessStage PostProcessStage::vignette(float strength) {
+    PostProcessStage stage;
+    stage.type = PostProcessStageType::VIGNETTE;
+    stage.strength = strength;
+    return stage;
+}
+
+PostProcessStage PostProcessStage::quantize(int levels, bool dithering) {
+    PostProcessStage stage;
+    stage.type = PostProcessStageType::COLOR_QUANTIZE;
+    stage.levels = std::max(levels, 1);
+    stage.dithering = dithering;
+    return stage;
+}
+
+PostProcessStage PostProcessStage::toneMap(ToneMapOperator op, float exposure) {
+    PostProcessStage stage;
+    stage.type = PostProcessStageType::TONE_MAP;
+    stage.toneMapOperator = op;
+    stage.exposure = exposure;
+    return stage;
+}
+
+PostProcessStage PostProcessStage::blur(float strength) {
+    PostProcessStage stage;
+    stage.type = PostProcessStageType::BLUR;
+    stage.strength = strength;
+    return stage;
+}
+
+PostProcessStage PostProcessStage::chromaticAberration(float strength) {
+    PostProcessStage stage;
+    stage.type = PostProcessStageType::CHROMATIC_ABERRATION;
+    stage.strength = strength;
+    return stage;
+}
+
+PostProcessStage PostProcessStage::pixelate(int pixelSize) {
+    PostProcessStage stage;
+    stage.type = PostProcessStageType::PIXELATE;
+    stage.pixelSize = std::max(pixelSize, 1);
+    return stage;
+}
+
+PostProcessStage PostProcessStage::custom(const std::string& name) {
+    PostProcessStage stage;
+    stage.type = PostProcessStageType::CUSTOM;
+    stage.customName = name;
+    return stage;
+}
+
+bool PostProcessPass::isCustom() const {
+    return !stages.empty() && stages.front().type == PostProcessStageType::CUSTOM;
+}
+
+double PostProcessPlan::estimateBandwidth(int width, int height, int bytesPerPixel) const {
+    // Each pass reads its input once (neighbour taps hit the texture cache) and writes once
+    return 2.0 * static_cast<double>(passes.size()) * width * height * bytesPerPixel;
+}
+
+double PostProcessPlan::estimateUnfusedBandwidth(int width, int height, int bytesPerPixel) const {
+    return 2.0 * static_cast<double>(unfusedPassCount) * width * height * bytesPerPixel;
+}
+
+PostProcessPlan PostProcessFusion::plan(const std::vector<PostProcessStage>& stages) {
+    PostProcessPlan result;
+    result.unfusedPassCount = static_cast<int>(stages.size());
+
+    bool passOpen = false;
+    for (size_t i = 0; i < stages.size(); ++i) {
+        const PostProcessStage& stage = stages[i];
+        const bool startsPass = stage.type == PostProcessStageType::CUSTOM || !stage.isPerPixel() || !passOpen;
+
+        if (startsPass) {
+            result.passes.emplace_back();
+        }
+        result.passes.back().stages.push_back(stage);
+        result.passes.back().stageIndices.push_back(static_cast<int>(i));
+
+        // Nothing may be appended to an opaque custom pass
+        passOpen = stage.type != PostProcessStageType::CUSTOM;
+    }
+
+    return result;
+}
+
+std::vector<PostProcessStage> PostProcessFusion::fromSteps(const std::vector<PostProcessStep>& steps) {
+    std::vector<PostProcessStage> stages;
+    stages.reserve(steps.size());
+    for (const auto& step : steps) {
+        if (step.effect != PostProcessEffect::NONE) {
+            stages.push_back(PostProcessStage::fromEffect(step.effect, step.strength));
+        }
+    }
+    return stages;
+}
+
+std::vector<PostProcessStage> PostProcessFusion::pixelArtStages(int pixelSize, int colorDepth, bool dithering) {
+    return {PostProcessStage::pixelate(pixelSize), PostProcessStage::quantize(colorDepth, dithering)};
+}
+
+std::string PostProcessFusion::generateFragmentShader(const PostProcessPass& pass) {
+    if (pass.stages.empty() || pass.isCustom()) {
+        std::cerr << "Warning: Cannot generate a fused shader for an empty or custom pass" << std::endl;
+        return std::string();
+    }
+
+    bool needsDither = false;
+    bool needsReinhard = false;
+    bool needsACES = false;
+
+    std::ostringstream glsl;
+    glsl << "#version 330 core\n"
+         << "out vec4 FragColor;\n\n"
+         << "in vec2 TexCoords;\n\n"
+         << "uniform sampler2D screenTexture;\n";
+
+    for (const auto& uniform : getUniformValues(pass)) {
+        glsl << "uniform float " << uniform.first << ";\n";
+    }
+
+    for (const auto& stage : pass.stages) {
+        needsDither |= stage.type == PostProcessStageType::COLOR_QUANTIZE && stage.dithering;
+        if (stage.type == PostProcessStageType::TONE_MAP) {
+            needsReinhard |= stage.toneMapOperator == ToneMapOperator::REINHARD;
+            needsACES |= stage.toneMapOperator == ToneMapOperator::ACES;
+        }
+    }
+
+    if (needsDither) {
+        glsl << "\nconst float ditherMatrix[16] = float[](\n"
+             << "    0.0/16.0,  8.0/16.0,  2.0/16.0, 10.0/16.0,\n"
+             << "    12.0/16.0, 4.0/16.0, 14.0/16.0,  6.0/16.0,\n"
+             << "    3.0/16.0, 11.0/16.0,  1.0/16.0,  9.0/16.0,\n"
+             << "    15.0/16.0, 7.0/16.0, 13.0/16.0,  5.0/16.0\n"
+             << ");\n";
+    }
+    if (needsReinhard) {
+        glsl << "\nvec3 toneMapReinhard(vec3 c)\n{\n"
+             << "    return c / (1.0 + max(c, vec3(0.0)));\n"
+             << "}\n";
+    }
+    if (needsACES) {
+        glsl << "\nvec3 toneMapACES(vec3 c)\n{\n"
+             << "    return clamp((c * (2.51 * c + 0.03)) / (c * (2.43 * c + 0.59) + 0.14), 0.0, 1.0);\n"
+             << "}\n";
+    }
+
+    glsl << "\nvoid main()\n{\n"
+         << "    vec4 color;\n";
+
+    const bool hasHead = !pass.stages.front().isPerPixel();
+    emitHead(glsl, pass.stages.front(), 0);
+    for (size_t i = hasHead ? 1 : 0; i < pass.stages.size(); ++i) {
+        emitTail(glsl, pass.stages[i], static_cast<int>(i));
+    }
+
+    glsl << "    FragColor = color;\n"
+         << "}\n";
+    return glsl.str();
+}
+
+std::vector<std::pair<std::string, float>> PostProcessFusion::getUniformValues(const PostProcessPass& pass) {
+    std::vector<std::pair<std::string, float>> uniforms;
+    for (size_t i = 0; i < pass.stages.size(); ++i) {
+        const PostProcessStage& stage = pass.stages[i];
+        const int index = static_cast<int>(i);
+        switch (stage.type) {
+            case PostProcessStageType::GRAYSCALE:
+            case PostProcessStageType::VIGNETTE:
+            case PostProcessStageType::BLUR:
+            case PostProcessStageType::CHROMATIC_ABERRATION:
+                uniforms.emplace_back(uniformName(index, "Strength"), stage.strength);
+                break;
+            case PostProcessStageType::COLOR_QUANTIZE:
+                uniforms.emplace_back(uniformName(index, "Levels"), static_cast<float>(stage.levels));
+                break;
+            case PostProcessStageType::TONE_MAP:
+                uniforms.emplace_back(uniformName(index, "Exposure"), stage.exposure);
+                break;
+            case PostProcessStageType::PIXELATE:
+                uniforms.emplace_back(uniformName(index, "PixelSize"), static_cast<float>(stage.pixelSize));
+                break;
+            case PostProcessStageType::CUSTOM:
+            default:
+                break;
+        }
+    }
+    return uniforms;
+}
+
+void PostProcessFusion::execute(const PostProcessPlan& plan, Image& image) {
+    Image scratch;
+    for (const auto& pass : plan.passes) {
+        if (pass.stages.empty() || pass.isCustom()) {
+            continue;
+        }
+        if (pass.stages.front().isPerPixel()) {
+            // Pure per-pixel passes can run in place
+            runPass(pass, image, image);
+        } else {
+            runPass(pass, image, scratch);
+            std::swap(image, scratch);
+        }
+    }
+}
+
+void PostProcessFusion::executeUnfused(const std::vector<PostProcessStage>& stages, Image& image) {
+    PostProcessPlan unfused;
+    unfused.unfusedPassCount = static_cast<int>(stages.size());
+    for (size_t i = 0; i < stages.size(); ++i) {
+        PostProcessPass pass;
+        pass.stages.push_back(stages[i]);
+        pass.stageIndices.push_back(static_cast<int>(i));
+        unfused.passes.push_back(pass);
+    }
+    execute(unfused, image);
+}
+
+} // namespace ElementalRenderer
@@ -4,7 +4,7 @@
  */
 
 #include "Shaders/SSAOShader.h"
-#include <random>
+#include "Headless/AmbientOcclusion.h"
 #include <glad/glad.h>  // OpenGL loader... should be included before other OpenGL-related headers
 #include <GLFW/glfw3.h> // input handling
 
@@ -143,28 +143,9 @@ bool SSAOShader::loadSSAOBlurShader() {
 }
 
 void SSAOShader::generateSampleKernel(int kernelSize) {
+    // Shared with the CPU reference so both use the same kernel
     m_kernelSize = kernelSize;
-    m_sampleKernel.resize(kernelSize);
-
-    std::uniform_real_distribution<float> randomFloats(0.0, 1.0);
-    std::default_random_engine generator;
-
-    for (int i = 0; i < kernelSize; ++i) {
-        // Create sample in tangent space
-        glm::vec3 sample(
-            randomFloats(generator) * 2.0f - 1.0f,
-            randomFloats(generator) * 2.0f - 1.0f,
-            randomFloats(generator)
-        );
-        sample = glm::normalize(sample);
-        sample *= randomFloats(generator);
-
-        // Scale samples s.t. they're more focused near the origin
-        float scale = static_cast<float>(i) / static_cast<float>(kernelSize);
-        scale = 0.1f + 0.9f * scale * scale; // Lerp
-        sample *= scale;
-        m_sampleKernel[i] = sample;
-    }
+    m_sampleKernel = AmbientOcclusion::generateSampleKernel(kernelSize);
 
     // Update the shader with sample kernel
     use();
@@ -176,19 +157,7 @@ void SSAOShader::generateSampleKernel(int kernelSize) {
 }
 
 unsigned int SSAOShader::generateNoiseTexture(int size) {
-    std::vector<glm::vec3> ssaoNoise;
-    std::uniform_real_distribution<float> randomFloats(0.0, 1.0);
-    std::default_random_engine generator;
-
-    for (int i = 0; i < size * size; i++) {
-        // Rotate around z-axis (in tangent space)
-        glm::vec3 noise(
-            randomFloats(generator) * 2.0f - 1.0f,
-            randomFloats(generator) * 2.0f - 1.0f,
-            0.0f
-        );
-        ssaoNoise.push_back(noise);
-    }
+    std::vector<glm::vec3> ssaoNoise = AmbientOcclusion::generateNoise(size);
 
     // Create and set up the noise texture
     unsigned int noiseTexture;
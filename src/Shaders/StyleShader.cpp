@@ -131,6 +131,8 @@ void StyleShader::initAnimeShader() {
         out vec3 Normal;
         out vec2 TexCoords;
         out vec3 ViewPos;
+        out vec3 ViewNormal;
+        out float ViewDepth;
         
         uniform mat4 model;
         uniform mat4 view;
@@ -142,25 +144,30 @@ void StyleShader::initAnimeShader() {
             Normal = mat3(transpose(inverse(model))) * aNormal;
             TexCoords = aTexCoords;
             ViewPos = viewPos;
+            ViewNormal = mat3(view) * Normal;
+            ViewDepth = -(view * vec4(FragPos, 1.0)).z;
             gl_Position = projection * view * vec4(FragPos, 1.0);
         }
     )";
     
-    // Fragment shader source for anime cell shading
+    // Fragment shader source for anime cell shading; outlines are drawn
+    // afterwards by the renderer's screen-space pass from NormalDepth
     const char* fragmentShaderSource = R"(
         #version 330 core
-        out vec4 FragColor;
+        layout (location = 0) out vec4 FragColor;
+        layout (location = 1) out vec4 NormalDepth;   // View-space normal, linear depth
         
         in vec3 FragPos;
         in vec3 Normal;
         in vec2 TexCoords;
         in vec3 ViewPos;
+        in vec3 ViewNormal;
+        in float ViewDepth;
         
         uniform sampler2D diffuseTexture;
         uniform vec3 lightPos;
         uniform vec3 lightColor;
         uniform vec3 objectColor;
-        uniform float outlineThickness;
         uniform float celLevels;
         
         void main() {
@@ -193,12 +200,7 @@ void StyleShader::initAnimeShader() {
             
             // Output with light ambient
             FragColor = vec4(result + vec3(0.1, 0.1, 0.1), 1.0);
-            
-            // Edge detection for outlines
-            float edge = dot(viewDir, normal);
-            if (edge < outlineThickness) {
-                FragColor = vec4(0.0, 0.0, 0.0, 1.0); // Black outline
-            }
+            NormalDepth = vec4(normalize(ViewNormal), ViewDepth);
         }
     )";
     
@@ -681,7 +683,6 @@ void StyleShader::setDefaultParameters(Style style) {
     // Set style-specific parameters
     switch (style) {
         case Style::ANIME:
-            shader->setFloat("outlineThickness", 0.3f);
             shader->setFloat("celLevels", 3.0f);
             break;
         case Style::PIXEL_ART:
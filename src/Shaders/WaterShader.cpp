@@ -4,6 +4,7 @@
  */
 
 #include "Shaders/WaterShader.h"
+#include <glad/glad.h>  // OpenGL loader... should be included before other OpenGL-related headers
 
 namespace ElementalRenderer {
 
@@ -145,6 +146,12 @@ void WaterShader::setWaterMaps(unsigned int dudvMap, unsigned int normalMap) {
     use();
     setInt("dudvMap", 0);
     setInt("normalMap", 1);
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, dudvMap);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, normalMap);
+    glActiveTexture(GL_TEXTURE0);
 }
 
 void WaterShader::setWaterTextures(unsigned int reflectionTexture, unsigned int refractionTexture, unsigned int depthTexture) {
@@ -0,0 +1,197 @@
+/**
+ * @file CascadedShadowPlanner.cpp
+ * @brief Implementation of the cascaded shadow map planner
+ */
+
+#include "Shadows/CascadedShadowPlanner.h"
+#include <algorithm>
+#include <cmath>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace ElementalRenderer {
+
+namespace {
+
+// Bounding sphere radii are rounded up to this step so float noise from
+// camera rotation never changes the cascade size (and thus the texel size)
+const float kRadiusQuantum = 1.0f / 16.0f;
+
+glm::mat4 makeLightView(const glm::vec3& lightDirection) {
+    const glm::vec3 direction = glm::normalize(lightDirection);
+    const glm::vec3 up = std::abs(direction.y) > 0.99f ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+    // Rotation only: light space is anchored at the world origin so texel
+    // snapping in light space is also stable in world space
+    return glm::lookAt(glm::vec3(0.0f), direction, up);
+}
+
+inline float snapDown(float value, float step) {
+    return std::floor(value / step) * step;
+}
+
+} // namespace
+
+void CascadedShadowPlanner::getClipPlanes(const glm::mat4& projection, float& nearPlane, float& farPlane) {
+    if (std::abs(projection[2][3] + 1.0f) < 1e-6f) {
+        // Perspective: [2][2] = -(f + n) / (f - n), [3][2] = -2fn / (f - n)
+        nearPlane = projection[3][2] / (projection[2][2] - 1.0f);
+        farPlane = projection[3][2] / (projection[2][2] + 1.0f);
+    } else {
+        // Orthographic: [2][2] = -2 / (f - n), [3][2] = -(f + n) / (f - n)
+        nearPlane = (projection[3][2] + 1.0f) / projection[2][2];
+        farPlane = (projection[3][2] - 1.0f) / projection[2][2];
+    }
+}
+
+std::vector<float> CascadedShadowPlanner::computeSplits(float nearPlane, float farPlane, int cascadeCount, float lambda) {
+    const int count = std::min(std::max(cascadeCount, 1), kMaxCascades);
+    const float blend = std::min(std::max(lambda, 0.0f), 1.0f);
+    nearPlane = std::max(nearPlane, 1e-4f);
+    farPlane = std::max(farPlane, nearPlane);
+
+    std::vector<float> splits(count + 1);
+    splits[0] = nearPlane;
+    for (int i = 1; i < count; ++i) {
+        const float fraction = static_cast<float>(i) / static_cast<float>(count);
+        const float logarithmic = nearPlane * std::pow(farPlane / nearPlane, fraction);
+        const float uniform = nearPlane + (farPlane - nearPlane) * fraction;
+        splits[i] = blend * logarithmic + (1.0f - blend) * uniform;
+    }
+    splits[count] = farPlane;
+    return splits;
+}
+
+std::array<glm::vec3, 8> CascadedShadowPlanner::getFrustumSliceCorners(const glm::mat4& cameraView,
+                                                                      const glm::mat4& cameraProjection,
+                                                                      float sliceNear, float sliceFar) {
+    float nearPlane, farPlane;
+    getClipPlanes(cameraProjection, nearPlane, farPlane);
+    const glm::mat4 inverseViewProjection = glm::inverse(cameraProjection * cameraView);
+
+    // Each corner edge of the frustum runs from its near-plane to its far-plane
+    // corner, and view depth is linear along it
+    const float t0 = (sliceNear - nearPlane) / (farPlane - nearPlane);
+    const float t1 = (sliceFar - nearPlane) / (farPlane - nearPlane);
+
+    std::array<glm::vec3, 8> corners;
+    for (int i = 0; i < 4; ++i) {
+        const float x = (i & 1) ? 1.0f : -1.0f;
+        const float y = (i & 2) ? 1.0f : -1.0f;
+        glm::vec4 nearCorner = inverseViewProjection * glm::vec4(x, y, -1.0f, 1.0f);
+        glm::vec4 farCorner = inverseViewProjection * glm::vec4(x, y, 1.0f, 1.0f);
+        const glm::vec3 a = glm::vec3(nearCorner) / nearCorner.w;
+        const glm::vec3 b = glm::vec3(farCorner) / farCorner.w;
+        corners[i] = a + (b - a) * t0;
+        corners[i + 4] = a + (b - a) * t1;
+    }
+    return corners;
+}
+
+std::vector<ShadowCascade> CascadedShadowPlanner::plan(const glm::mat4& cameraView, const glm::mat4& cameraProjection,
+                                                       const glm::vec3& lightDirection, const BoundingBox& sceneBounds,
+                                                       const std::vector<BoundingBox>& casterBounds,
+                                                       const CascadeSettings& settings) {
+    float nearPlane, farPlane;
+    getClipPlanes(cameraProjection, nearPlane, farPlane);
+    if (settings.maxShadowDistance > 0.0f) {
+        farPlane = std::min(farPlane, settings.maxShadowDistance);
+    }
+    const std::vector<float> splits = computeSplits(nearPlane, farPlane, settings.cascadeCount, settings.splitLambda);
+    const float resolution = static_cast<float>(std::max(settings.resolution, 1));
+
+    const glm::mat4 lightView = makeLightView(lightDirection);
+    const BoundingBox sceneLight = sceneBounds.transformed(lightView);
+    std::vector<BoundingBox> castersLight;
+    castersLight.reserve(casterBounds.size());
+    for (const BoundingBox& bounds : casterBounds) {
+        castersLight.push_back(bounds.transformed(lightView));
+    }
+
+    std::vector<ShadowCascade> cascades(splits.size() - 1);
+    for (size_t c = 0; c < cascades.size(); ++c) {
+        ShadowCascade& cascade = cascades[c];
+        cascade.splitNear = splits[c];
+        cascade.splitFar = splits[c + 1];
+        cascade.lightView = lightView;
+
+        const std::array<glm::vec3, 8> corners =
+            getFrustumSliceCorners(cameraView, cameraProjection, cascade.splitNear, cascade.splitFar);
+        BoundingBox slice;
+        glm::vec3 center(0.0f);
+        for (const glm::vec3& corner : corners) {
+            const glm::vec3 p = glm::vec3(lightView * glm::vec4(corner, 1.0f));
+            slice.expand(p);
+            center += p;
+        }
+        center /= 8.0f;
+
+        glm::vec2 windowMin, windowMax;
+        if (settings.stabilize) {
+            // Bounding sphere: its size only depends on the projection and the
+            // splits, so camera rotation cannot change the texel size
+            float radius = 0.0f;
+            for (const glm::vec3& corner : corners) {
+                radius = std::max(radius, glm::length(glm::vec3(lightView * glm::vec4(corner, 1.0f)) - center));
+            }
+            radius = std::ceil(radius / kRadiusQuantum) * kRadiusQuantum;
+            cascade.texelSize = 2.0f * radius / resolution;
+
+            // Move the window in whole texels only
+            const glm::vec2 origin(snapDown(center.x - radius, cascade.texelSize),
+                                   snapDown(center.y - radius, cascade.texelSize));
+            windowMin = origin;
+            windowMax = origin + glm::vec2(2.0f * radius);
+        } else {
+            // Tightest window: the slice clipped to the scene
+            windowMin = glm::vec2(slice.min.x, slice.min.y);
+            windowMax = glm::vec2(slice.max.x, slice.max.y);
+            if (!sceneLight.isEmpty()) {
+                const glm::vec2 clippedMin = glm::max(windowMin, glm::vec2(sceneLight.min.x, sceneLight.min.y));
+                const glm::vec2 clippedMax = glm::min(windowMax, glm::vec2(sceneLight.max.x, sceneLight.max.y));
+                if (clippedMin.x < clippedMax.x && clippedMin.y < clippedMax.y) {
+                    windowMin = clippedMin;
+                    windowMax = clippedMax;
+                }
+            }
+            cascade.texelSize = std::max(windowMax.x - windowMin.x, windowMax.y - windowMin.y) / resolution;
+        }
+
+        // Light space looks down -Z, so larger z is closer to the light. The near
+        // plane reaches back to the scene bounds to keep every occluder between
+        // the light and the slice; the far plane stops at the last receiver.
+        float nearZ = slice.max.z;
+        float farZ = slice.min.z;
+        if (!sceneLight.isEmpty()) {
+            nearZ = std::max(nearZ, sceneLight.max.z);
+            farZ = std::max(farZ, sceneLight.min.z);
+        }
+        const float depthMargin = std::max((nearZ - farZ) * 1e-3f, 1e-3f);
+        nearZ += depthMargin;
+        farZ -= depthMargin;
+
+        cascade.lightProjection = glm::ortho(windowMin.x, windowMax.x, windowMin.y, windowMax.y, -nearZ, -farZ);
+        cascade.lightSpaceMatrix = cascade.lightProjection * lightView;
+
+        for (size_t i = 0; i < castersLight.size(); ++i) {
+            const BoundingBox& caster = castersLight[i];
+            if (caster.isEmpty()) {
+                continue;
+            }
+            if (caster.max.x >= windowMin.x && caster.min.x <= windowMax.x && caster.max.y >= windowMin.y
+                && caster.min.y <= windowMax.y && caster.max.z >= farZ && caster.min.z <= nearZ) {
+                cascade.casters.push_back(i);
+            }
+        }
+    }
+    return cascades;
+}
+
+int CascadedShadowPlanner::selectCascade(const std::vector<ShadowCascade>& cascades, float viewDepth) {
+    for (size_t i = 0; i < cascades.size(); ++i) {
+        if (viewDepth <= cascades[i].splitFar) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+} // namespace ElementalRenderer
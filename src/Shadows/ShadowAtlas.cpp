@@ -0,0 +1,380 @@
+/**
+ * @file ShadowAtlas.cpp
+ * @brief Implementation of the shadow atlas allocator
+ */
+
+#include "Shadows/ShadowAtlas.h"
+#include <algorithm>
+#include <cmath>
+#include <unordered_set>
+
+namespace ElementalRenderer {
+
+namespace {
+
+int floorPowerOfTwo(int value) {
+    int result = 1;
+    while (result <= value / 2) {
+        result *= 2;
+    }
+    return result;
+}
+
+int ceilPowerOfTwo(int value) {
+    int result = 1;
+    while (result < value) {
+        result *= 2;
+    }
+    return result;
+}
+
+struct PendingRequest {
+    const ShadowAtlasRequest* request;
+    int resolution;
+    float score;
+};
+
+} // namespace
+
+ShadowAtlas::ShadowAtlas(int atlasSize, int minTileSize)
+    : m_atlasSize(floorPowerOfTwo(std::max(atlasSize, 1))),
+      m_minTileSize(std::min(floorPowerOfTwo(std::max(minTileSize, 1)), floorPowerOfTwo(std::max(atlasSize, 1)))),
+      m_fullCoverageResolution(2048),
+      m_droppedCount(0),
+      m_relocationCount(0) {
+    int levelCount = 1;
+    while ((m_atlasSize >> (levelCount - 1)) > m_minTileSize) {
+        ++levelCount;
+    }
+    m_levels.resize(levelCount);
+    m_freeCounts.assign(levelCount, 0);
+    clear();
+}
+
+void ShadowAtlas::setFullCoverageResolution(int resolution) {
+    m_fullCoverageResolution = std::max(resolution, 1);
+}
+
+void ShadowAtlas::clear() {
+    for (size_t level = 0; level < m_levels.size(); ++level) {
+        const size_t grid = static_cast<size_t>(gridSize(static_cast<int>(level)));
+        m_levels[level].assign(grid * grid, NodeState::ABSENT);
+        m_freeCounts[level] = 0;
+    }
+    setNode(0, 0, 0, NodeState::FREE);
+    m_allocations.clear();
+    m_droppedCount = 0;
+    m_relocationCount = 0;
+}
+
+int ShadowAtlas::levelForSize(int size) const {
+    const int tileSize = std::min(std::max(ceilPowerOfTwo(std::max(size, 1)), m_minTileSize), m_atlasSize);
+    int level = 0;
+    while (sizeForLevel(level) > tileSize) {
+        ++level;
+    }
+    return level;
+}
+
+void ShadowAtlas::setNode(int level, int x, int y, NodeState state) {
+    NodeState& current = m_levels[level][static_cast<size_t>(y) * gridSize(level) + x];
+    if (current == NodeState::FREE) {
+        --m_freeCounts[level];
+    }
+    if (state == NodeState::FREE) {
+        ++m_freeCounts[level];
+    }
+    current = state;
+}
+
+bool ShadowAtlas::allocateTile(int size, ShadowAtlasTile& tile) {
+    const int level = levelForSize(size);
+    if (ceilPowerOfTwo(std::max(size, 1)) > m_atlasSize) {
+        return false;
+    }
+
+    // Best fit: the smallest free node that can hold the tile
+    int foundLevel = -1;
+    int foundX = 0, foundY = 0;
+    for (int l = level; l >= 0 && foundLevel < 0; --l) {
+        if (m_freeCounts[l] == 0) {
+            continue;
+        }
+        const int grid = gridSize(l);
+        for (int i = 0; i < grid * grid; ++i) {
+            if (m_levels[l][i] == NodeState::FREE) {
+                foundLevel = l;
+                foundX = i % grid;
+                foundY = i / grid;
+                break;
+            }
+        }
+    }
+    if (foundLevel < 0) {
+        return false;
+    }
+
+    // Split down to the requested level, always descending into the first child
+    int x = foundX, y = foundY;
+    for (int l = foundLevel; l < level; ++l) {
+        setNode(l, x, y, NodeState::SPLIT);
+        x *= 2;
+        y *= 2;
+        setNode(l + 1, x, y, NodeState::FREE);
+        setNode(l + 1, x + 1, y, NodeState::FREE);
+        setNode(l + 1, x, y + 1, NodeState::FREE);
+        setNode(l + 1, x + 1, y + 1, NodeState::FREE);
+    }
+    setNode(level, x, y, NodeState::USED);
+
+    tile.size = sizeForLevel(level);
+    tile.x = x * tile.size;
+    tile.y = y * tile.size;
+    return true;
+}
+
+void ShadowAtlas::freeTile(const ShadowAtlasTile& tile) {
+    int level = levelForSize(tile.size);
+    int x = tile.x / sizeForLevel(level);
+    int y = tile.y / sizeForLevel(level);
+    if (node(level, x, y) != NodeState::USED) {
+        return;
+    }
+    setNode(level, x, y, NodeState::FREE);
+
+    // Merge free siblings back into their parent
+    while (level > 0) {
+        const int px = x / 2, py = y / 2;
+        const int cx = px * 2, cy = py * 2;
+        if (node(level, cx, cy) != NodeState::FREE || node(level, cx + 1, cy) != NodeState::FREE
+            || node(level, cx, cy + 1) != NodeState::FREE || node(level, cx + 1, cy + 1) != NodeState::FREE) {
+            break;
+        }
+        setNode(level, cx, cy, NodeState::ABSENT);
+        setNode(level, cx + 1, cy, NodeState::ABSENT);
+        setNode(level, cx, cy + 1, NodeState::ABSENT);
+        setNode(level, cx + 1, cy + 1, NodeState::ABSENT);
+        --level;
+        x = px;
+        y = py;
+        setNode(level, x, y, NodeState::FREE);
+    }
+}
+
+int ShadowAtlas::chooseResolution(const ShadowAtlasRequest& request) const {
+    const float coverage = std::min(std::max(request.screenCoverage, 0.0f), 1.0f);
+    const float ideal = static_cast<float>(m_fullCoverageResolution) * std::sqrt(coverage) * std::max(request.importance, 0.0f);
+    const int upper = std::max(std::min(floorPowerOfTwo(std::max(request.maxResolution, 1)), m_atlasSize), m_minTileSize);
+    if (ideal <= static_cast<float>(m_minTileSize)) {
+        return m_minTileSize;
+    }
+    // Nearest power of two in log space, so resolution steps are symmetric
+    const int resolution = 1 << static_cast<int>(std::lround(std::log2(ideal)));
+    return std::min(std::max(resolution, m_minTileSize), upper);
+}
+
+bool ShadowAtlas::allocateFaces(const ShadowAtlasRequest& request, int resolution, ShadowAtlasAllocation& allocation) {
+    allocation.lightId = request.lightId;
+    allocation.resolution = resolution;
+    allocation.faces.clear();
+    for (int face = 0; face < std::max(request.faceCount, 1); ++face) {
+        ShadowAtlasTile tile;
+        if (!allocateTile(resolution, tile)) {
+            releaseAllocation(allocation);
+            return false;
+        }
+        allocation.faces.push_back(tile);
+    }
+    allocation.moved = true;
+    return true;
+}
+
+void ShadowAtlas::releaseAllocation(ShadowAtlasAllocation& allocation) {
+    for (const ShadowAtlasTile& tile : allocation.faces) {
+        freeTile(tile);
+    }
+    allocation.faces.clear();
+}
+
+void ShadowAtlas::update(const std::vector<ShadowAtlasRequest>& requests) {
+    m_droppedCount = 0;
+    m_relocationCount = 0;
+
+    std::unordered_map<size_t, float> scores;
+    std::unordered_map<size_t, const ShadowAtlasRequest*> requestById;
+    for (const ShadowAtlasRequest& request : requests) {
+        requestById[request.lightId] = &request;
+        scores[request.lightId] = std::min(std::max(request.screenCoverage, 0.0f), 1.0f) * std::max(request.importance, 0.0f);
+    }
+
+    // Release lights that no longer cast shadows
+    for (auto it = m_allocations.begin(); it != m_allocations.end();) {
+        it->second.moved = false;
+        if (scores.find(it->first) == scores.end()) {
+            releaseAllocation(it->second);
+            it = m_allocations.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    // Keep allocations whose resolution is close enough; one level of
+    // hysteresis on shrinking stops lights near a boundary from flipping
+    std::vector<PendingRequest> pending;
+    std::vector<PendingRequest> oversized;
+    for (const ShadowAtlasRequest& request : requests) {
+        const int desired = chooseResolution(request);
+        auto it = m_allocations.find(request.lightId);
+        if (it != m_allocations.end()) {
+            ShadowAtlasAllocation& current = it->second;
+            const bool sameFaces = static_cast<int>(current.faces.size()) == std::max(request.faceCount, 1);
+            if (sameFaces && desired == current.resolution) {
+                continue;
+            }
+            if (sameFaces && desired * 2 == current.resolution) {
+                oversized.push_back({&request, desired, scores[request.lightId]});
+                continue;
+            }
+            if (!sameFaces || desired < current.resolution) {
+                releaseAllocation(current);
+                m_allocations.erase(it);
+            }
+        }
+        pending.push_back({&request, desired, scores[request.lightId]});
+    }
+
+    auto byPriority = [](const PendingRequest& a, const PendingRequest& b) {
+        if (a.score != b.score) {
+            return a.score > b.score;
+        }
+        return a.request->lightId < b.request->lightId;
+    };
+    std::sort(pending.begin(), pending.end(), byPriority);
+    std::unordered_set<size_t> pendingIds;
+    for (const PendingRequest& entry : pending) {
+        pendingIds.insert(entry.request->lightId);
+    }
+
+    std::vector<PendingRequest> leftovers;
+    for (const PendingRequest& entry : pending) {
+        const ShadowAtlasRequest& request = *entry.request;
+        auto existing = m_allocations.find(request.lightId);
+        // Growing lights keep their current tiles if the larger ones do not fit
+        const int smallest = existing != m_allocations.end() ? existing->second.resolution * 2 : m_minTileSize;
+
+        ShadowAtlasAllocation allocation;
+        bool placed = false;
+        while (!placed) {
+            for (int resolution = entry.resolution; resolution >= smallest && !placed; resolution /= 2) {
+                placed = allocateFaces(request, resolution, allocation);
+            }
+            if (placed || existing != m_allocations.end()) {
+                break;
+            }
+
+            // Make room by evicting the lowest-priority resident below this light
+            auto victim = m_allocations.end();
+            for (auto it = m_allocations.begin(); it != m_allocations.end(); ++it) {
+                if (scores[it->first] < entry.score
+                    && (victim == m_allocations.end() || scores[it->first] < scores[victim->first])) {
+                    victim = it;
+                }
+            }
+            if (victim == m_allocations.end()) {
+                break;
+            }
+            // Victims still waiting in the queue get their turn later anyway
+            if (pendingIds.find(victim->first) == pendingIds.end()) {
+                leftovers.push_back({requestById[victim->first], victim->second.resolution / 2, scores[victim->first]});
+            }
+            releaseAllocation(victim->second);
+            m_allocations.erase(victim);
+        }
+
+        if (placed) {
+            if (existing != m_allocations.end()) {
+                releaseAllocation(existing->second);
+            }
+            m_allocations[request.lightId] = allocation;
+        } else if (existing == m_allocations.end()) {
+            leftovers.push_back(entry);
+        }
+    }
+
+    // Under pressure the hysteresis gives way: oversized lights drop to the
+    // resolution they asked for before anyone goes without a shadow
+    if (!leftovers.empty()) {
+        for (const PendingRequest& entry : oversized) {
+            // Lights evicted above are already queued as leftovers
+            auto it = m_allocations.find(entry.request->lightId);
+            if (it == m_allocations.end()) {
+                continue;
+            }
+            releaseAllocation(it->second);
+            if (!allocateFaces(*entry.request, entry.resolution, it->second)) {
+                // Competes with the other leftovers, and counts as dropped if nothing fits
+                m_allocations.erase(it);
+                leftovers.push_back({entry.request, entry.resolution / 2, entry.score});
+            }
+        }
+    }
+
+    // Evicted and unplaced lights get whatever is left, at reduced resolution
+    std::sort(leftovers.begin(), leftovers.end(), byPriority);
+    for (const PendingRequest& entry : leftovers) {
+        if (m_allocations.find(entry.request->lightId) != m_allocations.end()) {
+            continue;
+        }
+        ShadowAtlasAllocation allocation;
+        bool placed = false;
+        for (int resolution = std::max(entry.resolution, m_minTileSize); resolution >= m_minTileSize && !placed; resolution /= 2) {
+            placed = allocateFaces(*entry.request, resolution, allocation);
+        }
+        if (placed) {
+            m_allocations[entry.request->lightId] = allocation;
+        } else {
+            ++m_droppedCount;
+        }
+    }
+
+    for (const auto& entry : m_allocations) {
+        m_relocationCount += entry.second.moved ? 1 : 0;
+    }
+}
+
+const ShadowAtlasAllocation* ShadowAtlas::getAllocation(size_t lightId) const {
+    auto it = m_allocations.find(lightId);
+    return it != m_allocations.end() ? &it->second : nullptr;
+}
+
+ShadowAtlasStats ShadowAtlas::getStats() const {
+    ShadowAtlasStats stats;
+    stats.allocationCount = static_cast<int>(m_allocations.size());
+    stats.droppedCount = m_droppedCount;
+    stats.relocationCount = m_relocationCount;
+
+    double freeArea = 0.0;
+    for (size_t level = 0; level < m_levels.size(); ++level) {
+        const double size = static_cast<double>(sizeForLevel(static_cast<int>(level)));
+        stats.freeBlockCount += m_freeCounts[level];
+        freeArea += size * size * m_freeCounts[level];
+        if (m_freeCounts[level] > 0 && stats.largestFreeTile == 0) {
+            stats.largestFreeTile = static_cast<int>(size);
+        }
+    }
+
+    const double atlasArea = static_cast<double>(m_atlasSize) * m_atlasSize;
+    stats.usedFraction = static_cast<float>(1.0 - freeArea / atlasArea);
+    if (freeArea > 0.0) {
+        const double largest = static_cast<double>(stats.largestFreeTile);
+        stats.fragmentation = static_cast<float>(1.0 - largest * largest / freeArea);
+    }
+    return stats;
+}
+
+glm::vec4 ShadowAtlas::getUVTransform(const ShadowAtlasTile& tile) const {
+    const float inverseSize = 1.0f / static_cast<float>(m_atlasSize);
+    return glm::vec4(tile.size * inverseSize, tile.size * inverseSize, tile.x * inverseSize, tile.y * inverseSize);
+}
+
+} // namespace ElementalRenderer
@@ -0,0 +1,195 @@
+/**
+ * @file ShadowCasterCache.cpp
+ * @brief Implementation of the static shadow caster cache
+ */
+
+#include "Shadows/ShadowCasterCache.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ElementalRenderer {
+
+ShadowCasterCache::ShadowCasterCache()
+    : m_matrixEpsilon(1e-6f) {
+}
+
+bool ShadowCasterCache::overlapsView(const BoundingBox& bounds, const glm::mat4& lightSpaceMatrix) {
+    if (bounds.isEmpty()) {
+        return false;
+    }
+    glm::vec4 corners[8];
+    for (int i = 0; i < 8; ++i) {
+        corners[i] = lightSpaceMatrix * glm::vec4(bounds.getCorner(i), 1.0f);
+    }
+    // Outside if all corners are beyond the same clip plane (-w <= x, y, z <= w)
+    for (int axis = 0; axis < 3; ++axis) {
+        for (float side : {-1.0f, 1.0f}) {
+            bool allOutside = true;
+            for (const glm::vec4& c : corners) {
+                if (side * c[axis] <= c.w) {
+                    allOutside = false;
+                    break;
+                }
+            }
+            if (allOutside) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool ShadowCasterCache::matricesMatch(const glm::mat4& a, const glm::mat4& b) const {
+    for (int c = 0; c < 4; ++c) {
+        for (int r = 0; r < 4; ++r) {
+            if (std::abs(a[c][r] - b[c][r]) > m_matrixEpsilon) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void ShadowCasterCache::invalidateOverlapping(const BoundingBox& bounds) {
+    for (auto& entry : m_views) {
+        View& view = entry.second;
+        if (view.valid && overlapsView(bounds, view.lightSpaceMatrix)) {
+            view.valid = false;
+        }
+    }
+}
+
+void ShadowCasterCache::setCaster(size_t meshIndex, const BoundingBox& worldBounds, bool isStatic) {
+    if (meshIndex >= m_casters.size()) {
+        m_casters.resize(meshIndex + 1);
+    }
+    Caster& caster = m_casters[meshIndex];
+
+    // Static layers that held the old or will hold the new footprint go stale
+    if (caster.registered && caster.isStatic) {
+        invalidateOverlapping(caster.bounds);
+    }
+    if (isStatic) {
+        invalidateOverlapping(worldBounds);
+    }
+
+    caster.bounds = worldBounds;
+    caster.isStatic = isStatic;
+    caster.registered = true;
+}
+
+void ShadowCasterCache::removeCaster(size_t meshIndex) {
+    if (meshIndex >= m_casters.size() || !m_casters[meshIndex].registered) {
+        return;
+    }
+    if (m_casters[meshIndex].isStatic) {
+        invalidateOverlapping(m_casters[meshIndex].bounds);
+    }
+    m_casters[meshIndex] = Caster();
+}
+
+ShadowViewPlan ShadowCasterCache::prepareView(size_t lightIndex, int viewIndex, const glm::mat4& lightSpaceMatrix) {
+    ShadowViewPlan plan;
+    View& view = m_views[ViewKey(lightIndex, viewIndex)];
+    ++m_stats.viewsPrepared;
+
+    if (!view.valid || !matricesMatch(view.lightSpaceMatrix, lightSpaceMatrix)) {
+        // Re-cull the static set only when the cached layer is rebuilt
+        view.lightSpaceMatrix = lightSpaceMatrix;
+        view.staticCasters.clear();
+        for (size_t i = 0; i < m_casters.size(); ++i) {
+            const Caster& caster = m_casters[i];
+            if (caster.registered && caster.isStatic && overlapsView(caster.bounds, lightSpaceMatrix)) {
+                view.staticCasters.push_back(i);
+            }
+        }
+        view.valid = true;
+        plan.redrawStatic = true;
+        plan.staticCasters = view.staticCasters;
+        ++m_stats.staticRedraws;
+        m_stats.staticCastersDrawn += static_cast<int>(view.staticCasters.size());
+    } else {
+        m_stats.staticCastersSkipped += static_cast<int>(view.staticCasters.size());
+    }
+
+    for (size_t i = 0; i < m_casters.size(); ++i) {
+        const Caster& caster = m_casters[i];
+        if (caster.registered && !caster.isStatic && overlapsView(caster.bounds, lightSpaceMatrix)) {
+            plan.dynamicCasters.push_back(i);
+        }
+    }
+    return plan;
+}
+
+void ShadowCasterCache::invalidateLight(size_t lightIndex) {
+    for (auto& entry : m_views) {
+        if (entry.first.first == lightIndex) {
+            entry.second.valid = false;
+        }
+    }
+}
+
+void ShadowCasterCache::invalidateAll() {
+    for (auto& entry : m_views) {
+        entry.second.valid = false;
+    }
+}
+
+void ShadowCasterCache::onSceneChange(const SceneChange& change) {
+    switch (change.type) {
+        case SceneChangeType::MESH_ADDED:
+            // Nothing to do until its bounds arrive through setCaster()
+            break;
+
+        case SceneChangeType::MESH_CHANGED:
+            // The new bounds come through setCaster(); drop layers holding the old ones
+            if (change.index < m_casters.size() && m_casters[change.index].registered
+                && m_casters[change.index].isStatic) {
+                invalidateOverlapping(m_casters[change.index].bounds);
+            }
+            break;
+
+        case SceneChangeType::MESH_REMOVED: {
+            removeCaster(change.index);
+            if (change.index < m_casters.size()) {
+                m_casters.erase(m_casters.begin() + static_cast<std::ptrdiff_t>(change.index));
+            }
+            // Cached lists hold indices, so shift the ones past the removed mesh
+            for (auto& entry : m_views) {
+                for (size_t& index : entry.second.staticCasters) {
+                    if (index > change.index) {
+                        --index;
+                    }
+                }
+            }
+            break;
+        }
+
+        case SceneChangeType::LIGHT_ADDED:
+            break;
+
+        case SceneChangeType::LIGHT_CHANGED:
+            invalidateLight(change.index);
+            break;
+
+        case SceneChangeType::LIGHT_REMOVED: {
+            std::map<ViewKey, View> shifted;
+            for (auto& entry : m_views) {
+                const size_t light = entry.first.first;
+                if (light == change.index) {
+                    continue;
+                }
+                shifted[ViewKey(light > change.index ? light - 1 : light, entry.first.second)] = std::move(entry.second);
+            }
+            m_views.swap(shifted);
+            break;
+        }
+
+        case SceneChangeType::CLEARED:
+            m_casters.clear();
+            m_views.clear();
+            break;
+    }
+}
+
+} // namespace ElementalRenderer
@@ -0,0 +1,157 @@
+/**
+ * @file AmbientOcclusionBaker_test.cpp
+ * @brief Tests for ray packets and the per-vertex ambient occlusion baker
+ */
+
+#include "doctest/doctest.h"
+#include "PathTracing/AmbientOcclusionBaker.h"
+#include "PathTracing/TriangleBVH.h"
+#include "Headless/Parallel.h"
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <random>
+
+using namespace ElementalRenderer;
+
+namespace {
+
+struct TestMesh {
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> normals;
+    std::vector<unsigned int> indices;
+
+    void addQuad(const glm::vec3& corner, const glm::vec3& edgeA, const glm::vec3& edgeB) {
+        const unsigned int base = static_cast<unsigned int>(positions.size());
+        const glm::vec3 normal = glm::normalize(glm::cross(edgeA, edgeB));
+        for (const glm::vec3& position : {corner, corner + edgeA, corner + edgeA + edgeB, corner + edgeB}) {
+            positions.push_back(position);
+            normals.push_back(normal);
+        }
+        for (unsigned int index : {0u, 1u, 2u, 0u, 2u, 3u}) {
+            indices.push_back(base + index);
+        }
+    }
+
+    // Single upward-facing vertex to measure occlusion at, as a degenerate triangle
+    unsigned int addProbe(const glm::vec3& position) {
+        const unsigned int index = static_cast<unsigned int>(positions.size());
+        positions.push_back(position);
+        normals.push_back(glm::vec3(0.0f, 1.0f, 0.0f));
+        indices.insert(indices.end(), {index, index, index});
+        return index;
+    }
+};
+
+float visibility(const BakedAmbientOcclusion& baked, unsigned int vertex) {
+    return baked.occlusion[vertex] / 255.0f;
+}
+
+} // namespace
+
+TEST_CASE("Ray packets agree with single-ray occlusion queries") {
+    std::mt19937 random(11);
+    std::uniform_real_distribution<float> coordinate(-5.0f, 5.0f);
+    std::uniform_real_distribution<float> offset(-1.0f, 1.0f);
+    std::vector<glm::vec3> positions;
+    std::vector<unsigned int> indices;
+    for (unsigned int i = 0; i < 500; ++i) {
+        const glm::vec3 center(coordinate(random), coordinate(random), coordinate(random));
+        for (int corner = 0; corner < 3; ++corner) {
+            positions.push_back(center + glm::vec3(offset(random), offset(random), offset(random)));
+            indices.push_back(3 * i + corner);
+        }
+    }
+    TriangleBVH bvh;
+    bvh.build(positions, indices);
+
+    int occludedCount = 0;
+    for (int packetIndex = 0; packetIndex < 300; ++packetIndex) {
+        // Shared origin as in ambient occlusion, plus one unrelated ray
+        const glm::vec3 origin(coordinate(random), coordinate(random), coordinate(random));
+        Ray rays[4];
+        for (int lane = 0; lane < 4; ++lane) {
+            rays[lane].origin = lane == 3 ? glm::vec3(coordinate(random), coordinate(random), coordinate(random)) : origin;
+            rays[lane].direction = glm::vec3(offset(random), offset(random), offset(random));
+            rays[lane].tMax = 2.0f + 4.0f * (offset(random) + 1.0f);
+        }
+        const int mask = bvh.occludedPacket(rays);
+        for (int lane = 0; lane < 4; ++lane) {
+            CHECK(((mask >> lane) & 1) == (bvh.occluded(rays[lane]) ? 1 : 0));
+            occludedCount += (mask >> lane) & 1;
+        }
+    }
+    CHECK(occludedCount > 100);
+    CHECK(occludedCount < 1100);
+}
+
+TEST_CASE("Baked ambient occlusion matches analytic visibility") {
+    TestMesh mesh;
+    mesh.addQuad(glm::vec3(-10.0f, 0.0f, -10.0f), glm::vec3(0.0f, 0.0f, 20.0f), glm::vec3(20.0f, 0.0f, 0.0f));
+    // Tall wall along x = 0 over the left half of the floor
+    mesh.addQuad(glm::vec3(0.0f, 0.0f, -10.0f), glm::vec3(0.0f, 20.0f, 0.0f), glm::vec3(0.0f, 0.0f, 20.0f));
+    const unsigned int open = mesh.addProbe(glm::vec3(200.0f, 0.0f, 0.0f));
+    const unsigned int besideWall = mesh.addProbe(glm::vec3(0.001f, 0.0f, 0.0f));
+    // Under a 10 x 10 ceiling at height 2
+    mesh.addQuad(glm::vec3(-30.0f, 2.0f, -5.0f), glm::vec3(10.0f, 0.0f, 0.0f), glm::vec3(0.0f, 0.0f, 10.0f));
+    const unsigned int underCeiling = mesh.addProbe(glm::vec3(-25.0f, 0.0f, 0.0f));
+
+    AmbientOcclusionSettings settings;
+    settings.rayCount = 1024;
+    settings.maxDistance = 100.0f;
+    const BakedAmbientOcclusion baked = AmbientOcclusionBaker::bake(mesh.positions, mesh.normals, mesh.indices, settings);
+    REQUIRE(baked.occlusion.size() == mesh.positions.size());
+    CHECK_FALSE(baked.loadedFromCache);
+    CHECK(baked.occlusion[open] == 255);
+    // A wall blocks exactly the cosine-weighted half of the hemisphere on its side
+    CHECK(visibility(baked, besideWall) == doctest::Approx(0.5f).epsilon(0.04));
+    // Light escapes around the ceiling: one minus its form factor, four
+    // quarters of a rectangle seen from below a corner
+    const float x = 5.0f / 2.0f;
+    const float root = std::sqrt(1.0f + x * x);
+    const float formFactor = 4.0f * (2.0f * x / root * std::atan(x / root)) / (2.0f * 3.14159265f);
+    CHECK(visibility(baked, underCeiling) == doctest::Approx(1.0f - formFactor).epsilon(0.1));
+
+    // Occluders beyond the maximum distance are ignored
+    settings.maxDistance = 1.5f;
+    CHECK(AmbientOcclusionBaker::bake(mesh.positions, mesh.normals, mesh.indices, settings).occlusion[underCeiling] == 255);
+}
+
+TEST_CASE("Ambient occlusion bakes are deterministic and cached") {
+    TestMesh mesh;
+    mesh.addQuad(glm::vec3(-1.0f, 0.0f, -1.0f), glm::vec3(0.0f, 0.0f, 2.0f), glm::vec3(2.0f, 0.0f, 0.0f));
+    mesh.addQuad(glm::vec3(-1.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f), glm::vec3(0.0f, 0.0f, 2.0f));
+    mesh.addQuad(glm::vec3(-1.0f, 0.0f, -1.0f), glm::vec3(2.0f, 0.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    for (int i = 0; i < 200; ++i) {
+        mesh.addProbe(glm::vec3(-0.99f + 0.0099f * i, 0.0f, -0.5f + 0.005f * i));
+    }
+    // Zero normals fall back to face normals
+    std::fill(mesh.normals.begin(), mesh.normals.begin() + 4, glm::vec3(0.0f));
+
+    AmbientOcclusionSettings settings;
+    settings.rayCount = 30;
+    settings.maxDistance = 4.0f;
+    const BakedAmbientOcclusion first = AmbientOcclusionBaker::bake(mesh.positions, mesh.normals, mesh.indices, settings);
+    const unsigned int threads = Parallel::getThreadCount();
+    Parallel::setThreadCount(1);
+    const BakedAmbientOcclusion singleThreaded = AmbientOcclusionBaker::bake(mesh.positions, mesh.normals, mesh.indices, settings);
+    Parallel::setThreadCount(threads);
+    CHECK(first.occlusion == singleThreaded.occlusion);
+    CHECK(first.occlusion[2] < 255);
+    CHECK(first.occlusion[12] < first.occlusion[2]);
+    CHECK(first.hash == singleThreaded.hash);
+
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "elemental_ao_cache_test";
+    std::filesystem::remove_all(directory);
+    const BakedAmbientOcclusion stored = AmbientOcclusionBaker::bake(mesh.positions, mesh.normals, mesh.indices, settings, directory.string());
+    CHECK_FALSE(stored.loadedFromCache);
+    const BakedAmbientOcclusion loaded = AmbientOcclusionBaker::bake(mesh.positions, mesh.normals, mesh.indices, settings, directory.string());
+    CHECK(loaded.loadedFromCache);
+    CHECK(loaded.occlusion == first.occlusion);
+
+    settings.seed = 2;
+    const BakedAmbientOcclusion reseeded = AmbientOcclusionBaker::bake(mesh.positions, mesh.normals, mesh.indices, settings, directory.string());
+    CHECK_FALSE(reseeded.loadedFromCache);
+    CHECK(reseeded.hash != first.hash);
+    std::filesystem::remove_all(directory);
+}
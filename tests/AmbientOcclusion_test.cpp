@@ -0,0 +1,146 @@
+/**
+ * @file AmbientOcclusion_test.cpp
+ * @brief Tests for the CPU screen-space ambient occlusion
+ */
+
+#include "doctest/doctest.h"
+#include "Headless/AmbientOcclusion.h"
+#include "Headless/Parallel.h"
+#include <cmath>
+#include <glm/gtc/matrix_transform.hpp>
+
+using namespace ElementalRenderer;
+
+namespace {
+
+// Ray-casts a wall at z = -wallDistance and a floor at y = -2, which meet in a
+// concave crease that should be occluded while open areas are not
+GBuffer makeCorner(int width, int height, float wallDistance = 10.0f) {
+    GBuffer gbuffer(width, height);
+    gbuffer.setProjection(glm::perspective(glm::radians(60.0f), static_cast<float>(width) / height, 0.1f, 100.0f));
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            // View ray with unit depth step
+            glm::vec3 ray = gbuffer.getViewPosition(x + 0.5f, y + 0.5f, 1.0f);
+            float depth = wallDistance;
+            glm::vec3 normal(0.0f, 0.0f, 1.0f);
+            if (ray.y * wallDistance < -2.0f) {
+                depth = -2.0f / ray.y;
+                normal = glm::vec3(0.0f, 1.0f, 0.0f);
+            }
+            gbuffer.set(x, y, normal, depth);
+        }
+    }
+    return gbuffer;
+}
+
+float rowAverage(const std::vector<float>& values, int width, int y, int x0, int x1) {
+    float sum = 0.0f;
+    for (int x = x0; x < x1; ++x) {
+        sum += values[static_cast<size_t>(y) * width + x];
+    }
+    return sum / static_cast<float>(x1 - x0);
+}
+
+// Row of the crease: floor hits at depth just short of the wall
+int creaseRow(const GBuffer& gbuffer) {
+    for (int y = gbuffer.getHeight() - 1; y >= 0; --y) {
+        if (gbuffer.getNormal(0, y).y > 0.5f) {
+            return y;
+        }
+    }
+    return 0;
+}
+
+} // namespace
+
+TEST_CASE("G-buffer positions round-trip through the projection") {
+    GBuffer gbuffer(64, 48);
+    gbuffer.setProjection(glm::perspective(glm::radians(50.0f), 64.0f / 48.0f, 0.1f, 100.0f));
+    glm::vec3 p = gbuffer.getViewPosition(10.5f, 30.5f, 7.0f);
+    CHECK(p.z == doctest::Approx(-7.0f));
+    glm::vec2 pixel = gbuffer.projectToPixel(p);
+    CHECK(pixel.x == doctest::Approx(10.5f));
+    CHECK(pixel.y == doctest::Approx(30.5f));
+}
+
+TEST_CASE("Both modes darken a concave crease and leave open surfaces lit") {
+    const int width = 96, height = 72;
+    GBuffer gbuffer = makeCorner(width, height);
+    const int crease = creaseRow(gbuffer);
+    REQUIRE(crease > 8);
+    REQUIRE(crease < height - 8);
+
+    for (AmbientOcclusionMode mode : {AmbientOcclusionMode::HEMISPHERE, AmbientOcclusionMode::HORIZON}) {
+        AmbientOcclusionSettings settings;
+        settings.mode = mode;
+        settings.radius = 1.0f;
+        settings.downsample = 1;
+        std::vector<float> visibility;
+        AmbientOcclusion::compute(gbuffer, settings, visibility);
+
+        const float atCrease = rowAverage(visibility, width, crease, 8, width - 8);
+        const float openWall = rowAverage(visibility, width, height - 4, 8, width - 8);
+        const float openFloor = rowAverage(visibility, width, 2, 8, width - 8);
+        CHECK(atCrease < openWall - 0.1f);
+        CHECK(atCrease < openFloor - 0.1f);
+        CHECK(openWall > 0.95f);
+        CHECK(openFloor > 0.95f);
+        for (float v : visibility) {
+            CHECK((v >= 0.0f && v <= 1.0f));
+        }
+    }
+}
+
+TEST_CASE("Downsampled occlusion is upsampled close to full resolution") {
+    const int width = 128, height = 96;
+    GBuffer gbuffer = makeCorner(width, height);
+    AmbientOcclusionSettings settings;
+    settings.radius = 1.0f;
+
+    settings.downsample = 1;
+    std::vector<float> full;
+    AmbientOcclusion::compute(gbuffer, settings, full);
+
+    settings.downsample = 2;
+    std::vector<float> half;
+    AmbientOcclusion::compute(gbuffer, settings, half);
+
+    REQUIRE(half.size() == full.size());
+    float error = 0.0f;
+    for (size_t i = 0; i < full.size(); ++i) {
+        error += std::abs(full[i] - half[i]);
+    }
+    CHECK(error / static_cast<float>(full.size()) < 0.03f);
+
+    // Background stays unoccluded
+    GBuffer empty(16, 16);
+    AmbientOcclusion::compute(empty, settings, half);
+    CHECK(half[5 * 16 + 5] == 1.0f);
+}
+
+TEST_CASE("Occlusion does not depend on the thread count and matches the GPU kernel") {
+    GBuffer gbuffer = makeCorner(80, 60);
+    AmbientOcclusionSettings settings;
+    settings.mode = AmbientOcclusionMode::HEMISPHERE;
+    settings.tileSize = 16;
+
+    const unsigned int threads = Parallel::getThreadCount();
+    Parallel::setThreadCount(1);
+    std::vector<float> serial;
+    AmbientOcclusion::compute(gbuffer, settings, serial);
+    Parallel::setThreadCount(4);
+    std::vector<float> parallel;
+    AmbientOcclusion::compute(gbuffer, settings, parallel);
+    Parallel::setThreadCount(threads);
+    CHECK(serial == parallel);
+
+    std::vector<glm::vec3> kernel = AmbientOcclusion::generateSampleKernel(64);
+    REQUIRE(kernel.size() == 64);
+    for (const glm::vec3& k : kernel) {
+        CHECK(k.z >= 0.0f);
+        CHECK(glm::length(k) <= 1.0f);
+    }
+    CHECK(glm::length(kernel[0]) <= 0.1f);
+    CHECK(kernel == AmbientOcclusion::generateSampleKernel(64));
+}
@@ -0,0 +1,204 @@
+/**
+ * @file BRDF_test.cpp
+ * @brief Tests for the batched CPU lighting models against the GLSL formulas
+ */
+
+#include "doctest/doctest.h"
+#include "Headless/BRDF.h"
+#include "Headless/SIMD.h"
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace ElementalRenderer;
+
+namespace {
+
+const float PI = 3.14159265359f;
+
+// Straight transliterations of MainFragmentShader.glsl
+
+glm::vec3 glslPhong(glm::vec3 normal, glm::vec3 lightDir, glm::vec3 viewDir, glm::vec3 albedo, float specularPower, bool blinn) {
+    float NdotL = std::max(glm::dot(normal, lightDir), 0.0f);
+    if (NdotL < 0.001f) return glm::vec3(0.0f);
+    glm::vec3 diffuse = albedo * NdotL;
+    float cosine;
+    if (blinn) {
+        cosine = std::max(glm::dot(normal, glm::normalize(lightDir + viewDir)), 0.0f);
+    } else {
+        cosine = std::max(glm::dot(viewDir, glm::reflect(-lightDir, normal)), 0.0f);
+    }
+    return diffuse + glm::vec3(0.3f) * std::pow(cosine, specularPower);
+}
+
+glm::vec3 glslOrenNayar(glm::vec3 normal, glm::vec3 lightDir, glm::vec3 viewDir, glm::vec3 albedo, float roughness) {
+    float NdotL = std::max(glm::dot(normal, lightDir), 0.0f);
+    float NdotV = std::max(glm::dot(normal, viewDir), 0.0f);
+    if (NdotL < 0.001f) return glm::vec3(0.0f);
+    float angleVL = std::max(0.0f, glm::dot(viewDir, lightDir));
+    float thetaI = std::acos(NdotL);
+    float thetaR = std::acos(NdotV);
+    float sigma2 = roughness * roughness;
+    float A = 1.0f - (0.5f * sigma2 / (sigma2 + 0.33f));
+    float B = 0.45f * sigma2 / (sigma2 + 0.09f);
+    float alpha = std::max(thetaI, thetaR);
+    float beta = std::min(thetaI, thetaR);
+    float C = std::sin(alpha) * std::tan(beta);
+    return albedo * (NdotL * (A + B * std::max(0.0f, angleVL) * C));
+}
+
+glm::vec3 glslCookTorrance(glm::vec3 normal, glm::vec3 lightDir, glm::vec3 viewDir, glm::vec3 albedo,
+                           float roughness, float metallic, float F0, int distribution) {
+    glm::vec3 halfwayDir = glm::normalize(lightDir + viewDir);
+    float NdotL = std::max(glm::dot(normal, lightDir), 0.0f);
+    float NdotV = std::max(glm::dot(normal, viewDir), 0.0f);
+    float NdotH = std::max(glm::dot(normal, halfwayDir), 0.0f);
+    float VdotH = std::max(glm::dot(viewDir, halfwayDir), 0.0f);
+    if (NdotL < 0.001f) return glm::vec3(0.0f);
+    float alpha = roughness * roughness;
+    float D;
+    if (distribution == 0) {
+        float alpha2 = alpha * alpha;
+        float NdotH2 = NdotH * NdotH;
+        D = std::exp((NdotH2 - 1.0f) / (alpha2 * NdotH2)) / (PI * alpha2 * NdotH2 * NdotH2);
+    } else if (distribution == 1) {
+        float alpha2 = alpha * alpha;
+        float denom = NdotH * NdotH * (alpha2 - 1.0f) + 1.0f;
+        D = alpha2 / (PI * denom * denom);
+    } else {
+        float normalization = (2.0f + 2.0f / alpha) / (2.0f * PI);
+        float power = 2.0f / (alpha * alpha) - 2.0f;
+        D = normalization * std::pow(NdotH, power);
+    }
+    float G1_v = 2.0f * NdotV / (NdotV + std::sqrt(alpha + (1.0f - alpha) * NdotV * NdotV));
+    float G1_l = 2.0f * NdotL / (NdotL + std::sqrt(alpha + (1.0f - alpha) * NdotL * NdotL));
+    float F = F0 + (1.0f - F0) * std::pow(1.0f - VdotH, 5.0f);
+    float specular = (D * G1_v * G1_l * F) / (4.0f * NdotV * NdotL);
+    float diffuse = (1.0f - F) * (1.0f - metallic) * NdotL / PI;
+    return albedo * (diffuse + specular * NdotL);
+}
+
+glm::vec3 glslPBR(glm::vec3 normal, glm::vec3 lightDir, glm::vec3 viewDir, glm::vec3 albedo,
+                  float roughness, float metallic, float ao) {
+    glm::vec3 H = glm::normalize(viewDir + lightDir);
+    float NdotL = std::max(glm::dot(normal, lightDir), 0.001f);
+    float NdotV = std::max(glm::dot(normal, viewDir), 0.001f);
+    float NdotH = std::max(glm::dot(normal, H), 0.0f);
+    float HdotV = std::max(glm::dot(H, viewDir), 0.0f);
+    glm::vec3 F0 = glm::mix(glm::vec3(0.04f), albedo, metallic);
+    glm::vec3 F = F0 + (glm::vec3(1.0f) - F0) * std::pow(1.0f - HdotV, 5.0f);
+    float alpha = roughness * roughness;
+    float alpha2 = alpha * alpha;
+    float denom = NdotH * NdotH * (alpha2 - 1.0f) + 1.0f;
+    float D = alpha2 / (PI * denom * denom);
+    float k = (roughness + 1.0f) * (roughness + 1.0f) / 8.0f;
+    float G = NdotV / (NdotV * (1.0f - k) + k) * (NdotL / (NdotL * (1.0f - k) + k));
+    glm::vec3 specular = (D * F * G) / (4.0f * NdotV * NdotL);
+    glm::vec3 diffuse = (glm::vec3(1.0f) - F) * (1.0f - metallic) * albedo / PI;
+    return (diffuse + specular) * NdotL * ao;
+}
+
+glm::vec3 randomDirection(std::mt19937& rng) {
+    std::normal_distribution<float> gaussian(0.0f, 1.0f);
+    return glm::normalize(glm::vec3(gaussian(rng), gaussian(rng), gaussian(rng)));
+}
+
+bool close(const glm::vec3& a, const glm::vec3& b) {
+    for (int c = 0; c < 3; ++c) {
+        if (std::abs(a[c] - b[c]) > 1e-4f + 2e-4f * std::abs(b[c])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("SIMD exp, log and pow track the standard library") {
+    for (float x = -20.0f; x < 20.0f; x += 0.37f) {
+        CHECK(SIMD::exp(SIMD::Float4::splat(x)).lane(0) == doctest::Approx(std::exp(x)).epsilon(1e-6));
+    }
+    for (float x = 1e-6f; x < 1e6f; x *= 3.7f) {
+        CHECK(SIMD::log(SIMD::Float4::splat(x)).lane(0) == doctest::Approx(std::log(x)).epsilon(1e-6));
+    }
+    const SIMD::Float4 p = SIMD::pow(SIMD::Float4::set(0.5f, 0.0f, 2.0f, 0.9f), SIMD::Float4::set(32.0f, 5.0f, 0.5f, 150.0f));
+    CHECK(p.lane(0) == doctest::Approx(std::pow(0.5f, 32.0f)).epsilon(1e-5));
+    CHECK(p.lane(1) == 0.0f);
+    CHECK(p.lane(2) == doctest::Approx(std::sqrt(2.0f)).epsilon(1e-5));
+    CHECK(p.lane(3) == doctest::Approx(std::pow(0.9f, 150.0f)).epsilon(1e-5));
+}
+
+TEST_CASE("Every lighting model matches its shader function") {
+    std::mt19937 rng(11);
+    const size_t count = 203; // not a multiple of the lane count
+    std::vector<glm::vec3> normals(count), lights(count), views(count), result(count);
+    for (size_t i = 0; i < count; ++i) {
+        normals[i] = randomDirection(rng);
+        lights[i] = randomDirection(rng);
+        views[i] = randomDirection(rng);
+        // Keep most samples in front of the surface so the interesting branches run
+        if (glm::dot(views[i], normals[i]) < 0.05f) views[i] = glm::normalize(views[i] + normals[i] * 1.5f);
+        if (i % 5 != 0 && glm::dot(lights[i], normals[i]) < 0.05f) lights[i] = glm::normalize(lights[i] + normals[i] * 1.5f);
+    }
+
+    BRDFMaterial material;
+    material.albedo = glm::vec3(0.8f, 0.5f, 0.2f);
+    material.roughness = 0.45f;
+    material.metallic = 0.3f;
+    material.fresnel = 0.08f;
+    material.ao = 0.9f;
+
+    BRDF::evaluate(BRDFModel::PHONG, material, normals.data(), lights.data(), views.data(), count, result.data());
+    for (size_t i = 0; i < count; ++i) {
+        CHECK(close(result[i], glslPhong(normals[i], lights[i], views[i], material.albedo, 32.0f, false)));
+    }
+    BRDF::evaluate(BRDFModel::BLINN_PHONG, material, normals.data(), lights.data(), views.data(), count, result.data());
+    for (size_t i = 0; i < count; ++i) {
+        CHECK(close(result[i], glslPhong(normals[i], lights[i], views[i], material.albedo, 32.0f, true)));
+    }
+    BRDF::evaluate(BRDFModel::OREN_NAYAR, material, normals.data(), lights.data(), views.data(), count, result.data());
+    for (size_t i = 0; i < count; ++i) {
+        CHECK(close(result[i], glslOrenNayar(normals[i], lights[i], views[i], material.albedo, material.roughness)));
+    }
+    for (int distribution = 0; distribution < 3; ++distribution) {
+        material.distribution = static_cast<MicrofacetDistribution>(distribution);
+        BRDF::evaluate(BRDFModel::COOK_TORRANCE, material, normals.data(), lights.data(), views.data(), count, result.data());
+        for (size_t i = 0; i < count; ++i) {
+            CHECK(close(result[i], glslCookTorrance(normals[i], lights[i], views[i], material.albedo,
+                                                    material.roughness, material.metallic, material.fresnel, distribution)));
+        }
+    }
+    material.distribution = MicrofacetDistribution::BECKMANN; // GGX ignores it
+    BRDF::evaluate(BRDFModel::GGX, material, normals.data(), lights.data(), views.data(), count, result.data());
+    for (size_t i = 0; i < count; ++i) {
+        CHECK(close(result[i], glslCookTorrance(normals[i], lights[i], views[i], material.albedo,
+                                                material.roughness, material.metallic, material.fresnel, 1)));
+    }
+    BRDF::evaluate(BRDFModel::PHYSICALLY_BASED, material, normals.data(), lights.data(), views.data(), count, result.data());
+    for (size_t i = 0; i < count; ++i) {
+        CHECK(close(result[i], glslPBR(normals[i], lights[i], views[i], material.albedo,
+                                       material.roughness, material.metallic, material.ao)));
+    }
+}
+
+TEST_CASE("Custom BRDFs default to Lambert and accept a CPU callback") {
+    BRDFMaterial material;
+    material.albedo = glm::vec3(0.5f);
+    const glm::vec3 n(0.0f, 1.0f, 0.0f);
+    const glm::vec3 l = glm::normalize(glm::vec3(1.0f, 1.0f, 0.0f));
+    const glm::vec3 v(0.0f, 1.0f, 0.0f);
+
+    const glm::vec3 lambert = BRDF::evaluate(BRDFModel::CUSTOM, material, n, l, v);
+    CHECK(lambert.x == doctest::Approx(0.5f * std::sqrt(0.5f) / PI));
+
+    material.customParams = glm::vec4(2.0f, 0.0f, 0.0f, 0.0f);
+    material.custom = [](const glm::vec3& normal, const glm::vec3& lightDir, const glm::vec3&,
+                         const glm::vec3& albedo, const glm::vec4& params) {
+        return albedo * params.x * std::max(glm::dot(normal, lightDir), 0.0f);
+    };
+    const glm::vec3 custom = BRDF::evaluate(BRDFModel::CUSTOM, material, n, l, v);
+    CHECK(custom.y == doctest::Approx(std::sqrt(0.5f)));
+
+    // Light below the horizon: the shader early-outs to black
+    CHECK(BRDF::evaluate(BRDFModel::GGX, material, n, -l, v).x == 0.0f);
+}
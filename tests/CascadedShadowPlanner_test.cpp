@@ -0,0 +1,149 @@
+/**
+ * @file CascadedShadowPlanner_test.cpp
+ * @brief Tests for the cascaded shadow map planner
+ */
+
+#include "doctest/doctest.h"
+#include "Shadows/CascadedShadowPlanner.h"
+#include <cmath>
+#include <glm/gtc/matrix_transform.hpp>
+
+using namespace ElementalRenderer;
+
+namespace {
+
+const glm::vec3 kLightDirection(-0.5f, -1.0f, -0.3f);
+
+glm::mat4 cameraProjection() {
+    return glm::perspective(glm::radians(45.0f), 16.0f / 9.0f, 0.1f, 100.0f);
+}
+
+// Left edge of the light window encoded in an orthographic projection
+float windowLeft(const glm::mat4& projection) {
+    return (-1.0f - projection[3][0]) / projection[0][0];
+}
+
+float windowBottom(const glm::mat4& projection) {
+    return (-1.0f - projection[3][1]) / projection[1][1];
+}
+
+} // namespace
+
+TEST_CASE("Practical splits blend uniform and logarithmic distributions") {
+    std::vector<float> uniform = CascadedShadowPlanner::computeSplits(1.0f, 101.0f, 4, 0.0f);
+    REQUIRE(uniform.size() == 5);
+    CHECK(uniform[1] == doctest::Approx(26.0f));
+    CHECK(uniform[2] == doctest::Approx(51.0f));
+
+    std::vector<float> logarithmic = CascadedShadowPlanner::computeSplits(1.0f, 10000.0f, 4, 1.0f);
+    CHECK(logarithmic[1] == doctest::Approx(10.0f));
+    CHECK(logarithmic[3] == doctest::Approx(1000.0f));
+
+    std::vector<float> practical = CascadedShadowPlanner::computeSplits(0.1f, 100.0f, 4, 0.75f);
+    CHECK(practical.front() == doctest::Approx(0.1f));
+    CHECK(practical.back() == doctest::Approx(100.0f));
+    for (size_t i = 1; i < practical.size(); ++i) {
+        CHECK(practical[i] > practical[i - 1]);
+    }
+
+    float nearPlane, farPlane;
+    CascadedShadowPlanner::getClipPlanes(cameraProjection(), nearPlane, farPlane);
+    CHECK(nearPlane == doctest::Approx(0.1f));
+    CHECK(farPlane == doctest::Approx(100.0f));
+    CascadedShadowPlanner::getClipPlanes(glm::ortho(-1.0f, 1.0f, -1.0f, 1.0f, 2.0f, 30.0f), nearPlane, farPlane);
+    CHECK(nearPlane == doctest::Approx(2.0f));
+    CHECK(farPlane == doctest::Approx(30.0f));
+}
+
+TEST_CASE("Every cascade encloses its frustum slice") {
+    const glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 3.0f, 8.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    const BoundingBox scene(glm::vec3(-60.0f, -1.0f, -100.0f), glm::vec3(60.0f, 10.0f, 20.0f));
+
+    for (bool stabilize : {true, false}) {
+        CascadeSettings settings;
+        settings.stabilize = stabilize;
+        settings.maxShadowDistance = 50.0f;
+        std::vector<ShadowCascade> cascades =
+            CascadedShadowPlanner::plan(view, cameraProjection(), kLightDirection, scene, {}, settings);
+        REQUIRE(cascades.size() == 4);
+        CHECK(cascades.back().splitFar == doctest::Approx(50.0f));
+
+        for (const ShadowCascade& cascade : cascades) {
+            std::array<glm::vec3, 8> corners = CascadedShadowPlanner::getFrustumSliceCorners(
+                view, cameraProjection(), cascade.splitNear, cascade.splitFar);
+            for (int i = 0; i < 8; ++i) {
+                // Slice corners sit at the requested view depths
+                float depth = -(view * glm::vec4(corners[i], 1.0f)).z;
+                CHECK(depth == doctest::Approx(i < 4 ? cascade.splitNear : cascade.splitFar).epsilon(1e-3));
+
+                // Receivers inside the scene must land inside the shadow map
+                if (!scene.contains(corners[i])) {
+                    continue;
+                }
+                glm::vec4 clip = cascade.lightSpaceMatrix * glm::vec4(corners[i], 1.0f);
+                CHECK(std::abs(clip.x) <= 1.0001f);
+                CHECK(std::abs(clip.y) <= 1.0001f);
+                CHECK(std::abs(clip.z) <= 1.0001f);
+            }
+        }
+        // Nearer cascades get finer texels
+        CHECK(cascades[0].texelSize < cascades[3].texelSize);
+    }
+}
+
+TEST_CASE("Stabilized cascades keep their texel size and move in whole texels") {
+    const BoundingBox scene(glm::vec3(-100.0f), glm::vec3(100.0f));
+    CascadeSettings settings;
+    settings.maxShadowDistance = 60.0f;
+
+    const glm::mat4 viewA = glm::lookAt(glm::vec3(0.0f, 3.0f, 8.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    const glm::mat4 viewB = glm::lookAt(glm::vec3(1.37f, 3.2f, 7.11f), glm::vec3(4.0f, -1.0f, -3.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    std::vector<ShadowCascade> a = CascadedShadowPlanner::plan(viewA, cameraProjection(), kLightDirection, scene, {}, settings);
+    std::vector<ShadowCascade> b = CascadedShadowPlanner::plan(viewB, cameraProjection(), kLightDirection, scene, {}, settings);
+
+    for (size_t c = 0; c < a.size(); ++c) {
+        CHECK(a[c].texelSize == b[c].texelSize);
+        for (const ShadowCascade* cascade : {&a[c], &b[c]}) {
+            float left = windowLeft(cascade->lightProjection) / cascade->texelSize;
+            float bottom = windowBottom(cascade->lightProjection) / cascade->texelSize;
+            CHECK(std::abs(left - std::round(left)) < 0.01f);
+            CHECK(std::abs(bottom - std::round(bottom)) < 0.01f);
+        }
+    }
+}
+
+TEST_CASE("Caster lists keep occluders toward the light and drop unrelated casters") {
+    // Light straight down; camera looking down -Z from above the ground
+    const glm::vec3 down(0.0f, -1.0f, 0.0f);
+    const glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 2.0f, 0.0f), glm::vec3(0.0f, 2.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    const BoundingBox scene(glm::vec3(-200.0f, 0.0f, -200.0f), glm::vec3(200.0f, 50.0f, 200.0f));
+
+    std::vector<BoundingBox> casters = {
+        BoundingBox(glm::vec3(-1.0f, 40.0f, -6.0f), glm::vec3(1.0f, 45.0f, -4.0f)),   // high above the view, casts into it
+        BoundingBox(glm::vec3(150.0f, 0.0f, 150.0f), glm::vec3(160.0f, 5.0f, 160.0f)), // far off to the side
+        BoundingBox(glm::vec3(-0.5f, 0.0f, -3.5f), glm::vec3(0.5f, 1.0f, -2.5f)),     // in the first slice
+    };
+
+    CascadeSettings settings;
+    settings.maxShadowDistance = 40.0f;
+    std::vector<ShadowCascade> cascades =
+        CascadedShadowPlanner::plan(view, cameraProjection(), down, scene, casters, settings);
+
+    auto contains = [](const ShadowCascade& cascade, size_t index) {
+        for (size_t i : cascade.casters) {
+            if (i == index) {
+                return true;
+            }
+        }
+        return false;
+    };
+    CHECK(contains(cascades[0], 2));
+    CHECK(contains(cascades[1], 0));
+    for (const ShadowCascade& cascade : cascades) {
+        CHECK_FALSE(contains(cascade, 1));
+    }
+
+    CHECK(CascadedShadowPlanner::selectCascade(cascades, 0.5f) == 0);
+    CHECK(CascadedShadowPlanner::selectCascade(cascades, cascades[1].splitFar - 0.01f) == 1);
+    CHECK(CascadedShadowPlanner::selectCascade(cascades, 45.0f) == -1);
+}
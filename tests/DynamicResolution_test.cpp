@@ -0,0 +1,145 @@
+/**
+ * @file DynamicResolution_test.cpp
+ * @brief Tests for the dynamic resolution controller and the CPU upscaler
+ */
+
+#include "doctest/doctest.h"
+#include "DynamicResolution.h"
+#include "Headless/CPUPostProcessor.h"
+#include <cmath>
+#include <random>
+
+using namespace ElementalRenderer;
+
+namespace {
+
+// GPU whose frame time is a fixed cost plus a per-pixel cost at full resolution
+float simulatedFrameTime(float scale, float fixedCost, float pixelCost) {
+    return fixedCost + pixelCost * scale * scale;
+}
+
+} // namespace
+
+TEST_CASE("Dynamic resolution settles under the frame budget") {
+    DynamicResolutionController controller;
+    const DynamicResolutionSettings& settings = controller.getSettings();
+    CHECK(controller.getScale() == 1.0f);
+
+    // 34 ms at full resolution; the budget is met at scale sqrt(11 / 30)
+    std::mt19937 random(5);
+    std::uniform_real_distribution<float> noise(0.95f, 1.05f);
+    float scale = controller.getScale();
+    for (int frame = 0; frame < 120; ++frame) {
+        scale = controller.update(simulatedFrameTime(scale, 4.0f, 30.0f) * noise(random));
+    }
+    CHECK(controller.getTelemetry().filteredFrameTime < settings.targetFrameTime);
+    CHECK(scale == doctest::Approx(std::sqrt(11.0f / 30.0f)).epsilon(0.1));
+
+    // Noise alone does not keep changing the resolution
+    const uint64_t changes = controller.getTelemetry().scaleChanges;
+    for (int frame = 0; frame < 300; ++frame) {
+        scale = controller.update(simulatedFrameTime(scale, 4.0f, 30.0f) * noise(random));
+    }
+    CHECK(controller.getTelemetry().scaleChanges - changes < 5);
+    CHECK(controller.getTelemetry().frameCount == 420);
+
+    // A sudden load spike is answered within a few frames
+    int framesOver = 0;
+    for (int frame = 0; frame < 60; ++frame) {
+        const float frameTime = simulatedFrameTime(scale, 4.0f, 40.0f);
+        framesOver += frameTime > settings.targetFrameTime ? 1 : 0;
+        scale = controller.update(frameTime);
+    }
+    CHECK(framesOver < 8);
+    CHECK(simulatedFrameTime(scale, 4.0f, 40.0f) < settings.targetFrameTime);
+}
+
+TEST_CASE("Dynamic resolution respects its bounds and recovers from saturation") {
+    DynamicResolutionSettings settings;
+    settings.minScale = 0.5f;
+    settings.maxScale = 0.9f;
+    DynamicResolutionController controller(settings);
+    CHECK(controller.getScale() == doctest::Approx(0.9f));
+
+    // Hardware that cannot reach the budget stays at the minimum
+    for (int frame = 0; frame < 200; ++frame) {
+        controller.update(50.0f);
+    }
+    CHECK(controller.getScale() == doctest::Approx(0.5f));
+
+    // Once the load drops, the scale climbs back to the maximum without wind-up delay
+    int frames = 0;
+    while (controller.getScale() < 0.9f && frames < 100) {
+        controller.update(simulatedFrameTime(controller.getScale(), 1.0f, 4.0f));
+        ++frames;
+    }
+    CHECK(controller.getScale() == doctest::Approx(0.9f));
+    CHECK(frames < 20);
+
+    // Invalid measurements are ignored
+    const uint64_t frameCount = controller.getTelemetry().frameCount;
+    controller.update(0.0f);
+    controller.update(-1.0f);
+    CHECK(controller.getTelemetry().frameCount == frameCount);
+
+    controller.reset();
+    CHECK(controller.getTelemetry().frameCount == 0);
+    CHECK(controller.getScale() == doctest::Approx(0.9f));
+}
+
+TEST_CASE("Render sizes are aligned and clamped to the output") {
+    DynamicResolutionSettings settings;
+    settings.minScale = 0.5f;
+    settings.maxScale = 0.5f;
+    DynamicResolutionController controller(settings);
+    CHECK(controller.getRenderSize(glm::ivec2(1920, 1080)) == glm::ivec2(960, 544));
+    CHECK(controller.getRenderSize(glm::ivec2(6, 3)) == glm::ivec2(6, 3));
+
+    settings.maxScale = 1.0f;
+    settings.alignment = 16;
+    controller.setSettings(settings);
+    CHECK(controller.getRenderSize(glm::ivec2(1366, 768)) == glm::ivec2(1366, 768));
+    controller.update(100.0f);
+    CHECK(controller.getRenderSize(glm::ivec2(1366, 768)).x % 16 == 0);
+}
+
+TEST_CASE("CPU upscaling is bilinear and sharpens without ringing") {
+    // Vertical step edge from 0 to 1, with a ramp in alpha
+    Image source(8, 4);
+    for (int y = 0; y < 4; ++y) {
+        for (int x = 0; x < 8; ++x) {
+            source.at(x, y) = glm::vec4(x < 4 ? 0.0f : 1.0f, 0.5f, 0.5f, x / 7.0f);
+        }
+    }
+
+    Image bilinear;
+    CPUPostProcessor::upscale(source, 20, 10, 0.0f, bilinear);
+    REQUIRE(bilinear.getWidth() == 20);
+    REQUIRE(bilinear.getHeight() == 10);
+    for (int x = 0; x < 20; ++x) {
+        const glm::vec4 expected = source.sample(glm::vec2((x + 0.5f) / 20.0f, 0.35f));
+        CHECK(bilinear.at(x, 3).x == doctest::Approx(expected.x));
+        CHECK(bilinear.at(x, 3).w == doctest::Approx(expected.w));
+    }
+
+    Image sharpened;
+    CPUPostProcessor::upscale(source, 20, 10, 1.0f, sharpened);
+    float bilinearContrast = 0.0f;
+    float sharpenedContrast = 0.0f;
+    for (int x = 0; x < 20; ++x) {
+        const glm::vec4& texel = sharpened.at(x, 5);
+        CHECK(texel.x >= 0.0f);
+        CHECK(texel.x <= 1.0f);
+        CHECK(texel.y == doctest::Approx(0.5f));
+        CHECK(texel.w == doctest::Approx(bilinear.at(x, 5).w));
+        if (x > 0) {
+            bilinearContrast = std::max(bilinearContrast, bilinear.at(x, 5).x - bilinear.at(x - 1, 5).x);
+            sharpenedContrast = std::max(sharpenedContrast, texel.x - sharpened.at(x - 1, 5).x);
+        }
+    }
+    CHECK(sharpenedContrast > bilinearContrast);
+
+    // In place, as with the other effects
+    CPUPostProcessor::upscale(source, 16, 8, 0.5f, source);
+    CHECK(source.getWidth() == 16);
+}
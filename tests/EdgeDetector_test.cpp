@@ -0,0 +1,156 @@
+/**
+ * @file EdgeDetector_test.cpp
+ * @brief Tests for the screen-space outline extraction
+ */
+
+#include "doctest/doctest.h"
+#include "Headless/EdgeDetector.h"
+#include <cmath>
+#include <limits>
+#include <random>
+
+using namespace ElementalRenderer;
+
+namespace {
+
+// A square at depth 5 in front of a wall at depth 10, both facing the camera
+GBuffer makeBoxOnWall(int size, int x0, int x1) {
+    GBuffer gbuffer(size, size);
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            bool box = x >= x0 && x < x1 && y >= x0 && y < x1;
+            gbuffer.set(x, y, glm::vec3(0.0f, 0.0f, 1.0f), box ? 5.0f : 10.0f);
+        }
+    }
+    return gbuffer;
+}
+
+} // namespace
+
+TEST_CASE("Depth edges sit on the near side of silhouettes") {
+    GBuffer gbuffer = makeBoxOnWall(32, 10, 22);
+
+    for (EdgeOperator op : {EdgeOperator::SOBEL, EdgeOperator::ROBERTS}) {
+        EdgeSettings settings;
+        settings.edgeOperator = op;
+        std::vector<float> edges;
+        EdgeDetector::detectEdges(gbuffer, settings, edges);
+
+        int onWall = 0, inside = 0;
+        for (int y = 0; y < 32; ++y) {
+            for (int x = 0; x < 32; ++x) {
+                bool box = x >= 10 && x < 22 && y >= 10 && y < 22;
+                bool interior = x >= 12 && x < 20 && y >= 12 && y < 20;
+                float e = edges[y * 32 + x];
+                onWall += (!box && e > 0.0f) ? 1 : 0;
+                inside += (interior && e > 0.0f) ? 1 : 0;
+            }
+        }
+        CHECK(onWall == 0);
+        CHECK(inside == 0);
+        CHECK(edges[15 * 32 + 10] == 1.0f);
+        CHECK(edges[21 * 32 + 21] == 1.0f);
+    }
+}
+
+TEST_CASE("Slope-aware thresholds ignore grazing planes, normals find creases") {
+    // Floor receding at a grazing angle: depth grows quickly but smoothly
+    GBuffer floor(40, 40);
+    const glm::vec3 floorNormal = glm::normalize(glm::vec3(0.0f, 0.9f, 0.1f));
+    for (int y = 0; y < 40; ++y) {
+        for (int x = 0; x < 40; ++x) {
+            floor.set(x, y, floorNormal, 4.0f + 0.6f * y);
+        }
+    }
+    EdgeSettings settings;
+    std::vector<float> edges;
+    EdgeDetector::detectEdges(floor, settings, edges);
+    float total = 0.0f;
+    for (float e : edges) {
+        total += e;
+    }
+    CHECK(total == 0.0f);
+
+    settings.slopeScale = 0.0f;
+    EdgeDetector::detectEdges(floor, settings, edges);
+    CHECK(edges[20 * 40 + 20] == 1.0f);
+
+    // Two faces of a box meeting at a 90 degree crease at constant depth
+    GBuffer crease(20, 20);
+    for (int y = 0; y < 20; ++y) {
+        for (int x = 0; x < 20; ++x) {
+            glm::vec3 n = x < 10 ? glm::normalize(glm::vec3(-1.0f, 0.0f, 1.0f)) : glm::normalize(glm::vec3(1.0f, 0.0f, 1.0f));
+            crease.set(x, y, n, 6.0f);
+        }
+    }
+    EdgeDetector::detectEdges(crease, EdgeSettings(), edges);
+    CHECK(edges[10 * 20 + 9] == 1.0f);
+    CHECK(edges[10 * 20 + 10] == 1.0f);
+    CHECK(edges[10 * 20 + 4] == 0.0f);
+
+    // Geometry next to cleared background is always a silhouette
+    GBuffer lone(8, 8);
+    lone.set(4, 4, glm::vec3(0.0f, 0.0f, 1.0f), 3.0f);
+    EdgeDetector::detectEdges(lone, EdgeSettings(), edges);
+    CHECK(edges[4 * 8 + 4] == 1.0f);
+    CHECK(edges[4 * 8 + 5] == 0.0f);
+}
+
+TEST_CASE("Jump flood matches brute-force distances within range") {
+    const int width = 61, height = 47;
+    std::vector<float> seeds(width * height, 0.0f);
+    std::mt19937 rng(5);
+    for (int i = 0; i < 25; ++i) {
+        seeds[rng() % seeds.size()] = 1.0f;
+    }
+
+    const float maxDistance = 6.5f;
+    std::vector<float> distance;
+    EdgeDetector::jumpFlood(seeds, width, height, maxDistance, distance);
+
+    int mismatches = 0;
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            float exact = std::numeric_limits<float>::max();
+            for (int i = 0; i < width * height; ++i) {
+                if (seeds[i] > 0.5f) {
+                    float dx = static_cast<float>(i % width - x), dy = static_cast<float>(i / width - y);
+                    exact = std::min(exact, std::sqrt(dx * dx + dy * dy));
+                }
+            }
+            if (exact <= maxDistance) {
+                mismatches += std::abs(distance[y * width + x] - exact) > 1e-4f ? 1 : 0;
+            } else {
+                mismatches += distance[y * width + x] > maxDistance ? 0 : 1;
+            }
+        }
+    }
+    CHECK(mismatches == 0);
+
+    CHECK(EdgeDetector::getJumpFloodSteps(1.0f) == std::vector<int>{2, 1, 1});
+    CHECK(EdgeDetector::getJumpFloodSteps(6.5f).front() == 8);
+}
+
+TEST_CASE("Line width controls coverage and composite blends the outline color") {
+    GBuffer gbuffer = makeBoxOnWall(32, 10, 22);
+    EdgeSettings settings;
+    settings.lineWidth = 3.0f;
+    settings.outlineColor = glm::vec3(1.0f, 0.0f, 0.0f);
+
+    std::vector<float> coverage;
+    EdgeDetector::computeCoverage(gbuffer, settings, coverage);
+    CHECK(coverage[16 * 32 + 10] == doctest::Approx(1.0f)); // on the edge
+    CHECK(coverage[16 * 32 + 9] == doctest::Approx(1.0f));  // one pixel out
+    CHECK(coverage[16 * 32 + 8] == doctest::Approx(0.0f));  // two pixels out
+    CHECK(coverage[16 * 32 + 16] == doctest::Approx(0.0f)); // interior
+
+    Image color(32, 32, glm::vec4(0.0f, 0.0f, 1.0f, 0.0f));
+    EdgeDetector::composite(color, coverage, settings.outlineColor);
+    CHECK(color.at(10, 16).x == doctest::Approx(1.0f));
+    CHECK(color.at(10, 16).w == doctest::Approx(1.0f));
+    CHECK(color.at(16, 16).z == doctest::Approx(1.0f));
+    CHECK(color.at(16, 16).w == doctest::Approx(0.0f));
+
+    CHECK(EdgeSettings::fromOutlineThickness(0.0f).lineWidth == doctest::Approx(1.0f));
+    CHECK(EdgeSettings::fromOutlineThickness(1.0f).lineWidth == doctest::Approx(8.0f));
+}
@@ -0,0 +1,107 @@
+/**
+ * @file EditHistory_test.cpp
+ * @brief Tests for the command based undo/redo history
+ */
+
+#include "doctest/doctest.h"
+#include "GUI/EditHistory.h"
+#include <glm/glm.hpp>
+
+using namespace ElementalRenderer;
+
+namespace {
+
+std::unique_ptr<EditCommand> setValue(float& target, float value, const std::string& key = std::string()) {
+    return std::make_unique<PropertyEditCommand<float>>("Set value", key, target, value,
+                                                        [&target](const float& v) { target = v; });
+}
+
+} // namespace
+
+TEST_CASE("Edit history undoes and redoes property edits") {
+    EditHistory history;
+    float value = 1.0f;
+    CHECK_FALSE(history.canUndo());
+    CHECK_FALSE(history.undo());
+
+    history.execute(setValue(value, 2.0f));
+    history.execute(setValue(value, 3.0f));
+    CHECK(value == 3.0f);
+    CHECK(history.getUndoCount() == 2);
+
+    REQUIRE(history.undo());
+    CHECK(value == 2.0f);
+    REQUIRE(history.undo());
+    CHECK(value == 1.0f);
+    CHECK(history.getRedoCount() == 2);
+    REQUIRE(history.redo());
+    CHECK(value == 2.0f);
+
+    // A new edit discards the redo branch
+    history.execute(setValue(value, 5.0f));
+    CHECK_FALSE(history.canRedo());
+    CHECK(history.getUndoDescription() == "Set value");
+    REQUIRE(history.undo());
+    CHECK(value == 2.0f);
+}
+
+TEST_CASE("Edits during a drag coalesce into one undo step") {
+    EditHistory history;
+    glm::vec3 position(0.0f);
+    auto move = [&position](const glm::vec3& to) {
+        return std::make_unique<PropertyEditCommand<glm::vec3>>("Move light", "light0.position", position, to,
+                                                                [&position](const glm::vec3& v) { position = v; });
+    };
+
+    history.beginCoalescing();
+    for (int frame = 1; frame <= 100; ++frame) {
+        history.execute(move(glm::vec3(static_cast<float>(frame), 0.0f, 0.0f)));
+    }
+    history.endCoalescing();
+    CHECK(history.getUndoCount() == 1);
+    CHECK(position.x == 100.0f);
+    const size_t singleStep = history.getMemoryUsage();
+
+    // Other properties and sealed drags start new steps
+    float intensity = 1.0f;
+    history.beginCoalescing();
+    history.execute(setValue(intensity, 2.0f, "light0.intensity"));
+    history.execute(move(glm::vec3(200.0f, 0.0f, 0.0f)));
+    history.endCoalescing();
+    history.execute(move(glm::vec3(300.0f, 0.0f, 0.0f)));
+    CHECK(history.getUndoCount() == 4);
+
+    for (int step = 0; step < 3; ++step) {
+        REQUIRE(history.undo());
+    }
+    CHECK(position.x == 100.0f);
+    CHECK(intensity == 1.0f);
+    REQUIRE(history.undo());
+    CHECK(position.x == 0.0f);
+    CHECK(history.getMemoryUsage() > singleStep);
+}
+
+TEST_CASE("Edit history trims the oldest steps past its memory budget") {
+    float value = 0.0f;
+    const size_t stepSize = setValue(value, 0.0f)->getMemoryUsage();
+    EditHistory history(stepSize * 10);
+
+    for (int edit = 1; edit <= 50; ++edit) {
+        history.execute(setValue(value, static_cast<float>(edit)));
+        CHECK(history.getMemoryUsage() <= history.getMemoryBudget());
+    }
+    CHECK(history.getUndoCount() == 10);
+    while (history.undo()) {
+    }
+    CHECK(value == 40.0f);
+
+    // Shrinking the budget trims at once but always keeps the newest step
+    history.setMemoryBudget(0);
+    CHECK(history.getUndoCount() + history.getRedoCount() == 0);
+    history.execute(setValue(value, 1.0f));
+    CHECK(history.getUndoCount() == 1);
+
+    history.clear();
+    CHECK(history.getMemoryUsage() == 0);
+    CHECK_FALSE(history.canUndo());
+}
@@ -0,0 +1,151 @@
+/**
+ * @file EnvironmentBaker_test.cpp
+ * @brief Tests for the cube map helpers and the image-based lighting baker
+ */
+
+#include "doctest/doctest.h"
+#include "Headless/EnvironmentBaker.h"
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+
+using namespace ElementalRenderer;
+
+namespace {
+
+// Radiance max(y, 0): a sky lit from straight above
+CubeMap makeSky(int size) {
+    CubeMap sky(size);
+    for (int face = 0; face < CubeMap::kFaceCount; ++face) {
+        for (int y = 0; y < size; ++y) {
+            for (int x = 0; x < size; ++x) {
+                const glm::vec3 d = CubeMap::faceDirection(face, (x + 0.5f) / size, (y + 0.5f) / size);
+                const float value = std::max(d.y, 0.0f);
+                sky.getFace(face).at(x, y) = glm::vec4(value, value, value, 1.0f);
+            }
+        }
+    }
+    return sky;
+}
+
+} // namespace
+
+TEST_CASE("Cube map faces follow the OpenGL layout") {
+    for (int face = 0; face < CubeMap::kFaceCount; ++face) {
+        for (float s = 0.1f; s < 1.0f; s += 0.2f) {
+            for (float t = 0.1f; t < 1.0f; t += 0.2f) {
+                int hitFace;
+                glm::vec2 st;
+                CubeMap::directionToFace(CubeMap::faceDirection(face, s, t), hitFace, st);
+                CHECK(hitFace == face);
+                CHECK(st.x == doctest::Approx(s));
+                CHECK(st.y == doctest::Approx(t));
+            }
+        }
+    }
+    // +X face: s grows toward -z, t grows toward -y
+    const glm::vec3 corner = CubeMap::faceDirection(0, 1.0f, 1.0f);
+    CHECK(corner.z < 0.0f);
+    CHECK(corner.y < 0.0f);
+
+    double total = 0.0;
+    for (int y = 0; y < 16; ++y) {
+        for (int x = 0; x < 16; ++x) {
+            total += 6.0 * CubeMap::texelSolidAngle(16, x, y);
+        }
+    }
+    CHECK(total == doctest::Approx(4.0 * 3.14159265358979));
+}
+
+TEST_CASE("Split-sum LUT and irradiance match known values") {
+    const Image lut = EnvironmentBaker::bakeBRDFLUT(32, 256);
+    for (int y = 0; y < 32; ++y) {
+        for (int x = 0; x < 32; ++x) {
+            const glm::vec4& texel = lut.at(x, y);
+            CHECK(texel.x >= 0.0f);
+            CHECK(texel.y >= 0.0f);
+            CHECK(texel.x + texel.y <= 1.001f);
+        }
+    }
+    // A mirror seen head-on reflects everything
+    const glm::vec4& smooth = lut.at(31, 0);
+    CHECK(smooth.x + smooth.y == doctest::Approx(1.0f).epsilon(0.02));
+    // Fresnel moves smooth grazing reflection into the bias term
+    CHECK(lut.at(0, 0).y > 0.5f);
+    CHECK(smooth.y < 0.01f);
+    // Rough surfaces lose energy to shadowing and masking
+    CHECK(lut.at(31, 31).x + lut.at(31, 31).y < 0.5f);
+
+    // Cosine-weighted average of max(y, 0) is 2/3 looking up and 0 looking down
+    const SphericalHarmonics9 sh = SphericalHarmonics9::project(makeSky(32));
+    CHECK(sh.evaluateIrradiance(glm::vec3(0.0f, 1.0f, 0.0f)).x == doctest::Approx(2.0f / 3.0f).epsilon(0.05));
+    CHECK(sh.evaluateIrradiance(glm::vec3(0.0f, -1.0f, 0.0f)).x < 0.05f);
+    CHECK(sh.evaluateIrradiance(glm::vec3(1.0f, 0.0f, 0.0f)).x == doctest::Approx(0.25f).epsilon(0.1));
+}
+
+TEST_CASE("Specular mips blur with roughness and bakes are cached on disk") {
+    EnvironmentBakeSettings settings;
+    settings.brdfLUTSize = 16;
+    settings.brdfSampleCount = 64;
+    settings.specularSize = 16;
+    settings.specularMipCount = 4;
+    settings.specularSampleCount = 64;
+
+    const CubeMap sky = makeSky(32);
+    const std::vector<CubeMap> mips = EnvironmentBaker::prefilterSpecular(sky, 16, 4, 64);
+    REQUIRE(mips.size() == 4);
+    CHECK(mips[3].getSize() == 2);
+    // The mirror mip reproduces the sky; rougher mips pull the zenith down and the horizon up
+    const glm::vec3 up(0.0f, 1.0f, 0.0f);
+    const glm::vec3 horizon = glm::normalize(glm::vec3(1.0f, -0.05f, 0.0f));
+    CHECK(mips[0].sample(up).x == doctest::Approx(1.0f).epsilon(0.02));
+    CHECK(mips[3].sample(up).x < mips[1].sample(up).x);
+    CHECK(mips[3].sample(horizon).x > mips[0].sample(horizon).x);
+
+    const std::filesystem::path cache = std::filesystem::temp_directory_path() / "elemental_ibl_cache_test";
+    std::filesystem::remove_all(cache);
+
+    const BakedEnvironment first = EnvironmentBaker::bake(sky, settings, cache.string());
+    CHECK_FALSE(first.loadedFromCache);
+    const BakedEnvironment second = EnvironmentBaker::bake(sky, settings, cache.string());
+    CHECK(second.loadedFromCache);
+    CHECK(second.hash == first.hash);
+    REQUIRE(second.specular.size() == first.specular.size());
+    CHECK(second.specular[2].getFace(3).at(1, 2).x == first.specular[2].getFace(3).at(1, 2).x);
+    CHECK(second.brdfLUT.at(5, 7).y == first.brdfLUT.at(5, 7).y);
+    CHECK(second.irradiance.coefficients[6].z == first.irradiance.coefficients[6].z);
+
+    // A different environment misses the cache
+    CubeMap brighter = sky;
+    brighter.getFace(2).at(0, 0) = glm::vec4(5.0f);
+    CHECK_FALSE(EnvironmentBaker::bake(brighter, settings, cache.string()).loadedFromCache);
+    std::filesystem::remove_all(cache);
+}
+
+TEST_CASE("Corrupt cache files are rejected before allocating") {
+    EnvironmentBakeSettings settings;
+    settings.brdfLUTSize = 8;
+    settings.brdfSampleCount = 16;
+    settings.specularSize = 4;
+    settings.specularMipCount = 2;
+    settings.specularSampleCount = 16;
+    const BakedEnvironment baked = EnvironmentBaker::bake(makeSky(8), settings);
+
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "elemental_ibl_corrupt_test.ibl";
+    REQUIRE(EnvironmentBaker::saveToFile(baked, path.string()));
+    BakedEnvironment loaded;
+    REQUIRE(EnvironmentBaker::loadFromFile(path.string(), loaded));
+
+    // The LUT size follows the 8-byte magic, the version and the hash
+    const std::streamoff lutSizeOffset = 8 + sizeof(uint32_t) + sizeof(uint64_t);
+    for (int32_t size : { EnvironmentBaker::kMaxBakeSize, EnvironmentBaker::kMaxBakeSize * 8, 9 }) {
+        {
+            std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+            file.seekp(lutSizeOffset);
+            file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        }
+        CHECK_FALSE(EnvironmentBaker::loadFromFile(path.string(), loaded));
+    }
+    CHECK(loaded.brdfLUT.getWidth() == 8);
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,378 @@
+/**
+ * @file HalfEdgeMesh_test.cpp
+ * @brief Tests for the half-edge editing mesh
+ */
+
+#include "doctest/doctest.h"
+#include "HalfEdgeMesh.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace ElementalRenderer;
+
+namespace {
+
+std::vector<int32_t> sorted(std::vector<int32_t> values) {
+    std::sort(values.begin(), values.end());
+    return values;
+}
+
+// 3 x 3 vertex grid in the z = 0 plane, split into 2 x 2 quads
+//   6 7 8
+//   3 4 5
+//   0 1 2
+void buildGrid(HalfEdgeMesh& mesh) {
+    for (int y = 0; y < 3; ++y) {
+        for (int x = 0; x < 3; ++x) {
+            mesh.addVertex(glm::vec3(static_cast<float>(x), static_cast<float>(y), 0.0f));
+        }
+    }
+    for (int y = 0; y < 2; ++y) {
+        for (int x = 0; x < 2; ++x) {
+            const int32_t corner = y * 3 + x;
+            mesh.addFace({ corner, corner + 1, corner + 4, corner + 3 }, x);
+        }
+    }
+}
+
+// Checks the links every half-edge of a live face must satisfy
+void checkConsistency(const HalfEdgeMesh& mesh) {
+    for (size_t face = 0; face < mesh.getFaceCapacity(); ++face) {
+        if (!mesh.isFaceValid(static_cast<int32_t>(face))) {
+            continue;
+        }
+        mesh.forEachFaceHalfEdge(static_cast<int32_t>(face), [&](int32_t halfEdge) {
+            const HalfEdgeMesh::HalfEdge& edge = mesh.getHalfEdge(halfEdge);
+            CHECK(edge.face == static_cast<int32_t>(face));
+            CHECK(mesh.getHalfEdge(edge.next).prev == halfEdge);
+            if (edge.twin >= 0) {
+                CHECK(mesh.getHalfEdge(edge.twin).twin == halfEdge);
+                CHECK(mesh.getHalfEdge(edge.twin).origin == mesh.getTarget(halfEdge));
+            }
+        });
+    }
+    for (size_t vertex = 0; vertex < mesh.getVertexCapacity(); ++vertex) {
+        const int32_t halfEdge = mesh.isVertexValid(static_cast<int32_t>(vertex))
+                               ? mesh.getVertexHalfEdge(static_cast<int32_t>(vertex)) : HalfEdgeMesh::kInvalid;
+        if (halfEdge >= 0) {
+            CHECK(mesh.getHalfEdge(halfEdge).origin == static_cast<int32_t>(vertex));
+        }
+    }
+}
+
+} // namespace
+
+TEST_CASE("Half-edge adjacency of a quad grid") {
+    HalfEdgeMesh mesh;
+    buildGrid(mesh);
+    CHECK(mesh.getVertexCount() == 9);
+    CHECK(mesh.getFaceCount() == 4);
+    CHECK(mesh.getHalfEdgeCount() == 16);
+    checkConsistency(mesh);
+
+    std::vector<int32_t> result;
+    mesh.getFaceVertices(3, result);
+    CHECK(result == std::vector<int32_t>{ 4, 5, 8, 7 });
+
+    mesh.getVertexFaces(4, result);
+    CHECK(sorted(result) == std::vector<int32_t>{ 0, 1, 2, 3 });
+    mesh.getVertexFaces(1, result);
+    CHECK(sorted(result) == std::vector<int32_t>{ 0, 1 });
+    mesh.getVertexFaces(8, result);
+    CHECK(result == std::vector<int32_t>{ 3 });
+
+    mesh.getVertexNeighbors(4, result);
+    CHECK(sorted(result) == std::vector<int32_t>{ 1, 3, 5, 7 });
+    mesh.getVertexNeighbors(0, result);
+    CHECK(sorted(result) == std::vector<int32_t>{ 1, 3 });
+
+    mesh.getFaceNeighbors(0, result);
+    CHECK(sorted(result) == std::vector<int32_t>{ 1, 2 });
+
+    CHECK_FALSE(mesh.isBoundaryVertex(4));
+    CHECK(mesh.isBoundaryVertex(3));
+
+    mesh.computeNormals();
+    for (int32_t vertex = 0; vertex < 9; ++vertex) {
+        CHECK(mesh.getNormal(vertex).z == doctest::Approx(1.0f));
+    }
+
+    // A face reusing an edge in the same direction has the wrong winding
+    const int32_t extra = mesh.addVertex(glm::vec3(1.0f, -1.0f, 0.0f));
+    CHECK(mesh.addFace({ 0, 1, extra }) == HalfEdgeMesh::kInvalid);
+    CHECK(mesh.addFace({ 0, 0, 1 }) == HalfEdgeMesh::kInvalid);
+    CHECK(mesh.addFace({ 0, 1 }) == HalfEdgeMesh::kInvalid);
+    CHECK(mesh.addFace({ 3, 4, extra }) == HalfEdgeMesh::kInvalid);   // Interior edge
+    CHECK(mesh.addFace({ 2, 5, 42 }) == HalfEdgeMesh::kInvalid);
+    CHECK(mesh.getFaceCount() == 4);
+
+    // The correctly wound one pairs with the grid's bottom edge
+    const int32_t below = mesh.addFace({ 1, 0, extra });
+    REQUIRE(below != HalfEdgeMesh::kInvalid);
+    mesh.getFaceNeighbors(below, result);
+    CHECK(result == std::vector<int32_t>{ 0 });
+    CHECK(mesh.getNormal(extra).z == doctest::Approx(0.0f));
+    checkConsistency(mesh);
+}
+
+TEST_CASE("Removed elements keep the other ids and are reused") {
+    HalfEdgeMesh mesh;
+    buildGrid(mesh);
+
+    // Removing the centre vertex takes every face with it
+    REQUIRE(mesh.removeVertex(4));
+    CHECK_FALSE(mesh.removeVertex(4));
+    CHECK(mesh.getFaceCount() == 0);
+    CHECK(mesh.getHalfEdgeCount() == 0);
+    CHECK(mesh.getVertexCount() == 8);
+    CHECK(mesh.getVertexHalfEdge(0) == HalfEdgeMesh::kInvalid);
+    CHECK(mesh.getPosition(8) == glm::vec3(2.0f, 2.0f, 0.0f));
+
+    // New elements fill the holes
+    CHECK(mesh.addVertex(glm::vec3(1.0f, 1.0f, 1.0f)) == 4);
+    CHECK(mesh.getVertexCapacity() == 9);
+    const int32_t face = mesh.addFace({ 0, 1, 4, 3 });
+    CHECK(face >= 0);
+    CHECK(face < 4);
+    CHECK(mesh.getFaceCapacity() == 4);
+    checkConsistency(mesh);
+
+    // Removing a face between two others turns its edges into boundaries again
+    HalfEdgeMesh grid;
+    buildGrid(grid);
+    REQUIRE(grid.removeFace(0));
+    CHECK_FALSE(grid.removeFace(0));
+    CHECK_FALSE(grid.isFaceValid(0));
+    CHECK(grid.isBoundaryVertex(4));
+    CHECK(grid.getVertexHalfEdge(0) == HalfEdgeMesh::kInvalid);
+    std::vector<int32_t> result;
+    grid.getVertexFaces(4, result);
+    CHECK(sorted(result) == std::vector<int32_t>{ 1, 2, 3 });
+    grid.getFaceNeighbors(1, result);
+    CHECK(result == std::vector<int32_t>{ 3 });
+    checkConsistency(grid);
+
+    // ... so the face can be added back
+    CHECK(grid.addFace({ 0, 1, 4, 3 }) == 0);
+    grid.getVertexFaces(4, result);
+    CHECK(sorted(result) == std::vector<int32_t>{ 0, 1, 2, 3 });
+    checkConsistency(grid);
+}
+
+TEST_CASE("Faces around a vertex are accepted in any order") {
+    // Closed fan of six triangles around the centre of a hexagon
+    const float pi = 3.14159265f;
+    std::vector<int> order{ 0, 1, 2, 3, 4, 5 };
+    do {
+        HalfEdgeMesh mesh;
+        const int32_t centre = mesh.addVertex(glm::vec3(0.0f));
+        for (int k = 0; k < 6; ++k) {
+            mesh.addVertex(glm::vec3(std::cos(k * pi / 3.0f), std::sin(k * pi / 3.0f), 0.0f));
+        }
+        for (int k : order) {
+            CHECK(mesh.addFace({ centre, 1 + k, 1 + (k + 1) % 6 }) == static_cast<int32_t>(mesh.getFaceCount()) - 1);
+        }
+        REQUIRE(mesh.getFaceCount() == 6);
+        std::vector<int32_t> result;
+        mesh.getVertexFaces(centre, result);
+        CHECK(result.size() == 6);
+        mesh.getVertexNeighbors(centre, result);
+        CHECK(sorted(result) == std::vector<int32_t>{ 1, 2, 3, 4, 5, 6 });
+        CHECK_FALSE(mesh.isBoundaryVertex(centre));
+        checkConsistency(mesh);
+    } while (std::next_permutation(order.begin(), order.end()));
+}
+
+TEST_CASE("Faces that would leave a vertex non-manifold are rejected") {
+    HalfEdgeMesh mesh;
+    const int32_t centre = mesh.addVertex(glm::vec3(0.0f));
+    const int32_t a = mesh.addVertex(glm::vec3(1.0f, 0.0f, 0.0f));
+    const int32_t b = mesh.addVertex(glm::vec3(0.0f, 1.0f, 0.0f));
+    const int32_t c = mesh.addVertex(glm::vec3(-1.0f, -1.0f, 0.0f));
+    const int32_t d = mesh.addVertex(glm::vec3(0.0f, 0.0f, 1.0f));
+    const int32_t e = mesh.addVertex(glm::vec3(0.0f, 1.0f, 1.0f));
+
+    // A separate fan is fine while the first one is still open ...
+    REQUIRE(mesh.addFace({ centre, a, b }) == 0);
+    REQUIRE(mesh.addFace({ centre, b, c }) == 1);
+    CHECK(mesh.addFace({ centre, d, e }) == 2);
+
+    // ... but closing the first fan would leave the second unreachable
+    CHECK(mesh.addFace({ centre, c, a }) == HalfEdgeMesh::kInvalid);
+    REQUIRE(mesh.removeFace(2));
+    CHECK(mesh.addFace({ centre, c, a }) == 2);
+
+    // Nothing may be added beside a closed fan
+    CHECK(mesh.addFace({ centre, d, e }) == HalfEdgeMesh::kInvalid);
+    CHECK(mesh.getFaceCount() == 3);
+    checkConsistency(mesh);
+
+    // Removing the middle face of an open fan splits it; queries still see both parts
+    HalfEdgeMesh grid;
+    buildGrid(grid);
+    std::vector<int32_t> result;
+    REQUIRE(grid.removeFace(0));
+    REQUIRE(grid.removeFace(3));
+    grid.getVertexFaces(4, result);
+    CHECK(sorted(result) == std::vector<int32_t>{ 1, 2 });
+    grid.getVertexNeighbors(4, result);
+    CHECK(sorted(result) == std::vector<int32_t>{ 1, 3, 5, 7 });
+    CHECK(grid.isBoundaryVertex(4));
+    checkConsistency(grid);
+
+    // Filling the gap joins the two parts again
+    CHECK(grid.addFace({ 4, 5, 8, 7 }) == 3);
+    grid.getVertexFaces(4, result);
+    CHECK(sorted(result) == std::vector<int32_t>{ 1, 2, 3 });
+    checkConsistency(grid);
+}
+
+TEST_CASE("Compaction and triangulation number the live elements densely") {
+    HalfEdgeMesh mesh;
+    buildGrid(mesh);
+    mesh.setTexCoord(8, glm::vec2(1.0f, 1.0f));
+    REQUIRE(mesh.removeFace(1));
+    REQUIRE(mesh.removeVertex(2));
+    REQUIRE(mesh.removeVertex(0));   // Also drops face 0
+
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> normals;
+    std::vector<glm::vec2> texCoords;
+    std::vector<unsigned int> indices;
+    std::vector<int32_t> materials;
+    mesh.triangulate(positions, normals, texCoords, indices, &materials);
+    CHECK(positions.size() == 7);
+    CHECK(indices.size() == 12);
+    CHECK(materials == std::vector<int32_t>{ 0, 0, 1, 1 });
+
+    std::vector<int32_t> vertexRemap;
+    std::vector<int32_t> faceRemap;
+    mesh.compact(&vertexRemap, &faceRemap);
+    CHECK(vertexRemap == std::vector<int32_t>{ HalfEdgeMesh::kInvalid, 0, HalfEdgeMesh::kInvalid, 1, 2, 3, 4, 5, 6 });
+    CHECK(faceRemap == std::vector<int32_t>{ HalfEdgeMesh::kInvalid, HalfEdgeMesh::kInvalid, 0, 1 });
+    CHECK(mesh.getVertexCapacity() == 7);
+    CHECK(mesh.getFaceCapacity() == 2);
+    CHECK(mesh.getHalfEdgeCount() == 8);
+    CHECK(mesh.getPosition(6) == glm::vec3(2.0f, 2.0f, 0.0f));
+    CHECK(mesh.getTexCoord(6) == glm::vec2(1.0f, 1.0f));
+    CHECK(mesh.getFaceMaterial(1) == 1);
+    checkConsistency(mesh);
+
+    // The triangles match the ones produced before compaction
+    std::vector<glm::vec3> compactPositions;
+    std::vector<unsigned int> compactIndices;
+    mesh.triangulate(compactPositions, normals, texCoords, compactIndices);
+    CHECK(compactPositions == positions);
+    CHECK(compactIndices == indices);
+
+    std::vector<int32_t> result;
+    mesh.getFaceVertices(1, result);
+    CHECK(result == std::vector<int32_t>{ 2, 3, 6, 5 });
+    mesh.getFaceNeighbors(0, result);
+    CHECK(result == std::vector<int32_t>{ 1 });
+
+    // Compaction leaves nothing to reuse
+    CHECK(mesh.addVertex(glm::vec3(0.0f)) == 7);
+}
+
+namespace {
+
+// n x n quads over the unit square with matching texture coordinates
+void buildDenseGrid(HalfEdgeMesh& mesh, int n) {
+    const float step = 1.0f / static_cast<float>(n);
+    for (int y = 0; y <= n; ++y) {
+        for (int x = 0; x <= n; ++x) {
+            const glm::vec2 uv(static_cast<float>(x) * step, static_cast<float>(y) * step);
+            mesh.addVertex(glm::vec3(uv.x, uv.y, 0.0f), uv);
+        }
+    }
+    for (int y = 0; y < n; ++y) {
+        for (int x = 0; x < n; ++x) {
+            const int32_t corner = y * (n + 1) + x;
+            mesh.addFace({ corner, corner + 1, corner + n + 2, corner + n + 1 });
+        }
+    }
+}
+
+// Incremental results must match a full recompute of the same geometry
+void checkMatchesFullRecompute(const HalfEdgeMesh& mesh) {
+    HalfEdgeMesh reference = mesh;
+    reference.computeNormals();
+    int mismatches = 0;
+    for (size_t i = 0; i < mesh.getVertexCapacity(); ++i) {
+        const int32_t vertex = static_cast<int32_t>(i);
+        if (mesh.isVertexValid(vertex)
+            && (glm::length(mesh.getNormal(vertex) - reference.getNormal(vertex)) > 1e-5f
+                || glm::length(mesh.getTangent(vertex) - reference.getTangent(vertex)) > 1e-5f)) {
+            ++mismatches;
+        }
+    }
+    CHECK(mismatches == 0);
+}
+
+} // namespace
+
+TEST_CASE("Vertex edits recompute only the normals and tangents around them") {
+    const int n = 200;
+    HalfEdgeMesh mesh;
+    buildDenseGrid(mesh, n);
+    CHECK(mesh.getDirtyFaceCount() == static_cast<size_t>(n * n));
+    CHECK(mesh.updateNormals() == static_cast<size_t>((n + 1) * (n + 1)));
+    CHECK(mesh.getDirtyFaceCount() == 0);
+    CHECK(mesh.getNormal(0).z == doctest::Approx(1.0f));
+    CHECK(mesh.getTangent(0).x == doctest::Approx(1.0f));
+    CHECK(mesh.getTangent(0).w == 1.0f);
+
+    // Lifting an interior vertex touches its four quads and their nine vertices
+    const int32_t centre = (n / 2) * (n + 1) + n / 2;
+    mesh.setPosition(centre, mesh.getPosition(centre) + glm::vec3(0.0f, 0.0f, 0.05f));
+    CHECK(mesh.getDirtyFaceCount() == 4);
+    CHECK(mesh.updateNormals() == 9);
+    CHECK(mesh.updateNormals() == 0);
+    CHECK(mesh.getNormal(centre + 1).x > 0.1f);
+    CHECK(mesh.getNormal(centre + 2) == mesh.getNormal(0));
+    checkMatchesFullRecompute(mesh);
+
+    // A drag moving the same vertices many times is flushed as one batch
+    for (int step = 1; step <= 20; ++step) {
+        for (int32_t vertex : { centre, centre + 7, 5 * (n + 1) + 3 }) {
+            mesh.setPosition(vertex, mesh.getPosition(vertex) + glm::vec3(0.0f, 0.0f, 0.001f * static_cast<float>(step)));
+        }
+    }
+    CHECK(mesh.getDirtyFaceCount() == 12);
+    CHECK(mesh.updateNormals() == 27);
+    checkMatchesFullRecompute(mesh);
+
+    // Mirrored texture coordinates flip the tangent handedness
+    for (int32_t vertex : { 0, 1, n + 1, n + 2 }) {
+        const glm::vec2 uv = mesh.getTexCoord(vertex);
+        mesh.setTexCoord(vertex, glm::vec2(-uv.x, uv.y));
+    }
+    mesh.updateNormals();
+    CHECK(mesh.getTangent(0).w == -1.0f);
+    CHECK(mesh.getTangent(0).x == doctest::Approx(-1.0f));
+    checkMatchesFullRecompute(mesh);
+
+    // Removing faces re-accumulates the vertices they leave behind
+    REQUIRE(mesh.removeFace(0));
+    mesh.updateNormals();
+    CHECK(mesh.getNormal(0) == glm::vec3(0.0f, 1.0f, 0.0f));
+    checkMatchesFullRecompute(mesh);
+
+    // Edits covering most of the mesh take the parallel full recompute
+    for (size_t i = 0; i < mesh.getVertexCapacity(); ++i) {
+        const int32_t vertex = static_cast<int32_t>(i);
+        const glm::vec3 position = mesh.getPosition(vertex);
+        mesh.setPosition(vertex, glm::vec3(position.x, position.y, std::sin(position.x * 6.0f) * 0.1f));
+    }
+    CHECK(mesh.updateNormals() == mesh.getVertexCount());
+    checkMatchesFullRecompute(mesh);
+
+    // Pending edits survive compaction
+    REQUIRE(mesh.removeVertex(n));
+    mesh.setPosition(centre, mesh.getPosition(centre) + glm::vec3(0.0f, 0.0f, 0.2f));
+    mesh.compact();
+    CHECK(mesh.getDirtyFaceCount() == 4);
+    mesh.updateNormals();
+    checkMatchesFullRecompute(mesh);
+}
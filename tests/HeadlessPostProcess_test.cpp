@@ -0,0 +1,219 @@
+/**
+ * @file HeadlessPostProcess_test.cpp
+ * @brief Golden-image tests for the CPU post-processing kernels
+ */
+
+#include "doctest/doctest.h"
+#include "Headless/CPUPostProcessor.h"
+#include <cmath>
+#include <glm/glm.hpp>
+
+using namespace ElementalRenderer;
+
+namespace {
+
+// Deterministic test pattern with gradients, hard edges and varying alpha
+Image makePattern(int width, int height) {
+    Image image(width, height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            float checker = ((x / 3 + y / 3) % 2) ? 0.9f : 0.1f;
+            image.at(x, y) = glm::vec4(
+                static_cast<float>(x) / width,
+                static_cast<float>(y) / height,
+                checker,
+                0.25f + 0.5f * checker);
+        }
+    }
+    return image;
+}
+
+glm::vec2 texCoords(const Image& image, int x, int y) {
+    return glm::vec2((x + 0.5f) / image.getWidth(), (y + 0.5f) / image.getHeight());
+}
+
+float shaderSmoothstep(float edge0, float edge1, float x) {
+    float t = glm::clamp((x - edge0) / (edge1 - edge0), 0.0f, 1.0f);
+    return t * t * (3.0f - 2.0f * t);
+}
+
+// Straight transcription of the standard post-process fragment shader
+glm::vec4 shadePixel(const Image& screen, glm::vec2 uv, int effectType, float strength) {
+    if (effectType == 1) {
+        const float offset = 1.0f / 300.0f;
+        const glm::vec2 offsets[9] = {
+            glm::vec2(-offset, offset), glm::vec2(0.0f, offset), glm::vec2(offset, offset),
+            glm::vec2(-offset, 0.0f), glm::vec2(0.0f, 0.0f), glm::vec2(offset, 0.0f),
+            glm::vec2(-offset, -offset), glm::vec2(0.0f, -offset), glm::vec2(offset, -offset)};
+        const float kernel[9] = {1.0f / 16, 2.0f / 16, 1.0f / 16,
+                                 2.0f / 16, 4.0f / 16, 2.0f / 16,
+                                 1.0f / 16, 2.0f / 16, 1.0f / 16};
+        glm::vec3 col(0.0f);
+        for (int i = 0; i < 9; ++i) {
+            glm::vec4 s = screen.sample(uv + offsets[i] * strength);
+            col += glm::vec3(s.x, s.y, s.z) * kernel[i];
+        }
+        glm::vec4 o = screen.sample(uv);
+        col = glm::mix(glm::vec3(o.x, o.y, o.z), col, strength);
+        return glm::vec4(col, 1.0f);
+    }
+    if (effectType == 2) {
+        glm::vec4 s = screen.sample(uv);
+        glm::vec3 col(s.x, s.y, s.z);
+        float average = 0.2126f * col.x + 0.7152f * col.y + 0.0722f * col.z;
+        col = glm::mix(col, glm::vec3(average), strength);
+        return glm::vec4(col, 1.0f);
+    }
+    if (effectType == 3) {
+        glm::vec4 s = screen.sample(uv);
+        float distance = glm::length(uv - glm::vec2(0.5f));
+        float factor = shaderSmoothstep(0.8f, 0.2f, distance * strength);
+        return glm::vec4(glm::vec3(s.x, s.y, s.z) * factor, 1.0f);
+    }
+    if (effectType == 4) {
+        float aberration = 0.01f * strength;
+        return glm::vec4(screen.sample(uv + glm::vec2(aberration, 0.0f)).x,
+                         screen.sample(uv).y,
+                         screen.sample(uv - glm::vec2(aberration, 0.0f)).z,
+                         1.0f);
+    }
+    return screen.sample(uv);
+}
+
+float maxDifference(const Image& a, const Image& b) {
+    float worst = 0.0f;
+    for (int y = 0; y < a.getHeight(); ++y) {
+        for (int x = 0; x < a.getWidth(); ++x) {
+            glm::vec4 d = glm::abs(a.at(x, y) - b.at(x, y));
+            worst = std::max(worst, std::max(std::max(d.x, d.y), std::max(d.z, d.w)));
+        }
+    }
+    return worst;
+}
+
+float goldenError(PostProcessEffect effect, float strength, int width, int height) {
+    Image source = makePattern(width, height);
+    Image golden(width, height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            golden.at(x, y) = shadePixel(source, texCoords(source, x, y), static_cast<int>(effect), strength);
+        }
+    }
+
+    Image result;
+    CPUPostProcessor::applyEffect(effect, strength, source, result);
+    return maxDifference(result, golden);
+}
+
+} // namespace
+
+TEST_CASE("CPU post-process effects match the shader math") {
+    const PostProcessEffect effects[] = {
+        PostProcessEffect::BLUR,
+        PostProcessEffect::GRAYSCALE,
+        PostProcessEffect::VIGNETTE,
+        PostProcessEffect::CHROMATIC_ABERRATION
+    };
+
+    for (PostProcessEffect effect : effects) {
+        for (float strength : {0.0f, 0.35f, 1.0f, 2.5f}) {
+            // Odd sizes exercise clamp-to-edge and fractional tap offsets
+            CHECK(goldenError(effect, strength, 613, 97) < 1e-4f);
+            CHECK(goldenError(effect, strength, 64, 301) < 1e-4f);
+        }
+    }
+}
+
+TEST_CASE("CPU post-processor mirrors the PostProcessShader interface") {
+    CPUPostProcessor processor;
+    CHECK(processor.getEffect() == PostProcessEffect::NONE);
+
+    processor.setEffect(PostProcessEffect::GRAYSCALE);
+    processor.setEffectStrength(1.0f);
+    CHECK(processor.getEffect() == PostProcessEffect::GRAYSCALE);
+
+    Image image(4, 4, glm::vec4(1.0f, 0.0f, 0.0f, 0.5f));
+    processor.apply(image, image);
+    CHECK(image.at(2, 2).x == doctest::Approx(0.2126f));
+    CHECK(image.at(2, 2).y == doctest::Approx(0.2126f));
+    CHECK(image.at(2, 2).w == doctest::Approx(1.0f));
+
+    std::vector<unsigned char> rgba8(4 * 4 * 4, 0);
+    for (size_t i = 0; i < rgba8.size(); i += 4) {
+        rgba8[i + 1] = 255;
+        rgba8[i + 3] = 255;
+    }
+    std::vector<unsigned char> out;
+    processor.apply(rgba8.data(), 4, 4, out);
+    REQUIRE(out.size() == rgba8.size());
+    CHECK(out[0] == 182); // round(0.7152 * 255)
+    CHECK(out[1] == 182);
+    CHECK(out[3] == 255);
+}
+
+TEST_CASE("Effect chains apply steps in order") {
+    Image source = makePattern(40, 30);
+
+    Image stepwise;
+    CPUPostProcessor::applyEffect(PostProcessEffect::CHROMATIC_ABERRATION, 0.8f, source, stepwise);
+    CPUPostProcessor::applyEffect(PostProcessEffect::VIGNETTE, 1.5f, stepwise, stepwise);
+
+    Image chained = source;
+    CPUPostProcessor::applyChain({{PostProcessEffect::CHROMATIC_ABERRATION, 0.8f},
+                                  {PostProcessEffect::NONE, 1.0f},
+                                  {PostProcessEffect::VIGNETTE, 1.5f}}, chained);
+
+    CHECK(maxDifference(stepwise, chained) == 0.0f);
+}
+
+TEST_CASE("Kernels can write over their own input") {
+    const Image source = makePattern(53, 41);
+    const struct {
+        void (*kernel)(const Image&, Image&, float);
+        float strength;
+    } kernels[] = {
+        { CPUPostProcessor::blur, 1.0f },
+        { CPUPostProcessor::grayscale, 0.7f },
+        { CPUPostProcessor::vignette, 1.5f },
+        { CPUPostProcessor::chromaticAberration, 2.0f },
+    };
+
+    for (const auto& entry : kernels) {
+        Image expected;
+        entry.kernel(source, expected, entry.strength);
+        Image image = source;
+        entry.kernel(image, image, entry.strength);
+        CHECK(maxDifference(image, expected) == 0.0f);
+    }
+}
+
+TEST_CASE("Sliding-window Gaussian blur preserves energy and spreads like a Gaussian") {
+    const int size = 129;
+    const float sigma = 6.0f;
+
+    Image impulse(size, size, glm::vec4(0.0f));
+    impulse.at(size / 2, size / 2) = glm::vec4(1.0f);
+
+    Image blurred;
+    CPUPostProcessor::gaussianBlur(impulse, blurred, sigma);
+
+    double total = 0.0;
+    double variance = 0.0;
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            double w = blurred.at(x, y).x;
+            double dx = x - size / 2;
+            total += w;
+            variance += w * dx * dx;
+        }
+    }
+
+    CHECK(total == doctest::Approx(1.0).epsilon(1e-3));
+    CHECK(std::sqrt(variance / total) == doctest::Approx(sigma).epsilon(0.05));
+    CHECK(blurred.at(size / 2 + 3, size / 2).x == doctest::Approx(blurred.at(size / 2 - 3, size / 2).x));
+
+    Image flat(50, 20, glm::vec4(0.3f, 0.6f, 0.9f, 1.0f));
+    CPUPostProcessor::gaussianBlur(flat, flat, 25.0f);
+    CHECK(flat.at(0, 0).y == doctest::Approx(0.6f).epsilon(1e-4));
+    CHECK(flat.at(49, 19).z == doctest::Approx(0.9f).epsilon(1e-4));
+}
@@ -0,0 +1,138 @@
+/**
+ * @file IrradianceProbeGrid_test.cpp
+ * @brief Tests for the spherical-harmonic irradiance probe grid
+ */
+
+#include "doctest/doctest.h"
+#include "Lighting/IrradianceProbeGrid.h"
+#include "PathTracing/PathTracer.h"
+#include <cmath>
+
+using namespace ElementalRenderer;
+
+namespace {
+
+PathTracerMaterial lambert(float albedo) {
+    PathTracerMaterial material;
+    material.model = BRDFModel::CUSTOM;
+    material.brdf.albedo = glm::vec3(albedo);
+    return material;
+}
+
+void addQuad(PathTracerScene& scene, const glm::vec3& corner, const glm::vec3& edgeA, const glm::vec3& edgeB,
+             const PathTracerMaterial& material) {
+    scene.addMesh({corner, corner + edgeA, corner + edgeA + edgeB, corner + edgeB}, {}, {0, 1, 2, 0, 2, 3}, material);
+}
+
+// Lit floor for x > 0, dark floor for x < 0, separated by a tall black wall at x = 0
+PathTracerScene wallScene(float lightRadiance) {
+    PathTracerScene scene;
+    addQuad(scene, glm::vec3(-10.0f, 0.0f, -10.0f), glm::vec3(0.0f, 0.0f, 20.0f), glm::vec3(20.0f, 0.0f, 0.0f), lambert(0.8f));
+    addQuad(scene, glm::vec3(0.0f, 0.0f, -10.0f), glm::vec3(0.0f, 10.0f, 0.0f), glm::vec3(0.0f, 0.0f, 20.0f), lambert(0.0f));
+    PathTracerLight light;
+    light.position = glm::vec3(2.0f, 3.0f, 0.0f);
+    light.radiance = glm::vec3(lightRadiance);
+    scene.lights.push_back(light);
+    return scene;
+}
+
+IrradianceProbeSettings wallSettings() {
+    IrradianceProbeSettings settings;
+    settings.counts = glm::ivec3(4, 2, 2);
+    settings.samplesPerProbe = 128;
+    return settings;
+}
+
+const BoundingBox kWallBounds(glm::vec3(-1.5f, 0.5f, -1.0f), glm::vec3(1.5f, 2.5f, 1.0f));
+
+bool sameProbe(const IrradianceProbeGrid& a, const IrradianceProbeGrid& b, const glm::ivec3& probe) {
+    const SphericalHarmonics9 first = a.getProbe(probe);
+    const SphericalHarmonics9 second = b.getProbe(probe);
+    for (int i = 0; i < 9; ++i) {
+        if (first.coefficients[i] != second.coefficients[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("Irradiance probes reproduce a constant environment") {
+    // A tiny distant quad keeps the BVH non-empty
+    PathTracerScene scene;
+    addQuad(scene, glm::vec3(0.0f, -50.0f, 0.0f), glm::vec3(0.1f, 0.0f, 0.0f), glm::vec3(0.0f, 0.0f, 0.1f), lambert(0.5f));
+    scene.environment = glm::vec3(0.2f, 0.4f, 0.6f);
+    PathTracer tracer;
+    tracer.setScene(scene);
+
+    IrradianceProbeGrid grid;
+    IrradianceProbeSettings settings;
+    settings.counts = glm::ivec3(3, 2, 3);
+    settings.samplesPerProbe = 256;
+    grid.place(BoundingBox(glm::vec3(-2.0f), glm::vec3(2.0f)), settings);
+    CHECK_FALSE(grid.isBaked());
+    CHECK(grid.sampleIrradiance(glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f)) == glm::vec3(0.0f));
+    grid.bake(tracer);
+    REQUIRE(grid.isBaked());
+    CHECK(grid.getIrradianceAtlas().getWidth() == 3 * 9);
+    CHECK(grid.getIrradianceAtlas().getHeight() == 2 * 3);
+    CHECK(grid.getVisibilityAtlas().getWidth() == 3 * settings.visibilityResolution);
+
+    for (const glm::vec3& normal : {glm::vec3(0.0f, 1.0f, 0.0f), glm::vec3(-1.0f, 0.0f, 0.0f), glm::vec3(0.0f, 0.0f, -1.0f)}) {
+        const glm::vec3 irradiance = grid.sampleIrradiance(glm::vec3(0.3f, -0.7f, 1.1f), normal);
+        CHECK(irradiance.x == doctest::Approx(0.2f).epsilon(0.02));
+        CHECK(irradiance.z == doctest::Approx(0.6f).epsilon(0.02));
+    }
+}
+
+TEST_CASE("Irradiance probe visibility stops light leaking through walls") {
+    PathTracer tracer;
+    tracer.setScene(wallScene(20.0f));
+    IrradianceProbeGrid grid;
+    grid.place(kWallBounds, wallSettings());
+    grid.bake(tracer);
+
+    // Facing the floor, the lit probes see far more light than the dark ones
+    const glm::vec3 down(0.0f, -1.0f, 0.0f);
+    const float litProbe = grid.getProbe(glm::ivec3(2, 0, 0)).evaluateIrradiance(down).x;
+    const float darkProbe = grid.getProbe(glm::ivec3(1, 0, 0)).evaluateIrradiance(down).x;
+    REQUIRE(litProbe > 0.1f);
+    CHECK(darkProbe < 0.01f * litProbe);
+
+    // Points a fifth of a cell either side of the wall take their light from
+    // their own side only, although plain trilinear blending would mix both
+    const float litSide = grid.sampleIrradiance(glm::vec3(0.2f, 1.0f, 0.0f), down).x;
+    const float darkSide = grid.sampleIrradiance(glm::vec3(-0.2f, 1.0f, 0.0f), down).x;
+    CHECK(litSide > 0.8f * litProbe);
+    CHECK(darkSide < 0.02f * litProbe);
+}
+
+TEST_CASE("Irradiance probes re-bake only around changes") {
+    PathTracer tracer;
+    tracer.setScene(wallScene(20.0f));
+    IrradianceProbeGrid grid;
+    grid.place(kWallBounds, wallSettings());
+    grid.bake(tracer);
+    const IrradianceProbeGrid before = grid;
+
+    // Brighten the light and re-bake around it: only the upper probes of the
+    // outermost lit column lie within a cell of the light
+    tracer.setScene(wallScene(40.0f));
+    const BoundingBox changed(glm::vec3(1.9f, 2.9f, -0.1f), glm::vec3(2.1f, 3.1f, 0.1f));
+    CHECK(grid.rebake(tracer, changed) == 2);
+
+    IrradianceProbeGrid reference;
+    reference.place(kWallBounds, wallSettings());
+    reference.bake(tracer);
+    for (int z = 0; z < 2; ++z) {
+        for (int y = 0; y < 2; ++y) {
+            for (int x = 0; x < 4; ++x) {
+                const glm::ivec3 probe(x, y, z);
+                const bool nearChange = x == 3 && y == 1;
+                CHECK(sameProbe(grid, nearChange ? reference : before, probe));
+            }
+        }
+    }
+    CHECK_FALSE(sameProbe(grid, before, glm::ivec3(3, 1, 0)));
+}
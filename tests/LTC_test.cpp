@@ -0,0 +1,190 @@
+/**
+ * @file LTC_test.cpp
+ * @brief Tests for the linearly transformed cosine area lights
+ */
+
+#include "doctest/doctest.h"
+#include "Headless/LTC.h"
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+
+using namespace ElementalRenderer;
+
+namespace {
+
+const float kPi = 3.14159265358979f;
+
+// calculateCookTorrance's GGX specular with F = 1, cosine included
+float cookTorranceSpecular(const glm::vec3& n, const glm::vec3& l, const glm::vec3& v, float roughness) {
+    const float nDotL = glm::dot(n, l);
+    const float nDotV = glm::dot(n, v);
+    if (nDotL <= 0.0f || nDotV <= 0.0f) {
+        return 0.0f;
+    }
+    const glm::vec3 h = glm::normalize(l + v);
+    const float nDotH = glm::dot(n, h);
+    const float alpha = roughness * roughness;
+    const float alpha2 = alpha * alpha;
+    const float denom = nDotH * nDotH * (alpha2 - 1.0f) + 1.0f;
+    const float d = alpha2 / (kPi * denom * denom);
+    const float g1v = 2.0f * nDotV / (nDotV + std::sqrt(alpha + (1.0f - alpha) * nDotV * nDotV));
+    const float g1l = 2.0f * nDotL / (nDotL + std::sqrt(alpha + (1.0f - alpha) * nDotL * nDotL));
+    return d * g1v * g1l / (4.0f * nDotV);
+}
+
+// Midpoint-rule integral over a one-sided rectangle light seen from the origin with normal +z
+template<typename Integrand>
+float integrateRectangle(const glm::vec3& center, const glm::vec3& axisX, const glm::vec3& axisY, Integrand f) {
+    const int steps = 400;
+    const glm::vec3 emission = glm::normalize(glm::cross(axisY, axisX));
+    const float texelArea = 4.0f * glm::length(axisX) * glm::length(axisY) / (steps * steps);
+    double sum = 0.0;
+    for (int j = 0; j < steps; ++j) {
+        for (int i = 0; i < steps; ++i) {
+            const glm::vec3 p = center + axisX * (2.0f * (i + 0.5f) / steps - 1.0f) + axisY * (2.0f * (j + 0.5f) / steps - 1.0f);
+            const float distance2 = glm::dot(p, p);
+            const glm::vec3 l = p / std::sqrt(distance2);
+            const float cosLight = -glm::dot(emission, l);
+            if (cosLight > 0.0f) {
+                sum += f(l) * cosLight * texelArea / distance2;
+            }
+        }
+    }
+    return static_cast<float>(sum);
+}
+
+} // namespace
+
+TEST_CASE("Polygon integration gives exact form factors") {
+    glm::vec3 polygon[LTC::kMaxPolygonVertices];
+
+    // Unit-height square of side 2 centered above the point: 4 corner form factors
+    const float corner = 2.0f * (1.0f / std::sqrt(2.0f)) * std::atan(1.0f / std::sqrt(2.0f)) / (2.0f * kPi);
+    int count = LTC::rectanglePolygon(glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f), polygon);
+    CHECK(LTC::integratePolygon(polygon, count, false) == doctest::Approx(4.0f * corner).epsilon(1e-4));
+
+    // Facing away it only lights two-sided
+    count = LTC::rectanglePolygon(glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(0.0f, 1.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f), polygon);
+    CHECK(LTC::integratePolygon(polygon, count, false) == 0.0f);
+    CHECK(LTC::integratePolygon(polygon, count, true) == doctest::Approx(4.0f * corner).epsilon(1e-4));
+
+    // Disk of radius r at height h: r^2 / (h^2 + r^2)
+    count = LTC::diskPolygon(glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f), polygon);
+    CHECK(count == LTC::kDiskSegments);
+    CHECK(LTC::integratePolygon(polygon, count, false) == doctest::Approx(0.5f).epsilon(0.01));
+
+    // A wall crossing the horizon is clipped
+    const glm::vec3 center(1.0f, 0.0f, 0.2f);
+    const glm::vec3 axisX(0.0f, 0.5f, 0.0f);
+    const glm::vec3 axisY(0.0f, 0.0f, 0.5f);
+    count = LTC::rectanglePolygon(center, axisX, axisY, polygon);
+    const float expected = integrateRectangle(center, axisX, axisY, [](const glm::vec3& l) { return std::max(l.z, 0.0f) / kPi; });
+    CHECK(LTC::integratePolygon(polygon, count, false) == doctest::Approx(expected).epsilon(0.01));
+}
+
+TEST_CASE("Fitted tables reproduce the Cook-Torrance specular of a rectangle light") {
+    LTCFitSettings settings;
+    settings.tableSize = 8;
+    settings.sampleCount = 256;
+    const LTCTable table = LTC::fit(settings);
+    REQUIRE(table.getSize() == 8);
+
+    for (int y = 0; y < 8; ++y) {
+        for (int x = 0; x < 8; ++x) {
+            const glm::vec4& magnitude = table.magnitude.at(x, y);
+            CHECK(magnitude.x >= 0.0f);
+            CHECK(magnitude.x + magnitude.y <= 1.001f);
+        }
+    }
+
+    // Evaluate at texel centers so the comparison measures the fit, not the interpolation
+    const glm::vec3 normal(0.0f, 0.0f, 1.0f);
+    const glm::vec3 center(-0.6f, 0.2f, 1.5f);
+    const glm::vec3 axisX(1.0f, 0.0f, 0.0f);
+    const glm::vec3 axisY(0.0f, 0.7f, 0.0f);
+    glm::vec3 polygon[4];
+    LTC::rectanglePolygon(center, axisX, axisY, polygon);
+
+    const int cells[3][2] = {{1, 2}, {2, 4}, {4, 6}};
+    for (const auto& cell : cells) {
+        const float x = (cell[0] + 0.5f) / 8.0f;
+        const float nDotV = 1.0f - x * x;
+        const glm::vec3 view(std::sqrt(1.0f - nDotV * nDotV), 0.0f, nDotV);
+
+        BRDFMaterial material;
+        material.roughness = (cell[1] + 0.5f) / 8.0f;
+        material.metallic = 1.0f;
+        material.fresnel = 1.0f;
+        const float ltc = LTC::evaluate(table, polygon, 4, false, glm::vec3(0.0f), normal, view, material).x;
+        const float reference = integrateRectangle(center, axisX, axisY, [&](const glm::vec3& l) {
+            return cookTorranceSpecular(normal, l, view, material.roughness);
+        });
+        CHECK(ltc == doctest::Approx(reference).epsilon(0.06));
+    }
+}
+
+TEST_CASE("Built-in tables are finite and match the Cook-Torrance specular") {
+    const LTCTable& table = LTC::getBuiltinTable();
+    REQUIRE(table.getSize() == LTCFitSettings().tableSize);
+
+    // Row 0 is the smallest roughness, where the GGX peak is sharpest
+    for (int y = 0; y < table.getSize(); ++y) {
+        for (int x = 0; x < table.getSize(); ++x) {
+            const glm::vec4& matrix = table.matrix.at(x, y);
+            const glm::vec4& magnitude = table.magnitude.at(x, y);
+            CHECK(std::isfinite(matrix.x + matrix.y + matrix.z + matrix.w));
+            CHECK(std::isfinite(magnitude.x + magnitude.y));
+            CHECK(magnitude.x >= 0.0f);
+            CHECK(magnitude.x + magnitude.y <= 1.001f);
+        }
+    }
+
+    const glm::vec3 normal(0.0f, 0.0f, 1.0f);
+    const glm::vec3 center(-0.6f, 0.2f, 1.5f);
+    const glm::vec3 axisX(1.0f, 0.0f, 0.0f);
+    const glm::vec3 axisY(0.0f, 0.7f, 0.0f);
+    glm::vec3 polygon[4];
+    LTC::rectanglePolygon(center, axisX, axisY, polygon);
+
+    const int size = table.getSize();
+    const int cells[3][2] = {{10, 20}, {20, 36}, {36, 52}};
+    for (const auto& cell : cells) {
+        const float x = (cell[0] + 0.5f) / size;
+        const float nDotV = 1.0f - x * x;
+        const glm::vec3 view(std::sqrt(1.0f - nDotV * nDotV), 0.0f, nDotV);
+
+        BRDFMaterial material;
+        material.roughness = (cell[1] + 0.5f) / size;
+        material.metallic = 1.0f;
+        material.fresnel = 1.0f;
+        const float ltc = LTC::evaluate(table, polygon, 4, false, glm::vec3(0.0f), normal, view, material).x;
+        const float reference = integrateRectangle(center, axisX, axisY, [&](const glm::vec3& l) {
+            return cookTorranceSpecular(normal, l, view, material.roughness);
+        });
+        CHECK(ltc == doctest::Approx(reference).epsilon(0.06));
+    }
+}
+
+TEST_CASE("LTC tables round-trip through the binary asset") {
+    LTCFitSettings settings;
+    settings.tableSize = 4;
+    settings.sampleCount = 64;
+    settings.maxIterations = 50;
+
+    const std::string path = (std::filesystem::temp_directory_path() / "elemental_ltc_test.bin").string();
+    std::remove(path.c_str());
+
+    const LTCTable fitted = LTC::loadOrFit(path, settings);
+    LTCTable loaded;
+    REQUIRE(LTC::loadFromFile(path, loaded, 4));
+    CHECK(loaded.matrix.at(3, 2).y == fitted.matrix.at(3, 2).y);
+    CHECK(loaded.magnitude.at(1, 3).x == fitted.magnitude.at(1, 3).x);
+    CHECK_FALSE(LTC::loadFromFile(path, loaded, 8));
+
+    // A different size refits and replaces the asset
+    settings.tableSize = 3;
+    CHECK(LTC::loadOrFit(path, settings).getSize() == 3);
+    CHECK(LTC::loadFromFile(path, loaded, 3));
+    std::remove(path.c_str());
+}
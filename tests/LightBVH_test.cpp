@@ -0,0 +1,178 @@
+/**
+ * @file LightBVH_test.cpp
+ * @brief Tests for the light BVH used for many-light importance sampling
+ */
+
+#include "doctest/doctest.h"
+#include "PathTracing/LightBVH.h"
+#include <cmath>
+#include <random>
+
+using namespace ElementalRenderer;
+
+namespace {
+
+const float kPi = 3.14159265358979f;
+
+LightEmitter pointEmitter(const glm::vec3& position, float power) {
+    LightEmitter emitter;
+    emitter.bounds.bounds = BoundingBox(position, position);
+    emitter.bounds.power = power;
+    return emitter;
+}
+
+// A 64 x 64 grid of point lights over a large floor, with power varying over four orders of magnitude
+std::vector<LightEmitter> makeLightGrid() {
+    std::vector<LightEmitter> emitters;
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> exponent(0.0f, 4.0f);
+    for (int y = 0; y < 64; ++y) {
+        for (int x = 0; x < 64; ++x) {
+            const glm::vec3 position(x * 2.0f - 63.0f, 3.0f, y * 2.0f - 63.0f);
+            emitters.push_back(pointEmitter(position, std::pow(10.0f, exponent(random))));
+        }
+    }
+    return emitters;
+}
+
+// Irradiance from one point light of the grid onto an upward-facing floor point
+float irradiance(const LightEmitter& emitter, const glm::vec3& point) {
+    const glm::vec3 toLight = emitter.bounds.bounds.getCenter() - point;
+    const float distance2 = glm::dot(toLight, toLight);
+    const float cosine = std::max(toLight.y, 0.0f) / std::sqrt(distance2);
+    return emitter.bounds.power / (4.0f * kPi) * cosine / distance2;
+}
+
+} // namespace
+
+TEST_CASE("Light BVH probabilities are normalized and match sampling") {
+    const std::vector<LightEmitter> emitters = makeLightGrid();
+    LightBVH bvh;
+    bvh.build(emitters);
+    CHECK(bvh.getNodeCount() == 2 * emitters.size() - 1);
+    CHECK(bvh.getRootBounds().cosThetaO == -1.0f);
+
+    const glm::vec3 point(10.0f, 0.0f, -20.0f);
+    const glm::vec3 normal(0.0f, 1.0f, 0.0f);
+    double total = 0.0;
+    for (size_t i = 0; i < emitters.size(); ++i) {
+        total += bvh.probability(point, normal, i);
+    }
+    CHECK(total == doctest::Approx(1.0).epsilon(1e-3));
+
+    // The returned probability is the one probability() reports
+    for (int i = 0; i < 64; ++i) {
+        size_t index;
+        float p;
+        REQUIRE(bvh.sample(point, normal, (i + 0.5f) / 64.0f, index, p));
+        CHECK(p == doctest::Approx(bvh.probability(point, normal, index)).epsilon(1e-4));
+    }
+
+    // One-sided emitters facing away from a point are never chosen
+    LightEmitter panel = pointEmitter(glm::vec3(0.0f, 3.0f, 0.0f), 10.0f);
+    panel.bounds.bounds = BoundingBox(glm::vec3(-1.0f, 3.0f, -1.0f), glm::vec3(1.0f, 3.0f, 1.0f));
+    panel.bounds.direction = glm::vec3(0.0f, -1.0f, 0.0f);
+    panel.bounds.cosThetaO = 1.0f;
+    LightBVH single;
+    single.build({panel});
+    size_t index;
+    float p;
+    CHECK(single.sample(point, normal, 0.5f, index, p));
+    CHECK_FALSE(single.sample(glm::vec3(0.0f, 10.0f, 0.0f), normal, 0.5f, index, p));
+
+    // Infinite lights take a share of the probability by count
+    std::vector<LightEmitter> withSun = emitters;
+    LightEmitter sun;
+    sun.infinite = true;
+    sun.bounds.power = 1.0f;
+    withSun.push_back(sun);
+    bvh.build(withSun);
+    CHECK(bvh.probability(point, normal, withSun.size() - 1) == doctest::Approx(0.5f));
+    REQUIRE(bvh.sample(point, normal, 0.25f, index, p));
+    CHECK(index == withSun.size() - 1);
+}
+
+TEST_CASE("Light BVH refits incrementally when lights move") {
+    std::vector<LightEmitter> emitters = makeLightGrid();
+    LightBVH bvh;
+    bvh.build(emitters);
+
+    // Move one light next to the shading point: only its path to the root is recomputed
+    const glm::vec3 point(40.0f, 0.0f, 40.0f);
+    const glm::vec3 normal(0.0f, 1.0f, 0.0f);
+    const float before = bvh.probability(point, normal, 5);
+    LightEmitter moved = pointEmitter(point + glm::vec3(0.0f, 0.5f, 0.0f), 1000.0f);
+    bvh.updateEmitter(5, moved);
+    const size_t recomputed = bvh.refit();
+    CHECK(recomputed > 1);
+    CHECK(recomputed < 40);
+    CHECK(bvh.getRootBounds().bounds.contains(point + glm::vec3(0.0f, 0.5f, 0.0f)));
+    CHECK(bvh.probability(point, normal, 5) > 100.0f * before);
+
+    double total = 0.0;
+    for (size_t i = 0; i < emitters.size(); ++i) {
+        total += bvh.probability(point, normal, i);
+    }
+    CHECK(total == doctest::Approx(1.0).epsilon(1e-3));
+
+    // Switching a light off takes it out of the tree on the next refit
+    moved.bounds.power = 0.0f;
+    bvh.updateEmitter(5, moved);
+    bvh.refit();
+    CHECK(bvh.getNodeCount() == 2 * emitters.size() - 3);
+    CHECK(bvh.probability(point, normal, 5) == 0.0f);
+}
+
+TEST_CASE("Light BVH sampling converges faster than uniform selection") {
+    const std::vector<LightEmitter> emitters = makeLightGrid();
+    LightBVH bvh;
+    bvh.build(emitters);
+
+    const glm::vec3 points[3] = {glm::vec3(0.0f), glm::vec3(-50.0f, 0.0f, 30.0f), glm::vec3(63.0f, 0.0f, 63.0f)};
+    const glm::vec3 normal(0.0f, 1.0f, 0.0f);
+    std::mt19937 random(11);
+    std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+
+    for (const glm::vec3& point : points) {
+        double reference = 0.0;
+        for (const LightEmitter& emitter : emitters) {
+            reference += irradiance(emitter, point);
+        }
+
+        // Relative variance of a one-sample estimator, exact from the selection probabilities
+        double bvhMoment = 0.0;
+        double uniformMoment = 0.0;
+        for (size_t i = 0; i < emitters.size(); ++i) {
+            const double f = irradiance(emitters[i], point) / reference;
+            const double p = bvh.probability(point, normal, i);
+            if (f > 0.0) {
+                REQUIRE(p > 0.0);
+                bvhMoment += f * f / p;
+            }
+            uniformMoment += f * f * emitters.size();
+        }
+        CHECK((bvhMoment - 1.0) * 16.0 < uniformMoment - 1.0);
+
+        // The sampled estimate converges: relative RMS error over repeated trials falls with the sample count
+        float previousError = 1e30f;
+        for (int sampleCount : {4, 16, 64}) {
+            const int trials = 64;
+            double squaredError = 0.0;
+            for (int trial = 0; trial < trials; ++trial) {
+                double estimate = 0.0;
+                for (int s = 0; s < sampleCount; ++s) {
+                    size_t index;
+                    float p;
+                    if (bvh.sample(point, normal, uniform(random), index, p)) {
+                        estimate += irradiance(emitters[index], point) / p;
+                    }
+                }
+                squaredError += std::pow(estimate / sampleCount / reference - 1.0, 2.0);
+            }
+            const float error = static_cast<float>(std::sqrt(squaredError / trials));
+            CHECK(error < previousError);
+            previousError = error;
+        }
+        CHECK(previousError < 0.25f);
+    }
+}
@@ -0,0 +1,197 @@
+/**
+ * @file LightRegistry_test.cpp
+ * @brief Tests for the structure-of-arrays light registry
+ */
+
+#include "doctest/doctest.h"
+#include "Lighting/LightRegistry.h"
+#include "Light.h"
+#include "Scene.h"
+#include <cmath>
+
+using namespace ElementalRenderer;
+
+namespace {
+
+LightDesc pointLight(float x, float intensity = 1.0f) {
+    LightDesc desc;
+    desc.type = LightType::POINT;
+    desc.position = glm::vec3(x, 1.0f, 0.0f);
+    desc.intensity = intensity;
+    return desc;
+}
+
+} // namespace
+
+TEST_CASE("Light registry handles survive removal of other lights") {
+    LightRegistry registry;
+    LightHandle handles[5];
+    for (int i = 0; i < 5; ++i) {
+        handles[i] = registry.add(pointLight(static_cast<float>(i)));
+    }
+    CHECK(registry.getLightCount() == 5);
+
+    REQUIRE(registry.remove(handles[1]));
+    CHECK_FALSE(registry.remove(handles[1]));
+    CHECK_FALSE(registry.contains(handles[1]));
+    CHECK(registry.getPointLights().size() == 4);
+
+    // The last light moved into the hole, but every handle still finds its light
+    LightDesc desc;
+    for (int i : {0, 2, 3, 4}) {
+        REQUIRE(registry.getDesc(handles[i], desc));
+        CHECK(desc.position.x == static_cast<float>(i));
+    }
+
+    // A reused slot does not revive the stale handle
+    const LightHandle reused = registry.add(pointLight(9.0f));
+    CHECK(reused.slot == handles[1].slot);
+    CHECK(reused != handles[1]);
+    CHECK_FALSE(registry.getDesc(handles[1], desc));
+    CHECK_FALSE(registry.update(handles[1], pointLight(7.0f)));
+    CHECK_FALSE(registry.contains(LightHandle()));
+
+    registry.clear();
+    CHECK(registry.getLightCount() == 0);
+    CHECK_FALSE(registry.contains(handles[0]));
+    CHECK_FALSE(registry.contains(reused));
+}
+
+TEST_CASE("Light registry updates move lights between type tables") {
+    LightRegistry registry;
+    const LightHandle first = registry.add(pointLight(1.0f));
+    const LightHandle second = registry.add(pointLight(2.0f));
+
+    const uint64_t before = registry.getVersion();
+    CHECK(registry.getVersion(first) < before);
+    LightDesc spot;
+    spot.type = LightType::SPOT;
+    spot.position = glm::vec3(0.0f, 3.0f, 0.0f);
+    spot.innerAngle = 20.0f;
+    spot.outerAngle = 35.0f;
+    REQUIRE(registry.update(first, spot));
+    CHECK(registry.getVersion() > before);
+    CHECK(registry.getVersion(first) == registry.getVersion());
+    CHECK(registry.getVersion(second) == before);
+
+    CHECK(registry.getPointLights().size() == 1);
+    CHECK(registry.getPointLights().positions[0].x == 2.0f);
+    REQUIRE(registry.getSpotLights().size() == 1);
+    CHECK(registry.getSpotLights().cosOuter[0] == doctest::Approx(std::cos(35.0f * 3.14159265f / 180.0f)));
+
+    LightDesc desc;
+    REQUIRE(registry.getDesc(first, desc));
+    CHECK(desc.type == LightType::SPOT);
+    CHECK(desc.innerAngle == doctest::Approx(20.0f).epsilon(1e-4));
+    CHECK(desc.outerAngle == doctest::Approx(35.0f).epsilon(1e-4));
+    REQUIRE(registry.getDesc(second, desc));
+    CHECK(desc.position.x == 2.0f);
+}
+
+TEST_CASE("Light registry packs a GPU buffer grouped by type") {
+    CHECK(sizeof(PackedLight) == 80);
+
+    LightRegistry registry;
+    LightDesc area;
+    area.type = LightType::AREA;
+    area.shape = AreaLightShape::DISK;
+    area.axisX = glm::vec3(0.0f, 0.0f, 1.0f);
+    area.axisY = glm::vec3(1.0f, 0.0f, 0.0f);
+    area.twoSided = true;
+    area.castShadows = false;
+    area.color = glm::vec3(1.0f, 0.5f, 0.25f);
+    area.intensity = 4.0f;
+    registry.add(area);
+    registry.add(pointLight(1.0f, 2.0f));
+    LightDesc sun;
+    sun.type = LightType::DIRECTIONAL;
+    registry.add(sun);
+    registry.add(pointLight(2.0f));
+
+    std::vector<PackedLight> buffer;
+    const LightBufferLayout layout = registry.pack(buffer);
+    REQUIRE(buffer.size() == 4);
+    const int directional = static_cast<int>(LightType::DIRECTIONAL);
+    const int point = static_cast<int>(LightType::POINT);
+    const int areaIndex = static_cast<int>(LightType::AREA);
+    CHECK(layout.offsets[directional] == 0);
+    CHECK(layout.counts[directional] == 1);
+    CHECK(layout.offsets[point] == 1);
+    CHECK(layout.counts[point] == 2);
+    CHECK(layout.counts[static_cast<int>(LightType::SPOT)] == 0);
+    CHECK(layout.offsets[areaIndex] == 3);
+
+    const PackedLight& packedPoint = buffer[layout.offsets[point]];
+    CHECK(packedPoint.positionType.x == 1.0f);
+    CHECK(packedPoint.positionType.w == static_cast<float>(point));
+    CHECK(packedPoint.radianceFlags.x == 2.0f);
+    CHECK(packedPoint.radianceFlags.w == static_cast<float>(PackedLight::kPackedCastShadows));
+
+    const PackedLight& packedArea = buffer[layout.offsets[areaIndex]];
+    CHECK(packedArea.radianceFlags.y == 2.0f);
+    CHECK(packedArea.radianceFlags.w == static_cast<float>(PackedLight::kPackedDisk | PackedLight::kPackedTwoSided));
+    CHECK(packedArea.axisXCosInner.z == 1.0f);
+    // Emits along axisY x axisX
+    CHECK(packedArea.directionRange.y == doctest::Approx(-1.0f));
+}
+
+TEST_CASE("Light descriptions match scene lights") {
+    auto spot = Light::createSpotLight(glm::vec3(1.0f, 2.0f, 3.0f), glm::vec3(0.0f, -1.0f, 0.0f),
+                                       glm::vec3(0.5f), 3.0f, 12.0f, 15.0f, 25.0f);
+    const LightDesc spotDesc = LightDesc::fromLight(*spot);
+    CHECK(spotDesc.type == LightType::SPOT);
+    CHECK(spotDesc.position.z == 3.0f);
+    CHECK(spotDesc.intensity == 3.0f);
+    CHECK(spotDesc.range == 12.0f);
+    CHECK(spotDesc.outerAngle == 25.0f);
+
+    auto area = Light::createAreaLight(AreaLightShape::RECTANGLE, glm::vec3(0.0f, 4.0f, 0.0f),
+                                       glm::vec3(0.0f, -1.0f, 0.0f), glm::vec2(2.0f, 1.0f));
+    const LightDesc areaDesc = LightDesc::fromLight(*area);
+    CHECK(areaDesc.type == LightType::AREA);
+    CHECK(glm::length(areaDesc.axisX) == doctest::Approx(1.0f));
+    CHECK(glm::length(areaDesc.axisY) == doctest::Approx(0.5f));
+
+    // The registry reproduces the emission direction from the axes
+    LightRegistry registry;
+    LightDesc roundTrip;
+    REQUIRE(registry.getDesc(registry.add(areaDesc), roundTrip));
+    CHECK(roundTrip.direction.y == doctest::Approx(-1.0f));
+}
+
+TEST_CASE("Scene light registry follows lights reported as changed") {
+    Scene scene;
+    scene.addLight(Light::createPointLight(glm::vec3(0.0f, 2.0f, 0.0f), glm::vec3(1.0f), 1.0f, 10.0f));
+    auto spot = Light::createSpotLight(glm::vec3(1.0f, 2.0f, 3.0f), glm::vec3(0.0f, -1.0f, 0.0f),
+                                       glm::vec3(1.0f), 1.0f, 12.0f, 15.0f, 25.0f);
+    scene.addLight(spot);
+    const uint64_t version = scene.getLightRegistry().getVersion();
+
+    // Setters on the shared pointer are invisible until they are reported
+    auto point = std::dynamic_pointer_cast<PointLight>(scene.getLight(0));
+    REQUIRE(point);
+    point->setPosition(glm::vec3(4.0f, 5.0f, 6.0f));
+    point->setColor(glm::vec3(1.0f, 0.5f, 0.25f));
+    point->setIntensity(3.0f);
+    CHECK(scene.getLightRegistry().getVersion() == version);
+    CHECK(scene.getLightRegistry().getPointLights().positions[0] == glm::vec3(0.0f, 2.0f, 0.0f));
+
+    // What the light properties panel does after an edit
+    scene.notifyLightChanged(0);
+    const LightRegistry& registry = scene.getLightRegistry();
+    CHECK(registry.getVersion() == version + 1);
+    const PointLightColumns& points = registry.getPointLights();
+    REQUIRE(points.size() == 1);
+    CHECK(points.positions[0] == glm::vec3(4.0f, 5.0f, 6.0f));
+    CHECK(points.colors[0] == glm::vec3(1.0f, 0.5f, 0.25f));
+    CHECK(points.intensities[0] == 3.0f);
+
+    // Indices shift after a removal; the remaining light keeps its handle
+    scene.removeLight(0);
+    std::static_pointer_cast<SpotLight>(spot)->setRange(20.0f);
+    scene.notifyLightChanged(0);
+    LightDesc desc;
+    REQUIRE(scene.getLightRegistry().getDesc(scene.getLightHandle(0), desc));
+    CHECK(desc.range == 20.0f);
+    CHECK(scene.getLightRegistry().getPointLights().size() == 0);
+}
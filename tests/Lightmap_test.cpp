@@ -0,0 +1,294 @@
+/**
+ * @file Lightmap_test.cpp
+ * @brief Tests for lightmap unwrapping and the CPU lightmap baker
+ */
+
+#include "doctest/doctest.h"
+#include "Lighting/LightmapUnwrapper.h"
+#include "Lighting/LightmapBaker.h"
+#include "PathTracing/PathTracer.h"
+#include "Headless/Parallel.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace ElementalRenderer;
+
+namespace {
+
+const float kPi = 3.14159265358979f;
+
+struct TestMesh {
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> normals;
+    std::vector<unsigned int> indices;
+
+    // Two triangles with their own four vertices, facing edgeA x edgeB
+    void addQuad(const glm::vec3& corner, const glm::vec3& edgeA, const glm::vec3& edgeB) {
+        const unsigned int base = static_cast<unsigned int>(positions.size());
+        const glm::vec3 normal = glm::normalize(glm::cross(edgeA, edgeB));
+        for (const glm::vec3& position : {corner, corner + edgeA, corner + edgeA + edgeB, corner + edgeB}) {
+            positions.push_back(position);
+            normals.push_back(normal);
+        }
+        for (unsigned int index : {0u, 1u, 2u, 0u, 2u, 3u}) {
+            indices.push_back(base + index);
+        }
+    }
+};
+
+// Cube of half size 1 with its 8 corners shared by all faces, two triangles per face
+TestMesh sharedCube() {
+    TestMesh mesh;
+    for (int i = 0; i < 8; ++i) {
+        mesh.positions.push_back(glm::vec3(i & 1 ? 1.0f : -1.0f, i & 2 ? 1.0f : -1.0f, i & 4 ? 1.0f : -1.0f));
+    }
+    mesh.indices = {0, 2, 3, 0, 3, 1,  4, 5, 7, 4, 7, 6,  0, 1, 5, 0, 5, 4,
+                    2, 6, 7, 2, 7, 3,  0, 4, 6, 0, 6, 2,  1, 3, 7, 1, 7, 5};
+    return mesh;
+}
+
+LightmapSurface makeSurface(const TestMesh& mesh, const LightmapUnwrap& unwrap) {
+    LightmapSurface surface;
+    for (unsigned int vertex : unwrap.vertexMap) {
+        surface.positions.push_back(mesh.positions[vertex]);
+        surface.normals.push_back(mesh.normals[vertex]);
+    }
+    surface.lightmapCoords = unwrap.lightmapCoords;
+    surface.indices = unwrap.indices;
+    return surface;
+}
+
+// World position at a texel center, or false if no triangle covers it
+bool texelPosition(const LightmapSurface& surface, const glm::vec2& uv, glm::vec3& position) {
+    for (size_t i = 0; i + 2 < surface.indices.size(); i += 3) {
+        const glm::vec2 a = surface.lightmapCoords[surface.indices[i]];
+        const glm::vec2 e1 = surface.lightmapCoords[surface.indices[i + 1]] - a;
+        const glm::vec2 e2 = surface.lightmapCoords[surface.indices[i + 2]] - a;
+        const glm::vec2 d = uv - a;
+        const float area = e1.x * e2.y - e1.y * e2.x;
+        const float u = (d.x * e2.y - d.y * e2.x) / area;
+        const float v = (e1.x * d.y - e1.y * d.x) / area;
+        if (u >= -1e-4f && v >= -1e-4f && u + v <= 1.0f + 1e-4f) {
+            position = surface.positions[surface.indices[i]] * (1.0f - u - v)
+                     + surface.positions[surface.indices[i + 1]] * u + surface.positions[surface.indices[i + 2]] * v;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Lambertian material, as in the path tracer tests
+PathTracerMaterial lambert(float albedo) {
+    PathTracerMaterial material;
+    material.model = BRDFModel::CUSTOM;
+    material.brdf.albedo = glm::vec3(albedo);
+    return material;
+}
+
+} // namespace
+
+TEST_CASE("Lightmap charts follow the dominant normal axis and do not overlap") {
+    const TestMesh cube = sharedCube();
+    LightmapUnwrapSettings settings;
+    settings.resolution = 64;
+    settings.padding = 2;
+    const LightmapUnwrap unwrap = LightmapUnwrapper::unwrap(cube.positions, cube.indices, settings);
+    CHECK(unwrap.chartCount == 6);
+    REQUIRE(unwrap.indices.size() == cube.indices.size());
+    REQUIRE(unwrap.vertexMap.size() == 24);
+    CHECK(unwrap.texelsPerUnit > 8.0f);
+    for (size_t i = 0; i < unwrap.indices.size(); ++i) {
+        CHECK(cube.positions[unwrap.vertexMap[unwrap.indices[i]]] == cube.positions[cube.indices[i]]);
+    }
+
+    // Uniform texel density, and padded chart rectangles are disjoint
+    glm::vec2 lower[6];
+    glm::vec2 upper[6];
+    for (int face = 0; face < 6; ++face) {
+        lower[face] = glm::vec2(1.0f);
+        upper[face] = glm::vec2(0.0f);
+        for (int i = 6 * face; i < 6 * face + 6; ++i) {
+            const glm::vec2& uv = unwrap.lightmapCoords[unwrap.indices[i]];
+            CHECK(uv.x >= 0.0f);
+            CHECK(uv.y <= 1.0f);
+            lower[face] = glm::min(lower[face], uv);
+            upper[face] = glm::max(upper[face], uv);
+        }
+        const glm::vec2 texels = (upper[face] - lower[face]) * 64.0f;
+        CHECK(texels.x == doctest::Approx(2.0f * unwrap.texelsPerUnit));
+        CHECK(texels.y == doctest::Approx(2.0f * unwrap.texelsPerUnit));
+    }
+    const float gap = settings.padding / 64.0f - 1e-5f;
+    for (int a = 0; a < 6; ++a) {
+        for (int b = a + 1; b < 6; ++b) {
+            const bool separated = lower[b].x - upper[a].x >= gap || lower[a].x - upper[b].x >= gap
+                                || lower[b].y - upper[a].y >= gap || lower[a].y - upper[b].y >= gap;
+            CHECK(separated);
+        }
+    }
+
+    // Duplicated vertices along an attribute seam still form a single chart
+    TestMesh plane;
+    plane.addQuad(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(1.0f, 0.0f, 0.0f));
+    plane.positions.push_back(plane.positions[2]);
+    plane.indices[4] = 4;
+    CHECK(LightmapUnwrapper::unwrap(plane.positions, plane.indices, settings).chartCount == 1);
+
+    // Too many charts for the atlas
+    settings.resolution = 8;
+    CHECK(LightmapUnwrapper::unwrap(cube.positions, cube.indices, settings).indices.empty());
+}
+
+TEST_CASE("Baked lightmaps match direct and environment lighting") {
+    TestMesh floor;
+    floor.addQuad(glm::vec3(-4.0f, 0.0f, -4.0f), glm::vec3(0.0f, 0.0f, 8.0f), glm::vec3(8.0f, 0.0f, 0.0f));
+    LightmapUnwrapSettings unwrapSettings;
+    unwrapSettings.resolution = 32;
+    const LightmapSurface surface = makeSurface(floor, LightmapUnwrapper::unwrap(floor.positions, floor.indices, unwrapSettings));
+
+    // Point light at height 2, with a downward-facing blocker at height 1 over x in [1, 3]
+    PathTracerScene scene;
+    scene.addMesh(floor.positions, floor.normals, floor.indices, lambert(0.5f));
+    TestMesh blocker;
+    blocker.addQuad(glm::vec3(1.0f, 1.0f, -1.0f), glm::vec3(2.0f, 0.0f, 0.0f), glm::vec3(0.0f, 0.0f, 2.0f));
+    scene.addMesh(blocker.positions, blocker.normals, blocker.indices, lambert(0.5f));
+    PathTracerLight light;
+    light.type = PathTracerLight::Type::POINT;
+    light.position = glm::vec3(0.0f, 2.0f, 0.0f);
+    light.radiance = glm::vec3(10.0f);
+    scene.lights.push_back(light);
+    PathTracer tracer;
+    tracer.setScene(scene);
+
+    LightmapBaker baker;
+    LightmapBakeSettings settings;
+    settings.width = 32;
+    settings.height = 32;
+    settings.directSamples = 1;
+    settings.bounces = 0;
+    settings.tileSize = 8;
+    baker.setSettings(settings);
+    Image lightmap;
+    REQUIRE(baker.bake(tracer, surface, lightmap));
+    REQUIRE(lightmap.getWidth() == 32);
+
+    int lit = 0;
+    int shadowed = 0;
+    int dilated = 0;
+    for (int y = 0; y < 32; ++y) {
+        for (int x = 0; x < 32; ++x) {
+            const glm::vec4& texel = lightmap.at(x, y);
+            glm::vec3 position;
+            if (texel.w == 0.0f) {
+                dilated += texel.x > 0.0f ? 1 : 0;
+                continue;
+            }
+            REQUIRE(texelPosition(surface, glm::vec2((x + 0.5f) / 32.0f, (y + 0.5f) / 32.0f), position));
+            const bool inShadow = position.x > 2.0f && position.x < 6.0f && std::abs(position.z) < 2.0f;
+            if (std::abs(position.x - 2.0f) < 0.3f || std::abs(std::abs(position.z) - 2.0f) < 0.3f) {
+                continue;
+            }
+            if (inShadow) {
+                CHECK(texel.x == 0.0f);
+                ++shadowed;
+            } else {
+                const float distance = glm::length(light.position - position);
+                const float attenuation = 1.0f / (1.0f + 0.09f * distance + 0.032f * distance * distance);
+                const float expected = 10.0f * attenuation * (2.0f / distance) / kPi;
+                CHECK(texel.x == doctest::Approx(expected).epsilon(0.001));
+                ++lit;
+            }
+        }
+    }
+    CHECK(lit > 300);
+    CHECK(shadowed > 20);
+    CHECK(dilated > 0);
+
+    // One bounce under a constant sky: every hemisphere ray escapes
+    PathTracerScene sky;
+    sky.addMesh(floor.positions, floor.normals, floor.indices, lambert(0.5f));
+    sky.environment = glm::vec3(0.25f, 0.5f, 1.0f);
+    tracer.setScene(sky);
+    settings.directSamples = 4;
+    settings.indirectSamples = 16;
+    settings.bounces = 1;
+    baker.setSettings(settings);
+    REQUIRE(baker.bake(tracer, surface, lightmap));
+    const glm::vec2 center = surface.lightmapCoords[surface.indices[0]] * 0.5f + surface.lightmapCoords[surface.indices[2]] * 0.5f;
+    const glm::vec4& texel = lightmap.at(static_cast<int>(center.x * 32.0f), static_cast<int>(center.y * 32.0f));
+    CHECK(texel.w == 1.0f);
+    CHECK(texel.x == doctest::Approx(0.25f));
+    CHECK(texel.z == doctest::Approx(1.0f));
+}
+
+TEST_CASE("Lightmap bakes report progress, cancel and do not depend on the thread count") {
+    TestMesh room;
+    room.addQuad(glm::vec3(-2.0f, 0.0f, -2.0f), glm::vec3(0.0f, 0.0f, 4.0f), glm::vec3(4.0f, 0.0f, 0.0f));
+    room.addQuad(glm::vec3(-2.0f, 0.0f, -2.0f), glm::vec3(0.0f, 2.0f, 0.0f), glm::vec3(0.0f, 0.0f, 4.0f));
+    room.addQuad(glm::vec3(-2.0f, 0.0f, -2.0f), glm::vec3(4.0f, 0.0f, 0.0f), glm::vec3(0.0f, 2.0f, 0.0f));
+    LightmapUnwrapSettings unwrapSettings;
+    unwrapSettings.resolution = 48;
+    const LightmapSurface surface = makeSurface(room, LightmapUnwrapper::unwrap(room.positions, room.indices, unwrapSettings));
+
+    PathTracerScene scene;
+    scene.addMesh(room.positions, room.normals, room.indices, lambert(0.8f));
+    PathTracerLight light;
+    light.type = PathTracerLight::Type::AREA;
+    light.position = glm::vec3(0.5f, 1.5f, 0.5f);
+    light.radiance = glm::vec3(4.0f);
+    light.twoSided = true;
+    scene.lights.push_back(light);
+    scene.environment = glm::vec3(0.1f);
+    PathTracer tracer;
+    tracer.setScene(scene);
+
+    LightmapBaker baker;
+    LightmapBakeSettings settings;
+    settings.width = 48;
+    settings.height = 48;
+    settings.directSamples = 4;
+    settings.indirectSamples = 8;
+    settings.tileSize = 16;
+    baker.setSettings(settings);
+    int calls = 0;
+    int lastCompleted = 0;
+    baker.setProgressCallback([&](int completed, int tileCount) {
+        ++calls;
+        lastCompleted = std::max(lastCompleted, completed);
+        CHECK(tileCount == 9);
+    });
+    Image first;
+    REQUIRE(baker.bake(tracer, surface, first));
+    CHECK(calls == 9);
+    CHECK(lastCompleted == 9);
+    CHECK(baker.getProgress() == 1.0f);
+
+    const unsigned int threads = Parallel::getThreadCount();
+    Parallel::setThreadCount(1);
+    Image singleThreaded;
+    REQUIRE(baker.bake(tracer, surface, singleThreaded));
+    Parallel::setThreadCount(threads);
+    bool identical = true;
+    for (int y = 0; y < 48; ++y) {
+        for (int x = 0; x < 48; ++x) {
+            identical = identical && first.at(x, y) == singleThreaded.at(x, y);
+        }
+    }
+    CHECK(identical);
+
+    // Cancelling leaves the previous lightmap untouched
+    baker.setProgressCallback([&](int, int) { baker.cancel(); });
+    Image cancelled(2, 2, glm::vec4(7.0f));
+    CHECK_FALSE(baker.bake(tracer, surface, cancelled));
+    CHECK(cancelled.getWidth() == 2);
+    baker.setProgressCallback(nullptr);
+    baker.cancel();
+    CHECK_FALSE(baker.bake(tracer, surface, cancelled));
+    CHECK(baker.bake(tracer, surface, cancelled));
+    CHECK(cancelled.getWidth() == 48);
+
+    // Inconsistent surfaces are rejected
+    LightmapSurface broken = surface;
+    broken.lightmapCoords.pop_back();
+    CHECK_FALSE(baker.bake(tracer, broken, cancelled));
+}
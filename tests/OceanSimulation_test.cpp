@@ -0,0 +1,131 @@
+/**
+ * @file OceanSimulation_test.cpp
+ * @brief Tests for the 2D FFT and the FFT ocean
+ */
+
+#include "doctest/doctest.h"
+#include "Headless/FFT.h"
+#include "Headless/OceanSimulation.h"
+#include <cmath>
+#include <random>
+
+using namespace ElementalRenderer;
+
+TEST_CASE("FFT2D matches a direct DFT and round-trips") {
+    const int n = 16;
+    FFT2D fft(n);
+    REQUIRE(fft.getSize() == n);
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> uniform(-1.0f, 1.0f);
+    std::vector<float> re(n * n), im(n * n);
+    for (int i = 0; i < n * n; ++i) {
+        re[i] = uniform(rng);
+        im[i] = uniform(rng);
+    }
+    std::vector<float> outRe = re, outIm = im;
+    fft.inverse(outRe.data(), outIm.data());
+
+    double maxError = 0.0;
+    for (int y = 0; y < n; ++y) {
+        for (int x = 0; x < n; ++x) {
+            double sumRe = 0.0, sumIm = 0.0;
+            for (int ky = 0; ky < n; ++ky) {
+                for (int kx = 0; kx < n; ++kx) {
+                    const double angle = 2.0 * 3.14159265358979 * (kx * x + ky * y) / n;
+                    const double c = std::cos(angle), s = std::sin(angle);
+                    sumRe += re[ky * n + kx] * c - im[ky * n + kx] * s;
+                    sumIm += re[ky * n + kx] * s + im[ky * n + kx] * c;
+                }
+            }
+            maxError = std::max(maxError, std::abs(sumRe - outRe[y * n + x]));
+            maxError = std::max(maxError, std::abs(sumIm - outIm[y * n + x]));
+        }
+    }
+    CHECK(maxError < 1e-4);
+
+    fft.forward(outRe.data(), outIm.data());
+    for (int i = 0; i < n * n; ++i) {
+        CHECK(outRe[i] / (n * n) == doctest::Approx(re[i]).epsilon(1e-4));
+        CHECK(outIm[i] / (n * n) == doctest::Approx(im[i]).epsilon(1e-4));
+    }
+}
+
+TEST_CASE("Ocean heights follow the spectrum and the surface tiles") {
+    OceanSettings settings;
+    settings.resolution = 128;
+    settings.patchSize = 500.0f;
+    settings.windSpeed = 10.0f; // peak well above the patch's lowest wave numbers
+    OceanSimulation ocean(settings);
+    ocean.update(3.0f);
+
+    const Image& displacement = ocean.getDisplacement();
+    REQUIRE(displacement.getWidth() == 128);
+    double mean = 0.0, variance = 0.0;
+    for (int z = 0; z < 128; ++z) {
+        for (int x = 0; x < 128; ++x) {
+            mean += displacement.at(x, z).y;
+            variance += displacement.at(x, z).y * displacement.at(x, z).y;
+        }
+    }
+    mean /= 128.0 * 128.0;
+    variance /= 128.0 * 128.0;
+    CHECK(std::abs(mean) < 1e-3);
+    // One random realization stays close to the expected energy
+    CHECK(variance == doctest::Approx(ocean.getExpectedHeightVariance()).epsilon(0.25));
+    CHECK(4.0 * std::sqrt(variance) > 1.0); // a 10 m/s wind raises metre-scale seas
+
+    // Normals are unit length and point up
+    for (int z = 0; z < 128; z += 7) {
+        for (int x = 0; x < 128; x += 5) {
+            const glm::vec4& normal = ocean.getNormals().at(x, z);
+            CHECK(glm::length(glm::vec3(normal.x, normal.y, normal.z)) == doctest::Approx(1.0f));
+            CHECK(normal.y > 0.0f);
+        }
+    }
+
+    // Sampling wraps every patch and hits grid points exactly
+    const glm::vec3 atGrid = ocean.sampleDisplacement(glm::vec2(62.5f, 125.0f));
+    const glm::vec4& texel = displacement.at(16, 32);
+    CHECK(atGrid.y == doctest::Approx(texel.y));
+    const glm::vec3 wrapped = ocean.sampleDisplacement(glm::vec2(62.5f - 500.0f, 125.0f + 1000.0f));
+    CHECK(wrapped.y == doctest::Approx(atGrid.y).epsilon(1e-3));
+}
+
+TEST_CASE("Wind shapes the waves and the result is deterministic") {
+    OceanSettings settings;
+    settings.resolution = 64;
+    settings.spectrum = OceanSpectrum::JONSWAP;
+    settings.windDirection = glm::vec2(1.0f, 0.0f);
+    OceanSimulation ocean(settings);
+    ocean.update(1.5f);
+
+    // Waves run along x, so slopes are steeper along x than across
+    double slopeX = 0.0, slopeZ = 0.0;
+    double minJacobian = 1.0;
+    for (int z = 0; z < 64; ++z) {
+        for (int x = 0; x < 64; ++x) {
+            const glm::vec4& normal = ocean.getNormals().at(x, z);
+            slopeX += normal.x * normal.x;
+            slopeZ += normal.z * normal.z;
+            minJacobian = std::min(minJacobian, static_cast<double>(ocean.getDisplacement().at(x, z).w));
+        }
+    }
+    CHECK(slopeX > 2.0 * slopeZ);
+    CHECK(minJacobian < 1.0); // crests compress under choppy displacement
+
+    std::vector<unsigned char> dudv, normals;
+    ocean.encodeWaterMaps(dudv, normals);
+    REQUIRE(dudv.size() == 64 * 64 * 4);
+    REQUIRE(normals.size() == dudv.size());
+    CHECK(normals[2] > 60); // b stores ny / 3, close to 85 for a nearly flat surface
+
+    OceanSimulation again(settings);
+    again.update(1.5f);
+    CHECK(again.getDisplacement().at(10, 20).y == ocean.getDisplacement().at(10, 20).y);
+
+    // Stronger wind means larger seas
+    settings.windSpeed = 30.0f;
+    OceanSimulation stormy(settings);
+    CHECK(stormy.getExpectedHeightVariance() > ocean.getExpectedHeightVariance());
+}
@@ -0,0 +1,102 @@
+/**
+ * @file PainterlyFilter_test.cpp
+ * @brief Tests for the anisotropic Kuwahara filter
+ */
+
+#include "doctest/doctest.h"
+#include "Headless/PainterlyFilter.h"
+#include "Headless/Parallel.h"
+#include <cmath>
+#include <random>
+
+using namespace ElementalRenderer;
+
+namespace {
+
+// Two flat regions split by the line a*x + b*y = c, with mild noise
+Image makeNoisyStep(int width, int height, float a, float b, float c, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> noise(-0.04f, 0.04f);
+    Image image(width, height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            float base = a * x + b * y < c ? 0.2f : 0.8f;
+            image.at(x, y) = glm::vec4(base + noise(rng), base + noise(rng), base + noise(rng), 1.0f);
+        }
+    }
+    return image;
+}
+
+double regionVariance(const Image& image, int x0, int y0, int x1, int y1, float expected) {
+    double sum = 0.0;
+    int count = 0;
+    for (int y = y0; y < y1; ++y) {
+        for (int x = x0; x < x1; ++x) {
+            double d = image.at(x, y).x - expected;
+            sum += d * d;
+            ++count;
+        }
+    }
+    return sum / count;
+}
+
+} // namespace
+
+TEST_CASE("Structure tensor follows the dominant gradient") {
+    Image vertical = makeNoisyStep(40, 40, 1.0f, 0.0f, 20.0f, 1);
+    Image tensor;
+    PainterlyFilter::computeStructureTensor(vertical, 2.0f, tensor);
+    const glm::vec4& t = tensor.at(20, 20);
+    CHECK(t.x > 10.0f * t.z);
+    CHECK(std::abs(t.y) < 0.1f * t.x);
+}
+
+TEST_CASE("Painterly filter flattens regions and keeps edges") {
+    PainterlySettings settings;
+    settings.radius = 6;
+    settings.tileSize = 32; // several tiles so seams are exercised
+
+    Image vertical = makeNoisyStep(96, 80, 1.0f, 0.0f, 48.0f, 2);
+    Image filtered;
+    PainterlyFilter::apply(vertical, filtered, settings);
+
+    CHECK(regionVariance(filtered, 4, 4, 40, 76, 0.2f) < 0.25 * regionVariance(vertical, 4, 4, 40, 76, 0.2f));
+    for (int y = 10; y < 70; y += 7) {
+        CHECK(filtered.at(45, y).x == doctest::Approx(0.2f).epsilon(0.15));
+        CHECK(filtered.at(50, y).x == doctest::Approx(0.8f).epsilon(0.05));
+        CHECK(filtered.at(50, y).w == doctest::Approx(1.0f));
+    }
+
+    // Diagonal edges go through the rotated frames
+    Image diagonal = makeNoisyStep(96, 96, 1.0f, 1.0f, 96.0f, 3);
+    PainterlyFilter::apply(diagonal, diagonal, settings);
+    for (int i = 20; i < 76; i += 9) {
+        CHECK(diagonal.at(i, 96 - i - 4).x == doctest::Approx(0.2f).epsilon(0.15));
+        CHECK(diagonal.at(i, 96 - i + 3).x == doctest::Approx(0.8f).epsilon(0.05));
+    }
+}
+
+TEST_CASE("Painterly filter is deterministic and preserves constant images") {
+    Image flat(70, 50, glm::vec4(0.3f, 0.5f, 0.7f, 0.25f));
+    PainterlyFilter::apply(flat, flat, PainterlySettings::watercolor());
+    CHECK(flat.at(0, 0).x == doctest::Approx(0.3f));
+    CHECK(flat.at(69, 49).z == doctest::Approx(0.7f));
+    CHECK(flat.at(35, 25).w == doctest::Approx(0.25f));
+
+    Image source = makeNoisyStep(100, 60, 0.3f, 1.0f, 40.0f, 4);
+    unsigned int previous = Parallel::getThreadCount();
+    Image serial, threaded;
+    Parallel::setThreadCount(1);
+    PainterlyFilter::apply(source, serial, PainterlySettings::illustration());
+    Parallel::setThreadCount(4);
+    PainterlyFilter::apply(source, threaded, PainterlySettings::illustration());
+    Parallel::setThreadCount(previous);
+
+    bool identical = true;
+    for (int y = 0; y < 60; ++y) {
+        for (int x = 0; x < 100; ++x) {
+            identical = identical && serial.at(x, y) == threaded.at(x, y);
+        }
+    }
+    CHECK(identical);
+}
@@ -0,0 +1,180 @@
+/**
+ * @file Palette_test.cpp
+ * @brief Tests for palette extraction, the palette LUT and dithering
+ */
+
+#include "doctest/doctest.h"
+#include "Headless/Dither.h"
+#include "Headless/Palette.h"
+#include "Headless/Parallel.h"
+#include "Shaders/PostProcessFusion.h"
+#include <algorithm>
+#include <random>
+#include <set>
+
+using namespace ElementalRenderer;
+
+namespace {
+
+float paletteError(const Image& image, const Palette& palette) {
+    double total = 0.0;
+    for (int y = 0; y < image.getHeight(); ++y) {
+        for (int x = 0; x < image.getWidth(); ++x) {
+            glm::vec3 c(image.at(x, y).x, image.at(x, y).y, image.at(x, y).z);
+            glm::vec3 d = c - palette[palette.findNearest(c)];
+            total += d.x * d.x + d.y * d.y + d.z * d.z;
+        }
+    }
+    return static_cast<float>(total / (image.getWidth() * image.getHeight()));
+}
+
+Image makeNoisyImage(int width, int height, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> jitter(-0.05f, 0.05f);
+    const glm::vec3 bases[5] = {glm::vec3(0.9f, 0.2f, 0.1f), glm::vec3(0.1f, 0.6f, 0.2f),
+                                glm::vec3(0.2f, 0.3f, 0.8f), glm::vec3(0.95f, 0.9f, 0.7f),
+                                glm::vec3(0.1f, 0.1f, 0.1f)};
+    Image image(width, height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            glm::vec3 c = bases[(x * 5) / width] + glm::vec3(jitter(rng), jitter(rng), jitter(rng));
+            image.at(x, y) = glm::vec4(glm::clamp(c, glm::vec3(0.0f), glm::vec3(1.0f)), 1.0f);
+        }
+    }
+    return image;
+}
+
+} // namespace
+
+TEST_CASE("Median cut recovers distinct colors and ignores transparent pixels") {
+    Image image(32, 32);
+    for (int y = 0; y < 32; ++y) {
+        for (int x = 0; x < 32; ++x) {
+            glm::vec3 c = x < 16 ? (y < 16 ? glm::vec3(1, 0, 0) : glm::vec3(0, 1, 0))
+                                 : (y < 16 ? glm::vec3(0, 0, 1) : glm::vec3(1, 1, 0));
+            image.at(x, y) = glm::vec4(c, 1.0f);
+        }
+    }
+    // A transparent magenta border must not claim a palette entry
+    for (int x = 0; x < 32; ++x) {
+        image.at(x, 0) = glm::vec4(1.0f, 0.0f, 1.0f, 0.0f);
+    }
+
+    Palette palette = Palette::medianCut(image, 8);
+    CHECK(palette.getSize() == 4);
+    for (const auto& c : palette.getColors()) {
+        CHECK(!(c.x > 0.99f && c.y < 0.01f && c.z > 0.99f));
+    }
+    CHECK(paletteError(image, palette) < 0.1f);
+    CHECK(Palette::medianCut(Image(), 4).isEmpty());
+}
+
+TEST_CASE("K-means refines median cut and is independent of the thread count") {
+    Image image = makeNoisyImage(200, 120, 7);
+
+    Palette seed = Palette::medianCut(image, 5);
+    int previousThreads = Parallel::getThreadCount();
+    Parallel::setThreadCount(1);
+    Palette serial = Palette::kMeans(image, 5);
+    Parallel::setThreadCount(4);
+    Palette parallel = Palette::kMeans(image, 5);
+    Parallel::setThreadCount(previousThreads);
+
+    REQUIRE(serial.getSize() == 5);
+    REQUIRE(parallel.getSize() == 5);
+    for (int i = 0; i < 5; ++i) {
+        CHECK(serial[i].x == parallel[i].x);
+        CHECK(serial[i].y == parallel[i].y);
+        CHECK(serial[i].z == parallel[i].z);
+    }
+    CHECK(paletteError(image, serial) <= paletteError(image, seed) + 1e-7f);
+}
+
+TEST_CASE("Palette LUT agrees with exhaustive search") {
+    Palette palette = Palette::kMeans(makeNoisyImage(64, 64, 3), 16);
+    PaletteLUT lut(palette, 32);
+    REQUIRE(lut.getResolution() == 32);
+
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    int agreements = 0;
+    const int trials = 20000;
+    float worstExcess = 0.0f;
+    for (int i = 0; i < trials; ++i) {
+        glm::vec3 c(unit(rng), unit(rng), unit(rng));
+        int exact = palette.findNearest(c);
+        int approximate = lut.lookupIndex(c);
+        agreements += exact == approximate ? 1 : 0;
+        // A miss can only pick a color that is nearly as close
+        worstExcess = std::max(worstExcess, glm::length(c - palette[approximate]) - glm::length(c - palette[exact]));
+    }
+    CHECK(agreements > trials * 9 / 10);
+    CHECK(worstExcess <= std::sqrt(3.0f) / 32.0f + 1e-5f);
+
+    std::vector<unsigned char> texels;
+    lut.toRGB8(texels);
+    CHECK(texels.size() == 32u * 32u * 32u * 3u);
+    CHECK(Palette::cga().getSize() == 16);
+}
+
+TEST_CASE("Ordered dithering matches the shader and blue noise is a balanced permutation") {
+    Image image(13, 9);
+    for (int y = 0; y < 9; ++y) {
+        for (int x = 0; x < 13; ++x) {
+            image.at(x, y) = glm::vec4(x / 13.0f, y / 9.0f, 0.37f, 1.0f);
+        }
+    }
+    Image fused = image;
+    Dither::quantize(image, 5, DitherPattern::BAYER);
+    PostProcessFusion::execute(PostProcessFusion::plan({PostProcessStage::quantize(5, true)}), fused);
+    for (int y = 0; y < 9; ++y) {
+        for (int x = 0; x < 13; ++x) {
+            CHECK(image.at(x, y).x == fused.at(x, y).x);
+            CHECK(image.at(x, y).z == fused.at(x, y).z);
+        }
+    }
+
+    const std::vector<float>& noise = Dither::getBlueNoise();
+    REQUIRE(noise.size() == static_cast<size_t>(Dither::kBlueNoiseSize * Dither::kBlueNoiseSize));
+    CHECK(std::set<float>(noise.begin(), noise.end()).size() == noise.size());
+
+    // Blue noise has little low-frequency energy: every 8x8 block averages near 0.5
+    float worstBlock = 0.0f;
+    for (int by = 0; by < Dither::kBlueNoiseSize; by += 8) {
+        for (int bx = 0; bx < Dither::kBlueNoiseSize; bx += 8) {
+            float sum = 0.0f;
+            for (int y = by; y < by + 8; ++y) {
+                for (int x = bx; x < bx + 8; ++x) {
+                    sum += Dither::threshold(DitherPattern::BLUE_NOISE, x, y);
+                }
+            }
+            worstBlock = std::max(worstBlock, std::abs(sum / 64.0f - 0.5f));
+        }
+    }
+    CHECK(worstBlock < 0.06f);
+}
+
+TEST_CASE("Palette dithering preserves average intensity") {
+    PaletteLUT lut(Palette({glm::vec3(0.0f), glm::vec3(1.0f)}), 16);
+
+    auto meanRed = [](const Image& image) {
+        double sum = 0.0;
+        for (int y = 0; y < image.getHeight(); ++y) {
+            for (int x = 0; x < image.getWidth(); ++x) {
+                float r = image.at(x, y).x;
+                CHECK((r == 0.0f || r == 1.0f));
+                sum += r;
+            }
+        }
+        return sum / (image.getWidth() * image.getHeight());
+    };
+
+    Image diffused(64, 64, glm::vec4(0.3f, 0.3f, 0.3f, 1.0f));
+    Dither::errorDiffuse(diffused, lut);
+    CHECK(meanRed(diffused) == doctest::Approx(0.3).epsilon(0.05));
+
+    Image ordered(64, 64, glm::vec4(0.3f, 0.3f, 0.3f, 0.5f));
+    Dither::mapToPalette(ordered, lut, DitherPattern::BLUE_NOISE, 1.0f);
+    CHECK(meanRed(ordered) == doctest::Approx(0.3).epsilon(0.05));
+    CHECK(ordered.at(5, 5).w == doctest::Approx(0.5f));
+}
@@ -0,0 +1,242 @@
+/**
+ * @file PathTracer_test.cpp
+ * @brief Tests for the triangle BVH and the progressive CPU path tracer
+ */
+
+#include "doctest/doctest.h"
+#include "PathTracing/PathTracer.h"
+#include "Headless/LTC.h"
+#include "Headless/Parallel.h"
+#include <cmath>
+#include <random>
+#include <glm/gtc/matrix_transform.hpp>
+
+using namespace ElementalRenderer;
+
+namespace {
+
+const float kPi = 3.14159265358979f;
+
+// Lambertian surface: the empty custom BRDF callback is calculateCustomBRDF's default
+PathTracerMaterial lambert(float albedo) {
+    PathTracerMaterial material;
+    material.model = BRDFModel::CUSTOM;
+    material.brdf.albedo = glm::vec3(albedo);
+    return material;
+}
+
+// Square in the y = height plane facing +y
+void addFloor(PathTracerScene& scene, float halfSize, float height, const PathTracerMaterial& material) {
+    const std::vector<glm::vec3> positions = {
+        glm::vec3(-halfSize, height, -halfSize), glm::vec3(halfSize, height, -halfSize),
+        glm::vec3(halfSize, height, halfSize), glm::vec3(-halfSize, height, halfSize)};
+    const std::vector<glm::vec3> normals(4, glm::vec3(0.0f, 1.0f, 0.0f));
+    scene.addMesh(positions, normals, {0, 2, 1, 0, 3, 2}, material);
+}
+
+// Orthographic camera looking straight down at [-extent, extent]^2 of the floor
+void lookDown(PathTracer& tracer, float extent) {
+    const glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 10.0f, 0.0f), glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f));
+    tracer.setCamera(view, glm::ortho(-extent, extent, -extent, extent, 0.1f, 100.0f));
+}
+
+} // namespace
+
+TEST_CASE("Triangle BVH matches brute-force intersection") {
+    std::mt19937 random(3);
+    std::uniform_real_distribution<float> coordinate(-10.0f, 10.0f);
+    std::uniform_real_distribution<float> offset(-1.0f, 1.0f);
+    std::vector<glm::vec3> positions;
+    std::vector<unsigned int> indices;
+    for (unsigned int i = 0; i < 2000; ++i) {
+        const glm::vec3 center(coordinate(random), coordinate(random), coordinate(random));
+        for (int corner = 0; corner < 3; ++corner) {
+            positions.push_back(center + glm::vec3(offset(random), offset(random), offset(random)));
+            indices.push_back(3 * i + corner);
+        }
+    }
+    TriangleBVH bvh;
+    bvh.build(positions, indices);
+    CHECK(bvh.getTriangleCount() == 2000);
+    CHECK(bvh.getNodeCount() < 2000 / 2);
+
+    int hits = 0;
+    for (int i = 0; i < 500; ++i) {
+        Ray ray;
+        ray.origin = glm::vec3(coordinate(random), coordinate(random), coordinate(random)) * 1.5f;
+        ray.direction = glm::normalize(glm::vec3(offset(random), offset(random), offset(random)));
+
+        // Reference: closest hit over all triangles
+        float closest = ray.tMax;
+        uint32_t closestTriangle = 0;
+        for (uint32_t t = 0; t < 2000; ++t) {
+            const glm::vec3 p0 = positions[3 * t];
+            const glm::vec3 e1 = positions[3 * t + 1] - p0;
+            const glm::vec3 e2 = positions[3 * t + 2] - p0;
+            const glm::vec3 p = glm::cross(ray.direction, e2);
+            const float determinant = glm::dot(e1, p);
+            if (std::abs(determinant) < 1e-12f) {
+                continue;
+            }
+            const glm::vec3 s = ray.origin - p0;
+            const float u = glm::dot(s, p) / determinant;
+            const glm::vec3 q = glm::cross(s, e1);
+            const float v = glm::dot(ray.direction, q) / determinant;
+            const float distance = glm::dot(e2, q) / determinant;
+            if (u >= 0.0f && v >= 0.0f && u + v <= 1.0f && distance > 0.0f && distance < closest) {
+                closest = distance;
+                closestTriangle = t;
+            }
+        }
+
+        RayHit hit;
+        const bool found = bvh.intersect(ray, hit);
+        REQUIRE(found == (closest < ray.tMax));
+        CHECK(bvh.occluded(ray) == found);
+        if (found) {
+            ++hits;
+            CHECK(hit.triangle == closestTriangle);
+            CHECK(hit.t == doctest::Approx(closest).epsilon(1e-4));
+
+            // The segment up to just before the hit is free
+            ray.tMax = hit.t * 0.999f;
+            CHECK_FALSE(bvh.occluded(ray));
+        }
+    }
+    CHECK(hits > 50);
+}
+
+TEST_CASE("Path tracer direct lighting matches the analytic result") {
+    PathTracerSettings settings;
+    settings.width = 8;
+    settings.height = 8;
+    settings.maxBounces = 0;
+
+    // A point light above a Lambertian floor, with the rasterizer's attenuation
+    PathTracerScene scene;
+    addFloor(scene, 4.0f, 0.0f, lambert(0.5f));
+    PathTracerLight light;
+    light.position = glm::vec3(0.0f, 2.0f, 0.0f);
+    light.radiance = glm::vec3(3.0f);
+    scene.lights.push_back(light);
+
+    PathTracer tracer;
+    tracer.setSettings(settings);
+    tracer.setScene(scene);
+    Ray ray;
+    ray.origin = glm::vec3(1.0f, 5.0f, 0.5f);
+    ray.direction = glm::vec3(0.0f, -1.0f, 0.0f);
+    const glm::vec3 toLight = light.position - glm::vec3(1.0f, 0.0f, 0.5f);
+    const float distance = glm::length(toLight);
+    const float cosine = toLight.y / distance;
+    const float expected = 0.5f / kPi * cosine * 3.0f / (1.0f + 0.09f * distance + 0.032f * distance * distance);
+    CHECK(tracer.tracePath(ray, 0, 0).x == doctest::Approx(expected).epsilon(1e-4));
+
+    // An occluder between floor and light casts a shadow
+    const std::vector<glm::vec3> blocker = {glm::vec3(-2.0f, 1.0f, -2.0f), glm::vec3(2.0f, 1.0f, -2.0f), glm::vec3(0.0f, 1.0f, 3.0f)};
+    scene.addMesh(blocker, {}, {0, 1, 2}, lambert(0.5f));
+    tracer.setScene(scene);
+    ray.origin.y = 0.5f;
+    CHECK(tracer.tracePath(ray, 0, 0).x == 0.0f);
+
+    // A rectangle area light converges to albedo * radiance * form factor
+    PathTracerScene areaScene;
+    addFloor(areaScene, 4.0f, 0.0f, lambert(0.8f));
+    PathTracerLight area;
+    area.type = PathTracerLight::Type::AREA;
+    area.position = glm::vec3(0.3f, 1.0f, -0.2f);
+    area.axisX = glm::vec3(0.0f, 0.0f, 0.7f);
+    area.axisY = glm::vec3(0.5f, 0.0f, 0.0f);
+    area.radiance = glm::vec3(2.0f);
+    areaScene.lights.push_back(area);
+    tracer.setScene(areaScene);
+    lookDown(tracer, 1.0f);
+    for (int pass = 0; pass < 1024; ++pass) {
+        REQUIRE(tracer.renderPass());
+    }
+    const Image image = tracer.getImage();
+    double error = 0.0;
+    for (int y = 0; y < settings.height; ++y) {
+        for (int x = 0; x < settings.width; ++x) {
+            // Pixel centers, with the jitter averaged out over the passes
+            const glm::vec3 point(2.0f * (x + 0.5f) / settings.width - 1.0f, 0.0f, 1.0f - 2.0f * (y + 0.5f) / settings.height);
+            glm::vec3 polygon[4];
+            LTC::rectanglePolygon(area.position - point, area.axisX, area.axisY, polygon);
+            // Rotate so the floor normal is +z, as integratePolygon expects
+            for (glm::vec3& vertex : polygon) {
+                vertex = glm::vec3(vertex.x, -vertex.z, vertex.y);
+            }
+            const float formFactor = LTC::integratePolygon(polygon, 4, true);
+            error += std::abs(image.at(x, y).x / (0.8f * 2.0f * formFactor) - 1.0f);
+        }
+    }
+    CHECK(error / (settings.width * settings.height) < 0.03);
+}
+
+TEST_CASE("Path tracer output is deterministic, progressive and cancellable") {
+    PathTracerSettings settings;
+    settings.width = 24;
+    settings.height = 16;
+    settings.tileSize = 8;
+    settings.maxBounces = 3;
+
+    // Floor and a wall under a sky and a point light, so paths bounce
+    PathTracerScene scene;
+    addFloor(scene, 3.0f, 0.0f, lambert(0.7f));
+    PathTracerMaterial wall;
+    wall.brdf.albedo = glm::vec3(0.9f, 0.2f, 0.2f);
+    wall.brdf.roughness = 0.4f;
+    scene.addMesh({glm::vec3(-3.0f, 0.0f, -1.0f), glm::vec3(3.0f, 0.0f, -1.0f), glm::vec3(3.0f, 3.0f, -1.0f), glm::vec3(-3.0f, 3.0f, -1.0f)},
+                  {}, {0, 1, 2, 0, 2, 3}, wall);
+    PathTracerLight light;
+    light.position = glm::vec3(0.5f, 2.0f, 1.0f);
+    light.radiance = glm::vec3(4.0f);
+    scene.lights.push_back(light);
+    scene.environment = glm::vec3(0.2f, 0.3f, 0.5f);
+
+    auto render = [&](uint32_t seed, int passes) {
+        PathTracer tracer;
+        settings.seed = seed;
+        tracer.setSettings(settings);
+        tracer.setScene(scene);
+        tracer.setCamera(glm::lookAt(glm::vec3(0.0f, 1.5f, 5.0f), glm::vec3(0.0f, 0.5f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f)),
+                         glm::perspective(glm::radians(60.0f), 1.5f, 0.1f, 50.0f));
+        for (int pass = 0; pass < passes; ++pass) {
+            tracer.renderPass();
+        }
+        CHECK(tracer.getSampleCount() == passes);
+        return tracer.getImage();
+    };
+    auto difference = [&](const Image& a, const Image& b) {
+        double sum = 0.0;
+        for (int y = 0; y < settings.height; ++y) {
+            for (int x = 0; x < settings.width; ++x) {
+                sum += std::abs(a.at(x, y).x - b.at(x, y).x) + std::abs(a.at(x, y).z - b.at(x, y).z);
+            }
+        }
+        return sum;
+    };
+
+    const Image first = render(7, 4);
+    const unsigned int threads = Parallel::getThreadCount();
+    Parallel::setThreadCount(1);
+    const Image singleThreaded = render(7, 4);
+    Parallel::setThreadCount(threads);
+    CHECK(difference(first, singleThreaded) == 0.0);
+    CHECK(difference(first, render(8, 4)) > 0.0);
+
+    // More samples move the image towards the converged one
+    const Image reference = render(1, 256);
+    CHECK(difference(render(2, 64), reference) < 0.6 * difference(render(2, 4), reference));
+
+    // A cancelled pass leaves the accumulated samples untouched
+    PathTracer tracer;
+    tracer.setSettings(settings);
+    tracer.setScene(scene);
+    REQUIRE(tracer.renderPass());
+    tracer.cancel();
+    CHECK_FALSE(tracer.renderPass());
+    CHECK(tracer.getSampleCount() == 1);
+    CHECK(tracer.renderPass());
+    CHECK(tracer.getSampleCount() == 2);
+}
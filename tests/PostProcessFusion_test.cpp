@@ -0,0 +1,172 @@
+/**
+ * @file PostProcessFusion_test.cpp
+ * @brief Tests for the post-processing fusion planner and its CPU kernels
+ */
+
+#include "doctest/doctest.h"
+#include "Shaders/PostProcessFusion.h"
+#include "Headless/CPUPostProcessor.h"
+#include <algorithm>
+#include <string>
+
+using namespace ElementalRenderer;
+
+namespace {
+
+Image makeGradient(int width, int height) {
+    Image image(width, height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            float checker = ((x / 5 + y / 5) % 2) ? 1.7f : 0.2f;
+            image.at(x, y) = glm::vec4(static_cast<float>(x) / width * 2.0f,
+                                       static_cast<float>(y) / height,
+                                       checker,
+                                       0.5f);
+        }
+    }
+    return image;
+}
+
+float maxDifference(const Image& a, const Image& b) {
+    float worst = 0.0f;
+    for (int y = 0; y < a.getHeight(); ++y) {
+        for (int x = 0; x < a.getWidth(); ++x) {
+            glm::vec4 d = glm::abs(a.at(x, y) - b.at(x, y));
+            worst = std::max(worst, std::max(std::max(d.x, d.y), std::max(d.z, d.w)));
+        }
+    }
+    return worst;
+}
+
+size_t countOccurrences(const std::string& text, const std::string& pattern) {
+    size_t count = 0;
+    for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1)) {
+        ++count;
+    }
+    return count;
+}
+
+} // namespace
+
+TEST_CASE("Consecutive per-pixel stages fuse into one pass") {
+    std::vector<PostProcessStage> stages = {
+        PostProcessStage::toneMap(ToneMapOperator::ACES, 1.2f),
+        PostProcessStage::grayscale(0.5f),
+        PostProcessStage::vignette(1.0f),
+        PostProcessStage::quantize(8, true),
+        PostProcessStage::grayscale(0.25f)
+    };
+
+    PostProcessPlan plan = PostProcessFusion::plan(stages);
+    REQUIRE(plan.passes.size() == 1);
+    CHECK(plan.passes[0].stages.size() == 5);
+    CHECK(plan.unfusedPassCount == 5);
+
+    // Five full-screen RGBA16F passes at 4K collapse to one
+    CHECK(plan.estimateUnfusedBandwidth(3840, 2160) == doctest::Approx(5.0 * plan.estimateBandwidth(3840, 2160)));
+}
+
+TEST_CASE("Neighbourhood and custom stages split passes") {
+    std::vector<PostProcessStage> stages = {
+        PostProcessStage::chromaticAberration(0.5f),
+        PostProcessStage::grayscale(1.0f),
+        PostProcessStage::vignette(1.0f),
+        PostProcessStage::blur(0.5f),
+        PostProcessStage::toneMap(ToneMapOperator::REINHARD, 1.0f),
+        PostProcessStage::custom("Outline"),
+        PostProcessStage::grayscale(1.0f)
+    };
+
+    PostProcessPlan plan = PostProcessFusion::plan(stages);
+    REQUIRE(plan.passes.size() == 4);
+    CHECK(plan.passes[0].stageIndices == std::vector<int>{0, 1, 2});
+    CHECK(plan.passes[1].stageIndices == std::vector<int>{3, 4});
+    CHECK(plan.passes[2].isCustom());
+    CHECK(plan.passes[3].stageIndices == std::vector<int>{6});
+
+    CHECK(PostProcessFusion::plan({}).passes.empty());
+    CHECK(PostProcessFusion::plan(PostProcessFusion::pixelArtStages(4, 5, true)).passes.size() == 1);
+}
+
+TEST_CASE("Fused CPU execution matches stage-by-stage execution") {
+    std::vector<PostProcessStage> stages = {
+        PostProcessStage::chromaticAberration(0.7f),
+        PostProcessStage::toneMap(ToneMapOperator::ACES, 1.5f),
+        PostProcessStage::vignette(1.3f),
+        PostProcessStage::blur(0.8f),
+        PostProcessStage::grayscale(0.4f),
+        PostProcessStage::pixelate(3),
+        PostProcessStage::quantize(6, true),
+        PostProcessStage::toneMap(ToneMapOperator::REINHARD, 0.8f)
+    };
+
+    Image fused = makeGradient(97, 61);
+    Image unfused = fused;
+    PostProcessFusion::execute(PostProcessFusion::plan(stages), fused);
+    PostProcessFusion::executeUnfused(stages, unfused);
+    CHECK(maxDifference(fused, unfused) == 0.0f);
+
+    // Stages converted from a PostProcessShader chain reproduce its CPU kernels
+    std::vector<PostProcessStep> steps = {{PostProcessEffect::CHROMATIC_ABERRATION, 0.6f},
+                                          {PostProcessEffect::NONE, 1.0f},
+                                          {PostProcessEffect::GRAYSCALE, 0.7f},
+                                          {PostProcessEffect::VIGNETTE, 1.4f},
+                                          {PostProcessEffect::BLUR, 0.9f}};
+    Image reference = makeGradient(80, 45);
+    Image planned = reference;
+    CPUPostProcessor::applyChain(steps, reference);
+    PostProcessFusion::execute(PostProcessFusion::plan(PostProcessFusion::fromSteps(steps)), planned);
+    CHECK(maxDifference(reference, planned) < 1e-5f);
+}
+
+TEST_CASE("Per-pixel stages follow the shader formulas") {
+    Image image(4, 4, glm::vec4(0.3f, 1.0f, 1.0f, 0.5f));
+    PostProcessFusion::execute(PostProcessFusion::plan({PostProcessStage::quantize(4, false)}), image);
+    CHECK(image.at(1, 1).x == doctest::Approx(0.25f));
+    CHECK(image.at(1, 1).y == doctest::Approx(1.0f));
+    CHECK(image.at(1, 1).w == doctest::Approx(1.0f));
+
+    // Bayer threshold at (1, 0) is 8/16: 0.45 * 4 + 0.5 reaches the next level
+    Image dithered(4, 4, glm::vec4(0.45f, 0.0f, 0.0f, 1.0f));
+    PostProcessFusion::execute(PostProcessFusion::plan({PostProcessStage::quantize(4, true)}), dithered);
+    CHECK(dithered.at(0, 0).x == doctest::Approx(0.25f));
+    CHECK(dithered.at(1, 0).x == doctest::Approx(0.5f));
+
+    Image hdr(2, 2, glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
+    Image aces = hdr;
+    PostProcessFusion::execute(PostProcessFusion::plan({PostProcessStage::toneMap(ToneMapOperator::REINHARD, 1.0f)}), hdr);
+    PostProcessFusion::execute(PostProcessFusion::plan({PostProcessStage::toneMap(ToneMapOperator::ACES, 1.0f)}), aces);
+    CHECK(hdr.at(0, 0).x == doctest::Approx(0.5f));
+    CHECK(hdr.at(0, 0).w == doctest::Approx(0.5f));
+    CHECK(aces.at(0, 0).x == doctest::Approx(2.54f / 3.16f));
+}
+
+TEST_CASE("Generated shaders declare every uniform and only the helpers they use") {
+    PostProcessPlan plan = PostProcessFusion::plan({
+        PostProcessStage::pixelate(4),
+        PostProcessStage::quantize(5, true),
+        PostProcessStage::toneMap(ToneMapOperator::ACES, 1.0f),
+        PostProcessStage::vignette(0.9f)
+    });
+    REQUIRE(plan.passes.size() == 1);
+
+    const std::string source = PostProcessFusion::generateFragmentShader(plan.passes[0]);
+    CHECK(countOccurrences(source, "void main()") == 1);
+    CHECK(countOccurrences(source, "texture(screenTexture") == 1);
+    CHECK(countOccurrences(source, "ditherMatrix[16]") == 1);
+    CHECK(countOccurrences(source, "vec3 toneMapACES") == 1);
+    CHECK(countOccurrences(source, "toneMapReinhard") == 0);
+
+    auto uniforms = PostProcessFusion::getUniformValues(plan.passes[0]);
+    REQUIRE(uniforms.size() == 4);
+    CHECK(uniforms[0].first == "stage0PixelSize");
+    CHECK(uniforms[1].first == "stage1Levels");
+    CHECK(uniforms[3].second == doctest::Approx(0.9f));
+    for (const auto& uniform : uniforms) {
+        CHECK(countOccurrences(source, "uniform float " + uniform.first + ";") == 1);
+    }
+
+    PostProcessPass custom;
+    custom.stages.push_back(PostProcessStage::custom("Outline"));
+    CHECK(PostProcessFusion::generateFragmentShader(custom).empty());
+}
@@ -0,0 +1,142 @@
+/**
+ * @file ScenePicker_test.cpp
+ * @brief Tests for BVH picking and frustum selection
+ */
+
+#include "doctest/doctest.h"
+#include "GUI/ScenePicker.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+
+using namespace ElementalRenderer;
+
+namespace {
+
+// Unit cube around the origin
+void cubeGeometry(std::vector<glm::vec3>& positions, std::vector<unsigned int>& indices) {
+    for (int corner = 0; corner < 8; ++corner) {
+        positions.push_back(glm::vec3((corner & 1) ? 0.5f : -0.5f, (corner & 2) ? 0.5f : -0.5f, (corner & 4) ? 0.5f : -0.5f));
+    }
+    const unsigned int faces[6][4] = { {0, 2, 3, 1}, {4, 5, 7, 6}, {0, 1, 5, 4}, {2, 6, 7, 3}, {0, 4, 6, 2}, {1, 3, 7, 5} };
+    for (const auto& face : faces) {
+        indices.insert(indices.end(), { face[0], face[1], face[2], face[0], face[2], face[3] });
+    }
+}
+
+const BoundingBox kCubeBounds(glm::vec3(-0.5f), glm::vec3(0.5f));
+
+glm::vec3 gridPosition(uint32_t id) {
+    return glm::vec3(static_cast<float>(id % 10) * 3.0f - 13.5f, static_cast<float>(id / 10) * 3.0f - 13.5f, 0.0f);
+}
+
+// 10 x 10 cubes in the z = 0 plane, seen from +z
+struct PickerFixture {
+    ScenePicker picker;
+    glm::mat4 viewProjection;
+    int geometryRequests = 0;
+
+    PickerFixture() {
+        viewProjection = glm::perspective(glm::radians(60.0f), 1.0f, 0.1f, 100.0f)
+                       * glm::lookAt(glm::vec3(0.0f, 0.0f, 40.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        for (uint32_t id = 0; id < 100; ++id) {
+            picker.setObject(id, kCubeBounds, [this](std::vector<glm::vec3>& positions, std::vector<unsigned int>& indices) {
+                ++geometryRequests;
+                cubeGeometry(positions, indices);
+            }, glm::translate(glm::mat4(1.0f), gridPosition(id)));
+        }
+    }
+
+    glm::vec2 project(const glm::vec3& point) const {
+        const glm::vec4 clip = viewProjection * glm::vec4(point, 1.0f);
+        return glm::vec2(clip.x / clip.w, clip.y / clip.w);
+    }
+};
+
+} // namespace
+
+TEST_CASE("Picking finds the object, triangle and barycentrics under the cursor") {
+    PickerFixture fixture;
+    PickHit hit;
+    for (uint32_t id : { 0u, 37u, 99u }) {
+        const Ray ray = ScenePicker::unproject(fixture.viewProjection, fixture.project(gridPosition(id) + glm::vec3(0.2f, 0.1f, 0.5f)));
+        REQUIRE(fixture.picker.pick(ray, hit));
+        CHECK(hit.object == id);
+        CHECK(hit.position.z == doctest::Approx(0.5f).epsilon(1e-3));
+        CHECK(hit.position.x == doctest::Approx(gridPosition(id).x + 0.2f).epsilon(1e-3));
+        CHECK(hit.barycentrics.x + hit.barycentrics.y + hit.barycentrics.z == doctest::Approx(1.0f));
+        CHECK(hit.triangle / 2 == 1);   // The +z face
+    }
+    // Only the objects a ray reached had their triangle BVH built
+    CHECK(fixture.geometryRequests <= 6);
+    CHECK(fixture.picker.getCachedObjectCount() == static_cast<size_t>(fixture.geometryRequests));
+
+    // Between cubes the ray misses everything
+    CHECK_FALSE(fixture.picker.pick(ScenePicker::unproject(fixture.viewProjection, fixture.project(glm::vec3(-12.0f, -12.0f, 0.0f))), hit));
+
+    CHECK(ScenePicker::cursorToNDC(glm::vec2(0.0f, 0.0f), glm::ivec2(800, 600)) == glm::vec2(-1.0f, 1.0f));
+    CHECK(ScenePicker::cursorToNDC(glm::vec2(400.0f, 300.0f), glm::ivec2(800, 600)) == glm::vec2(0.0f, 0.0f));
+}
+
+TEST_CASE("Picking follows moved, edited and removed objects") {
+    PickerFixture fixture;
+    PickHit hit;
+    const glm::vec3 target = gridPosition(55);
+    const Ray ray = ScenePicker::unproject(fixture.viewProjection, fixture.project(target));
+    REQUIRE(fixture.picker.pick(ray, hit));
+    CHECK(hit.object == 55);
+    const int requests = fixture.geometryRequests;
+
+    // Moving another cube in front refits the tree and keeps the cached triangles
+    REQUIRE(fixture.picker.setTransform(3, glm::translate(glm::mat4(1.0f), target + glm::vec3(0.0f, 0.0f, 5.0f))));
+    REQUIRE(fixture.picker.pick(ray, hit));
+    CHECK(hit.object == 3);
+    CHECK(hit.position.z == doctest::Approx(5.5f).epsilon(1e-3));
+    CHECK(fixture.geometryRequests <= requests + 1);
+
+    // Invalidated geometry is fetched again on the next hit
+    const int beforeEdit = fixture.geometryRequests;
+    REQUIRE(fixture.picker.invalidateGeometry(3, kCubeBounds));
+    REQUIRE(fixture.picker.pick(ray, hit));
+    CHECK(fixture.geometryRequests == beforeEdit + 1);
+
+    REQUIRE(fixture.picker.removeObject(3));
+    CHECK_FALSE(fixture.picker.removeObject(3));
+    CHECK_FALSE(fixture.picker.setTransform(3, glm::mat4(1.0f)));
+    REQUIRE(fixture.picker.pick(ray, hit));
+    CHECK(hit.object == 55);
+    CHECK(fixture.picker.getObjectCount() == 99);
+
+    fixture.picker.clear();
+    CHECK_FALSE(fixture.picker.pick(ray, hit));
+}
+
+TEST_CASE("Rectangle and lasso selection use the selection frustum") {
+    PickerFixture fixture;
+
+    // Everything on screen
+    CHECK(fixture.picker.selectRectangle(fixture.viewProjection, glm::vec2(-1.0f), glm::vec2(1.0f)).size() == 100);
+
+    // A rectangle around the bottom-left 3 x 2 cubes, given corner first in either order
+    const glm::vec2 a = fixture.project(gridPosition(0) - glm::vec3(0.6f, 0.6f, 0.0f));
+    const glm::vec2 b = fixture.project(gridPosition(12) + glm::vec3(0.6f, 0.6f, 0.0f));
+    std::vector<uint32_t> selection = fixture.picker.selectRectangle(fixture.viewProjection, b, a);
+    std::sort(selection.begin(), selection.end());
+    CHECK(selection == std::vector<uint32_t>{ 0, 1, 2, 10, 11, 12 });
+
+    // A triangular lasso over the same cubes drops the corner cube 12 its hypotenuse misses
+    const glm::vec2 corner = fixture.project(gridPosition(0) - glm::vec3(1.0f, 1.0f, 0.0f));
+    const std::vector<glm::vec2> lasso = {
+        corner,
+        fixture.project(gridPosition(0) + glm::vec3(8.0f, -1.0f, 0.0f)),
+        fixture.project(gridPosition(0) + glm::vec3(-1.0f, 5.0f, 0.0f)),
+    };
+    selection = fixture.picker.selectLasso(fixture.viewProjection, lasso);
+    std::sort(selection.begin(), selection.end());
+    CHECK(selection == std::vector<uint32_t>{ 0, 1, 2, 10, 11 });
+    CHECK(fixture.picker.selectLasso(fixture.viewProjection, { corner, corner }).empty());
+
+    // Nothing behind the camera
+    const glm::mat4 away = glm::perspective(glm::radians(60.0f), 1.0f, 0.1f, 100.0f)
+                         * glm::lookAt(glm::vec3(0.0f, 0.0f, 40.0f), glm::vec3(0.0f, 0.0f, 80.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    CHECK(fixture.picker.selectRectangle(away, glm::vec2(-1.0f), glm::vec2(1.0f)).empty());
+}
@@ -0,0 +1,160 @@
+/**
+ * @file SceneSnapshot_test.cpp
+ * @brief Tests for the binary scene snapshot container
+ */
+
+#include "doctest/doctest.h"
+#include "SceneSnapshot.h"
+#include "Light.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+
+using namespace ElementalRenderer;
+
+namespace {
+
+void fillWriter(SceneSnapshotWriter& writer, int objectCount) {
+    SnapshotMaterial material;
+    material.name = writer.addString("Brick");
+    material.albedo = glm::vec3(0.6f, 0.3f, 0.2f);
+    material.roughness = 0.8f;
+    const uint32_t materialIndex = writer.addMaterial(material);
+
+    for (int i = 0; i < objectCount; ++i) {
+        SnapshotTransform transform;
+        transform.translation = glm::vec3(static_cast<float>(i), 0.0f, -1.0f);
+        transform.scale = glm::vec3(2.0f);
+
+        SnapshotMesh mesh;
+        mesh.name = writer.addString("Object" + std::to_string(i));
+        mesh.source = writer.addString("assets/crate.obj");
+        mesh.transform = writer.addTransform(transform);
+        mesh.material = materialIndex;
+        mesh.vertexCount = 24;
+        mesh.indexCount = 36;
+        writer.addMesh(mesh);
+    }
+
+    SnapshotLight light;
+    light.name = writer.addString("Window");
+    light.type = static_cast<uint32_t>(LightType::AREA);
+    light.shape = static_cast<uint32_t>(AreaLightShape::DISK);
+    light.flags = SnapshotLight::kTwoSided;
+    light.size = glm::vec2(2.0f, 1.0f);
+    light.intensity = 5.0f;
+    writer.addLight(light);
+
+    SnapshotEditorState state;
+    state.sceneName = writer.addString("Warehouse");
+    state.selectedObject = 3;
+    state.cameraPosition = glm::vec3(1.0f, 2.0f, 3.0f);
+    writer.setEditorState(state);
+}
+
+} // namespace
+
+TEST_CASE("Scene snapshots round trip through memory") {
+    SceneSnapshotWriter writer;
+    fillWriter(writer, 10);
+    // Repeated strings are stored once
+    CHECK(writer.addString("assets/crate.obj") == writer.addString("assets/crate.obj"));
+    CHECK(writer.addString("") == kSnapshotNone);
+
+    std::vector<uint8_t> buffer;
+    writer.writeToBuffer(buffer);
+    SceneSnapshot snapshot;
+    REQUIRE(snapshot.openBuffer(buffer));
+
+    const SnapshotView<SnapshotMesh> meshes = snapshot.getMeshes();
+    const SnapshotView<SnapshotTransform> transforms = snapshot.getTransforms();
+    REQUIRE(meshes.size() == 10);
+    REQUIRE(transforms.size() == 10);
+    CHECK(std::string(snapshot.getString(meshes[7].name)) == "Object7");
+    CHECK(meshes[7].source == meshes[2].source);
+    CHECK(transforms[meshes[7].transform].translation.x == 7.0f);
+    CHECK(transforms[meshes[7].transform].rotation.w == 1.0f);
+    CHECK(snapshot.getMaterials()[meshes[7].material].roughness == doctest::Approx(0.8f));
+
+    REQUIRE(snapshot.getLights().size() == 1);
+    const SnapshotLight& light = snapshot.getLights()[0];
+    CHECK(light.type == static_cast<uint32_t>(LightType::AREA));
+    CHECK((light.flags & SnapshotLight::kTwoSided) != 0);
+    CHECK((light.flags & SnapshotLight::kCastShadows) == 0);
+    CHECK(light.size.x == 2.0f);
+
+    SnapshotEditorState state;
+    REQUIRE(snapshot.getEditorState(state));
+    CHECK(std::string(snapshot.getString(state.sceneName)) == "Warehouse");
+    CHECK(state.selectedObject == 3);
+    CHECK(state.cameraPosition.z == 3.0f);
+    CHECK(std::string(snapshot.getString(kSnapshotNone)).empty());
+    CHECK(std::string(snapshot.getString(1u << 30)).empty());
+
+    snapshot.close();
+    CHECK_FALSE(snapshot.isOpen());
+    CHECK(snapshot.getMeshes().empty());
+}
+
+TEST_CASE("Scene snapshots are memory mapped from files") {
+    const std::string path = (std::filesystem::temp_directory_path() / "elemental_snapshot_test.bin").string();
+    std::remove(path.c_str());
+
+    SceneSnapshotWriter writer;
+    fillWriter(writer, 2000);
+    REQUIRE(writer.saveToFile(path));
+    // Saving again replaces the file and leaves no temporary behind
+    REQUIRE(writer.saveToFile(path));
+    CHECK_FALSE(std::filesystem::exists(path + ".tmp"));
+
+    SceneSnapshot snapshot;
+    REQUIRE(snapshot.open(path));
+    REQUIRE(snapshot.getMeshes().size() == 2000);
+    const SnapshotMesh& last = snapshot.getMeshes()[1999];
+    CHECK(std::string(snapshot.getString(last.name)) == "Object1999");
+    CHECK(snapshot.getTransforms()[last.transform].translation.x == 1999.0f);
+    snapshot.close();
+    std::remove(path.c_str());
+
+    CHECK_FALSE(snapshot.open(path));
+}
+
+TEST_CASE("Corrupt snapshots are rejected section by section") {
+    SceneSnapshotWriter writer;
+    fillWriter(writer, 4);
+    std::vector<uint8_t> buffer;
+    writer.writeToBuffer(buffer);
+
+    SceneSnapshot snapshot;
+    std::vector<uint8_t> badMagic = buffer;
+    badMagic[0] = 'X';
+    CHECK_FALSE(snapshot.openBuffer(badMagic));
+    std::vector<uint8_t> truncated(buffer.begin(), buffer.end() - 16);
+    CHECK_FALSE(snapshot.openBuffer(truncated));
+    CHECK_FALSE(snapshot.openBuffer(std::vector<uint8_t>()));
+
+    // A mesh pointing past the materials invalidates only the mesh section
+    SnapshotMesh broken;
+    broken.material = 5;
+    writer.addMesh(broken);
+    writer.writeToBuffer(buffer);
+    REQUIRE(snapshot.openBuffer(buffer));
+    CHECK(snapshot.getMeshes().empty());
+    CHECK(snapshot.getTransforms().size() == 4);
+    CHECK(snapshot.getLights().size() == 1);
+
+    // Strings without a terminator make every string read as empty
+    writer.clear();
+    fillWriter(writer, 1);
+    writer.writeToBuffer(buffer);
+    const std::string sceneName = "Warehouse";
+    auto found = std::search(buffer.begin(), buffer.end(), sceneName.begin(), sceneName.end());
+    REQUIRE(found != buffer.end());
+    *(found + static_cast<std::ptrdiff_t>(sceneName.size())) = 'X';
+    REQUIRE(snapshot.openBuffer(buffer));
+    SnapshotEditorState state;
+    CHECK_FALSE(snapshot.getEditorState(state));
+    CHECK(snapshot.getTransforms().size() == 1);
+}
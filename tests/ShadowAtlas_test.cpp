@@ -0,0 +1,212 @@
+/**
+ * @file ShadowAtlas_test.cpp
+ * @brief Tests for the shadow atlas allocator
+ */
+
+#include "doctest/doctest.h"
+#include "Shadows/ShadowAtlas.h"
+
+using namespace ElementalRenderer;
+
+namespace {
+
+bool overlaps(const ShadowAtlasTile& a, const ShadowAtlasTile& b) {
+    return a.x < b.x + b.size && b.x < a.x + a.size && a.y < b.y + b.size && b.y < a.y + a.size;
+}
+
+// Every allocated face lies inside the atlas and no two faces overlap
+bool isConsistent(const ShadowAtlas& atlas, const std::vector<ShadowAtlasRequest>& requests) {
+    std::vector<ShadowAtlasTile> tiles;
+    for (const ShadowAtlasRequest& request : requests) {
+        if (const ShadowAtlasAllocation* allocation = atlas.getAllocation(request.lightId)) {
+            for (const ShadowAtlasTile& tile : allocation->faces) {
+                if (tile.x < 0 || tile.y < 0 || tile.x + tile.size > atlas.getAtlasSize()
+                    || tile.y + tile.size > atlas.getAtlasSize() || tile.size != allocation->resolution) {
+                    return false;
+                }
+                tiles.push_back(tile);
+            }
+        }
+    }
+    for (size_t i = 0; i < tiles.size(); ++i) {
+        for (size_t j = i + 1; j < tiles.size(); ++j) {
+            if (overlaps(tiles[i], tiles[j])) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("Quadtree allocator splits, merges and reports fragmentation") {
+    ShadowAtlas atlas(8192, 64);
+    std::vector<ShadowAtlasTile> tiles(4);
+    for (ShadowAtlasTile& tile : tiles) {
+        REQUIRE(atlas.allocateTile(4096, tile));
+    }
+    ShadowAtlasTile extra;
+    CHECK_FALSE(atlas.allocateTile(64, extra));
+    CHECK(atlas.getStats().usedFraction == doctest::Approx(1.0f));
+
+    atlas.freeTile(tiles[1]);
+    std::vector<ShadowAtlasTile> small(64);
+    for (ShadowAtlasTile& tile : small) {
+        REQUIRE(atlas.allocateTile(500, tile)); // rounded up to 512
+        CHECK(tile.size == 512);
+    }
+    // Free every other small tile: half of the quadrant is free but scattered
+    for (size_t i = 0; i < small.size(); i += 2) {
+        atlas.freeTile(small[i]);
+    }
+    ShadowAtlasStats stats = atlas.getStats();
+    CHECK(stats.largestFreeTile == 512);
+    CHECK(stats.freeBlockCount == 32);
+    CHECK(stats.fragmentation == doctest::Approx(1.0f - 1.0f / 32.0f));
+
+    // Freeing everything merges back to a single root block
+    for (size_t i = 1; i < small.size(); i += 2) {
+        atlas.freeTile(small[i]);
+    }
+    atlas.freeTile(tiles[0]);
+    atlas.freeTile(tiles[2]);
+    atlas.freeTile(tiles[3]);
+    stats = atlas.getStats();
+    CHECK(stats.freeBlockCount == 1);
+    CHECK(stats.largestFreeTile == 8192);
+    CHECK(stats.fragmentation == doctest::Approx(0.0f));
+}
+
+TEST_CASE("Over a hundred lights share one atlas and stay in place across frames") {
+    ShadowAtlas atlas(8192, 64);
+    std::vector<ShadowAtlasRequest> requests;
+    for (size_t i = 0; i < 120; ++i) {
+        ShadowAtlasRequest request;
+        request.lightId = i;
+        request.screenCoverage = 0.002f + 0.0005f * static_cast<float>(i % 17);
+        request.faceCount = (i % 4 == 0) ? 6 : 1; // every fourth light is a point light
+        requests.push_back(request);
+    }
+
+    atlas.update(requests);
+    ShadowAtlasStats stats = atlas.getStats();
+    CHECK(stats.allocationCount == 120);
+    CHECK(stats.droppedCount == 0);
+    CHECK(stats.relocationCount == 120);
+    CHECK(isConsistent(atlas, requests));
+    CHECK(atlas.getAllocation(0)->faces.size() == 6);
+
+    const ShadowAtlasTile before = atlas.getAllocation(7)->faces[0];
+
+    // Same frame again, then a small coverage change inside the hysteresis band
+    atlas.update(requests);
+    CHECK(atlas.getStats().relocationCount == 0);
+    const int resolution = atlas.getAllocation(7)->resolution;
+    requests[7].screenCoverage *= 0.3f;
+    REQUIRE(atlas.chooseResolution(requests[7]) * 2 == resolution);
+    atlas.update(requests);
+    CHECK(atlas.getStats().relocationCount == 0);
+    CHECK(atlas.getAllocation(7)->faces[0].x == before.x);
+    CHECK(atlas.getAllocation(7)->faces[0].y == before.y);
+
+    // Removing lights releases their tiles without moving anyone else
+    requests.erase(requests.begin() + 50, requests.begin() + 60);
+    atlas.update(requests);
+    CHECK(atlas.getStats().relocationCount == 0);
+    CHECK(atlas.getAllocation(55) == nullptr);
+    CHECK(atlas.getStats().allocationCount == 110);
+
+    glm::vec4 uv = atlas.getUVTransform(before);
+    CHECK(uv.x == doctest::Approx(before.size / 8192.0f));
+    CHECK(uv.z == doctest::Approx(before.x / 8192.0f));
+}
+
+TEST_CASE("Resolution follows coverage and importance, and priority wins under pressure") {
+    ShadowAtlas atlas(4096, 128);
+    atlas.setFullCoverageResolution(2048);
+
+    ShadowAtlasRequest request;
+    request.screenCoverage = 1.0f;
+    CHECK(atlas.chooseResolution(request) == 2048);
+    request.screenCoverage = 0.25f;
+    CHECK(atlas.chooseResolution(request) == 1024);
+    request.importance = 2.0f;
+    CHECK(atlas.chooseResolution(request) == 2048);
+    request.maxResolution = 512;
+    CHECK(atlas.chooseResolution(request) == 512);
+    request.screenCoverage = 0.0f;
+    CHECK(atlas.chooseResolution(request) == 128);
+
+    // Fill the atlas with low-priority lights, then add an important one
+    std::vector<ShadowAtlasRequest> requests;
+    for (size_t i = 0; i < 4; ++i) {
+        ShadowAtlasRequest low;
+        low.lightId = i;
+        low.screenCoverage = 1.0f;
+        requests.push_back(low);
+    }
+    atlas.update(requests);
+    CHECK(atlas.getStats().usedFraction == doctest::Approx(1.0f));
+
+    ShadowAtlasRequest important;
+    important.lightId = 99;
+    important.screenCoverage = 1.0f;
+    important.importance = 4.0f;
+    requests.push_back(important);
+    atlas.update(requests);
+
+    REQUIRE(atlas.getAllocation(99) != nullptr);
+    CHECK(atlas.getAllocation(99)->resolution == 2048);
+    CHECK(isConsistent(atlas, requests));
+    // One low-priority light made room and found no space left to come back
+    ShadowAtlasStats stats = atlas.getStats();
+    CHECK(stats.allocationCount == 4);
+    CHECK(stats.droppedCount == 1);
+
+    // Once the important light shrinks, the dropped light returns at a reduced size
+    requests.back().importance = 1.0f;
+    requests.back().maxResolution = 1024;
+    atlas.update(requests);
+    stats = atlas.getStats();
+    CHECK(stats.allocationCount == 5);
+    CHECK(stats.droppedCount == 0);
+    CHECK(isConsistent(atlas, requests));
+}
+
+TEST_CASE("Oversized lights evicted under pressure are dropped, not left with empty allocations") {
+    ShadowAtlas atlas(4096, 128);
+    atlas.setFullCoverageResolution(2048);
+
+    std::vector<ShadowAtlasRequest> requests;
+    for (size_t i = 0; i < 4; ++i) {
+        ShadowAtlasRequest light;
+        light.lightId = i;
+        light.screenCoverage = 1.0f;
+        requests.push_back(light);
+    }
+    atlas.update(requests);
+    CHECK(atlas.getStats().usedFraction == doctest::Approx(1.0f));
+
+    // Light 0 now wants half its resolution, which hysteresis alone would not
+    // give up, and a more important light needs its space
+    requests[0].screenCoverage = 0.25f;
+    ShadowAtlasRequest important;
+    important.lightId = 99;
+    important.screenCoverage = 1.0f;
+    important.importance = 4.0f;
+    requests.push_back(important);
+    atlas.update(requests);
+
+    REQUIRE(atlas.getAllocation(99) != nullptr);
+    CHECK(atlas.getAllocation(0) == nullptr);
+    CHECK(isConsistent(atlas, requests));
+    ShadowAtlasStats stats = atlas.getStats();
+    CHECK(stats.allocationCount == 4);
+    CHECK(stats.droppedCount == 1);
+    for (const ShadowAtlasRequest& request : requests) {
+        if (const ShadowAtlasAllocation* allocation = atlas.getAllocation(request.lightId)) {
+            CHECK(allocation->faces.size() == static_cast<size_t>(request.faceCount));
+        }
+    }
+}
@@ -0,0 +1,113 @@
+/**
+ * @file ShadowCasterCache_test.cpp
+ * @brief Tests for static shadow caster caching
+ */
+
+#include "doctest/doctest.h"
+#include "Shadows/ShadowCasterCache.h"
+#include <glm/gtc/matrix_transform.hpp>
+
+using namespace ElementalRenderer;
+
+namespace {
+
+// Two side-by-side shadow views (e.g. two cascades) looking down -z
+const glm::mat4 kLeftView = glm::ortho(-10.0f, 0.0f, -10.0f, 10.0f, -100.0f, 100.0f);
+const glm::mat4 kRightView = glm::ortho(0.0f, 10.0f, -10.0f, 10.0f, -100.0f, 100.0f);
+
+BoundingBox boxAt(float x, float y) {
+    return BoundingBox(glm::vec3(x - 0.5f, y - 0.5f, -1.0f), glm::vec3(x + 0.5f, y + 0.5f, 1.0f));
+}
+
+} // namespace
+
+TEST_CASE("Static casters are drawn once and dynamic casters every frame") {
+    ShadowCasterCache cache;
+    for (int i = 0; i < 10; ++i) {
+        cache.setCaster(static_cast<size_t>(i), boxAt(-9.0f + 2.0f * i, 0.0f), true);
+    }
+    cache.setCaster(10, boxAt(-5.0f, 5.0f), false);
+
+    ShadowViewPlan plan = cache.prepareView(0, 0, kLeftView);
+    CHECK(plan.redrawStatic);
+    CHECK(plan.staticCasters.size() == 5);
+    CHECK(plan.dynamicCasters.size() == 1);
+
+    // Moving the dynamic caster around never touches the static layer
+    for (int frame = 0; frame < 5; ++frame) {
+        cache.setCaster(10, boxAt(-5.0f + 0.5f * frame, 5.0f), false);
+        plan = cache.prepareView(0, 0, kLeftView);
+        CHECK_FALSE(plan.redrawStatic);
+        CHECK(plan.staticCasters.empty());
+        CHECK(plan.dynamicCasters.size() == 1);
+    }
+
+    // Once the dynamic caster leaves the view it is culled
+    cache.setCaster(10, boxAt(5.0f, 5.0f), false);
+    CHECK(cache.prepareView(0, 0, kLeftView).dynamicCasters.empty());
+
+    const ShadowCacheStats& stats = cache.getStats();
+    CHECK(stats.viewsPrepared == 7);
+    CHECK(stats.staticRedraws == 1);
+    CHECK(stats.staticCastersDrawn == 5);
+    CHECK(stats.staticCastersSkipped == 30);
+}
+
+TEST_CASE("Static edits only invalidate the views they overlap") {
+    ShadowCasterCache cache;
+    cache.setCaster(0, boxAt(-5.0f, 0.0f), true);
+    cache.setCaster(1, boxAt(5.0f, 0.0f), true);
+    REQUIRE(cache.prepareView(0, 0, kLeftView).redrawStatic);
+    REQUIRE(cache.prepareView(0, 1, kRightView).redrawStatic);
+
+    // Moving a static caster within the right view leaves the left one cached
+    cache.setCaster(1, boxAt(6.0f, 0.0f), true);
+    CHECK_FALSE(cache.prepareView(0, 0, kLeftView).redrawStatic);
+    CHECK(cache.prepareView(0, 1, kRightView).redrawStatic);
+
+    // Moving it across the boundary dirties both
+    cache.setCaster(1, boxAt(-6.0f, 0.0f), true);
+    ShadowViewPlan left = cache.prepareView(0, 0, kLeftView);
+    CHECK(left.redrawStatic);
+    CHECK(left.staticCasters.size() == 2);
+    CHECK(cache.prepareView(0, 1, kRightView).redrawStatic);
+
+    // A changed light-space matrix or light edit re-renders as well
+    const glm::mat4 shifted = glm::ortho(-10.5f, -0.5f, -10.0f, 10.0f, -100.0f, 100.0f);
+    CHECK(cache.prepareView(0, 0, shifted).redrawStatic);
+    CHECK_FALSE(cache.prepareView(0, 0, shifted).redrawStatic);
+    cache.onSceneChange(SceneChange{SceneChangeType::LIGHT_CHANGED, 0});
+    CHECK(cache.prepareView(0, 0, shifted).redrawStatic);
+
+    // Another light's edits do not matter
+    cache.onSceneChange(SceneChange{SceneChangeType::LIGHT_CHANGED, 3});
+    CHECK_FALSE(cache.prepareView(0, 0, shifted).redrawStatic);
+}
+
+TEST_CASE("Scene removals shift mesh and light indices") {
+    ShadowCasterCache cache;
+    cache.setCaster(0, boxAt(-8.0f, 0.0f), true);
+    cache.setCaster(1, boxAt(5.0f, 0.0f), true);
+    cache.setCaster(2, boxAt(-2.0f, 0.0f), true);
+    REQUIRE(cache.prepareView(1, 0, kLeftView).redrawStatic);
+    REQUIRE(cache.prepareView(1, 1, kRightView).redrawStatic);
+
+    // Removing a mesh outside the left view keeps it cached but renumbers its list
+    cache.onSceneChange(SceneChange{SceneChangeType::MESH_REMOVED, 1});
+    CHECK_FALSE(cache.prepareView(1, 0, kLeftView).redrawStatic);
+    cache.invalidateAll();
+    ShadowViewPlan plan = cache.prepareView(1, 0, kLeftView);
+    REQUIRE(plan.staticCasters.size() == 2);
+    CHECK(plan.staticCasters[0] == 0);
+    CHECK(plan.staticCasters[1] == 1);
+
+    // Light 1 becomes light 0 once light 0 is removed, keeping its cached layer
+    cache.onSceneChange(SceneChange{SceneChangeType::LIGHT_REMOVED, 0});
+    CHECK_FALSE(cache.prepareView(0, 0, kLeftView).redrawStatic);
+    CHECK(cache.prepareView(1, 0, kLeftView).redrawStatic);
+
+    cache.onSceneChange(SceneChange{SceneChangeType::CLEARED, 0});
+    plan = cache.prepareView(0, 0, kLeftView);
+    CHECK(plan.redrawStatic);
+    CHECK(plan.staticCasters.empty());
+}